@@ -93,3 +93,13 @@ func readNextRecord(
 //
 //go:wasmimport redpanda_transform write_record
 func writeRecord(data unsafe.Pointer, length int32) int32
+
+// keepRecord writes the last record read back to the broker unchanged.
+//
+// The broker reuses the payload of the input record, so unlike writeRecord
+// nothing is copied out of the guest.
+//
+// Returns a negative number to indicate an error.
+//
+//go:wasmimport redpanda_transform keep_record
+func keepRecord() int32
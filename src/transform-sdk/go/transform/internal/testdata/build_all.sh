@@ -2,6 +2,7 @@
 
 PKGS=(
   identity
+  filter
   setup-panic
   transform-error
   transform-panic
@@ -48,14 +48,27 @@ func process(userTransformFunction OnRecordWrittenCallback) {
 	if userTransformFunction == nil {
 		panic("Invalid configuration, there is a nil registered user transform function")
 	}
+	run(func() { transformRecord(userTransformFunction) })
+}
+
+// run our filtering loop
+func processFilter(userFilterFunction OnRecordFilteredCallback) {
+	if userFilterFunction == nil {
+		panic("Invalid configuration, there is a nil registered user filter function")
+	}
+	run(func() { filterRecord(userFilterFunction) })
+}
+
+// process batches forever, calling handleRecord for every record read
+func run(handleRecord func()) {
 	checkAbiVersion()
 	for {
-		processBatch(userTransformFunction)
+		processBatch(handleRecord)
 	}
 }
 
-// process and transform a single batch
-func processBatch(userTransformFunction OnRecordWrittenCallback) {
+// process a single batch
+func processBatch(handleRecord func()) {
 	bufSize := int(readBatchHeader(
 		unsafe.Pointer(&currentHeader.baseOffset),
 		unsafe.Pointer(&currentHeader.recordCount),
@@ -93,22 +106,39 @@ func processBatch(userTransformFunction OnRecordWrittenCallback) {
 		if err != nil {
 			panic("deserializing record failed: " + err.Error())
 		}
-		rs, err := userTransformFunction(&e)
-		if err != nil {
-			panic("transforming record failed: " + err.Error())
-		}
-		if rs == nil {
-			continue
-		}
-		for _, r := range rs {
-			outbuf.Reset()
-			r.serializePayload(outbuf)
-			b := outbuf.ReadAll()
-			// Write the record back out to the broker
-			amt := int(writeRecord(unsafe.Pointer(&b[0]), int32(len(b))))
-			if amt != len(b) {
-				panic("writing record failed with errno: " + strconv.Itoa(amt))
-			}
+		handleRecord()
+	}
+}
+
+// transform the current record and write the results back out to the broker
+func transformRecord(userTransformFunction OnRecordWrittenCallback) {
+	rs, err := userTransformFunction(&e)
+	if err != nil {
+		panic("transforming record failed: " + err.Error())
+	}
+	for _, r := range rs {
+		outbuf.Reset()
+		r.serializePayload(outbuf)
+		b := outbuf.ReadAll()
+		// Write the record back out to the broker
+		amt := int(writeRecord(unsafe.Pointer(&b[0]), int32(len(b))))
+		if amt != len(b) {
+			panic("writing record failed with errno: " + strconv.Itoa(amt))
 		}
 	}
 }
+
+// filter the current record, the broker passes kept records along as is
+func filterRecord(userFilterFunction OnRecordFilteredCallback) {
+	keep, err := userFilterFunction(&e)
+	if err != nil {
+		panic("filtering record failed: " + err.Error())
+	}
+	if !keep {
+		return
+	}
+	amt := int(keepRecord())
+	if amt < 0 {
+		panic("keeping record failed with errno: " + strconv.Itoa(amt))
+	}
+}
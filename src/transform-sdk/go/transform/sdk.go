@@ -28,6 +28,19 @@ func OnRecordWritten(fn OnRecordWrittenCallback) {
 // OnRecordWrittenCallback is a callback to transform records after a write event happens in the input topic.
 type OnRecordWrittenCallback func(e WriteEvent) ([]Record, error)
 
+// OnRecordFiltered registers a callback to decide if a record written to the input topic is kept in the output topic.
+//
+// Kept records are passed along unchanged without being copied back to Redpanda, so a filter is cheaper
+// registered this way than as an OnRecordWritten callback.
+//
+// OnRecordFiltered should be called in a package's `main` function to register the filter function that will be applied.
+func OnRecordFiltered(fn OnRecordFilteredCallback) {
+	processFilter(fn)
+}
+
+// OnRecordFilteredCallback is a callback that returns true if the record of the write event should be kept.
+type OnRecordFilteredCallback func(e WriteEvent) (bool, error)
+
 // WriteEvent contains information about the write that took place,
 // namely it contains the record that was written.
 type WriteEvent interface {
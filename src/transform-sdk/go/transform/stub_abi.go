@@ -56,3 +56,7 @@ func readNextRecord(
 func writeRecord(buf unsafe.Pointer, len int32) int32 {
 	panic("stub")
 }
+
+func keepRecord() int32 {
+	panic("stub")
+}
@@ -17,15 +17,18 @@
 #include "archival/scrubber.h"
 #include "archival/segment_reupload.h"
 #include "archival/types.h"
+#include "bytes/iostream.h"
 #include "cloud_storage/async_manifest_view.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment.h"
 #include "cloud_storage/remote_segment_index.h"
+#include "cloud_storage/segment_key_filter.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
+#include "cloud_storage/upload_scheduler.h"
 #include "cloud_storage_clients/types.h"
 #include "cluster/archival_metadata_stm.h"
 #include "cluster/partition_manager.h"
@@ -219,9 +222,15 @@ ntp_archiver::ntp_archiver(
   , _sync_manifest_timeout(
       config::shard_local_cfg()
         .cloud_storage_readreplica_manifest_sync_timeout_ms.bind())
+  , _sync_manifest_max_interval(
+      config::shard_local_cfg()
+        .cloud_storage_readreplica_manifest_sync_max_interval_ms.bind())
   , _max_segments_pending_deletion(
       config::shard_local_cfg()
         .cloud_storage_max_segments_pending_deletion_per_partition.bind())
+  , _max_concurrent_uploads(
+      config::shard_local_cfg()
+        .cloud_storage_max_concurrent_uploads_per_partition.bind())
   , _housekeeping_interval(
       config::shard_local_cfg().cloud_storage_housekeeping_interval_ms.bind())
   , _housekeeping_jitter(_housekeeping_interval(), housekeeping_jit)
@@ -238,6 +247,8 @@ ntp_archiver::ntp_archiver(
   , _manifest_upload_interval(
       config::shard_local_cfg()
         .cloud_storage_manifest_max_upload_interval_sec.bind())
+  , _manifest_max_deltas(
+      config::shard_local_cfg().cloud_storage_manifest_max_deltas.bind())
   , _manifest_view(std::move(amv)) {
     _housekeeping_interval.watch([this] {
         _housekeeping_jitter = simple_time_jitter<ss::lowres_clock>{
@@ -315,6 +326,13 @@ void ntp_archiver::notify_leadership(std::optional<model::node_id> leader_id) {
     if (_scrubber) {
         _scrubber->set_enabled(is_leader);
     }
+
+    // Only the leader uploads, the followers would hold on to the buffers
+    _parent.log()->set_upload_buffering(
+      is_leader
+      && config::shard_local_cfg()
+             .cloud_storage_upload_buffer_memory_per_shard()
+           > 0);
 }
 
 ss::future<> ntp_archiver::upload_until_abort() {
@@ -601,9 +619,46 @@ ss::future<std::error_code> ntp_archiver::reset_scrubbing_metadata() {
     co_return error;
 }
 
+ss::future<std::vector<ntp_archiver::segment_key_lookup>>
+ntp_archiver::lookup_key(ss::sstring key) {
+    static constexpr size_t max_concurrent_downloads = 8;
+    ss::gate::holder holder(_gate);
+    const auto key_hash = cloud_storage::segment_key_filter::hash_key(key);
+
+    // Copy the metadata, the manifest may change while the filters are
+    // downloaded.
+    std::vector<segment_key_lookup> result;
+    for (const auto& meta : manifest()) {
+        result.push_back({.meta = meta});
+    }
+    co_await ss::max_concurrent_for_each(
+      result,
+      max_concurrent_downloads,
+      [this, key_hash](segment_key_lookup& lookup) -> ss::future<> {
+          retry_chain_node fib(
+            _conf->manifest_upload_timeout,
+            _conf->cloud_storage_initial_backoff,
+            &_rtcnode);
+          auto path = cloud_storage::generate_key_filter_path(
+            manifest().generate_segment_path(lookup.meta));
+          cloud_storage::segment_key_filter filter;
+          auto res = co_await _remote.download_key_filter(
+            get_bucket_name(), remote_segment_path(path), filter, fib);
+          if (res == cloud_storage::download_result::success) {
+              lookup.has_key_filter = true;
+              lookup.may_contain = filter.may_contain(key_hash);
+          }
+      });
+    co_return result;
+}
+
 ss::future<> ntp_archiver::upload_until_term_change() {
     ss::lowres_clock::duration backoff = _conf->upload_loop_initial_backoff;
 
+    // Another leader may have uploaded the manifest since our last term, the
+    // first upload of the term is never a delta.
+    _manifest_delta_base.reset();
+
     if (!_feature_table.local().is_active(
           features::feature::cloud_storage_manifest_format_v2)) {
         vlog(
@@ -752,6 +807,9 @@ ss::future<> ntp_archiver::upload_until_term_change() {
 }
 
 ss::future<> ntp_archiver::sync_manifest_until_term_change() {
+    // The manifest in the STM may have been replicated by another leader
+    _read_replica_manifest_etag = {};
+    _read_replica_idle_syncs = 0;
     while (can_update_archival_metadata()) {
         if (!_feature_table.local().is_active(
               features::feature::cloud_storage_manifest_format_v2)) {
@@ -786,29 +844,75 @@ ss::future<> ntp_archiver::sync_manifest_until_term_change() {
               "Successfuly downloaded manifest {}",
               manifest().get_manifest_path());
         }
-        co_await ss::sleep_abortable(_sync_manifest_timeout(), _as);
+        co_await ss::sleep_abortable(sync_manifest_interval(), _as);
+    }
+}
+
+ss::lowres_clock::duration ntp_archiver::sync_manifest_interval() const {
+    const ss::lowres_clock::duration base = _sync_manifest_timeout();
+    const auto max = _sync_manifest_max_interval();
+    if (!max.has_value() || *max <= base) {
+        return base;
     }
+    // Partitions which are written to rarely are checked less often
+    static constexpr size_t max_shift = 16;
+    const auto shift = std::min(_read_replica_idle_syncs, max_shift);
+    return std::min<ss::lowres_clock::duration>(base * (1ULL << shift), *max);
 }
 
 ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
     vlog(_rtclog.debug, "Downloading manifest in read-replica mode");
-    auto [m, res] = co_await download_manifest();
-    if (res != cloud_storage::download_result::success) {
-        vlog(
-          _rtclog.error,
-          "Failed to download partition manifest in read-replica mode");
-        co_return res;
-    } else {
-        if (m == _parent.archival_meta_stm()->manifest()) {
-            // TODO: This can be made more efficient by using a conditional GET:
-            // https://github.com/redpanda-data/redpanda/issues/11776
-            //
-            // Then, the GET can be adapted to return the raw buffer, so that we
-            // don't go through a deserialize/serialize cycle before writing the
-            // manifest back into a raft batch.
+    retry_chain_node fib(
+      _conf->manifest_upload_timeout,
+      _conf->cloud_storage_initial_backoff,
+      &_rtcnode);
+    const auto manifest_path = manifest().get_manifest_format_and_path().second;
+    auto [head_res, etag] = co_await _remote.object_etag(
+      get_bucket_name(),
+      cloud_storage::remote_segment_path{manifest_path()},
+      fib);
+    if (head_res != cloud_storage::download_result::success) {
+        etag = {};
+    }
+
+    std::optional<cloud_storage::partition_manifest> updated;
+    if (!etag.empty() && etag == _read_replica_manifest_etag) {
+        // The full manifest wasn't uploaded again since the last sync, only
+        // the deltas uploaded since then have to be downloaded.
+        if (_manifest_max_deltas() == 0) {
             vlog(_rtclog.debug, "Manifest has not changed, no sync required");
+            ++_read_replica_idle_syncs;
+            co_return cloud_storage::download_result::success;
+        }
+        auto m = manifest().clone();
+        auto res = co_await _remote.download_partition_manifest_deltas(
+          get_bucket_name(), m, fib);
+        if (res == cloud_storage::download_result::success) {
+            updated = std::move(m);
+        }
+    }
+    if (!updated.has_value()) {
+        auto [m, res] = co_await download_manifest();
+        if (res != cloud_storage::download_result::success) {
+            vlog(
+              _rtclog.error,
+              "Failed to download partition manifest in read-replica mode");
             co_return res;
         }
+        updated = std::move(m);
+    }
+
+    {
+        auto& m = *updated;
+        if (m == _parent.archival_meta_stm()->manifest()) {
+            // The GET could be adapted to return the raw buffer, so that we
+            // don't go through a deserialize/serialize cycle before writing
+            // the manifest back into a raft batch.
+            vlog(_rtclog.debug, "Manifest has not changed, no sync required");
+            _read_replica_manifest_etag = std::move(etag);
+            ++_read_replica_idle_syncs;
+            co_return cloud_storage::download_result::success;
+        }
 
         vlog(
           _rtclog.debug,
@@ -843,6 +947,8 @@ ss::future<cloud_storage::download_result> ntp_archiver::sync_manifest() {
         }
     }
 
+    _read_replica_manifest_etag = std::move(etag);
+    _read_replica_idle_syncs = 0;
     _last_sync_time = ss::lowres_clock::now();
     co_return cloud_storage::download_result::success;
 }
@@ -889,6 +995,7 @@ ss::future<> ntp_archiver::stop() {
     _uploads_active.broken();
     _leader_cond.broken();
     co_await _gate.close();
+    _parent.log()->set_upload_buffering(false);
 }
 
 const model::ntp& ntp_archiver::get_ntp() const { return _ntp; }
@@ -1075,8 +1182,10 @@ ss::future<cloud_storage::upload_result> ntp_archiver::upload_manifest(
       upload_insync_offset,
       manifest().get_manifest_path());
 
-    auto result = co_await _remote.upload_manifest(
-      get_bucket_name(), manifest(), fib);
+    auto result = _manifest_max_deltas() > 0
+                    ? co_await upload_manifest_or_delta(fib)
+                    : co_await _remote.upload_manifest(
+                      get_bucket_name(), manifest(), fib);
 
     if (result == cloud_storage::upload_result::success) {
         _last_manifest_upload_time = ss::lowres_clock::now();
@@ -1096,6 +1205,64 @@ ss::future<cloud_storage::upload_result> ntp_archiver::upload_manifest(
     co_return result;
 }
 
+ss::future<cloud_storage::upload_result>
+ntp_archiver::upload_manifest_or_delta(retry_chain_node& fib) {
+    // The manifest is serialized before the first scheduling point so the
+    // uploaded version matches the captured offsets exactly.
+    const auto& m = manifest();
+    manifest_delta_base uploaded{
+      .insync_offset = m.get_insync_offset(),
+      .last_offset = m.get_last_offset(),
+      .layout_id = m.layout_id(),
+    };
+
+    if (
+      _manifest_delta_base.has_value()
+      && _manifest_delta_base->layout_id == uploaded.layout_id
+      && _manifest_deltas.size() < _manifest_max_deltas()) {
+        auto delta = m.make_delta(
+          _manifest_delta_base->insync_offset,
+          _manifest_delta_base->last_offset);
+        cloud_storage_clients::object_key key{
+          m.get_manifest_delta_path(uploaded.insync_offset)()};
+        vlog(
+          _rtclog.debug,
+          "Uploading manifest delta with {} segments to {}",
+          delta.segments.size(),
+          key);
+        auto res = co_await _remote.upload_object(
+          get_bucket_name(),
+          key,
+          serde::to_iobuf(std::move(delta)),
+          fib,
+          "manifest-delta");
+        if (res == cloud_storage::upload_result::success) {
+            _manifest_delta_base = uploaded;
+            _manifest_deltas.push_back(std::move(key));
+        }
+        co_return res;
+    }
+
+    auto res = co_await _remote.upload_object(
+      get_bucket_name(),
+      cloud_storage_clients::object_key{m.get_manifest_path()()},
+      m.to_iobuf(),
+      fib,
+      "manifest");
+    if (res != cloud_storage::upload_result::success) {
+        co_return res;
+    }
+    _manifest_delta_base = uploaded;
+    if (!_manifest_deltas.empty()) {
+        // Deltas are part of the manifest only until it is uploaded in full,
+        // failing to remove them isn't an error.
+        auto deltas = std::exchange(_manifest_deltas, {});
+        std::ignore = co_await _remote.delete_objects(
+          get_bucket_name(), std::move(deltas), fib);
+    }
+    co_return res;
+}
+
 remote_segment_path ntp_archiver::segment_path_for_candidate(
   model::term_id archiver_term, const upload_candidate& candidate) {
     vassert(
@@ -1133,10 +1300,135 @@ split_segment_stream(
       std::move(std::get<0>(res)), std::move(std::get<1>(res)));
 }
 
+namespace {
+
+// This struct wraps a stream object and exposes the stream_provider
+// interface for compatibility with the remote object API.
+struct stream_wrapper final : public storage::stream_provider {
+    std::optional<ss::input_stream<char>> stream;
+
+    stream_wrapper(const stream_wrapper&) = delete;
+    stream_wrapper(stream_wrapper&&) = default;
+    stream_wrapper& operator=(const stream_wrapper&) = delete;
+    stream_wrapper& operator=(stream_wrapper&&) = default;
+
+    ~stream_wrapper() override = default;
+
+    explicit stream_wrapper(ss::input_stream<char> s)
+      : stream(std::move(s)) {}
+
+    ss::input_stream<char> take_stream() override {
+        vassert(stream.has_value(), "no stream to take");
+        ss::input_stream<char> s = std::move(stream.value());
+        stream = std::nullopt;
+        return s;
+    }
+
+    ss::future<> close() override {
+        if (stream.has_value()) {
+            co_await stream.value().close();
+        }
+        co_return;
+    }
+};
+
+// Reads the streams one after the other
+class concat_data_source final : public ss::data_source_impl {
+public:
+    explicit concat_data_source(std::vector<ss::input_stream<char>> streams)
+      : _streams(std::move(streams)) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        while (_current < _streams.size()) {
+            auto buf = co_await _streams[_current].read();
+            if (!buf.empty()) {
+                co_return buf;
+            }
+            co_await _streams[_current++].close();
+        }
+        co_return ss::temporary_buffer<char>{};
+    }
+
+    ss::future<> close() override {
+        for (; _current < _streams.size(); ++_current) {
+            co_await _streams[_current].close();
+        }
+    }
+
+private:
+    std::vector<ss::input_stream<char>> _streams;
+    size_t _current{0};
+};
+
+} // namespace
+
+/// The data of the candidate, read from the upload buffer of its segment if
+/// it was buffered or from the segment files, followed by the footer (the
+/// embedded segment index).
+struct ntp_archiver::upload_source {
+    const upload_candidate& candidate;
+    std::optional<iobuf> buffered;
+    iobuf footer;
+    ss::io_priority_class priority;
+
+    size_t size() const {
+        return candidate.content_length + footer.size_bytes();
+    }
+
+    /// Bytes [offset, offset + length) of the object
+    ss::input_stream<char> open(uint64_t offset, uint64_t length) {
+        const uint64_t data_size = candidate.content_length;
+        const uint64_t end = offset + length;
+        std::vector<ss::input_stream<char>> streams;
+        if (offset < data_size) {
+            const auto data_end = std::min(end, data_size);
+            if (buffered.has_value()) {
+                streams.push_back(make_iobuf_input_stream(
+                  buffered->share(offset, data_end - offset)));
+            } else if (offset == 0 && data_end == data_size) {
+                streams.push_back(
+                  storage::concat_segment_reader_view{
+                    candidate.sources,
+                    candidate.file_offset,
+                    candidate.final_file_offset,
+                    priority}
+                    .take_stream());
+            } else {
+                // Ranges are only read from single segment candidates, see
+                // multipart_upload_part_size.
+                vassert(
+                  candidate.sources.size() == 1,
+                  "range of a candidate with {} segments",
+                  candidate.sources.size());
+                const auto begin = candidate.file_offset + offset;
+                streams.push_back(
+                  storage::concat_segment_reader_view{
+                    candidate.sources,
+                    begin,
+                    begin + (data_end - offset),
+                    priority}
+                    .take_stream());
+            }
+        }
+        if (end > data_size) {
+            const auto footer_begin = offset > data_size ? offset - data_size
+                                                         : 0;
+            streams.push_back(make_iobuf_input_stream(
+              footer.share(footer_begin, end - data_size - footer_begin)));
+        }
+        if (streams.size() == 1) {
+            return std::move(streams.front());
+        }
+        return ss::input_stream<char>(ss::data_source(
+          std::make_unique<concat_data_source>(std::move(streams))));
+    }
+};
+
 ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
   const remote_segment_path& path,
-  upload_candidate candidate,
+  const upload_candidate& candidate,
   ss::input_stream<char> stream,
+  upload_source& source,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
     auto rtc = source_rtc.value_or(std::ref(_rtcnode));
     retry_chain_node fib(
@@ -1151,38 +1443,8 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
       [this]() { return upload_should_abort(); },
     };
 
-    // This struct wraps a stream object and exposes the stream_provider
-    // interface for compatibility with the remote object API.
-    struct stream_wrapper final : public storage::stream_provider {
-        std::optional<ss::input_stream<char>> stream;
-
-        stream_wrapper(const stream_wrapper&) = delete;
-        stream_wrapper(stream_wrapper&&) = default;
-        stream_wrapper& operator=(const stream_wrapper&) = delete;
-        stream_wrapper& operator=(stream_wrapper&&) = default;
-
-        ~stream_wrapper() override = default;
-
-        explicit stream_wrapper(ss::input_stream<char> s)
-          : stream(std::move(s)) {}
-
-        ss::input_stream<char> take_stream() override {
-            vassert(stream.has_value(), "no stream to take");
-            ss::input_stream<char> s = std::move(stream.value());
-            stream = std::nullopt;
-            return s;
-        }
-
-        ss::future<> close() override {
-            if (stream.has_value()) {
-                co_await stream.value().close();
-            }
-            co_return;
-        }
-    };
-
     std::optional<ss::input_stream<char>> stream_state = std::move(stream);
-    auto reset_func = [this, candidate, &stream_state] {
+    auto reset_func = [&stream_state, &source] {
         using provider_t = std::unique_ptr<storage::stream_provider>;
         // On first attempt to upload, the stream-ref passed in is used.
         if (stream_state.has_value()) {
@@ -1192,13 +1454,11 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
             stream_state = std::nullopt;
             return f;
         } else {
-            // On subsequent uploads, the segment is read again from disk
+            // On subsequent uploads, the segment is read again from disk or
+            // from its upload buffer
             return ss::make_ready_future<provider_t>(
-              std::make_unique<storage::concat_segment_reader_view>(
-                candidate.sources,
-                candidate.file_offset,
-                candidate.final_file_offset,
-                _conf->upload_io_priority));
+              std::make_unique<stream_wrapper>(
+                source.open(0, source.size())));
         }
     };
 
@@ -1207,7 +1467,7 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
         response = co_await _remote.upload_segment(
           get_bucket_name(),
           path,
-          candidate.content_length,
+          source.size(),
           std::move(reset_func),
           fib,
           lazy_abort_source);
@@ -1228,38 +1488,214 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
     co_return response;
 }
 
+/// Part size used to upload the candidate as a multipart upload, or nullopt
+/// if it is uploaded with a single request.
+static std::optional<size_t>
+multipart_upload_part_size(const upload_candidate& candidate) {
+    auto part_size
+      = config::shard_local_cfg().cloud_storage_multipart_upload_part_size();
+    // Parts are read from a single segment file. Candidates that span several
+    // segments are only created by reuploads and are sent as a single stream.
+    if (
+      !part_size.has_value() || candidate.sources.size() != 1
+      || candidate.content_length <= *part_size) {
+        return std::nullopt;
+    }
+    return part_size;
+}
+
+ss::future<cloud_storage::upload_result>
+ntp_archiver::do_upload_segment_multipart(
+  const remote_segment_path& path,
+  const upload_candidate& candidate,
+  size_t part_size,
+  upload_source& source,
+  std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
+    auto rtc = source_rtc.value_or(std::ref(_rtcnode));
+    retry_chain_node fib(
+      _conf->segment_upload_timeout,
+      _conf->cloud_storage_initial_backoff,
+      &rtc.get());
+    retry_chain_logger ctxlog(archival_log, fib, _ntp.path());
+
+    vlog(
+      ctxlog.debug,
+      "Uploading segment {} to {} in parts of {} bytes",
+      candidate,
+      path,
+      part_size);
+
+    auto lazy_abort_source = cloud_storage::lazy_abort_source{
+      [this]() { return upload_should_abort(); },
+    };
+
+    auto reset_func = [&source](uint64_t offset, uint64_t length) {
+        using provider_t = std::unique_ptr<storage::stream_provider>;
+        return ss::make_ready_future<provider_t>(
+          std::make_unique<stream_wrapper>(source.open(offset, length)));
+    };
+
+    const size_t concurrency
+      = config::shard_local_cfg().cloud_storage_multipart_upload_concurrency();
+    auto response = cloud_storage::upload_result::success;
+    try {
+        auto res = co_await _remote.upload_segment_multipart(
+          get_bucket_name(),
+          path,
+          source.size(),
+          part_size,
+          concurrency,
+          reset_func,
+          fib,
+          lazy_abort_source);
+        if (_probe) {
+            _probe->multipart_upload(res.parts, res.part_retries);
+        }
+        response = res.result;
+    } catch (const ss::gate_closed_exception&) {
+        response = cloud_storage::upload_result::cancelled;
+    } catch (const ss::abort_requested_exception&) {
+        response = cloud_storage::upload_result::cancelled;
+    } catch (const ss::broken_named_semaphore&) {
+        response = cloud_storage::upload_result::cancelled;
+    } catch (const std::exception& e) {
+        vlog(_rtclog.error, "failed to upload segment {}: {}", path, e);
+        response = cloud_storage::upload_result::failed;
+    }
+    co_return response;
+}
+
+/// The data of the candidate if all of it is in the upload buffer of its
+/// segment, see storage::segment::enable_upload_buffer
+static std::optional<iobuf> buffered_candidate_data(upload_candidate& c) {
+    if (c.sources.size() != 1) {
+        return std::nullopt;
+    }
+    return c.sources.front()->upload_buffer_range(
+      c.file_offset, c.final_file_offset);
+}
+
 static ss::sstring make_index_path(const remote_segment_path& segment_path) {
     return fmt::format("{}.index", segment_path().native());
 }
 
+cloud_storage::segment_name_format
+ntp_archiver::upload_segment_name_format() const {
+    // Readers which don't know about the embedded index would download it as
+    // a part of the segment data.
+    if (
+      config::shard_local_cfg().cloud_storage_embed_segment_index()
+      && _feature_table.local().is_active(
+        features::feature::cloud_storage_embedded_segment_index)) {
+        return cloud_storage::segment_name_format::v4;
+    }
+    return cloud_storage::segment_name_format::v3;
+}
+
 // from offset to offset (by record batch boundary)
 ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
   model::term_id archiver_term,
   upload_candidate candidate,
   std::vector<ss::rwlock::holder> segment_read_locks,
+  cloud_storage::segment_name_format sname_format,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
     vassert(
       candidate.remote_sources.empty(),
       "This method can only work with local segments");
 
-    auto [stream_upload, stream_index] = split_segment_stream(
-      candidate, _conf->upload_io_priority);
-
     auto path = segment_path_for_candidate(archiver_term, candidate);
 
-    auto upload_fut = do_upload_segment(
-      path, candidate, std::move(stream_upload), source_rtc);
+    // Spend the upload budget of the shard before reading the segment.
+    try {
+        co_await _remote.uploads().throttle(candidate.content_length, _as);
+    } catch (const ss::abort_requested_exception&) {
+        co_return cloud_storage::upload_result::cancelled;
+    } catch (const ss::broken_named_semaphore&) {
+        co_return cloud_storage::upload_result::cancelled;
+    }
 
+    // Recently appended data is uploaded from memory when the leader kept a
+    // copy of it, instead of being read back from the segment file.
+    upload_source source{
+      .candidate = candidate,
+      .buffered = buffered_candidate_data(candidate),
+      .priority = _conf->upload_io_priority};
+    if (source.buffered.has_value() && _probe) {
+        _probe->buffered_upload_bytes(source.buffered->size_bytes());
+    }
+    const auto data_size = candidate.content_length;
+    const bool embed_index = sname_format
+                             >= cloud_storage::segment_name_format::v4;
+    const auto part_size = multipart_upload_part_size(candidate);
     auto index_path = make_index_path(path);
-    auto make_idx_fut = make_segment_index(
-      candidate.starting_offset,
-      candidate.base_timestamp,
-      _rtclog,
-      index_path,
-      std::move(stream_index));
 
-    auto [upload_res, idx_res] = co_await ss::when_all_succeed(
-      std::move(upload_fut), std::move(make_idx_fut));
+    cloud_storage::upload_result upload_res{};
+    std::optional<make_segment_index_result> idx_res;
+    if (embed_index) {
+        // The index is a part of the object, it is built before the upload
+        idx_res = co_await make_segment_index(
+          candidate.starting_offset,
+          candidate.base_timestamp,
+          _rtclog,
+          index_path,
+          source.open(0, data_size));
+        if (!idx_res.has_value()) {
+            co_return cloud_storage::upload_result::failed;
+        }
+        source.footer = idx_res->index.to_iobuf();
+        if (part_size.has_value()) {
+            upload_res = co_await do_upload_segment_multipart(
+              path, candidate, *part_size, source, source_rtc);
+        } else {
+            upload_res = co_await do_upload_segment(
+              path,
+              candidate,
+              source.open(0, source.size()),
+              source,
+              source_rtc);
+        }
+    } else {
+        ss::input_stream<char> stream_index;
+        std::optional<ss::future<cloud_storage::upload_result>> upload_fut;
+        if (part_size.has_value()) {
+            // The parts read the segment on their own, the index is built
+            // from a separate read of the whole segment.
+            stream_index = source.open(0, data_size);
+            upload_fut = do_upload_segment_multipart(
+              path, candidate, *part_size, source, source_rtc);
+        } else if (source.buffered.has_value()) {
+            stream_index = source.open(0, data_size);
+            upload_fut = do_upload_segment(
+              path, candidate, source.open(0, data_size), source, source_rtc);
+        } else {
+            auto [stream_upload, stream_idx] = split_segment_stream(
+              candidate, _conf->upload_io_priority);
+            stream_index = std::move(stream_idx);
+            upload_fut = do_upload_segment(
+              path, candidate, std::move(stream_upload), source, source_rtc);
+        }
+
+        auto make_idx_fut = make_segment_index(
+          candidate.starting_offset,
+          candidate.base_timestamp,
+          _rtclog,
+          index_path,
+          std::move(stream_index));
+
+        std::tie(upload_res, idx_res) = co_await ss::when_all_succeed(
+          std::move(*upload_fut), std::move(make_idx_fut));
+    }
+
+    if (upload_res == cloud_storage::upload_result::success) {
+        // The uploaded bytes are no longer needed in memory
+        for (size_t i = 0; i + 1 < candidate.sources.size(); ++i) {
+            candidate.sources[i]->release_upload_buffer();
+        }
+        if (!candidate.sources.empty()) {
+            candidate.sources.back()->trim_upload_buffer(
+              candidate.final_file_offset);
+        }
+    }
 
     if (
       upload_res == cloud_storage::upload_result::success
@@ -1274,12 +1710,26 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
         // the read path will create the index on the fly while downloading the
         // segment, so it is okay to ignore the index upload failure, we still
         // want to advance the offsets because the segment did get uploaded.
-        std::ignore = co_await _remote.upload_object(
-          _conf->bucket_name,
-          cloud_storage_clients::object_key{index_path},
-          idx_res->index.to_iobuf(),
-          fib,
-          "segment-index");
+        if (!embed_index) {
+            std::ignore = co_await _remote.upload_object(
+              _conf->bucket_name,
+              cloud_storage_clients::object_key{index_path},
+              idx_res->index.to_iobuf(),
+              fib,
+              "segment-index");
+        }
+
+        // The key filter is an optimization for key lookups as well, the
+        // lookups treat segments without a filter as possible matches.
+        if (idx_res->key_filter.has_value()) {
+            std::ignore = co_await _remote.upload_object(
+              _conf->bucket_name,
+              cloud_storage_clients::object_key{
+                cloud_storage::generate_key_filter_path(path)},
+              std::move(*idx_res->key_filter).to_iobuf(),
+              fib,
+              "segment-key-filter");
+        }
 
         co_return ntp_archiver_upload_result(idx_res->stats);
     } else {
@@ -1406,13 +1856,21 @@ ntp_archiver::make_segment_index(
     vlog(ctxlog.debug, "creating remote segment index: {}", index_path);
     cloud_storage::segment_record_stats stats{};
 
+    std::optional<cloud_storage::segment_key_filter_builder> key_filter;
+    if (auto max_keys = config::shard_local_cfg()
+                          .cloud_storage_segment_key_filter_max_keys();
+        max_keys.has_value()) {
+        key_filter.emplace(*max_keys);
+    }
+
     auto builder = cloud_storage::make_remote_segment_index_builder(
       _ntp,
       std::move(stream),
       ix,
       base_rp_offset - base_kafka_offset,
       cloud_storage::remote_segment_sampling_step_bytes,
-      std::ref(stats));
+      std::ref(stats),
+      key_filter ? &*key_filter : nullptr);
 
     auto res = co_await builder->consume().finally(
       [&builder] { return builder->close(); });
@@ -1426,7 +1884,10 @@ ntp_archiver::make_segment_index(
         co_return std::nullopt;
     }
 
-    co_return make_segment_index_result{.index = std::move(ix), .stats = stats};
+    co_return make_segment_index_result{
+      .index = std::move(ix),
+      .stats = stats,
+      .key_filter = key_filter ? key_filter->build() : std::nullopt};
 }
 
 // The function turns an array of futures that return an error code into a
@@ -1468,8 +1929,9 @@ ntp_archiver::do_schedule_single_upload(
     // uploaded.
     std::vector<ss::future<ntp_archiver_upload_result>> all_uploads;
 
+    auto sname_format = upload_segment_name_format();
     all_uploads.emplace_back(
-      upload_segment(archiver_term, upload, std::move(locks)));
+      upload_segment(archiver_term, upload, std::move(locks), sname_format));
 
     ss::log_level level{};
     std::exception_ptr ep;
@@ -1525,7 +1987,7 @@ ntp_archiver::do_schedule_single_upload(
         .archiver_term = archiver_term,
         .segment_term = upload.term,
         .delta_offset_end = delta_offset_next,
-        .sname_format = cloud_storage::segment_name_format::v3,
+        .sname_format = sname_format,
         .metadata_size_hint = tx_size,
       },
       .name = upload.exposed_name, .delta = offset - base,
@@ -1659,7 +2121,7 @@ ntp_archiver::schedule_uploads(model::offset last_stable_offset) {
 ss::future<std::vector<ntp_archiver::scheduled_upload>>
 ntp_archiver::schedule_uploads(std::vector<upload_context> loop_contexts) {
     std::vector<scheduled_upload> scheduled_uploads;
-    auto uploads_remaining = _concurrency;
+    size_t uploads_remaining = _max_concurrent_uploads();
     for (auto& ctx : loop_contexts) {
         if (uploads_remaining <= 0) {
             vlog(
@@ -2028,6 +2490,10 @@ ss::future<ntp_archiver::batch_result> ntp_archiver::upload_next_candidates(
     ss::gate::holder holder(_gate);
     try {
         auto units = co_await ss::get_units(_mutex, 1, _as);
+        // Partitions which haven't uploaded for the longest time are admitted
+        // first when the number of concurrent uploads on the shard is capped.
+        auto permit = co_await _remote.uploads().acquire(
+          _last_segment_upload_time, _as);
         auto scheduled_uploads = co_await schedule_uploads(last_stable_offset);
         co_return co_await wait_all_scheduled_uploads(
           std::move(scheduled_uploads));
@@ -2319,13 +2785,15 @@ ss::future<> ntp_archiver::garbage_collect_archive() {
                       // Add index and tx-manifest
                       if (
                         meta.sname_format
-                          == cloud_storage::segment_name_format::v3
+                          >= cloud_storage::segment_name_format::v3
                         && meta.metadata_size_hint != 0) {
                           objects_to_remove.emplace_back(
                             cloud_storage::generate_remote_tx_path(path));
                       }
                       objects_to_remove.emplace_back(
                         cloud_storage::generate_index_path(path));
+                      objects_to_remove.emplace_back(
+                        cloud_storage::generate_key_filter_path(path));
                   } else {
                       // This indicates that we need to remove only some of the
                       // segments from the manifest. In this case the outer loop
@@ -2389,7 +2857,7 @@ ss::future<> ntp_archiver::garbage_collect_archive() {
       _conf->garbage_collect_timeout,
       _conf->cloud_storage_initial_backoff,
       &_rtcnode);
-    const auto delete_result = co_await _remote.delete_objects(
+    const auto delete_result = co_await _remote.delete_objects_coalesced(
       get_bucket_name(), objects_to_remove, fib);
     const auto backlog_size_exceeded = segments_to_remove_count
                                        > _max_segments_pending_deletion();
@@ -2413,7 +2881,12 @@ ss::future<> ntp_archiver::garbage_collect_archive() {
           "Failed to delete all selected segments from cloud storage. Will "
           "retry on the next housekeeping run.");
     }
-    if (all_deletes_succeeded || backlog_size_exceeded) {
+    if (
+      (all_deletes_succeeded || backlog_size_exceeded)
+      && _parent.archival_meta_stm()->defer_cleanup_metadata()) {
+        vlog(
+          _rtclog.debug, "Deferred metadata cleanup after garbage collection");
+    } else if (all_deletes_succeeded || backlog_size_exceeded) {
         auto sync_timeout = config::shard_local_cfg()
                               .cloud_storage_metadata_sync_timeout_ms.value();
         auto deadline = ss::lowres_clock::now() + sync_timeout;
@@ -2635,6 +3108,10 @@ ss::future<> ntp_archiver::apply_retention() {
           retention_calculator->strategy_name(),
           *next_start_offset);
 
+        if (_parent.archival_meta_stm()->defer_truncate(*next_start_offset)) {
+            co_return;
+        }
+
         auto sync_timeout = config::shard_local_cfg()
                               .cloud_storage_metadata_sync_timeout_ms.value();
         auto deadline = ss::lowres_clock::now() + sync_timeout;
@@ -2660,6 +3137,12 @@ ss::future<> ntp_archiver::garbage_collect() {
         co_return;
     }
 
+    // The segments were already removed, their metadata cleanup is waiting
+    // to be replicated with the next batch of archival metadata updates.
+    if (_parent.archival_meta_stm()->has_deferred_cleanup()) {
+        co_return;
+    }
+
     const auto to_remove
       = _parent.archival_meta_stm()->get_segments_to_cleanup();
 
@@ -2699,13 +3182,15 @@ ss::future<> ntp_archiver::garbage_collect() {
           cloud_storage::generate_remote_tx_path(path));
         objects_to_remove.emplace_back(
           cloud_storage::generate_index_path(path));
+        objects_to_remove.emplace_back(
+          cloud_storage::generate_key_filter_path(path));
     }
 
     retry_chain_node fib(
       _conf->garbage_collect_timeout,
       _conf->cloud_storage_initial_backoff,
       &_rtcnode);
-    const auto delete_result = co_await _remote.delete_objects(
+    const auto delete_result = co_await _remote.delete_objects_coalesced(
       get_bucket_name(), objects_to_remove, fib);
 
     const auto backlog_size_exceeded = to_remove.size()
@@ -2793,14 +3278,26 @@ ntp_archiver::find_reupload_candidate(manifest_scanner_t scanner) {
     if (run->meta.base_offset >= _parent.raft_start_offset()) {
         auto log_generic = _parent.log();
         auto& log = *log_generic;
+        // Segments of a compacted topic which are done with local compaction
+        // are merged in their compacted form. The merged object is smaller
+        // than the run because the local compaction already deduplicated the
+        // keys of the segments using its key offset map.
+        auto mode = segment_collector_mode::collect_non_compacted;
+        if (_parent.get_ntp_config().is_compacted()) {
+            auto it = log.segments().lower_bound(run->meta.base_offset);
+            if (
+              it != log.segments().end()
+              && archival_policy::eligible_for_compacted_reupload(**it)) {
+                mode = segment_collector_mode::collect_compacted;
+            }
+        }
         segment_collector collector(
           run->meta.base_offset,
           manifest(),
           log,
           run->meta.size_bytes,
           run->meta.committed_offset);
-        collector.collect_segments(
-          segment_collector_mode::collect_non_compacted);
+        collector.collect_segments(mode);
         auto candidate = co_await collector.make_upload_candidate(
           _conf->upload_io_priority, _conf->segment_upload_timeout);
 
@@ -2814,11 +3311,16 @@ ntp_archiver::find_reupload_candidate(manifest_scanner_t scanner) {
                 false,
                 "unexpected default re-upload candidate creation result");
           },
-          [this, &run, units = std::move(units)](
+          [this, &run, mode, units = std::move(units)](
             upload_candidate_with_locks& upload_candidate) mutable -> ret_t {
+              const auto size_mismatch
+                = mode == segment_collector_mode::collect_compacted
+                    ? upload_candidate.candidate.content_length
+                        > run->meta.size_bytes
+                    : upload_candidate.candidate.content_length
+                        != run->meta.size_bytes;
               if (
-                upload_candidate.candidate.content_length
-                  != run->meta.size_bytes
+                size_mismatch
                 || upload_candidate.candidate.starting_offset
                      != run->meta.base_offset
                 || upload_candidate.candidate.final_offset
@@ -2893,14 +3395,22 @@ ss::future<bool> ntp_archiver::do_upload_local(
     }
     auto [upload, locks] = std::move(upload_locks);
 
-    for (const auto& s : upload.sources) {
-        if (archival_policy::eligible_for_compacted_reupload(*s)) {
-            vlog(
-              _rtclog.warn,
-              "Upload {} requested contains compacted segments.",
-              upload.exposed_name);
-            co_return false;
-        }
+    // Compacted segments can only be merged with each other, and only if the
+    // topic is still compacted.
+    const auto num_compacted = static_cast<size_t>(std::count_if(
+      upload.sources.begin(), upload.sources.end(), [](const auto& s) {
+          return archival_policy::eligible_for_compacted_reupload(*s);
+      }));
+    const bool is_compacted = num_compacted > 0;
+    if (
+      is_compacted
+      && (num_compacted != upload.sources.size()
+          || !_parent.get_ntp_config().is_compacted())) {
+        vlog(
+          _rtclog.warn,
+          "Upload {} requested contains compacted segments.",
+          upload.exposed_name);
+        co_return false;
     }
 
     if (upload.sources.empty()) {
@@ -2920,8 +3430,9 @@ ss::future<bool> ntp_archiver::do_upload_local(
 
     // Upload segments and tx-manifest in parallel
     std::vector<ss::future<ntp_archiver_upload_result>> futures;
-    futures.emplace_back(
-      upload_segment(archiver_term, upload, std::move(locks), source_rtc));
+    auto sname_format = upload_segment_name_format();
+    futures.emplace_back(upload_segment(
+      archiver_term, upload, std::move(locks), sname_format, source_rtc));
 
     size_t tx_size = 0;
     std::exception_ptr tx_ep;
@@ -2957,7 +3468,7 @@ ss::future<bool> ntp_archiver::do_upload_local(
     }
 
     auto meta = cloud_storage::partition_manifest::segment_meta{
-      .is_compacted = false,
+      .is_compacted = is_compacted,
       .size_bytes = upload.content_length,
       .base_offset = upload.starting_offset,
       .committed_offset = offset,
@@ -2968,7 +3479,7 @@ ss::future<bool> ntp_archiver::do_upload_local(
       .archiver_term = archiver_term,
       .segment_term = upload.term,
       .delta_offset_end = delta_offset_next,
-      .sname_format = cloud_storage::segment_name_format::v3,
+      .sname_format = sname_format,
       .metadata_size_hint = tx_size,
     };
 
@@ -2976,7 +3487,9 @@ ss::future<bool> ntp_archiver::do_upload_local(
       = config::shard_local_cfg()
           .cloud_storage_disable_upload_consistency_checks.value();
 
-    if (!checks_disabled && upl_res.has_record_stats()) {
+    // Compaction removes batches, the first and the last batch of a merged
+    // compacted segment don't have to match the offset range.
+    if (!checks_disabled && !is_compacted && upl_res.has_record_stats()) {
         auto stats = upl_res.record_stats();
         // Validate segment content. The 'stats' is computed when
         // the actual segment is scanned and represents the 'ground truth' about
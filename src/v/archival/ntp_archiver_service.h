@@ -180,8 +180,9 @@ public:
 
     /// \brief Upload next set of segments to S3 (if any)
     /// The semaphore is used to track number of parallel uploads. The method
-    /// will pick not more than '_concurrency' candidates and start
-    /// uploading them.
+    /// will pick not more than '_max_concurrent_uploads' candidates and start
+    /// uploading them. The uploaded segments are added to the manifest in
+    /// offset order with a single archival metadata STM command.
     ///
     /// \param lso_override last stable offset override
     /// \return future that returns number of uploaded/failed segments
@@ -190,6 +191,9 @@ public:
 
     ss::future<cloud_storage::download_result> sync_manifest();
 
+    /// Time until the next sync of the read replica manifest
+    ss::lowres_clock::duration sync_manifest_interval() const;
+
     uint64_t estimate_backlog_size();
 
     /// \brief Probe remote storage and truncate the manifest if needed
@@ -350,6 +354,20 @@ public:
 
     ss::future<std::error_code> reset_scrubbing_metadata();
 
+    /// Outcome of a key lookup in one segment of the manifest
+    struct segment_key_lookup {
+        cloud_storage::segment_meta meta;
+        /// False if the key filter of the segment rules the key out
+        bool may_contain{true};
+        /// False if the segment has no key filter or it couldn't be fetched
+        bool has_key_filter{false};
+    };
+
+    /// Check the key filters of the segments in the STM manifest. The
+    /// segments which are ruled out don't have to be downloaded by tools
+    /// looking for the key.
+    ss::future<std::vector<segment_key_lookup>> lookup_key(ss::sstring key);
+
 private:
     // Labels for contexts in which manifest uploads occur. Used for logging.
     static constexpr const char* housekeeping_ctx_label = "housekeeping";
@@ -453,8 +471,8 @@ private:
     /// \param candidate is an upload candidate
     /// \param segment_read_locks protects the underlying segment(s) from being
     ///        deleted while the upload is in flight.
-    /// \param stream is a stream to the segment used for the initial upload. If
-    /// the upload is retried, the segment will be read again.
+    /// \param sname_format is the format of the segment object, the index is
+    ///        appended to the segment data with segment_name_format::v4
     /// \param source_rtc
     /// is a retry_chain_node of the caller, if it's set
     ///        to nullopt own retry chain of the ntp_archiver is used
@@ -463,16 +481,35 @@ private:
       model::term_id archiver_term,
       upload_candidate candidate,
       std::vector<ss::rwlock::holder> segment_read_locks,
+      cloud_storage::segment_name_format sname_format,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
+    /// Format of the segments uploaded from now on
+    cloud_storage::segment_name_format upload_segment_name_format() const;
+
+    /// Bytes of an uploaded segment object
+    struct upload_source;
+
     /// Isolates segment upload and accepts a stream reference, so that if the
     /// upload fails the exception can be handled in the caller and the stream
-    /// can be closed.
+    /// can be closed. The retries read the object from \p source.
     ss::future<cloud_storage::upload_result> do_upload_segment(
       const remote_segment_path& path,
-      upload_candidate candidate,
+      const upload_candidate& candidate,
       ss::input_stream<char> stream,
+      upload_source& source,
+      std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
+      = std::nullopt);
+
+    /// Upload the segment as a multipart upload. Every part is read from
+    /// \p source on its own, so parts can be uploaded and retried
+    /// independently of each other.
+    ss::future<cloud_storage::upload_result> do_upload_segment_multipart(
+      const remote_segment_path& path,
+      const upload_candidate& candidate,
+      size_t part_size,
+      upload_source& source,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
@@ -495,6 +532,8 @@ private:
     struct make_segment_index_result {
         cloud_storage::offset_index index;
         cloud_storage::segment_record_stats stats;
+        /// Present if key filters are enabled and the segment is small enough
+        std::optional<cloud_storage::segment_key_filter> key_filter;
     };
 
     /// Builds a segment index from the supplied input stream.
@@ -518,6 +557,12 @@ private:
     /// will have been updated if so)
     ss::future<bool> maybe_upload_manifest(const char* upload_ctx);
 
+    /// Upload the manifest as a delta against the previously uploaded
+    /// version if possible, or in full otherwise. Used instead of
+    /// remote::upload_manifest when cloud_storage_manifest_max_deltas is set.
+    ss::future<cloud_storage::upload_result>
+    upload_manifest_or_delta(retry_chain_node& fib);
+
     /// Lazy variant of flush_manifest_clean_offset, for use in situations
     /// where we didn't just upload the manifest, but want to make sure we
     /// will eventually flush projected_manifest_clean_at in case it was
@@ -603,9 +648,13 @@ private:
 
     ss::lw_shared_ptr<const configuration> _conf;
     config::binding<std::chrono::milliseconds> _sync_manifest_timeout;
+    config::binding<std::optional<std::chrono::milliseconds>>
+      _sync_manifest_max_interval;
     config::binding<size_t> _max_segments_pending_deletion;
     simple_time_jitter<ss::lowres_clock> _backoff_jitter{100ms};
-    size_t _concurrency{4};
+    // Upper bound on the number of segment uploads in flight. The uploads
+    // of a window are committed together in offset order.
+    config::binding<uint16_t> _max_concurrent_uploads;
 
     // When we last wrote the partition manifest to object storage: this
     // is used to limit the frequency with which we do uploads.
@@ -623,6 +672,11 @@ private:
 
     // When we last synced the manifest of the read replica
     std::optional<ss::lowres_clock::time_point> _last_sync_time;
+    // ETag of the full manifest of the read replica at the last sync, the
+    // manifest is only downloaded again if it changes
+    ss::sstring _read_replica_manifest_etag;
+    // Number of the last syncs of the read replica which found no new data
+    size_t _read_replica_idle_syncs{0};
 
     // Used during leadership transfer: instructs the archiver to
     // not proceed with uploads, even if it has leadership.
@@ -668,8 +722,23 @@ private:
     config::binding<std::optional<std::chrono::seconds>>
       _manifest_upload_interval;
 
+    config::binding<size_t> _manifest_max_deltas;
+
     ss::shared_ptr<cloud_storage::async_manifest_view> _manifest_view;
 
+    // Version of the manifest that was last uploaded, in full or as a delta,
+    // the next delta is built against it.
+    struct manifest_delta_base {
+        model::offset insync_offset;
+        model::offset last_offset;
+        uint64_t layout_id;
+    };
+    std::optional<manifest_delta_base> _manifest_delta_base;
+
+    // Deltas uploaded since the last full manifest upload. Readers ignore
+    // them once the next full manifest is uploaded, so they are removed.
+    std::vector<cloud_storage_clients::object_key> _manifest_deltas;
+
     friend class archival_fixture;
 };
 
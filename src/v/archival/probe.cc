@@ -67,6 +67,27 @@ void ntp_level_probe::setup_ntp_metrics(const model::ntp& ntp) {
           [this] { return _pending; },
           sm::description("Pending offsets"),
           labels),
+        sm::make_counter(
+          "multipart_uploads",
+          [this] { return _multipart_uploads; },
+          sm::description("Segments uploaded as multipart uploads"),
+          labels),
+        sm::make_counter(
+          "multipart_upload_parts",
+          [this] { return _multipart_upload_parts; },
+          sm::description("Parts of multipart segment uploads"),
+          labels),
+        sm::make_counter(
+          "multipart_upload_part_retries",
+          [this] { return _multipart_upload_part_retries; },
+          sm::description("Parts of multipart segment uploads sent again"),
+          labels),
+        sm::make_counter(
+          "buffered_upload_bytes",
+          [this] { return _buffered_upload_bytes; },
+          sm::description(
+            "Bytes of segment uploads read from memory instead of disk"),
+          labels),
       },
       {},
       std::vector<sm::label>{sm::shard_label});
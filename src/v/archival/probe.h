@@ -60,6 +60,19 @@ public:
 
     void segments_to_delete(int64_t count) { _segments_to_delete = count; };
 
+    /// Register a multipart segment upload
+    void multipart_upload(uint64_t parts, uint64_t part_retries) {
+        ++_multipart_uploads;
+        _multipart_upload_parts += parts;
+        _multipart_upload_part_retries += part_retries;
+    }
+
+    /// Register bytes of a segment upload read from the upload buffer of
+    /// the segment instead of its file
+    void buffered_upload_bytes(uint64_t bytes) {
+        _buffered_upload_bytes += bytes;
+    }
+
 private:
     /// Uploaded offsets
     uint64_t _uploaded = 0;
@@ -75,6 +88,14 @@ private:
     int64_t _segments_in_manifest = 0;
     /// Number of segments awaiting deletion
     int64_t _segments_to_delete = 0;
+    /// Number of segments uploaded as multipart uploads
+    uint64_t _multipart_uploads = 0;
+    /// Number of parts of the multipart uploads
+    uint64_t _multipart_upload_parts = 0;
+    /// Number of part uploads that had to be repeated
+    uint64_t _multipart_upload_part_retries = 0;
+    /// Uploaded bytes read from memory
+    uint64_t _buffered_upload_bytes = 0;
 
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
@@ -202,9 +202,28 @@ purger::collect_manifest_paths(
       "Generated manifest path should end in .bin");
 
     base_path.remove_suffix(serde_extension.length());
-    auto list_result = co_await _api.list_objects(
+    collected_manifests collected{};
+    auto list_result = co_await _api.list_objects_pages(
       bucket,
       collection_rtc,
+      [&collected](cloud_storage_clients::client::list_bucket_result page) {
+          for (auto& item : page.contents) {
+              std::string_view path{item.key};
+              if (path.ends_with(".bin")) {
+                  collected.current_serde = std::move(item.key);
+                  continue;
+              }
+
+              if (path.ends_with(".json")) {
+                  collected.current_json = std::move(item.key);
+                  continue;
+              }
+
+              collected.spillover.push_back(std::move(item.key));
+          }
+          return ss::make_ready_future<ss::stop_iteration>(
+            ss::stop_iteration::no);
+      },
       cloud_storage_clients::object_key{std::filesystem::path{base_path}});
 
     if (list_result.has_error()) {
@@ -216,23 +235,6 @@ purger::collect_manifest_paths(
         co_return std::nullopt;
     }
 
-    collected_manifests collected{};
-    collected.spillover.reserve(list_result.value().contents.size());
-    for (auto& item : list_result.value().contents) {
-        std::string_view path{item.key};
-        if (path.ends_with(".bin")) {
-            collected.current_serde = std::move(item.key);
-            continue;
-        }
-
-        if (path.ends_with(".json")) {
-            collected.current_json = std::move(item.key);
-            continue;
-        }
-
-        collected.spillover.push_back(std::move(item.key));
-    }
-
     co_return collected;
 }
 
@@ -12,6 +12,7 @@
 #include "cloud_storage/types.h"
 #include "cluster/archival_metadata_stm.h"
 #include "cluster/errc.h"
+#include "config/configuration.h"
 #include "features/feature_table.h"
 #include "http/tests/http_imposter.h"
 #include "model/fundamental.h"
@@ -691,6 +692,74 @@ FIXTURE_TEST(test_archival_stm_batching, archival_metadata_stm_fixture) {
       archival_stm->manifest().begin()->archiver_term == model::term_id(2));
 }
 
+FIXTURE_TEST(
+  test_archival_stm_deferred_commands, archival_metadata_stm_fixture) {
+    wait_for_confirmed_leader();
+    auto add_segment = [this](int64_t base, int64_t last) {
+        std::vector<cloud_storage::segment_meta> m;
+        m.push_back(segment_meta{
+          .base_offset = model::offset(base),
+          .committed_offset = model::offset(last),
+          .archiver_term = model::term_id(1),
+          .segment_term = model::term_id(1)});
+        archival_stm
+          ->add_segments(
+            m,
+            std::nullopt,
+            model::producer_id{},
+            ss::lowres_clock::now() + 10s,
+            never_abort,
+            cluster::segment_validated::yes)
+          .get();
+    };
+
+    // Coalescing is disabled by default
+    BOOST_REQUIRE(!archival_stm->defer_truncate(model::offset(100)));
+
+    config::shard_local_cfg()
+      .cloud_storage_metadata_coalescing_interval_ms.set_value(
+        std::chrono::milliseconds(1h));
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg()
+          .cloud_storage_metadata_coalescing_interval_ms.reset();
+    });
+
+    add_segment(0, 99);
+    add_segment(100, 199);
+
+    // The truncate is held back until the next update
+    BOOST_REQUIRE(archival_stm->defer_truncate(model::offset(100)));
+    BOOST_REQUIRE(archival_stm->get_start_offset() == model::offset(0));
+    add_segment(200, 299);
+    BOOST_REQUIRE(archival_stm->manifest().size() == 2);
+    BOOST_REQUIRE(archival_stm->get_start_offset() == model::offset(100));
+    BOOST_REQUIRE(archival_stm->get_segments_to_cleanup().size() == 1);
+
+    // The cleanup is held back until it is flushed
+    BOOST_REQUIRE(archival_stm->defer_cleanup_metadata());
+    BOOST_REQUIRE(archival_stm->has_deferred_cleanup());
+    BOOST_REQUIRE(
+      archival_stm
+        ->flush_deferred_commands(ss::lowres_clock::now() + 10s, never_abort)
+        .get()
+      == cluster::errc::success);
+    BOOST_REQUIRE(!archival_stm->has_deferred_cleanup());
+    BOOST_REQUIRE(archival_stm->get_segments_to_cleanup().empty());
+
+    // Deferred commands are applied ahead of the commands of the next batch,
+    // so the cleanup doesn't remove the segment truncated by it
+    BOOST_REQUIRE(archival_stm->defer_cleanup_metadata());
+    BOOST_REQUIRE(
+      archival_stm
+        ->truncate(
+          model::offset(200), ss::lowres_clock::now() + 10s, never_abort)
+        .get()
+      == cluster::errc::success);
+    BOOST_REQUIRE(!archival_stm->has_deferred_cleanup());
+    BOOST_REQUIRE(archival_stm->get_start_offset() == model::offset(200));
+    BOOST_REQUIRE(archival_stm->get_segments_to_cleanup().size() == 1);
+}
+
 FIXTURE_TEST(test_archival_stm_spillover, archival_metadata_stm_fixture) {
     wait_for_confirmed_leader();
     std::vector<cloud_storage::segment_meta> m;
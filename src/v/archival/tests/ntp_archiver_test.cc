@@ -229,6 +229,64 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
     }
 }
 
+FIXTURE_TEST(test_upload_window, archiver_fixture) {
+    std::vector<segment_desc> segments = {
+      {.ntp = manifest_ntp,
+       .base_offset = model::offset(0),
+       .term = model::term_id(1),
+       .num_records = 1000},
+      {.ntp = manifest_ntp,
+       .base_offset = model::offset(1000),
+       .term = model::term_id(4),
+       .num_records = 1000},
+    };
+    init_storage_api_local(segments);
+    wait_for_partition_leadership(manifest_ntp);
+    auto part = app.partition_manager.local().get(manifest_ntp);
+    tests::cooperative_spin_wait_with_timeout(10s, [part]() mutable {
+        return part->last_stable_offset() >= model::offset(1000);
+    }).get();
+
+    config::shard_local_cfg()
+      .cloud_storage_max_concurrent_uploads_per_partition.set_value(
+        uint16_t{1});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg()
+          .cloud_storage_max_concurrent_uploads_per_partition.reset();
+    });
+
+    listen();
+    auto [arch_conf, remote_conf] = get_configurations();
+    auto amv = ss::make_shared<cloud_storage::async_manifest_view>(
+      remote,
+      app.shadow_index_cache,
+      part->archival_meta_stm()->manifest(),
+      arch_conf->bucket_name);
+    archival::ntp_archiver archiver(
+      get_ntp_conf(),
+      arch_conf,
+      remote.local(),
+      app.shadow_index_cache.local(),
+      *part,
+      amv);
+    auto action = ss::defer([&archiver, &amv] {
+        archiver.stop().get();
+        amv->stop().get();
+    });
+
+    // every call uploads and commits a single segment, in offset order
+    const auto& stm_manifest = part->archival_meta_stm()->manifest();
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto res = upload_next_with_retries(archiver).get0();
+        BOOST_REQUIRE_EQUAL(res.non_compacted_upload_result.num_succeeded, 1);
+        BOOST_REQUIRE_EQUAL(res.non_compacted_upload_result.num_failed, 0);
+        BOOST_REQUIRE_EQUAL(stm_manifest.size(), i + 1);
+        auto it = stm_manifest.begin();
+        std::advance(it, i);
+        BOOST_REQUIRE_EQUAL(it->base_offset, segments[i].base_offset);
+    }
+}
+
 FIXTURE_TEST(test_upload_after_failure, archiver_fixture) {
     // During a segment upload, the stream used to read from the segment and
     // upload it can be created in two ways, depending on the failures that
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/details/io_fragment_pool.h"
 #include "bytes/details/out_of_range.h"
 #include "seastarx.h"
 #include "utils/intrusive_list_helpers.h"
@@ -31,7 +32,7 @@ public:
      * Initialize an empty fragment of a given size.
      */
     explicit io_fragment(size_t size)
-      : _buf(size)
+      : _buf(io_fragment_pool::allocate(size))
       , _used_bytes(0) {}
 
     io_fragment(io_fragment&& o) noexcept = delete;
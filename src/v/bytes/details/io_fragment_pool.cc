@@ -0,0 +1,125 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "bytes/details/io_fragment_pool.h"
+
+#include <seastar/core/reactor.hh>
+#include <seastar/core/smp.hh>
+
+#include <cstdlib>
+#include <new>
+
+namespace details {
+
+namespace {
+// buffers released during thread exit, after the pool has been destroyed,
+// are freed directly
+[[maybe_unused]] thread_local bool pool_destroyed = false; // NOLINT
+} // namespace
+
+io_fragment_pool::io_fragment_pool()
+  : _reclaimer(
+    [this](ss::memory::reclaimer::request r) {
+        return release(r.bytes_to_reclaim) > 0
+                 ? ss::memory::reclaiming_result::reclaimed_something
+                 : ss::memory::reclaiming_result::reclaimed_nothing;
+    },
+    ss::memory::reclaimer_scope::sync) {}
+
+io_fragment_pool::~io_fragment_pool() noexcept {
+    clear();
+    pool_destroyed = true;
+}
+
+io_fragment_pool& io_fragment_pool::local() {
+    static thread_local io_fragment_pool pool;
+    return pool;
+}
+
+int io_fragment_pool::size_class(size_t size) {
+    for (size_t i = 0; i < size_classes.size(); ++i) {
+        if (size_classes[i] == size) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+ss::temporary_buffer<char> io_fragment_pool::allocate(size_t size) {
+#ifdef SEASTAR_DEFAULT_ALLOCATOR
+    // keep every buffer visible to the sanitizers
+    return ss::temporary_buffer<char>(size);
+#else
+    const auto cls = size_class(size);
+    if (cls < 0 || !ss::engine_is_ready()) {
+        return ss::temporary_buffer<char>(size);
+    }
+    auto* buf = local().take(cls);
+    return ss::temporary_buffer<char>(
+      buf,
+      size,
+      ss::make_deleter([buf, cls, shard = ss::this_shard_id()] {
+          if (
+            ss::engine_is_ready() && ss::this_shard_id() == shard
+            && !pool_destroyed) {
+              io_fragment_pool::local().recycle(buf, cls);
+          } else {
+              std::free(buf); // NOLINT
+          }
+      }));
+#endif
+}
+
+char* io_fragment_pool::take(int cls) {
+    const auto size = size_classes[cls];
+    if (auto* f = _free[cls]; f != nullptr) {
+        _free[cls] = f->next;
+        _stats.pooled_bytes -= size;
+        ++_stats.hits;
+        return reinterpret_cast<char*>(f); // NOLINT
+    }
+    auto* buf = static_cast<char*>(std::malloc(size)); // NOLINT
+    if (buf == nullptr) {
+        throw std::bad_alloc();
+    }
+    ++_stats.misses;
+    return buf;
+}
+
+void io_fragment_pool::recycle(char* buf, int cls) {
+    const auto size = size_classes[cls];
+    if (_stats.pooled_bytes + size > max_pooled_bytes) {
+        std::free(buf); // NOLINT
+        return;
+    }
+    auto* f = new (buf) free_buffer{.next = _free[cls]};
+    _free[cls] = f;
+    _stats.pooled_bytes += size;
+}
+
+size_t io_fragment_pool::release(size_t bytes) {
+    size_t released = 0;
+    for (size_t i = size_classes.size(); i-- > 0 && released < bytes;) {
+        while (_free[i] != nullptr && released < bytes) {
+            auto* f = _free[i];
+            _free[i] = f->next;
+            std::free(f); // NOLINT
+            released += size_classes[i];
+        }
+    }
+    _stats.pooled_bytes -= released;
+    _stats.reclaimed_bytes += released;
+    return released;
+}
+
+void io_fragment_pool::clear() { release(_stats.pooled_bytes); }
+
+} // namespace details
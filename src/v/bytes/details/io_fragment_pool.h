@@ -0,0 +1,95 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/memory.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace details {
+
+/*
+ * Per-shard recycling pool for the fragment buffers of iobuf.
+ *
+ * Buffers up to io_allocation_size::ss_max_small_allocation are served by
+ * seastar's small object pools, which are already per-shard free lists. The
+ * larger fragment sizes of the iobuf growth schedule and of iobuf copies go
+ * to the page span allocator instead, and under produce/fetch churn their
+ * allocation and release shows in profiles and fragments the free memory.
+ *
+ * The pool keeps the released buffers of those large size classes in free
+ * lists, up to max_pooled_bytes per shard, and hands them out again for the
+ * next allocation of the same size. The free lists are intrusive (the next
+ * pointer is stored in the free buffer) so that releasing a buffer never
+ * allocates. The pool registers a memory reclaimer which releases the pooled
+ * buffers when the shard runs short of memory.
+ *
+ * Buffers released on another shard than the one they were allocated on are
+ * freed, not pooled.
+ */
+class io_fragment_pool {
+public:
+    // the large sizes of io_allocation_size::alloc_table and the
+    // power-of-two sizes of io_allocation_size::ss_next_allocation_size
+    static constexpr auto size_classes = std::to_array<size_t>(
+      {19683, 29525, 32768, 44288, 65536, 66432, 99648, 131072});
+
+    static constexpr size_t max_pooled_bytes = 4 * 1024 * 1024;
+
+    struct stats {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        uint64_t reclaimed_bytes{0};
+        size_t pooled_bytes{0};
+    };
+
+    io_fragment_pool();
+    io_fragment_pool(const io_fragment_pool&) = delete;
+    io_fragment_pool& operator=(const io_fragment_pool&) = delete;
+    io_fragment_pool(io_fragment_pool&&) = delete;
+    io_fragment_pool& operator=(io_fragment_pool&&) = delete;
+    ~io_fragment_pool() noexcept;
+
+    /// The pool of the current shard.
+    static io_fragment_pool& local();
+
+    /// A buffer of exactly `size` bytes from the pool of the current shard,
+    /// recycled if `size` is one of the size classes.
+    static ss::temporary_buffer<char> allocate(size_t size);
+
+    /// Free all the pooled buffers.
+    void clear();
+
+    const stats& get_stats() const { return _stats; }
+
+private:
+    struct free_buffer {
+        free_buffer* next;
+    };
+
+    static int size_class(size_t size);
+    char* take(int cls);
+    void recycle(char* buf, int cls);
+    // frees pooled buffers, largest first, until at least `bytes` are freed
+    size_t release(size_t bytes);
+
+    std::array<free_buffer*, size_classes.size()> _free{};
+    stats _stats;
+    ss::memory::reclaimer _reclaimer;
+};
+
+} // namespace details
@@ -162,6 +162,9 @@ public:
     size_t bytes_consumed() const { return _bytes_consumed; }
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     size_t segment_bytes_left() const { return _frag_index_end - _frag_index; }
+    /// the unconsumed bytes of the current fragment, segment_bytes_left()
+    /// of them are readable
+    const char* segment_begin() const { return _frag_index; }
     bool is_finished() const { return _frag == _frag_end; }
 
     /// starts a new iterator byte-for-byte starting at *this* index
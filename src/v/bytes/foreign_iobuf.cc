@@ -0,0 +1,42 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "bytes/foreign_iobuf.h"
+
+#include <seastar/core/deleter.hh>
+#include <seastar/core/shared_ptr.hh>
+
+iobuf adopt_foreign_iobuf(foreign_iobuf buf) {
+    if (!buf) {
+        return iobuf{};
+    }
+    if (buf.get_owner_shard() == ss::this_shard_id()) {
+        return std::move(*buf.release());
+    }
+
+    iobuf ret;
+    if (buf->empty()) {
+        return ret;
+    }
+    // a single shard local reference is shared by all the fragments, the
+    // foreign buffer is handed back to its owner when it is dropped.
+    auto owner = ss::make_lw_shared<foreign_iobuf>(std::move(buf));
+    for (const auto& frag : **owner) {
+        if (frag.is_empty()) {
+            continue;
+        }
+        ret.append(std::make_unique<iobuf::fragment>(ss::temporary_buffer<char>(
+          const_cast<char*>(frag.get()),
+          frag.size(),
+          ss::make_object_deleter(owner))));
+    }
+    return ret;
+}
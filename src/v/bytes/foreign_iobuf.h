@@ -0,0 +1,42 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+
+#include <seastar/core/sharded.hh>
+
+#include <memory>
+
+/// An iobuf owned by another shard
+using foreign_iobuf = ss::foreign_ptr<std::unique_ptr<iobuf>>;
+
+/// Wraps the buffer so that its ownership can be handed over to another
+/// shard.
+inline foreign_iobuf make_foreign_iobuf(iobuf buf) {
+    return ss::make_foreign(std::make_unique<iobuf>(std::move(buf)));
+}
+
+/**
+ * Makes the fragments of a buffer owned by another shard available to the
+ * calling shard without copying them.
+ *
+ * iobuf::share() is not safe across shards as the fragment deleters are not
+ * thread safe. Instead, the fragments of the returned buffer reference the
+ * memory of the foreign buffer and hold a shard local reference to it. The
+ * foreign buffer is destroyed on its owner shard once the returned buffer and
+ * every buffer sharing its fragments are gone.
+ *
+ * Neither shard may modify the contents of the foreign buffer while it is
+ * referenced.
+ */
+iobuf adopt_foreign_iobuf(foreign_iobuf);
@@ -11,6 +11,7 @@
 
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "bytes/details/io_fragment_pool.h"
 #include "bytes/iostream.h"
 #include "bytes/scattered_message.h"
 #include "vassert.h"
@@ -139,7 +140,7 @@ iobuf iobuf_copy(iobuf::iterator_consumer& in, size_t len) {
 
     int bytes_left = len;
     while (bytes_left) {
-        ss::temporary_buffer<char> buf(
+        auto buf = details::io_fragment_pool::allocate(
           details::io_allocation_size::ss_next_allocation_size(bytes_left));
 
         size_t offset = 0;
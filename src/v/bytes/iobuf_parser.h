@@ -46,12 +46,24 @@ public:
     size_t bytes_consumed() const { return _in.bytes_consumed(); }
 
     std::pair<int64_t, uint8_t> read_varlong() {
+        if (has_contiguous_word()) {
+            if (auto res = vint::deserialize_word(segment_data())) {
+                _in.skip(res->second);
+                return {res->first, res->second};
+            }
+        }
         auto [val, length_size] = vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
     }
 
     std::pair<uint32_t, uint8_t> read_unsigned_varint() {
+        if (has_contiguous_word()) {
+            if (auto res = unsigned_vint::deserialize_word(segment_data())) {
+                _in.skip(res->second);
+                return {res->first, res->second};
+            }
+        }
         auto [val, length_size] = unsigned_vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
@@ -108,6 +120,20 @@ protected:
     iobuf& ref() { return *std::get<owned_buf>(_buf); }
 
 private:
+    /*
+     * Varints take the word-at-a-time decoding path when the current fragment
+     * has a full word left. Otherwise they are decoded byte by byte as they
+     * may span fragments.
+     */
+    bool has_contiguous_word() const {
+        return _in.segment_bytes_left() >= sizeof(uint64_t);
+    }
+
+    const uint8_t* segment_data() const {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<const uint8_t*>(_in.segment_begin());
+    }
+
     using const_ref = const iobuf*;
     using owned_buf = std::unique_ptr<iobuf>;
 
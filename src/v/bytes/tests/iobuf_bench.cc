@@ -0,0 +1,76 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/details/io_allocation_size.h"
+#include "bytes/iobuf.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <algorithm>
+#include <vector>
+
+/*
+ * Allocation heavy iobuf patterns: appends growing through the fragment
+ * schedule, zero copy shares, and copies of large buffers. The iterations
+ * release their buffers, so that steady state runs exercise the fragment
+ * recycling of details::io_fragment_pool.
+ */
+namespace {
+
+constexpr size_t payload_size = 1024 * 1024;
+
+const std::vector<char>& payload() {
+    static const std::vector<char> p(payload_size, 'x');
+    return p;
+}
+
+iobuf make_iobuf(size_t chunk) {
+    iobuf buf;
+    const auto& p = payload();
+    for (size_t i = 0; i < p.size(); i += chunk) {
+        buf.append(p.data() + i, std::min(chunk, p.size() - i));
+    }
+    return buf;
+}
+
+} // namespace
+
+PERF_TEST(iobuf, append_small_1mib) {
+    perf_tests::start_measuring_time();
+    auto buf = make_iobuf(100);
+    perf_tests::do_not_optimize(buf);
+    perf_tests::stop_measuring_time();
+    return buf.size_bytes();
+}
+
+PERF_TEST(iobuf, append_large_1mib) {
+    perf_tests::start_measuring_time();
+    auto buf = make_iobuf(details::io_allocation_size::max_chunk_size);
+    perf_tests::do_not_optimize(buf);
+    perf_tests::stop_measuring_time();
+    return buf.size_bytes();
+}
+
+PERF_TEST(iobuf, share_1mib) {
+    static const auto src = make_iobuf(4096);
+    perf_tests::start_measuring_time();
+    auto buf = src.share(0, src.size_bytes());
+    perf_tests::do_not_optimize(buf);
+    perf_tests::stop_measuring_time();
+    return buf.size_bytes();
+}
+
+PERF_TEST(iobuf, copy_1mib) {
+    static const auto src = make_iobuf(4096);
+    perf_tests::start_measuring_time();
+    auto buf = src.copy();
+    perf_tests::do_not_optimize(buf);
+    perf_tests::stop_measuring_time();
+    return buf.size_bytes();
+}
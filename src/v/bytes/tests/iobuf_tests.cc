@@ -9,6 +9,8 @@
 
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "bytes/details/io_fragment_pool.h"
+#include "bytes/foreign_iobuf.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
@@ -17,6 +19,7 @@
 #include "bytes/tests/utils.h"
 
 #include <seastar/core/memory.hh>
+#include <seastar/core/smp.hh>
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/testing/thread_test_case.hh>
 
@@ -775,3 +778,93 @@ SEASTAR_THREAD_TEST_CASE(iobuf_hexdump) {
   00000000 | 41 65 6e 65 61 6e 20 73  65 64 20 6c 65 6f 20 70  | Aenean sed leo p
   00000010 | 6f 72 74 74 69 74 6f 72  2e                       | orttitor.)");
 }
+
+SEASTAR_THREAD_TEST_CASE(foreign_iobuf_adopt_local) {
+    iobuf buf;
+    append_sequence(buf, 1000);
+    auto expected = buf.copy();
+    auto data = buf.begin()->get();
+
+    auto adopted = adopt_foreign_iobuf(make_foreign_iobuf(std::move(buf)));
+    BOOST_REQUIRE_EQUAL(adopted, expected);
+    BOOST_REQUIRE(adopted.begin()->get() == data);
+}
+
+SEASTAR_THREAD_TEST_CASE(foreign_iobuf_adopt_remote) {
+    auto owner = (ss::this_shard_id() + 1) % ss::smp::count;
+    auto expected = ss::smp::submit_to(owner, [] {
+                        iobuf buf;
+                        append_sequence(buf, 1000);
+                        return make_foreign_iobuf(std::move(buf));
+                    }).get0();
+    std::vector<const char*> fragments;
+    for (const auto& f : *expected) {
+        fragments.push_back(f.get());
+    }
+    // a private copy of the same data owned by another shard
+    auto buf = ss::smp::submit_to(owner, [&expected] {
+                   return make_foreign_iobuf(expected->copy());
+               }).get0();
+
+    auto adopted = adopt_foreign_iobuf(std::move(expected));
+    BOOST_REQUIRE_EQUAL(adopted.size_bytes(), buf->size_bytes());
+    BOOST_REQUIRE_EQUAL(adopted, *buf);
+
+    // the fragments are referenced in place
+    size_t i = 0;
+    for (const auto& f : adopted) {
+        BOOST_REQUIRE_LT(i, fragments.size());
+        BOOST_REQUIRE(f.get() == fragments[i++]);
+    }
+    BOOST_REQUIRE_EQUAL(i, fragments.size());
+
+    // sharing the adopted buffer keeps the foreign buffer alive
+    auto shared = adopted.share(0, adopted.size_bytes());
+    adopted = iobuf{};
+    BOOST_REQUIRE_EQUAL(shared, *buf);
+}
+
+SEASTAR_THREAD_TEST_CASE(io_fragment_pool_recycles_large_fragments) {
+    if (seastar::memory::stats().allocated_memory() == 0) {
+        // debug mode: the pool is disabled with the default allocator
+        return;
+    }
+    using pool = details::io_fragment_pool;
+    constexpr auto max_chunk = details::io_allocation_size::max_chunk_size;
+    pool::local().clear();
+    const auto before = pool::local().get_stats();
+
+    // a released max size fragment is pooled and handed out again
+    { auto buf = pool::allocate(max_chunk); }
+    BOOST_REQUIRE_EQUAL(pool::local().get_stats().pooled_bytes, max_chunk);
+    { auto buf = pool::allocate(max_chunk); }
+    BOOST_REQUIRE_EQUAL(pool::local().get_stats().hits, before.hits + 1);
+
+    // sizes outside of the size classes are not pooled
+    { auto buf = pool::allocate(max_chunk - 1); }
+    BOOST_REQUIRE_EQUAL(pool::local().get_stats().pooled_bytes, max_chunk);
+
+    // the pool is bounded
+    {
+        std::vector<ss::temporary_buffer<char>> bufs;
+        for (size_t i = 0; i < 2 * pool::max_pooled_bytes / max_chunk; ++i) {
+            bufs.push_back(pool::allocate(max_chunk));
+        }
+    }
+    BOOST_REQUIRE_EQUAL(
+      pool::local().get_stats().pooled_bytes, pool::max_pooled_bytes);
+
+    // iobuf fragments are allocated from the pool
+    {
+        iobuf buf;
+        buf.reserve_memory(max_chunk);
+        BOOST_REQUIRE_EQUAL(
+          pool::local().get_stats().pooled_bytes,
+          pool::max_pooled_bytes - max_chunk);
+    }
+    BOOST_REQUIRE_EQUAL(
+      pool::local().get_stats().pooled_bytes, pool::max_pooled_bytes);
+
+    pool::local().clear();
+    BOOST_REQUIRE_EQUAL(pool::local().get_stats().pooled_bytes, 0);
+}
@@ -12,6 +12,7 @@
 
 #include "cloud_roles/logger.h"
 #include "cloud_roles/probe.h"
+#include "cloud_roles/request_response_helpers.h"
 #include "cloud_roles/signature.h"
 #include "config/configuration.h"
 #include "model/metadata.h"
@@ -70,8 +71,8 @@ public:
         void reset_retries();
 
     protected:
-        /// Returns an http client with the API host and port applied
-        ss::future<http::client> make_api_client(
+        /// Returns the endpoint of the API host and port
+        ss::future<api_endpoint> make_api_endpoint(
           ss::sstring name = "",
           client_tls_enabled enable_tls = client_tls_enabled::no);
 
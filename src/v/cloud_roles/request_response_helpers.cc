@@ -13,6 +13,7 @@
 #include "bytes/iostream.h"
 #include "bytes/streambuf.h"
 #include "config/configuration.h"
+#include "http/connection_pool.h"
 #include "json/istreamwrapper.h"
 #include "logger.h"
 
@@ -112,7 +113,7 @@ ss::future<api_response> make_request_without_payload(
 
 ss::future<api_response> make_request_with_payload(
   http::client& client,
-  http::client::request_header& req,
+  http::client::request_header req,
   iobuf content,
   std::optional<std::chrono::milliseconds> timeout) {
     req.set(
@@ -144,16 +145,18 @@ ss::future<api_response> make_request_with_payload(
 } // namespace
 
 ss::future<api_response> make_request(
-  http::client client,
+  api_endpoint endpoint,
   http::client::request_header req,
   std::optional<std::chrono::milliseconds> timeout) {
     auto tout = timeout.value_or(
       config::shard_local_cfg().cloud_storage_roles_operation_timeout_ms);
-    return http::with_client(
-      std::move(client), [req = std::move(req), tout](auto& client) mutable {
-          return do_request(req, [&client, tout](auto& req) mutable {
-              return make_request_without_payload(client, req, tout);
-          });
+    return do_request(
+      std::move(req),
+      [endpoint = std::move(endpoint), tout](auto& req) mutable {
+          return http::with_pooled_client(
+            endpoint.config, endpoint.as, [&req, tout](auto& client) {
+                return make_request_without_payload(client, req, tout);
+            });
       });
 }
 
@@ -167,28 +170,29 @@ json::Document parse_json_response(iobuf resp) {
 }
 
 ss::future<api_response> request_with_payload(
-  http::client client,
+  api_endpoint endpoint,
   http::client::request_header req,
   iobuf content,
   std::optional<std::chrono::milliseconds> timeout) {
     auto tout = timeout.value_or(
       config::shard_local_cfg().cloud_storage_roles_operation_timeout_ms);
 
-    return http::with_client(
-      std::move(client),
-      [req = std::move(req), content = std::move(content), tout](
-        auto& client) mutable -> ss::future<api_response> {
-          return do_request(
-            req,
-            [&client, content = std::move(content), tout](auto& req) mutable {
+    return do_request(
+      std::move(req),
+      [endpoint = std::move(endpoint), content = std::move(content), tout](
+        auto& req) mutable {
+          return http::with_pooled_client(
+            endpoint.config,
+            endpoint.as,
+            [&req, &content, tout](auto& client) {
                 return make_request_with_payload(
-                  client, req, std::move(content), tout);
+                  client, req, content.copy(), tout);
             });
       });
 }
 
 ss::future<api_response> request_with_payload(
-  http::client client,
+  api_endpoint endpoint,
   http::client::request_header req,
   seastar::sstring content,
   std::optional<std::chrono::milliseconds> timeout) {
@@ -197,7 +201,7 @@ ss::future<api_response> request_with_payload(
     auto tout = timeout.value_or(
       config::shard_local_cfg().cloud_storage_roles_operation_timeout_ms);
     return request_with_payload(
-      std::move(client), std::move(req), std::move(b), tout);
+      std::move(endpoint), std::move(req), std::move(b), tout);
 }
 
 std::chrono::system_clock::time_point parse_timestamp(std::string_view sv) {
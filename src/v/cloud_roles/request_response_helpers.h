@@ -13,22 +13,32 @@
 #include "cloud_roles/types.h"
 #include "http/client.h"
 #include "json/document.h"
+#include "net/transport.h"
+
+#include <seastar/core/abort_source.hh>
 
 namespace cloud_roles {
 
+/// Endpoint of the API requests, which go through the clients of the
+/// http::connection_pool of the shard
+struct api_endpoint {
+    net::base_transport::configuration config;
+    const ss::abort_source* as{nullptr};
+};
+
 ss::future<api_response> make_request(
-  http::client client,
+  api_endpoint endpoint,
   http::client::request_header req,
   std::optional<std::chrono::milliseconds> timeout = std::nullopt);
 
 ss::future<api_response> request_with_payload(
-  http::client client,
+  api_endpoint endpoint,
   http::client::request_header req,
   iobuf content,
   std::optional<std::chrono::milliseconds> timeout = std::nullopt);
 
 ss::future<api_response> request_with_payload(
-  http::client client,
+  api_endpoint endpoint,
   http::client::request_header req,
   ss::sstring content,
   std::optional<std::chrono::milliseconds> timeout = std::nullopt);
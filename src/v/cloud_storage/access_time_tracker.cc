@@ -13,13 +13,16 @@
 #include "bytes/iostream.h"
 #include "serde/serde.h"
 #include "units.h"
+#include "utils/vint.h"
 
+#include <seastar/core/byteorder.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/smp.hh>
 
 #include <absl/container/btree_map.h>
 #include <absl/container/btree_set.h>
 
+#include <cstring>
 #include <exception>
 #include <variant>
 
@@ -50,6 +53,9 @@ namespace cloud_storage {
 // is defined in a header struct, and then the main body of the encoding
 // is defined by hand in the read/write methods so that it can be done
 // with streaming.
+//
+// Version 0 of the format, only read for compatibility: the body is
+// table_size pairs of serde encoded (hash, timestamp).
 struct table_header
   : serde::envelope<table_header, serde::version<0>, serde::compat_version<0>> {
     size_t table_size{0};
@@ -57,6 +63,36 @@ struct table_header
     auto serde_fields() { return std::tie(table_size); }
 };
 
+// Version 1 of the format. The body is a sequence of blocks, each made of a
+// 32 bit little endian byte length followed by up to block_items entries.
+// An entry is the difference between its hash and the hash of the previous
+// entry, followed by the difference between its timestamp and
+// base_timestamp, both as unsigned varints. Hashes are stored in ascending
+// order so deltas are small, and access times of a cache span a short time
+// range, which brings the typical entry down from 8 to about 5 bytes.
+//
+// The compat version is bumped so that older versions refuse the file and
+// start with an empty tracker rather than misreading it.
+struct delta_table_header
+  : serde::envelope<
+      delta_table_header,
+      serde::version<1>,
+      serde::compat_version<1>> {
+    size_t table_size{0};
+    uint32_t base_timestamp{0};
+
+    auto serde_fields() { return std::tie(table_size, base_timestamp); }
+};
+
+namespace {
+
+// How many items to serialize per stream write()
+constexpr size_t block_items = 2048;
+
+constexpr size_t max_entry_size = 2 * unsigned_vint::max_length;
+
+} // namespace
+
 ss::future<> access_time_tracker::write(ss::output_stream<char>& out) {
     // This lock protects us from the _table being mutated while we
     // are iterating over it and yielding during the loop.
@@ -64,25 +100,41 @@ ss::future<> access_time_tracker::write(ss::output_stream<char>& out) {
 
     _dirty = false;
 
-    const table_header h{.table_size = _table.size()};
+    delta_table_header h{.table_size = _table.size()};
+    if (!_table.empty()) {
+        h.base_timestamp = std::numeric_limits<timestamp_t>::max();
+        size_t visited = 0;
+        for (const auto& [_, ts] : _table) {
+            h.base_timestamp = std::min(h.base_timestamp, ts);
+            if (++visited % block_items == 0) {
+                co_await ss::maybe_yield();
+            }
+        }
+    }
     iobuf header_buf;
     serde::write(header_buf, h);
     co_await write_iobuf_to_output_stream(std::move(header_buf), out);
 
-    // How many items to serialize per stream write()
-    constexpr size_t chunk_count = 2048;
-
+    std::vector<uint8_t> block(
+      sizeof(uint32_t) + block_items * max_entry_size);
+    size_t block_size = sizeof(uint32_t);
     size_t i = 0;
-    iobuf serialize_buf;
-    for (auto it : _table) {
-        serde::write(serialize_buf, it.first);
-        serde::write(serialize_buf, it.second);
+    uint32_t prev_hash = 0;
+    for (const auto& [hash, ts] : _table) {
+        block_size += unsigned_vint::serialize(
+          hash - prev_hash, block.data() + block_size);
+        block_size += unsigned_vint::serialize(
+          ts - h.base_timestamp, block.data() + block_size);
+        prev_hash = hash;
         ++i;
-        if (i % chunk_count == 0 || i == _table.size()) {
-            for (const auto& f : serialize_buf) {
-                co_await out.write(f.get(), f.size());
-            }
-            serialize_buf.clear();
+        if (i % block_items == 0 || i == _table.size()) {
+            const auto body_size = ss::cpu_to_le(
+              static_cast<uint32_t>(block_size - sizeof(uint32_t)));
+            std::memcpy(block.data(), &body_size, sizeof(body_size));
+            co_await out.write(
+              reinterpret_cast<const char*>(block.data()), block_size);
+            block_size = sizeof(uint32_t);
+            co_await ss::maybe_yield();
         }
     }
 
@@ -128,7 +180,14 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
     // Read serde envelope header
     auto envelope_header_tmp = co_await in.read_exactly(
       serde::envelope_header_size);
+    if (envelope_header_tmp.size() != serde::envelope_header_size) {
+        throw std::runtime_error("access time tracker header is truncated");
+    }
     header_buf.append(envelope_header_tmp.get(), envelope_header_tmp.size());
+    // The envelope header starts with the version of the struct, which
+    // selects the encoding of the body.
+    const auto h_version = static_cast<serde::version_t>(
+      envelope_header_tmp[0]);
 
     // Peek at the size of the header's serde body
     iobuf envelope_header_buf = header_buf.copy();
@@ -139,13 +198,24 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
     auto tmp = co_await in.read_exactly(header_size);
     header_buf.append(tmp.get(), tmp.size());
     auto h_parser = iobuf_parser(std::move(header_buf));
-    table_header h = serde::read_nested<table_header>(h_parser, 0);
 
-    // How many items to consume per stream read()
-    constexpr size_t chunk_count = 2048;
+    if (h_version == 0) {
+        co_await read_legacy_body(in, h_parser);
+    } else {
+        co_await read_delta_body(in, h_parser);
+    }
+
+    lock_guard.return_all();
+    // Any writes while we were reading are dropped
+    _pending_upserts.clear();
+}
+
+ss::future<> access_time_tracker::read_legacy_body(
+  ss::input_stream<char>& in, iobuf_parser& h_parser) {
+    auto h = serde::read_nested<table_header>(h_parser, 0);
 
-    for (size_t i = 0; i < h.table_size; i += chunk_count) {
-        auto item_count = std::min(chunk_count, h.table_size - i);
+    for (size_t i = 0; i < h.table_size; i += block_items) {
+        auto item_count = std::min(block_items, h.table_size - i);
         auto tmp_buf = co_await in.read_exactly(item_count * table_item_size);
         iobuf items_buf;
         items_buf.append(std::move(tmp_buf));
@@ -156,10 +226,58 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
             _table.emplace(hash, t);
         }
     }
+}
 
-    lock_guard.return_all();
-    // Any writes while we were reading are dropped
-    _pending_upserts.clear();
+ss::future<> access_time_tracker::read_delta_body(
+  ss::input_stream<char>& in, iobuf_parser& h_parser) {
+    auto h = serde::read_nested<delta_table_header>(h_parser, 0);
+
+    uint32_t hash = 0;
+    for (size_t i = 0; i < h.table_size; i += block_items) {
+        auto item_count = std::min(block_items, h.table_size - i);
+        auto size_buf = co_await in.read_exactly(sizeof(uint32_t));
+        if (size_buf.size() != sizeof(uint32_t)) {
+            throw std::runtime_error(fmt::format(
+              "access time tracker truncated at item {}/{}",
+              i,
+              h.table_size));
+        }
+        uint32_t block_size = 0;
+        std::memcpy(&block_size, size_buf.get(), sizeof(block_size));
+        block_size = ss::le_to_cpu(block_size);
+        if (block_size > item_count * max_entry_size) {
+            throw std::runtime_error(fmt::format(
+              "access time tracker block of {} bytes is too large for {} "
+              "items",
+              block_size,
+              item_count));
+        }
+        auto block = co_await in.read_exactly(block_size);
+        if (block.size() != block_size) {
+            throw std::runtime_error(fmt::format(
+              "access time tracker truncated at item {}/{}",
+              i,
+              h.table_size));
+        }
+
+        bytes_view remaining(
+          reinterpret_cast<const uint8_t*>(block.get()), block.size());
+        auto next = [&remaining] {
+            if (remaining.empty()) {
+                throw std::runtime_error(
+                  "access time tracker block ends before its items");
+            }
+            auto [value, n] = unsigned_vint::deserialize(remaining);
+            remaining.remove_prefix(std::min(n, remaining.size()));
+            return value;
+        };
+        for (size_t j = 0; j < item_count; ++j) {
+            hash += next();
+            const timestamp_t t = h.base_timestamp + next();
+            _table.emplace_hint(_table.end(), hash, t);
+        }
+        co_await ss::maybe_yield();
+    }
 }
 
 void access_time_tracker::add_timestamp(
@@ -41,7 +41,7 @@ class access_time_tracker {
     using timestamp_t = uint32_t;
     using table_t = absl::btree_map<uint32_t, timestamp_t>;
 
-    // Serialized size of each pair in table_t
+    // Serialized size of each pair in table_t in the version 0 format
     static constexpr size_t table_item_size = 8;
 
 public:
@@ -79,6 +79,11 @@ private:
     /// Drain _pending_upserts for any writes made while table lock was held
     void on_released_table_lock();
 
+    /// Decode the body of a serialized table in the fixed size (version 0) or
+    /// delta (version 1) encoding. \p h_parser holds the table header.
+    ss::future<> read_legacy_body(ss::input_stream<char>&, iobuf_parser&);
+    ss::future<> read_delta_body(ss::input_stream<char>&, iobuf_parser&);
+
     absl::btree_map<uint32_t, timestamp_t> _table;
 
     // Lock taken during async loops over the table (ser/de and trim())
@@ -13,6 +13,12 @@
 #include "cloud_storage/base_manifest.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
+#include "config/configuration.h"
+#include "random/generators.h"
+
+#include <seastar/core/loop.hh>
+
+#include <algorithm>
 
 namespace cloud_storage {
 
@@ -28,7 +34,10 @@ anomalies_detector::anomalies_detector(
   , _initial_rev(initial_rev)
   , _remote(remote)
   , _logger(logger)
-  , _as(as) {}
+  , _as(as)
+  , _segment_sample_percent(
+      config::shard_local_cfg()
+        .cloud_storage_scrubbing_segment_sample_percent.bind()) {}
 
 ss::future<anomalies_detector::result> anomalies_detector::run(
   retry_chain_node& rtc_node,
@@ -205,37 +214,69 @@ anomalies_detector::check_manifest(
         }
     }
 
-    for (; seg_iter != manifest.end(); ++seg_iter) {
+    struct segment_check {
+        segment_meta meta;
+        bool sampled;
+        download_result exists{download_result::success};
+    };
+    // Segments which aren't sampled cost no requests, this only bounds
+    // the memory of the window.
+    static constexpr size_t max_window = 1024;
+    const auto concurrency = std::max<size_t>(1, _remote.concurrency() / 4);
+    std::vector<segment_check> window;
+    window.reserve(concurrency);
+    while (seg_iter != manifest.end()) {
         if (should_stop()) {
             _result.status = scrub_status::partial;
             co_return stop_detector::yes;
         }
 
-        const auto seg_meta = *seg_iter;
-
-        const auto segment_path = manifest.generate_segment_path(seg_meta);
-        const auto exists_result = co_await _remote.segment_exists(
-          _bucket, segment_path, rtc_node);
-        _result.ops += 1;
+        // The existence checks of a window are issued concurrently. The
+        // window is limited to the quota left, so that the detector stops
+        // at the same segment as if the checks were issued one by one.
+        window.clear();
+        size_t checks = 0;
+        const auto budget = checks_budget(concurrency);
+        for (; seg_iter != manifest.end() && checks < budget
+               && window.size() < max_window;
+             ++seg_iter) {
+            auto sampled = sample_segment();
+            checks += sampled ? 1 : 0;
+            window.push_back({.meta = *seg_iter, .sampled = sampled});
+        }
 
-        if (exists_result == download_result::notfound) {
-            _result.detected.missing_segments.emplace(seg_meta);
-        } else if (exists_result != download_result::success) {
-            vlog(
-              _logger.debug,
-              "Failed to check existence of segment at {}",
-              segment_path());
+        co_await ss::parallel_for_each(
+          window, [this, &manifest, &rtc_node](segment_check& check) {
+              if (!check.sampled) {
+                  return ss::now();
+              }
+              return _remote
+                .segment_exists(
+                  _bucket, manifest.generate_segment_path(check.meta), rtc_node)
+                .then([&check](download_result r) { check.exists = r; });
+          });
+        _result.ops += static_cast<int32_t>(checks);
+
+        for (const auto& check : window) {
+            if (check.exists == download_result::notfound) {
+                _result.detected.missing_segments.emplace(check.meta);
+            } else if (check.exists != download_result::success) {
+                vlog(
+                  _logger.debug,
+                  "Failed to check existence of segment at {}",
+                  manifest.generate_segment_path(check.meta)());
 
-            _result.status = scrub_status::partial;
-        }
+                _result.status = scrub_status::partial;
+            }
 
-        scrub_segment_meta(
-          seg_meta,
-          previous_seg_meta,
-          _result.detected.segment_metadata_anomalies);
-        previous_seg_meta = seg_meta;
+            scrub_segment_meta(
+              check.meta,
+              previous_seg_meta,
+              _result.detected.segment_metadata_anomalies);
+            previous_seg_meta = check.meta;
 
-        _result.last_scrubbed_offset = seg_meta.committed_offset;
+            _result.last_scrubbed_offset = check.meta.committed_offset;
+        }
     }
 
     vlog(
@@ -261,6 +302,21 @@ bool anomalies_detector::should_stop() const {
     return false;
 }
 
+size_t anomalies_detector::checks_budget(size_t concurrency) const {
+    const archival::run_quota_t ops{_result.ops};
+    if (ops > _received_quota) {
+        // should_stop() lets one segment through to make progress
+        return 1;
+    }
+    const auto left = static_cast<size_t>((_received_quota - ops)()) + 1;
+    return std::min(concurrency, left);
+}
+
+bool anomalies_detector::sample_segment() const {
+    const auto percent = _segment_sample_percent();
+    return percent >= 100 || random_generators::get_int(0, 99) < percent;
+}
+
 anomalies_detector::result&
 anomalies_detector::result::operator+=(anomalies_detector::result&& other) {
     if (
@@ -14,6 +14,7 @@
 #include "cloud_storage/fwd.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cloud_storage/types.h"
+#include "config/property.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "seastarx.h"
@@ -33,6 +34,12 @@ namespace cloud_storage {
  * 3. Check for existence of segments referenced by partition manifest
  * 4. For each spillover manifest, check for existence of the referenced
  * segments
+ *
+ * The existence of a segment is checked with a HEAD request. Only a sample
+ * of the segments (cloud_storage_scrubbing_segment_sample_percent) is
+ * checked, and the checks of a manifest are issued concurrently, using
+ * a fraction of the client pool so that uploads and reads of the shard
+ * aren't starved.
  */
 class anomalies_detector {
 public:
@@ -71,6 +78,13 @@ private:
 
     bool should_stop() const;
 
+    /// Number of segment existence checks which may be issued before
+    /// should_stop() has to be consulted again.
+    size_t checks_budget(size_t concurrency) const;
+
+    /// Pick the segments whose existence is checked
+    bool sample_segment() const;
+
     cloud_storage_clients::bucket_name _bucket;
     model::ntp _ntp;
     model::initial_revision_id _initial_rev;
@@ -79,6 +93,8 @@ private:
     retry_chain_logger& _logger;
     ss::abort_source& _as;
 
+    config::binding<uint16_t> _segment_sample_percent;
+
     result _result;
     archival::run_quota_t _received_quota;
 };
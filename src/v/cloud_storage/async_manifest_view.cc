@@ -40,6 +40,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/outcome/success_failure.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <iterator>
@@ -233,6 +234,7 @@ async_manifest_view_cursor::seek(async_view_search_query_t q) {
         _stm_start_offset = start_offset;
     } else {
         _stm_start_offset = std::nullopt;
+        maybe_prefetch_next();
     }
     _timer.rearm(_idle_timeout + ss::lowres_clock::now());
     co_return true;
@@ -297,11 +299,26 @@ async_manifest_view_cursor::next() {
         // Invariant: if cursor points to the STM manifest _stm_start_offset is
         //            set to expected base offset
         _stm_start_offset = std::clamp(next_base_offset, _begin, _end);
+    } else {
+        maybe_prefetch_next();
     }
     _timer.rearm(_idle_timeout + ss::lowres_clock::now());
     co_return eof::no;
 }
 
+void async_manifest_view_cursor::maybe_prefetch_next() {
+    if (!std::holds_alternative<ss::shared_ptr<materialized_manifest>>(
+          _current)) {
+        return;
+    }
+    const auto& m = std::get<ss::shared_ptr<materialized_manifest>>(_current);
+    auto next_base_offset = model::next_offset(m->manifest.get_last_offset());
+    if (next_base_offset > _end) {
+        return;
+    }
+    _view.prefetch_manifest(next_base_offset);
+}
+
 ss::future<ss::stop_iteration> async_manifest_view_cursor::next_iter() {
     auto res = co_await next();
     if (res.has_failure()) {
@@ -414,6 +431,25 @@ ss::future<> async_manifest_view::run_bg_loop() {
             auto front = std::move(_requests.front());
             _requests.pop_front();
             try {
+                auto key = std::make_tuple(
+                  get_ntp(), front.search_vec.base_offset);
+                if (
+                  front.prefetch
+                  && (_manifest_cache.contains(key)
+                      || _manifest_cache.size_bytes()
+                             + front.search_vec.metadata_size_hint
+                           > _manifest_cache.get_capacity())) {
+                    // The prefetched manifest is either cached already, or
+                    // could only get in by evicting manifests which are
+                    // being read now. In the latter case it will be
+                    // materialized when the reader gets to it.
+                    vlog(
+                      _ctxlog.debug,
+                      "Skipping prefetch of spillover manifest {}",
+                      front.search_vec);
+                    front.promise.set_value(error_outcome::repeat);
+                    continue;
+                }
                 auto path = get_spillover_manifest_path(front.search_vec);
                 vlog(
                   _ctxlog.debug,
@@ -431,8 +467,7 @@ ss::future<> async_manifest_view::run_bg_loop() {
                     front.promise.set_value(std::ref(_stm_manifest));
                     continue;
                 }
-                if (!_manifest_cache.contains(std::make_tuple(
-                      get_ntp(), front.search_vec.base_offset))) {
+                if (!_manifest_cache.contains(key)) {
                     // Manifest is not cached and has to be hydrated and/or
                     // materialized.
                     vlog(
@@ -505,9 +540,7 @@ ss::future<> async_manifest_view::run_bg_loop() {
                 } else {
                     vlog(_ctxlog.debug, "Manifest is already materialized");
                 }
-                auto cached = _manifest_cache.get(
-                  std::make_tuple(get_ntp(), front.search_vec.base_offset),
-                  _ctxlog);
+                auto cached = _manifest_cache.get(key, _ctxlog);
                 front.promise.set_value(cached);
                 vlog(
                   _ctxlog.debug,
@@ -708,14 +741,10 @@ async_manifest_view::get_term_last_offset(model::term_id term) noexcept {
         if (last->segment_term == term) {
             // Fast path, most requests should query the last term
             co_return last->next_kafka_offset() - kafka::offset(1);
-        } else {
-            // look for first segment in next term, segments are sorted by
-            // base_offset and term
-            for (auto const& p : stmm) {
-                if (p.segment_term > term) {
-                    co_return p.base_kafka_offset() - kafka::offset(1);
-                }
-            }
+        } else if (auto next = stmm.first_kafka_offset_after_term(term)) {
+            // first segment in next term, segments are sorted by base_offset
+            // and term
+            co_return *next - kafka::offset(1);
         }
     } else if (stmm.get_archive_start_offset() != model::offset{}) {
         const auto spill_index = get_spillover_upper_bound_by_term(term);
@@ -772,18 +801,16 @@ async_manifest_view::get_term_last_offset(model::term_id term) noexcept {
                     "Scanning manifest {} for term {}",
                     manifest.get_manifest_path(),
                     term);
-                  for (auto meta : manifest) {
-                      if (meta.segment_term > term) {
-                          res_offset = meta.base_kafka_offset()
-                                       - kafka::offset(1);
-                          vlog(
-                            _ctxlog.debug,
-                            "Scan found offset {} at term {}",
-                            res_offset.value(),
-                            meta.segment_term);
-                          return ss::make_ready_future<ss::stop_iteration>(
-                            ss::stop_iteration::yes);
-                      }
+                  auto next = manifest.first_kafka_offset_after_term(term);
+                  if (next.has_value()) {
+                      res_offset = *next - kafka::offset(1);
+                      vlog(
+                        _ctxlog.debug,
+                        "Scan found offset {} after term {}",
+                        res_offset.value(),
+                        term);
+                      return ss::make_ready_future<ss::stop_iteration>(
+                        ss::stop_iteration::yes);
                   }
                   return cursor->next_iter();
               });
@@ -1341,6 +1368,41 @@ async_manifest_view::get_materialized_manifest(
     }
 }
 
+void async_manifest_view::prefetch_manifest(
+  model::offset base_offset) noexcept {
+    if (_gate.is_closed() || in_stm(base_offset)) {
+        return;
+    }
+    auto meta = search_spillover_manifests(base_offset);
+    if (!meta.has_value() || meta->base_offset != base_offset) {
+        return;
+    }
+    auto key = std::make_tuple(get_ntp(), meta->base_offset);
+    if (_manifest_cache.contains(key)) {
+        return;
+    }
+    auto queued = std::any_of(
+      _requests.begin(),
+      _requests.end(),
+      [&meta](const materialization_request_t& r) {
+          return r.search_vec.base_offset == meta->base_offset;
+      });
+    if (queued) {
+        return;
+    }
+    vlog(_ctxlog.debug, "Prefetching spillover manifest {}", meta);
+    materialization_request_t request{
+      .search_vec = *meta,
+      .prefetch = true,
+    };
+    // Nobody waits for the prefetch, the reader looks the manifest up in
+    // the cache when it gets to it.
+    ssx::background = request.promise.get_future().then_wrapped(
+      [](auto f) { f.ignore_ready_future(); });
+    _requests.emplace_back(std::move(request));
+    _cvar.signal();
+}
+
 ss::future<result<spillover_manifest, error_outcome>>
 async_manifest_view::hydrate_manifest(
   remote_manifest_path path) const noexcept {
@@ -150,6 +150,15 @@ private:
     ss::future<result<manifest_section_t, error_outcome>>
     get_materialized_manifest(async_view_search_query_t q) noexcept;
 
+    /// Materialize the spillover manifest which starts at \p base_offset in
+    /// the background, without waiting for it
+    ///
+    /// The cursor calls this for the manifest that follows the one it was
+    /// moved to, so that a reader doesn't wait for the download when it
+    /// reaches the end of the current manifest. The prefetched manifest is
+    /// only admitted into the cache if it fits without evicting anything.
+    void prefetch_manifest(model::offset base_offset) noexcept;
+
     /// Load manifest from the cloud
     ///
     /// On success put serialized copy into the cache. The method should only be
@@ -208,6 +217,8 @@ private:
         segment_meta search_vec;
         ss::promise<result<manifest_section_t, error_outcome>> promise;
         std::unique_ptr<ts_read_path_probe::hist_t::measurement> _measurement;
+        // Set for the requests of prefetch_manifest, nobody waits for them
+        bool prefetch{false};
     };
     std::deque<materialization_request_t> _requests;
     ss::condition_variable _cvar;
@@ -327,6 +338,10 @@ private:
 
     bool manifest_in_range(const manifest_section_t& m);
 
+    /// Prefetch the spillover manifest that follows the current one if it
+    /// is in the range of the cursor
+    void maybe_prefetch_next();
+
     /// Manifest view ref
     async_manifest_view& _view;
 
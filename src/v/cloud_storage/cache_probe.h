@@ -41,6 +41,9 @@ public:
     void exhaustive_trim() { ++_exhaustive_trims; }
     void failed_trim() { ++_failed_trims; }
 
+    uint64_t num_cached_gets() const { return _num_cached_gets; }
+    uint64_t num_miss_gets() const { return _num_miss_gets; }
+
 private:
     uint64_t _num_puts = 0;
     uint64_t _num_gets = 0;
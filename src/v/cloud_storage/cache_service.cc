@@ -10,10 +10,14 @@
 
 #include "bytes/iostream.h"
 #include "cloud_storage/access_time_tracker.h"
+#include "cloud_storage/chunk_slab_store.h"
 #include "cloud_storage/logger.h"
+#include "config/configuration.h"
 #include "seastar/util/file.hh"
+#include "serde/serde.h"
 #include "ssx/future-util.h"
 #include "storage/segment.h"
+#include "utils/file_io.h"
 #include "vassert.h"
 #include "vlog.h"
 
@@ -23,6 +27,7 @@
 #include <seastar/core/seastar.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/core/timed_out_error.hh>
 #include <seastar/util/defer.hh>
 
 #include <cloud_storage/cache_service.h>
@@ -39,14 +44,37 @@ using namespace std::chrono_literals;
 namespace {
 // Matches log segments optionally containing a numeric term suffix
 const re2::RE2 segment_expr{R"#(.*\.log(\.\d+)?)#"};
+
+// Chunks are stored in the directory of their segment, see
+// remote_segment::get_path_to_chunk
+bool is_chunk_key(const std::filesystem::path& key) {
+    return std::string_view(key.parent_path().native()).ends_with("_chunks");
+}
 } // namespace
 
 namespace cloud_storage {
 
 static constexpr auto access_timer_period = 60s;
+// Access times recorded on shards other than 0 are sent to the tracker in
+// batches, at this period or once this many distinct files were accessed.
+static constexpr auto access_time_flush_period = 5s;
+static constexpr size_t max_pending_access_times = 1024;
 static constexpr const char* access_time_tracker_file_name = "accesstime";
 static constexpr const char* access_time_tracker_file_name_tmp
   = "accesstime.tmp";
+static constexpr const char* walk_summary_file_name = "walksummary";
+static constexpr const char* walk_summary_file_name_tmp = "walksummary.tmp";
+
+/// Cache usage recorded by a clean shutdown. A restart which finds it skips
+/// the startup walk of the cache directory. The file is removed as soon as
+/// it is loaded so that it never describes a cache that was modified after.
+struct walk_summary
+  : serde::envelope<walk_summary, serde::version<0>, serde::compat_version<0>> {
+    uint64_t cache_size{0};
+    uint64_t cache_objects{0};
+
+    auto serde_fields() { return std::tie(cache_size, cache_objects); }
+};
 
 std::ostream& operator<<(std::ostream& o, cache_element_status s) {
     switch (s) {
@@ -184,6 +212,49 @@ cache::delete_file_and_empty_parents(const std::string_view& key) {
 
 uint64_t cache::get_total_cleaned() { return _total_cleaned; }
 
+size_t trim_candidates_to_sort(
+  size_t candidates,
+  uint64_t candidates_size,
+  uint64_t size_to_delete,
+  size_t objects_to_delete) {
+    if (candidates == 0) {
+        return 0;
+    }
+    // Estimate how many of the oldest files free the requested space from
+    // the average file size, and keep a wide margin because trim_fast skips
+    // some candidates (tmp and index files) and sizes are not uniform.
+    const uint64_t average_size = std::max<uint64_t>(
+      candidates_size / candidates, 1);
+    const uint64_t estimate = std::max<uint64_t>(
+      objects_to_delete, size_to_delete / average_size + 1);
+    constexpr uint64_t margin_factor = 2;
+    constexpr uint64_t min_sorted = 1024;
+    return std::min<uint64_t>(
+      candidates, std::max(estimate * margin_factor, min_sorted));
+}
+
+void sort_oldest_candidates(
+  fragmented_vector<file_list_item>& candidates, size_t n) {
+    const auto by_atime = [](const auto& a, const auto& b) {
+        return a.access_time < b.access_time;
+    };
+    n = std::min(n, candidates.size());
+    if (n < candidates.size()) {
+        // Every item past the first n is at least as recent as all of them,
+        // so a trim which runs past the sorted prefix still removes the
+        // oldest files first, in approximate order.
+        std::nth_element(
+          candidates.begin(),
+          candidates.begin() + static_cast<ptrdiff_t>(n),
+          candidates.end(),
+          by_atime);
+    }
+    std::sort(
+      candidates.begin(),
+      candidates.begin() + static_cast<ptrdiff_t>(n),
+      by_atime);
+}
+
 ss::future<> cache::clean_up_at_start() {
     auto guard = _gate.hold();
     auto [walked_size, filtered_out_files, candidates_for_deletion, empty_dirs]
@@ -379,12 +450,6 @@ ss::future<> cache::trim(
         co_return;
     }
 
-    // Sort by atime for the subsequent LRU trimming loop
-    std::sort(
-      candidates_for_deletion.begin(),
-      candidates_for_deletion.end(),
-      [](auto& a, auto& b) { return a.access_time < b.access_time; });
-
     // Calculate how much to delete
     auto size_to_delete
       = (_current_cache_size + _reserved_cache_size)
@@ -394,6 +459,17 @@ ss::future<> cache::trim(
         - std::min(
           target_objects, _current_cache_objects + _reserved_cache_objects);
 
+    // Order the oldest candidates by atime for the subsequent LRU trimming
+    // loop. Sorting the whole list costs O(n log n) on a cache holding
+    // millions of chunks while a trim only removes a small fraction of them.
+    sort_oldest_candidates(
+      candidates_for_deletion,
+      trim_candidates_to_sort(
+        candidates_for_deletion.size(),
+        walked_cache_size,
+        size_to_delete,
+        objects_to_delete));
+
     vlog(
       cst_log.debug,
       "trim: removing {}/{} bytes, {}/{} objects ({}% of cache) to reach "
@@ -657,7 +733,14 @@ ss::future<cache::trim_result> cache::trim_fast(
 bool cache::is_trim_exempt(const ss::sstring& path) const {
     if (
       path == (_cache_dir / access_time_tracker_file_name).string()
-      || path == (_cache_dir / access_time_tracker_file_name_tmp).string()) {
+      || path == (_cache_dir / access_time_tracker_file_name_tmp).string()
+      || path == (_cache_dir / walk_summary_file_name_tmp).string()) {
+        return true;
+    }
+
+    // The slabs are never deleted, their chunks are evicted by the store
+    if (std::string_view(path).starts_with(
+          (_cache_dir / chunk_slab_store::dir_name).string() + "/")) {
         return true;
     }
 
@@ -856,7 +939,9 @@ ss::future<> cache::start() {
         // access time tracker has to be initialized before
         // cleanup
         co_await load_access_time_tracker();
-        co_await clean_up_at_start();
+        if (!co_await load_walk_summary()) {
+            co_await clean_up_at_start();
+        }
 
         _tracker_timer.set_callback([this] {
             ssx::spawn_with_gate(_gate, [this] {
@@ -870,7 +955,49 @@ ss::future<> cache::start() {
             });
         });
         _tracker_timer.arm_periodic(access_timer_period);
+    } else {
+        _tracker_timer.set_callback([this] {
+            ssx::spawn_with_gate(
+              _gate, [this] { return flush_access_times(); });
+        });
+        _tracker_timer.arm_periodic(access_time_flush_period);
+    }
+
+    co_await start_slabs();
+}
+
+ss::future<> cache::start_slabs() {
+    const auto slabs
+      = config::shard_local_cfg().cloud_storage_cache_slabs_per_shard();
+    if (slabs == 0) {
+        co_return;
+    }
+    _slabs = std::make_unique<chunk_slab_store>(
+      _cache_dir / chunk_slab_store::dir_name
+        / fmt::format("{}", ss::this_shard_id()),
+      config::shard_local_cfg().cloud_storage_cache_slab_size(),
+      slabs);
+    auto created = co_await _slabs->start();
+    if (created == 0) {
+        co_return;
+    }
+    // The next walk of the cache counts the slabs like the other files
+    co_await container().invoke_on(0, [created](cache& c) {
+        c._current_cache_size += created;
+        c.probe.set_size(c._current_cache_size);
+    });
+}
+
+ss::future<> cache::flush_access_times() {
+    if (_pending_access_times.empty()) {
+        co_return;
     }
+    auto batch = std::exchange(_pending_access_times, {});
+    co_await container().invoke_on(0, [batch = std::move(batch)](cache& c) {
+        for (const auto& [path, ts] : batch) {
+            c._access_time_tracker.add_timestamp(path, ts);
+        }
+    });
 }
 
 ss::future<> cache::stop() {
@@ -894,13 +1021,90 @@ ss::future<> cache::stop() {
         });
     }
     co_await _walker.stop();
+    for (auto& [_, h] : _hydrations) {
+        h.done.set_value();
+    }
+    _hydrations.clear();
     co_await _gate.close();
+    if (_slabs) {
+        co_await _slabs->stop();
+    }
+    if (ss::this_shard_id() == 0) {
+        co_await save_walk_summary().handle_exception([](auto eptr) {
+            vlog(cst_log.warn, "failed to save cache walk summary: {}", eptr);
+        });
+    }
+}
+
+ss::future<bool> cache::load_walk_summary() {
+    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
+    auto path = _cache_dir / walk_summary_file_name;
+    if (!co_await ss::file_exists(path.native())) {
+        co_return false;
+    }
+
+    std::optional<walk_summary> summary;
+    try {
+        auto buf = co_await read_fully(path);
+        summary = serde::from_iobuf<walk_summary>(std::move(buf));
+    } catch (...) {
+        vlog(
+          cst_log.warn,
+          "Failed to read cache walk summary '{}': {}",
+          path,
+          std::current_exception());
+    }
+    // Whatever happens next invalidates the summary
+    co_await ss::remove_file(path.native());
+    if (!summary) {
+        co_return false;
+    }
+
+    _current_cache_size = summary->cache_size;
+    _current_cache_objects = summary->cache_objects;
+    probe.set_size(_current_cache_size);
+    probe.set_num_files(_current_cache_objects);
+    vlog(
+      cst_log.info,
+      "Skipping startup walk of the cache after a clean shutdown, size {}/{}",
+      _current_cache_size,
+      _current_cache_objects);
+    co_return true;
+}
+
+ss::future<> cache::save_walk_summary() {
+    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
+    // A download in progress leaves a tmp file behind, which only the
+    // startup walk cleans up.
+    if (_reserved_cache_objects > 0 || !_files_in_progress.empty()) {
+        vlog(
+          cst_log.debug,
+          "Not saving cache walk summary, {} downloads in progress",
+          _reserved_cache_objects);
+        co_return;
+    }
+
+    auto tmp_path = _cache_dir / walk_summary_file_name_tmp;
+    co_await write_fully(
+      tmp_path,
+      serde::to_iobuf(walk_summary{
+        .cache_size = _current_cache_size,
+        .cache_objects = _current_cache_objects}));
+    co_await ss::rename_file(
+      tmp_path.native(), (_cache_dir / walk_summary_file_name).native());
 }
 
 ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
     auto guard = _gate.hold();
     vlog(cst_log.debug, "Trying to get {} from archival cache.", key.native());
     probe.get();
+    if (_slabs && is_chunk_key(key)) {
+        if (auto chunk = co_await _slabs->get(key.native()); chunk) {
+            probe.cached_get();
+            co_return std::optional(
+              cache_item{std::move(chunk->first), chunk->second});
+        }
+    }
     ss::file cache_file;
     try {
         auto source = (_cache_dir / key).native();
@@ -911,12 +1115,13 @@ ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
             _access_time_tracker.add_timestamp(
               source, std::chrono::system_clock::now());
         } else {
-            ssx::spawn_with_gate(_gate, [this, source] {
-                return container().invoke_on(0, [source](cache& c) {
-                    c._access_time_tracker.add_timestamp(
-                      source, std::chrono::system_clock::now());
-                });
-            });
+            // One cross shard call per get() would flood shard 0 during
+            // large scans, record the access and send it in a batch.
+            _pending_access_times[source] = std::chrono::system_clock::now();
+            if (_pending_access_times.size() >= max_pending_access_times) {
+                ssx::spawn_with_gate(
+                  _gate, [this] { return flush_access_times(); });
+            }
         }
     } catch (std::filesystem::filesystem_error& e) {
         if (e.code() == std::errc::no_such_file_or_directory) {
@@ -974,6 +1179,22 @@ ss::future<> cache::put(
     }
     auto dir_path = normal_key_path.remove_filename();
 
+    if (_slabs && is_chunk_key(key)) {
+        if (co_await _slabs->put(
+              key.native(),
+              data,
+              reservation.bytes(),
+              io_priority,
+              write_buffer_size,
+              write_behind)) {
+            // The space of the slabs is already accounted for
+            reservation.wrote_data(0, 0);
+            co_return;
+        }
+        // Stored as a file, which must not be shadowed by an older version
+        co_await _slabs->invalidate(key.native());
+    }
+
     // tmp file is used to protect against concurrent writes to the same
     // file. One tmp file is written only once by one thread. tmp file
     // should not be read directly. _cnt is an atomic counter that
@@ -1070,6 +1291,9 @@ cache::is_cached(const std::filesystem::path& key) {
     if (_files_in_progress.contains(key)) {
         return seastar::make_ready_future<cache_element_status>(
           cache_element_status::in_progress);
+    } else if (_slabs && _slabs->contains(key.native())) {
+        return seastar::make_ready_future<cache_element_status>(
+          cache_element_status::available);
     } else {
         return ss::file_exists((_cache_dir / key).native())
           .then([](bool exists) {
@@ -1085,6 +1309,9 @@ ss::future<> cache::invalidate(const std::filesystem::path& key) {
       cst_log.debug,
       "Trying to invalidate {} from archival cache.",
       key.native());
+    if (_slabs && co_await _slabs->invalidate(key.native())) {
+        co_return;
+    }
     try {
         auto path = (_cache_dir / key).native();
         auto stat = co_await ss::file_stat(path);
@@ -1158,6 +1385,79 @@ void cache::reserve_space_release(
     }
 }
 
+hydration_claim::~hydration_claim() {
+    if (_cache != nullptr) {
+        _cache->hydration_release(_key, _id);
+    }
+}
+
+ss::shard_id cache::hydration_shard(const std::filesystem::path& key) {
+    return std::hash<std::string_view>{}(key.native()) % ss::smp::count;
+}
+
+ss::future<hydration_claim>
+cache::claim_hydration(std::filesystem::path key) {
+    auto [id, waited] = co_await container().invoke_on(
+      hydration_shard(key), [k = ss::sstring(key.native())](cache& c) {
+          return c.do_claim_hydration(k);
+      });
+    co_return hydration_claim(*this, std::move(key), id, waited);
+}
+
+ss::future<std::pair<uint64_t, bool>>
+cache::do_claim_hydration(ss::sstring key) {
+    auto holder = _gate.hold();
+    bool waited = false;
+    for (auto it = _hydrations.find(key); it != _hydrations.end();
+         it = _hydrations.find(key)) {
+        waited = true;
+        const auto id = it->second.id;
+        try {
+            co_await it->second.done.get_shared_future(
+              ss::lowres_clock::now() + cache_hydration_timeout);
+        } catch (const ss::timed_out_error&) {
+            // A download that doesn't finish within its own timeout lost its
+            // claim, e.g. the release didn't make it to this shard
+            if (auto stale = _hydrations.find(key);
+                stale != _hydrations.end() && stale->second.id == id) {
+                vlog(
+                  cst_log.warn,
+                  "Hydration of {} didn't release its claim, taking it over",
+                  key);
+                stale->second.done.set_value();
+                _hydrations.erase(stale);
+            }
+        }
+        _gate.check();
+    }
+    const auto id = _next_hydration_id++;
+    _hydrations.emplace(std::move(key), hydration{.id = id});
+    co_return std::make_pair(id, waited);
+}
+
+void cache::hydration_release(const std::filesystem::path& key, uint64_t id) {
+    auto owner = hydration_shard(key);
+    if (ss::this_shard_id() == owner) {
+        do_hydration_release(key.native(), id);
+    } else {
+        ssx::spawn_with_gate(
+          _gate, [this, owner, k = ss::sstring(key.native()), id]() {
+              return container().invoke_on(
+                owner, [k, id](cache& c) { c.do_hydration_release(k, id); });
+          });
+    }
+}
+
+void cache::do_hydration_release(const ss::sstring& key, uint64_t id) {
+    auto it = _hydrations.find(key);
+    if (it == _hydrations.end() || it->second.id != id) {
+        // taken over after a timeout
+        return;
+    }
+    it->second.done.set_value();
+    _hydrations.erase(it);
+}
+
 void cache::do_reserve_space_release(
   uint64_t bytes, size_t objects, uint64_t wrote_bytes, size_t wrote_objects) {
     vassert(ss::this_shard_id() == ss::shard_id{0}, "Only call on shard 0");
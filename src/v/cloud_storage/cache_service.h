@@ -12,6 +12,7 @@
 
 #include "cloud_storage/access_time_tracker.h"
 #include "cloud_storage/cache_probe.h"
+#include "cloud_storage/chunk_slab_store.h"
 #include "cloud_storage/recursive_directory_walker.h"
 #include "config/property.h"
 #include "resource_mgmt/io_priority.h"
@@ -24,6 +25,10 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/iostream.hh>
+#include <seastar/core/shared_future.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
 
 #include <filesystem>
 #include <set>
@@ -89,6 +94,8 @@ public:
     /// May only be called once per reservation.
     void wrote_data(uint64_t, size_t);
 
+    uint64_t bytes() const { return _bytes; }
+
 private:
     cache& _cache;
 
@@ -97,6 +104,53 @@ private:
     size_t _objects{0};
 };
 
+/// RAII claim of the download of an object into the cache, made with
+/// cache::claim_hydration and released on destruction.
+class hydration_claim {
+public:
+    hydration_claim(
+      cache& cache, std::filesystem::path key, uint64_t id, bool waited)
+      : _cache(&cache)
+      , _key(std::move(key))
+      , _id(id)
+      , _waited(waited) {}
+
+    hydration_claim(const hydration_claim&) = delete;
+    hydration_claim& operator=(const hydration_claim&) = delete;
+    hydration_claim(hydration_claim&& rhs) noexcept
+      : _cache(std::exchange(rhs._cache, nullptr))
+      , _key(std::move(rhs._key))
+      , _id(rhs._id)
+      , _waited(rhs._waited) {}
+    hydration_claim& operator=(hydration_claim&&) = delete;
+
+    ~hydration_claim();
+
+    /// True if another download of the object was in flight when the claim
+    /// was made: the object may be in the cache by now.
+    bool waited() const { return _waited; }
+
+private:
+    cache* _cache;
+    std::filesystem::path _key;
+    uint64_t _id;
+    bool _waited;
+};
+
+/// Number of trim candidates which need to be in access time order for a
+/// trim removing \p size_to_delete bytes and \p objects_to_delete objects
+/// out of \p candidates files, totalling \p candidates_size bytes.
+size_t trim_candidates_to_sort(
+  size_t candidates,
+  uint64_t candidates_size,
+  uint64_t size_to_delete,
+  size_t objects_to_delete);
+
+/// Move the \p n least recently accessed candidates to the front, in access
+/// time order. The remaining candidates are left in no particular order.
+void sort_oldest_candidates(
+  fragmented_vector<file_list_item>& candidates, size_t n);
+
 class cache : public ss::peering_sharded_service<cache> {
 public:
     /// C-tor.
@@ -164,6 +218,19 @@ public:
     // a background fiber in order to be callable from the guard destructor.
     void reserve_space_release(uint64_t, size_t, uint64_t, size_t);
 
+    /// Claim the download of \p key into the cache.
+    ///
+    /// Downloads of the same key are deduplicated node wide: the claims of a
+    /// key are tracked by the shard which owns the key, and a claim is only
+    /// granted once the previous claim of the key is released. The caller
+    /// should check the cache again if the claim reports that it waited,
+    /// before downloading the object itself.
+    ss::future<hydration_claim> claim_hydration(std::filesystem::path key);
+
+    // Release a claim made with `claim_hydration`.  This spawns a background
+    // fiber in order to be callable from the claim destructor.
+    void hydration_release(const std::filesystem::path& key, uint64_t id);
+
     static ss::future<> initialize(std::filesystem::path);
 
     /// Shard 0 only.  Update the utilization status of local disk.  Will
@@ -177,6 +244,10 @@ public:
 
     uint64_t get_usage_bytes() { return _current_cache_size; }
 
+    /// True while new downloads into the cache are blocked because the local
+    /// disk is critically low on space. Maintained on every shard.
+    bool is_under_pressure() const { return _block_puts; }
+
     /// Administrative trim, that specifies its own limits instead of using
     /// the configured limits (skips throttling, and can e.g. trim to zero bytes
     /// if they want to)
@@ -189,6 +260,8 @@ public:
         return _cache_dir / key;
     }
 
+    const cache_probe& get_probe() const { return probe; }
+
 private:
     /// Load access time tracker from file
     ss::future<> load_access_time_tracker();
@@ -200,6 +273,25 @@ private:
     /// Save access time tracker state to the file if needed
     ss::future<> maybe_save_access_time_tracker();
 
+    /// Shard which tracks the hydrations of \p key
+    static ss::shard_id hydration_shard(const std::filesystem::path& key);
+
+    /// Owner shard only. Wait until \p key isn't being hydrated and claim
+    /// it, returns the id of the claim and whether the caller waited.
+    ss::future<std::pair<uint64_t, bool>> do_claim_hydration(ss::sstring key);
+    void do_hydration_release(const ss::sstring& key, uint64_t id);
+
+    /// Send the access times recorded on this shard to the tracker on shard 0
+    ss::future<> flush_access_times();
+
+    /// Load the cache usage saved by a clean shutdown. Returns false if there
+    /// is none, in which case the startup walk is required.
+    ss::future<bool> load_walk_summary();
+
+    /// Save the cache usage for the next startup, if no downloads are in
+    /// progress.
+    ss::future<> save_walk_summary();
+
     /// Triggers directory walker, creates a list of files to delete and deletes
     /// them until cache size <= _cache_size_low_watermark * max_bytes
     ss::future<> trim(
@@ -268,6 +360,9 @@ private:
     /// (only runs on shard 0)
     void do_reserve_space_release(uint64_t, size_t, uint64_t, size_t);
 
+    /// Open the slabs of the chunks of this shard, if configured
+    ss::future<> start_slabs();
+
     /// Update _block_puts and kick _block_puts_cond if necessary.  This is
     /// called on all shards by shard 0 when handling a disk space status
     /// update.
@@ -320,6 +415,22 @@ private:
     access_time_tracker _access_time_tracker;
     ss::timer<ss::lowres_clock> _tracker_timer;
 
+    /// Access times not yet sent to shard 0 (shards other than 0 only)
+    absl::flat_hash_map<ss::sstring, std::chrono::system_clock::time_point>
+      _pending_access_times;
+
+    /// Downloads in progress of the keys owned by this shard, see
+    /// claim_hydration. The nodes are stable while there are waiters.
+    struct hydration {
+        uint64_t id;
+        ss::shared_promise<> done;
+    };
+    absl::node_hash_map<ss::sstring, hydration> _hydrations;
+    uint64_t _next_hydration_id{0};
+
+    /// Segment chunks of this shard stored in slab files, if enabled
+    std::unique_ptr<chunk_slab_store> _slabs;
+
     /// Remember when we last finished clean_up_cache, in order to
     /// avoid wastefully running it again soon after.
     ss::lowres_clock::time_point _last_clean_up;
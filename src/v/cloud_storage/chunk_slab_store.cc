@@ -0,0 +1,506 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/chunk_slab_store.h"
+
+#include "cloud_storage/logger.h"
+#include "serde/serde.h"
+#include "units.h"
+#include "utils/file_io.h"
+#include "vlog.h"
+
+#include <seastar/core/align.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/seastar.hh>
+
+#include <sys/stat.h>
+
+#include <system_error>
+
+namespace cloud_storage {
+
+namespace {
+
+static constexpr const char* index_file_name = "index";
+static constexpr const char* index_file_name_tmp = "index.tmp";
+
+// Extents start on a block boundary of the slab, for direct I/O
+static constexpr uint64_t extent_alignment = 4_KiB;
+
+struct persisted_slab
+  : serde::
+      envelope<persisted_slab, serde::version<0>, serde::compat_version<0>> {
+    uint64_t write_pos{0};
+    int64_t last_access_ms{0};
+
+    auto serde_fields() { return std::tie(write_pos, last_access_ms); }
+};
+
+struct persisted_extent
+  : serde::
+      envelope<persisted_extent, serde::version<0>, serde::compat_version<0>> {
+    ss::sstring key;
+    uint32_t slab{0};
+    uint64_t offset{0};
+    uint64_t size{0};
+
+    auto serde_fields() { return std::tie(key, slab, offset, size); }
+};
+
+struct slab_index
+  : serde::envelope<slab_index, serde::version<0>, serde::compat_version<0>> {
+    uint64_t slab_size{0};
+    uint32_t active{0};
+    std::vector<persisted_slab> slabs;
+    std::vector<persisted_extent> extents;
+
+    auto serde_fields() {
+        return std::tie(slab_size, active, slabs, extents);
+    }
+};
+
+/// Read only view of an extent of a slab, or the destination of a chunk
+/// being written to the slab. Offsets are relative to the start of the
+/// extent, and the reads stop at its end like at the end of a file.
+///
+/// Takes over a pin of the slab, released when the file is closed.
+class slab_extent_file final : public ss::file_impl {
+public:
+    slab_extent_file(
+      ss::lw_shared_ptr<chunk_slab_store::slab> slab,
+      uint64_t offset,
+      uint64_t size,
+      uint64_t capacity)
+      : _slab(std::move(slab))
+      , _offset(offset)
+      , _size(size)
+      , _capacity(capacity) {}
+
+    slab_extent_file(const slab_extent_file&) = delete;
+    slab_extent_file& operator=(const slab_extent_file&) = delete;
+    ~slab_extent_file() override { release(); }
+
+    ss::future<size_t> write_dma(
+      uint64_t pos,
+      const void* buffer,
+      size_t len,
+      const ss::io_priority_class& pc) final {
+        check_write(pos, len);
+        auto n = co_await get_file_impl(_slab->file)
+                   ->write_dma(_offset + pos, buffer, len, pc);
+        _size = std::max(_size, pos + n);
+        co_return n;
+    }
+
+    ss::future<size_t> write_dma(
+      uint64_t pos,
+      std::vector<iovec> iov,
+      const ss::io_priority_class& pc) final {
+        size_t len = 0;
+        for (const auto& io : iov) {
+            len += io.iov_len;
+        }
+        check_write(pos, len);
+        auto n = co_await get_file_impl(_slab->file)
+                   ->write_dma(_offset + pos, std::move(iov), pc);
+        _size = std::max(_size, pos + n);
+        co_return n;
+    }
+
+    ss::future<size_t> read_dma(
+      uint64_t pos,
+      void* buffer,
+      size_t len,
+      const ss::io_priority_class& pc) final {
+        if (pos >= _size) {
+            co_return 0;
+        }
+        // the capacity is aligned, unlike the size of the extent
+        len = std::min(len, _capacity - pos);
+        auto n = co_await get_file_impl(_slab->file)
+                   ->read_dma(_offset + pos, buffer, len, pc);
+        co_return std::min(n, _size - pos);
+    }
+
+    ss::future<size_t> read_dma(
+      uint64_t pos,
+      std::vector<iovec> iov,
+      const ss::io_priority_class& pc) final {
+        if (pos >= _size) {
+            co_return 0;
+        }
+        auto n = co_await get_file_impl(_slab->file)
+                   ->read_dma(_offset + pos, std::move(iov), pc);
+        co_return std::min(n, _size - pos);
+    }
+
+    ss::future<> flush() final { return _slab->file.flush(); }
+
+    ss::future<struct stat> stat() final {
+        auto st = co_await _slab->file.stat();
+        st.st_size = static_cast<off_t>(_size);
+        st.st_blocks = static_cast<blkcnt_t>(_capacity / 512);
+        co_return st;
+    }
+
+    ss::future<> truncate(uint64_t length) final {
+        if (length > _capacity) {
+            return ss::make_exception_future<>(
+              std::system_error(EFBIG, std::system_category()));
+        }
+        _size = length;
+        return ss::now();
+    }
+
+    // The space of the extents is managed by the store
+    ss::future<> discard(uint64_t, uint64_t) final { return ss::now(); }
+    ss::future<> allocate(uint64_t, uint64_t) final { return ss::now(); }
+
+    ss::future<uint64_t> size() final {
+        return ss::make_ready_future<uint64_t>(_size);
+    }
+
+    // The slab is shared by the extents, only the pin is released
+    ss::future<> close() final {
+        release();
+        return ss::now();
+    }
+
+    std::unique_ptr<ss::file_handle_impl> dup() final {
+        throw std::system_error(ENOTSUP, std::system_category());
+    }
+
+    ss::subscription<ss::directory_entry>
+    list_directory(std::function<ss::future<>(ss::directory_entry)>) final {
+        throw std::system_error(ENOTDIR, std::system_category());
+    }
+
+    ss::future<ss::temporary_buffer<uint8_t>> dma_read_bulk(
+      uint64_t pos, size_t len, const ss::io_priority_class& pc) final {
+        if (pos >= _size) {
+            co_return ss::temporary_buffer<uint8_t>();
+        }
+        len = std::min(len, _size - pos);
+        auto buf = co_await get_file_impl(_slab->file)
+                     ->dma_read_bulk(_offset + pos, len, pc);
+        buf.trim(std::min(buf.size(), len));
+        co_return buf;
+    }
+
+private:
+    void check_write(uint64_t pos, size_t len) const {
+        if (pos + len > _capacity) {
+            throw std::system_error(EFBIG, std::system_category());
+        }
+    }
+
+    void release() noexcept {
+        if (!_released) {
+            _released = true;
+            --_slab->pins;
+        }
+    }
+
+    ss::lw_shared_ptr<chunk_slab_store::slab> _slab;
+    uint64_t _offset;
+    uint64_t _size;
+    uint64_t _capacity;
+    bool _released{false};
+};
+
+uint64_t extent_capacity(uint64_t size) {
+    return ss::align_up(size, extent_alignment);
+}
+
+int64_t to_millis(std::chrono::system_clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+             t.time_since_epoch())
+      .count();
+}
+
+} // namespace
+
+chunk_slab_store::chunk_slab_store(
+  std::filesystem::path dir, uint64_t slab_size, uint32_t slab_count)
+  : _dir(std::move(dir))
+  , _slab_size(ss::align_down(slab_size, extent_alignment))
+  , _slab_count(slab_count) {}
+
+std::filesystem::path chunk_slab_store::slab_path(uint32_t i) const {
+    return _dir / fmt::format("slab_{}", i);
+}
+
+ss::future<uint64_t> chunk_slab_store::start() {
+    auto holder = _gate.hold();
+    co_await ss::recursive_touch_directory(_dir.native());
+
+    uint64_t created = 0;
+    _slabs.reserve(_slab_count);
+    for (uint32_t i = 0; i < _slab_count; ++i) {
+        auto s = ss::make_lw_shared<slab>();
+        s->file = co_await ss::open_file_dma(
+          slab_path(i).native(), ss::open_flags::rw | ss::open_flags::create);
+        auto size = co_await s->file.size();
+        if (size != _slab_size) {
+            co_await s->file.truncate(_slab_size);
+            co_await s->file.allocate(0, _slab_size);
+            created += _slab_size - std::min(size, _slab_size);
+        }
+        _slabs.push_back(std::move(s));
+    }
+    // Slabs of a previous configuration with more of them
+    for (uint32_t i = _slab_count;
+         co_await ss::file_exists(slab_path(i).native());
+         ++i) {
+        co_await ss::remove_file(slab_path(i).native());
+    }
+
+    co_await load_index();
+    vlog(
+      cst_log.info,
+      "Cache chunk slabs in {}: {} slabs of {} bytes, {} chunks",
+      _dir,
+      _slab_count,
+      _slab_size,
+      _extents.size());
+    co_return created;
+}
+
+ss::future<> chunk_slab_store::stop() {
+    co_await _gate.close();
+    {
+        auto units = co_await _index_lock.get_units();
+        try {
+            co_await persist_index();
+        } catch (...) {
+            vlog(
+              cst_log.warn,
+              "Failed to save the index of the cache slabs in {}: {}",
+              _dir,
+              std::current_exception());
+        }
+    }
+    for (auto& s : _slabs) {
+        co_await s->file.close();
+    }
+}
+
+ss::future<> chunk_slab_store::load_index() {
+    auto path = _dir / index_file_name;
+    if (!co_await ss::file_exists(path.native())) {
+        co_return;
+    }
+
+    slab_index index;
+    try {
+        index = serde::from_iobuf<slab_index>(co_await read_fully(path));
+    } catch (...) {
+        vlog(
+          cst_log.warn,
+          "Failed to read the index of the cache slabs '{}': {}",
+          path,
+          std::current_exception());
+        co_return;
+    }
+    if (
+      index.slab_size != _slab_size || index.slabs.size() != _slab_count
+      || index.active >= _slab_count) {
+        vlog(
+          cst_log.info,
+          "Dropping the cache slabs of a different layout ({} slabs of {} "
+          "bytes)",
+          index.slabs.size(),
+          index.slab_size);
+        co_return;
+    }
+
+    _active = index.active;
+    for (uint32_t i = 0; i < _slab_count; ++i) {
+        _slabs[i]->write_pos = index.slabs[i].write_pos;
+        _slabs[i]->last_access = std::chrono::system_clock::time_point(
+          std::chrono::milliseconds(index.slabs[i].last_access_ms));
+    }
+    for (auto& e : index.extents) {
+        if (
+          e.slab >= _slab_count
+          || e.offset + extent_capacity(e.size) > _slab_size) {
+            continue;
+        }
+        _slabs[e.slab]->keys.push_back(e.key);
+        _extents.insert_or_assign(
+          std::move(e.key),
+          extent{.slab = e.slab, .offset = e.offset, .size = e.size});
+    }
+}
+
+ss::future<> chunk_slab_store::persist_index() {
+    // The extents of the index must not be lost in the page cache
+    for (auto& s : _slabs) {
+        if (s->dirty) {
+            s->dirty = false;
+            co_await s->file.flush();
+        }
+    }
+
+    slab_index index{.slab_size = _slab_size, .active = _active};
+    index.slabs.reserve(_slabs.size());
+    for (const auto& s : _slabs) {
+        index.slabs.push_back(persisted_slab{
+          .write_pos = s->write_pos,
+          .last_access_ms = to_millis(s->last_access)});
+    }
+    index.extents.reserve(_extents.size());
+    for (const auto& [key, e] : _extents) {
+        index.extents.push_back(persisted_extent{
+          .key = key, .slab = e.slab, .offset = e.offset, .size = e.size});
+    }
+
+    auto tmp_path = _dir / index_file_name_tmp;
+    co_await write_fully(tmp_path, serde::to_iobuf(std::move(index)));
+    co_await ss::rename_file(
+      tmp_path.native(), (_dir / index_file_name).native());
+}
+
+std::optional<uint32_t> chunk_slab_store::reuse_candidate() const {
+    std::optional<uint32_t> candidate;
+    for (uint32_t i = 0; i < _slabs.size(); ++i) {
+        if (i == _active || _slabs[i]->pins > 0) {
+            continue;
+        }
+        if (
+          !candidate
+          || _slabs[i]->last_access < _slabs[*candidate]->last_access) {
+            candidate = i;
+        }
+    }
+    return candidate;
+}
+
+void chunk_slab_store::drop_extents(uint32_t i) {
+    for (const auto& key : _slabs[i]->keys) {
+        auto it = _extents.find(key);
+        if (it != _extents.end() && it->second.slab == i) {
+            _extents.erase(it);
+        }
+    }
+    _slabs[i]->keys.clear();
+    _slabs[i]->write_pos = 0;
+}
+
+ss::future<std::optional<chunk_slab_store::extent>>
+chunk_slab_store::allocate(uint64_t size) {
+    const auto capacity = extent_capacity(size);
+    if (capacity > _slab_size) {
+        co_return std::nullopt;
+    }
+
+    auto units = co_await _index_lock.get_units();
+    if (_slabs[_active]->write_pos + capacity > _slab_size) {
+        auto candidate = reuse_candidate();
+        if (!candidate) {
+            vlog(
+              cst_log.debug,
+              "All the cache slabs in {} are in use, not storing a chunk of {} "
+              "bytes",
+              _dir,
+              size);
+            co_return std::nullopt;
+        }
+        vlog(
+          cst_log.debug,
+          "Reusing cache slab {} in {}, dropping {} chunks",
+          *candidate,
+          _dir,
+          _slabs[*candidate]->keys.size());
+        drop_extents(*candidate);
+        _active = *candidate;
+        _slabs[_active]->last_access = std::chrono::system_clock::now();
+        // The dropped chunks must be gone from the index before their space
+        // is overwritten
+        co_await persist_index();
+    }
+
+    auto& s = *_slabs[_active];
+    extent e{.slab = _active, .offset = s.write_pos, .size = size};
+    s.write_pos += capacity;
+    ++s.pins;
+    co_return e;
+}
+
+ss::future<std::optional<std::pair<ss::file, uint64_t>>>
+chunk_slab_store::get(const ss::sstring& key) {
+    auto it = _extents.find(key);
+    if (it == _extents.end()) {
+        return ss::make_ready_future<
+          std::optional<std::pair<ss::file, uint64_t>>>(std::nullopt);
+    }
+    const auto& e = it->second;
+    auto& s = _slabs[e.slab];
+    ++s->pins;
+    s->last_access = std::chrono::system_clock::now();
+    auto file = ss::file(ss::make_shared<slab_extent_file>(
+      s, e.offset, e.size, extent_capacity(e.size)));
+    return ss::make_ready_future<std::optional<std::pair<ss::file, uint64_t>>>(
+      std::make_pair(std::move(file), e.size));
+}
+
+ss::future<bool> chunk_slab_store::put(
+  const ss::sstring& key,
+  ss::input_stream<char>& data,
+  uint64_t size,
+  ss::io_priority_class io_priority,
+  size_t write_buffer_size,
+  unsigned int write_behind) {
+    auto holder = _gate.hold();
+    auto e = co_await allocate(size);
+    if (!e) {
+        co_return false;
+    }
+
+    auto s = _slabs[e->slab];
+    auto file = ss::file(ss::make_shared<slab_extent_file>(
+      s, e->offset, 0, extent_capacity(size)));
+    ss::file_output_stream_options options{};
+    options.buffer_size = write_buffer_size;
+    options.write_behind = write_behind;
+    options.io_priority_class = io_priority;
+    auto out = co_await ss::make_file_output_stream(file, options);
+    co_await ss::copy(data, out)
+      .then([&out]() { return out.flush(); })
+      .finally([&out]() { return out.close(); });
+
+    e->size = co_await file.size();
+    s->dirty = true;
+    s->keys.push_back(key);
+    _extents.insert_or_assign(key, *e);
+    co_return true;
+}
+
+ss::future<bool> chunk_slab_store::invalidate(const ss::sstring& key) {
+    auto holder = _gate.hold();
+    auto units = co_await _index_lock.get_units();
+    auto it = _extents.find(key);
+    if (it == _extents.end()) {
+        co_return false;
+    }
+    auto e = it->second;
+    _extents.erase(it);
+    co_await persist_index();
+    // Readers of the chunk would see the hole, the space of a held slab is
+    // reclaimed when the slab is reused
+    if (_slabs[e.slab]->pins == 0) {
+        co_await _slabs[e.slab]->file.discard(
+          e.offset, extent_capacity(e.size));
+    }
+    co_return true;
+}
+
+} // namespace cloud_storage
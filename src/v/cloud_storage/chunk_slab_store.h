@@ -0,0 +1,144 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "utils/mutex.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/io_priority_class.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace cloud_storage {
+
+/**
+ * Storage of the segment chunks of the cache of a shard in a few large
+ * preallocated slab files, instead of a file per chunk.
+ *
+ * The chunks are appended to the active slab. When it is full, the least
+ * recently read slab which no reader holds open becomes the active one and
+ * all of its chunks are dropped at once: eviction doesn't unlink any file,
+ * and the directory walks of the cache only see the slabs.
+ *
+ * The location of the chunks is kept in memory and persisted in an index
+ * file, which is rewritten before a slab is reused or a chunk invalidated:
+ * the persisted index never refers to overwritten data. The chunks written
+ * since the last persist are lost on a crash, they are only cache misses.
+ *
+ * The slabs are created when the store starts, and count towards the size of
+ * the cache like any other file in the cache directory.
+ */
+class chunk_slab_store {
+public:
+    /// Name of the directory of the slabs in the cache directory
+    static constexpr std::string_view dir_name = "slabs";
+
+    /// \param dir is the directory of the slab files of this store
+    chunk_slab_store(
+      std::filesystem::path dir, uint64_t slab_size, uint32_t slab_count);
+
+    chunk_slab_store(const chunk_slab_store&) = delete;
+    chunk_slab_store& operator=(const chunk_slab_store&) = delete;
+
+    /// Open or create the slab files and load the persisted index. Returns
+    /// the number of bytes of the slab files which were created.
+    ss::future<uint64_t> start();
+    ss::future<> stop();
+
+    /// Chunk \p key as a read only file, and its size. The slab of the
+    /// chunk is not reused until the file is closed.
+    ss::future<std::optional<std::pair<ss::file, uint64_t>>>
+    get(const ss::sstring& key);
+
+    /// Write the \p size bytes of \p data as chunk \p key. Returns false,
+    /// without reading \p data, if the chunk doesn't fit in a slab or all
+    /// the slabs are held open by readers.
+    ss::future<bool> put(
+      const ss::sstring& key,
+      ss::input_stream<char>& data,
+      uint64_t size,
+      ss::io_priority_class io_priority,
+      size_t write_buffer_size,
+      unsigned int write_behind);
+
+    bool contains(const ss::sstring& key) const {
+        return _extents.contains(key);
+    }
+
+    /// Drop chunk \p key, punching a hole in its slab. Returns false if the
+    /// chunk isn't in the store.
+    ss::future<bool> invalidate(const ss::sstring& key);
+
+    size_t chunks() const { return _extents.size(); }
+    uint64_t capacity() const { return _slab_size * _slab_count; }
+
+    /// Slab currently written to, exposed for testing
+    uint32_t active_slab() const { return _active; }
+
+    struct slab {
+        ss::file file;
+        uint64_t write_pos{0};
+        std::chrono::system_clock::time_point last_access;
+        /// Readers and writers holding the slab
+        uint32_t pins{0};
+        /// Written since the last flush
+        bool dirty{false};
+        /// Keys written to the slab, some of them may have been overwritten
+        /// or invalidated since
+        std::vector<ss::sstring> keys;
+    };
+
+    struct extent {
+        uint32_t slab;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+private:
+    std::filesystem::path slab_path(uint32_t) const;
+
+    ss::future<> load_index();
+
+    /// Flush the slabs written to and rewrite the index file
+    ss::future<> persist_index();
+
+    /// Find the position of a new extent of \p size bytes, reusing a slab if
+    /// the active one is full.
+    ss::future<std::optional<extent>> allocate(uint64_t size);
+
+    /// Least recently read slab which isn't held, other than the active one
+    std::optional<uint32_t> reuse_candidate() const;
+
+    void drop_extents(uint32_t slab);
+
+    std::filesystem::path _dir;
+    uint64_t _slab_size;
+    uint32_t _slab_count;
+    std::vector<ss::lw_shared_ptr<slab>> _slabs;
+    uint32_t _active{0};
+    absl::flat_hash_map<ss::sstring, extent> _extents;
+    /// Serializes the changes of the index which must be persisted
+    mutex _index_lock{"cloud/cache/slabs"};
+    ss::gate _gate;
+};
+
+} // namespace cloud_storage
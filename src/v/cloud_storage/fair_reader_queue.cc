@@ -0,0 +1,114 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/fair_reader_queue.h"
+
+#include "vassert.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/gate.hh>
+
+namespace cloud_storage {
+
+void fair_reader_queue::units::reset() noexcept {
+    if (auto q = std::exchange(_queue, nullptr); q != nullptr) {
+        q->release(_client);
+    }
+}
+
+ss::future<fair_reader_queue::units> fair_reader_queue::get_units(
+  ss::sstring client, storage::opt_abort_source_t as) {
+    if (_stopped) {
+        throw ss::gate_closed_exception();
+    }
+    if (as) {
+        as->get().check();
+    }
+    if (_waiters.empty() && has_capacity()) {
+        ++_outstanding;
+        ++_held[client];
+        co_return units(*this, std::move(client));
+    }
+
+    const auto seq = _next_seq++;
+    auto& w = _waiters[seq];
+    w.client = client;
+    auto f = w.promise.get_future();
+    std::optional<ss::abort_source::subscription> sub;
+    if (as) {
+        sub = as->get().subscribe([this, seq]() noexcept {
+            if (auto it = _waiters.find(seq); it != _waiters.end()) {
+                it->second.promise.set_exception(
+                  ss::abort_requested_exception());
+                _waiters.erase(it);
+            }
+        });
+        vassert(sub.has_value(), "abort source is checked above");
+    }
+
+    // the slot is accounted for by admit_waiters before the promise is set
+    co_await std::move(f);
+    co_return units(*this, std::move(client));
+}
+
+void fair_reader_queue::set_capacity(std::optional<size_t> capacity) {
+    _capacity = capacity;
+    admit_waiters();
+}
+
+void fair_reader_queue::stop() {
+    _stopped = true;
+    for (auto& [_, w] : _waiters) {
+        w.promise.set_exception(ss::gate_closed_exception());
+    }
+    _waiters.clear();
+}
+
+size_t fair_reader_queue::held_by(const ss::sstring& client) const {
+    auto it = _held.find(client);
+    return it == _held.end() ? 0 : it->second;
+}
+
+bool fair_reader_queue::has_capacity() const {
+    return !_capacity.has_value()
+           || _outstanding < std::max<size_t>(*_capacity, 1);
+}
+
+void fair_reader_queue::release(const ss::sstring& client) noexcept {
+    vassert(_outstanding > 0, "reader slot released twice");
+    --_outstanding;
+    if (auto it = _held.find(client); it != _held.end() && --it->second == 0) {
+        _held.erase(it);
+    }
+    admit_waiters();
+}
+
+void fair_reader_queue::admit_waiters() noexcept {
+    while (!_waiters.empty() && has_capacity()) {
+        // the oldest waiter of the client with the fewest slots, the queue
+        // is short enough for a linear scan
+        auto next = _waiters.begin();
+        auto fewest = held_by(next->second.client);
+        for (auto it = std::next(next); it != _waiters.end() && fewest > 0;
+             ++it) {
+            if (auto held = held_by(it->second.client); held < fewest) {
+                next = it;
+                fewest = held;
+            }
+        }
+        ++_outstanding;
+        ++_held[next->second.client];
+        auto node = _waiters.extract(next);
+        node.mapped().promise.set_value();
+    }
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "storage/types.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <map>
+#include <optional>
+
+namespace cloud_storage {
+
+/**
+ * Fair admission of the partition readers of a shard.
+ *
+ * A consumer which scans many partitions creates a reader for each of them,
+ * and with first come, first served admission it takes all the slots while
+ * an interactive consumer waits behind it. The queue limits the number of
+ * concurrent readers and, whenever a slot is released, admits the waiter of
+ * the client which holds the fewest slots (the oldest waiter among them).
+ * Every active client thus converges to an equal share of the slots, no
+ * matter how many readers it asks for.
+ *
+ * Without a capacity the readers are admitted immediately.
+ */
+class fair_reader_queue {
+public:
+    /// Slot held by a reader, returned to the queue on destruction.
+    class units {
+    public:
+        units() = default;
+        units(const units&) = delete;
+        units& operator=(const units&) = delete;
+        units(units&& other) noexcept
+          : _queue(std::exchange(other._queue, nullptr))
+          , _client(std::move(other._client)) {}
+        units& operator=(units&& other) noexcept {
+            if (this != &other) {
+                reset();
+                _queue = std::exchange(other._queue, nullptr);
+                _client = std::move(other._client);
+            }
+            return *this;
+        }
+        ~units() { reset(); }
+
+        void reset() noexcept;
+
+    private:
+        friend class fair_reader_queue;
+        units(fair_reader_queue& q, ss::sstring client)
+          : _queue(&q)
+          , _client(std::move(client)) {}
+
+        fair_reader_queue* _queue{nullptr};
+        ss::sstring _client;
+    };
+
+    fair_reader_queue() = default;
+    fair_reader_queue(const fair_reader_queue&) = delete;
+    fair_reader_queue& operator=(const fair_reader_queue&) = delete;
+    fair_reader_queue(fair_reader_queue&&) = delete;
+    fair_reader_queue& operator=(fair_reader_queue&&) = delete;
+    ~fair_reader_queue() = default;
+
+    /// Wait for a slot for a reader of \p client.
+    ///
+    /// \throw ss::abort_requested_exception if \p as is triggered
+    /// \throw ss::gate_closed_exception if the queue is stopped
+    ss::future<units>
+    get_units(ss::sstring client, storage::opt_abort_source_t as);
+
+    /// Set the number of slots, unlimited if unset.
+    void set_capacity(std::optional<size_t>);
+
+    /// Fail all pending and future waiters.
+    void stop();
+
+    size_t outstanding() const { return _outstanding; }
+    size_t waiters() const { return _waiters.size(); }
+    size_t held_by(const ss::sstring& client) const;
+
+private:
+    struct waiter {
+        ss::sstring client;
+        ss::promise<> promise;
+    };
+
+    bool has_capacity() const;
+    void release(const ss::sstring& client) noexcept;
+    void admit_waiters() noexcept;
+
+    std::optional<size_t> _capacity;
+    size_t _outstanding{0};
+    uint64_t _next_seq{0};
+    bool _stopped{false};
+    // waiters by arrival order
+    std::map<uint64_t, waiter> _waiters;
+    // slots held by each client
+    absl::flat_hash_map<ss::sstring, size_t> _held;
+};
+
+} // namespace cloud_storage
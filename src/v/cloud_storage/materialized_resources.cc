@@ -177,7 +177,9 @@ materialized_resources::materialized_resources()
   , _throughput_shard_limit_config(
       config::shard_local_cfg().cloud_storage_max_throughput_per_shard.bind())
   , _relative_throughput(
-      config::shard_local_cfg().cloud_storage_throughput_limit_percent.bind()) {
+      config::shard_local_cfg().cloud_storage_throughput_limit_percent.bind())
+  , _fair_readers_per_shard(
+      config::shard_local_cfg().cloud_storage_fair_readers_per_shard.bind()) {
     auto update_max_mem = [this]() {
         // Update memory capacity to accommodate new max number of segment
         // readers
@@ -211,6 +213,21 @@ materialized_resources::materialized_resources()
     _relative_throughput.watch(reset_tp);
 
     reset_tp();
+
+    _fair_readers_per_shard.watch([this] { update_reader_slots(); });
+    update_reader_slots();
+}
+
+void materialized_resources::update_reader_slots() {
+    auto total = _fair_readers_per_shard();
+    if (!total.has_value()) {
+        _tail_readers.set_capacity(std::nullopt);
+        _historical_readers.set_capacity(std::nullopt);
+        return;
+    }
+    auto historical = std::max<size_t>(*total / 2, 1);
+    _historical_readers.set_capacity(historical);
+    _tail_readers.set_capacity(std::max<size_t>(*total - historical, 1));
 }
 
 ss::future<> materialized_resources::update_throughput() {
@@ -283,6 +300,9 @@ ss::future<> materialized_resources::stop() {
 
     _hydration_units.broken();
 
+    _tail_readers.stop();
+    _historical_readers.stop();
+
     co_await _gate.close();
     cst_log.debug("Stopped materialized_segments...");
 }
@@ -447,9 +467,17 @@ materialized_resources::get_segment_reader_units(
     co_return segment_reader_units{std::move(semaphore_units)};
 }
 
-ss::future<ssx::semaphore_units>
+ss::future<partition_reader_units>
 materialized_resources::get_partition_reader_units(
-  storage::opt_abort_source_t as) {
+  storage::opt_abort_source_t as, ss::sstring client, reader_pool pool) {
+    fair_reader_queue::units slot;
+    {
+        auto queued = _read_path_probe.reader_queue_delay();
+        auto& readers = pool == reader_pool::tail ? _tail_readers
+                                                  : _historical_readers;
+        slot = co_await readers.get_units(std::move(client), as);
+    }
+
     auto sz = projected_remote_partition_reader_memory_usage();
     if (_mem_units.available_units() <= sz) {
         // Update metrics counter if we are trying to acquire units while
@@ -457,7 +485,9 @@ materialized_resources::get_partition_reader_units(
         _partition_readers_delayed += 1;
     }
 
-    return get_units_abortable(_mem_units, sz, as);
+    auto memory = co_await get_units_abortable(_mem_units, sz, as);
+    co_return partition_reader_units{
+      .memory = std::move(memory), .slot = std::move(slot)};
 }
 
 ss::future<ssx::semaphore_units>
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "cloud_storage/fair_reader_queue.h"
 #include "cloud_storage/materialized_manifest_cache.h"
 #include "cloud_storage/read_path_probes.h"
 #include "cloud_storage/remote_partition.h"
@@ -35,6 +36,16 @@ class remote_segment_batch_reader;
 class remote_probe;
 class materialized_manifest_cache;
 
+/// The slots a partition reader is admitted with: reads of the last uploaded
+/// segment of a partition don't queue behind historical scans.
+enum class reader_pool { tail, historical };
+
+/// Units held by a partition reader for its lifetime
+struct partition_reader_units {
+    ssx::semaphore_units memory;
+    fair_reader_queue::units slot;
+};
+
 /**
  * This class tracks:
  * - Instances of materialized_segment that are created by
@@ -65,8 +76,10 @@ public:
     ss::future<segment_reader_units>
     get_segment_reader_units(storage::opt_abort_source_t as);
 
-    ss::future<ssx::semaphore_units>
-    get_partition_reader_units(storage::opt_abort_source_t as);
+    /// Wait for the memory of a partition reader and for a slot in \p pool,
+    /// which is shared fairly between the clients.
+    ss::future<partition_reader_units> get_partition_reader_units(
+      storage::opt_abort_source_t as, ss::sstring client, reader_pool pool);
 
     ss::future<segment_units> get_segment_units(storage::opt_abort_source_t as);
 
@@ -130,6 +143,9 @@ private:
     /// Recalculate and reset throughput limits
     ss::future<> update_throughput();
 
+    /// Split cloud_storage_fair_readers_per_shard between the reader pools
+    void update_reader_slots();
+
     /// Try to evict segment readers until `target_free` units are available in
     /// _reader_units, i.e. available for new readers to be created.
     void trim_segment_readers(size_t target_free);
@@ -179,6 +195,10 @@ private:
     config::binding<std::optional<size_t>> _relative_throughput;
     bool _throttling_disabled{false};
     std::optional<size_t> _device_throughput;
+
+    config::binding<std::optional<uint32_t>> _fair_readers_per_shard;
+    fair_reader_queue _tail_readers;
+    fair_reader_queue _historical_readers;
 };
 
 } // namespace cloud_storage
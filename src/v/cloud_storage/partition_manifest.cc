@@ -293,6 +293,58 @@ partition_manifest::get_legacy_manifest_format_and_path() const {
       manifest_format::json,
       generate_partition_manifest_path(_ntp, _rev, manifest_format::json)};
 }
+
+remote_manifest_path partition_manifest::get_manifest_delta_prefix() const {
+    return remote_manifest_path{
+      fmt::format("{}.delta.", get_manifest_path()().native())};
+}
+
+remote_manifest_path
+partition_manifest::get_manifest_delta_path(model::offset insync_offset) const {
+    return remote_manifest_path{
+      fmt::format(
+        "{}{}", get_manifest_delta_prefix()().native(), insync_offset())};
+}
+
+uint64_t partition_manifest::next_layout_id() {
+    static thread_local uint64_t id = 0;
+    return ++id;
+}
+
+partition_manifest_delta partition_manifest::make_delta(
+  model::offset base_insync_offset, model::offset base_last_offset) const {
+    partition_manifest_delta delta{
+      .base_insync_offset = base_insync_offset,
+      .insync_offset = _insync_offset,
+      .start_offset = _start_offset,
+      .start_kafka_offset_override = _start_kafka_offset_override,
+      .cloud_log_size_bytes = _cloud_log_size_bytes,
+      .highest_producer_id = _highest_producer_id,
+    };
+    for (auto it = _segments.upper_bound(base_last_offset),
+              end_it = _segments.end();
+         it != end_it;
+         ++it) {
+        delta.segments.push_back(*it);
+    }
+    return delta;
+}
+
+bool partition_manifest::apply_delta(const partition_manifest_delta& delta) {
+    if (delta.base_insync_offset != _insync_offset) {
+        return false;
+    }
+    for (const auto& meta : delta.segments) {
+        add(meta);
+    }
+    advance_start_offset(delta.start_offset);
+    _start_kafka_offset_override = delta.start_kafka_offset_override;
+    _cloud_log_size_bytes = delta.cloud_log_size_bytes;
+    advance_highest_producer_id(delta.highest_producer_id);
+    advance_insync_offset(delta.insync_offset);
+    return true;
+}
+
 const model::ntp& partition_manifest::get_ntp() const { return _ntp; }
 
 model::offset partition_manifest::get_last_offset() const {
@@ -403,6 +455,28 @@ partition_manifest::segment_containing(kafka::offset o) const {
         return end();
     }
 
+    if (const auto& index = get_kafka_offset_index(); index.usable) {
+        // The first segment with a base kafka offset higher than 'o' is
+        // preceded by the segment that has to contain 'o'.
+        auto ix = std::upper_bound(
+          index.bases.begin(),
+          index.bases.end(),
+          o,
+          [](kafka::offset o, const auto& e) { return o < e.first; });
+        if (ix == index.bases.begin()) {
+            return end();
+        }
+        auto it = _segments.find(std::prev(ix)->second);
+        if (
+          ix != index.bases.end()
+          || it->delta_offset_end == model::offset_delta{}) {
+            return it;
+        }
+        // If 'it' points to the last segment, it's not guaranteed that the
+        // segment contains the required kafka offset.
+        return it->next_kafka_offset() <= o ? end() : it;
+    }
+
     // Kafka offset is always <= log offset.
     // To find a segment by its kafka offset we can simply query
     // manifest by log offset and then traverse forward until we
@@ -447,6 +521,68 @@ partition_manifest::segment_containing(kafka::offset o) const {
     return back;
 }
 
+std::optional<kafka::offset>
+partition_manifest::first_kafka_offset_after_term(model::term_id term) const {
+    if (const auto& index = get_kafka_offset_index(); index.usable) {
+        auto it = std::upper_bound(
+          index.terms.begin(),
+          index.terms.end(),
+          term,
+          [](model::term_id t, const auto& e) { return t < e.first; });
+        if (it == index.terms.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+    for (const auto& s : _segments) {
+        if (s.segment_term > term) {
+            return s.base_kafka_offset();
+        }
+    }
+    return std::nullopt;
+}
+
+const partition_manifest::kafka_offset_index&
+partition_manifest::get_kafka_offset_index() const {
+    auto& index = _kafka_offset_index;
+    if (
+      index.layout_id == _layout_id && index.segments == _segments.size()) {
+        return index;
+    }
+    // Appending segments doesn't change the layout, the new segments are
+    // added to the index. Removing segments always does.
+    auto from = _segments.begin();
+    if (
+      index.layout_id == _layout_id && index.usable && !index.bases.empty()
+      && index.segments < _segments.size()
+      && index.bases.front().second == _segments.begin()->base_offset) {
+        from = _segments.upper_bound(index.bases.back().second);
+    } else {
+        index.bases.clear();
+        index.terms.clear();
+        index.usable = true;
+    }
+    for (auto it = from; it != _segments.end(); ++it) {
+        auto base_kafka = it->base_kafka_offset();
+        auto term = it->segment_term;
+        if (
+          (!index.bases.empty() && index.bases.back().first > base_kafka)
+          || (!index.terms.empty() && index.terms.back().first > term)) {
+            index.usable = false;
+            index.bases.clear();
+            index.terms.clear();
+            break;
+        }
+        index.bases.emplace_back(base_kafka, it->base_offset);
+        if (index.terms.empty() || index.terms.back().first < term) {
+            index.terms.emplace_back(term, base_kafka);
+        }
+    }
+    index.layout_id = _layout_id;
+    index.segments = _segments.size();
+    return index;
+}
+
 model::offset partition_manifest::get_last_uploaded_compacted_offset() const {
     return _last_uploaded_compacted_offset;
 }
@@ -476,6 +612,8 @@ segment_name partition_manifest::generate_remote_segment_name(
     case segment_name_format::v2:
         [[fallthrough]];
     case segment_name_format::v3:
+        [[fallthrough]];
+    case segment_name_format::v4:
         // Use new style format ".../base-committed-term-size-v1.log"
         return segment_name(ssx::sformat(
           "{}-{}-{}-{}-v1.log",
@@ -561,6 +699,7 @@ uint64_t partition_manifest::archive_size_bytes() const {
 }
 
 void partition_manifest::disable_permanently() {
+    _layout_id = next_layout_id();
     _last_offset = model::offset::max();
     _last_uploaded_compacted_offset = model::offset::max();
 }
@@ -605,7 +744,10 @@ bool partition_manifest::segment_with_offset_range_exists(
     }
 }
 
-void partition_manifest::delete_replaced_segments() { _replaced.clear(); }
+void partition_manifest::delete_replaced_segments() {
+    _replaced.clear();
+    _layout_id = next_layout_id();
+}
 
 model::offset partition_manifest::get_archive_start_offset() const {
     return _archive_start_offset;
@@ -628,6 +770,7 @@ model::offset partition_manifest::get_archive_clean_offset() const {
 
 void partition_manifest::set_archive_start_offset(
   model::offset start_rp_offset, model::offset_delta start_delta) {
+    _layout_id = next_layout_id();
     if (_archive_start_offset < start_rp_offset) {
         _archive_start_offset = start_rp_offset;
         _archive_start_offset_delta = start_delta;
@@ -657,6 +800,7 @@ void partition_manifest::set_archive_start_offset(
 
 void partition_manifest::set_archive_clean_offset(
   model::offset start_rp_offset, uint64_t size_bytes) {
+    _layout_id = next_layout_id();
     if (_archive_start_offset < start_rp_offset) {
         vlog(
           cst_log.error,
@@ -872,6 +1016,7 @@ const anomalies& partition_manifest::detected_anomalies() const {
 }
 
 void partition_manifest::reset_scrubbing_metadata() {
+    _layout_id = next_layout_id();
     _detected_anomalies = {};
     _last_partition_scrub = model::timestamp::missing();
     _last_scrubbed_offset = std::nullopt;
@@ -919,6 +1064,10 @@ bool partition_manifest::add(segment_meta meta) {
         return false;
     }
 
+    if (total_replaced_size.value() > 0 || meta.base_offset <= _last_offset) {
+        _layout_id = next_layout_id();
+    }
+
     if (meta.ntp_revision == model::initial_revision_id{}) {
         meta.ntp_revision = _rev;
     }
@@ -1121,6 +1270,7 @@ partition_manifest::truncate(model::offset starting_rp_offset) {
 }
 
 partition_manifest partition_manifest::truncate() {
+    _layout_id = next_layout_id();
     partition_manifest removed(_ntp, _rev);
     // copy segments that will be removed by the truncate op
     for (auto it = _segments.begin(),
@@ -1189,6 +1339,7 @@ partition_manifest partition_manifest::clone() const {
 }
 
 void partition_manifest::spillover(const segment_meta& spillover_meta) {
+    _layout_id = next_layout_id();
     auto start_offset = model::next_offset(spillover_meta.committed_offset);
     auto append_tx = _spillover_manifests.append(spillover_meta);
     partition_manifest removed;
@@ -2029,7 +2180,7 @@ ss::future<> partition_manifest::update(
         update_with_json(std::move(result));
         break;
     case manifest_format::serde:
-        from_iobuf(std::move(result));
+        co_await from_iobuf_async(std::move(result));
         break;
     }
 }
@@ -2041,6 +2192,7 @@ constexpr auto to_underlying(Enum e) {
 }
 
 void partition_manifest::do_update(partition_manifest_handler&& handler) {
+    _layout_id = next_layout_id();
     if (
       handler._version != to_underlying(manifest_version::v1)
       && handler._version != to_underlying(manifest_version::v2)
@@ -2149,7 +2301,7 @@ struct partition_manifest::serialization_cursor {
 };
 
 ss::future<serialized_data_stream> partition_manifest::serialize() const {
-    auto serialized = to_iobuf();
+    auto serialized = co_await to_iobuf_async();
     size_t size_bytes = serialized.size_bytes();
     co_return serialized_data_stream{
       .stream = make_iobuf_input_stream(std::move(serialized)),
@@ -2322,7 +2474,7 @@ void partition_manifest::serialize_segment_meta(
         w.Key("sname_format");
         w.Int64(static_cast<int16_t>(meta.sname_format));
     }
-    if (meta.sname_format == segment_name_format::v3) {
+    if (meta.sname_format >= segment_name_format::v3) {
         w.Key("metadata_size_hint");
         w.Int64(static_cast<int64_t>(meta.metadata_size_hint));
     }
@@ -2641,6 +2793,14 @@ struct partition_manifest_serde
     model::timestamp _last_partition_scrub;
     std::optional<model::offset> _last_scrubbed_offset;
     model::producer_id _highest_producer_id;
+
+    ss::future<> serde_async_write(iobuf& out) {
+        return serde::write_fields_async(out, *this);
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, serde::header const h) {
+        return serde::read_fields_async(in, *this, h);
+    }
 };
 
 static_assert(
@@ -2709,6 +2869,7 @@ iobuf partition_manifest::to_iobuf() const {
 }
 
 void partition_manifest::from_iobuf(iobuf in) {
+    _layout_id = next_layout_id();
     partition_manifest_serde_to_partition_manifest(
       serde::from_iobuf<partition_manifest_serde>(std::move(in)), *this);
 
@@ -2717,11 +2878,28 @@ void partition_manifest::from_iobuf(iobuf in) {
     _cached_start_kafka_offset_local = std::nullopt;
 }
 
+ss::future<iobuf> partition_manifest::to_iobuf_async() const {
+    iobuf out;
+    co_await serde::write_async(
+      out, partition_manifest_serde_from_partition_manifest(*this));
+    co_return out;
+}
+
+ss::future<> partition_manifest::from_iobuf_async(iobuf in) {
+    iobuf_parser parser(std::move(in));
+    auto m = co_await serde::read_async<partition_manifest_serde>(parser);
+
+    _layout_id = next_layout_id();
+    partition_manifest_serde_to_partition_manifest(std::move(m), *this);
+    _cached_start_kafka_offset_local = std::nullopt;
+}
+
 void partition_manifest::process_anomalies(
   model::timestamp scrub_timestamp,
   std::optional<model::offset> last_scrubbed_offset,
   scrub_status status,
   anomalies detected) {
+    _layout_id = next_layout_id();
     // Firstly, update the in memory list of anomalies.
     // If the entires log was scrubbed, overwrite the old anomalies,
     // otherwise append to them.
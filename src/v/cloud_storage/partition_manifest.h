@@ -77,6 +77,36 @@ remote_manifest_path generate_partition_manifest_path(
 // to allow access to private fields of the manifest.
 struct partition_manifest_accessor;
 
+/// Changes of a partition manifest since the version with insync offset
+/// 'base_insync_offset', limited to appended segments and start offsets
+/// moving forward. Deltas are uploaded next to the manifest so that small
+/// updates don't require uploading the full manifest every time.
+struct partition_manifest_delta
+  : serde::envelope<
+      partition_manifest_delta,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::offset base_insync_offset;
+    model::offset insync_offset;
+    /// Segments added after the last offset of the base version
+    std::vector<segment_meta> segments;
+    model::offset start_offset;
+    kafka::offset start_kafka_offset_override;
+    uint64_t cloud_log_size_bytes{0};
+    model::producer_id highest_producer_id;
+
+    auto serde_fields() {
+        return std::tie(
+          base_insync_offset,
+          insync_offset,
+          segments,
+          start_offset,
+          start_kafka_offset_override,
+          cloud_log_size_bytes,
+          highest_producer_id);
+    }
+};
+
 /// Manifest file stored in S3
 class partition_manifest : public base_manifest {
     friend struct partition_manifest_accessor;
@@ -225,6 +255,30 @@ public:
     std::pair<manifest_format, remote_manifest_path>
     get_legacy_manifest_format_and_path() const;
 
+    /// Object name of the delta that brings the manifest to 'insync_offset'
+    remote_manifest_path
+    get_manifest_delta_path(model::offset insync_offset) const;
+
+    /// Common prefix of the object names of all deltas of the manifest
+    remote_manifest_path get_manifest_delta_prefix() const;
+
+    /// Identifies the layout of the manifest. It changes on every update
+    /// that can't be described by a partition_manifest_delta, i.e. anything
+    /// but appending segments and moving the start offsets forward. Not
+    /// serialized.
+    uint64_t layout_id() const { return _layout_id; }
+
+    /// Build the delta from the version of this manifest which had the
+    /// given insync and last offsets. The layout_id of the manifest must not
+    /// have changed since that version.
+    partition_manifest_delta make_delta(
+      model::offset base_insync_offset, model::offset base_last_offset) const;
+
+    /// Apply a delta built against the current version of the manifest
+    ///
+    /// \return false if the delta doesn't apply to the current version
+    bool apply_delta(const partition_manifest_delta& delta);
+
     /// Get NTP
     const model::ntp& get_ntp() const;
 
@@ -461,6 +515,11 @@ public:
     const_iterator segment_containing(model::offset o) const;
     const_iterator segment_containing(kafka::offset o) const;
 
+    /// Base kafka offset of the first segment with a term higher than
+    /// \p term, the first offset of the next leader epoch, if any.
+    std::optional<kafka::offset>
+    first_kafka_offset_after_term(model::term_id term) const;
+
     // Return collection of segments that were replaced in lightweight format.
     std::vector<partition_manifest::lw_segment_meta>
     lw_replaced_segments() const;
@@ -567,6 +626,12 @@ public:
 
     iobuf to_iobuf() const;
 
+    /// Same as from_iobuf/to_iobuf but yield to the reactor while decoding
+    /// and encoding the containers of large manifests
+    ss::future<> from_iobuf_async(iobuf in);
+
+    ss::future<iobuf> to_iobuf_async() const;
+
     void process_anomalies(
       model::timestamp scrub_timestamp,
       std::optional<model::offset> last_scrubbed_offset,
@@ -585,6 +650,28 @@ private:
     // the current _start_offset).
     uint64_t compute_cloud_log_size() const;
 
+    static uint64_t next_layout_id();
+
+    /// Base kafka offsets of the segments, used to look segments up by
+    /// kafka offset without walking the segments which lie between the
+    /// kafka offset and the log offset.
+    struct kafka_offset_index {
+        uint64_t layout_id{0};
+        // Number of the segments the index was built from
+        size_t segments{0};
+        // (base kafka offset, base offset) of the segments in offset order
+        fragmented_vector<std::pair<kafka::offset, model::offset>> bases;
+        // (term, base kafka offset) of the first segment of each term
+        fragmented_vector<std::pair<model::term_id, kafka::offset>> terms;
+        // False if the base kafka offsets of the segments aren't monotonic,
+        // the lookup falls back to the scan of the segments then
+        bool usable{true};
+    };
+
+    /// Index of the current segments, brought up to date if the segments
+    /// changed since the previous lookup
+    const kafka_offset_index& get_kafka_offset_index() const;
+
     /// Update manifest content from json document that supposed to be generated
     /// from manifest.json file
     void do_update(partition_manifest_handler&& handler);
@@ -674,6 +761,13 @@ private:
     // all partitions during cluster recovery time to determine a new starting
     // id_allocator ID that is higher than any used so far.
     model::producer_id _highest_producer_id;
+
+    // Unique on the shard, lets the uploader detect that the manifest can't
+    // be uploaded as a delta.
+    uint64_t _layout_id{next_layout_id()};
+
+    // Not serialized, rebuilt lazily by get_kafka_offset_index
+    mutable kafka_offset_index _kafka_offset_index;
 };
 
 } // namespace cloud_storage
@@ -148,6 +148,14 @@ ts_read_path_probe::ts_read_path_probe() {
               },
               sm::description("Chunk hydration latency histogram"))
               .aggregate(aggregate_labels),
+            sm::make_histogram(
+              "reader_queue_delay",
+              [this] {
+                  return _reader_queue_delay.public_histogram_logform();
+              },
+              sm::description("Time spent by partition readers waiting for a "
+                              "slot in the fair reader queues"))
+              .aggregate(aggregate_labels),
             sm::make_counter(
               "hydrations_in_progress",
               [this] { return _hydrations_in_progress; },
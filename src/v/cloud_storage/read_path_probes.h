@@ -72,6 +72,8 @@ public:
         return _chunk_hydration_latency.auto_measure();
     }
 
+    auto reader_queue_delay() { return _reader_queue_delay.auto_measure(); }
+
     void download_throttled(size_t value) { _downloads_throttled_sum += value; }
 
     auto get_downloads_throttled_sum() const noexcept {
@@ -96,6 +98,8 @@ private:
 
     size_t _chunks_hydrated = 0;
     hist_t _chunk_hydration_latency;
+    /// Time spent by partition readers waiting for a slot
+    hist_t _reader_queue_delay;
     size_t _downloads_throttled_sum = 0;
     size_t _hydrations_in_progress = 0;
 
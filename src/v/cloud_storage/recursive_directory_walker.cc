@@ -17,6 +17,7 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/file.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/sstring.hh>
 
@@ -28,6 +29,16 @@
 
 namespace cloud_storage {
 
+namespace {
+
+// Directories listed concurrently. Each one visits its files with up to
+// max_concurrent_stats file_stat calls in flight, so the syscall threads
+// work on many entries at once instead of one file at a time.
+constexpr size_t max_concurrent_dirs = 16;
+constexpr size_t max_concurrent_stats = 32;
+
+} // namespace
+
 struct walk_accumulator {
     walk_accumulator(
       ss::sstring start_dir,
@@ -37,36 +48,44 @@ struct walk_accumulator {
       , dirlist({std::move(start_dir)})
       , filter(std::move(collect_filter)) {}
 
-    ss::future<> visit(ss::sstring const& target, ss::directory_entry entry) {
-        seen_dentries = true;
-        auto entry_path = fmt::format("{}/{}", target, entry.name);
-        if (entry.type && entry.type == ss::directory_entry_type::regular) {
-            auto file_stats = co_await ss::file_stat(entry_path);
-
-            vlog(
-              cst_log.debug,
-              "Regular file found {} ({})",
-              entry_path,
-              file_stats.size);
-
-            auto last_access_timepoint = tracker.estimate_timestamp(entry_path)
-                                           .value_or(file_stats.time_accessed);
-
-            current_cache_size += static_cast<uint64_t>(file_stats.size);
-
-            if (!filter || filter.value()(entry_path)) {
-                files.push_back(
-                  {last_access_timepoint,
-                   (std::filesystem::path(target) / entry.name.data()).native(),
-                   static_cast<uint64_t>(file_stats.size)});
-            } else if (filter) {
-                ++filtered_out_files;
+    ss::future<> visit_file(ss::sstring const& target, ss::sstring name) {
+        auto entry_path = fmt::format("{}/{}", target, name);
+        ss::stat_data file_stats;
+        try {
+            file_stats = co_await ss::file_stat(entry_path);
+        } catch (const std::filesystem::filesystem_error& e) {
+            if (e.code() == std::errc::no_such_file_or_directory) {
+                // removed since the directory was listed
+                co_return;
             }
-        } else if (
-          entry.type && entry.type == ss::directory_entry_type::directory) {
-            vlog(cst_log.debug, "Dir found {}", entry_path);
-            dirlist.push_front(entry_path);
+            throw;
         }
+
+        vlog(
+          cst_log.debug,
+          "Regular file found {} ({})",
+          entry_path,
+          file_stats.size);
+
+        auto last_access_timepoint = tracker.estimate_timestamp(entry_path)
+                                       .value_or(file_stats.time_accessed);
+
+        current_cache_size += static_cast<uint64_t>(file_stats.size);
+
+        if (!filter || filter.value()(entry_path)) {
+            files.push_back(
+              {last_access_timepoint,
+               (std::filesystem::path(target) / name.data()).native(),
+               static_cast<uint64_t>(file_stats.size)});
+        } else if (filter) {
+            ++filtered_out_files;
+        }
+    }
+
+    void visit_dir(ss::sstring const& target, const ss::sstring& name) {
+        auto entry_path = fmt::format("{}/{}", target, name);
+        vlog(cst_log.debug, "Dir found {}", entry_path);
+        dirlist.push_front(entry_path);
     }
 
     bool empty() const { return dirlist.empty(); }
@@ -77,10 +96,7 @@ struct walk_accumulator {
         return r;
     }
 
-    void reset_seen_dentries() { seen_dentries = false; }
-
     const access_time_tracker& tracker;
-    bool seen_dentries{false};
     std::deque<ss::sstring> dirlist;
     std::optional<recursive_directory_walker::filter_type> filter;
     fragmented_vector<file_list_item> files;
@@ -88,6 +104,38 @@ struct walk_accumulator {
     size_t filtered_out_files{0};
 };
 
+namespace {
+
+/// List a single directory, queue its subdirectories on \p state and stat
+/// its regular files. Returns false if the directory has no entries.
+ss::future<bool> walk_directory(walk_accumulator& state, ss::sstring target) {
+    std::vector<ss::sstring> regular_files;
+    bool seen_dentries = false;
+
+    ss::file target_dir = co_await open_directory(target);
+    co_await target_dir
+      .list_directory([&](ss::directory_entry entry) {
+          seen_dentries = true;
+          if (entry.type == ss::directory_entry_type::regular) {
+              regular_files.push_back(std::move(entry.name));
+          } else if (entry.type == ss::directory_entry_type::directory) {
+              state.visit_dir(target, entry.name);
+          }
+          return ss::now();
+      })
+      .done()
+      .finally([target_dir]() mutable { return target_dir.close(); });
+
+    co_await ss::max_concurrent_for_each(
+      regular_files, max_concurrent_stats, [&state, &target](auto& name) {
+          return state.visit_file(target, std::move(name));
+      });
+
+    co_return seen_dentries;
+}
+
+} // namespace
+
 ss::future<walk_result> recursive_directory_walker::walk(
   ss::sstring start_dir,
   const access_time_tracker& tracker,
@@ -99,35 +147,34 @@ ss::future<walk_result> recursive_directory_walker::walk(
 
     fragmented_vector<ss::sstring> empty_dirs;
 
+    std::vector<ss::sstring> batch;
     while (!state.empty()) {
-        auto target = state.pop();
-        vassert(
-          std::string_view(target).starts_with(start_dir),
-          "Looking at directory {}, which is outside of initial dir {}.",
-          target,
-          start_dir);
-
-        try {
-            ss::file target_dir = co_await open_directory(target);
-
-            state.reset_seen_dentries();
-            co_await target_dir
-              .list_directory([&state, &target](ss::directory_entry entry) {
-                  return state.visit(target, std::move(entry));
-              })
-              .done()
-              .finally([target_dir]() mutable { return target_dir.close(); });
-
-            if (unlikely(!state.seen_dentries) && target != start_dir) {
-                empty_dirs.push_back(target);
-            }
-        } catch (std::filesystem::filesystem_error& e) {
-            if (e.code() == std::errc::no_such_file_or_directory) {
-                // skip this directory, move to the ext one
-            } else {
-                throw;
-            }
+        batch.clear();
+        while (!state.empty() && batch.size() < max_concurrent_dirs) {
+            batch.push_back(state.pop());
         }
+
+        co_await ss::parallel_for_each(
+          batch, [&state, &start_dir, &empty_dirs](const ss::sstring& target) {
+              vassert(
+                std::string_view(target).starts_with(start_dir),
+                "Looking at directory {}, which is outside of initial dir {}.",
+                target,
+                start_dir);
+              return walk_directory(state, target)
+                .then([&empty_dirs, &target, &start_dir](bool seen_dentries) {
+                    if (unlikely(!seen_dentries) && target != start_dir) {
+                        empty_dirs.push_back(target);
+                    }
+                })
+                .handle_exception_type(
+                  [](const std::filesystem::filesystem_error& e) {
+                      if (e.code() != std::errc::no_such_file_or_directory) {
+                          throw e;
+                      }
+                      // skip this directory, move to the next one
+                  });
+          });
     }
 
     co_return walk_result{
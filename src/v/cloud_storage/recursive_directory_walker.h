@@ -43,6 +43,10 @@ public:
 
     // recursively walks start_dir, returns the total size of files in this
     // directory and a list of files sorted by access time from oldest to newest
+    //
+    // Several directories are listed at once and the files of each directory
+    // are stat'ed concurrently, so the order of the returned files does not
+    // follow the directory structure.
     ss::future<walk_result> walk(
       ss::sstring start_dir,
       const access_time_tracker& tracker,
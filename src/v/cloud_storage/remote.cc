@@ -14,11 +14,16 @@
 #include "cloud_storage/base_manifest.h"
 #include "cloud_storage/logger.h"
 #include "cloud_storage/materialized_resources.h"
+#include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/segment_key_filter.h"
 #include "cloud_storage/types.h"
+#include "cloud_storage/upload_scheduler.h"
 #include "cloud_storage_clients/client_pool.h"
 #include "cloud_storage_clients/types.h"
 #include "cloud_storage_clients/util.h"
+#include "config/configuration.h"
 #include "model/metadata.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 #include "utils/retry_chain_node.h"
 
@@ -36,6 +41,7 @@
 #include <boost/range/irange.hpp>
 #include <fmt/chrono.h>
 
+#include <charconv>
 #include <exception>
 #include <iterator>
 #include <utility>
@@ -74,6 +80,7 @@ remote::remote(
   : _pool(clients)
   , _auth_refresh_bg_op{_gate, _as, conf, cloud_credentials_source}
   , _materialized(std::make_unique<materialized_resources>())
+  , _upload_scheduler(std::make_unique<upload_scheduler>())
   , _probe(
       remote_metrics_disabled(static_cast<bool>(
         std::visit([](auto&& cfg) { return cfg.disable_metrics; }, conf))),
@@ -161,6 +168,8 @@ ss::future<> remote::start() {
 ss::future<> remote::stop() {
     cst_log.debug("Stopping remote...");
     _as.request_abort();
+    _pending_deletes_cvar.broadcast();
+    _upload_scheduler->stop();
     co_await _materialized->stop();
     co_await _gate.close();
     co_await _auth_refresh_bg_op.stop();
@@ -243,6 +252,12 @@ remote::try_download_partition_manifest(
     auto format_path = manifest.get_manifest_format_and_path();
     auto serde_result = co_await do_download_manifest(
       bucket, format_path, manifest, parent, expect_missing);
+    if (
+      serde_result == download_result::success
+      && config::shard_local_cfg().cloud_storage_manifest_max_deltas() > 0) {
+        serde_result = co_await download_partition_manifest_deltas(
+          bucket, manifest, parent);
+    }
     if (serde_result != download_result::notfound) {
         // propagate success, timedout and failed to caller
         co_return std::pair{serde_result, manifest_format::serde};
@@ -255,6 +270,81 @@ remote::try_download_partition_manifest(
       manifest_format::json};
 }
 
+ss::future<download_result> remote::download_partition_manifest_deltas(
+  const cloud_storage_clients::bucket_name& bucket,
+  partition_manifest& manifest,
+  retry_chain_node& parent) {
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    const auto prefix = manifest.get_manifest_delta_prefix()().native();
+    auto list = co_await list_objects(
+      bucket, fib, cloud_storage_clients::object_key(prefix));
+    if (list.has_error()) {
+        vlog(ctxlog.warn, "Failed to list manifest deltas {}", prefix);
+        co_return download_result::failed;
+    }
+
+    // Keys end with the insync offset of the delta
+    std::vector<std::pair<model::offset, ss::sstring>> deltas;
+    for (auto& item : list.value().contents) {
+        std::string_view suffix{item.key};
+        suffix.remove_prefix(std::min(suffix.size(), prefix.size()));
+        int64_t offset{0};
+        auto [ptr, ec] = std::from_chars(
+          suffix.data(), suffix.data() + suffix.size(), offset);
+        if (ec != std::errc{} || ptr != suffix.data() + suffix.size()) {
+            vlog(ctxlog.debug, "Skipping unexpected object {}", item.key);
+            continue;
+        }
+        if (model::offset(offset) > manifest.get_insync_offset()) {
+            deltas.emplace_back(model::offset(offset), std::move(item.key));
+        }
+    }
+    std::sort(deltas.begin(), deltas.end());
+
+    for (const auto& [offset, key] : deltas) {
+        iobuf buf;
+        auto res = co_await download_stream(
+          bucket,
+          remote_segment_path(std::string(key)),
+          [&buf](uint64_t, ss::input_stream<char> is) -> ss::future<uint64_t> {
+              auto os = make_iobuf_ref_output_stream(buf);
+              co_await ss::copy(is, os);
+              co_await is.close();
+              co_return buf.size_bytes();
+          },
+          fib,
+          "manifest-delta",
+          download_metrics{});
+        if (res != download_result::success) {
+            co_return res;
+        }
+        partition_manifest_delta delta;
+        try {
+            delta = serde::from_iobuf<partition_manifest_delta>(
+              std::move(buf));
+        } catch (...) {
+            vlog(
+              ctxlog.warn,
+              "Failed to parse manifest delta {}: {}",
+              key,
+              std::current_exception());
+            co_return download_result::failed;
+        }
+        if (!manifest.apply_delta(delta)) {
+            // Left over from before the manifest was uploaded in full, or
+            // the chain was broken by a leadership change.
+            vlog(
+              ctxlog.debug,
+              "Manifest delta {} doesn't apply to insync offset {}",
+              key,
+              manifest.get_insync_offset());
+            break;
+        }
+    }
+    co_return download_result::success;
+}
+
 ss::future<download_result> remote::do_download_manifest(
   const cloud_storage_clients::bucket_name& bucket,
   const std::pair<manifest_format, remote_manifest_path>& format_key,
@@ -646,6 +736,215 @@ ss::future<upload_result> remote::upload_segment(
       [this] { _probe.upload_backoff(); });
 }
 
+template<typename RequestFn>
+ss::future<upload_result> remote::do_multipart_upload_request(
+  const cloud_storage_clients::object_key& path,
+  std::string_view request_label,
+  RequestFn request,
+  retry_chain_node& fib,
+  lazy_abort_source& lazy_abort_source) {
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto permit = fib.retry();
+    while (!_gate.is_closed() && permit.is_allowed) {
+        auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+
+        if (lazy_abort_source.abort_requested()) {
+            vlog(
+              ctxlog.warn,
+              "{}: cancelled {} of {}",
+              lazy_abort_source.abort_reason(),
+              request_label,
+              path);
+            co_return upload_result::cancelled;
+        }
+
+        auto res = co_await request(*lease.client);
+        if (res) {
+            co_return upload_result::success;
+        }
+
+        lease.client->shutdown();
+        switch (res.error()) {
+        case cloud_storage_clients::error_outcome::retry:
+            vlog(
+              ctxlog.debug,
+              "{} of {}, {} backoff required",
+              request_label,
+              path,
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                permit.delay));
+            _probe.upload_backoff();
+            if (!lazy_abort_source.abort_requested()) {
+                co_await ss::sleep_abortable(
+                  permit.delay, fib.root_abort_source());
+            }
+            permit = fib.retry();
+            break;
+        case cloud_storage_clients::error_outcome::key_not_found:
+            // not expected during upload
+            [[fallthrough]];
+        case cloud_storage_clients::error_outcome::fail:
+            vlog(ctxlog.warn, "{} of {} failed", request_label, path);
+            co_return upload_result::failed;
+        }
+    }
+    vlog(
+      ctxlog.warn,
+      "{} of {}, backoff quota exceded, request not sent",
+      request_label,
+      path);
+    co_return upload_result::timedout;
+}
+
+ss::future<remote::multipart_upload_result> remote::upload_segment_multipart(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& segment_path,
+  uint64_t content_length,
+  uint64_t part_size,
+  size_t concurrency,
+  const reset_input_stream_range& reset_str,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    using request_result = result<void, cloud_storage_clients::error_outcome>;
+    vassert(
+      part_size > 0, "Multipart upload of {} without parts", segment_path);
+    auto guard = _gate.hold();
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto path = cloud_storage_clients::object_key(segment_path());
+    multipart_upload_result result{
+      .result = upload_result::success,
+      .parts = (content_length + part_size - 1) / part_size,
+    };
+    vlog(
+      ctxlog.debug,
+      "Uploading segment to path {}, length {}, {} parts",
+      segment_path,
+      content_length,
+      result.parts);
+    notify_external_subscribers(
+      api_activity_notification{
+        .type = api_activity_type::segment_upload, .is_retry = false},
+      parent);
+
+    ss::sstring upload_id;
+    result.result = co_await do_multipart_upload_request(
+      path,
+      "starting multipart upload",
+      [&](cloud_storage_clients::client& client)
+        -> ss::future<request_result> {
+          auto res = co_await client.create_multipart_upload(
+            bucket, path, fib.get_timeout());
+          if (!res) {
+              co_return res.error();
+          }
+          upload_id = std::move(res.value());
+          co_return outcome::success();
+      },
+      fib,
+      lazy_abort_source);
+    if (result.result != upload_result::success) {
+        _probe.failed_upload();
+        co_return result;
+    }
+
+    std::vector<cloud_storage_clients::client::multipart_upload_part> parts(
+      result.parts);
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, result.parts),
+      concurrency,
+      [&](size_t ix) -> ss::future<> {
+          if (result.result != upload_result::success) {
+              // another part has failed, the upload will be aborted
+              co_return;
+          }
+          const auto part_number = static_cast<int>(ix + 1);
+          const auto offset = ix * part_size;
+          const auto length = std::min(part_size, content_length - offset);
+          retry_chain_node part_fib(&fib);
+          size_t attempts = 0;
+          auto part_res = co_await do_multipart_upload_request(
+            path,
+            fmt::format("uploading part {}", part_number),
+            [&](cloud_storage_clients::client& client)
+              -> ss::future<request_result> {
+                ++attempts;
+                auto reader_handle = co_await reset_str(offset, length);
+                auto res = co_await client.upload_part(
+                  bucket,
+                  path,
+                  upload_id,
+                  part_number,
+                  length,
+                  reader_handle->take_stream(),
+                  part_fib.get_timeout());
+                // `upload_part` closed the encapsulated input_stream, but we
+                // must call close() on the handle to release the FD.
+                co_await reader_handle->close();
+                if (!res) {
+                    co_return res.error();
+                }
+                parts[ix] = {
+                  .part_number = part_number, .etag = std::move(res.value())};
+                co_return outcome::success();
+            },
+            part_fib,
+            lazy_abort_source);
+          result.part_retries += attempts > 0 ? attempts - 1 : 0;
+          if (
+            part_res != upload_result::success
+            && result.result == upload_result::success) {
+              result.result = part_res;
+          }
+      });
+
+    if (result.result == upload_result::success) {
+        result.result = co_await do_multipart_upload_request(
+          path,
+          "completing multipart upload",
+          [&](cloud_storage_clients::client& client) {
+              return client
+                .complete_multipart_upload(
+                  bucket, path, upload_id, parts, fib.get_timeout())
+                .then([](auto res) -> request_result {
+                    if (!res) {
+                        return res.error();
+                    }
+                    return outcome::success();
+                });
+          },
+          fib,
+          lazy_abort_source);
+    }
+
+    if (result.result == upload_result::success) {
+        _probe.successful_upload();
+        _probe.register_upload_size(content_length);
+        co_return result;
+    }
+
+    _probe.failed_upload();
+    vlog(
+      ctxlog.warn,
+      "Uploading segment {} to {}, {}, aborting multipart upload",
+      segment_path,
+      bucket,
+      result.result);
+    // Best effort: a multipart upload which is never aborted keeps its parts
+    // until the bucket lifecycle rules remove them.
+    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+    auto res = co_await lease.client->abort_multipart_upload(
+      bucket, path, upload_id, fib.get_timeout());
+    if (!res) {
+        vlog(
+          ctxlog.warn,
+          "Failed to abort multipart upload of {}: {}",
+          segment_path,
+          make_error_code(res.error()).message());
+    }
+    co_return result;
+}
+
 ss::future<download_result> remote::download_stream(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& path,
@@ -879,7 +1178,99 @@ ss::future<download_result> remote::download_index(
     co_return *result;
 }
 
+ss::future<download_result> remote::download_key_filter(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& filter_path,
+  segment_key_filter& filter,
+  retry_chain_node& parent) {
+    auto guard = _gate.hold();
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto path = cloud_storage_clients::object_key(filter_path());
+    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+
+    auto permit = fib.retry();
+    vlog(ctxlog.debug, "Download key filter {}", path);
+
+    std::optional<download_result> result;
+    while (!_gate.is_closed() && permit.is_allowed && !result) {
+        notify_external_subscribers(
+          api_activity_notification{
+            .type = api_activity_type::segment_download,
+            .is_retry = fib.retry_count() > 1},
+          parent);
+        // Segments uploaded while the filters were disabled have none
+        auto resp = co_await lease.client->get_object(
+          bucket, path, fib.get_timeout(), true);
+
+        if (resp) {
+            vlog(ctxlog.debug, "Receive OK response from {}", path);
+            auto buffer
+              = co_await cloud_storage_clients::util::drain_response_stream(
+                resp.value());
+            try {
+                filter = segment_key_filter::from_iobuf(std::move(buffer));
+            } catch (...) {
+                vlog(
+                  ctxlog.warn,
+                  "Failed to parse key filter {}: {}",
+                  path,
+                  std::current_exception());
+                co_return download_result::failed;
+            }
+            co_return download_result::success;
+        }
+
+        lease.client->shutdown();
+
+        switch (resp.error()) {
+        case cloud_storage_clients::error_outcome::retry:
+            vlog(
+              ctxlog.debug,
+              "Downloading key filter from {}, {} backoff required",
+              bucket,
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                permit.delay));
+            _probe.download_backoff();
+            co_await ss::sleep_abortable(permit.delay, fib.root_abort_source());
+            permit = fib.retry();
+            break;
+        case cloud_storage_clients::error_outcome::fail:
+            result = download_result::failed;
+            break;
+        case cloud_storage_clients::error_outcome::key_not_found:
+            vlog(ctxlog.debug, "Key filter {} not found", path);
+            co_return download_result::notfound;
+        }
+    }
+    if (!result) {
+        vlog(
+          ctxlog.warn,
+          "Downloading key filter from {}, backoff quota exceded, key filter "
+          "at {} not available",
+          bucket,
+          path);
+        result = download_result::timedout;
+    } else {
+        vlog(
+          ctxlog.warn,
+          "Downloading key filter from {}, {}, key filter at {} not available",
+          bucket,
+          *result,
+          path);
+    }
+    co_return *result;
+}
+
 ss::future<download_result> remote::segment_exists(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& segment_path,
+  retry_chain_node& parent) {
+    auto [result, _] = co_await object_etag(bucket, segment_path, parent);
+    co_return result;
+}
+
+ss::future<std::pair<download_result, ss::sstring>> remote::object_etag(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& segment_path,
   retry_chain_node& parent) {
@@ -902,7 +1293,8 @@ ss::future<download_result> remote::segment_exists(
               path,
               resp.value().object_size,
               resp.value().etag);
-            co_return download_result::success;
+            co_return std::make_pair(
+              download_result::success, std::move(resp.value().etag));
         }
 
         // Error path
@@ -942,7 +1334,7 @@ ss::future<download_result> remote::segment_exists(
           *result,
           path);
     }
-    co_return *result;
+    co_return std::make_pair(*result, ss::sstring{});
 }
 
 ss::future<upload_result> remote::delete_object(
@@ -1137,6 +1529,7 @@ ss::future<upload_result> remote::delete_object_batch(
 
         switch (res.error()) {
         case cloud_storage_clients::error_outcome::retry:
+            ++_delete_retries;
             vlog(
               ctxlog.debug,
               "DeleteObjects {}, {} backoff required",
@@ -1192,6 +1585,151 @@ remote::delete_objects<std::deque<cloud_storage_clients::object_key>>(
   std::deque<cloud_storage_clients::object_key> keys,
   retry_chain_node& parent);
 
+template<typename R>
+requires std::ranges::range<R>
+         && std::same_as<
+           std::ranges::range_value_t<R>,
+           cloud_storage_clients::object_key>
+ss::future<upload_result> remote::delete_objects_coalesced(
+  const cloud_storage_clients::bucket_name& bucket,
+  R keys,
+  retry_chain_node& parent) {
+    if (keys.empty() || !is_batch_delete_supported()) {
+        co_return co_await delete_objects(bucket, std::move(keys), parent);
+    }
+    ss::gate::holder gh{_gate};
+
+    std::vector<cloud_storage_clients::object_key> key_vec;
+    key_vec.reserve(keys.size());
+    std::move(keys.begin(), keys.end(), std::back_inserter(key_vec));
+    auto pending = ss::make_lw_shared<pending_delete>(
+      bucket, std::move(key_vec), parent);
+    auto fut = pending->promise.get_future();
+    _pending_deletes.push_back(std::move(pending));
+    if (!_delete_queue_running) {
+        _delete_queue_running = true;
+        _max_deletes_inflight = concurrency();
+        ssx::spawn_with_gate(_gate, [this] { return run_delete_queue(); });
+    }
+    _pending_deletes_cvar.signal();
+    co_return co_await std::move(fut);
+}
+
+template ss::future<upload_result> remote::delete_objects_coalesced<
+  std::vector<cloud_storage_clients::object_key>>(
+  const cloud_storage_clients::bucket_name& bucket,
+  std::vector<cloud_storage_clients::object_key> keys,
+  retry_chain_node& parent);
+
+template ss::future<upload_result> remote::delete_objects_coalesced<
+  std::deque<cloud_storage_clients::object_key>>(
+  const cloud_storage_clients::bucket_name& bucket,
+  std::deque<cloud_storage_clients::object_key> keys,
+  retry_chain_node& parent);
+
+ss::future<> remote::run_delete_queue() {
+    const auto max_keys = static_cast<size_t>(delete_objects_max_keys());
+    while (!_as.abort_requested()) {
+        co_await _pending_deletes_cvar.wait([this] {
+            return _as.abort_requested()
+                   || (!_pending_deletes.empty()
+                       && _deletes_inflight < _max_deletes_inflight);
+        });
+        if (_as.abort_requested()) {
+            break;
+        }
+
+        // The keys queued while the previous requests were in flight are
+        // packed together, the requests only carry keys of one bucket.
+        auto bucket = _pending_deletes.front()->bucket;
+        std::vector<cloud_storage_clients::object_key> keys;
+        std::vector<pending_delete_ptr> owners;
+        while (!_pending_deletes.empty() && keys.size() < max_keys
+               && _pending_deletes.front()->bucket == bucket) {
+            auto& front = _pending_deletes.front();
+            auto n = std::min(
+              max_keys - keys.size(), front->keys.size() - front->queued);
+            auto begin = std::next(
+              front->keys.begin(), static_cast<ptrdiff_t>(front->queued));
+            keys.insert(
+              keys.end(),
+              std::make_move_iterator(begin),
+              std::make_move_iterator(
+                std::next(begin, static_cast<ptrdiff_t>(n))));
+            front->queued += n;
+            ++front->inflight;
+            owners.push_back(front);
+            if (front->queued == front->keys.size()) {
+                _pending_deletes.pop_front();
+            }
+        }
+
+        ++_deletes_inflight;
+        ssx::spawn_with_gate(
+          _gate,
+          [this,
+           bucket = std::move(bucket),
+           keys = std::move(keys),
+           owners = std::move(owners)]() mutable {
+              return send_coalesced_batch(
+                std::move(bucket), std::move(keys), std::move(owners));
+          });
+    }
+
+    // The keys which weren't sent yet are not deleted. A partially sent
+    // caller is notified when its last request completes.
+    for (auto& p : _pending_deletes) {
+        p->result = upload_result::cancelled;
+        p->queued = p->keys.size();
+        if (p->inflight == 0) {
+            p->promise.set_value(p->result);
+        }
+    }
+    _pending_deletes.clear();
+}
+
+ss::future<> remote::send_coalesced_batch(
+  cloud_storage_clients::bucket_name bucket,
+  std::vector<cloud_storage_clients::object_key> keys,
+  std::vector<pending_delete_ptr> owners) {
+    vlog(
+      cst_log.debug,
+      "Deleting {} objects queued by {} callers, {} requests in flight",
+      keys.size(),
+      owners.size(),
+      _deletes_inflight);
+    const auto retries = _delete_retries;
+    auto result = upload_result::failed;
+    try {
+        result = co_await delete_object_batch(
+          bucket, std::move(keys), owners.front()->parent);
+    } catch (...) {
+        vlog(
+          cst_log.warn,
+          "Failed to delete a batch of objects: {}",
+          std::current_exception());
+    }
+
+    // AIMD: back off quickly when the backend pushes back, recover slowly
+    if (_delete_retries != retries) {
+        _max_deletes_inflight = std::max<size_t>(1, _max_deletes_inflight / 2);
+    } else if (result == upload_result::success) {
+        _max_deletes_inflight = std::min(
+          concurrency(), _max_deletes_inflight + 1);
+    }
+    --_deletes_inflight;
+
+    for (auto& p : owners) {
+        if (result != upload_result::success) {
+            p->result = result;
+        }
+        if (--p->inflight == 0 && p->queued == p->keys.size()) {
+            p->promise.set_value(p->result);
+        }
+    }
+    _pending_deletes_cvar.signal();
+}
+
 template<typename R>
 requires std::ranges::range<R>
          && std::same_as<
@@ -1271,24 +1809,67 @@ ss::future<remote::list_result> remote::list_objects(
   retry_chain_node& parent,
   std::optional<cloud_storage_clients::object_key> prefix,
   std::optional<char> delimiter,
+  std::optional<cloud_storage_clients::client::item_filter> item_filter) {
+    // Gathers the items from a series of successful ListObjectsV2 calls
+    cloud_storage_clients::client::list_bucket_result list_bucket_result;
+
+    auto res = co_await list_objects_pages(
+      bucket,
+      parent,
+      [&list_bucket_result](
+        cloud_storage_clients::client::list_bucket_result page) {
+          std::copy(
+            std::make_move_iterator(page.contents.begin()),
+            std::make_move_iterator(page.contents.end()),
+            std::back_inserter(list_bucket_result.contents));
+
+          // Move common prefixes to the result, only if they have not been
+          // copied yet. These values will remain the same during pagination
+          // of list call results, so they should only be copied once.
+          if (
+            list_bucket_result.common_prefixes.empty()
+            && !page.common_prefixes.empty()) {
+              std::copy(
+                std::make_move_iterator(page.common_prefixes.begin()),
+                std::make_move_iterator(page.common_prefixes.end()),
+                std::back_inserter(list_bucket_result.common_prefixes));
+          }
+
+          list_bucket_result.prefix = std::move(page.prefix);
+          return ss::make_ready_future<ss::stop_iteration>(
+            ss::stop_iteration::no);
+      },
+      std::move(prefix),
+      delimiter,
+      std::move(item_filter));
+
+    if (res.has_error()) {
+        co_return res.error();
+    }
+    co_return list_bucket_result;
+}
+
+ss::future<remote::list_pages_result> remote::list_objects_pages(
+  const cloud_storage_clients::bucket_name& bucket,
+  retry_chain_node& parent,
+  list_page_consumer consumer,
+  std::optional<cloud_storage_clients::object_key> prefix,
+  std::optional<char> delimiter,
   std::optional<cloud_storage_clients::client::item_filter> item_filter) {
     ss::gate::holder gh{_gate};
     retry_chain_node fib(&parent);
     retry_chain_logger ctxlog(cst_log, fib);
-    auto lease = co_await _pool.local().acquire(fib.root_abort_source());
     auto permit = fib.retry();
     vlog(ctxlog.debug, "List objects {}", bucket);
-    std::optional<list_result> result;
+    std::optional<list_pages_result> result;
 
-    bool items_remaining = true;
     std::optional<ss::sstring> continuation_token = std::nullopt;
 
-    // Gathers the items from a series of successful ListObjectsV2 calls
-    cloud_storage_clients::client::list_bucket_result list_bucket_result;
-
     // Keep iterating until the ListObjectsV2 calls has more items to return
     while (!_gate.is_closed() && permit.is_allowed && !result) {
-        auto res = co_await lease.client->list_objects(
+        auto lease = std::make_optional(
+          co_await _pool.local().acquire(fib.root_abort_source()));
+        auto res = co_await lease->client->list_objects(
           bucket,
           prefix,
           std::nullopt,
@@ -1299,39 +1880,26 @@ ss::future<remote::list_result> remote::list_objects(
           item_filter);
 
         if (res) {
-            auto list_result = res.value();
+            // Release the client before the consumer runs, it may take a
+            // while to process the page or need a client itself.
+            lease.reset();
+            auto page = std::move(res.value());
             // Successful call, prepare for future calls by getting
             // continuation_token if result was truncated
-            items_remaining = list_result.is_truncated;
-            continuation_token.emplace(list_result.next_continuation_token);
-            std::copy(
-              std::make_move_iterator(list_result.contents.begin()),
-              std::make_move_iterator(list_result.contents.end()),
-              std::back_inserter(list_bucket_result.contents));
-
-            // Move common prefixes to the result, only if they have not been
-            // copied yet. These values will remain the same during pagination
-            // of list call results, so they should only be copied once.
-            if (
-              list_bucket_result.common_prefixes.empty()
-              && !list_result.common_prefixes.empty()) {
-                std::copy(
-                  std::make_move_iterator(list_result.common_prefixes.begin()),
-                  std::make_move_iterator(list_result.common_prefixes.end()),
-                  std::back_inserter(list_bucket_result.common_prefixes));
-            }
+            const bool items_remaining = page.is_truncated;
+            continuation_token.emplace(page.next_continuation_token);
 
-            list_bucket_result.prefix = list_result.prefix;
+            auto stop = co_await consumer(std::move(page));
 
             // Continue to list the remaining items
-            if (items_remaining) {
+            if (items_remaining && stop == ss::stop_iteration::no) {
                 continue;
             }
 
-            co_return list_bucket_result;
+            co_return outcome::success();
         }
 
-        lease.client->shutdown();
+        lease->client->shutdown();
 
         switch (res.error()) {
         case cloud_storage_clients::error_outcome::retry:
@@ -26,15 +26,20 @@
 #include "utils/retry_chain_node.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/loop.hh>
+#include <seastar/core/shared_ptr.hh>
 
+#include <deque>
 #include <ranges>
 #include <utility>
 
 namespace cloud_storage {
 
 class materialized_resources;
+class upload_scheduler;
+class segment_key_filter;
 
 /// \brief Predicate required to continue operation
 ///
@@ -130,6 +135,13 @@ public:
     using reset_input_stream = ss::noncopyable_function<
       ss::future<std::unique_ptr<storage::stream_provider>>()>;
 
+    /// Functor that returns fresh input_stream object over the byte range
+    /// [offset, offset + length) of the data that needs to be uploaded. It
+    /// can be invoked concurrently for different ranges.
+    using reset_input_stream_range = ss::noncopyable_function<
+      ss::future<std::unique_ptr<storage::stream_provider>>(
+        uint64_t offset, uint64_t length)>;
+
     /// Functor that attempts to consume the input stream. If the connection
     /// is broken during the download the functor is responsible for he cleanup.
     /// The functor should be reenterable since it can be called many times.
@@ -144,6 +156,13 @@ public:
     using list_objects_consumer = std::function<ss::stop_iteration(
       ss::sstring, std::chrono::system_clock::time_point, size_t, ss::sstring)>;
 
+    /// Functor that receives the pages of a listing in order, as soon as
+    /// every page is received. The next page is only requested once the
+    /// returned future resolves.
+    using list_page_consumer = ss::noncopyable_function<
+      ss::future<ss::stop_iteration>(
+        cloud_storage_clients::client::list_bucket_result)>;
+
     using latency_measurement_t
       = std::unique_ptr<remote_probe::hist_t::measurement>;
     struct download_metrics {
@@ -273,6 +292,34 @@ public:
       retry_chain_node& parent,
       lazy_abort_source& lazy_abort_source);
 
+    struct multipart_upload_result {
+        upload_result result;
+        /// Number of parts the object was split into
+        size_t parts{0};
+        /// Number of part uploads that had to be repeated
+        size_t part_retries{0};
+    };
+
+    /// \brief Upload segment to S3 as a multipart upload
+    ///
+    /// The segment is split into parts of \p part_size bytes (the last part
+    /// can be shorter) which are uploaded concurrently, at most \p
+    /// concurrency at a time, each with its own client lease. A part that
+    /// fails with a retryable error is uploaded again on its own while the
+    /// parts uploaded before are kept. If a part can't be uploaded the
+    /// multipart upload is aborted.
+    /// \param reset_str is a functor that returns an input_stream with the
+    ///                  data of one part
+    ss::future<multipart_upload_result> upload_segment_multipart(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& segment_path,
+      uint64_t content_length,
+      uint64_t part_size,
+      size_t concurrency,
+      const reset_input_stream_range& reset_str,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
     /// \brief Download segment from S3
     ///
     /// The method downloads the segment while tolerating some errors. It can
@@ -334,12 +381,30 @@ public:
       offset_index& ix,
       retry_chain_node& parent);
 
+    /// \brief Download the key filter of a segment
+    /// \param filter is populated from data from the object store
+    /// \return notfound if the segment was uploaded without a filter
+    ss::future<download_result> download_key_filter(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& filter_path,
+      segment_key_filter& filter,
+      retry_chain_node& parent);
+
     /// Checks if the segment exists in the bucket
     ss::future<download_result> segment_exists(
       const cloud_storage_clients::bucket_name& bucket,
       const remote_segment_path& path,
       retry_chain_node& parent);
 
+    /// Checks if the object exists in the bucket and returns its ETag
+    ///
+    /// The ETag changes whenever the object is overwritten, this is a cheap
+    /// way of finding out if an object has to be downloaded again.
+    ss::future<std::pair<download_result, ss::sstring>> object_etag(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& path,
+      retry_chain_node& parent);
+
     /// \brief Delete object from S3
     ///
     /// The method deletes the object. It can retry after some errors.
@@ -373,6 +438,33 @@ public:
       R keys,
       retry_chain_node& parent);
 
+    /// \brief Delete multiple objects, sharing requests with other callers
+    ///
+    /// Like delete_objects, but the keys are put in a shard-wide deletion
+    /// queue and packed into DeleteObjects requests of up to
+    /// delete_objects_max_keys together with the keys queued by the other
+    /// partitions of the shard. This is meant for the deletions of
+    /// retention and of deleted topics, which otherwise send many small
+    /// requests. The number of requests in flight adapts to the backend:
+    /// it is halved when a request has to be retried (e.g. on SlowDown)
+    /// and grows back by one with every request that succeeds.
+    ///
+    /// The result is a failure if any of the requests carrying the keys
+    /// failed, the timeout of the request is the one of \p parent of the
+    /// caller whose keys are first in it.
+    ///
+    /// \param bucket The bucket to delete from
+    /// \param keys A range of keys which will be deleted
+    template<typename R>
+    requires std::ranges::range<R>
+             && std::same_as<
+               std::ranges::range_value_t<R>,
+               cloud_storage_clients::object_key>
+    ss::future<upload_result> delete_objects_coalesced(
+      const cloud_storage_clients::bucket_name& bucket,
+      R keys,
+      retry_chain_node& parent);
+
     using list_result = result<
       cloud_storage_clients::client::list_bucket_result,
       cloud_storage_clients::error_outcome>;
@@ -394,6 +486,34 @@ public:
       std::optional<cloud_storage_clients::client::item_filter> item_filter
       = std::nullopt);
 
+    using list_pages_result
+      = result<void, cloud_storage_clients::error_outcome>;
+
+    /// \brief Lists objects in a bucket one page at a time
+    ///
+    /// Unlike list_objects the results are not gathered, every page of
+    /// ListObjectsV2 results is passed to \p consumer which can stop the
+    /// listing early. Only one page is held in memory at a time. The client
+    /// lease is released while the consumer runs, so the consumer is free
+    /// to issue other requests.
+    ///
+    /// \param name The bucket to list
+    /// \param parent The retry chain node to manage timeouts
+    /// \param consumer Receives the pages
+    /// \param prefix Optional prefix to restrict listing of objects
+    /// \param delimiter A character to use as a delimiter when grouping list
+    /// results
+    /// \param item_filter Optional filter to apply to items before
+    /// collecting
+    ss::future<list_pages_result> list_objects_pages(
+      const cloud_storage_clients::bucket_name& name,
+      retry_chain_node& parent,
+      list_page_consumer consumer,
+      std::optional<cloud_storage_clients::object_key> prefix = std::nullopt,
+      std::optional<char> delimiter = std::nullopt,
+      std::optional<cloud_storage_clients::client::item_filter> item_filter
+      = std::nullopt);
+
     /// \brief Upload small objects to bucket. Suitable for uploading simple
     /// strings, does not check for leadership before upload like the segment
     /// upload function.
@@ -415,8 +535,22 @@ public:
       retry_chain_node& parent,
       bool expect_missing = false);
 
+    /// \brief Apply the deltas uploaded after the partition manifest
+    ///
+    /// Lists the deltas stored next to the manifest and applies them in
+    /// order for as long as they chain with the version of the manifest.
+    /// \param manifest is a previously downloaded manifest
+    /// \return failed or timedout if a delta can't be listed or downloaded
+    ss::future<download_result> download_partition_manifest_deltas(
+      const cloud_storage_clients::bucket_name& bucket,
+      partition_manifest& manifest,
+      retry_chain_node& parent);
+
     materialized_resources& materialized() { return *_materialized; }
 
+    /// Shard-wide admission and throttling of segment uploads
+    upload_scheduler& uploads() { return *_upload_scheduler; }
+
     /// Event filter class.
     ///
     /// The filter can be used to subscribe to subset of events.
@@ -496,6 +630,17 @@ private:
       SuccessfulUploadMetricFn successful_upload_metric,
       UploadBackoffMetricFn upload_backoff_metric);
 
+    /// Send one request of a multipart upload, retrying it with a fresh
+    /// client until it succeeds, fails with a non-retryable error or the
+    /// retry budget of \p fib runs out.
+    template<typename RequestFn>
+    ss::future<upload_result> do_multipart_upload_request(
+      const cloud_storage_clients::object_key& path,
+      std::string_view request_label,
+      RequestFn request,
+      retry_chain_node& fib,
+      lazy_abort_source& lazy_abort_source);
+
     template<
       typename DownloadLatencyMeasurementFn,
       typename FailedDownloadMetricFn,
@@ -532,6 +677,38 @@ private:
       std::vector<cloud_storage_clients::object_key> keys,
       retry_chain_node& parent);
 
+    /// Keys of a delete_objects_coalesced call. The keys may be spread
+    /// over several requests, the caller is notified once all of them
+    /// complete.
+    struct pending_delete {
+        pending_delete(
+          cloud_storage_clients::bucket_name bucket,
+          std::vector<cloud_storage_clients::object_key> keys,
+          retry_chain_node& parent)
+          : bucket(std::move(bucket))
+          , keys(std::move(keys))
+          , parent(parent) {}
+
+        cloud_storage_clients::bucket_name bucket;
+        std::vector<cloud_storage_clients::object_key> keys;
+        retry_chain_node& parent;
+        // Number of the keys already put in a request
+        size_t queued{0};
+        // Number of the requests with the keys which didn't complete
+        size_t inflight{0};
+        upload_result result{upload_result::success};
+        ss::promise<upload_result> promise;
+    };
+    using pending_delete_ptr = ss::lw_shared_ptr<pending_delete>;
+
+    /// Pack the queued keys into requests and send them
+    ss::future<> run_delete_queue();
+
+    ss::future<> send_coalesced_batch(
+      cloud_storage_clients::bucket_name bucket,
+      std::vector<cloud_storage_clients::object_key> keys,
+      std::vector<pending_delete_ptr> owners);
+
     ss::future<> propagate_credentials(cloud_roles::credentials credentials);
     /// Notify all subscribers about segment or manifest upload/download
     void notify_external_subscribers(
@@ -542,6 +719,7 @@ private:
     ss::abort_source _as;
     auth_refresh_bg_op _auth_refresh_bg_op;
     std::unique_ptr<materialized_resources> _materialized;
+    std::unique_ptr<upload_scheduler> _upload_scheduler;
 
     // Lifetime: probe has reference to _materialized, must be destroyed after
     remote_probe _probe;
@@ -551,6 +729,15 @@ private:
     config::binding<std::optional<ss::sstring>> _azure_shared_key_binding;
 
     model::cloud_storage_backend _cloud_storage_backend;
+
+    // Shard-wide deletion queue of delete_objects_coalesced
+    std::deque<pending_delete_ptr> _pending_deletes;
+    ss::condition_variable _pending_deletes_cvar;
+    bool _delete_queue_running{false};
+    size_t _deletes_inflight{0};
+    size_t _max_deletes_inflight{1};
+    // Number of DeleteObjects attempts which had to be retried
+    uint64_t _delete_retries{0};
 };
 
 } // namespace cloud_storage
@@ -16,6 +16,7 @@
 #include "cloud_storage/offset_translation_layer.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment.h"
+#include "cloud_storage/segment_key_filter.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
@@ -215,7 +216,7 @@ public:
     explicit partition_record_batch_reader_impl(
       ss::shared_ptr<remote_partition> part,
       ss::lw_shared_ptr<storage::offset_translator_state> ot_state,
-      ssx::semaphore_units units) noexcept
+      partition_reader_units units) noexcept
       : _rtc(part->_as)
       , _ctxlog(cst_log, _rtc, part->get_ntp().path())
       , _partition(std::move(part))
@@ -821,7 +822,7 @@ private:
 
     /// RAII units managed by `materialized_resources` to limit concurrent
     /// readers, we simply carry the object around and then free on destruction.
-    ssx::semaphore_units _units;
+    partition_reader_units _units;
 };
 
 remote_partition::remote_partition(
@@ -1112,8 +1113,19 @@ ss::future<storage::translating_reader> remote_partition::make_reader(
       config,
       _segments.size());
 
+    // reads of the last uploaded segment are the ones of consumers which are
+    // close to the tail of the log, they don't wait behind historical scans
+    auto last_seg = _manifest_view->stm_manifest().last_segment();
+    auto pool = last_seg.has_value()
+                    && model::offset_cast(config.start_offset)
+                         >= last_seg->base_kafka_offset()
+                  ? reader_pool::tail
+                  : reader_pool::historical;
+    auto client = config.client_address.has_value()
+                    ? config.client_address.value()()
+                    : ss::sstring{};
     auto units = co_await _api.materialized().get_partition_reader_units(
-      config.abort_source);
+      config.abort_source, std::move(client), pool);
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       get_ntp());
 
@@ -1334,6 +1346,8 @@ ss::future<remote_partition::erase_result> remote_partition::erase(
           cloud_storage::generate_remote_tx_path(path));
         objects_to_remove.emplace_back(
           cloud_storage::generate_index_path(path));
+        objects_to_remove.emplace_back(
+          cloud_storage::generate_key_filter_path(path));
     }
 
     for (const auto& meta : manifest) {
@@ -1345,6 +1359,8 @@ ss::future<remote_partition::erase_result> remote_partition::erase(
           cloud_storage::generate_remote_tx_path(path));
         objects_to_remove.emplace_back(
           cloud_storage::generate_index_path(path));
+        objects_to_remove.emplace_back(
+          cloud_storage::generate_key_filter_path(path));
     }
 
     vlog(
@@ -1353,7 +1369,7 @@ ss::future<remote_partition::erase_result> remote_partition::erase(
       manifest.get_ntp(),
       segments_to_remove_count);
     if (
-      co_await api.delete_objects(
+      co_await api.delete_objects_coalesced(
         bucket, std::move(objects_to_remove), local_rtc)
       != upload_result::success) {
         vlog(
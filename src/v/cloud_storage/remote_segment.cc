@@ -18,6 +18,7 @@
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/segment_chunk_data_source.h"
+#include "cloud_storage/segment_stream_data_source.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
 #include "config/configuration.h"
@@ -51,6 +52,7 @@
 #include <fmt/core.h>
 
 #include <exception>
+#include <limits>
 
 namespace {
 class bounded_stream final : public ss::data_source_impl {
@@ -328,6 +330,38 @@ remote_segment::offset_data_stream(
     if (is_legacy_mode_engaged()) {
         data_stream = ss::make_file_input_stream(
           _data_file, pos.file_pos, std::move(options));
+    } else if (
+      first_timestamp.has_value()
+      && !co_await is_chunk_local(pos.kaf_offset)) {
+        // A time query reads one batch close to the indexed position.
+        // Hydrating the whole chunk would download and write to disk many
+        // megabytes for it, while a ranged read stops as soon as the reader
+        // has its batch and closes the stream.
+        vlog(
+          _ctxlog.debug,
+          "streaming time query read from file position {}",
+          pos.file_pos);
+        auto stream_ds = std::make_unique<stream_data_source_impl>(
+          *this,
+          pos.file_pos,
+          get_chunk_end_for_kafka_offset(end),
+          config::shard_local_cfg().storage_read_buffer_size());
+        data_stream = ss::input_stream<char>{
+          ss::data_source{std::move(stream_ds)}};
+    } else if (
+      !prefetch_override.has_value()
+      && co_await should_stream_read(pos.kaf_offset, pos.file_pos, end)) {
+        vlog(
+          _ctxlog.debug,
+          "streaming read from file position {}, bypassing the cache",
+          pos.file_pos);
+        auto stream_ds = std::make_unique<stream_data_source_impl>(
+          *this,
+          pos.file_pos,
+          get_chunk_end_for_kafka_offset(end),
+          config::shard_local_cfg().cloud_storage_stream_read_buffer_size());
+        data_stream = ss::input_stream<char>{
+          ss::data_source{std::move(stream_ds)}};
     } else {
         auto chunk_ds = std::make_unique<chunk_data_source_impl>(
           _chunks_api.value(),
@@ -348,6 +382,63 @@ remote_segment::offset_data_stream(
     };
 }
 
+ss::future<bool> remote_segment::should_stream_read(
+  kafka::offset start, uint64_t file_pos, kafka::offset end) {
+    const auto buffer_size
+      = config::shard_local_cfg().cloud_storage_stream_read_buffer_size();
+    if (buffer_size == 0) {
+        co_return false;
+    }
+
+    // Data which is already local is cheaper to read from the cache
+    if (co_await is_chunk_local(start)) {
+        co_return false;
+    }
+
+    // Chunks written to a cache which blocks new downloads for lack of disk
+    // space would only stall the reader.
+    if (_cache.is_under_pressure()) {
+        co_return true;
+    }
+
+    // A reader starting at the beginning of the segment is most likely a
+    // sequential scan moving on from the previous segment. Data it reads
+    // across several chunks is read once, writing it to the cache disk only
+    // adds write amplification.
+    co_return file_pos == 0 && get_chunk_start_for_kafka_offset(end) > 0;
+}
+
+ss::future<bool> remote_segment::is_chunk_local(kafka::offset koff) {
+    const auto chunk_start = get_chunk_start_for_kafka_offset(koff);
+    co_return _chunks_api->get(chunk_start).current_state
+                != chunk_state::not_available
+              || co_await _cache.is_cached(get_path_to_chunk(chunk_start))
+                   != cache_element_status::not_available;
+}
+
+uint64_t
+remote_segment::get_chunk_end_for_kafka_offset(kafka::offset koff) const {
+    vassert(_coarse_index.has_value(), "coarse index is not initialized");
+    auto it = _coarse_index->upper_bound(koff);
+    if (it == _coarse_index->end()) {
+        return _size - 1;
+    }
+    return static_cast<uint64_t>(it->second) - 1;
+}
+
+ss::future<> remote_segment::download_range(
+  uint64_t begin,
+  uint64_t end,
+  const remote::try_consume_stream& consumer,
+  retry_chain_node& rtc) {
+    auto g = _gate.hold();
+    auto res = co_await _api.download_segment(
+      _bucket, _path, consumer, rtc, std::make_pair(begin, end));
+    if (res != download_result::success) {
+        throw download_exception{res, _path};
+    }
+}
+
 std::optional<offset_index::find_result>
 remote_segment::maybe_get_offsets(kafka::offset kafka_offset) {
     if (!_index) {
@@ -496,6 +587,14 @@ ss::future<> remote_segment::put_chunk_in_cache(
 }
 
 ss::future<> remote_segment::do_hydrate_segment() {
+    auto claim = co_await _cache.claim_hydration(_path);
+    if (
+      claim.waited()
+      && co_await _cache.is_cached(_path) == cache_element_status::available) {
+        vlog(_ctxlog.debug, "segment {} was hydrated concurrently", _path);
+        co_return;
+    }
+
     retry_chain_node local_rtc(
       cache_hydration_timeout, cache_hydration_backoff, &_rtc);
 
@@ -503,6 +602,12 @@ ss::future<> remote_segment::do_hydrate_segment() {
     auto reservation = co_await _cache.reserve_space(
       _size + storage::segment_index::estimate_size(_size), 1);
 
+    // The index embedded in the object isn't a part of the segment file
+    std::optional<cloud_storage_clients::http_byte_range> byte_range;
+    if (_sname_format >= segment_name_format::v4) {
+        byte_range = std::make_pair(0, _size - 1);
+    }
+
     track_hydration t{_ts_probe};
     auto res = co_await _api.download_segment(
       _bucket,
@@ -514,7 +619,8 @@ ss::future<> remote_segment::do_hydrate_segment() {
           return put_segment_in_cache_and_create_index(
             size_bytes, reservation, std::move(s));
       },
-      local_rtc);
+      local_rtc,
+      byte_range);
 
     if (res != download_result::success) {
         vlog(
@@ -538,11 +644,15 @@ ss::future<> remote_segment::do_hydrate_index() {
       remote_segment_sampling_step_bytes,
       _base_timestamp);
 
-    auto result = co_await _api.download_index(
-      _bucket, remote_segment_path{_index_path}, ix, local_rtc);
+    if (_sname_format >= segment_name_format::v4) {
+        co_await download_embedded_index(ix, local_rtc);
+    } else {
+        auto result = co_await _api.download_index(
+          _bucket, remote_segment_path{_index_path}, ix, local_rtc);
 
-    if (result != download_result::success) {
-        throw download_exception(result, _index_path);
+        if (result != download_result::success) {
+            throw download_exception(result, _index_path);
+        }
     }
 
     _index = std::move(ix);
@@ -558,11 +668,52 @@ ss::future<> remote_segment::do_hydrate_index() {
     });
 }
 
+ss::future<> remote_segment::download_embedded_index(
+  offset_index& ix, retry_chain_node& rtc) {
+    // A segment which fits in a single chunk is downloaded whole: the request
+    // which fetches the index also fetches the only chunk of the segment,
+    // which the reader needs next. Otherwise only the index is fetched, the
+    // chunk boundaries depend on it. The end of the range is past the end of
+    // the object, the object store returns the bytes up to its end.
+    const bool with_data = _size <= _chunk_size;
+    const uint64_t begin = with_data ? 0 : _size;
+    const uint64_t end = std::numeric_limits<int64_t>::max();
+
+    iobuf buf;
+    auto consumer = [this, with_data, &buf](
+                      uint64_t size, ss::input_stream<char> s)
+      -> ss::future<uint64_t> {
+        const uint64_t data_size = with_data ? _size : 0;
+        if (size <= data_size) {
+            // The object has no index after the data
+            co_await s.close();
+            throw download_exception(download_result::failed, _path);
+        }
+        if (with_data) {
+            auto reservation = co_await _cache.reserve_space(_size, 1);
+            auto data = ss::input_stream<char>{
+              ss::data_source{std::make_unique<bounded_stream>(s, _size)}};
+            _probe.chunk_size(_size);
+            co_await put_chunk_in_cache(reservation, std::move(data), 0);
+        }
+        buf = co_await read_iobuf_exactly(s, size - data_size);
+        co_await s.close();
+        co_return size;
+    };
+
+    auto res = co_await _api.download_segment(
+      _bucket, _path, consumer, rtc, std::make_pair(begin, end));
+    if (res != download_result::success) {
+        throw download_exception(res, _path);
+    }
+    ix.from_iobuf(std::move(buf));
+}
+
 ss::future<> remote_segment::do_hydrate_txrange() {
     ss::gate::holder guard(_gate);
     retry_chain_node local_rtc(
       cache_hydration_timeout, cache_hydration_backoff, &_rtc);
-    if (_sname_format == segment_name_format::v3 && _metadata_size_hint == 0) {
+    if (_sname_format >= segment_name_format::v3 && _metadata_size_hint == 0) {
         // The tx-manifest is empty, no need to download it, and
         // avoid putting this empty manifest into the cache.
         _tx_range.emplace();
@@ -994,6 +1145,21 @@ ss::future<> remote_segment::hydrate_chunk(segment_chunk_range range) {
         co_return;
     }
 
+    // Another shard may be hydrating the same chunk, e.g. while the partition
+    // moves between shards: only one of the downloads goes to the object store.
+    auto claim = co_await _cache.claim_hydration(path_to_start);
+    if (
+      claim.waited()
+      && co_await _cache.is_cached(path_to_start)
+           == cache_element_status::available) {
+        vlog(
+          _ctxlog.debug,
+          "skipping chunk hydration for chunk path {}, it was hydrated "
+          "concurrently",
+          path_to_start);
+        co_return;
+    }
+
     retry_chain_node rtc{
       cache_hydration_timeout, cache_hydration_backoff, &_rtc};
 
@@ -140,6 +140,14 @@ public:
     /// files are written to cache.
     ss::future<> hydrate_chunk(segment_chunk_range range);
 
+    /// Download the byte range [begin, end] of the segment and pass the
+    /// response body to \p consumer. Nothing is written to the cache.
+    ss::future<> download_range(
+      uint64_t begin,
+      uint64_t end,
+      const remote::try_consume_stream& consumer,
+      retry_chain_node& rtc);
+
     /// Loads the segment chunk file from cache into an open file handle. If the
     /// file is not present in cache, the returned file handle is unopened.
     ss::future<ss::file> materialize_chunk(chunk_start_offset_t);
@@ -192,6 +200,19 @@ public:
     std::pair<size_t, bool> min_cache_cost() const;
 
 private:
+    /// Return true if the read of kafka offsets [start, end], beginning at
+    /// file position \p file_pos, should stream data from object storage
+    /// instead of hydrating chunks into the cache.
+    ss::future<bool> should_stream_read(
+      kafka::offset start, uint64_t file_pos, kafka::offset end);
+
+    /// Return true if the chunk containing kafka offset \p koff is hydrated,
+    /// or being hydrated, into the cache.
+    ss::future<bool> is_chunk_local(kafka::offset koff);
+
+    /// Last file position of the chunk containing kafka offset \p koff
+    uint64_t get_chunk_end_for_kafka_offset(kafka::offset koff) const;
+
     /// get a file offset for the corresponding kafka offset
     /// if the index is available
     std::optional<offset_index::find_result>
@@ -236,6 +257,10 @@ private:
 
     ss::future<> do_hydrate_index();
 
+    /// Download the index appended to the data of a segment_name_format::v4
+    /// object, and the data too if the segment fits in a single chunk.
+    ss::future<> download_embedded_index(offset_index& ix, retry_chain_node&);
+
     /// Materilize segment. Segment has to be hydrated beforehand. The
     /// 'materialization' process opens file handle and creates
     /// compressed segment index in memory.
@@ -15,6 +15,7 @@
 #include "raft/consensus.h"
 #include "serde/envelope.h"
 #include "serde/serde.h"
+#include "storage/parser_utils.h"
 
 namespace cloud_storage {
 
@@ -412,12 +413,14 @@ remote_segment_index_builder::remote_segment_index_builder(
   offset_index& ix,
   model::offset_delta initial_delta,
   size_t sampling_step,
-  std::optional<std::reference_wrapper<segment_record_stats>> maybe_stats)
+  std::optional<std::reference_wrapper<segment_record_stats>> maybe_stats,
+  segment_key_filter_builder* key_filter)
   : _ix(ix)
   , _running_delta(initial_delta)
   , _sampling_step(sampling_step)
   , _filter(raft::offset_translator_batch_types(ntp))
-  , _stats(maybe_stats) {}
+  , _stats(maybe_stats)
+  , _key_filter(key_filter) {}
 
 remote_segment_index_builder::consume_result
 remote_segment_index_builder::accept_batch_start(
@@ -446,6 +449,10 @@ void remote_segment_index_builder::consume_batch_start(
     }
     _window += size_on_disk;
 
+    if (_key_filter && hdr.type == model::record_batch_type::raft_data) {
+        _key_batch_header = hdr;
+    }
+
     // Update stats
     if (_stats.has_value()) {
         if (is_config) {
@@ -470,10 +477,29 @@ void remote_segment_index_builder::skip_batch_start(
     vassert(false, "no batches should be skipped by this consumer");
 }
 
-void remote_segment_index_builder::consume_records(iobuf&&) {}
+void remote_segment_index_builder::consume_records(iobuf&& records) {
+    if (_key_batch_header) {
+        _key_batch_records = std::move(records);
+    }
+}
 
 ss::future<remote_segment_index_builder::stop_parser>
 remote_segment_index_builder::consume_batch_end() {
+    if (!_key_batch_header) {
+        co_return stop_parser::no;
+    }
+    model::record_batch batch(
+      *std::exchange(_key_batch_header, std::nullopt),
+      std::exchange(_key_batch_records, iobuf{}),
+      model::record_batch::tag_ctor_ng{});
+    if (batch.compressed()) {
+        batch = co_await storage::internal::decompress_batch(std::move(batch));
+    }
+    batch.for_each_record([this](const model::record& r) {
+        if (r.key_size() >= 0) {
+            _key_filter->add(r.key());
+        }
+    });
     co_return stop_parser::no;
 }
 
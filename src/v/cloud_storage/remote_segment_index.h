@@ -12,6 +12,7 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
+#include "cloud_storage/segment_key_filter.h"
 #include "model/fundamental.h"
 #include "model/record_batch_types.h"
 #include "seastarx.h"
@@ -209,7 +210,8 @@ public:
       offset_index& ix,
       model::offset_delta initial_delta,
       size_t sampling_step,
-      std::optional<std::reference_wrapper<segment_record_stats>> maybe_stats);
+      std::optional<std::reference_wrapper<segment_record_stats>> maybe_stats,
+      segment_key_filter_builder* key_filter = nullptr);
 
     virtual consume_result
     accept_batch_start(const model::record_batch_header&) const;
@@ -236,6 +238,10 @@ private:
     std::vector<model::record_batch_type> _filter;
     /// Collected stats
     std::optional<std::reference_wrapper<segment_record_stats>> _stats;
+    /// Collects record keys of data batches if set
+    segment_key_filter_builder* _key_filter;
+    std::optional<model::record_batch_header> _key_batch_header;
+    iobuf _key_batch_records;
 };
 
 inline ss::lw_shared_ptr<storage::continuous_batch_parser>
@@ -246,10 +252,11 @@ make_remote_segment_index_builder(
   model::offset_delta initial_delta,
   size_t sampling_step,
   std::optional<std::reference_wrapper<segment_record_stats>> maybe_stats
-  = std::nullopt) {
+  = std::nullopt,
+  segment_key_filter_builder* key_filter = nullptr) {
     auto parser = ss::make_lw_shared<storage::continuous_batch_parser>(
       std::make_unique<remote_segment_index_builder>(
-        ntp, ix, initial_delta, sampling_step, maybe_stats),
+        ntp, ix, initial_delta, sampling_step, maybe_stats, key_filter),
       storage::segment_reader_handle(std::move(stream)));
     return parser;
 }
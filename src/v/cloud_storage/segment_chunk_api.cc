@@ -199,6 +199,31 @@ ss::future<segment_chunk::handle_t> segment_chunks::hydrate_chunk(
     co_return handle;
 }
 
+void segment_chunks::read_ahead(chunk_start_offset_t chunk_start) {
+    vassert(_started, "chunk API is not started");
+
+    if (_gate.is_closed() || _as.abort_requested()) {
+        return;
+    }
+
+    if (get(chunk_start).current_state != chunk_state::not_available) {
+        return;
+    }
+
+    vlog(_ctxlog.trace, "starting read-ahead of chunk at {}", chunk_start);
+    ssx::spawn_with_gate(_gate, [this, chunk_start] {
+        return hydrate_chunk(chunk_start, 0)
+          .discard_result()
+          .handle_exception([this, chunk_start](const std::exception_ptr& e) {
+              vlog(
+                _ctxlog.debug,
+                "read-ahead of chunk at {} failed: {}",
+                chunk_start,
+                e);
+          });
+    });
+}
+
 ss::future<> segment_chunks::trim_chunk_files() {
     vassert(_started, "chunk API is not started");
 
@@ -56,6 +56,14 @@ public:
     void
     register_readers(chunk_start_offset_t first, chunk_start_offset_t last);
 
+    // Starts hydrating the given chunk in the background without waiting for
+    // it, so that a reader reaching the chunk later either finds it hydrated
+    // or joins the download in flight as a waiter. The chunk is downloaded on
+    // its own, without prefetch, so several read-aheads of the same segment
+    // run as parallel ranged GETs. Failures are only logged, the reader
+    // retries the hydration once it needs the chunk.
+    void read_ahead(chunk_start_offset_t chunk_start);
+
     // Mark the first chunk id as acquired by decrementing its
     // required_by_readers_in_future count, and decrement the
     // required_after_n_chunks counts for everything from [first, last] by one.
@@ -32,7 +32,18 @@ chunk_data_source_impl::chunk_data_source_impl(
   , _stream_options(std::move(stream_options))
   , _rtc{_as}
   , _ctxlog{cst_log, _rtc, _segment.get_segment_path()().native()}
-  , _prefetch_override{prefetch_override} {
+  , _prefetch_override{prefetch_override}
+  , _max_read_ahead{
+      config::shard_local_cfg().cloud_storage_chunk_read_ahead()} {
+    if (_prefetch_override.has_value()) {
+        // A prefetch override is only passed for reads which touch few chunks,
+        // such as timequeries. Read-ahead would waste downloads for them.
+        _max_read_ahead = 0;
+    } else if (_max_read_ahead > 0) {
+        // Read-ahead issues one request per chunk, prefetching the same chunks
+        // would serialize them into a single large request.
+        _prefetch_override = 0;
+    }
     vlog(
       _ctxlog.trace,
       "chunk data source initialized with file position {} to {}",
@@ -94,6 +105,10 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
   chunk_start_offset_t chunk_start) {
     vlog(_ctxlog.debug, "loading stream for chunk starting at {}", chunk_start);
 
+    const bool stalled = _max_read_ahead > 0
+                         && _chunks.get(chunk_start).current_state
+                              != chunk_state::hydrated;
+
     std::exception_ptr eptr;
 
     try {
@@ -113,6 +128,8 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
     _chunks.mark_acquired_and_update_stats(
       _current_chunk_start, _last_chunk_start);
 
+    maybe_read_ahead(stalled);
+
     if (_current_stream) {
         co_await _current_stream->close();
     }
@@ -137,6 +154,33 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
       *_current_data_file, begin, _stream_options);
 }
 
+void chunk_data_source_impl::maybe_read_ahead(bool stalled) {
+    if (_max_read_ahead == 0) {
+        return;
+    }
+
+    if (_read_ahead_window == 0) {
+        _read_ahead_window = 1;
+    } else if (stalled) {
+        // The reader had to wait for a chunk the window should have covered,
+        // the consumer is faster than the current read-ahead.
+        _read_ahead_window = std::min<uint16_t>(
+          _max_read_ahead, _read_ahead_window * 2);
+        vlog(
+          _ctxlog.trace,
+          "reader stalled on chunk at {}, read-ahead window is now {}",
+          _current_chunk_start,
+          _read_ahead_window);
+    }
+
+    auto next = _current_chunk_start;
+    for (uint16_t i = 0; i < _read_ahead_window && next < _last_chunk_start;
+         ++i) {
+        next = _chunks.get_next_chunk_start(next);
+        _chunks.read_ahead(next);
+    }
+}
+
 ss::future<> chunk_data_source_impl::close() {
     co_await _gate.close();
     co_await maybe_close_stream();
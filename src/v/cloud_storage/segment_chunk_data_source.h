@@ -51,6 +51,10 @@ private:
     ss::future<> maybe_close_stream();
     ss::future<> load_chunk_handle(chunk_start_offset_t chunk_start);
 
+    // Grows the read-ahead window if the reader has caught up with it, then
+    // starts background hydration of the chunks inside the window.
+    void maybe_read_ahead(bool stalled);
+
     segment_chunks& _chunks;
     remote_segment& _segment;
 
@@ -70,6 +74,12 @@ private:
     retry_chain_node _rtc;
     retry_chain_logger _ctxlog;
     std::optional<uint16_t> _prefetch_override;
+
+    // Upper bound and current size, in chunks, of the read-ahead window. The
+    // window stays small for consumers slower than the download path and
+    // ramps up for fast ones such as backfills of historical data.
+    uint16_t _max_read_ahead;
+    uint16_t _read_ahead_window{0};
 };
 
 } // namespace cloud_storage
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/segment_key_filter.h"
+
+#include "hashing/xx.h"
+#include "serde/serde.h"
+
+#include <bit>
+
+namespace cloud_storage {
+
+namespace {
+// Kirsch-Mitzenmacher double hashing, the i-th probe of the key is
+// h1 + i * h2 where both halves are derived from a single 64-bit hash.
+struct probes {
+    explicit probes(uint64_t h)
+      : h1(h)
+      , h2(std::rotl(h, 32) | 1U) {}
+
+    uint64_t at(uint32_t i, size_t num_bits) const {
+        return (h1 + i * h2) % num_bits;
+    }
+
+    uint64_t h1;
+    uint64_t h2;
+};
+} // namespace
+
+segment_key_filter::segment_key_filter(size_t num_keys)
+  : _bits(std::max<size_t>((num_keys * bits_per_key + 63) / 64, 1), 0) {}
+
+uint64_t segment_key_filter::hash_key(const iobuf& key) {
+    incremental_xxhash64 h;
+    for (const auto& frag : key) {
+        h.update(frag.get(), frag.size());
+    }
+    return h.digest();
+}
+
+uint64_t segment_key_filter::hash_key(std::string_view key) {
+    incremental_xxhash64 h;
+    h.update(key);
+    return h.digest();
+}
+
+void segment_key_filter::add(uint64_t key_hash) {
+    const probes p(key_hash);
+    const auto num_bits = size_bits();
+    for (uint32_t i = 0; i < _num_hashes; ++i) {
+        auto bit = p.at(i, num_bits);
+        _bits[bit / 64] |= uint64_t{1} << (bit % 64);
+    }
+}
+
+bool segment_key_filter::may_contain(uint64_t key_hash) const {
+    if (_bits.empty()) {
+        return true;
+    }
+    const probes p(key_hash);
+    const auto num_bits = size_bits();
+    for (uint32_t i = 0; i < _num_hashes; ++i) {
+        auto bit = p.at(i, num_bits);
+        if ((_bits[bit / 64] & (uint64_t{1} << (bit % 64))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+iobuf segment_key_filter::to_iobuf() && {
+    return serde::to_iobuf(std::move(*this));
+}
+
+segment_key_filter segment_key_filter::from_iobuf(iobuf b) {
+    return serde::from_iobuf<segment_key_filter>(std::move(b));
+}
+
+void segment_key_filter_builder::add(const iobuf& key) {
+    if (_overflow) {
+        return;
+    }
+    if (_hashes.size() >= _max_keys) {
+        _overflow = true;
+        _hashes = {};
+        return;
+    }
+    _hashes.push_back(segment_key_filter::hash_key(key));
+}
+
+std::optional<segment_key_filter> segment_key_filter_builder::build() const {
+    if (_overflow) {
+        return std::nullopt;
+    }
+    segment_key_filter f(_hashes.size());
+    for (auto h : _hashes) {
+        f.add(h);
+    }
+    return f;
+}
+
+std::filesystem::path
+generate_key_filter_path(const cloud_storage::remote_segment_path& p) {
+    return fmt::format("{}.keys", p().native());
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/types.h"
+#include "serde/envelope.h"
+#include "utils/fragmented_vector.h"
+
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace cloud_storage {
+
+/// Bloom filter of the record keys of an uploaded segment
+///
+/// The filter is uploaded next to the segment index and lets key lookups
+/// skip the segments which can't contain the key without downloading them.
+/// False positives are possible, false negatives are not.
+class segment_key_filter
+  : public serde::envelope<
+      segment_key_filter,
+      serde::version<0>,
+      serde::compat_version<0>> {
+public:
+    /// Roughly 1% false positive rate
+    static constexpr size_t bits_per_key = 10;
+    static constexpr uint32_t default_num_hashes = 7;
+
+    segment_key_filter() = default;
+
+    /// Create an empty filter sized for \p num_keys keys
+    explicit segment_key_filter(size_t num_keys);
+
+    static uint64_t hash_key(const iobuf& key);
+    static uint64_t hash_key(std::string_view key);
+
+    /// Add a key using its hash_key() hash
+    void add(uint64_t key_hash);
+
+    bool may_contain(uint64_t key_hash) const;
+    bool may_contain(std::string_view key) const {
+        return may_contain(hash_key(key));
+    }
+
+    size_t size_bits() const { return _bits.size() * 64; }
+
+    iobuf to_iobuf() &&;
+    static segment_key_filter from_iobuf(iobuf);
+
+    auto serde_fields() { return std::tie(_num_hashes, _bits); }
+
+private:
+    uint32_t _num_hashes{default_num_hashes};
+    std::vector<uint64_t> _bits;
+};
+
+/// Collects the key hashes of a segment while it is being scanned and sizes
+/// the filter once the number of keys is known.
+class segment_key_filter_builder {
+public:
+    /// \param max_keys is a limit on the number of collected keys, no filter
+    ///        is built for segments with more keys
+    explicit segment_key_filter_builder(size_t max_keys)
+      : _max_keys(max_keys) {}
+
+    void add(const iobuf& key);
+
+    /// Return the filter or nullopt if the segment has too many keys
+    std::optional<segment_key_filter> build() const;
+
+private:
+    size_t _max_keys;
+    bool _overflow{false};
+    fragmented_vector<uint64_t> _hashes;
+};
+
+/// Path of the key filter of the segment
+std::filesystem::path
+generate_key_filter_path(const cloud_storage::remote_segment_path& p);
+
+} // namespace cloud_storage
@@ -542,6 +542,24 @@ public:
           ix, std::get<static_cast<size_t>(col_index)>(h.value()));
     }
 
+    /// Return the base_offset column position of the closest sampled row
+    /// whose base offset is lower or equal to 'bo'. Searches starting from
+    /// it only decode the rows of the frame that follow it, instead of the
+    /// whole frame.
+    std::optional<counter_col_t::hint_t>
+    base_offset_search_hint(int64_t bo) const {
+        if (unlikely(config::shard_local_cfg()
+                       .storage_ignore_cstore_hints.value())) {
+            return std::nullopt;
+        }
+        auto hint_it = _hints.lower_bound(bo);
+        if (hint_it == _hints.end() || hint_it->second == std::nullopt) {
+            return std::nullopt;
+        }
+        return std::get<static_cast<size_t>(segment_meta_ix::base_offset)>(
+          hint_it->second.value());
+    }
+
     /// Materialize 'segment_meta' struct from column iterator
     ///
     ///
@@ -624,19 +642,24 @@ public:
 
     /// Search by base_offset
     auto find(int64_t bo) const {
-        auto it = _base_offset.find(bo);
+        auto hint = base_offset_search_hint(bo);
+        auto it = hint ? _base_offset.find(bo, *hint) : _base_offset.find(bo);
         return materialize(std::move(it));
     }
 
     /// Search by base_offset
     auto lower_bound(int64_t bo) const {
-        auto it = _base_offset.lower_bound(bo);
+        auto hint = base_offset_search_hint(bo);
+        auto it = hint ? _base_offset.lower_bound(bo, *hint)
+                       : _base_offset.lower_bound(bo);
         return materialize(std::move(it));
     }
 
     /// Search by base_offset
     auto upper_bound(int64_t bo) const -> iterators_t {
-        auto it = _base_offset.upper_bound(bo);
+        auto hint = base_offset_search_hint(bo);
+        auto it = hint ? _base_offset.upper_bound(bo, *hint)
+                       : _base_offset.upper_bound(bo);
         return materialize(std::move(it));
     }
 
@@ -879,9 +879,30 @@ public:
     using delta_alg = details::delta_delta<value_t>;
     using base_t::base_t;
     using typename base_t::const_iterator;
+    using typename base_t::hint_t;
+    using base_t::find;
+    using base_t::lower_bound;
+    using base_t::upper_bound;
+
+    /// Search operations that start decoding the matching frame at 'hint'
+    /// instead of its first row. The 'hint' has to correspond to a value
+    /// lower or equal to the searched one, otherwise it's ignored.
+    const_iterator find(value_t value, const hint_t& hint) const {
+        return pred_search(value, std::equal_to<>{}, hint);
+    }
+
+    const_iterator upper_bound(value_t value, const hint_t& hint) const {
+        return pred_search(value, std::greater<>{}, hint);
+    }
+
+    const_iterator lower_bound(value_t value, const hint_t& hint) const {
+        return pred_search(value, std::greater_equal<>{}, hint);
+    }
 
     const_iterator pred_search(
-      value_t value, std::regular_invocable<value_t, value_t> auto pred) const {
+      value_t value,
+      std::regular_invocable<value_t, value_t> auto pred,
+      const std::optional<hint_t>& hint = std::nullopt) const {
         auto it = this->_frames.begin();
         size_t index = 0;
         for (; it != this->_frames.end(); ++it) {
@@ -894,7 +915,17 @@ public:
             index += it->size();
         }
         if (it != this->_frames.end()) {
-            auto start = const_iterator(it, this->_frames.end(), 0, index);
+            // the values are strictly increasing so every row before the
+            // hint is below the searched value and can be skipped. a hint
+            // from another frame is rejected by is_applicable.
+            auto start = [&] {
+                if (hint.has_value() && it->is_applicable(*hint)) {
+                    auto inner = hint->num_rows * details::FOR_buffer_depth;
+                    return const_iterator(
+                      it, this->_frames.end(), inner, *hint, index + inner);
+                }
+                return const_iterator(it, this->_frames.end(), 0, index);
+            }();
             for (; start != this->end(); ++start) {
                 if (pred(*start, value)) {
                     return start;
@@ -1025,8 +1056,14 @@ public:
     /// a new start offset.
     void prefix_truncate(model::offset);
 
+    /// Load the store from its serialized form. The serialized form is the
+    /// list of delta-FOR frames of every column followed by the hints, so
+    /// the encoded frames share the fragments of \p in and no row is
+    /// decoded. Only the frame and hint headers are parsed.
     void from_iobuf(iobuf in);
 
+    /// Serialize the store. The returned buffer shares the encoded frames
+    /// of the columns instead of copying them.
     iobuf to_iobuf() const;
 
     void flush_write_buffer();
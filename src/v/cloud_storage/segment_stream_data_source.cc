@@ -0,0 +1,115 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/segment_stream_data_source.h"
+
+#include "cloud_storage/cache_service.h"
+#include "cloud_storage/logger.h"
+#include "cloud_storage/remote_segment.h"
+#include "ssx/future-util.h"
+
+namespace cloud_storage {
+
+stream_data_source_impl::stream_data_source_impl(
+  remote_segment& segment,
+  uint64_t begin,
+  uint64_t end,
+  size_t max_buffered_bytes)
+  : _segment(segment)
+  , _begin(begin)
+  , _end(end)
+  , _max_buffered_bytes(std::max<size_t>(max_buffered_bytes, 1))
+  // buffer sizes are bounded by the semaphore, not the number of buffers
+  , _buffers(std::numeric_limits<size_t>::max())
+  , _buffer_units(_max_buffered_bytes, "cst::stream_read")
+  , _rtc{_as, cache_hydration_timeout, cache_hydration_backoff}
+  , _ctxlog{cst_log, _rtc, _segment.get_segment_path()().native()} {
+    vlog(
+      _ctxlog.trace,
+      "stream data source initialized with file position {} to {}",
+      _begin,
+      _end);
+}
+
+ss::future<ss::temporary_buffer<char>> stream_data_source_impl::get() {
+    auto g = _gate.hold();
+
+    if (!_started) {
+        _started = true;
+        ssx::spawn_with_gate(_gate, [this] {
+            return download().handle_exception(
+              [this](const std::exception_ptr& e) {
+                  vlog(_ctxlog.debug, "streaming download failed: {}", e);
+                  _buffers.abort(e);
+              });
+        });
+    }
+
+    auto buf = co_await _buffers.pop_eventually();
+    _buffer_units.signal(buffer_units(buf));
+    co_return buf;
+}
+
+ss::future<> stream_data_source_impl::download() {
+    co_await _segment.download_range(
+      _begin,
+      _end,
+      [this](uint64_t content_length, ss::input_stream<char> stream) {
+          return consume(content_length, std::move(stream));
+      },
+      _rtc);
+    // an empty buffer marks the end of the stream
+    _buffers.push(ss::temporary_buffer<char>{});
+}
+
+ss::future<uint64_t> stream_data_source_impl::consume(
+  uint64_t content_length, ss::input_stream<char> stream) {
+    // A retried download starts over from the beginning of the range
+    uint64_t skip = _produced;
+    std::exception_ptr eptr;
+    try {
+        while (true) {
+            _as.check();
+            auto buf = co_await stream.read();
+            if (buf.empty()) {
+                break;
+            }
+            if (skip > 0) {
+                const auto n = std::min<uint64_t>(skip, buf.size());
+                buf.trim_front(n);
+                skip -= n;
+                if (buf.empty()) {
+                    continue;
+                }
+            }
+            co_await _buffer_units.wait(buffer_units(buf));
+            _produced += buf.size();
+            _buffers.push(std::move(buf));
+        }
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await stream.close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+    co_return content_length;
+}
+
+ss::future<> stream_data_source_impl::close() {
+    vlog(_ctxlog.debug, "closing stream data source");
+    _as.request_abort();
+    const auto ex = std::make_exception_ptr(ss::abort_requested_exception{});
+    _buffer_units.broken(ex);
+    _buffers.abort(ex);
+    co_await _gate.close();
+}
+
+} // namespace cloud_storage
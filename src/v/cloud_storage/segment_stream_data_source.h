@@ -0,0 +1,81 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "ssx/semaphore.h"
+#include "utils/retry_chain_node.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/queue.hh>
+
+namespace cloud_storage {
+
+class remote_segment;
+
+/// Data source which serves a byte range of a remote segment straight from
+/// the object storage response, without writing it to the cache.
+///
+/// The download runs in the background and is decoupled from the reader by a
+/// buffer of at most `max_buffered_bytes`, so a slow consumer applies back
+/// pressure to the HTTP stream instead of growing memory use. If the
+/// download is retried the bytes already handed to the reader are skipped.
+class stream_data_source_impl final : public ss::data_source_impl {
+public:
+    stream_data_source_impl(
+      remote_segment& segment,
+      uint64_t begin,
+      uint64_t end,
+      size_t max_buffered_bytes);
+
+    stream_data_source_impl(const stream_data_source_impl&) = delete;
+    stream_data_source_impl& operator=(const stream_data_source_impl&)
+      = delete;
+    stream_data_source_impl(stream_data_source_impl&&) = delete;
+    stream_data_source_impl& operator=(stream_data_source_impl&&) = delete;
+
+    ~stream_data_source_impl() override = default;
+
+    ss::future<ss::temporary_buffer<char>> get() override;
+
+    ss::future<> close() override;
+
+private:
+    ss::future<> download();
+
+    // Consumes one attempt of the download, pushing the response body into
+    // the buffer queue.
+    ss::future<uint64_t> consume(uint64_t, ss::input_stream<char>);
+
+    size_t buffer_units(const ss::temporary_buffer<char>& buf) const {
+        return std::min(buf.size(), _max_buffered_bytes);
+    }
+
+    remote_segment& _segment;
+    uint64_t _begin;
+    uint64_t _end;
+    size_t _max_buffered_bytes;
+
+    // Bytes pushed to the queue by all download attempts so far
+    uint64_t _produced{0};
+    bool _started{false};
+
+    ss::queue<ss::temporary_buffer<char>> _buffers;
+    ssx::semaphore _buffer_units;
+
+    ss::gate _gate;
+    ss::abort_source _as;
+    retry_chain_node _rtc;
+    retry_chain_logger _ctxlog;
+};
+
+} // namespace cloud_storage
@@ -15,9 +15,11 @@
 #include "cloud_storage/remote.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cloud_storage/types.h"
+#include "config/configuration.h"
 #include "http/tests/http_imposter.h"
 #include "test_utils/fixture.h"
 
+#include <seastar/util/defer.hh>
 #include <seastar/util/short_streams.hh>
 
 #include <boost/test/tools/old/interface.hpp>
@@ -547,6 +549,26 @@ FIXTURE_TEST(test_missing_segments, bucket_view_fixture) {
       result.detected, flatten_partial_results(partial_results).detected);
 }
 
+FIXTURE_TEST(test_sampled_segment_checks, bucket_view_fixture) {
+    init_view(
+      stm_manifest, {spillover_manifest_at_0, spillover_manifest_at_20});
+
+    const auto full = run_detector(archival::run_quota_t{100});
+    BOOST_REQUIRE_EQUAL(full.status, cloud_storage::scrub_status::full);
+
+    auto& sample_percent = config::shard_local_cfg()
+                             .cloud_storage_scrubbing_segment_sample_percent;
+    sample_percent.set_value(uint16_t{1});
+    auto reset = ss::defer([&sample_percent] { sample_percent.reset(); });
+
+    // Every segment is still scrubbed, but few of them are looked up
+    const auto sampled = run_detector(archival::run_quota_t{100});
+    BOOST_REQUIRE_EQUAL(sampled.status, cloud_storage::scrub_status::full);
+    BOOST_REQUIRE(!sampled.detected.has_value());
+    BOOST_REQUIRE(!sampled.last_scrubbed_offset.has_value());
+    BOOST_REQUIRE_LT(sampled.ops, full.ops);
+}
+
 FIXTURE_TEST(test_missing_spillover_manifest, bucket_view_fixture) {
     init_view(
       stm_manifest, {spillover_manifest_at_0, spillover_manifest_at_20});
@@ -19,6 +19,7 @@
 #include "model/metadata.h"
 #include "model/timeout_clock.h"
 #include "model/timestamp.h"
+#include "test_utils/async.h"
 #include "test_utils/fixture.h"
 #include "utils/retry_chain_node.h"
 
@@ -431,6 +432,37 @@ FIXTURE_TEST(test_async_manifest_view_iter, async_manifest_view_fixture) {
     BOOST_REQUIRE(expected == actual);
 }
 
+FIXTURE_TEST(test_async_manifest_view_prefetch, async_manifest_view_fixture) {
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    listen();
+
+    auto& manifest_cache
+      = api.local().materialized().get_materialized_manifest_cache();
+    auto cursor = view.get_cursor(spillover_start_offsets.front()).get();
+    BOOST_REQUIRE(cursor.has_value());
+
+    // The manifest after the one the cursor points to is materialized
+    // while the reader is busy with the current one
+    auto next_key = std::make_tuple(manifest_ntp, spillover_start_offsets[1]);
+    tests::cooperative_spin_wait_with_timeout(10s, [&] {
+        return manifest_cache.contains(next_key);
+    }).get();
+
+    BOOST_REQUIRE(cursor.value()->next().get().value() == eof::no);
+    cursor.value()
+      ->with_manifest([this](const partition_manifest& m) {
+          BOOST_REQUIRE_EQUAL(
+            m.get_start_offset().value(), spillover_start_offsets[1]);
+      })
+      .get();
+    auto last_key = std::make_tuple(manifest_ntp, spillover_start_offsets[2]);
+    tests::cooperative_spin_wait_with_timeout(10s, [&] {
+        return manifest_cache.contains(last_key);
+    }).get();
+}
+
 FIXTURE_TEST(test_async_manifest_view_truncate, async_manifest_view_fixture) {
     // Check archive truncation
     std::vector<segment_meta> expected;
@@ -13,6 +13,8 @@
 #include "cache_test_fixture.h"
 #include "cloud_storage/access_time_tracker.h"
 #include "cloud_storage/cache_service.h"
+#include "hashing/xx.h"
+#include "serde/serde.h"
 #include "test_utils/fixture.h"
 #include "units.h"
 #include "utils/file_io.h"
@@ -27,6 +29,7 @@
 
 #include <chrono>
 #include <fstream>
+#include <map>
 #include <stdexcept>
 
 using namespace cloud_storage;
@@ -425,6 +428,97 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_serializer_large) {
     BOOST_REQUIRE_EQUAL(out.size(), item_count);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_read_legacy) {
+    // The version 0 format serialized every entry as a fixed size pair
+    struct legacy_header
+      : serde::envelope<
+          legacy_header,
+          serde::version<0>,
+          serde::compat_version<0>> {
+        size_t table_size{0};
+
+        auto serde_fields() { return std::tie(table_size); }
+    };
+
+    std::vector<ss::sstring> names;
+    std::map<uint32_t, uint32_t> table;
+    for (uint32_t i = 0; i < 3000; i++) {
+        names.push_back(fmt::format("key{:08x}", i));
+        table[xxhash_32(names.back().data(), names.back().size())]
+          = 1653000000 + i;
+    }
+
+    iobuf serialized;
+    serde::write(serialized, legacy_header{.table_size = table.size()});
+    for (const auto& [hash, ts] : table) {
+        serde::write(serialized, hash);
+        serde::write(serialized, ts);
+    }
+
+    access_time_tracker out;
+    auto in_stream = make_iobuf_input_stream(std::move(serialized));
+    out.read(in_stream).get();
+
+    BOOST_REQUIRE_EQUAL(out.size(), names.size());
+    for (uint32_t i = 0; i < names.size(); i++) {
+        BOOST_REQUIRE(
+          out.estimate_timestamp(names[i]) == make_ts(1653000000 + i));
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_delta_encoding) {
+    access_time_tracker in;
+
+    uint32_t item_count = 10000;
+    for (uint32_t i = 0; i < item_count; i++) {
+        in.add_timestamp(fmt::format("key{:08x}", i), make_ts(1653000000 + i));
+    }
+
+    iobuf serialized;
+    auto out_stream = make_iobuf_ref_output_stream(serialized);
+    in.write(out_stream).get();
+    out_stream.flush().get();
+
+    // well below the 8 bytes per entry of the fixed size encoding
+    BOOST_REQUIRE_LT(serialized.size_bytes(), item_count * 6);
+
+    auto out = serde_roundtrip(in);
+    BOOST_REQUIRE_EQUAL(out.size(), item_count);
+    for (uint32_t i = 0; i < item_count; i++) {
+        auto key = fmt::format("key{:08x}", i);
+        BOOST_REQUIRE(
+          out.estimate_timestamp(key) == in.estimate_timestamp(key));
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_sort_oldest_trim_candidates) {
+    fragmented_vector<file_list_item> candidates;
+    for (uint64_t i = 0; i < 5000; i++) {
+        // access times in a scrambled order
+        candidates.push_back(file_list_item{
+          .access_time = make_ts((i * 7919) % 5000),
+          .path = fmt::format("file{}", i),
+          .size = 1_MiB});
+    }
+
+    // 10MiB out of 5000MiB: the estimate needs a small fraction of the list
+    const auto n = trim_candidates_to_sort(
+      candidates.size(), 5000 * 1_MiB, 10_MiB, 0);
+    BOOST_REQUIRE_GE(n, 11);
+    BOOST_REQUIRE_LT(n, candidates.size());
+    BOOST_REQUIRE_EQUAL(
+      trim_candidates_to_sort(candidates.size(), 5000 * 1_MiB, 5000_MiB, 0),
+      candidates.size());
+
+    sort_oldest_candidates(candidates, n);
+    for (size_t i = 0; i < n; i++) {
+        BOOST_REQUIRE(candidates[i].access_time == make_ts(i));
+    }
+    for (size_t i = n; i < candidates.size(); i++) {
+        BOOST_REQUIRE(candidates[i].access_time >= make_ts(n));
+    }
+}
+
 /**
  * Validate that .part files and empty directories are deleted if found during
  * the startup walk of the cache.
@@ -538,3 +632,43 @@ FIXTURE_TEST(test_log_segment_cleanup, cache_test_fixture) {
           return !std::filesystem::exists(path);
       }));
 }
+
+FIXTURE_TEST(test_walk_summary_roundtrip, cache_test_fixture) {
+    put_into_cache(create_data_string('a', 1_KiB), KEY);
+    put_into_cache(create_data_string('b', 2_KiB), KEY2);
+    const auto usage_bytes = sharded_cache.local().get_usage_bytes();
+    const auto usage_objects = sharded_cache.local().get_usage_objects();
+
+    save_walk_summary().get();
+    BOOST_REQUIRE(ss::file_exists((CACHE_DIR / "walksummary").native()).get());
+
+    // Loading restores the saved usage and consumes the summary, so that a
+    // later unclean restart walks the directory again.
+    BOOST_REQUIRE(load_walk_summary().get());
+    BOOST_REQUIRE(
+      !ss::file_exists((CACHE_DIR / "walksummary").native()).get());
+    BOOST_REQUIRE_EQUAL(sharded_cache.local().get_usage_bytes(), usage_bytes);
+    BOOST_REQUIRE_EQUAL(
+      sharded_cache.local().get_usage_objects(), usage_objects);
+    BOOST_REQUIRE(!load_walk_summary().get());
+}
+
+FIXTURE_TEST(test_hydration_claims, cache_test_fixture) {
+    auto& cache = sharded_cache.local();
+    auto first = cache.claim_hydration(KEY).get();
+    BOOST_REQUIRE(!first.waited());
+
+    // concurrent claims of the same key wait for the first one, the claims
+    // of other keys don't
+    auto second = cache.claim_hydration(KEY);
+    auto other = cache.claim_hydration(KEY2).get();
+    BOOST_REQUIRE(!other.waited());
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!second.available());
+
+    {
+        auto released = std::move(first);
+    }
+    auto claim = second.get();
+    BOOST_REQUIRE(claim.waited());
+}
@@ -107,6 +107,14 @@ public:
         return sharded_cache.local().clean_up_at_start();
     }
 
+    ss::future<> save_walk_summary() {
+        return sharded_cache.local().save_walk_summary();
+    }
+
+    ss::future<bool> load_walk_summary() {
+        return sharded_cache.local().load_walk_summary();
+    }
+
     void trim_cache(
       std::optional<uint64_t> size_limit_override = std::nullopt,
       std::optional<size_t> object_limit_override = std::nullopt) {
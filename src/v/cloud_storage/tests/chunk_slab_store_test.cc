@@ -0,0 +1,141 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
+#include "cloud_storage/chunk_slab_store.h"
+#include "random/generators.h"
+#include "test_utils/tmp_dir.h"
+#include "units.h"
+
+#include <seastar/core/fstream.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace cloud_storage;
+
+namespace {
+
+constexpr uint64_t slab_size = 64_KiB;
+
+ss::sstring make_chunk(size_t size) {
+    return random_generators::gen_alphanum_string(size);
+}
+
+bool put(chunk_slab_store& store, const ss::sstring& key, ss::sstring data) {
+    iobuf buf;
+    buf.append(data.data(), data.size());
+    auto stream = make_iobuf_input_stream(std::move(buf));
+    auto stored = store
+                    .put(
+                      key,
+                      stream,
+                      data.size(),
+                      ss::default_priority_class(),
+                      4_KiB,
+                      1)
+                    .get();
+    stream.close().get();
+    return stored;
+}
+
+ss::sstring read(ss::file f, uint64_t size) {
+    auto stream = ss::make_file_input_stream(f);
+    auto buf = read_iobuf_exactly(stream, size + 1).get();
+    stream.close().get();
+    f.close().get();
+    auto out = ss::uninitialized_string(buf.size_bytes());
+    iobuf::iterator_consumer(buf.cbegin(), buf.cend())
+      .consume_to(buf.size_bytes(), out.data());
+    return out;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_slab_store_put_get) {
+    temporary_dir dir("chunk_slab_store");
+    chunk_slab_store store(dir.get_path(), slab_size, 2);
+    BOOST_REQUIRE_EQUAL(store.start().get(), 2 * slab_size);
+
+    auto data = make_chunk(10000);
+    BOOST_REQUIRE(put(store, "seg_chunks/0", data));
+    BOOST_REQUIRE(store.contains("seg_chunks/0"));
+    BOOST_REQUIRE(!store.get("seg_chunks/1").get().has_value());
+
+    auto chunk = store.get("seg_chunks/0").get();
+    BOOST_REQUIRE(chunk.has_value());
+    BOOST_REQUIRE_EQUAL(chunk->second, data.size());
+    BOOST_REQUIRE_EQUAL(chunk->first.size().get(), data.size());
+    BOOST_REQUIRE(read(chunk->first, chunk->second) == data);
+
+    // larger than a slab
+    BOOST_REQUIRE(!put(store, "seg_chunks/1", make_chunk(slab_size + 1)));
+
+    BOOST_REQUIRE(store.invalidate("seg_chunks/0").get());
+    BOOST_REQUIRE(!store.contains("seg_chunks/0"));
+    BOOST_REQUIRE(!store.invalidate("seg_chunks/0").get());
+    store.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_slab_store_reuse) {
+    temporary_dir dir("chunk_slab_store");
+    chunk_slab_store store(dir.get_path(), slab_size, 2);
+    store.start().get();
+
+    // two chunks per slab
+    for (int i = 0; i < 4; ++i) {
+        BOOST_REQUIRE(
+          put(store, fmt::format("seg_chunks/{}", i), make_chunk(30_KiB)));
+    }
+    BOOST_REQUIRE_EQUAL(store.chunks(), 4);
+    BOOST_REQUIRE_EQUAL(store.active_slab(), 1);
+
+    // the first slab is reused and its chunks dropped
+    BOOST_REQUIRE(put(store, "seg_chunks/4", make_chunk(30_KiB)));
+    BOOST_REQUIRE_EQUAL(store.active_slab(), 0);
+    BOOST_REQUIRE(!store.contains("seg_chunks/0"));
+    BOOST_REQUIRE(!store.contains("seg_chunks/1"));
+    BOOST_REQUIRE(store.contains("seg_chunks/2"));
+
+    // a slab held by a reader isn't reused
+    auto held = store.get("seg_chunks/2").get();
+    BOOST_REQUIRE(held.has_value());
+    BOOST_REQUIRE(put(store, "seg_chunks/5", make_chunk(30_KiB)));
+    BOOST_REQUIRE(!put(store, "seg_chunks/6", make_chunk(30_KiB)));
+    held->first.close().get();
+    BOOST_REQUIRE(put(store, "seg_chunks/6", make_chunk(30_KiB)));
+    BOOST_REQUIRE(!store.contains("seg_chunks/2"));
+    store.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_slab_store_restart) {
+    temporary_dir dir("chunk_slab_store");
+    auto data = make_chunk(5000);
+    {
+        chunk_slab_store store(dir.get_path(), slab_size, 2);
+        store.start().get();
+        BOOST_REQUIRE(put(store, "seg_chunks/0", data));
+        store.stop().get();
+    }
+    {
+        chunk_slab_store store(dir.get_path(), slab_size, 2);
+        BOOST_REQUIRE_EQUAL(store.start().get(), 0);
+        auto chunk = store.get("seg_chunks/0").get();
+        BOOST_REQUIRE(chunk.has_value());
+        BOOST_REQUIRE(read(chunk->first, chunk->second) == data);
+        store.stop().get();
+    }
+    {
+        // the chunks of a different layout are dropped
+        chunk_slab_store store(dir.get_path(), slab_size, 3);
+        BOOST_REQUIRE_EQUAL(store.start().get(), slab_size);
+        BOOST_REQUIRE(!store.contains("seg_chunks/0"));
+        store.stop().get();
+    }
+}
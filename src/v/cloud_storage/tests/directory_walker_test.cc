@@ -192,3 +192,37 @@ SEASTAR_THREAD_TEST_CASE(total_size_correct) {
     BOOST_REQUIRE_EQUAL(result.filtered_out_files, 2);
     BOOST_REQUIRE_EQUAL(result.regular_files.size(), 3);
 }
+
+SEASTAR_THREAD_TEST_CASE(many_directories) {
+    temporary_dir tmpdir("directory-walker");
+    cloud_storage::recursive_directory_walker _walker;
+    const std::filesystem::path target_dir = tmpdir.get_path();
+
+    // More directories and files per directory than the walker visits
+    // concurrently
+    std::set<std::string> expect;
+    uint64_t expect_size = 0;
+    for (int d = 0; d < 40; ++d) {
+        const auto dir = target_dir / fmt::format("d{}", d) / "sub";
+        ss::recursive_touch_directory(dir.native()).get();
+        for (int f = 0; f < 40; ++f) {
+            const auto path = dir / fmt::format("file{}", f);
+            auto file = ss::open_file_dma(
+                          path.native(),
+                          ss::open_flags::wo | ss::open_flags::create)
+                          .get();
+            write_to_file(file, d + f);
+            expect.insert(path.native());
+            expect_size += d + f;
+        }
+    }
+    ss::recursive_touch_directory((target_dir / "empty").native()).get();
+
+    access_time_tracker tracker;
+    auto result = _walker.walk(target_dir.native(), tracker).get();
+
+    BOOST_REQUIRE_EQUAL(result.cache_size, expect_size);
+    BOOST_REQUIRE_EQUAL(result.regular_files.size(), expect.size());
+    BOOST_REQUIRE(result_paths(result) == expect);
+    BOOST_REQUIRE_EQUAL(result.empty_dirs.size(), 1);
+}
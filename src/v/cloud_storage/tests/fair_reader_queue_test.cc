@@ -0,0 +1,83 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/fair_reader_queue.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <vector>
+
+using namespace cloud_storage;
+
+SEASTAR_THREAD_TEST_CASE(test_fair_reader_queue_unlimited) {
+    fair_reader_queue q;
+    auto u1 = q.get_units("scan", std::nullopt).get();
+    auto u2 = q.get_units("scan", std::nullopt).get();
+    BOOST_REQUIRE_EQUAL(q.outstanding(), 2);
+    BOOST_REQUIRE_EQUAL(q.held_by("scan"), 2);
+    u1.reset();
+    u2.reset();
+    BOOST_REQUIRE_EQUAL(q.outstanding(), 0);
+    BOOST_REQUIRE_EQUAL(q.held_by("scan"), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_fair_reader_queue_admits_fewest_held) {
+    fair_reader_queue q;
+    q.set_capacity(2);
+    std::vector<fair_reader_queue::units> scan;
+    scan.push_back(q.get_units("scan", std::nullopt).get());
+    scan.push_back(q.get_units("scan", std::nullopt).get());
+
+    // the scan queues more readers before the interactive client arrives
+    auto scan_next = q.get_units("scan", std::nullopt);
+    auto interactive = q.get_units("interactive", std::nullopt);
+    BOOST_REQUIRE_EQUAL(q.waiters(), 2);
+
+    // the interactive client holds no slot so it goes first
+    scan.pop_back();
+    BOOST_REQUIRE_EQUAL(q.held_by("interactive"), 1);
+    BOOST_REQUIRE_EQUAL(q.held_by("scan"), 1);
+    BOOST_REQUIRE_EQUAL(q.waiters(), 1);
+    auto i = interactive.get();
+
+    scan.pop_back();
+    BOOST_REQUIRE_EQUAL(q.held_by("scan"), 1);
+    BOOST_REQUIRE_EQUAL(q.waiters(), 0);
+    auto s = scan_next.get();
+    BOOST_REQUIRE_EQUAL(q.outstanding(), 2);
+    i.reset();
+    s.reset();
+    BOOST_REQUIRE_EQUAL(q.outstanding(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_fair_reader_queue_abort_and_stop) {
+    fair_reader_queue q;
+    q.set_capacity(1);
+    auto held = q.get_units("a", std::nullopt).get();
+
+    ss::abort_source as;
+    auto aborted = q.get_units("b", as);
+    as.request_abort();
+    BOOST_REQUIRE_THROW(aborted.get(), ss::abort_requested_exception);
+    BOOST_REQUIRE_EQUAL(q.waiters(), 0);
+
+    // raising the capacity admits the waiters
+    auto waiting = q.get_units("b", std::nullopt);
+    BOOST_REQUIRE_EQUAL(q.waiters(), 1);
+    q.set_capacity(2);
+    BOOST_REQUIRE_EQUAL(q.waiters(), 0);
+    auto admitted = waiting.get();
+    BOOST_REQUIRE_EQUAL(q.outstanding(), 2);
+
+    auto stopped = q.get_units("c", std::nullopt);
+    q.stop();
+    BOOST_REQUIRE_THROW(stopped.get(), ss::gate_closed_exception);
+}
@@ -431,6 +431,116 @@ SEASTAR_THREAD_TEST_CASE(test_segment_contains_by_kafka_offset) {
     BOOST_REQUIRE(check_no_offset(full_manifest, kafka::offset(15)));
 }
 
+SEASTAR_THREAD_TEST_CASE(test_segment_contains_by_kafka_offset_after_update) {
+    const auto check_offset = [](
+                                const partition_manifest& m,
+                                kafka::offset ko,
+                                model::offset expected_base_mo) {
+        const auto it = m.segment_containing(ko);
+        BOOST_REQUIRE(it != m.end());
+        BOOST_REQUIRE_EQUAL(it->base_offset, expected_base_mo);
+        BOOST_REQUIRE_LE(it->base_kafka_offset(), ko);
+        BOOST_REQUIRE_GT(it->next_kafka_offset(), ko);
+    };
+
+    // mo: 0      10     20     30
+    //     [a    ][b    ][c    ]end
+    // ko: 0      5      10     15
+    partition_manifest m = manifest_for({
+      {model::offset(0), kafka::offset(0)},
+      {model::offset(10), kafka::offset(5)},
+      {model::offset(20), kafka::offset(10)},
+      {model::offset(30), kafka::offset(15)},
+    });
+    check_offset(m, kafka::offset(12), model::offset(20));
+    BOOST_REQUIRE(m.segment_containing(kafka::offset(15)) == m.end());
+
+    // Segments appended after a lookup are found too.
+    // mo: 30     40      100
+    //     [d    ][e     ]end
+    // ko: 15     16      70
+    for (auto [base, last, delta, delta_end] :
+         {std::tuple{30, 39, 15, 24}, std::tuple{40, 99, 24, 30}}) {
+        m.add(
+          segment_name(fmt::format("{}-1-v1.log", base)),
+          segment_meta{
+            .is_compacted = false,
+            .size_bytes = 1024,
+            .base_offset = model::offset(base),
+            .committed_offset = model::offset(last),
+            .delta_offset = model::offset_delta(delta),
+            .delta_offset_end = model::offset_delta(delta_end),
+          });
+    }
+    check_offset(m, kafka::offset(12), model::offset(20));
+    check_offset(m, kafka::offset(15), model::offset(30));
+    check_offset(m, kafka::offset(16), model::offset(40));
+    check_offset(m, kafka::offset(69), model::offset(40));
+    BOOST_REQUIRE(m.segment_containing(kafka::offset(70)) == m.end());
+
+    // Removing segments from the front rebuilds the index.
+    BOOST_REQUIRE(m.advance_start_offset(model::offset(30)));
+    m.truncate();
+    BOOST_REQUIRE(m.segment_containing(kafka::offset(12)) == m.end());
+    check_offset(m, kafka::offset(15), model::offset(30));
+    check_offset(m, kafka::offset(20), model::offset(40));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_first_kafka_offset_after_term) {
+    partition_manifest m;
+    m.update(manifest_format::json, make_manifest_stream(empty_manifest_json))
+      .get();
+    // mo: 0      10     20     30     40
+    //     [a:1  ][b:1  ][c:3  ][d:4  ]end
+    // ko: 0      5      10     15
+    for (auto [base, delta, term] :
+         {std::tuple{0, 0, 1},
+          std::tuple{10, 5, 1},
+          std::tuple{20, 10, 3},
+          std::tuple{30, 15, 4}}) {
+        m.add(
+          segment_name(fmt::format("{}-{}-v1.log", base, term)),
+          segment_meta{
+            .is_compacted = false,
+            .size_bytes = 1024,
+            .base_offset = model::offset(base),
+            .committed_offset = model::offset(base + 9),
+            .delta_offset = model::offset_delta(delta),
+            .segment_term = model::term_id(term),
+            .delta_offset_end = model::offset_delta(delta + 5),
+          });
+    }
+    BOOST_REQUIRE_EQUAL(
+      m.first_kafka_offset_after_term(model::term_id(0)).value(),
+      kafka::offset(0));
+    BOOST_REQUIRE_EQUAL(
+      m.first_kafka_offset_after_term(model::term_id(1)).value(),
+      kafka::offset(10));
+    BOOST_REQUIRE_EQUAL(
+      m.first_kafka_offset_after_term(model::term_id(2)).value(),
+      kafka::offset(10));
+    BOOST_REQUIRE_EQUAL(
+      m.first_kafka_offset_after_term(model::term_id(3)).value(),
+      kafka::offset(15));
+    BOOST_REQUIRE(!m.first_kafka_offset_after_term(model::term_id(4)));
+
+    // Segments of a new term appended after a lookup are found too.
+    m.add(
+      segment_name("40-6-v1.log"),
+      segment_meta{
+        .is_compacted = false,
+        .size_bytes = 1024,
+        .base_offset = model::offset(40),
+        .committed_offset = model::offset(49),
+        .delta_offset = model::offset_delta(20),
+        .segment_term = model::term_id(6),
+        .delta_offset_end = model::offset_delta(25),
+      });
+    BOOST_REQUIRE_EQUAL(
+      m.first_kafka_offset_after_term(model::term_id(4)).value(),
+      kafka::offset(20));
+}
+
 SEASTAR_THREAD_TEST_CASE(test_segment_contains) {
     partition_manifest m;
     m.update(manifest_format::json, make_manifest_stream(manifest_with_gaps))
@@ -2656,3 +2766,48 @@ SEASTAR_THREAD_TEST_CASE(test_last_partition_scrub_json_serde) {
 
     BOOST_REQUIRE(manifest == manifest_after_round_trip);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_manifest_delta) {
+    auto make_segment = [](int64_t base, int64_t last) {
+        return segment_meta{
+          .size_bytes = 100,
+          .base_offset = model::offset(base),
+          .committed_offset = model::offset(last),
+          .archiver_term = model::term_id(1),
+          .segment_term = model::term_id(1),
+          .sname_format = segment_name_format::v3};
+    };
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    m.add(make_segment(0, 99));
+    m.add(make_segment(100, 199));
+    m.advance_insync_offset(model::offset(10));
+
+    // reader side starts from the full manifest
+    partition_manifest reader(manifest_ntp, model::initial_revision_id(0));
+    reader.from_iobuf(m.to_iobuf());
+
+    const auto base_insync = m.get_insync_offset();
+    const auto base_last = m.get_last_offset();
+    const auto layout = m.layout_id();
+    m.add(make_segment(200, 299));
+    m.advance_start_offset(model::offset(100));
+    m.advance_insync_offset(model::offset(20));
+    BOOST_REQUIRE_EQUAL(m.layout_id(), layout);
+
+    auto delta = serde::from_iobuf<partition_manifest_delta>(
+      serde::to_iobuf(m.make_delta(base_insync, base_last)));
+    BOOST_REQUIRE_EQUAL(delta.segments.size(), 1);
+    BOOST_REQUIRE(reader.apply_delta(delta));
+    BOOST_REQUIRE(reader == m);
+
+    // deltas must chain with the version they were built against
+    BOOST_REQUIRE(!reader.apply_delta(delta));
+
+    // anything but an append changes the layout
+    m.add(make_segment(100, 299));
+    BOOST_REQUIRE_NE(m.layout_id(), layout);
+
+    BOOST_REQUIRE_EQUAL(
+      m.get_manifest_delta_path(model::offset(20)),
+      "20000000/meta/test-ns/test-topic/42_0/manifest.bin.delta.20");
+}
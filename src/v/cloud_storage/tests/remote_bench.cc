@@ -0,0 +1,179 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iostream.h"
+#include "cloud_storage/remote.h"
+#include "cloud_storage/tests/cloud_storage_fixture.h"
+#include "cloud_storage/tests/common_def.h"
+#include "cloud_storage/tests/util.h"
+#include "storage/segment_reader.h"
+#include "utils/hdr_hist.h"
+#include "utils/retry_chain_node.h"
+#include "vassert.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/lexical_cast.hpp>
+#include <fmt/core.h>
+
+#include <cstdlib>
+
+/*
+ * Benchmarks of the tiered storage read and write paths against the s3
+ * imposter, with the imposter emulating the latency, bandwidth and error rate
+ * of a remote object store:
+ *
+ *  - hydration: full scans of a remote_partition with an empty cache, every
+ *    segment being downloaded,
+ *  - cached_read: full scans of a remote_partition served by the cache,
+ *  - segment_upload: uploads of segments through remote.
+ *
+ * The cache hit rate, injected errors and upload latency percentiles are
+ * printed as a JSON line per test when the fixture is torn down.
+ *
+ * The setup is configured with environment variables:
+ *  - RP_BENCH_LATENCY_MS: latency added to every request (default 0)
+ *  - RP_BENCH_BANDWIDTH: bytes per second of the bodies (default unlimited)
+ *  - RP_BENCH_ERROR_PERMILLE: requests failed per thousand (default 0)
+ *  - RP_BENCH_SEGMENTS: segments of the partition (default 16)
+ *  - RP_BENCH_BATCHES_PER_SEGMENT: batches per segment (default 100)
+ */
+namespace {
+
+size_t env_or(const char* name, size_t def) {
+    const char* v = std::getenv(name);
+    if (v == nullptr) {
+        return def;
+    }
+    return boost::lexical_cast<size_t>(v);
+}
+
+const auto bench_bucket = cloud_storage_clients::bucket_name("bucket");
+
+cloud_storage::lazy_abort_source always_continue{
+  []() { return std::nullopt; }};
+
+ss::abort_source never_abort;
+
+} // namespace
+
+struct remote_bench_fixture : cloud_storage_fixture {
+    ss::sstring bench_name;
+    std::vector<in_memory_segment> segments;
+    hdr_hist upload_latency;
+    size_t uploads{0};
+    bool warm{false};
+
+    remote_bench_fixture() {
+        set_fault_injection({
+          .latency = std::chrono::milliseconds(
+            env_or("RP_BENCH_LATENCY_MS", 0)),
+          .bandwidth = env_or("RP_BENCH_BANDWIDTH", 0),
+          .error_rate = static_cast<double>(
+                          env_or("RP_BENCH_ERROR_PERMILLE", 0))
+                        / 1000.0,
+        });
+        segments = setup_s3_imposter(
+          *this,
+          static_cast<int>(env_or("RP_BENCH_SEGMENTS", 16)),
+          static_cast<int>(env_or("RP_BENCH_BATCHES_PER_SEGMENT", 100)));
+    }
+
+    remote_bench_fixture(const remote_bench_fixture&) = delete;
+    remote_bench_fixture& operator=(const remote_bench_fixture&) = delete;
+    remote_bench_fixture(remote_bench_fixture&&) = delete;
+    remote_bench_fixture& operator=(remote_bench_fixture&&) = delete;
+
+    ~remote_bench_fixture() {
+        if (bench_name.empty()) {
+            return;
+        }
+        const auto& probe = cache.local().get_probe();
+        auto hits = probe.num_cached_gets();
+        auto misses = probe.num_miss_gets();
+        auto lookups = hits + misses;
+        fmt::print(
+          "{{\"bench\": \"{}\", \"cache_hits\": {}, \"cache_misses\": {}, "
+          "\"cache_hit_rate\": {:.3f}, \"injected_errors\": {}, "
+          "\"uploads\": {}, \"upload_p50_us\": {}, \"upload_p99_us\": {}}}\n",
+          bench_name,
+          hits,
+          misses,
+          lookups == 0 ? 0.0
+                       : static_cast<double>(hits)
+                           / static_cast<double>(lookups),
+          injected_errors(),
+          uploads,
+          upload_latency.get_value_at(50.0),
+          upload_latency.get_value_at(99.0));
+    }
+
+    size_t scan() {
+        return scan_remote_partition(*this, model::offset(0)).size();
+    }
+
+    void upload(const in_memory_segment& s) {
+        auto name = segment_name(ssx::sformat("{}-1-v1.log", uploads++));
+        auto path = generate_remote_segment_path(
+          manifest_ntp, manifest_revision, name, model::term_id{1});
+        auto reset_stream = [&s]()
+          -> ss::future<std::unique_ptr<storage::stream_provider>> {
+            iobuf out;
+            out.append(s.bytes.data(), s.bytes.size());
+            co_return std::make_unique<storage::segment_reader_handle>(
+              make_iobuf_input_stream(std::move(out)));
+        };
+        retry_chain_node fib(never_abort, 60s, 100ms);
+        auto m = upload_latency.auto_measure();
+        auto res = api.local()
+                     .upload_segment(
+                       bench_bucket,
+                       path,
+                       s.bytes.size(),
+                       reset_stream,
+                       fib,
+                       always_continue)
+                     .get();
+        vassert(res == upload_result::success, "upload failed: {}", res);
+    }
+};
+
+PERF_TEST_F(remote_bench_fixture, hydration) {
+    bench_name = "hydration";
+    cache.local().trim_manually(0, 0).get();
+
+    perf_tests::start_measuring_time();
+    auto batches = scan();
+    perf_tests::stop_measuring_time();
+    return batches;
+}
+
+PERF_TEST_F(remote_bench_fixture, cached_read) {
+    bench_name = "cached_read";
+    if (!warm) {
+        scan();
+        warm = true;
+    }
+
+    perf_tests::start_measuring_time();
+    auto batches = scan();
+    perf_tests::stop_measuring_time();
+    return batches;
+}
+
+PERF_TEST_F(remote_bench_fixture, segment_upload) {
+    bench_name = "segment_upload";
+    const auto& s = segments[uploads % segments.size()];
+
+    perf_tests::start_measuring_time();
+    upload(s);
+    perf_tests::stop_measuring_time();
+    return s.bytes.size();
+}
@@ -172,12 +172,8 @@ FIXTURE_TEST(test_remote_segment_timeout, cloud_storage_fixture) { // NOLINT
     segment.stop().get();
 }
 
-void upload_index(
-  cloud_storage_fixture& f,
-  const partition_manifest::segment_meta& meta,
-  const iobuf& segment_bytes,
-  const remote_segment_path& path,
-  retry_chain_node& fib) {
+iobuf make_index(
+  const partition_manifest::segment_meta& meta, const iobuf& segment_bytes) {
     offset_index ix{
       meta.base_offset,
       meta.base_kafka_offset(),
@@ -194,7 +190,16 @@ void upload_index(
 
     builder->consume().get();
     builder->close().get();
-    auto ixbuf = ix.to_iobuf();
+    return ix.to_iobuf();
+}
+
+void upload_index(
+  cloud_storage_fixture& f,
+  const partition_manifest::segment_meta& meta,
+  const iobuf& segment_bytes,
+  const remote_segment_path& path,
+  retry_chain_node& fib) {
+    auto ixbuf = make_index(meta, segment_bytes);
     auto upload_res = f.api.local()
                         .upload_object(
                           bucket,
@@ -286,6 +291,86 @@ make_recording_batch_parser(
     return parser;
 }
 
+FIXTURE_TEST(
+  test_remote_segment_embedded_index, cloud_storage_fixture) { // NOLINT
+    set_expectations_and_listen({});
+    partition_manifest m(manifest_ntp, manifest_revision);
+    iobuf segment_bytes = generate_segment(model::offset(1), 100);
+    std::vector<model::record_batch_header> headers;
+    std::vector<iobuf> records;
+    std::vector<uint64_t> file_offsets;
+    auto parser = make_recording_batch_parser(
+      iobuf_deep_copy(segment_bytes), headers, records, file_offsets);
+    parser->consume().get();
+    parser->close().get();
+
+    partition_manifest::segment_meta meta{
+      .is_compacted = false,
+      .size_bytes = segment_bytes.size_bytes(),
+      .base_offset = headers.front().base_offset,
+      .committed_offset = headers.back().last_offset(),
+      .base_timestamp = {},
+      .max_timestamp = {},
+      .delta_offset = model::offset_delta(0),
+      .ntp_revision = manifest_revision,
+      .sname_format = segment_name_format::v4};
+    auto path = m.generate_segment_path(meta);
+    retry_chain_node fib(never_abort, 10000ms, 200ms);
+
+    // The index follows the data in the object, there is no .index object
+    iobuf object_bytes = segment_bytes.copy();
+    object_bytes.append(make_index(meta, segment_bytes));
+    uint64_t clen = object_bytes.size_bytes();
+    auto reset_stream = make_reset_fn(object_bytes);
+    auto upl_res = api.local()
+                     .upload_segment(
+                       bucket, path, clen, reset_stream, fib, always_continue)
+                     .get();
+    BOOST_REQUIRE(upl_res == upload_result::success);
+    m.add(meta);
+
+    storage::log_reader_config reader_config(
+      meta.base_offset, meta.committed_offset, ss::default_priority_class());
+
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    auto segment = ss::make_lw_shared<remote_segment>(
+      api.local(),
+      cache.local(),
+      bucket,
+      m.generate_segment_path(meta),
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    remote_segment_batch_reader reader(
+      segment, reader_config, probe, ts_probe, ssx::semaphore_units());
+    storage::offset_translator_state ot_state(m.get_ntp());
+
+    std::vector<model::offset> offsets;
+    while (true) {
+        auto s = reader.read_some(model::no_timeout, ot_state).get();
+        BOOST_REQUIRE(static_cast<bool>(s));
+        if (s.value().empty()) {
+            break;
+        }
+        for (const auto& batch : s.value()) {
+            offsets.push_back(batch.base_offset());
+        }
+    }
+    reader.stop().get();
+    segment->stop().get();
+
+    // The index bytes aren't read as batches
+    BOOST_REQUIRE_EQUAL(offsets.size(), headers.size());
+    BOOST_REQUIRE_EQUAL(offsets.back(), headers.back().base_offset);
+    for (const auto& req : get_requests()) {
+        BOOST_REQUIRE(!std::string_view{req.url}.ends_with(".index"));
+    }
+}
+
 void test_remote_segment_batch_reader(
   cloud_storage_fixture& fixture,
   int num_batches,
@@ -1158,6 +1243,202 @@ FIXTURE_TEST(test_chunk_prefetch, cloud_storage_fixture) {
     }
 }
 
+FIXTURE_TEST(test_chunk_read_ahead, cloud_storage_fixture) {
+    config::shard_local_cfg().cloud_storage_cache_chunk_size.set_value(
+      static_cast<uint64_t>(128_KiB));
+    config::shard_local_cfg().cloud_storage_chunk_read_ahead.set_value(
+      static_cast<uint16_t>(4));
+
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().cloud_storage_cache_chunk_size.reset();
+        config::shard_local_cfg().cloud_storage_chunk_read_ahead.reset();
+    });
+
+    const auto key = model::offset(1);
+    retry_chain_node fib(never_abort, 300s, 200ms);
+    const iobuf segment_bytes = generate_segment(model::offset(1), 300);
+
+    const auto m = chunk_read_baseline(*this, key, fib, segment_bytes.copy());
+    const auto meta = *m.get(key);
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    remote_segment segment(
+      api.local(),
+      cache.local(),
+      bucket,
+      m.generate_segment_path(meta),
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    ss::abort_source as{};
+    auto stream = segment
+                    .offset_data_stream(
+                      m.get(key)->base_kafka_offset(),
+                      kafka::offset{100000000},
+                      std::nullopt,
+                      ss::default_priority_class(),
+                      as)
+                    .get()
+                    .stream;
+
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(stream, rds).get();
+    stream.close().get();
+
+    const auto chunk_count = segment.get_coarse_index().size() + 1;
+    BOOST_REQUIRE_GT(chunk_count, 4);
+
+    segment.stop().get();
+
+    BOOST_REQUIRE(downloaded == segment_bytes);
+
+    // Every chunk is downloaded once, by its own ranged request
+    const std::regex log_file_expr{".*-.*log(\\.\\d+)?$"};
+    size_t segment_requests = 0;
+    for (const auto& req : get_requests()) {
+        if (
+          req.method != "GET"
+          || !std::regex_match(req.url.begin(), req.url.end(), log_file_expr)) {
+            continue;
+        }
+        ++segment_requests;
+        BOOST_REQUIRE(req.header("Range").has_value());
+    }
+    BOOST_REQUIRE_EQUAL(segment_requests, chunk_count);
+}
+
+FIXTURE_TEST(test_remote_segment_stream_read, cloud_storage_fixture) {
+    config::shard_local_cfg().cloud_storage_cache_chunk_size.set_value(
+      static_cast<uint64_t>(128_KiB));
+    config::shard_local_cfg().cloud_storage_stream_read_buffer_size.set_value(
+      static_cast<uint64_t>(32_KiB));
+
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().cloud_storage_cache_chunk_size.reset();
+        config::shard_local_cfg().cloud_storage_stream_read_buffer_size.reset();
+    });
+
+    const auto key = model::offset(1);
+    retry_chain_node fib(never_abort, 300s, 200ms);
+    const iobuf segment_bytes = generate_segment(model::offset(1), 300);
+
+    const auto m = chunk_read_baseline(*this, key, fib, segment_bytes.copy());
+    const auto meta = *m.get(key);
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    remote_segment segment(
+      api.local(),
+      cache.local(),
+      bucket,
+      m.generate_segment_path(meta),
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    // A read from the beginning of the segment spanning several chunks is a
+    // sequential scan, it is served without hydrating any chunk.
+    ss::abort_source as{};
+    auto stream = segment
+                    .offset_data_stream(
+                      m.get(key)->base_kafka_offset(),
+                      kafka::offset{100000000},
+                      std::nullopt,
+                      ss::default_priority_class(),
+                      as)
+                    .get()
+                    .stream;
+
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(stream, rds).get();
+    stream.close().get();
+    segment.stop().get();
+
+    BOOST_REQUIRE(downloaded == segment_bytes);
+
+    using dit = std::filesystem::recursive_directory_iterator;
+    const auto chunk_file = std::find_if(
+      dit{tmp_directory.get_path()}, dit{}, [](const auto& entry) {
+          return entry.path().native().find("_chunks") != std::string::npos
+                 && entry.is_regular_file();
+      });
+    BOOST_REQUIRE(chunk_file == dit{});
+
+    const std::regex log_file_expr{".*-.*log(\\.\\d+)?$"};
+    const auto& requests_made = get_requests();
+    BOOST_REQUIRE_EQUAL(
+      std::count_if(
+        requests_made.cbegin(),
+        requests_made.cend(),
+        [&log_file_expr](const auto& req) {
+            return req.method == "GET"
+                   && std::regex_match(
+                     req.url.begin(), req.url.end(), log_file_expr);
+        }),
+      1);
+}
+
+FIXTURE_TEST(test_remote_segment_timequery_stream_read, cloud_storage_fixture) {
+    config::shard_local_cfg().cloud_storage_cache_chunk_size.set_value(
+      static_cast<uint64_t>(128_KiB));
+    auto reset_cfg = ss::defer(
+      [] { config::shard_local_cfg().cloud_storage_cache_chunk_size.reset(); });
+
+    const auto key = model::offset(1);
+    retry_chain_node fib(never_abort, 300s, 200ms);
+    const iobuf segment_bytes = generate_segment(model::offset(1), 300);
+
+    const auto m = chunk_read_baseline(*this, key, fib, segment_bytes.copy());
+    const auto meta = *m.get(key);
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    remote_segment segment(
+      api.local(),
+      cache.local(),
+      bucket,
+      m.generate_segment_path(meta),
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    // A time query on data which isn't cached streams from the indexed
+    // position, even with streaming reads of scans disabled.
+    ss::abort_source as{};
+    auto stream = segment
+                    .offset_data_stream(
+                      m.get(key)->base_kafka_offset(),
+                      kafka::offset{100000000},
+                      model::timestamp::min(),
+                      ss::default_priority_class(),
+                      as)
+                    .get()
+                    .stream;
+
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(stream, rds).get();
+    stream.close().get();
+    segment.stop().get();
+
+    BOOST_REQUIRE(downloaded == segment_bytes);
+
+    using dit = std::filesystem::recursive_directory_iterator;
+    const auto chunk_file = std::find_if(
+      dit{tmp_directory.get_path()}, dit{}, [](const auto& entry) {
+          return entry.path().native().find("_chunks") != std::string::npos
+                 && entry.is_regular_file();
+      });
+    BOOST_REQUIRE(chunk_file == dit{});
+}
+
 FIXTURE_TEST(test_abort_hydration_timeout, cloud_storage_fixture) {
     scoped_config reset;
     reset.get("cloud_storage_hydration_timeout_ms").set_value(0ms);
@@ -361,6 +361,67 @@ FIXTURE_TEST(test_download_segment, remote_fixture) { // NOLINT
     BOOST_REQUIRE(subscription.get().type == api_activity_type::segment_upload);
 }
 
+FIXTURE_TEST(test_upload_segment_multipart, remote_fixture) {
+    set_expectations_and_listen({});
+    auto bucket = cloud_storage_clients::bucket_name("bucket");
+    auto name = segment_name("1-2-v1.log");
+    auto path = generate_remote_segment_path(
+      manifest_ntp, manifest_revision, name, model::term_id{123});
+    const uint64_t clen = manifest_payload.size();
+    const uint64_t part_size = 64;
+    auto reset_stream = [](uint64_t offset, uint64_t length)
+      -> ss::future<std::unique_ptr<storage::stream_provider>> {
+        iobuf out;
+        out.append(manifest_payload.data() + offset, length);
+        co_return std::make_unique<storage::segment_reader_handle>(
+          make_iobuf_input_stream(std::move(out)));
+    };
+    retry_chain_node fib(never_abort, 1s, 20ms);
+    auto upl_res = remote.local()
+                     .upload_segment_multipart(
+                       bucket,
+                       path,
+                       clen,
+                       part_size,
+                       2,
+                       reset_stream,
+                       fib,
+                       always_continue)
+                     .get();
+    BOOST_REQUIRE(upl_res.result == upload_result::success);
+    BOOST_REQUIRE_EQUAL(upl_res.parts, (clen + part_size - 1) / part_size);
+    BOOST_REQUIRE_EQUAL(upl_res.part_retries, 0);
+
+    // one PUT per part, each no larger than the part size
+    size_t part_uploads = 0;
+    for (const auto& req : get_requests()) {
+        if (req.method == "PUT") {
+            ++part_uploads;
+            BOOST_REQUIRE_LE(req.content_length, part_size);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(part_uploads, upl_res.parts);
+    BOOST_REQUIRE(get_requests().back().method == "POST");
+    BOOST_REQUIRE(
+      get_requests().back().content.find("etag-1") != ss::sstring::npos);
+
+    iobuf downloaded;
+    auto try_consume = [&downloaded](uint64_t len, ss::input_stream<char> is) {
+        downloaded.clear();
+        auto rds = make_iobuf_ref_output_stream(downloaded);
+        return ss::do_with(
+          std::move(rds), std::move(is), [&downloaded](auto& rds, auto& is) {
+              return ss::copy(is, rds).then(
+                [&downloaded] { return downloaded.size_bytes(); });
+          });
+    };
+    auto dnl_res
+      = remote.local().download_segment(bucket, path, try_consume, fib).get();
+    BOOST_REQUIRE(dnl_res == download_result::success);
+    iobuf_parser p(std::move(downloaded));
+    BOOST_REQUIRE(p.read_string(p.bytes_left()) == manifest_payload);
+}
+
 FIXTURE_TEST(test_download_segment_timeout, remote_fixture) { // NOLINT
     auto bucket = cloud_storage_clients::bucket_name("bucket");
     auto subscription = remote.local().subscribe(allow_all);
@@ -694,6 +755,59 @@ FIXTURE_TEST(test_list_bucket_with_filter, remote_fixture) {
     BOOST_REQUIRE_EQUAL(items[0].key, "b");
 }
 
+FIXTURE_TEST(test_list_bucket_pages, remote_fixture) {
+    set_expectations_and_listen({});
+    cloud_storage_clients::bucket_name bucket{"test"};
+    retry_chain_node fib(never_abort, 10s, 20ms);
+    for (const char first : {'x', 'y'}) {
+        for (const char second : {'a', 'b', 'c'}) {
+            cloud_storage_clients::object_key path{
+              fmt::format("{}/{}", first, second)};
+            auto result
+              = remote.local().upload_object(bucket, path, iobuf{}, fib).get();
+            BOOST_REQUIRE_EQUAL(cloud_storage::upload_result::success, result);
+        }
+    }
+
+    std::vector<ss::sstring> keys;
+    size_t pages = 0;
+    auto result = remote.local()
+                    .list_objects_pages(
+                      bucket,
+                      fib,
+                      [&](cloud_storage_clients::client::list_bucket_result
+                            page) {
+                          ++pages;
+                          for (auto& item : page.contents) {
+                              keys.push_back(std::move(item.key));
+                          }
+                          return ss::make_ready_future<ss::stop_iteration>(
+                            ss::stop_iteration::no);
+                      },
+                      cloud_storage_clients::object_key{"y/"})
+                    .get();
+    BOOST_REQUIRE(result.has_value());
+    BOOST_REQUIRE_GE(pages, 1);
+    BOOST_REQUIRE(keys == (std::vector<ss::sstring>{"y/a", "y/b", "y/c"}));
+
+    // stopping the iteration is not an error and issues no more requests
+    const auto requests_before = get_requests().size();
+    pages = 0;
+    result = remote.local()
+               .list_objects_pages(
+                 bucket,
+                 fib,
+                 [&](cloud_storage_clients::client::list_bucket_result) {
+                     ++pages;
+                     return ss::make_ready_future<ss::stop_iteration>(
+                       ss::stop_iteration::yes);
+                 })
+               .get();
+    BOOST_REQUIRE(result.has_value());
+    BOOST_REQUIRE_EQUAL(pages, 1);
+    BOOST_REQUIRE_EQUAL(get_requests().size(), requests_before + 1);
+}
+
 FIXTURE_TEST(test_put_string, remote_fixture) {
     set_expectations_and_listen({});
     auto conf = get_configuration();
@@ -771,6 +885,46 @@ FIXTURE_TEST(test_delete_objects_multiple_batches, remote_fixture) {
       deleted_keys.end());
 }
 
+FIXTURE_TEST(test_delete_objects_coalesced, remote_fixture) {
+    set_expectations_and_listen({});
+
+    cloud_storage_clients::bucket_name bucket{"test"};
+    retry_chain_node fib_a(never_abort, 500ms, 20ms);
+    retry_chain_node fib_b(never_abort, 500ms, 20ms);
+
+    std::vector<cloud_storage_clients::object_key> keys_a{
+      cloud_storage_clients::object_key{"a"},
+      cloud_storage_clients::object_key{"b"}};
+    std::deque<cloud_storage_clients::object_key> keys_b{
+      cloud_storage_clients::object_key{"c"},
+      cloud_storage_clients::object_key{"d"},
+      cloud_storage_clients::object_key{"e"}};
+
+    // Both callers queue their keys before the queue is drained, so they
+    // share a single request
+    auto fut_a = remote.local().delete_objects_coalesced(bucket, keys_a, fib_a);
+    auto fut_b = remote.local().delete_objects_coalesced(bucket, keys_b, fib_b);
+    BOOST_REQUIRE_EQUAL(cloud_storage::upload_result::success, fut_a.get());
+    BOOST_REQUIRE_EQUAL(cloud_storage::upload_result::success, fut_b.get());
+
+    auto requests = get_requests();
+    BOOST_REQUIRE_EQUAL(requests.size(), 1);
+    BOOST_REQUIRE_EQUAL(requests[0].url, "/?delete");
+    auto deleted_keys = keys_from_delete_objects_request(requests[0]);
+    std::sort(deleted_keys.begin(), deleted_keys.end());
+    std::vector<cloud_storage_clients::object_key> expected{
+      cloud_storage_clients::object_key{"a"},
+      cloud_storage_clients::object_key{"b"},
+      cloud_storage_clients::object_key{"c"},
+      cloud_storage_clients::object_key{"d"},
+      cloud_storage_clients::object_key{"e"}};
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(
+      deleted_keys.begin(),
+      deleted_keys.end(),
+      expected.begin(),
+      expected.end());
+}
+
 FIXTURE_TEST(
   test_delete_objects_multiple_batches_single_failure, remote_fixture) {
     set_expectations_and_listen({expectation{
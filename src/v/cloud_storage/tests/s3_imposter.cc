@@ -15,12 +15,14 @@
 #include "cloud_storage/types.h"
 #include "cloud_storage_clients/client.h"
 #include "cloud_storage_clients/client_probe.h"
+#include "random/generators.h"
 #include "seastarx.h"
 #include "test_utils/async.h"
 #include "test_utils/test_macros.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/iostream.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/http/function_handlers.hh>
 #include <seastar/net/socket_defs.hh>
@@ -208,6 +210,10 @@ struct s3_imposter_fixture::content_handler {
             return slow_down_response;
         }
 
+        if (request.query_parameters.contains("uploadId")) {
+            return handle_multipart(request, repl);
+        }
+
         if (request._method == "GET") {
             if (
               fixture._search_on_get_list
@@ -289,11 +295,59 @@ struct s3_imposter_fixture::content_handler {
                 return expect_iter->second.body.value();
             }
             return R"xml(<DeleteResult xmlns="http://s3.amazonaws.com/doc/2006-03-01/"></DeleteResult>)xml";
+        } else if (
+          request._method == "POST"
+          && request.query_parameters.contains("uploads")) {
+            // Create multipart upload, all uploads share the same id
+            return fmt::format(
+              R"xml(<InitiateMultipartUploadResult><Key>{}</Key><UploadId>{}</UploadId></InitiateMultipartUploadResult>)xml",
+              request._url,
+              multipart_upload_id);
         }
         RPTEST_FAIL("Unexpected request");
         return "";
     }
+
+    ss::sstring handle_multipart(const_req request, reply& repl) {
+        if (request.get_query_param("uploadId") != multipart_upload_id) {
+            repl.set_status(reply::status_type::not_found);
+            return "";
+        }
+        auto& parts = multipart_uploads[request._url];
+        if (request._method == "PUT") {
+            // Upload part
+            int part_number = 0;
+            auto param = request.get_query_param("partNumber");
+            std::from_chars(
+              param.data(), param.data() + param.size(), part_number);
+            parts[part_number] = request.content;
+            repl.add_header("ETag", fmt::format("\"etag-{}\"", part_number));
+            return "";
+        } else if (request._method == "POST") {
+            // Complete multipart upload
+            ss::sstring body;
+            for (const auto& [_, content] : parts) {
+                body += content;
+            }
+            expectations[request._url] = {
+              .url = request._url, .body = std::move(body)};
+            multipart_uploads.erase(request._url);
+            return R"xml(<CompleteMultipartUploadResult></CompleteMultipartUploadResult>)xml";
+        } else if (request._method == "DELETE") {
+            // Abort multipart upload
+            multipart_uploads.erase(request._url);
+            repl.set_status(reply::status_type::no_content);
+            return "";
+        }
+        RPTEST_FAIL("Unexpected multipart request");
+        return "";
+    }
+
+    static constexpr std::string_view multipart_upload_id = "upload-id";
+
     std::map<ss::sstring, s3_imposter_fixture::expectation> expectations;
+    /// Parts of the in-progress multipart uploads by object url
+    std::map<ss::sstring, std::map<int, ss::sstring>> multipart_uploads;
     s3_imposter_fixture& fixture;
     std::optional<absl::flat_hash_set<ss::sstring>> headers = std::nullopt;
 };
@@ -393,13 +447,39 @@ void s3_imposter_fixture::set_routes(
     _content_handler = ss::make_shared<content_handler>(
       expectations, *this, std::move(headers_to_store));
     _handler = std::make_unique<function_handler>(
-      [this](const_req req, reply& repl) {
-          return _content_handler->handle(req, repl);
+      [this](
+        std::unique_ptr<ss::http::request> req, std::unique_ptr<reply> repl) {
+          return handle_with_faults(std::move(req), std::move(repl));
       },
       "txt");
     r.add_default_handler(_handler.get());
 }
 
+ss::future<std::unique_ptr<ss::http::reply>>
+s3_imposter_fixture::handle_with_faults(
+  std::unique_ptr<ss::http::request> req,
+  std::unique_ptr<ss::http::reply> repl) {
+    if (_faults.latency > 0ms) {
+        co_await ss::sleep(_faults.latency);
+    }
+    if (
+      _faults.error_rate > 0.0
+      && random_generators::get_real<double>() < _faults.error_rate) {
+        ++_injected_errors;
+        repl->set_status(ss::http::reply::status_type::internal_server_error);
+        co_return repl;
+    }
+
+    repl->_content += _content_handler->handle(*req, *repl);
+
+    if (_faults.bandwidth > 0) {
+        auto bytes = req->content.size() + repl->_content.size();
+        co_await ss::sleep(std::chrono::microseconds(
+          bytes * 1'000'000 / _faults.bandwidth));
+    }
+    co_return repl;
+}
+
 enable_cloud_storage_fixture::enable_cloud_storage_fixture() {
     ss::smp::invoke_on_all([]() {
         auto& cfg = config::shard_local_cfg();
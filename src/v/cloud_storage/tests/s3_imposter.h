@@ -95,6 +95,23 @@ public:
 
     void set_search_on_get_list(bool should) { _search_on_get_list = should; }
 
+    /// Faults applied to every request, to emulate a remote object store
+    /// with a realistic latency and bandwidth.
+    struct fault_injection {
+        /// Delay added before handling each request
+        std::chrono::milliseconds latency{0};
+        /// Bytes per second of the request and response bodies, 0 means
+        /// unlimited
+        size_t bandwidth{0};
+        /// Probability of failing a request with an internal server error
+        double error_rate{0.0};
+    };
+
+    void set_fault_injection(fault_injection f) { _faults = f; }
+
+    /// Number of requests failed by the fault injection
+    size_t injected_errors() const { return _injected_errors; }
+
 private:
     void set_routes(
       ss::httpd::routes& r,
@@ -105,6 +122,9 @@ private:
     ss::socket_address _server_addr;
     ss::shared_ptr<ss::httpd::http_server_control> _server;
 
+    ss::future<std::unique_ptr<ss::http::reply>> handle_with_faults(
+      std::unique_ptr<ss::http::request>, std::unique_ptr<ss::http::reply>);
+
     struct content_handler;
     friend struct content_handler;
     ss::shared_ptr<content_handler> _content_handler;
@@ -117,6 +137,9 @@ private:
     /// Whether or not to search through expectations for content when handling
     /// a list GET request.
     bool _search_on_get_list{true};
+
+    fault_injection _faults;
+    size_t _injected_errors{0};
 };
 
 class enable_cloud_storage_fixture {
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/segment_key_filter.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace cloud_storage;
+
+namespace {
+iobuf make_key(int i) {
+    auto s = fmt::format("key-{}", i);
+    iobuf b;
+    b.append(s.data(), s.size());
+    return b;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_segment_key_filter_no_false_negatives) {
+    constexpr int num_keys = 1000;
+    segment_key_filter_builder builder(num_keys);
+    for (int i = 0; i < num_keys; ++i) {
+        builder.add(make_key(i));
+    }
+    auto filter = builder.build();
+    BOOST_REQUIRE(filter.has_value());
+
+    auto restored = segment_key_filter::from_iobuf(
+      std::move(*filter).to_iobuf());
+    for (int i = 0; i < num_keys; ++i) {
+        BOOST_REQUIRE(restored.may_contain(fmt::format("key-{}", i)));
+    }
+
+    // with 10 bits per key the false positive rate is around 1%
+    int false_positives = 0;
+    for (int i = num_keys; i < 2 * num_keys; ++i) {
+        if (restored.may_contain(fmt::format("key-{}", i))) {
+            ++false_positives;
+        }
+    }
+    BOOST_REQUIRE_LT(false_positives, num_keys / 20);
+}
+
+BOOST_AUTO_TEST_CASE(test_segment_key_filter_overflow) {
+    segment_key_filter_builder builder(10);
+    for (int i = 0; i < 11; ++i) {
+        builder.add(make_key(i));
+    }
+    BOOST_REQUIRE(!builder.build().has_value());
+}
+
+BOOST_AUTO_TEST_CASE(test_segment_key_filter_empty) {
+    segment_key_filter_builder builder(10);
+    auto filter = builder.build();
+    BOOST_REQUIRE(filter.has_value());
+    BOOST_REQUIRE(!filter->may_contain("key-0"));
+}
@@ -262,6 +262,66 @@ PERF_TEST(cstore_bench, xor_column_at_with_index_4K) {
     perf_tests::stop_measuring_time();
 }
 
+template<class DeltaT>
+deltafor_encoder<int64_t, DeltaT> make_encoder_4M() {
+    deltafor_encoder<int64_t, DeltaT> enc(0);
+    std::array<int64_t, details::FOR_buffer_depth> row{};
+    int64_t value = 0;
+    for (int64_t i = 0; i < 4096000; i += row.size()) {
+        for (auto& e : row) {
+            value += random_generators::get_int(1, 100);
+            e = value;
+        }
+        enc.add(row);
+    }
+    return enc;
+}
+
+// decode rate of the raw delta-FOR stream, reported per value
+template<class DeltaT>
+size_t decode_test(const deltafor_encoder<int64_t, DeltaT>& enc) {
+    deltafor_decoder<int64_t, DeltaT> dec(
+      enc.get_initial_value(), enc.get_row_count(), enc.share());
+    std::array<int64_t, details::FOR_buffer_depth> row{};
+    size_t values = 0;
+    perf_tests::start_measuring_time();
+    while (dec.read(row)) {
+        perf_tests::do_not_optimize(row);
+        values += row.size();
+    }
+    perf_tests::stop_measuring_time();
+    return values;
+}
+
+// decode rate of a column scan, which goes through the frame iterators
+template<class ColumnT>
+size_t scan_test(const ColumnT& column) {
+    size_t values = 0;
+    perf_tests::start_measuring_time();
+    for (auto it = column.begin(); !it.is_end(); ++it) {
+        perf_tests::do_not_optimize(*it);
+        ++values;
+    }
+    perf_tests::stop_measuring_time();
+    return values;
+}
+
+PERF_TEST(cstore_bench, xor_decode_4M) {
+    static const auto enc = make_encoder_4M<delta_xor_alg>();
+    return decode_test(enc);
+}
+
+PERF_TEST(cstore_bench, delta_decode_4M) {
+    static const auto enc = make_encoder_4M<delta_delta_alg>();
+    return decode_test(enc);
+}
+
+PERF_TEST(cstore_bench, xor_column_scan_4M) { return scan_test(xor_column_4M); }
+
+PERF_TEST(cstore_bench, delta_column_scan_4M) {
+    return scan_test(delta_column_4M);
+}
+
 std::vector<segment_meta> generate_metadata(size_t sz) {
     namespace rg = random_generators;
     std::vector<segment_meta> manifest;
@@ -735,6 +735,47 @@ BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_full_upper_bound) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_search_between_segments) {
+    segment_meta_cstore store;
+    auto manifest = generate_metadata(short_test_size);
+    for (const auto& sm : manifest) {
+        store.insert(sm);
+    }
+
+    // expected results are computed over the base offsets so that the
+    // searches also land inside of the sampled rows of every frame
+    auto check = [&](size_t first) {
+        auto by_base = [](const segment_meta& m) { return m.base_offset; };
+        for (size_t i = first; i < manifest.size(); i++) {
+            auto o = manifest[i].committed_offset;
+            auto lb = std::ranges::lower_bound(
+              manifest.begin() + first, manifest.end(), o, {}, by_base);
+            auto it = store.lower_bound(o);
+            if (lb == manifest.end()) {
+                BOOST_REQUIRE(it == store.end());
+            } else {
+                BOOST_REQUIRE(it != store.end());
+                BOOST_REQUIRE_EQUAL(*it, *lb);
+            }
+            auto ub = std::ranges::upper_bound(
+              manifest.begin() + first, manifest.end(), o, {}, by_base);
+            auto uit = store.upper_bound(o);
+            if (ub == manifest.end()) {
+                BOOST_REQUIRE(uit == store.end());
+            } else {
+                BOOST_REQUIRE(uit != store.end());
+                BOOST_REQUIRE_EQUAL(*uit, *ub);
+            }
+        }
+    };
+    check(0);
+
+    // prefix truncation drops the hints of the truncated frame
+    const size_t first = manifest.size() / 3 + 7;
+    store.prefix_truncate(manifest[first].base_offset);
+    check(first);
+}
+
 BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_iterators) {
     segment_meta_cstore store;
 
@@ -909,6 +950,25 @@ BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_serde_roundtrip) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_serde_keeps_frames) {
+    segment_meta_cstore store{};
+    auto manifest = generate_metadata(100003);
+    for (auto const& sm : manifest) {
+        store.insert(sm);
+    }
+    auto serialized = store.to_iobuf();
+    auto expected = serialized.copy();
+
+    // the loaded store keeps the encoded frames as they were serialized, so
+    // its footprint is unchanged and it serializes back to the same bytes
+    segment_meta_cstore loaded{};
+    loaded.from_iobuf(std::move(serialized));
+    BOOST_REQUIRE(
+      loaded.inflated_actual_size() == store.inflated_actual_size());
+    BOOST_REQUIRE(loaded.to_iobuf() == expected);
+    BOOST_REQUIRE(loaded == store);
+}
+
 BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_insert_single_replacement) {
     // only base/committed offset are interesting for this test
     constexpr static auto base_segment = segment_meta{
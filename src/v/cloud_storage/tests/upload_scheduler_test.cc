@@ -0,0 +1,107 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/upload_scheduler.h"
+#include "units.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace cloud_storage;
+using namespace std::chrono_literals;
+
+using opt_size = std::optional<size_t>;
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_unlimited) {
+    upload_scheduler s(
+      config::mock_binding<opt_size>(std::nullopt),
+      config::mock_binding<opt_size>(std::nullopt));
+    ss::abort_source as;
+    auto p1 = s.acquire(ss::lowres_clock::now(), as).get();
+    auto p2 = s.acquire(ss::lowres_clock::now(), as).get();
+    BOOST_REQUIRE_EQUAL(s.active_uploads(), 2);
+    s.throttle(1_GiB, as).get();
+    p1.reset();
+    p2.reset();
+    BOOST_REQUIRE_EQUAL(s.active_uploads(), 0);
+    s.stop();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_lag_order) {
+    upload_scheduler s(
+      config::mock_binding<opt_size>(1),
+      config::mock_binding<opt_size>(std::nullopt));
+    ss::abort_source as;
+    auto now = ss::lowres_clock::now();
+    auto first = s.acquire(now, as).get();
+
+    std::vector<int> order;
+    auto recent = s.acquire(now, as).then([&order](auto p) {
+        order.push_back(0);
+        return p;
+    });
+    auto lagging = s.acquire(now - 10s, as).then([&order](auto p) {
+        order.push_back(1);
+        return p;
+    });
+    BOOST_REQUIRE_EQUAL(s.waiting_uploads(), 2);
+
+    // the partition that uploaded last a long time ago goes first
+    first.reset();
+    auto p = lagging.get();
+    BOOST_REQUIRE_EQUAL(s.waiting_uploads(), 1);
+    p.reset();
+    recent.get().reset();
+    BOOST_REQUIRE(order == std::vector<int>({1, 0}));
+    BOOST_REQUIRE_EQUAL(s.active_uploads(), 0);
+    s.stop();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_abort_and_stop) {
+    upload_scheduler s(
+      config::mock_binding<opt_size>(1),
+      config::mock_binding<opt_size>(std::nullopt));
+    ss::abort_source as;
+    ss::abort_source waiter_as;
+    auto first = s.acquire(ss::lowres_clock::now(), as).get();
+
+    auto aborted = s.acquire(ss::lowres_clock::now(), waiter_as);
+    auto stopped = s.acquire(ss::lowres_clock::now(), as);
+    BOOST_REQUIRE_EQUAL(s.waiting_uploads(), 2);
+
+    waiter_as.request_abort();
+    BOOST_REQUIRE_THROW(aborted.get(), ss::abort_requested_exception);
+    BOOST_REQUIRE_EQUAL(s.waiting_uploads(), 1);
+
+    s.stop();
+    BOOST_REQUIRE_THROW(stopped.get(), ss::gate_closed_exception);
+    BOOST_REQUIRE_THROW(
+      s.acquire(ss::lowres_clock::now(), as).get(), ss::gate_closed_exception);
+    first.reset();
+    BOOST_REQUIRE_EQUAL(s.active_uploads(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_upload_scheduler_throughput) {
+    upload_scheduler s(
+      config::mock_binding<opt_size>(std::nullopt),
+      config::mock_binding<opt_size>(10_MiB));
+    ss::abort_source as;
+    // the first second worth of tokens is available right away, the request
+    // larger than the rate is split and has to wait for the refill
+    auto start = ss::lowres_clock::now();
+    s.throttle(10_MiB, as).get();
+    s.throttle(5_MiB, as).get();
+    BOOST_REQUIRE(ss::lowres_clock::now() - start >= 400ms);
+    s.stop();
+}
@@ -59,7 +59,11 @@ enum class segment_name_format : int16_t {
     // the committed offset and size are added to the name.
     v2 = 2,
     // Extra field which is used to track size of the tx-manifest is added.
-    v3 = 3
+    v3 = 3,
+    // Same name and metadata as v3, the segment index is appended to the
+    // segment data in the object instead of being uploaded as a separate
+    // object. The size of the segment is the size of its data.
+    v4 = 4
 };
 
 std::ostream& operator<<(std::ostream& o, const segment_name_format& r);
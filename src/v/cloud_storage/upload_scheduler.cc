@@ -0,0 +1,128 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/upload_scheduler.h"
+
+#include "cloud_storage/logger.h"
+#include "config/configuration.h"
+#include "vassert.h"
+#include "vlog.h"
+
+#include <seastar/core/gate.hh>
+
+namespace cloud_storage {
+
+void upload_scheduler::permit::reset() noexcept {
+    if (auto s = std::exchange(_scheduler, nullptr); s != nullptr) {
+        s->release();
+    }
+}
+
+upload_scheduler::upload_scheduler()
+  : upload_scheduler(
+    config::shard_local_cfg()
+      .cloud_storage_max_partition_uploads_per_shard.bind(),
+    config::shard_local_cfg()
+      .cloud_storage_max_upload_throughput_per_shard.bind()) {}
+
+upload_scheduler::upload_scheduler(
+  config::binding<std::optional<size_t>> max_partitions,
+  config::binding<std::optional<size_t>> max_throughput)
+  : _max_partitions(std::move(max_partitions))
+  , _max_throughput(std::move(max_throughput))
+  , _throughput_limit(_max_throughput().value_or(1), "ts-segment-uploads") {
+    _max_partitions.watch([this] { admit_waiters(); });
+    _max_throughput.watch([this] { update_throughput(); });
+    update_throughput();
+}
+
+ss::future<upload_scheduler::permit> upload_scheduler::acquire(
+  ss::lowres_clock::time_point last_upload, ss::abort_source& as) {
+    if (_stopped) {
+        throw ss::gate_closed_exception();
+    }
+    as.check();
+    if (_waiters.empty() && has_capacity()) {
+        ++_active;
+        co_return permit(*this);
+    }
+
+    const waiter_key key{.last_upload = last_upload, .seq = _next_seq++};
+    auto f = _waiters[key].get_future();
+    auto sub = as.subscribe([this, key]() noexcept {
+        if (auto it = _waiters.find(key); it != _waiters.end()) {
+            it->second.set_exception(ss::abort_requested_exception());
+            _waiters.erase(it);
+        }
+    });
+    vassert(sub.has_value(), "abort source is checked above");
+
+    // the slot is accounted for by admit_waiters before the promise is set
+    co_await std::move(f);
+    co_return permit(*this);
+}
+
+ss::future<> upload_scheduler::throttle(size_t bytes, ss::abort_source& as) {
+    // the bucket never holds more than a second worth of tokens so the
+    // throttling is applied in chunks which are not larger than the rate
+    while (bytes > 0 && !_throttling_disabled) {
+        auto chunk = std::min(bytes, _max_throughput().value_or(bytes));
+        co_await _throughput_limit.throttle(chunk, as);
+        bytes -= chunk;
+    }
+}
+
+void upload_scheduler::stop() {
+    _stopped = true;
+    for (auto& [_, p] : _waiters) {
+        p.set_exception(ss::gate_closed_exception());
+    }
+    _waiters.clear();
+    _throughput_limit.shutdown();
+}
+
+bool upload_scheduler::has_capacity() const {
+    auto limit = _max_partitions();
+    return !limit.has_value() || _active < std::max<size_t>(*limit, 1);
+}
+
+void upload_scheduler::release() noexcept {
+    vassert(_active > 0, "upload permit released twice");
+    --_active;
+    admit_waiters();
+}
+
+void upload_scheduler::admit_waiters() noexcept {
+    while (!_waiters.empty() && has_capacity()) {
+        auto node = _waiters.extract(_waiters.begin());
+        ++_active;
+        node.mapped().set_value();
+    }
+}
+
+void upload_scheduler::update_throughput() {
+    auto tput = _max_throughput().value_or(0);
+    if (tput != 0) {
+        vlog(
+          cst_log.info,
+          "Setting cloud storage upload bandwidth to {} on this shard",
+          tput);
+        _throughput_limit.update_capacity(tput);
+        _throughput_limit.update_rate(tput);
+        _throttling_disabled = false;
+    } else {
+        vlog(
+          cst_log.info,
+          "Disabling cloud storage upload throttling on this shard");
+        _throttling_disabled = true;
+    }
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "seastarx.h"
+#include "utils/token_bucket.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/lowres_clock.hh>
+
+#include <map>
+#include <tuple>
+
+namespace cloud_storage {
+
+/**
+ * Shard-wide admission of partition uploads.
+ *
+ * Every ntp_archiver runs its own upload loop. Without coordination all of
+ * them compete for client_pool leases at once, which is most visible when
+ * the object store recovers from an outage and every partition retries at
+ * the same time. The scheduler limits the number of partitions which upload
+ * concurrently and admits the waiting ones in order of their lag, i.e. the
+ * partition that did not upload anything for the longest time goes first.
+ * Independently of that, the total upload throughput of the shard can be
+ * capped with a byte-rate budget.
+ */
+class upload_scheduler {
+public:
+    /// Upload slot held by a partition for the duration of an upload
+    /// iteration. The slot is returned to the scheduler on destruction.
+    class permit {
+    public:
+        permit() = default;
+        permit(const permit&) = delete;
+        permit& operator=(const permit&) = delete;
+        permit(permit&& other) noexcept
+          : _scheduler(std::exchange(other._scheduler, nullptr)) {}
+        permit& operator=(permit&& other) noexcept {
+            if (this != &other) {
+                reset();
+                _scheduler = std::exchange(other._scheduler, nullptr);
+            }
+            return *this;
+        }
+        ~permit() { reset(); }
+
+        void reset() noexcept;
+
+    private:
+        friend class upload_scheduler;
+        explicit permit(upload_scheduler& s)
+          : _scheduler(&s) {}
+
+        upload_scheduler* _scheduler{nullptr};
+    };
+
+    upload_scheduler();
+    upload_scheduler(
+      config::binding<std::optional<size_t>> max_partitions,
+      config::binding<std::optional<size_t>> max_throughput);
+    upload_scheduler(const upload_scheduler&) = delete;
+    upload_scheduler& operator=(const upload_scheduler&) = delete;
+    upload_scheduler(upload_scheduler&&) = delete;
+    upload_scheduler& operator=(upload_scheduler&&) = delete;
+    ~upload_scheduler() = default;
+
+    /// Wait for an upload slot.
+    ///
+    /// \param last_upload is the time of the last successful upload of the
+    ///        partition, the waiters with the oldest uploads go first
+    /// \param as is used to cancel the wait
+    /// \throw ss::abort_requested_exception if \p as is triggered
+    /// \throw ss::gate_closed_exception if the scheduler is stopped
+    ss::future<permit>
+    acquire(ss::lowres_clock::time_point last_upload, ss::abort_source& as);
+
+    /// Consume \p bytes from the upload budget of the shard, waiting until it
+    /// has enough tokens. Returns immediately if uploads are not throttled.
+    ss::future<> throttle(size_t bytes, ss::abort_source& as);
+
+    /// Fail all pending and future waiters.
+    void stop();
+
+    size_t active_uploads() const { return _active; }
+    size_t waiting_uploads() const { return _waiters.size(); }
+
+private:
+    struct waiter_key {
+        ss::lowres_clock::time_point last_upload;
+        uint64_t seq;
+
+        bool operator<(const waiter_key& other) const {
+            return std::tie(last_upload, seq)
+                   < std::tie(other.last_upload, other.seq);
+        }
+    };
+
+    bool has_capacity() const;
+    void release() noexcept;
+    void admit_waiters() noexcept;
+    void update_throughput();
+
+    config::binding<std::optional<size_t>> _max_partitions;
+    config::binding<std::optional<size_t>> _max_throughput;
+
+    size_t _active{0};
+    uint64_t _next_seq{0};
+    bool _stopped{false};
+    std::map<waiter_key, ss::promise<>> _waiters;
+
+    token_bucket<> _throughput_limit;
+    bool _throttling_disabled{true};
+};
+
+} // namespace cloud_storage
@@ -20,6 +20,7 @@
 #include "config/configuration.h"
 #include "json/document.h"
 #include "json/istreamwrapper.h"
+#include "utils/base64.h"
 #include "vlog.h"
 
 #include <utility>
@@ -51,6 +52,17 @@ constexpr boost::beast::string_view is_hns_enabled_name = "x-ms-is-hns-enabled";
 constexpr boost::beast::string_view delete_snapshot_value = "include";
 constexpr boost::beast::string_view error_code_name = "x-ms-error-code";
 constexpr boost::beast::string_view content_type_name = "Content-Type";
+constexpr boost::beast::string_view blob_content_type_name
+  = "x-ms-blob-content-type";
+
+// Block ids of a blob must all have the same length. The base64 encoding of a
+// run of six decimal digits is eight characters long and contains neither
+// padding nor '+' and '/', so it can be used in a query string as is.
+ss::sstring make_block_id(int part_number) {
+    const auto id = fmt::format("{:06d}", part_number);
+    return bytes_to_base64(
+      {reinterpret_cast<const uint8_t*>(id.data()), id.size()});
+}
 
 bool is_error_retryable(
   const cloud_storage_clients::abs_rest_error_response& err) {
@@ -280,6 +292,69 @@ abs_request_creator::make_delete_blob_request(
     return header;
 }
 
+result<http::client::request_header>
+abs_request_creator::make_put_block_request(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& block_id,
+  size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=block&blockid={id} HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    const auto target = fmt::format(
+      "/{}/{}?comp=block&blockid={}", name(), key().string(), block_id);
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
+result<http::client::request_header>
+abs_request_creator::make_put_block_list_request(
+  bucket_name const& name, object_key const& key, size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=blocklist HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    // x-ms-blob-content-type: text/plain
+    const auto target = fmt::format(
+      "/{}/{}?comp=blocklist", name(), key().string());
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(blob_content_type_name, content_type_value);
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
 result<http::client::request_header>
 abs_request_creator::make_list_blobs_request(
   const bucket_name& name,
@@ -901,6 +976,140 @@ ss::future<> abs_client::do_delete_file(
     }
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+abs_client::create_multipart_upload(
+  bucket_name const&, object_key const&, ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<ss::sstring, error_outcome>>(
+      ss::sstring{});
+}
+
+ss::future<result<ss::sstring, error_outcome>> abs_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const&,
+  int part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block(
+        name, key, part_number, payload_size, std::move(body), timeout),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<ss::sstring> abs_client::do_put_block(
+  bucket_name const& name,
+  object_key const& key,
+  int part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    auto block_id = make_block_id(part_number);
+    auto header = _requestor.make_put_block_request(
+      name, key, block_id, payload_size);
+    if (!header) {
+        co_await body.close();
+
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+    co_await util::drain_response_stream(std::move(response_stream));
+    co_return block_id;
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const&,
+  std::vector<multipart_upload_part> parts,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block_list(name, key, std::move(parts), timeout).then([]() {
+          return ss::make_ready_future<no_response>(no_response{});
+      }),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<> abs_client::do_put_block_list(
+  bucket_name const& name,
+  object_key const& key,
+  std::vector<multipart_upload_part> parts,
+  ss::lowres_clock::duration timeout) {
+    // <?xml version="1.0" encoding="utf-8"?>
+    // <BlockList>
+    //   <Latest>{block-id}</Latest>
+    //   ...
+    // </BlockList>
+    ss::sstring block_list{
+      R"(<?xml version="1.0" encoding="utf-8"?><BlockList>)"};
+    for (const auto& p : parts) {
+        block_list += ssx::sformat("<Latest>{}</Latest>", p.etag);
+    }
+    block_list += "</BlockList>";
+    iobuf payload;
+    payload.append(block_list.data(), block_list.size());
+
+    auto header = _requestor.make_put_block_list_request(
+      name, key, payload.size_bytes());
+    if (!header) {
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto body = make_iobuf_input_stream(std::move(payload));
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+    co_await util::drain_response_stream(std::move(response_stream));
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::abort_multipart_upload(
+  bucket_name const&,
+  object_key const&,
+  ss::sstring const&,
+  ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<no_response, error_outcome>>(
+      no_response{});
+}
+
 ss::future<result<abs_client::no_response, error_outcome>>
 abs_client::delete_path(
   const bucket_name& name,
@@ -65,6 +65,30 @@ public:
     result<http::client::request_header>
     make_delete_blob_request(bucket_name const& name, object_key const& key);
 
+    /// \brief Create a 'Put Block' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_id is the base64 encoded id of the block
+    /// \param payload_size_bytes is a size of the block in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_request(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& block_id,
+      size_t payload_size_bytes);
+
+    /// \brief Create a 'Put Block List' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param payload_size_bytes is a size of the block list in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_list_request(
+      bucket_name const& name,
+      object_key const& key,
+      size_t payload_size_bytes);
+
     // clang-format off
     /// \brief Initialize http header for 'List Blobs' request
     ///
@@ -206,6 +230,38 @@ public:
       std::vector<object_key> keys,
       ss::lowres_clock::duration timeout) override;
 
+    /// Block blobs need no upload id: blocks are staged against the blob
+    /// and stay invisible until the block list is committed.
+    ss::future<result<ss::sstring, error_outcome>> create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block request. The returned identifier is the block id.
+    ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      int part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block List request committing the uploaded blocks
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      std::vector<multipart_upload_part> parts,
+      ss::lowres_clock::duration timeout) override;
+
+    /// No-op: uncommitted blocks are garbage collected by the service
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     struct storage_account_info {
         bool is_hns_enabled{false};
     };
@@ -256,6 +312,20 @@ private:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_put_block(
+      bucket_name const& name,
+      object_key const& key,
+      int part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_put_block_list(
+      bucket_name const& name,
+      object_key const& key,
+      std::vector<multipart_upload_part> parts,
+      ss::lowres_clock::duration timeout);
+
     ss::future<head_object_result> do_head_object(
       bucket_name const& name,
       object_key const& key,
@@ -172,6 +172,80 @@ public:
       std::vector<object_key> keys,
       ss::lowres_clock::duration timeout)
       = 0;
+
+    struct multipart_upload_part {
+        /// 1-based position of the part in the object
+        int part_number;
+        /// Identifier of the uploaded part returned by upload_part
+        ss::sstring etag;
+    };
+
+    /// Start a multipart upload of an object
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param timeout is a timeout of the operation
+    /// \return future that returns the id of the new upload
+    virtual ss::future<result<ss::sstring, error_outcome>>
+    create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Upload a part of a multipart upload. Parts can be uploaded in any
+    /// order and concurrently. Uploading a part again replaces the previous
+    /// upload of the same part.
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by create_multipart_upload
+    /// \param part_number is the 1-based position of the part
+    /// \param payload_size is a size of the part in bytes
+    /// \param body is an input_stream that can be used to read the part
+    /// \param timeout is a timeout of the operation
+    /// \return future that returns the identifier of the uploaded part
+    virtual ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      int part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Assemble the object from the uploaded parts
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by create_multipart_upload
+    /// \param parts is the list of uploaded parts ordered by part number
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the object is created
+    virtual ss::future<result<no_response, error_outcome>>
+    complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      std::vector<multipart_upload_part> parts,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Discard a multipart upload and the parts uploaded so far
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is the id returned by create_multipart_upload
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready when the request is completed
+    virtual ss::future<result<no_response, error_outcome>>
+    abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      ss::lowres_clock::duration timeout)
+      = 0;
 };
 
 } // namespace cloud_storage_clients
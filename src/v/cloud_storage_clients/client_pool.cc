@@ -26,6 +26,9 @@
 namespace {
 constexpr auto self_configure_attempts = 3;
 constexpr auto self_configure_backoff = 1s;
+// Peer shards don't signal this shard when they release a client, so a shard
+// that failed to borrow only waits this long before it tries again.
+constexpr auto borrow_retry_interval = 100ms;
 } // namespace
 
 namespace cloud_storage_clients {
@@ -246,6 +249,10 @@ client_pool::acquire(ss::abort_source& as) {
 
     std::optional<unsigned int> source_sid;
     std::optional<http_client_ptr> client;
+    std::unique_ptr<client_probe::hist_t::measurement> wait_measurement;
+    if (_probe) {
+        wait_measurement = _probe->register_lease_wait();
+    }
 
     try {
         // If credentials have not yet been acquired, wait for them. It is
@@ -320,8 +327,13 @@ client_pool::acquire(ss::abort_source& as) {
                     client = make_client();
                 } else {
                     vlog(pool_log.debug, "can't borrow connection, waiting");
-                    co_await ssx::with_timeout_abortable(
-                      _cvar.wait(), model::no_timeout, as);
+                    try {
+                        co_await ssx::with_timeout_abortable(
+                          _cvar.wait(borrow_retry_interval),
+                          model::no_timeout,
+                          as);
+                    } catch (const ss::condition_variable_timed_out&) {
+                    }
                     vlog(
                       pool_log.debug,
                       "cvar triggered, pool size: {}",
@@ -332,9 +344,13 @@ client_pool::acquire(ss::abort_source& as) {
     } catch (const ss::broken_condition_variable&) {
     }
     if (_gate.is_closed() || _as.abort_requested()) {
+        if (wait_measurement) {
+            wait_measurement->cancel();
+        }
         throw ss::gate_closed_exception();
     }
     vassert(client.has_value(), "'acquire' invariant is broken");
+    wait_measurement.reset();
 
     update_usage_stats();
     vlog(
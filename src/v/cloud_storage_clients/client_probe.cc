@@ -98,6 +98,11 @@ client_probe::register_lease_duration() {
     return _lease_duration.auto_measure();
 }
 
+std::unique_ptr<client_probe::hist_t::measurement>
+client_probe::register_lease_wait() {
+    return _lease_wait.auto_measure();
+}
+
 void client_probe::register_utilization(unsigned clients_in_use) {
     _pool_utilization = clients_in_use;
 }
@@ -197,6 +202,12 @@ void client_probe::setup_internal_metrics(
           [this] { return _lease_duration.public_histogram_logform(); },
           sm::description("Lease duration histogram"),
           labels),
+        sm::make_histogram(
+          "lease_wait_duration",
+          [this] { return _lease_wait.internal_histogram_logform(); },
+          sm::description(
+            "Time spent waiting for a client lease to be granted"),
+          labels),
         sm::make_gauge(
           "client_pool_utilization",
           [this] { return _pool_utilization; },
@@ -84,6 +84,8 @@ public:
     void register_borrow();
     /// Register total lease duration
     std::unique_ptr<hist_t::measurement> register_lease_duration();
+    /// Register the time spent waiting for a lease to be granted
+    std::unique_ptr<hist_t::measurement> register_lease_wait();
     /// Utilization metric which is used to decide if borrowing is possible
     void register_utilization(unsigned clients_in_use);
 
@@ -112,6 +114,8 @@ private:
     uint64_t _total_borrows{0};
     /// Total time the lease is held by the ntp_archiver (or another user)
     hist_t _lease_duration;
+    /// Time spent in the client pool waiting for a lease
+    hist_t _lease_wait;
     /// Current utilization of the client pool
     uint64_t _pool_utilization;
     metrics::internal_metric_groups _metrics;
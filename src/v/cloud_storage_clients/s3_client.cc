@@ -246,9 +246,9 @@ request_creator::make_delete_object_request(
     return header;
 }
 
-struct delete_objects_body : public ss::data_source_impl {
+struct xml_request_body : public ss::data_source_impl {
     ss::temporary_buffer<char> data;
-    explicit delete_objects_body(std::string_view body) noexcept
+    explicit xml_request_body(std::string_view body) noexcept
       : data{body.data(), body.size()} {}
     auto get() -> ss::future<ss::temporary_buffer<char>> override {
         return ss::make_ready_future<ss::temporary_buffer<char>>(
@@ -340,7 +340,153 @@ request_creator::make_delete_objects_request(
     return {
       std::move(header),
       ss::input_stream<char>{ss::data_source{
-        std::make_unique<delete_objects_body>(std::move(body))}}};
+        std::make_unique<xml_request_body>(std::move(body))}}};
+}
+
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  bucket_name const& name, object_key const& key) {
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploads", key().string());
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(boost::beast::http::field::content_length, "0");
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_unsigned_upload_part_request(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  int part_number,
+  size_t payload_size_bytes) {
+    // PUT /{object-id}?partNumber={part}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: 11434
+    // [11434 bytes of part data]
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format(
+      "/{}?partNumber={}&uploadId={}", key().string(), part_number, upload_id);
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+request_creator::make_complete_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  std::span<const client::multipart_upload_part> parts) {
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // Authorization: <applied by _requestor>
+    // Content-Length: <...>
+    //
+    // <?xml version="1.0" encoding="UTF-8"?>
+    // <CompleteMultipartUpload>
+    //     <Part>
+    //         <PartNumber>1</PartNumber>
+    //         <ETag>"etag"</ETag>
+    //     </Part>
+    //      ...
+    // </CompleteMultipartUpload>
+    auto body = [&] {
+        auto complete_tree = boost::property_tree::ptree{};
+        for (auto part_tree = boost::property_tree::ptree{};
+             auto const& p : parts) {
+            part_tree.put("PartNumber", p.part_number);
+            part_tree.put("ETag", p.etag.c_str());
+            complete_tree.add_child("CompleteMultipartUpload.Part", part_tree);
+        }
+
+        auto out = std::ostringstream{};
+        boost::property_tree::write_xml(out, complete_tree);
+        if (!out.good()) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "failed to create complete multipart upload request, state: {}",
+              out.rdstate()));
+        }
+        return out.str();
+    }();
+
+    auto header = http::client::request_header{};
+    header.method(boost::beast::http::verb::post);
+    header.target(fmt::format("/{}?uploadId={}", key().string(), upload_id));
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(
+      boost::beast::http::field::host, fmt::format("{}.{}", name(), _ap()));
+    header.insert(
+      boost::beast::http::field::content_length,
+      fmt::format("{}", body.size()));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+
+    return {
+      std::move(header),
+      ss::input_stream<char>{ss::data_source{
+        std::make_unique<xml_request_body>(std::move(body))}}};
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id) {
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), upload_id);
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
 }
 
 // client //
@@ -978,4 +1124,192 @@ auto s3_client::delete_objects(
     return send_request(
       do_delete_objects(bucket, keys, timeout), bucket, dummy);
 }
+
+ss::future<result<ss::sstring, error_outcome>>
+s3_client::create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_create_multipart_upload(name, key, timeout), name, key);
+}
+
+ss::future<ss::sstring> s3_client::do_create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_create_multipart_upload_request(name, key);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace, "send CreateMultipartUpload request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto res = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 CreateMultipartUpload request failed: {} {:l}",
+          status,
+          ref->get_headers());
+        co_return co_await parse_rest_error_response<ss::sstring>(
+          status, std::move(res));
+    }
+    auto root = util::iobuf_to_ptree(std::move(res), s3_log);
+    co_return root.get<ss::sstring>("InitiateMultipartUploadResult.UploadId");
+}
+
+ss::future<result<ss::sstring, error_outcome>> s3_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  int part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_upload_part(
+        name,
+        key,
+        upload_id,
+        part_number,
+        payload_size,
+        std::move(body),
+        timeout),
+      name,
+      key);
+}
+
+ss::future<ss::sstring> s3_client::do_upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  int part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_unsigned_upload_part_request(
+      name, key, upload_id, part_number, payload_size);
+    if (!header) {
+        co_await body.close();
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send UploadPart request:\n{}", header.value());
+    try {
+        auto ref = co_await _client
+                     .request(std::move(header.value()), body, timeout)
+                     .finally([&body] { return body.close(); });
+        auto res = co_await util::drain_response_stream(ref);
+        auto status = ref->get_headers().result();
+        if (status != boost::beast::http::status::ok) {
+            vlog(
+              s3_log.warn,
+              "S3 UploadPart request failed: {} {:l}",
+              status,
+              ref->get_headers());
+            co_return co_await parse_rest_error_response<ss::sstring>(
+              status, std::move(res));
+        }
+        auto etag = ref->get_headers().at(boost::beast::http::field::etag);
+        co_return ss::sstring(etag.data(), etag.length());
+    } catch (const rest_error_response& err) {
+        _probe->register_failure(err.code(), op_type_tag::upload);
+        throw;
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  std::vector<multipart_upload_part> parts,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_complete_multipart_upload(
+        name, key, upload_id, std::move(parts), timeout)
+        .then([] { return no_response{}; }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  std::vector<multipart_upload_part> parts,
+  ss::lowres_clock::duration timeout) {
+    auto request = _requestor.make_complete_multipart_upload_request(
+      name, key, upload_id, parts);
+    if (!request) {
+        throw std::system_error(request.error());
+    }
+    auto& [header, body] = request.value();
+    vlog(s3_log.trace, "send CompleteMultipartUpload request:\n{}", header);
+    auto ref = co_await _client.request(std::move(header), body, timeout)
+                 .finally([&body] { return body.close(); });
+    auto res = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 CompleteMultipartUpload request failed: {} {:l}",
+          status,
+          ref->get_headers());
+        co_return co_await parse_rest_error_response<>(status, std::move(res));
+    }
+    // S3 can reply with 200 and an error response in the body once the
+    // request has been accepted.
+    auto root = util::iobuf_to_ptree(std::move(res), s3_log);
+    if (root.get_optional<ss::sstring>("Error.Code")) {
+        constexpr const char* empty = "";
+        throw rest_error_response(
+          root.get<ss::sstring>("Error.Code", empty),
+          root.get<ss::sstring>("Error.Message", empty),
+          root.get<ss::sstring>("Error.RequestId", empty),
+          root.get<ss::sstring>("Error.Resource", empty));
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_abort_multipart_upload(name, key, upload_id, timeout).then([] {
+          return no_response{};
+      }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring const& upload_id,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_abort_multipart_upload_request(
+      name, key, upload_id);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(
+      s3_log.trace, "send AbortMultipartUpload request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto res = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (
+      status != boost::beast::http::status::ok
+      && status != boost::beast::http::status::no_content) {
+        vlog(
+          s3_log.warn,
+          "S3 AbortMultipartUpload request failed: {} {:l}",
+          status,
+          ref->get_headers());
+        co_return co_await parse_rest_error_response<>(status, std::move(res));
+    }
+}
 } // namespace cloud_storage_clients
@@ -105,6 +105,54 @@ public:
       std::optional<ss::sstring> continuation_token,
       std::optional<char> delimiter = std::nullopt);
 
+    /// \brief Create a 'CreateMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_create_multipart_upload_request(
+      bucket_name const& name, object_key const& key);
+
+    /// \brief Create unsigned 'UploadPart' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id returned by 'CreateMultipartUpload'
+    /// \param part_number is a 1-based index of the part
+    /// \param payload_size_bytes is a size of the part in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_unsigned_upload_part_request(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      int part_number,
+      size_t payload_size_bytes);
+
+    /// \brief Create a 'CompleteMultipartUpload' request header and body
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id returned by 'CreateMultipartUpload'
+    /// \param parts is a list of uploaded parts
+    /// \return the header and the body as an input_stream
+    result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+    make_complete_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      std::span<const client::multipart_upload_part> parts);
+
+    /// \brief Create an 'AbortMultipartUpload' request header
+    ///
+    /// \param name is a bucket that has the upload
+    /// \param key is an object name
+    /// \param upload_id is an id returned by 'CreateMultipartUpload'
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_abort_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id);
+
 private:
     access_point_uri _ap;
     /// Applies credentials to http requests by adding headers and signing
@@ -191,6 +239,33 @@ public:
       std::vector<object_key> keys,
       ss::lowres_clock::duration timeout) override;
 
+    ss::future<result<ss::sstring, error_outcome>> create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      int part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      std::vector<multipart_upload_part> parts,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
 private:
     ss::future<head_object_result> do_head_object(
       bucket_name const& name,
@@ -231,6 +306,33 @@ private:
       std::span<const object_key> keys,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<ss::sstring> do_upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      int part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      std::vector<multipart_upload_part> parts,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring const& upload_id,
+      ss::lowres_clock::duration timeout);
+
     template<typename T>
     ss::future<result<T, error_outcome>> send_request(
       ss::future<T> request_future,
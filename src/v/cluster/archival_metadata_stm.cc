@@ -267,7 +267,9 @@ command_batch_builder::command_batch_builder(
   , _builder(model::record_batch_type::archival_metadata, model::offset(0))
   , _deadline(deadline)
   , _as(as)
-  , _holder(stm._gate) {}
+  , _holder(stm._gate) {
+    stm.append_deferred_commands(_builder);
+}
 
 command_batch_builder& command_batch_builder::reset_metadata() {
     iobuf key_buf = serde::to_iobuf(
@@ -404,6 +406,9 @@ command_batch_builder& command_batch_builder::cleanup_archive(
 
 ss::future<std::error_code> command_batch_builder::replicate() {
     _as.check();
+    if (_builder.empty()) {
+        return ss::make_ready_future<std::error_code>(errc::success);
+    }
     return _stm.get()._lock.with([this]() {
         vlog(
           _stm.get()._logger.debug, "command_batch_builder::replicate called");
@@ -599,7 +604,94 @@ archival_metadata_stm::archival_metadata_stm(
       raft->log_config().get_initial_revision(),
       partition_mem_tracker))
   , _cloud_storage_api(remote)
-  , _feature_table(ft) {}
+  , _feature_table(ft) {
+    _deferred_flush_timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] {
+            auto deadline = ss::lowres_clock::now()
+                            + config::shard_local_cfg()
+                                .cloud_storage_metadata_sync_timeout_ms();
+            return flush_deferred_commands(deadline, _deferred_flush_as)
+              .then([this](std::error_code errc) {
+                  if (errc) {
+                      vlog(
+                        _logger.info,
+                        "Failed to replicate deferred commands: {}",
+                        errc.message());
+                  }
+              });
+        });
+    });
+}
+
+bool archival_metadata_stm::arm_deferred_flush() {
+    auto interval = config::shard_local_cfg()
+                      .cloud_storage_metadata_coalescing_interval_ms();
+    if (interval == 0ms || _gate.is_closed()) {
+        return false;
+    }
+    if (!_deferred_flush_timer.armed()) {
+        _deferred_flush_timer.arm(interval);
+    }
+    return true;
+}
+
+bool archival_metadata_stm::defer_truncate(model::offset start_rp_offset) {
+    if (!arm_deferred_flush()) {
+        return false;
+    }
+    _deferred.start_offset = std::max(
+      _deferred.start_offset.value_or(start_rp_offset), start_rp_offset);
+    return true;
+}
+
+bool archival_metadata_stm::defer_cleanup_metadata() {
+    if (!arm_deferred_flush()) {
+        return false;
+    }
+    _deferred.cleanup_backlog = get_segments_to_cleanup().size();
+    return true;
+}
+
+void archival_metadata_stm::append_deferred_commands(
+  storage::record_batch_builder& b) {
+    if (_deferred.empty()) {
+        return;
+    }
+    // The cleanup goes first: the backlog it was queued for doesn't include
+    // the segments removed by the truncate.
+    if (
+      _deferred.cleanup_backlog.has_value()
+      && _deferred.cleanup_backlog.value()
+           == get_segments_to_cleanup().size()) {
+        b.add_raw_kv(serde::to_iobuf(cleanup_metadata_cmd::key), iobuf{});
+    }
+    if (
+      _deferred.start_offset.has_value()
+      && _deferred.start_offset.value() > get_start_offset()) {
+        auto record_val = update_start_offset_cmd::value{
+          .start_offset = _deferred.start_offset.value()};
+        b.add_raw_kv(
+          serde::to_iobuf(update_start_offset_cmd::key),
+          serde::to_iobuf(record_val));
+    }
+    vlog(
+      _logger.debug,
+      "Coalescing deferred commands, truncate: {}, cleanup: {}",
+      _deferred.start_offset.has_value(),
+      _deferred.cleanup_backlog.has_value());
+    _deferred = {};
+    _deferred_flush_timer.cancel();
+}
+
+ss::future<std::error_code> archival_metadata_stm::flush_deferred_commands(
+  ss::lowres_clock::time_point deadline, ss::abort_source& as) {
+    if (_deferred.empty()) {
+        co_return errc::success;
+    }
+    // The builder picks up the deferred commands
+    auto builder = batch_start(deadline, as);
+    co_return co_await builder.replicate();
+}
 
 ss::future<std::error_code> archival_metadata_stm::truncate(
   model::offset start_rp_offset,
@@ -934,6 +1026,7 @@ ss::future<std::error_code> archival_metadata_stm::do_add_segments(
 
     storage::record_batch_builder b(
       model::record_batch_type::archival_metadata, model::offset(0));
+    append_deferred_commands(b);
     for (auto& meta : add_segments) {
         iobuf key_buf = serde::to_iobuf(add_segment_cmd::key);
         if (meta.ntp_revision == model::initial_revision_id{}) {
@@ -1548,6 +1641,8 @@ archival_metadata_stm::get_segments_to_cleanup() const {
 
 ss::future<> archival_metadata_stm::stop() {
     _download_as.request_abort();
+    _deferred_flush_timer.cancel();
+    _deferred_flush_as.request_abort();
     co_await raft::persisted_stm<>::stop();
 }
 
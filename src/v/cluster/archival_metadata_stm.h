@@ -23,7 +23,9 @@
 #include "utils/mutex.h"
 #include "utils/prefix_logger.h"
 
+#include <seastar/core/abort_source.hh>
 #include <seastar/core/circular_buffer.hh>
+#include <seastar/core/timer.hh>
 #include <seastar/util/log.hh>
 #include <seastar/util/noncopyable_function.hh>
 
@@ -182,6 +184,27 @@ public:
     ss::future<std::error_code>
     mark_clean(ss::lowres_clock::time_point, model::offset, ss::abort_source&);
 
+    /// Queue a truncate command instead of replicating it right away
+    ///
+    /// Queued commands are replicated as a prefix of the next command batch
+    /// or on their own once cloud_storage_metadata_coalescing_interval_ms
+    /// elapses, whichever comes first. They are dropped if they no longer
+    /// apply by then, the caller is expected to retry on its next iteration.
+    /// \return false if coalescing is disabled, in which case the caller
+    ///         should replicate the command itself
+    bool defer_truncate(model::offset start_rp_offset);
+
+    /// Queue a cleanup_metadata command, see defer_truncate
+    bool defer_cleanup_metadata();
+
+    bool has_deferred_cleanup() const {
+        return _deferred.cleanup_backlog.has_value();
+    }
+
+    /// Replicate the queued commands, if any
+    ss::future<std::error_code> flush_deferred_commands(
+      ss::lowres_clock::time_point deadline, ss::abort_source&);
+
     /// A set of archived segments. NOTE: manifest can be out-of-date if this
     /// node is not leader; or if the STM hasn't yet performed sync; or if the
     /// node has lost leadership. But it will contain segments successfully
@@ -264,6 +287,10 @@ private:
     ss::future<std::error_code>
     do_replicate_commands(model::record_batch, ss::abort_source&);
 
+    // Move the queued commands into the batch and rearm the flush timer
+    void append_deferred_commands(storage::record_batch_builder&);
+    bool arm_deferred_flush();
+
     ss::future<> apply(const model::record_batch& batch) override;
     ss::future<> apply_raft_snapshot(const iobuf&) override;
 
@@ -338,6 +365,22 @@ private:
     };
     std::optional<last_replicate> _last_replicate;
 
+    // Commands queued by defer_truncate and defer_cleanup_metadata
+    struct deferred_commands {
+        std::optional<model::offset> start_offset;
+        // Size of the cleanup backlog when the cleanup was queued. The
+        // command is dropped if the backlog changed, the new entries were
+        // not removed from the cloud yet.
+        std::optional<size_t> cleanup_backlog;
+
+        bool empty() const {
+            return !start_offset.has_value() && !cleanup_backlog.has_value();
+        }
+    };
+    deferred_commands _deferred;
+    ss::timer<ss::lowres_clock> _deferred_flush_timer;
+    ss::abort_source _deferred_flush_as;
+
     cloud_storage::remote& _cloud_storage_api;
     features::feature_table& _feature_table;
     ss::abort_source _download_as;
@@ -66,20 +66,24 @@ offsets_lookup::lookup(offsets_lookup_request req) {
     for (auto& [shard, ntps] : lookups_per_shard) {
         shards.emplace_back(shard);
         pending_shard_replies.emplace_back(_partitions.invoke_on(
-          shard, [ntps = std::move(ntps)](partition_manager& pm) mutable {
+          shard,
+          [ntps = std::move(ntps)](
+            partition_manager& pm) mutable -> ss::future<offsets_lookup_reply> {
               offsets_lookup_reply shard_reply;
               for (auto& ntp : ntps) {
                   auto partition = kafka::make_partition_proxy(
                     model::ktp{ntp.tp.topic, ntp.tp.partition}, pm);
-                  if (!partition.has_value()) {
-                      // Partition may have moved between scheduling points.
-                      continue;
+                  if (partition.has_value()) {
+                      shard_reply.ntp_and_offset.emplace_back(
+                        std::move(ntp),
+                        model::offset_cast(partition->high_watermark()));
                   }
-                  shard_reply.ntp_and_offset.emplace_back(
-                    std::move(ntp),
-                    model::offset_cast(partition->high_watermark()));
+                  // Requests may carry thousands of NTPs per shard. The
+                  // partitions are looked up again after each scheduling
+                  // point, so one that moved is simply skipped.
+                  co_await ss::maybe_yield();
               }
-              return shard_reply;
+              co_return shard_reply;
           }));
     }
 
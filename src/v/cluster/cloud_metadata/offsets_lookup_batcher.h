@@ -26,12 +26,19 @@ namespace cluster::cloud_metadata {
 class offsets_lookup_batcher {
 public:
     typedef absl::btree_map<model::ntp, kafka::offset> map_t;
+
+    // Maximum number of NTPs per lookup request. A lookup is cheap on the
+    // receiving node, so the cost of a lookup is dominated by the round trips
+    // and large batches keep the number of requests low when restoring
+    // groups with many partitions.
+    static constexpr size_t default_batch_size = 1000;
+
     explicit offsets_lookup_batcher(
       model::node_id node_id,
       offsets_lookup& local_lookup,
       cluster::partition_leaders_table& leaders_table,
       rpc::connection_cache& connection_cache,
-      size_t batch_size = 100)
+      size_t batch_size = default_batch_size)
       : _node_id(node_id)
       , _local_lookup(local_lookup)
       , _leaders_table(leaders_table)
@@ -25,8 +25,59 @@
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/timed_out_error.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 namespace cluster::cloud_metadata {
 
+namespace {
+
+// Applies the groups of `snap` on top of `merged`. The snapshots of an
+// offsets partition are a full snapshot followed by deltas of the offsets
+// that changed since, so the offsets of a snapshot replace those of the
+// snapshots before it.
+void merge_snapshot(
+  group_offsets_snapshot& merged,
+  absl::flat_hash_map<ss::sstring, size_t>& group_idx,
+  group_offsets_snapshot snap) {
+    for (auto& g : snap.groups) {
+        auto [it, inserted] = group_idx.try_emplace(
+          g.group_id, merged.groups.size());
+        if (inserted) {
+            merged.groups.emplace_back(std::move(g));
+            continue;
+        }
+        auto& merged_topics = merged.groups[it->second].offsets;
+        for (auto& tp : g.offsets) {
+            auto topic_it = std::find_if(
+              merged_topics.begin(),
+              merged_topics.end(),
+              [&tp](const group_offsets::topic_partitions& t) {
+                  return t.topic == tp.topic;
+              });
+            if (topic_it == merged_topics.end()) {
+                merged_topics.emplace_back(std::move(tp));
+                continue;
+            }
+            auto& merged_partitions = topic_it->partitions;
+            for (const auto& po : tp.partitions) {
+                auto p_it = std::find_if(
+                  merged_partitions.begin(),
+                  merged_partitions.end(),
+                  [&po](const group_offsets::partition_offset& p) {
+                      return p.partition == po.partition;
+                  });
+                if (p_it == merged_partitions.end()) {
+                    merged_partitions.push_back(po);
+                } else {
+                    p_it->offset = po.offset;
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
 offsets_recoverer::offsets_recoverer(
   model::node_id node_id,
   ss::sharded<cloud_storage::remote>& remote,
@@ -90,7 +141,8 @@ ss::future<offsets_recovery_reply> offsets_recoverer::recover(
       req.offsets_ntp);
 
     // Offsets recovery comprises of the following steps:
-    // - Download the remote snapshot file, deserializing the groups.
+    // - Download the remote snapshot files, deserializing the groups and
+    //   applying the deltas on top of the full snapshot.
     // - Perform lookups on each of the NTPs that are a part of any group.
     // - If any offset falls below the looked up HWM, trim the committed offset
     //   down to the HWM.
@@ -105,6 +157,8 @@ ss::future<offsets_recovery_reply> offsets_recoverer::recover(
       _offsets_lookup.local(),
       _leaders_table.local(),
       _connection_cache.local());
+    group_offsets_snapshot snapshot;
+    absl::flat_hash_map<ss::sstring, size_t> group_idx;
     for (const auto& snapshot_path : snapshot_paths) {
         auto offsets_snapshot = cloud_storage::remote_file(
           _remote.local(),
@@ -113,7 +167,6 @@ ss::future<offsets_recovery_reply> offsets_recoverer::recover(
           cloud_storage::remote_segment_path{snapshot_path},
           retry_node,
           "offsets_snapshot");
-        group_offsets_snapshot snapshot;
         try {
             auto f = co_await offsets_snapshot.hydrate_readable_file();
             auto f_size = co_await f.size();
@@ -121,107 +174,95 @@ ss::future<offsets_recovery_reply> offsets_recoverer::recover(
             auto input = ss::make_file_input_stream(f, options);
             auto snap_buf_parser = iobuf_parser{
               co_await read_iobuf_exactly(input, f_size)};
-            snapshot = serde::read<group_offsets_snapshot>(snap_buf_parser);
+            merge_snapshot(
+              snapshot,
+              group_idx,
+              serde::read<group_offsets_snapshot>(snap_buf_parser));
         } catch (...) {
             reply.ec = cluster::errc::allocation_error;
             co_return reply;
         };
-        // Collect the NTPs corresponding to the snapshot file, in preparation
-        // to perform some offset lookups.
-        absl::btree_set<model::ntp> ntps;
-        for (const auto& g : snapshot.groups) {
-            for (const auto& tp : g.offsets) {
-                for (const auto& po : tp.partitions) {
-                    ntps.emplace(
-                      model::kafka_namespace, tp.topic, po.partition);
-                }
+        co_await ss::maybe_yield();
+    }
+    // Collect the NTPs corresponding to the snapshot, in preparation to
+    // perform some offset lookups.
+    absl::btree_set<model::ntp> ntps;
+    for (const auto& g : snapshot.groups) {
+        for (const auto& tp : g.offsets) {
+            for (const auto& po : tp.partitions) {
+                ntps.emplace(model::kafka_namespace, tp.topic, po.partition);
             }
         }
-        try {
-            co_await offsets_lookup.run_lookups(std::move(ntps), retry_node);
-        } catch (ss::timed_out_error&) {
-            reply.ec = cluster::errc::timeout;
-            co_return reply;
-        }
-        const auto& offsets_by_ntp = offsets_lookup.offsets_by_ntp();
-        group_offsets_snapshot batched_groups;
-        for (auto& g : snapshot.groups) {
-            // Collect into a batched request so we can periodically kick off a
-            // batch of commits.
-            batched_groups.groups.emplace_back(group_offsets{});
-            auto& req_group = batched_groups.groups.back();
-            req_group.group_id = g.group_id;
-
-            bool discard_group = false;
-            absl::flat_hash_map<model::topic, group_offsets::topic_partitions>
-              req_topics;
-            for (auto& tp : g.offsets) {
-                for (auto& po : tp.partitions) {
-                    auto ntp = model::ntp{
-                      model::kafka_namespace, tp.topic, po.partition};
-                    if (auto offset_it = offsets_by_ntp.find(ntp);
-                        offset_it != offsets_by_ntp.end()) {
-                        auto hwm = offset_it->second;
-                        if (po.offset > hwm) {
-                            // The recovered partition doesn't have all the data
-                            // required to restore the snapshot exactly. Trim
-                            // it down to the high watermark.
-                            vlog(
-                              clusterlog.warn,
-                              "Group {} NTP {} trimmed to restored HWM instead "
-                              "of snapshotted offset {} < {}",
-                              g.group_id,
-                              ntp,
-                              hwm,
-                              po.offset);
-                            po.offset = kafka::offset{hwm()};
-                        }
-                        // Add the NTP to our request topic.
-                        const auto& t = tp.topic;
-                        auto& req_topic = req_topics[t];
-                        req_topic.partitions.emplace_back(
-                          po.partition, po.offset);
-                    } else {
-                        // If there is a group that contains a partition that
-                        // wasn't restored for some reason, discard the group.
-                        discard_group = true;
+    }
+    try {
+        co_await offsets_lookup.run_lookups(std::move(ntps), retry_node);
+    } catch (ss::timed_out_error&) {
+        reply.ec = cluster::errc::timeout;
+        co_return reply;
+    }
+    const auto& offsets_by_ntp = offsets_lookup.offsets_by_ntp();
+    group_offsets_snapshot batched_groups;
+    for (auto& g : snapshot.groups) {
+        // Collect into a batched request so we can periodically kick off a
+        // batch of commits.
+        batched_groups.groups.emplace_back(group_offsets{});
+        auto& req_group = batched_groups.groups.back();
+        req_group.group_id = g.group_id;
+
+        bool discard_group = false;
+        absl::flat_hash_map<model::topic, group_offsets::topic_partitions>
+          req_topics;
+        for (auto& tp : g.offsets) {
+            for (auto& po : tp.partitions) {
+                auto ntp = model::ntp{
+                  model::kafka_namespace, tp.topic, po.partition};
+                if (auto offset_it = offsets_by_ntp.find(ntp);
+                    offset_it != offsets_by_ntp.end()) {
+                    auto hwm = offset_it->second;
+                    if (po.offset > hwm) {
+                        // The recovered partition doesn't have all the data
+                        // required to restore the snapshot exactly. Trim
+                        // it down to the high watermark.
                         vlog(
                           clusterlog.warn,
-                          "NTP {} doesn't exist, skipping group {} on recovery "
-                          "of {}",
-                          ntp,
+                          "Group {} NTP {} trimmed to restored HWM instead "
+                          "of snapshotted offset {} < {}",
                           g.group_id,
-                          req.offsets_ntp);
-                        break;
+                          ntp,
+                          hwm,
+                          po.offset);
+                        po.offset = kafka::offset{hwm()};
                     }
+                    // Add the NTP to our request topic.
+                    const auto& t = tp.topic;
+                    auto& req_topic = req_topics[t];
+                    req_topic.partitions.emplace_back(po.partition, po.offset);
+                } else {
+                    // If there is a group that contains a partition that
+                    // wasn't restored for some reason, discard the group.
+                    discard_group = true;
+                    vlog(
+                      clusterlog.warn,
+                      "NTP {} doesn't exist, skipping group {} on recovery "
+                      "of {}",
+                      ntp,
+                      g.group_id,
+                      req.offsets_ntp);
+                    break;
                 }
             }
-            if (discard_group) {
-                continue;
-            }
-            for (auto& [t, req_topic] : req_topics) {
-                req_topic.topic = t;
-                req_group.offsets.emplace_back(std::move(req_topic));
-            }
-
-            // If we've amassed a reasonably large set of groups managed by the
-            // same partition, send the offset commits.
-            if (batched_groups.groups.size() == groups_per_batch) {
-                auto errc = co_await recover_groups(
-                  req.offsets_ntp.tp.partition,
-                  std::move(batched_groups),
-                  retry_node);
-                if (errc != cluster::errc::success) {
-                    reply.ec = errc;
-                    co_return reply;
-                }
-                batched_groups = {};
-            }
-            co_await ss::maybe_yield();
         }
-        // We've processed all groups in the snapshot. Send out any remaining
-        // batches of offset commits.
-        if (!batched_groups.groups.empty()) {
+        if (discard_group) {
+            continue;
+        }
+        for (auto& [t, req_topic] : req_topics) {
+            req_topic.topic = t;
+            req_group.offsets.emplace_back(std::move(req_topic));
+        }
+
+        // If we've amassed a reasonably large set of groups managed by the
+        // same partition, send the offset commits.
+        if (batched_groups.groups.size() == groups_per_batch) {
             auto errc = co_await recover_groups(
               req.offsets_ntp.tp.partition,
               std::move(batched_groups),
@@ -232,6 +273,20 @@ ss::future<offsets_recovery_reply> offsets_recoverer::recover(
             }
             batched_groups = {};
         }
+        co_await ss::maybe_yield();
+    }
+    // We've processed all groups in the snapshot. Send out any remaining
+    // batches of offset commits.
+    if (!batched_groups.groups.empty()) {
+        auto errc = co_await recover_groups(
+          req.offsets_ntp.tp.partition,
+          std::move(batched_groups),
+          retry_node);
+        if (errc != cluster::errc::success) {
+            reply.ec = errc;
+            co_return reply;
+        }
+        batched_groups = {};
     }
     co_return reply;
 }
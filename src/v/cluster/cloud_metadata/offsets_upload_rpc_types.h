@@ -22,7 +22,7 @@ namespace cluster::cloud_metadata {
 struct offsets_upload_request
   : public serde::envelope<
       offsets_upload_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
 
@@ -35,7 +35,13 @@ struct offsets_upload_request
     // Cluster metadata ID with which to associate the uploaded metadata.
     cluster_metadata_id meta_id;
 
-    auto serde_fields() { return std::tie(cluster_uuid, offsets_ntp, meta_id); }
+    // Paths of the offsets snapshots of the partition in the last cluster
+    // manifest, on top of which a delta snapshot may be uploaded.
+    std::vector<ss::sstring> previous_paths{};
+
+    auto serde_fields() {
+        return std::tie(cluster_uuid, offsets_ntp, meta_id, previous_paths);
+    }
 
     friend bool
     operator==(const offsets_upload_request&, const offsets_upload_request&)
@@ -13,6 +13,7 @@
 #include "cloud_storage_clients/types.h"
 #include "cluster/cloud_metadata/error_outcome.h"
 #include "cluster/cloud_metadata/key_utils.h"
+#include "cluster/cloud_metadata/offsets_snapshot.h"
 #include "cluster/cloud_metadata/types.h"
 #include "cluster/logger.h"
 #include "config/configuration.h"
@@ -25,16 +26,53 @@
 
 #include <seastar/core/lowres_clock.hh>
 
+#include <absl/hash/hash.h>
+
 #include <exception>
 
 namespace cluster::cloud_metadata {
 
+namespace {
+
+size_t offset_key(
+  const ss::sstring& group_id, const model::topic& t, model::partition_id p) {
+    return absl::HashOf(group_id, t, p);
+}
+
+// Regroups the non-empty groups of the given snapshots into snapshots of at
+// most `max_groups` groups.
+std::vector<group_offsets_snapshot> repack_groups(
+  std::vector<group_offsets_snapshot> snaps,
+  model::partition_id pid,
+  size_t max_groups) {
+    std::vector<group_offsets_snapshot> packed;
+    for (auto& snap : snaps) {
+        for (auto& g : snap.groups) {
+            if (g.offsets.empty()) {
+                continue;
+            }
+            if (packed.empty() || packed.back().groups.size() >= max_groups) {
+                packed.emplace_back();
+                packed.back().offsets_topic_pid = pid;
+            }
+            packed.back().groups.emplace_back(std::move(g));
+        }
+    }
+    return packed;
+}
+
+} // namespace
+
 ss::future<offsets_upload_reply>
 offsets_uploader::upload(offsets_upload_request req) {
     auto holder = _gate.hold();
     retry_chain_node parent_node(_as, 30s, 1s);
     auto res = co_await upload(
-      req.cluster_uuid, req.offsets_ntp, req.meta_id, parent_node);
+      req.cluster_uuid,
+      req.offsets_ntp,
+      req.meta_id,
+      parent_node,
+      req.previous_paths);
     offsets_upload_reply reply;
     if (res.has_error()) {
         reply.ec = cluster::errc::partition_operation_failed;
@@ -48,19 +86,79 @@ ss::future<offsets_upload_result> offsets_uploader::upload(
   const model::cluster_uuid& uuid,
   const model::ntp& ntp,
   const cluster_metadata_id& meta_id,
-  retry_chain_node& parent_node) {
+  retry_chain_node& parent_node,
+  const std::vector<ss::sstring>& previous_paths) {
     vlog(clusterlog.debug, "Requested to upload offsets from {}", ntp);
     auto holder = _gate.hold();
     _as.check();
+    auto units = co_await _lock.get_units(_as);
+    const auto pid = ntp.tp.partition;
+    const auto max_groups
+      = config::shard_local_cfg()
+          .cloud_storage_cluster_metadata_num_consumer_groups_per_upload();
     auto snap_res = co_await _group_manager.local().snapshot_groups(
-      ntp,
-      config::shard_local_cfg()
-        .cloud_storage_cluster_metadata_num_consumer_groups_per_upload());
+      ntp, max_groups);
     if (snap_res.has_error()) {
         co_return snap_res.error();
     }
-    size_t snap_idx = 0;
     auto& snaps = snap_res.value();
+
+    auto prev_it = _uploaded.find(pid);
+    const bool is_delta
+      = prev_it != _uploaded.end() && prev_it->second.cluster_uuid == uuid
+        && prev_it->second.meta_id < meta_id
+        && prev_it->second.paths == previous_paths
+        && prev_it->second.num_deltas
+             < config::shard_local_cfg()
+                 .cloud_storage_cluster_metadata_max_offsets_deltas();
+
+    // The offsets of this upload: all of them for a full snapshot, only those
+    // that changed since the previous upload for a delta.
+    absl::flat_hash_map<size_t, kafka::offset> offsets;
+    for (auto& snap : snaps) {
+        for (auto& g : snap.groups) {
+            fragmented_vector<group_offsets::topic_partitions> changed_topics;
+            for (auto& tp : g.offsets) {
+                fragmented_vector<group_offsets::partition_offset> changed;
+                for (const auto& po : tp.partitions) {
+                    auto key = offset_key(g.group_id, tp.topic, po.partition);
+                    if (is_delta) {
+                        auto it = prev_it->second.offsets.find(key);
+                        if (
+                          it != prev_it->second.offsets.end()
+                          && it->second == po.offset) {
+                            continue;
+                        }
+                        changed.push_back(po);
+                    }
+                    offsets.emplace(key, po.offset);
+                }
+                if (!changed.empty()) {
+                    changed_topics.emplace_back(tp.topic, std::move(changed));
+                }
+            }
+            if (is_delta) {
+                g.offsets = std::move(changed_topics);
+            }
+            co_await ss::maybe_yield();
+        }
+    }
+    if (is_delta) {
+        if (offsets.empty()) {
+            vlog(clusterlog.debug, "No offsets changed on {}", ntp);
+            co_return offsets_upload_paths{.paths = prev_it->second.paths};
+        }
+        snaps = repack_groups(std::move(snaps), pid, max_groups);
+        vlog(
+          clusterlog.debug,
+          "Uploading {} changed offsets of {} in {} delta snapshots",
+          offsets.size(),
+          ntp,
+          snaps.size());
+    }
+
+    size_t snap_idx = 0;
+    bool all_uploaded = true;
     offsets_upload_paths paths;
     for (auto& snap : snaps) {
         retry_chain_node retry_node(&parent_node);
@@ -73,6 +171,8 @@ ss::future<offsets_upload_result> offsets_uploader::upload(
               _bucket, remote_key, std::move(buf), retry_node);
             if (upload_res == cloud_storage::upload_result::success) {
                 paths.paths.emplace_back(remote_key().c_str());
+            } else {
+                all_uploaded = false;
             }
         } catch (...) {
             auto eptr = std::current_exception();
@@ -85,6 +185,36 @@ ss::future<offsets_upload_result> offsets_uploader::upload(
             co_return error_outcome::upload_failed;
         }
     }
+    if (is_delta) {
+        // A missing delta would silently lose the changes it carries.
+        if (!all_uploaded) {
+            co_return error_outcome::upload_failed;
+        }
+        auto& prev = prev_it->second;
+        for (auto& [key, o] : offsets) {
+            prev.offsets.insert_or_assign(key, o);
+        }
+        std::move(
+          paths.paths.begin(),
+          paths.paths.end(),
+          std::back_inserter(prev.paths));
+        prev.meta_id = meta_id;
+        ++prev.num_deltas;
+        co_return offsets_upload_paths{.paths = prev.paths};
+    }
+    if (all_uploaded) {
+        _uploaded.insert_or_assign(
+          pid,
+          uploaded_offsets{
+            .cluster_uuid = uuid,
+            .meta_id = meta_id,
+            .paths = paths.paths,
+            .offsets = std::move(offsets),
+          });
+    } else {
+        // Only a complete snapshot can be the base of deltas.
+        _uploaded.erase(pid);
+    }
     co_return paths;
 }
 
@@ -17,11 +17,14 @@
 #include "kafka/server/fwd.h"
 #include "outcome.h"
 #include "seastarx.h"
+#include "utils/mutex.h"
 #include "utils/retry_chain_node.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/sharded.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 namespace cluster::cloud_metadata {
 
 struct offsets_upload_paths {
@@ -30,6 +33,15 @@ struct offsets_upload_paths {
 using offsets_upload_result = result<offsets_upload_paths, error_outcome>;
 
 // Encapsulates uploading an offsets snapshot to S3.
+//
+// The first upload of an offsets partition is a full snapshot of its groups.
+// The following uploads are deltas, with only the offsets that changed since
+// the previous upload, as long as the previous upload is the one the caller
+// still references. Every
+// cloud_storage_cluster_metadata_max_offsets_deltas uploads the deltas are
+// consolidated into a new full snapshot. The returned paths are those of the
+// last full snapshot followed by the deltas uploaded since, and are meant to
+// be applied in order.
 class offsets_uploader {
 public:
     offsets_uploader(
@@ -53,13 +65,32 @@ public:
 
     ss::future<offsets_upload_reply> upload(offsets_upload_request req);
 
+    // Uploads the offsets of the given offsets partition. `previous_paths`
+    // are the paths of the partition in the last cluster manifest: a delta is
+    // only uploaded on top of them.
     ss::future<offsets_upload_result> upload(
       const model::cluster_uuid& uuid,
       const model::ntp&,
       const cluster_metadata_id& meta_id,
-      retry_chain_node& retry_node);
+      retry_chain_node& retry_node,
+      const std::vector<ss::sstring>& previous_paths = {});
 
 private:
+    // What this shard uploaded for an offsets partition: the paths of the
+    // last full snapshot and of the deltas uploaded since, and the offsets
+    // they contain, keyed by hash of group, topic and partition.
+    struct uploaded_offsets {
+        model::cluster_uuid cluster_uuid;
+        cluster_metadata_id meta_id;
+        std::vector<ss::sstring> paths;
+        size_t num_deltas{0};
+        absl::flat_hash_map<size_t, kafka::offset> offsets;
+    };
+
+    // Serializes uploads, which build on each other's state.
+    mutex _lock{"offsets_uploader"};
+    absl::flat_hash_map<model::partition_id, uploaded_offsets> _uploaded;
+
     ss::abort_source _as;
     ss::gate _gate;
     const cloud_storage_clients::bucket_name _bucket;
@@ -482,6 +482,69 @@ FIXTURE_TEST(test_upload_offsets_batched, offsets_recovery_fixture) {
     validate_downloaded_offsets(*this, committed_offsets, remote_paths).get();
 }
 
+FIXTURE_TEST(test_upload_offsets_delta, offsets_recovery_fixture) {
+    make_partitions(1).get();
+    auto client = make_connected_client();
+    auto stop_client = ss::defer([&client]() { client.stop().get(); });
+    auto groups = group_ids("test_group", 30);
+    auto members = create_groups(client, groups).get();
+    auto committed_offsets = commit_random_offsets(client, members).get();
+
+    retry_chain_node retry_node(
+      never_abort, ss::lowres_clock::time_point::max(), 10ms);
+    offsets_uploader uploader(
+      bucket, app._group_manager, app.cloud_storage_api);
+    auto stop_uploader = ss::defer([&uploader] { uploader.stop().get(); });
+    std::vector<std::vector<ss::sstring>> full_paths;
+    for (const auto& ntp : offset_ntps) {
+        auto res = uploader
+                     .upload(
+                       cluster_uuid, ntp, cluster_metadata_id{0}, retry_node)
+                     .get();
+        BOOST_REQUIRE(!res.has_error());
+        full_paths.emplace_back(std::move(res.value().paths));
+    }
+
+    // Move the offset of a single group.
+    const auto& [gid, mid] = *members.begin();
+    committed_offsets[gid] += 1;
+    auto t = kafka::offset_commit_request_topic{
+      .name = topic_name,
+      .partitions = {
+        {.partition_index = model::partition_id{0},
+         .committed_offset = model::offset{committed_offsets[gid]},
+         .committed_metadata{mid()}}}};
+    client.consumer_offset_commit(gid, mid, {std::move(t)}).get();
+
+    // Only the partition that manages the group uploads a delta, on top of
+    // its full snapshot.
+    std::vector<cloud_storage::remote_segment_path> remote_paths;
+    size_t num_deltas = 0;
+    for (const auto& ntp : offset_ntps) {
+        const auto& prev = full_paths[ntp.tp.partition()];
+        auto res = uploader
+                     .upload(
+                       cluster_uuid,
+                       ntp,
+                       cluster_metadata_id{1},
+                       retry_node,
+                       prev)
+                     .get();
+        BOOST_REQUIRE(!res.has_error());
+        const auto& paths = res.value().paths;
+        BOOST_REQUIRE_GE(paths.size(), prev.size());
+        BOOST_REQUIRE(std::equal(prev.begin(), prev.end(), paths.begin()));
+        num_deltas += paths.size() - prev.size();
+        for (const auto& p : paths) {
+            remote_paths.emplace_back(p);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(num_deltas, 1);
+
+    // Applied in order, the snapshots have the latest offsets.
+    validate_downloaded_offsets(*this, committed_offsets, remote_paths).get();
+}
+
 FIXTURE_TEST(test_local_recovery, offsets_recovery_fixture) {
     make_partitions(1).get();
     constexpr const auto num_groups = 30;
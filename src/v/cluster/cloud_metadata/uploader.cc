@@ -165,6 +165,10 @@ ss::future<error_outcome> uploader::upload_next_metadata(
             req.offsets_ntp = model::ntp{nt.ns, nt.tp, model::partition_id{i}};
             req.cluster_uuid = _cluster_uuid;
             req.meta_id = manifest.metadata_id;
+            const auto& prev_paths = manifest.offsets_snapshots_by_partition;
+            if (static_cast<size_t>(i) < prev_paths.size()) {
+                req.previous_paths = prev_paths[i];
+            }
             vlog(
               clusterlog.debug,
               "Requesting offsets upload of {}",
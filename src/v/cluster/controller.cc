@@ -208,8 +208,13 @@ ss::future<> controller::start(
       })
       .then([this](consensus_ptr c) { _raft0 = c; })
       .then([this] { return _partition_leaders.start(std::ref(_tp_state)); })
-      .then(
-        [this] { return _drain_manager.start(std::ref(_partition_manager)); })
+      .then([this] {
+          return _drain_manager.start(
+            std::ref(_partition_manager), ss::sharded_parameter([] {
+                return config::shard_local_cfg()
+                  .maintenance_mode_transfer_limit_per_node.bind();
+            }));
+      })
       .then([this] {
           return _members_manager.start_single(
             _raft0,
@@ -408,6 +413,10 @@ ss::future<> controller::start(
                 return config::shard_local_cfg()
                   .initial_retention_local_target_ms_default.bind();
             }),
+            ss::sharded_parameter([] {
+                return config::shard_local_cfg()
+                  .initial_retention_use_local_target.bind();
+            }),
             std::ref(_as));
       })
       .then(
@@ -615,6 +624,8 @@ ss::future<> controller::start(
               .partition_autobalancing_tick_interval_ms.bind(),
             config::shard_local_cfg()
               .partition_autobalancing_concurrent_moves.bind(),
+            config::shard_local_cfg()
+              .partition_autobalancing_concurrent_moves_per_node.bind(),
             config::shard_local_cfg()
               .partition_autobalancing_tick_moves_drop_threshold.bind(),
             config::shard_local_cfg().segment_fallocation_step.bind(),
@@ -151,6 +151,10 @@ bool are_configuration_replicas_up_to_date(
     for (auto& id : cfg.current_config().voters) {
         all_ids.emplace(id.id());
     }
+    // observers are replicas of the assignment which do not vote
+    for (auto& id : cfg.current_config().observers) {
+        all_ids.emplace(id.id());
+    }
 
     // there is different number of brokers in group configuration
     if (all_ids.size() != requested_replicas.size()) {
@@ -263,6 +267,7 @@ controller_backend::controller_backend(
   config::binding<std::optional<size_t>> initial_retention_local_target_bytes,
   config::binding<std::optional<std::chrono::milliseconds>>
     initial_retention_local_target_ms,
+  config::binding<bool> initial_retention_use_local_target,
   ss::sharded<ss::abort_source>& as)
   : _topics(tp_state)
   , _shard_table(st)
@@ -280,6 +285,8 @@ controller_backend::controller_backend(
       std::move(initial_retention_local_target_bytes))
   , _initial_retention_local_target_ms(
       std::move(initial_retention_local_target_ms))
+  , _initial_retention_use_local_target(
+      std::move(initial_retention_use_local_target))
   , _as(as) {}
 
 bool controller_backend::command_based_membership_active() const {
@@ -501,17 +508,36 @@ controller_backend::calculate_learner_initial_offset(
     /**
      * Calculate retention targets based on cluster and topic configuration
      */
-    const auto initial_retention_bytes = get_topic_property(
+    auto initial_retention_bytes = get_topic_property(
       _initial_retention_local_target_bytes(),
       log->config().has_overrides()
         ? log->config().get_overrides().initial_retention_local_target_bytes
         : tristate<size_t>{std::nullopt});
 
-    const auto initial_retention_ms = get_topic_property(
+    auto initial_retention_ms = get_topic_property(
       _initial_retention_local_target_ms(),
       log->config().has_overrides()
         ? log->config().get_overrides().initial_retention_local_target_ms
         : tristate<std::chrono::milliseconds>{std::nullopt});
+    /**
+     * Without an initial target retention the learner may start at the local
+     * retention target of the partition, it is the boundary the leader
+     * retains its local log to, the data below it are in the cloud storage.
+     */
+    if (
+      !initial_retention_bytes.has_value() && !initial_retention_ms.has_value()
+      && _initial_retention_use_local_target()) {
+        initial_retention_bytes = get_topic_property(
+          config::shard_local_cfg().retention_local_target_bytes_default(),
+          log->config().has_overrides()
+            ? log->config().get_overrides().retention_local_target_bytes
+            : tristate<size_t>{std::nullopt});
+        initial_retention_ms = get_topic_property(
+          config::shard_local_cfg().retention_local_target_ms_default(),
+          log->config().has_overrides()
+            ? log->config().get_overrides().retention_local_target_ms
+            : tristate<std::chrono::milliseconds>{std::nullopt});
+    }
     /**
      * Initial target retention disabled
      */
@@ -207,6 +207,7 @@ public:
         initial_retention_local_target_bytes,
       config::binding<std::optional<std::chrono::milliseconds>>
         initial_retention_local_target_ms,
+      config::binding<bool> initial_retention_use_local_target,
       ss::sharded<seastar::abort_source>&);
 
     ss::future<> stop();
@@ -417,6 +418,7 @@ private:
       _initial_retention_local_target_bytes;
     config::binding<std::optional<std::chrono::milliseconds>>
       _initial_retention_local_target_ms;
+    config::binding<bool> _initial_retention_use_local_target;
     ss::sharded<ss::abort_source>& _as;
 
     absl::btree_map<model::ntp, ntp_reconciliation_state> _states;
@@ -11,110 +11,31 @@
 
 #include "cluster/controller_snapshot.h"
 
-namespace cluster {
-
-namespace controller_snapshot_parts {
-
-template<typename Vec>
-ss::future<> write_vector_async(iobuf& out, Vec t) {
-    if (unlikely(t.size() > std::numeric_limits<serde::serde_size_t>::max())) {
-        throw serde::serde_exception(fmt_with_ctx(
-          ssx::sformat,
-          "serde: vector size {} exceeds serde_size_t",
-          t.size()));
-    }
-    serde::write(out, static_cast<serde::serde_size_t>(t.size()));
-    return ss::do_with(std::move(t), [&out](Vec& t) {
-        return ss::do_for_each(
-          t, [&out](auto& el) { serde::write(out, std::move(el)); });
-    });
-}
+#include "bytes/iostream.h"
+#include "hashing/crc32c.h"
+#include "serde/serde_exception.h"
+#include "ssx/sformat.h"
+#include "units.h"
 
-template<typename Map>
-ss::future<> write_map_async(iobuf& out, Map t) {
-    using serde::write;
-    if (unlikely(t.size() > std::numeric_limits<serde::serde_size_t>::max())) {
-        throw serde::serde_exception(fmt_with_ctx(
-          ssx::sformat, "serde: map size {} exceeds serde_size_t", t.size()));
-    }
-    write(out, static_cast<serde::serde_size_t>(t.size()));
-    return ss::do_with(std::move(t), [&out](Map& t) {
-        return ss::do_for_each(t, [&out](auto& el) {
-            write(out, el.first);
-            return serde::write_async(out, std::move(el.second));
-        });
-    });
-}
+#include <seastar/coroutine/maybe_yield.hh>
 
-template<typename T>
-concept Reservable = requires(T t) { t.reserve(0U); };
-
-template<typename Vec>
-ss::future<Vec>
-read_vector_async_nested(iobuf_parser& in, std::size_t const bytes_left_limit) {
-    using value_type = typename Vec::value_type;
-    const auto size = serde::read_nested<serde::serde_size_t>(
-      in, bytes_left_limit);
-    return ss::do_with(Vec{}, [size, &in, bytes_left_limit](Vec& t) {
-        if constexpr (Reservable<Vec>) {
-            t.reserve(size);
-        }
-        return ss::do_until(
-                 [size, &t] { return t.size() == size; },
-                 [&t, &in, bytes_left_limit] {
-                     t.push_back(
-                       serde::read_nested<value_type>(in, bytes_left_limit));
-                     return ss::now();
-                 })
-          .then([&t] {
-              t.shrink_to_fit();
-              return std::move(t);
-          });
-    });
-}
+namespace cluster {
 
-template<typename Map>
-ss::future<Map>
-read_map_async_nested(iobuf_parser& in, std::size_t const bytes_left_limit) {
-    using key_type = typename Map::key_type;
-    using mapped_type = typename Map::mapped_type;
-    const auto size = serde::read_nested<serde::serde_size_t>(
-      in, bytes_left_limit);
-    return ss::do_with(Map{}, [size, &in, bytes_left_limit](Map& t) {
-        if constexpr (Reservable<Map>) {
-            t.reserve(size);
-        }
-        return ss::do_until(
-                 [size, &t] { return t.size() == size; },
-                 [&t, &in, bytes_left_limit] {
-                     return serde::read_async_nested<key_type>(
-                              in, bytes_left_limit)
-                       .then([&t, &in, bytes_left_limit](auto key) {
-                           return serde::read_async_nested<mapped_type>(
-                                    in, bytes_left_limit)
-                             .then(
-                               [&t, key = std::move(key)](auto val) mutable {
-                                   t.emplace(std::move(key), std::move(val));
-                               });
-                       });
-                 })
-          .then([&t] { return std::move(t); });
-    });
-}
+namespace controller_snapshot_parts {
 
 ss::future<> topics_t::topic_t::serde_async_write(iobuf& out) {
     serde::write(out, metadata);
-    co_await write_map_async(out, std::move(partitions));
-    co_await write_map_async(out, std::move(updates));
+    co_await serde::write_async(out, std::move(partitions));
+    co_await serde::write_async(out, std::move(updates));
     serde::write(out, disabled_set);
 }
 
 ss::future<>
 topics_t::topic_t::serde_async_read(iobuf_parser& in, serde::header const h) {
     metadata = serde::read_nested<decltype(metadata)>(in, h._bytes_left_limit);
-    partitions = co_await read_map_async_nested<decltype(partitions)>(
+    partitions = co_await serde::read_async_nested<decltype(partitions)>(
       in, h._bytes_left_limit);
-    updates = co_await read_map_async_nested<decltype(updates)>(
+    updates = co_await serde::read_async_nested<decltype(updates)>(
       in, h._bytes_left_limit);
     if (h._version >= 1) {
         disabled_set = serde::read_nested<decltype(disabled_set)>(
@@ -127,25 +48,25 @@ topics_t::topic_t::serde_async_read(iobuf_parser& in, serde::header const h) {
 }
 
 ss::future<> topics_t::serde_async_write(iobuf& out) {
-    co_await write_map_async(out, std::move(topics));
+    co_await serde::write_async(out, std::move(topics));
     serde::write(out, highest_group_id);
-    co_await write_map_async(out, std::move(lifecycle_markers));
-    co_await write_map_async(out, partitions_to_force_recover);
+    co_await serde::write_async(out, std::move(lifecycle_markers));
+    co_await serde::write_async(out, partitions_to_force_recover);
 }
 
 ss::future<>
 topics_t::serde_async_read(iobuf_parser& in, serde::header const h) {
-    topics = co_await read_map_async_nested<decltype(topics)>(
+    topics = co_await serde::read_async_nested<decltype(topics)>(
       in, h._bytes_left_limit);
     highest_group_id = serde::read_nested<decltype(highest_group_id)>(
       in, h._bytes_left_limit);
     lifecycle_markers
-      = co_await read_map_async_nested<decltype(lifecycle_markers)>(
+      = co_await serde::read_async_nested<decltype(lifecycle_markers)>(
         in, h._bytes_left_limit);
 
     if (h._version >= 1) {
         partitions_to_force_recover
-          = co_await read_map_async_nested<force_recoverable_partitions_t>(
+          = co_await serde::read_async_nested<force_recoverable_partitions_t>(
             in, h._bytes_left_limit);
     }
 
@@ -155,16 +76,16 @@ topics_t::serde_async_read(iobuf_parser& in, serde::header const h) {
 }
 
 ss::future<> security_t::serde_async_write(iobuf& out) {
-    co_await write_vector_async(out, std::move(user_credentials));
-    co_await write_vector_async(out, std::move(acls));
+    co_await serde::write_async(out, std::move(user_credentials));
+    co_await serde::write_async(out, std::move(acls));
 }
 
 ss::future<>
 security_t::serde_async_read(iobuf_parser& in, serde::header const h) {
     user_credentials
-      = co_await read_vector_async_nested<decltype(user_credentials)>(
+      = co_await serde::read_async_nested<decltype(user_credentials)>(
         in, h._bytes_left_limit);
-    acls = co_await read_vector_async_nested<decltype(acls)>(
+    acls = co_await serde::read_async_nested<decltype(acls)>(
       in, h._bytes_left_limit);
 
     if (in.bytes_left() > h._bytes_left_limit) {
@@ -219,4 +140,133 @@ controller_snapshot::serde_async_read(iobuf_parser& in, serde::header const h) {
     }
 }
 
+namespace {
+
+// version, compat_version and size
+constexpr size_t envelope_header_size = 2 * sizeof(serde::version_t)
+                                        + sizeof(serde::serde_size_t);
+
+// size of the chunks in which sections unknown to this version are skipped
+constexpr size_t skip_chunk_size = 128_KiB;
+
+ss::future<iobuf> read_checksummed(
+  ss::input_stream<char>& in,
+  size_t n,
+  size_t& bytes_left,
+  crc::crc32c& crc) {
+    if (unlikely(n > bytes_left)) {
+        throw serde::serde_exception(ssx::sformat(
+          "controller snapshot section of {} bytes exceeds the {} bytes left",
+          n,
+          bytes_left));
+    }
+    auto buf = co_await read_iobuf_exactly(in, n);
+    if (unlikely(buf.size_bytes() != n)) {
+        throw serde::serde_exception(ssx::sformat(
+          "controller snapshot truncated: read {} bytes out of {}",
+          buf.size_bytes(),
+          n));
+    }
+    bytes_left -= n;
+    for (const auto& frag : buf) {
+        crc.extend(frag.get(), frag.size());
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return buf;
+}
+
+/// Reads the next section envelope from the stream. Only the raw bytes of
+/// this section are held while it is decoded.
+template<typename T>
+ss::future<T> read_section(
+  ss::input_stream<char>& in, size_t& bytes_left, crc::crc32c& crc) {
+    auto buf = co_await read_checksummed(
+      in, envelope_header_size, bytes_left, crc);
+    iobuf_parser header(buf.share(0, buf.size_bytes()));
+    header.skip(2 * sizeof(serde::version_t));
+    auto const size = serde::read_nested<serde::serde_size_t>(header, 0);
+
+    buf.append(co_await read_checksummed(in, size, bytes_left, crc));
+    iobuf_parser parser(std::move(buf));
+    co_return co_await serde::read_async<T>(parser);
+}
+
+} // namespace
+
+ss::future<controller_snapshot>
+controller_snapshot::read_streamed(ss::input_stream<char>& in, size_t size) {
+    constexpr size_t header_size = envelope_header_size
+                                   + sizeof(serde::checksum_t);
+    if (unlikely(size < header_size)) {
+        throw serde::serde_exception(
+          ssx::sformat("controller snapshot too small: {} bytes", size));
+    }
+    iobuf_parser header(co_await read_iobuf_exactly(in, header_size));
+    if (unlikely(header.bytes_left() != header_size)) {
+        throw serde::serde_exception(
+          "controller snapshot truncated: incomplete header");
+    }
+    auto const version = serde::read_nested<serde::version_t>(header, 0);
+    auto const compat_version = serde::read_nested<serde::version_t>(
+      header, 0);
+    size_t const body_size = serde::read_nested<serde::serde_size_t>(
+      header, 0);
+    auto const checksum = serde::read_nested<serde::checksum_t>(header, 0);
+
+    if (unlikely(compat_version > redpanda_serde_version)) {
+        throw serde::serde_exception(ssx::sformat(
+          "controller snapshot compat_version={} > version={}",
+          compat_version,
+          redpanda_serde_version));
+    }
+    if (unlikely(body_size != size - header_size)) {
+        throw serde::serde_exception(ssx::sformat(
+          "controller snapshot size mismatch: envelope={}, file={}",
+          body_size,
+          size - header_size));
+    }
+
+    size_t bytes_left = body_size;
+    crc::crc32c crc;
+    controller_snapshot snap;
+    snap.bootstrap = co_await read_section<decltype(snap.bootstrap)>(
+      in, bytes_left, crc);
+    snap.features = co_await read_section<decltype(snap.features)>(
+      in, bytes_left, crc);
+    snap.members = co_await read_section<decltype(snap.members)>(
+      in, bytes_left, crc);
+    snap.config = co_await read_section<decltype(snap.config)>(
+      in, bytes_left, crc);
+    snap.topics = co_await read_section<decltype(snap.topics)>(
+      in, bytes_left, crc);
+    snap.security = co_await read_section<decltype(snap.security)>(
+      in, bytes_left, crc);
+    snap.metrics_reporter
+      = co_await read_section<decltype(snap.metrics_reporter)>(
+        in, bytes_left, crc);
+    if (version >= 1) {
+        snap.plugins = co_await read_section<decltype(snap.plugins)>(
+          in, bytes_left, crc);
+    }
+    if (version >= 2) {
+        snap.cluster_recovery
+          = co_await read_section<decltype(snap.cluster_recovery)>(
+            in, bytes_left, crc);
+    }
+
+    // sections added by newer versions
+    while (bytes_left > 0) {
+        co_await read_checksummed(
+          in, std::min(bytes_left, skip_chunk_size), bytes_left, crc);
+    }
+
+    if (unlikely(crc.value() != checksum)) {
+        throw serde::serde_exception(ssx::sformat(
+          "controller snapshot has bad checksum: stored={}, actual={}",
+          checksum,
+          crc.value()));
+    }
+    co_return snap;
+}
+
 } // namespace cluster
@@ -21,6 +21,8 @@
 #include "serde/serde.h"
 #include "utils/fragmented_vector.h"
 
+#include <seastar/core/iostream.hh>
+
 #include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
@@ -265,6 +267,14 @@ struct controller_snapshot
 
     ss::future<> serde_async_write(iobuf&);
     ss::future<> serde_async_read(iobuf_parser&, serde::header const);
+
+    /// Reads a serialized snapshot of the given size section by section
+    /// from the stream, so that only the raw bytes of the section being
+    /// decoded are held in memory rather than the whole serialized
+    /// snapshot next to the decoded one. The format is the same as the one
+    /// read by serde::read_async.
+    static ss::future<controller_snapshot>
+    read_streamed(ss::input_stream<char>&, size_t size);
 };
 
 /// A subset of the controller snapshot used to initialize nodes joining
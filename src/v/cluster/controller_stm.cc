@@ -11,7 +11,6 @@
 
 #include "cluster/controller_stm.h"
 
-#include "bytes/iostream.h"
 #include "cluster/controller_snapshot.h"
 #include "cluster/logger.h"
 #include "cluster/members_manager.h"
@@ -154,10 +153,8 @@ ss::future<> controller_stm::apply_snapshot(
       size,
       get_last_applied_offset());
 
-    auto snap_buf_parser = iobuf_parser{
-      co_await read_iobuf_exactly(reader.input(), size)};
-    auto snapshot = co_await serde::read_async<controller_snapshot>(
-      snap_buf_parser);
+    auto snapshot = co_await controller_snapshot::read_streamed(
+      reader.input(), size);
 
     try {
         co_await std::get<bootstrap_backend&>(_state).apply_snapshot(
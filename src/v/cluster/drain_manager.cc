@@ -3,26 +3,70 @@
 #include "cluster/logger.h"
 #include "cluster/partition_manager.h"
 #include "cluster/types.h"
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "random/generators.h"
 #include "vlog.h"
 
+#include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/smp.hh>
-#include <seastar/core/when_all.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <absl/container/flat_hash_set.h>
+
+#include <algorithm>
 
 namespace cluster {
 
 drain_manager::drain_manager(
-  ss::sharded<cluster::partition_manager>& partition_manager)
-  : _partition_manager(partition_manager) {}
+  ss::sharded<cluster::partition_manager>& partition_manager,
+  config::binding<size_t> transfer_limit_per_node)
+  : _partition_manager(partition_manager)
+  , _transfer_limit_per_node(std::move(transfer_limit_per_node)) {}
 
 ss::future<> drain_manager::start() {
     vassert(!_drain.has_value(), "service cannot be restarted");
     vlog(clusterlog.info, "Drain manager starting");
+    setup_metrics();
     _drain = task();
     co_return;
 }
 
+void drain_manager::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cluster:drain_manager"),
+      {
+        sm::make_counter(
+          "leadership_transfers",
+          [this] { return _transferred; },
+          sm::description(
+            "Number of leaderships transferred by the current drain")),
+        sm::make_counter(
+          "leadership_transfer_failures",
+          [this] { return _failed; },
+          sm::description(
+            "Number of failed leadership transfers of the current drain")),
+        sm::make_gauge(
+          "leadership_transfers_in_progress",
+          [this] { return _status.transferring.value_or(0); },
+          sm::description("Number of leadership transfers in progress")),
+        sm::make_gauge(
+          "remaining_leaders",
+          [this] { return _remaining; },
+          sm::description(
+            "Number of leaderships left to transfer in the current round")),
+        sm::make_gauge(
+          "eta_seconds",
+          [this] { return eta_seconds(); },
+          sm::description("Estimated seconds left to drain, 0 if unknown")),
+      });
+}
+
 ss::future<> drain_manager::stop() {
     if (!_drain.has_value()) {
         vlog(clusterlog.info, "Drain manager stopped (was not started)");
@@ -157,6 +201,10 @@ ss::future<> drain_manager::do_drain() {
      */
     _partition_manager.local().block_new_leadership();
 
+    _drain_started = ss::lowres_clock::now();
+    _transferred = 0;
+    _failed = 0;
+
     while (!_restore_requested && !_abort.abort_requested()) {
         /*
          * build a set of eligible partitions. ignore any raft groups that
@@ -186,72 +234,45 @@ ss::future<> drain_manager::do_drain() {
         }
 
         /*
-         * choose a random sample from the set of eligible partitions. this is
-         * useful when we have a draining policy in which we want to drain as
-         * much as possible even if some groups continue to have leadership
-         * transfer errors. an alternative approach would be to fence off groups
-         * experiencing errors, but then we would have to create some type of
-         * retry policy to deal with those partitions.
-         */
-        std::vector<ss::lw_shared_ptr<cluster::partition>> selected;
-        selected.reserve(max_parallel_transfers);
-        std::sample(
-          eligible.begin(),
-          eligible.end(),
-          std::back_inserter(selected),
-          max_parallel_transfers,
-          random_generators::internal::gen);
-        eligible.clear();
-
-        /*
-         * start a group of transfers
+         * transfer the leadership of all eligible partitions. the order is
+         * random so that the groups experiencing transfer errors are not
+         * always the first ones to be retried. a new transfer starts as soon
+         * as one finishes. the eligible partitions are rebuilt after every
+         * round as the transfers may have failed, or some groups may have
+         * regained leadership.
          */
-        std::vector<ss::future<std::error_code>> transfers;
-        transfers.reserve(selected.size());
-        for (auto& p : selected) {
-            auto req = transfer_leadership_request{
-              .group = p->group(),
-            };
-            transfers.push_back(p->transfer_leadership(req));
-        }
-        _status.transferring = transfers.size();
+        std::shuffle(
+          eligible.begin(), eligible.end(), random_generators::internal::gen);
+        auto concurrency = co_await transfer_concurrency(eligible);
+        _remaining = eligible.size();
 
         vlog(
           clusterlog.info,
-          "Draining leadership from {} partitions",
-          transfers.size());
+          "Draining leadership from {} partitions, {} at once",
+          eligible.size(),
+          concurrency);
 
         auto started = ss::lowres_clock::now();
 
-        auto results = co_await ss::when_all(
-          transfers.begin(), transfers.end());
-
-        size_t failed = 0;
-        for (auto& f : results) {
-            try {
-                auto err = f.get();
-                if (err) {
-                    vlog(
-                      clusterlog.debug,
-                      "Draining leadership failed for group: {}",
-                      err);
-                    failed++;
-                }
-            } catch (...) {
-                vlog(
-                  clusterlog.debug,
-                  "Draining leadership failed for group: {}",
-                  std::current_exception());
-                failed++;
-            }
-        }
+        const auto transferred_before = _transferred;
+        const auto failed_before = _failed;
+        co_await ss::max_concurrent_for_each(
+          eligible,
+          concurrency,
+          [this](const ss::lw_shared_ptr<cluster::partition>& p) {
+              return transfer(p);
+          });
+        eligible.clear();
+        _remaining = 0;
+        size_t transferred = _transferred - transferred_before;
+        size_t failed = _failed - failed_before;
         _status.failed = failed;
 
         vlog(
           clusterlog.info,
           "Draining leadership from {} groups {} succeeded",
-          transfers.size(),
-          transfers.size() - failed);
+          transferred + failed,
+          transferred);
 
         /*
          * to avoid spinning, cool off if we failed fast
@@ -271,6 +292,76 @@ ss::future<> drain_manager::do_drain() {
       ss::this_shard_id());
 }
 
+ss::future<> drain_manager::transfer(ss::lw_shared_ptr<cluster::partition> p) {
+    if (
+      _restore_requested || _abort.abort_requested()
+      || !p->is_elected_leader()) {
+        // the drain stopped or the group isn't led by this node anymore
+        _remaining--;
+        co_return;
+    }
+
+    _status.transferring = _status.transferring.value_or(0) + 1;
+    bool ok = false;
+    try {
+        auto err = co_await p->transfer_leadership(
+          transfer_leadership_request{.group = p->group()});
+        if (err) {
+            vlog(
+              clusterlog.debug,
+              "Draining leadership failed for group {}: {}",
+              p->group(),
+              err);
+        } else {
+            ok = true;
+        }
+    } catch (...) {
+        vlog(
+          clusterlog.debug,
+          "Draining leadership failed for group {}: {}",
+          p->group(),
+          std::current_exception());
+    }
+    _status.transferring = _status.transferring.value() - 1;
+    _remaining--;
+    if (ok) {
+        _transferred++;
+    } else {
+        _failed++;
+    }
+}
+
+/*
+ * the leadership of a group moves to one of its followers, so the transfer
+ * limit is per node hosting followers of the groups of this shard: in a larger
+ * cluster the transfers are spread across more nodes.
+ */
+ss::future<size_t> drain_manager::transfer_concurrency(
+  const std::vector<ss::lw_shared_ptr<cluster::partition>>& eligible) const {
+    absl::flat_hash_set<model::node_id> targets;
+    for (const auto& p : eligible) {
+        auto self = p->raft()->self().id();
+        for (const auto& n : p->group_configuration().all_nodes()) {
+            if (n.id() != self) {
+                targets.insert(n.id());
+            }
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return _transfer_limit_per_node()
+      * std::max<size_t>(targets.size(), 1);
+}
+
+double drain_manager::eta_seconds() const {
+    if (_remaining == 0 || _transferred == 0) {
+        return 0;
+    }
+    std::chrono::duration<double> elapsed = ss::lowres_clock::now()
+                                            - _drain_started;
+    return elapsed.count() / static_cast<double>(_transferred)
+           * static_cast<double>(_remaining);
+}
+
 /*
  * Unblock this node from new leadership.
  *
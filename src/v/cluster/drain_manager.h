@@ -10,6 +10,8 @@
  */
 #pragma once
 #include "cluster/fwd.h"
+#include "config/property.h"
+#include "metrics/metrics.h"
 #include "reflection/adl.h"
 #include "seastarx.h"
 #include "serde/serde.h"
@@ -17,6 +19,7 @@
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/util/log.hh>
 
@@ -27,9 +30,13 @@ namespace cluster {
 /*
  * The drain manager is responsible for managing the draining of leadership from
  * a node. It is a core building block for implementing node maintenance mode.
+ *
+ * Every shard transfers the leadership of its groups. The number of transfers
+ * in progress on a shard is limited per node the leadership can move to, so
+ * that a larger cluster drains a node faster, and a new transfer starts as
+ * soon as one finishes rather than once a whole batch did.
  */
 class drain_manager : public ss::peering_sharded_service<drain_manager> {
-    static constexpr size_t max_parallel_transfers = 25;
     static constexpr std::chrono::duration transfer_throttle
       = std::chrono::seconds(5);
 
@@ -40,7 +47,7 @@ public:
      * partitions:   total partitions
      * eligible:     total drain-eligible partitions
      * transferring: total partitions currently transferring
-     * failed:       total transfers failed in last batch
+     * failed:       total transfers failed in last round
      *
      * the optional fields may not be set if draining has been requested, but
      * not yet started. in this case the values are not yet known.
@@ -65,7 +72,9 @@ public:
         }
     };
 
-    explicit drain_manager(ss::sharded<cluster::partition_manager>&);
+    drain_manager(
+      ss::sharded<cluster::partition_manager>&,
+      config::binding<size_t> transfer_limit_per_node);
 
     ss::future<> start();
     ss::future<> stop();
@@ -91,8 +100,14 @@ private:
     ss::future<> task();
     ss::future<> do_drain();
     ss::future<> do_restore();
+    ss::future<> transfer(ss::lw_shared_ptr<cluster::partition>);
+    ss::future<size_t> transfer_concurrency(
+      const std::vector<ss::lw_shared_ptr<cluster::partition>>&) const;
+    double eta_seconds() const;
+    void setup_metrics();
 
     ss::sharded<cluster::partition_manager>& _partition_manager;
+    config::binding<size_t> _transfer_limit_per_node;
     std::optional<ss::future<>> _drain;
     bool _draining_requested{false};
     bool _restore_requested{false};
@@ -100,6 +115,14 @@ private:
     ssx::semaphore _sem{0, "c/drain-mgr"};
     drain_status _status;
     ss::abort_source _abort;
+
+    // progress of the current drain
+    ss::lowres_clock::time_point _drain_started;
+    size_t _transferred{0};
+    size_t _failed{0};
+    // eligible partitions of the current round not yet transferred
+    size_t _remaining{0};
+    metrics::internal_metric_groups _metrics;
 };
 
 } // namespace cluster
@@ -49,6 +49,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 namespace cluster {
 
@@ -74,7 +75,9 @@ health_monitor_backend::health_monitor_backend(
   , _feature_table(feature_table)
   , _partition_leaders_table(partition_leaders_table)
   , _topic_table(topic_table)
-  , _local_monitor(local_monitor) {
+  , _local_monitor(local_monitor)
+  , _next_report_version(random_generators::get_int<int64_t>(
+      0, std::numeric_limits<int64_t>::max() / 2)) {
     _leadership_notification_handle
       = _raft_manager.local().register_leadership_notification(
         [this](
@@ -120,6 +123,7 @@ ss::future<> health_monitor_backend::stop() {
 
     auto f = _gate.close();
     _refresh_mutex.broken();
+    _report_delta_mutex.broken();
     abort_current_refresh();
 
     if (_refresh_request) {
@@ -371,6 +375,7 @@ health_monitor_backend::dispatch_refresh_cluster_health_request(
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
     _reports.clear();
+    _report_versions.clear();
     for (auto& n_report : reply.value().report->node_reports) {
         const auto id = n_report.id;
 
@@ -502,17 +507,79 @@ health_monitor_backend::collect_remote_node_health(model::node_id id) {
         ss::this_shard_id(),
         id,
         max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
+        [timeout, last_version = reported_version(id)](
+          controller_client_protocol client) mutable {
             return client.collect_node_health_report(
-              get_node_health_request{.filter = node_report_filter{}},
+              get_node_health_request{
+                .filter = node_report_filter{}, .last_version = last_version},
               rpc::client_opts(timeout));
         })
       .then(&rpc::get_ctx_data<get_node_health_reply>)
+      .then([this, id](result<get_node_health_reply> reply) {
+          return apply_node_reply_delta(id, std::move(reply));
+      })
       .then([this, id](result<get_node_health_reply> reply) {
           return process_node_reply(id, std::move(reply));
       });
 }
 
+std::optional<node_health_report_version>
+health_monitor_backend::reported_version(model::node_id id) const {
+    // a delta can only be applied on top of the report it was computed from
+    if (!_reports.contains(id)) {
+        return std::nullopt;
+    }
+    auto it = _report_versions.find(id);
+    if (it == _report_versions.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::apply_node_reply_delta(
+  model::node_id id, result<get_node_health_reply> reply) {
+    if (!reply || !reply.value().report.has_value()) {
+        _report_versions.erase(id);
+        co_return reply;
+    }
+    auto& r = reply.value();
+    if (r.delta_base.has_value()) {
+        auto report_it = _reports.find(id);
+        if (
+          report_it == _reports.end()
+          || reported_version(id) != r.delta_base) {
+            vlog(
+              clusterlog.warn,
+              "received health report delta from {} based on unknown version "
+              "{}",
+              id,
+              *r.delta_base);
+            _report_versions.erase(id);
+            co_return make_error_code(errc::error_collecting_health_report);
+        }
+        vlog(
+          clusterlog.trace,
+          "applying health report delta from {}: {} topics changed, {} with "
+          "removed partitions",
+          id,
+          r.report->topics.size(),
+          r.removed_partitions.size());
+        r.report->topics = co_await apply_partition_statuses_delta(
+          report_it->second.topics,
+          std::move(r.report->topics),
+          r.removed_partitions);
+        r.delta_base = std::nullopt;
+        r.removed_partitions.clear();
+    }
+    if (r.version.has_value()) {
+        _report_versions.insert_or_assign(id, *r.version);
+    } else {
+        _report_versions.erase(id);
+    }
+    co_return reply;
+}
+
 result<node_health_report>
 map_reply_result(result<get_node_health_reply> reply) {
     if (!reply) {
@@ -644,6 +711,36 @@ ss::future<std::error_code> health_monitor_backend::collect_cluster_health() {
     co_return errc::success;
 }
 
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::collect_current_node_health_delta(
+  std::optional<node_health_report_version> last_version) {
+    auto units = co_await _report_delta_mutex.get_units();
+    auto res = co_await collect_current_node_health(node_report_filter{});
+    if (!res) {
+        co_return res.error();
+    }
+    auto& report = res.value();
+    auto statuses = co_await index_partition_statuses(report.topics);
+
+    get_node_health_reply reply{.error = errc::success};
+    if (
+      last_version.has_value() && _last_reported.has_value()
+      && _last_reported->version == *last_version) {
+        auto delta = co_await diff_partition_statuses(
+          report.topics, statuses, _last_reported->statuses);
+        report.topics = std::move(delta.changed);
+        reply.removed_partitions = std::move(delta.removed);
+        reply.delta_base = last_version;
+    }
+    reply.version = _next_report_version;
+    _next_report_version = node_health_report_version{
+      _next_report_version() + 1};
+    _last_reported = reported_partitions{
+      .version = *reply.version, .statuses = std::move(statuses)};
+    reply.report = std::move(report);
+    co_return reply;
+}
+
 ss::future<result<node_health_report>>
 health_monitor_backend::collect_current_node_health(node_report_filter filter) {
     vlog(clusterlog.debug, "collecting health report with filter: {}", filter);
@@ -12,6 +12,7 @@
 #pragma once
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
+#include "cluster/health_report_delta.h"
 #include "cluster/node/local_monitor.h"
 #include "features/feature_table.h"
 #include "model/metadata.h"
@@ -71,6 +72,16 @@ public:
     ss::future<result<node_health_report>>
       collect_current_node_health(node_report_filter);
 
+    /**
+     * Collects the statuses of all the partitions of the current node for a
+     * requester holding the report of the given version. If this node sent
+     * that version, the reply only contains the partition statuses that
+     * changed since then.
+     */
+    ss::future<result<get_node_health_reply>>
+      collect_current_node_health_delta(
+        std::optional<node_health_report_version>);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -139,6 +150,10 @@ private:
 
     result<node_health_report>
       process_node_reply(model::node_id, result<get_node_health_reply>);
+    std::optional<node_health_report_version>
+      reported_version(model::node_id) const;
+    ss::future<result<get_node_health_reply>>
+      apply_node_reply_delta(model::node_id, result<get_node_health_reply>);
 
     std::chrono::milliseconds max_metadata_age();
     void abort_current_refresh();
@@ -194,10 +209,24 @@ private:
     storage::disk_space_alert _reports_disk_health
       = storage::disk_space_alert::ok;
     last_reply_cache_t _last_replies;
+    // versions of the reports in _reports, collected by this node as leader
+    absl::node_hash_map<model::node_id, node_health_report_version>
+      _report_versions;
     std::optional<size_t> _bytes_in_cloud_storage;
 
     ss::gate _gate;
     mutex _refresh_mutex;
+
+    // partition statuses last reported by this node
+    struct reported_partitions {
+        node_health_report_version version;
+        partition_statuses_index statuses;
+    };
+    std::optional<reported_partitions> _last_reported;
+    // random start, so that a requester can't confuse the versions reported
+    // before and after a restart
+    node_health_report_version _next_report_version;
+    mutex _report_delta_mutex;
     ss::sharded<node::local_monitor>& _local_monitor;
 
     std::vector<std::pair<cluster::notification_id_type, health_node_cb_t>>
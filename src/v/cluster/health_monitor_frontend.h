@@ -59,6 +59,11 @@ public:
     ss::future<result<node_health_report>>
       collect_node_health(node_report_filter);
 
+    // Collects the statuses of all partitions of the current node, only
+    // including the ones changed since the given version when possible
+    ss::future<result<get_node_health_reply>>
+      collect_node_health_delta(std::optional<node_health_report_version>);
+
     // Return status of all nodes
     ss::future<result<std::vector<node_state>>>
       get_nodes_status(model::timeout_clock::time_point);
@@ -55,6 +55,51 @@ bool partitions_filter::matches(
     return false;
 }
 
+ss::future<> topic_status::serde_async_write(iobuf& out) {
+    return serde::write_fields_async(out, *this);
+}
+
+ss::future<>
+topic_status::serde_async_read(iobuf_parser& in, serde::header const h) {
+    return serde::read_fields_async(in, *this, h);
+}
+
+ss::future<> node_health_report::serde_async_write(iobuf& out) {
+    return serde::write_fields_async(out, *this);
+}
+
+ss::future<>
+node_health_report::serde_async_read(iobuf_parser& in, serde::header const h) {
+    return serde::read_fields_async(in, *this, h);
+}
+
+ss::future<> cluster_health_report::serde_async_write(iobuf& out) {
+    return serde::write_fields_async(out, *this);
+}
+
+ss::future<> cluster_health_report::serde_async_read(
+  iobuf_parser& in, serde::header const h) {
+    return serde::read_fields_async(in, *this, h);
+}
+
+ss::future<> get_node_health_reply::serde_async_write(iobuf& out) {
+    return serde::write_fields_async(out, *this);
+}
+
+ss::future<> get_node_health_reply::serde_async_read(
+  iobuf_parser& in, serde::header const h) {
+    return serde::read_fields_async(in, *this, h);
+}
+
+ss::future<> get_cluster_health_reply::serde_async_write(iobuf& out) {
+    return serde::write_fields_async(out, *this);
+}
+
+ss::future<> get_cluster_health_reply::serde_async_read(
+  iobuf_parser& in, serde::header const h) {
+    return serde::read_fields_async(in, *this, h);
+}
+
 std::ostream& operator<<(std::ostream& o, const node_state& s) {
     fmt::print(
       o,
@@ -232,12 +277,29 @@ std::ostream& operator<<(std::ostream& o, const partitions_filter& filter) {
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_request& r) {
     fmt::print(
-      o, "{{filter: {}, current_version: {}}}", r.filter, r.current_version);
+      o,
+      "{{filter: {}, last_version: {}, current_version: {}}}",
+      r.filter,
+      r.last_version,
+      r.current_version);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const removed_topic_partitions& r) {
+    fmt::print(o, "{{topic: {}, partitions: {}}}", r.tp_ns, r.partitions);
     return o;
 }
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_reply& r) {
-    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    fmt::print(
+      o,
+      "{{error: {}, report: {}, version: {}, delta_base: {}, "
+      "removed_partitions: {}}}",
+      r.error,
+      r.report,
+      r.version,
+      r.delta_base,
+      r.removed_partitions);
     return o;
 }
 
@@ -116,6 +116,37 @@ struct topic_status
     friend bool operator==(const topic_status&, const topic_status&);
 
     auto serde_fields() { return std::tie(tp_ns, partitions); }
+
+    ss::future<> serde_async_write(iobuf&);
+    ss::future<> serde_async_read(iobuf_parser&, serde::header const);
+};
+
+/**
+ * Version of the partition statuses reported by a node. A requester holding
+ * the report of a given version gets only the partition statuses that changed
+ * since then.
+ */
+using node_health_report_version
+  = named_type<int64_t, struct node_health_report_version_tag>;
+
+/**
+ * Partitions of a topic that are no longer part of a node health report
+ */
+struct removed_topic_partitions
+  : serde::envelope<
+      removed_topic_partitions,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::topic_namespace tp_ns;
+    std::vector<model::partition_id> partitions;
+
+    friend std::ostream&
+    operator<<(std::ostream&, const removed_topic_partitions&);
+    friend bool
+    operator==(const removed_topic_partitions&, const removed_topic_partitions&)
+      = default;
+
+    auto serde_fields() { return std::tie(tp_ns, partitions); }
 };
 
 /**
@@ -182,6 +213,9 @@ struct node_health_report
         return std::tie(id, local_state, topics, drain_status);
     }
 
+    ss::future<> serde_async_write(iobuf&);
+    ss::future<> serde_async_read(iobuf_parser&, serde::header const);
+
     friend std::ostream& operator<<(std::ostream&, const node_health_report&);
 
     friend bool
@@ -215,6 +249,9 @@ struct cluster_health_report
         return std::tie(
           raft0_leader, node_states, node_reports, bytes_in_cloud_storage);
     }
+
+    ss::future<> serde_async_write(iobuf&);
+    ss::future<> serde_async_read(iobuf_parser&, serde::header const);
 };
 
 struct cluster_health_overview {
@@ -324,7 +361,7 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
 struct get_node_health_request
   : serde::envelope<
       get_node_health_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t initial_version = 0;
@@ -336,6 +373,9 @@ struct get_node_health_request
     static constexpr int8_t current_version = size_bytes_version;
 
     node_report_filter filter;
+    // version of the last report received from the node, if any. Only
+    // meaningful when requesting the statuses of all partitions.
+    std::optional<node_health_report_version> last_version;
     // this field is not serialized
     int8_t decoded_version = current_version;
 
@@ -346,19 +386,25 @@ struct get_node_health_request
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_request&);
 
-    auto serde_fields() { return std::tie(filter); }
+    auto serde_fields() { return std::tie(filter, last_version); }
 };
 
 struct get_node_health_reply
   : serde::envelope<
       get_node_health_reply,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t current_version = 0;
 
     errc error = cluster::errc::success;
     std::optional<node_health_report> report;
+    // version of the partition statuses of the report
+    std::optional<node_health_report_version> version;
+    // when set, the report only contains the partition statuses that changed
+    // since this version, and the removed ones are listed separately
+    std::optional<node_health_report_version> delta_base;
+    std::vector<removed_topic_partitions> removed_partitions;
 
     friend bool
     operator==(const get_node_health_reply&, const get_node_health_reply&)
@@ -367,7 +413,12 @@ struct get_node_health_reply
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_reply&);
 
-    auto serde_fields() { return std::tie(error, report); }
+    auto serde_fields() {
+        return std::tie(error, report, version, delta_base, removed_partitions);
+    }
+
+    ss::future<> serde_async_write(iobuf&);
+    ss::future<> serde_async_read(iobuf_parser&, serde::header const);
 };
 
 struct get_cluster_health_request
@@ -434,6 +485,9 @@ struct get_cluster_health_reply
     operator<<(std::ostream&, const get_cluster_health_reply&);
 
     auto serde_fields() { return std::tie(error, report); }
+
+    ss::future<> serde_async_write(iobuf&);
+    ss::future<> serde_async_read(iobuf_parser&, serde::header const);
 };
 
 } // namespace cluster
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/health_report_delta.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <absl/container/flat_hash_set.h>
+
+namespace cluster {
+
+ss::future<partition_statuses_index>
+index_partition_statuses(const ss::chunked_fifo<topic_status>& topics) {
+    partition_statuses_index index;
+    index.reserve(topics.size());
+    for (const auto& t : topics) {
+        auto& partitions = index[t.tp_ns];
+        partitions.reserve(partitions.size() + t.partitions.size());
+        for (const auto& p : t.partitions) {
+            partitions.insert_or_assign(p.id, p);
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return index;
+}
+
+ss::future<partition_statuses_delta> diff_partition_statuses(
+  const ss::chunked_fifo<topic_status>& current,
+  const partition_statuses_index& current_index,
+  const partition_statuses_index& previous_index) {
+    partition_statuses_delta delta;
+    for (const auto& t : current) {
+        auto prev_it = previous_index.find(t.tp_ns);
+        ss::chunked_fifo<partition_status> changed;
+        for (const auto& p : t.partitions) {
+            if (prev_it != previous_index.end()) {
+                auto p_it = prev_it->second.find(p.id);
+                if (p_it != prev_it->second.end() && p_it->second == p) {
+                    continue;
+                }
+            }
+            changed.push_back(p);
+        }
+        if (!changed.empty()) {
+            delta.changed.emplace_back(t.tp_ns, std::move(changed));
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    for (const auto& [tp_ns, partitions] : previous_index) {
+        auto cur_it = current_index.find(tp_ns);
+        removed_topic_partitions removed{.tp_ns = tp_ns};
+        for (const auto& [id, _] : partitions) {
+            if (
+              cur_it == current_index.end() || !cur_it->second.contains(id)) {
+                removed.partitions.push_back(id);
+            }
+        }
+        if (!removed.partitions.empty()) {
+            delta.removed.push_back(std::move(removed));
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return delta;
+}
+
+namespace {
+struct topic_delta {
+    const topic_status* changed{nullptr};
+    // changed statuses of the partitions present in the base report
+    absl::flat_hash_map<model::partition_id, const partition_status*> updated;
+    absl::flat_hash_set<model::partition_id> removed;
+};
+} // namespace
+
+ss::future<ss::chunked_fifo<topic_status>> apply_partition_statuses_delta(
+  const ss::chunked_fifo<topic_status>& base,
+  ss::chunked_fifo<topic_status> changed,
+  const std::vector<removed_topic_partitions>& removed) {
+    absl::node_hash_map<model::topic_namespace, topic_delta> deltas;
+    for (const auto& t : changed) {
+        auto& d = deltas[t.tp_ns];
+        d.changed = &t;
+        for (const auto& p : t.partitions) {
+            d.updated.emplace(p.id, &p);
+        }
+    }
+    for (const auto& r : removed) {
+        auto& d = deltas[r.tp_ns];
+        d.removed.insert(r.partitions.begin(), r.partitions.end());
+    }
+
+    ss::chunked_fifo<topic_status> ret;
+    ret.reserve(base.size());
+    for (const auto& t : base) {
+        auto d_it = deltas.find(t.tp_ns);
+        if (d_it == deltas.end()) {
+            ret.push_back(t);
+            co_await ss::coroutine::maybe_yield();
+            continue;
+        }
+        auto& d = d_it->second;
+        ss::chunked_fifo<partition_status> partitions;
+        partitions.reserve(t.partitions.size());
+        for (const auto& p : t.partitions) {
+            if (d.removed.contains(p.id)) {
+                continue;
+            }
+            if (auto u_it = d.updated.find(p.id); u_it != d.updated.end()) {
+                partitions.push_back(*u_it->second);
+                d.updated.erase(u_it);
+            } else {
+                partitions.push_back(p);
+            }
+        }
+        // partitions new to the topic
+        if (d.changed) {
+            for (const auto& p : d.changed->partitions) {
+                if (d.updated.contains(p.id)) {
+                    partitions.push_back(p);
+                }
+            }
+        }
+        if (!partitions.empty()) {
+            ret.emplace_back(t.tp_ns, std::move(partitions));
+        }
+        deltas.erase(d_it);
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    // topics new to the report
+    for (auto& t : changed) {
+        if (deltas.contains(t.tp_ns)) {
+            ret.push_back(std::move(t));
+        }
+    }
+    co_return ret;
+}
+
+} // namespace cluster
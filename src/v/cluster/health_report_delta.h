@@ -0,0 +1,60 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/health_monitor_types.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+
+#include <seastar/core/chunked_fifo.hh>
+#include <seastar/core/future.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
+
+#include <vector>
+
+/*
+ * Nodes send the controller leader only the partition statuses that changed
+ * since the last report the leader received from them. The leader applies such
+ * a delta on top of the report it holds to rebuild the full node report.
+ */
+namespace cluster {
+
+/// Partition statuses of a node health report indexed by topic and partition
+using partition_statuses_index = absl::node_hash_map<
+  model::topic_namespace,
+  absl::flat_hash_map<model::partition_id, partition_status>>;
+
+ss::future<partition_statuses_index>
+index_partition_statuses(const ss::chunked_fifo<topic_status>&);
+
+struct partition_statuses_delta {
+    // statuses that are new or differ from the previous report
+    ss::chunked_fifo<topic_status> changed;
+    // partitions of the previous report that are no longer reported
+    std::vector<removed_topic_partitions> removed;
+};
+
+/// Difference between the statuses of the current report, indexed as
+/// `current_index`, and the ones of the previous report.
+ss::future<partition_statuses_delta> diff_partition_statuses(
+  const ss::chunked_fifo<topic_status>& current,
+  const partition_statuses_index& current_index,
+  const partition_statuses_index& previous_index);
+
+/// Statuses of the report obtained by applying the delta to `base`
+ss::future<ss::chunked_fifo<topic_status>> apply_partition_statuses_delta(
+  const ss::chunked_fifo<topic_status>& base,
+  ss::chunked_fifo<topic_status> changed,
+  const std::vector<removed_topic_partitions>& removed);
+
+} // namespace cluster
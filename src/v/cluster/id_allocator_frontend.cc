@@ -25,12 +25,15 @@
 #include "model/namespace.h"
 #include "model/record_batch_reader.h"
 #include "rpc/connection_cache.h"
+#include "ssx/future-util.h"
 #include "vformat.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/do_with.hh>
 #include <seastar/core/sharded.hh>
 
+#include <algorithm>
+
 namespace cluster {
 using namespace std::chrono_literals;
 
@@ -137,8 +140,9 @@ reset_id_handler::process(ss::shard_id shard, reset_id_allocator_request req) {
 ss::future<allocate_id_reply>
 allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
     auto timeout = req.timeout;
+    auto count = std::max<int64_t>(req.count, 1);
     return _partition_manager.invoke_on(
-      shard, _ssg, [timeout](cluster::partition_manager& mgr) mutable {
+      shard, _ssg, [timeout, count](cluster::partition_manager& mgr) mutable {
           auto partition = mgr.get(model::id_allocator_ntp);
           if (!partition) {
               vlog(
@@ -157,8 +161,8 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
               return ss::make_ready_future<allocate_id_reply>(
                 allocate_id_reply{0, errc::topic_not_exists});
           }
-          return stm->allocate_id(timeout).then(
-            [](id_allocator_stm::stm_allocation_result r) {
+          return stm->allocate_ids(count, timeout)
+            .then([](id_allocator_stm::stm_allocation_result r) {
                 if (r.raft_status != raft::errc::success) {
                     vlog(
                       clusterlog.warn,
@@ -167,7 +171,7 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
                     return allocate_id_reply{r.id, errc::replication_error};
                 }
 
-                return allocate_id_reply{r.id, errc::success};
+                return allocate_id_reply{r.id, errc::success, r.count};
             });
       });
 }
@@ -200,26 +204,114 @@ id_allocator_frontend::id_allocator_frontend(
       metadata_cache,
       connection_cache,
       leaders,
-      node_id) {}
+      node_id)
+  , _lease_size(config::shard_local_cfg().id_allocator_lease_size.bind()) {}
+
+ss::future<> id_allocator_frontend::stop() {
+    co_await _gate.close();
+    co_await _allocator_router.shutdown();
+}
 
 ss::future<allocate_id_reply>
 id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
+    if (auto id = take_leased_id(timeout); id) {
+        co_return allocate_id_reply{*id, errc::success};
+    }
     if (!co_await ensure_id_allocator_topic_exists()) {
         co_return allocate_id_reply{0, errc::topic_not_exists};
     }
+    if (_lease_size() > 0) {
+        // the lease may be taken by concurrent callers as soon as it is
+        // refilled, refill it until an id is left for this one
+        while (co_await refill_lease(0, timeout)) {
+            if (auto id = take_leased_id(timeout); id) {
+                co_return allocate_id_reply{*id, errc::success};
+            }
+        }
+        // the error of the leader is returned by the plain allocation
+    }
     co_return co_await _allocator_router.allocate_router::process_or_dispatch(
       allocate_id_request{timeout}, model::id_allocator_ntp, timeout);
 }
 
+int64_t id_allocator_frontend::leased_ids() const {
+    int64_t ids = 0;
+    for (const auto& lease : _leases) {
+        ids += lease.end - lease.next;
+    }
+    return ids;
+}
+
+std::optional<int64_t>
+id_allocator_frontend::take_leased_id(model::timeout_clock::duration timeout) {
+    while (!_leases.empty() && _leases.front().next == _leases.front().end) {
+        _leases.pop_front();
+    }
+    if (_leases.empty()) {
+        return std::nullopt;
+    }
+    auto id = _leases.front().next++;
+    auto low = _lease_size() / 2;
+    if (low > 0 && leased_ids() <= low && _lease_lock.ready()) {
+        ssx::spawn_with_gate(_gate, [this, low, timeout] {
+            return refill_lease(low, timeout).discard_result();
+        });
+    }
+    return id;
+}
+
+ss::future<bool> id_allocator_frontend::refill_lease(
+  int64_t low, model::timeout_clock::duration timeout) {
+    auto units = co_await _lease_lock.get_units();
+    if (leased_ids() > low) {
+        co_return true;
+    }
+    auto size = static_cast<int64_t>(_lease_size());
+    if (size <= 0) {
+        co_return false;
+    }
+    auto reply
+      = co_await _allocator_router.allocate_router::process_or_dispatch(
+        allocate_id_request{timeout, size}, model::id_allocator_ntp, timeout);
+    if (reply.ec != errc::success) {
+        vlog(clusterlog.warn, "can't lease producer ids: {}", reply.ec);
+        co_return false;
+    }
+    vlog(
+      clusterlog.trace,
+      "leased producer ids [{}, {})",
+      reply.id,
+      reply.id + reply.count);
+    auto next = std::max(reply.id, _lease_floor);
+    auto end = reply.id + reply.count;
+    if (next < end) {
+        _leases.push_back(id_lease{.next = next, .end = end});
+    }
+    co_return true;
+}
+
+void id_allocator_frontend::drop_leases_below(int64_t id) {
+    _lease_floor = std::max(_lease_floor, id);
+    std::erase_if(
+      _leases, [id](const id_lease& lease) { return lease.next < id; });
+}
+
 ss::future<reset_id_allocator_reply> id_allocator_frontend::reset_next_id(
   model::producer_id pid, model::timeout_clock::duration timeout) {
     if (!co_await ensure_id_allocator_topic_exists()) {
         co_return reset_id_allocator_reply{errc::topic_not_exists};
     }
-    co_return co_await _id_reset_router.reset_id_router::process_or_dispatch(
-      reset_id_allocator_request{timeout, pid},
-      model::id_allocator_ntp,
-      timeout);
+    auto reply
+      = co_await _id_reset_router.reset_id_router::process_or_dispatch(
+        reset_id_allocator_request{timeout, pid},
+        model::id_allocator_ntp,
+        timeout);
+    if (reply.ec == errc::success) {
+        // the ids leased on this node before the reset may be in use
+        co_await container().invoke_on_all(
+          [id = pid()](id_allocator_frontend& f) { f.drop_leases_below(id); });
+    }
+    co_return reply;
 }
 
 ss::future<bool> id_allocator_frontend::try_create_id_allocator_topic() {
@@ -13,12 +13,17 @@
 #include "cluster/id_allocator_service.h"
 #include "cluster/leader_router.h"
 #include "cluster/types.h"
+#include "config/property.h"
 #include "rpc/fwd.h"
+#include "utils/mutex.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
+#include <deque>
+#include <optional>
 #include <vector>
 
 namespace cluster {
@@ -133,7 +138,13 @@ private:
 //
 // when the service recieves a call it triggers id_allocator_frontend
 // which in its own turn pass the request to the id_allocator_stm
-class id_allocator_frontend {
+//
+// when id_allocator_lease_size is set every shard leases a block of ids
+// and serves allocate_id from it, so that a burst of producers doesn't
+// turn into a burst of requests to the leader. the lease is refilled in
+// the background once half of it is used.
+class id_allocator_frontend
+  : public ss::peering_sharded_service<id_allocator_frontend> {
 public:
     id_allocator_frontend(
       ss::smp_service_group,
@@ -151,7 +162,7 @@ public:
     ss::future<reset_id_allocator_reply>
     reset_next_id(model::producer_id, model::timeout_clock::duration timeout);
 
-    ss::future<> stop() { return _allocator_router.shutdown(); }
+    ss::future<> stop();
 
     allocate_id_router& allocator_router() { return _allocator_router; }
     reset_id_router& id_reset_router() { return _id_reset_router; }
@@ -173,6 +184,27 @@ private:
     ss::future<bool> try_create_id_allocator_topic();
     ss::future<bool> ensure_id_allocator_topic_exists();
 
+    // the ids [next, end) leased by the shard
+    struct id_lease {
+        int64_t next;
+        int64_t end;
+    };
+
+    int64_t leased_ids() const;
+    std::optional<int64_t> take_leased_id(model::timeout_clock::duration);
+    // leases a block of ids unless more than `low` ids are leased already,
+    // returns false if the leader couldn't allocate the block
+    ss::future<bool>
+      refill_lease(int64_t low, model::timeout_clock::duration);
+    // drops the leased ids below `id`, they may be in use after a reset
+    void drop_leases_below(int64_t id);
+
+    config::binding<int16_t> _lease_size;
+    std::deque<id_lease> _leases;
+    int64_t _lease_floor{0};
+    mutex _lease_lock;
+    ss::gate _gate;
+
     friend id_allocator;
 };
 } // namespace cluster
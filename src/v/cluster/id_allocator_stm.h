@@ -37,6 +37,8 @@ public:
     struct stm_allocation_result {
         int64_t id;
         raft::errc raft_status{raft::errc::success};
+        // The ids [id, id + count) are allocated
+        int64_t count{1};
     };
 
     explicit id_allocator_stm(ss::logger&, raft::consensus*);
@@ -47,6 +49,11 @@ public:
     ss::future<stm_allocation_result>
     allocate_id(model::timeout_clock::duration timeout);
 
+    // Allocates up to `count` consecutive ids, fewer if the current batch
+    // has less left. Lets the frontends lease blocks of ids.
+    ss::future<stm_allocation_result>
+    allocate_ids(int64_t count, model::timeout_clock::duration timeout);
+
     std::string_view get_name() const final { return "id_allocator_stm"; }
     ss::future<iobuf> take_snapshot(model::offset) final { co_return iobuf{}; }
 
@@ -99,7 +106,7 @@ private:
     };
 
     ss::future<stm_allocation_result>
-      do_allocate_id(model::timeout_clock::duration);
+      do_allocate_id(int64_t, model::timeout_clock::duration);
     ss::future<bool> set_state(int64_t, model::timeout_clock::duration);
 
     ss::future<> apply(const model::record_batch&) final;
@@ -47,6 +47,10 @@
 #include <optional>
 
 namespace cluster {
+
+// Number of nodes the leadership updates are sent to at a time
+static constexpr size_t max_concurrent_updates = 32;
+
 metadata_dissemination_service::metadata_dissemination_service(
   ss::sharded<raft::group_manager>& raft_manager,
   ss::sharded<cluster::partition_manager>& partition_manager,
@@ -157,46 +161,53 @@ void metadata_dissemination_service::handle_leadership_notification(
   model::revision_id revision,
   model::term_id term,
   std::optional<model::node_id> lid) {
+    _notifications.emplace_back(std::move(ntp), term, lid, revision);
+    if (_notifications.size() > 1) {
+        // already waiting to be dispatched with the previous notification
+        return;
+    }
     ssx::spawn_with_gate(
-      _bg, [this, ntp = std::move(ntp), lid, revision, term]() mutable {
-          // the lock sequences the updates from raft
-          return _lock.with(
-            [this, ntp = std::move(ntp), lid, revision, term]() mutable {
-                return container().invoke_on(
-                  0,
-                  [ntp = std::move(ntp), lid, revision, term](
-                    metadata_dissemination_service& s) mutable {
-                      return s.apply_leadership_notification(
-                        std::move(ntp), revision, term, lid);
-                  });
-            });
-      });
+      _bg, [this] { return dispatch_leadership_notifications(); });
 }
 
-ss::future<> metadata_dissemination_service::apply_leadership_notification(
-  model::ntp ntp,
-  model::revision_id revision,
-  model::term_id term,
-  std::optional<model::node_id> lid) {
+ss::future<>
+metadata_dissemination_service::dispatch_leadership_notifications() {
+    // the lock sequences the updates from raft, the notifications which
+    // arrive while the previous batch is applied make up the next one
+    return _lock.with([this] {
+        auto notifications = std::exchange(_notifications, {});
+        return container().invoke_on(
+          0,
+          [notifications = std::move(notifications)](
+            metadata_dissemination_service& s) mutable {
+              return s.apply_leadership_notifications(std::move(notifications));
+          });
+    });
+}
+
+ss::future<> metadata_dissemination_service::apply_leadership_notifications(
+  ss::chunked_fifo<ntp_leader_revision> notifications) {
     // the gate also needs to be taken on the destination core.
-    return ss::with_gate(
-      _bg, [this, ntp = std::move(ntp), lid, revision, term]() mutable {
-          // update partition leaders
-          vlog(clusterlog.trace, "updating {} leadership locally", ntp);
-          auto f = _leaders.invoke_on_all(
-            [ntp, lid, revision, term](partition_leaders_table& leaders) {
-                leaders.update_partition_leader(ntp, revision, term, lid);
-            });
-          if (lid == _self.id()) {
-              // only disseminate from current leader
-              f = f.then(
-                [this, ntp = std::move(ntp), term, lid, revision]() mutable {
-                    return disseminate_leadership(
-                      std::move(ntp), revision, term, lid);
-                });
+    auto holder = _bg.hold();
+    // update partition leaders
+    vlog(
+      clusterlog.trace,
+      "updating leadership of {} partitions locally",
+      notifications.size());
+    co_await _leaders.invoke_on_all(
+      [&notifications](partition_leaders_table& leaders) {
+          for (const auto& n : notifications) {
+              leaders.update_partition_leader(
+                n.ntp, n.revision, n.term, n.leader_id);
           }
-          return f;
       });
+    for (auto& n : notifications) {
+        if (n.leader_id == _self.id()) {
+            // only disseminate from current leader
+            disseminate_leadership(
+              std::move(n.ntp), n.revision, n.term, n.leader_id);
+        }
+    }
 }
 
 static inline ss::future<>
@@ -307,17 +318,15 @@ void metadata_dissemination_service::collect_pending_updates() {
             if (id == _self.id()) {
                 continue;
             }
-            if (!_pending_updates.contains(id)) {
-                _pending_updates.emplace(
-                  id,
-                  update_retry_meta{ss::chunked_fifo<ntp_leader_revision>{}});
-            }
             vlog(
               clusterlog.trace,
               "new metadata update {} for {}",
               ntp_leader,
               id);
-            _pending_updates[id].updates.push_back(ntp_leader);
+            // the requests are in the order of the leadership changes, the
+            // later one supersedes an update which wasn't delivered yet
+            _pending_updates[id].updates.insert_or_assign(
+              ntp_leader.ntp, ntp_leader);
         }
     }
     _requests.clear();
@@ -367,9 +376,10 @@ ss::future<> metadata_dissemination_service::dispatch_disseminate_leadership() {
       })
       .then([this] {
           collect_pending_updates();
-          return ss::parallel_for_each(
+          return ss::max_concurrent_for_each(
             _pending_updates.begin(),
             _pending_updates.end(),
+            max_concurrent_updates,
             [this](broker_updates_t::value_type& br_update) {
                 return dispatch_one_update(br_update.first, br_update.second);
             });
@@ -413,8 +423,9 @@ ss::future<> metadata_dissemination_service::dispatch_one_update(
     // copy updates to make retries possible
     ss::chunked_fifo<ntp_leader_revision> updates;
     updates.reserve(meta.updates.size());
-    std::copy(
-      meta.updates.begin(), meta.updates.end(), std::back_inserter(updates));
+    for (const auto& [_, update] : meta.updates) {
+        updates.push_back(update);
+    }
 
     return _clients.local()
       .with_node_client<metadata_dissemination_rpc_client_protocol>(
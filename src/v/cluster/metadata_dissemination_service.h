@@ -38,7 +38,13 @@ namespace cluster {
 /// triggers leadership notification and by that mean updates leadership in
 /// metadata cache.
 /// The service caches all leadership updates and sends them as
-/// batch per node, every configurable period of time. This service is also
+/// batch per node, every configurable period of time. Only the latest update
+/// of a partition is kept in the batch, so that a node which is unreachable
+/// for a while or a series of leadership changes doesn't grow the batch past
+/// the number of partitions. The batches are sent to a bounded number of
+/// nodes at a time. Leadership notifications of a shard are coalesced too,
+/// the partition leaders tables are updated once per coalesced batch rather
+/// than once per notification. This service is also
 /// responsible for querying one of the cluster nodes for current leadership
 /// metadata when node has started.
 ///
@@ -99,7 +105,7 @@ private:
     // When update was delivered successfully the finished flag is set to true
     // and object is removed from pending updates map
     struct update_retry_meta {
-        ss::chunked_fifo<ntp_leader_revision> updates;
+        absl::flat_hash_map<model::ntp, ntp_leader_revision> updates;
         bool finished = false;
     };
     // Used to track the process of requesting update when redpanda starts
@@ -121,11 +127,9 @@ private:
       model::revision_id,
       model::term_id,
       std::optional<model::node_id>);
-    ss::future<> apply_leadership_notification(
-      model::ntp,
-      model::revision_id,
-      model::term_id,
-      std::optional<model::node_id>);
+    ss::future<> dispatch_leadership_notifications();
+    ss::future<>
+      apply_leadership_notifications(ss::chunked_fifo<ntp_leader_revision>);
 
     void collect_pending_updates();
     void cleanup_finished_updates();
@@ -154,6 +158,8 @@ private:
     std::chrono::milliseconds _dissemination_interval;
     config::tls_config _rpc_tls_config;
     ss::chunked_fifo<ntp_leader_revision> _requests;
+    // leadership notifications of the shard waiting to be applied
+    ss::chunked_fifo<ntp_leader_revision> _notifications;
     std::vector<net::unresolved_address> _seed_servers;
     broker_updates_t _pending_updates;
     mutex _lock;
@@ -52,6 +52,7 @@ partition_balancer_backend::partition_balancer_backend(
   config::binding<unsigned>&& storage_space_alert_free_threshold_percent,
   config::binding<std::chrono::milliseconds>&& tick_interval,
   config::binding<size_t>&& max_concurrent_actions,
+  config::binding<size_t>&& max_concurrent_moves_per_node,
   config::binding<double>&& moves_drop_threshold,
   config::binding<size_t>&& segment_fallocation_step,
   config::binding<std::optional<size_t>> min_partition_size_threshold,
@@ -71,6 +72,7 @@ partition_balancer_backend::partition_balancer_backend(
       std::move(storage_space_alert_free_threshold_percent))
   , _tick_interval(std::move(tick_interval))
   , _max_concurrent_actions(std::move(max_concurrent_actions))
+  , _max_concurrent_moves_per_node(std::move(max_concurrent_moves_per_node))
   , _concurrent_moves_drop_threshold(std::move(moves_drop_threshold))
   , _segment_fallocation_step(std::move(segment_fallocation_step))
   , _min_partition_size_threshold(std::move(min_partition_size_threshold))
@@ -365,7 +367,8 @@ ss::future<> partition_balancer_backend::do_tick() {
             = _cur_term->_ondemand_rebalance_requested,
             .segment_fallocation_step = _segment_fallocation_step(),
             .min_partition_size_threshold = get_min_partition_size_threshold(),
-            .node_responsiveness_timeout = node_responsiveness_timeout},
+            .node_responsiveness_timeout = node_responsiveness_timeout,
+            .max_concurrent_moves_per_node = _max_concurrent_moves_per_node()},
           _state,
           _partition_allocator)
           .plan_actions(health_report.value(), _tick_in_progress.value());
@@ -46,6 +46,7 @@ public:
       config::binding<unsigned>&& storage_space_alert_free_threshold_percent,
       config::binding<std::chrono::milliseconds>&& tick_interval,
       config::binding<size_t>&& max_concurrent_actions,
+      config::binding<size_t>&& max_concurrent_moves_per_node,
       config::binding<double>&& moves_drop_threshold,
       config::binding<size_t>&& segment_fallocation_step,
       config::binding<std::optional<size_t>> min_partition_size_threshold,
@@ -102,6 +103,7 @@ private:
     config::binding<unsigned> _storage_space_alert_free_threshold_percent;
     config::binding<std::chrono::milliseconds> _tick_interval;
     config::binding<size_t> _max_concurrent_actions;
+    config::binding<size_t> _max_concurrent_moves_per_node;
     config::binding<double> _concurrent_moves_drop_threshold;
     config::binding<size_t> _segment_fallocation_step;
     config::binding<std::optional<size_t>> _min_partition_size_threshold;
@@ -61,6 +61,48 @@ distinct_from(const absl::flat_hash_set<model::node_id>& nodes) {
     return hard_constraint(std::make_unique<impl>(nodes));
 }
 
+/// A node is a move target only while fewer than \p limit moves towards it
+/// are in progress. The original replicas of the partition are exempt, as a
+/// replica staying where it is isn't a move.
+hard_constraint below_inbound_moves_limit(
+  const absl::flat_hash_map<model::node_id, size_t>& inbound_moves,
+  size_t limit,
+  const std::vector<model::broker_shard>& orig_replicas) {
+    class impl : public hard_constraint::impl {
+    public:
+        impl(
+          const absl::flat_hash_map<model::node_id, size_t>& inbound_moves,
+          size_t limit,
+          const std::vector<model::broker_shard>& orig_replicas)
+          : _inbound_moves(inbound_moves)
+          , _limit(limit)
+          , _orig_replicas(orig_replicas) {}
+
+        hard_constraint_evaluator
+        make_evaluator(const model::ntp&, const replicas_t&) const final {
+            return [this](const allocation_node& node) {
+                if (contains_node(_orig_replicas, node.id())) {
+                    return true;
+                }
+                auto it = _inbound_moves.find(node.id());
+                return it == _inbound_moves.end() || it->second < _limit;
+            };
+        }
+
+        ss::sstring name() const final {
+            return ssx::sformat("less than {} moves in progress", _limit);
+        }
+
+    private:
+        const absl::flat_hash_map<model::node_id, size_t>& _inbound_moves;
+        size_t _limit;
+        const std::vector<model::broker_shard>& _orig_replicas;
+    };
+
+    return hard_constraint(
+      std::make_unique<impl>(inbound_moves, limit, orig_replicas));
+}
+
 } // namespace
 
 partition_balancer_planner::partition_balancer_planner(
@@ -81,6 +123,8 @@ public:
     absl::flat_hash_set<model::node_id> timed_out_unavailable_nodes;
     absl::flat_hash_set<model::node_id> decommissioning_nodes;
     absl::flat_hash_map<model::node_id, node_disk_space> node_disk_reports;
+    // moves in progress or planned towards a node
+    absl::flat_hash_map<model::node_id, size_t> node_inbound_moves;
 
     ss::future<> for_each_partition(
       ss::noncopyable_function<ss::stop_iteration(partition&)>);
@@ -117,6 +161,26 @@ public:
         }
     }
 
+    /// True if some node doesn't accept more moves in this iteration, so
+    /// that a failed allocation may only be deferred until moves finish.
+    bool inbound_moves_limited() const {
+        const auto limit = config().max_concurrent_moves_per_node;
+        return limit > 0
+               && std::any_of(
+                 node_inbound_moves.begin(),
+                 node_inbound_moves.end(),
+                 [limit](const auto& p) { return p.second >= limit; });
+    }
+
+    void add_inbound_move(model::node_id id) { ++node_inbound_moves[id]; }
+
+    void remove_inbound_move(model::node_id id) {
+        auto it = node_inbound_moves.find(id);
+        if (it != node_inbound_moves.end() && it->second > 0) {
+            --it->second;
+        }
+    }
+
     ss::future<> maybe_yield() {
         co_await ss::coroutine::maybe_yield();
         _as.check();
@@ -211,7 +275,7 @@ private:
     };
 
     partition_balancer_planner& _parent;
-    absl::btree_map<model::ntp, partition_sizes> _ntp2sizes;
+    absl::flat_hash_map<model::ntp, partition_sizes> _ntp2sizes;
     absl::node_hash_map<model::ntp, reassignment_info> _reassignments;
     absl::node_hash_map<model::ntp, allocated_partition> _force_reassignments;
     size_t _failed_actions_count = 0;
@@ -344,6 +408,19 @@ void partition_balancer_planner::init_per_node_state(
           node_report.id, node_disk_space(node_report.id, total, total - free));
     }
 
+    for (const auto& [ntp, update] : _state.topics().updates_in_progress()) {
+        if (
+          update.get_state() != reconfiguration_state::in_progress
+          && update.get_state() != reconfiguration_state::force_update) {
+            continue;
+        }
+        auto moving_to = subtract(
+          update.get_target_replicas(), update.get_previous_replicas());
+        for (const auto& bs : moving_to) {
+            ctx.add_inbound_move(bs.node_id);
+        }
+    }
+
     for (model::node_id id : ctx.all_nodes) {
         auto disk_it = ctx.node_disk_reports.find(id);
         if (disk_it == ctx.node_disk_reports.end()) {
@@ -372,10 +449,15 @@ void partition_balancer_planner::init_per_node_state(
 
 ss::future<> partition_balancer_planner::init_ntp_sizes_from_health_report(
   const cluster_health_report& health_report, request_context& ctx) {
+    ctx._ntp2sizes.reserve(_state.topics().partition_count());
     for (const auto& node_report : health_report.node_reports) {
         for (const auto& tp_ns : node_report.topics) {
+            // reused for all the partitions of the topic: the ntp is only
+            // copied when a partition is seen for the first time
+            model::ntp ntp{
+              tp_ns.tp_ns.ns, tp_ns.tp_ns.tp, model::partition_id{}};
             for (const auto& partition : tp_ns.partitions) {
-                model::ntp ntp{tp_ns.tp_ns.ns, tp_ns.tp_ns.tp, partition.id};
+                ntp.tp.partition = partition.id;
                 size_t reclaimable = partition.reclaimable_size_bytes.value_or(
                   0);
                 vlog(
@@ -1063,6 +1145,14 @@ partition_balancer_planner::reassignable_partition::get_allocation_constraints(
         constraints.add(distinct_from(_ctx.decommissioning_nodes));
     }
 
+    // Add constraint on moves in progress towards a node
+    if (_ctx.config().max_concurrent_moves_per_node > 0) {
+        constraints.add(below_inbound_moves_limit(
+          _ctx.node_inbound_moves,
+          _ctx.config().max_concurrent_moves_per_node,
+          _orig_replicas));
+    }
+
     return constraints;
 }
 
@@ -1140,6 +1230,10 @@ partition_balancer_planner::reassignable_partition::move_replica(
               from_it->second);
         }
 
+        if (!_reallocated->partition.is_original(new_node)) {
+            _ctx.add_inbound_move(new_node);
+        }
+
         auto to_it = _ctx.node_disk_reports.find(new_node);
         if (to_it != _ctx.node_disk_reports.end()) {
             if (_reallocated->partition.is_original(new_node)) {
@@ -1176,6 +1270,10 @@ void partition_balancer_planner::reassignable_partition::revert(
     auto err = _reallocated->partition.try_revert(move);
     vassert(err == errc::success, "ntp {}: revert error: {}", _ntp, err);
 
+    if (!_reallocated->partition.is_original(move.current().node_id)) {
+        _ctx.remove_inbound_move(move.current().node_id);
+    }
+
     auto from_it = _ctx.node_disk_reports.find(move.previous()->node_id);
     if (from_it != _ctx.node_disk_reports.end()) {
         from_it->second.released -= _sizes.get_current(
@@ -1353,7 +1451,7 @@ ss::future<> partition_balancer_planner::get_node_drain_actions(
                         replica,
                         ctx.config().hard_max_disk_usage_ratio,
                         reason);
-                      if (!result) {
+                      if (!result && !ctx.inbound_moves_limited()) {
                           ctx.report_decommission_reallocation_failure(
                             replica, part.ntp());
                       }
@@ -56,6 +56,10 @@ struct planner_config {
     // the request but it is not yet considered as a violation of partition
     // balancing rules
     std::chrono::milliseconds node_responsiveness_timeout;
+    // Max number of moves in progress towards a single node, 0 means no limit.
+    // The moves to a node share its recovery bandwidth, so a node is not a
+    // target of new moves while it is at the limit and the others are used.
+    size_t max_concurrent_moves_per_node = 0;
 };
 
 class partition_balancer_planner {
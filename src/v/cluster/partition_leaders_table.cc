@@ -42,14 +42,19 @@ ss::future<> partition_leaders_table::stop() {
     return ss::now();
 }
 
-std::optional<partition_leaders_table::leader_meta>
+const partition_leaders_table::leader_meta*
 partition_leaders_table::find_leader_meta(
   model::topic_namespace_view tp_ns, model::partition_id pid) const {
-    if (auto it = _leaders.find(leader_key_view{tp_ns, pid});
-        it != _leaders.end()) {
-        return it->second;
+    auto it = _leaders.find(tp_ns);
+    if (it == _leaders.end()) {
+        return nullptr;
+    }
+    const auto& partitions = it->second.partitions;
+    if (pid() < 0 || static_cast<size_t>(pid()) >= partitions.size()) {
+        return nullptr;
     }
-    return std::nullopt;
+    const auto& meta = partitions[pid()];
+    return meta ? &*meta : nullptr;
 }
 
 std::optional<model::node_id> partition_leaders_table::get_previous_leader(
@@ -95,9 +100,6 @@ void partition_leaders_table::update_partition_leader(
   model::revision_id revision_id,
   model::term_id term,
   std::optional<model::node_id> leader_id) {
-    auto key = leader_key_view{
-      model::topic_namespace_view(ntp), ntp.tp.partition};
-
     const auto is_controller = ntp == model::controller_ntp;
     /**
      * Use revision to differentiate updates for the topic that was
@@ -118,16 +120,25 @@ void partition_leaders_table::update_partition_leader(
         return;
     }
 
-    auto it = _leaders.find(key);
-    if (it == _leaders.end()) {
+    auto t_it = _leaders.find(model::topic_namespace_view(ntp));
+    if (t_it == _leaders.end()) {
         auto [new_it, _] = _leaders.emplace(
-          leader_key{
-            model::topic_namespace(ntp.ns, ntp.tp.topic), ntp.tp.partition},
-          leader_meta{
-            .current_leader = leader_id,
-            .update_term = term,
-            .partition_revision = revision_id});
-        it = new_it;
+          model::topic_namespace(ntp.ns, ntp.tp.topic), topic_leaders{});
+        t_it = new_it;
+    }
+    auto& topic = t_it->second;
+    const auto idx = static_cast<size_t>(ntp.tp.partition());
+    if (idx >= topic.partitions.size()) {
+        topic.partitions.resize(idx + 1);
+    }
+    auto& slot = topic.partitions[idx];
+    if (!slot) {
+        slot = leader_meta{
+          .current_leader = leader_id,
+          .update_term = term,
+          .partition_revision = revision_id};
+        ++topic.size;
+        ++_leaders_count;
     } else {
         /**
          * Controller is a special case as it revision never but it
@@ -147,9 +158,7 @@ void partition_leaders_table::update_partition_leader(
         const bool revision_id_valid = revision_id >= model::revision_id{0};
         if (!is_controller) {
             // skip update for partition with previous revision
-            if (
-              revision_id_valid
-              && revision_id < it->second.partition_revision) {
+            if (revision_id_valid && revision_id < slot->partition_revision) {
                 vlog(
                   clusterlog.trace,
                   "skip update for partition {} with previous revision {} "
@@ -157,38 +166,36 @@ void partition_leaders_table::update_partition_leader(
                   "revision {}",
                   ntp,
                   revision_id,
-                  it->second.partition_revision);
+                  slot->partition_revision);
                 return;
             }
             // reset the term for new ntp revision
-            if (
-              revision_id_valid
-              && revision_id > it->second.partition_revision) {
-                it->second.update_term = model::term_id{};
+            if (revision_id_valid && revision_id > slot->partition_revision) {
+                slot->update_term = model::term_id{};
             }
         }
 
         // existing partition
-        if (it->second.update_term > term) {
+        if (slot->update_term > term) {
             vlog(
               clusterlog.trace,
               "skip update for partition {} with previous term {} current term "
               "{}",
               ntp,
               term,
-              it->second.update_term);
+              slot->update_term);
             // Do nothing if update term is older
             return;
         }
 
         // if current leader has value, store it as a previous leader
-        if (it->second.current_leader) {
-            it->second.previous_leader = it->second.current_leader;
+        if (slot->current_leader) {
+            slot->previous_leader = slot->current_leader;
         }
-        it->second.current_leader = leader_id;
-        it->second.update_term = term;
+        slot->current_leader = leader_id;
+        slot->update_term = term;
         if (revision_id_valid) {
-            it->second.partition_revision = revision_id;
+            slot->partition_revision = revision_id;
         }
     }
     vlog(
@@ -196,16 +203,16 @@ void partition_leaders_table::update_partition_leader(
       "updated partition: {} leader: {{term: {}, current leader: {}, previous "
       "leader: {}, revision: {}}}",
       ntp,
-      it->second.update_term,
-      it->second.current_leader,
-      it->second.previous_leader,
-      it->second.partition_revision);
+      slot->update_term,
+      slot->current_leader,
+      slot->previous_leader,
+      slot->partition_revision);
     // notify waiters if update is setting the leader
     if (!leader_id) {
         return;
     }
     // update stable leader term
-    it->second.last_stable_leader_term = term;
+    slot->last_stable_leader_term = term;
 
     if (auto it = _leader_promises.find(ntp); it != _leader_promises.end()) {
         for (auto& promise : it->second) {
@@ -215,8 +222,8 @@ void partition_leaders_table::update_partition_leader(
 
     // Ensure leadership has changed before notifying watchers
     if (
-      !it->second.previous_leader
-      || leader_id.value() != it->second.previous_leader.value()) {
+      !slot->previous_leader
+      || leader_id.value() != slot->previous_leader.value()) {
         _watchers.notify(ntp, ntp, term, leader_id);
     }
 }
@@ -225,7 +232,7 @@ ss::future<> partition_leaders_table::update_with_estimates() {
     for (const auto& [ns_tp, topic] :
          _topic_table.local().all_topics_metadata()) {
         for (const auto& part : topic.metadata.get_assignments()) {
-            if (!_leaders.contains(leader_key_view{ns_tp, part.id})) {
+            if (!find_leader_meta(ns_tp, part.id)) {
                 model::ntp ntp{ns_tp.ns, ns_tp.tp, part.id};
                 vassert(
                   !part.replicas.empty(),
@@ -270,40 +277,63 @@ ss::future<model::node_id> partition_leaders_table::wait_for_leader(
 
 void partition_leaders_table::remove_leader(
   const model::ntp& ntp, model::revision_id revision) {
-    auto it = _leaders.find(
-      leader_key_view{model::topic_namespace_view(ntp), ntp.tp.partition});
+    auto it = _leaders.find(model::topic_namespace_view(ntp));
+    if (it == _leaders.end()) {
+        return;
+    }
+    auto& topic = it->second;
+    const auto idx = static_cast<size_t>(ntp.tp.partition());
+    if (idx >= topic.partitions.size() || !topic.partitions[idx]) {
+        return;
+    }
+    auto& slot = topic.partitions[idx];
     // ignore updates with old revision
-    if (it != _leaders.end() && it->second.partition_revision <= revision) {
+    if (slot->partition_revision <= revision) {
         vlog(
           clusterlog.trace,
           "removing {} with revision {} matched by revision {}",
           ntp,
-          it->second.partition_revision,
+          slot->partition_revision,
           revision);
-        _leaders.erase(it);
+        slot.reset();
+        --_leaders_count;
+        if (--topic.size == 0) {
+            _leaders.erase(it);
+        } else {
+            // trim the trailing empty entries of removed partitions
+            while (!topic.partitions.back()) {
+                topic.partitions.pop_back();
+            }
+        }
     }
 }
 
 void partition_leaders_table::reset() {
     vlog(clusterlog.trace, "resetting leaders");
     _leaders.clear();
+    _leaders_count = 0;
 }
 
 partition_leaders_table::leaders_info_t
 partition_leaders_table::get_leaders() const {
     leaders_info_t ans;
-    ans.reserve(_leaders.size());
-    for (const auto& leader_info : _leaders) {
-        leader_info_t info{
-          .tp_ns = leader_info.first.tp_ns,
-          .pid = leader_info.first.pid,
-          .current_leader = leader_info.second.current_leader,
-          .previous_leader = leader_info.second.previous_leader,
-          .last_stable_leader_term = leader_info.second.last_stable_leader_term,
-          .update_term = leader_info.second.update_term,
-          .partition_revision = leader_info.second.partition_revision,
-        };
-        ans.push_back(std::move(info));
+    ans.reserve(_leaders_count);
+    for (const auto& [tp_ns, topic] : _leaders) {
+        for (size_t i = 0; i < topic.partitions.size(); ++i) {
+            const auto& meta = topic.partitions[i];
+            if (!meta) {
+                continue;
+            }
+            ans.push_back(leader_info_t{
+              .tp_ns = tp_ns,
+              .pid = model::partition_id(static_cast<int32_t>(i)),
+              .current_leader = meta->current_leader,
+              .previous_leader = meta->previous_leader,
+              .last_stable_leader_term = meta->last_stable_leader_term,
+              .update_term = meta->update_term,
+              .partition_revision = meta->partition_revision,
+            });
+        }
     }
     return ans;
 }
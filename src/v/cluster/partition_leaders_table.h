@@ -23,6 +23,7 @@
 #include <absl/container/node_hash_map.h>
 
 #include <optional>
+#include <vector>
 
 namespace cluster {
 
@@ -70,8 +71,16 @@ public:
         { f(tp_ns, pid, leader, term) } -> std::same_as<void>;
     }
     void for_each_leader(Func&& f) const {
-        for (auto& [k, v] : _leaders) {
-            f(k.tp_ns, k.pid, v.current_leader, v.update_term);
+        for (auto& [tp_ns, topic] : _leaders) {
+            for (size_t i = 0; i < topic.partitions.size(); ++i) {
+                const auto& meta = topic.partitions[i];
+                if (meta) {
+                    f(tp_ns,
+                      model::partition_id(static_cast<int32_t>(i)),
+                      meta->current_leader,
+                      meta->update_term);
+                }
+            }
         }
     }
 
@@ -126,61 +135,6 @@ public:
       const model::ntp&, notification_id_type);
 
 private:
-    // optimized to reduce number of ntp copies
-    struct leader_key {
-        model::topic_namespace tp_ns;
-        model::partition_id pid;
-        template<typename H>
-        friend H AbslHashValue(H h, const leader_key& lkv) {
-            return H::combine(std::move(h), lkv.tp_ns, lkv.pid);
-        }
-    };
-    struct leader_key_view {
-        model::topic_namespace_view tp_ns;
-        model::partition_id pid;
-
-        template<typename H>
-        friend H AbslHashValue(H h, const leader_key_view& lkv) {
-            return H::combine(std::move(h), lkv.tp_ns, lkv.pid);
-        }
-    };
-    // make leader_key queryable with leader_key_view
-    struct leader_key_hash {
-        using is_transparent = void;
-
-        size_t operator()(leader_key_view v) const {
-            return absl::Hash<leader_key_view>{}(v);
-        }
-
-        size_t operator()(const leader_key& v) const {
-            return absl::Hash<leader_key>{}(v);
-        }
-    };
-
-    struct leader_key_eq {
-        using is_transparent = void;
-
-        bool operator()(leader_key_view lhs, leader_key_view rhs) const {
-            return lhs.tp_ns.ns == rhs.tp_ns.ns && lhs.tp_ns.tp == rhs.tp_ns.tp
-                   && lhs.pid == rhs.pid;
-        }
-
-        bool operator()(const leader_key& lhs, const leader_key& rhs) const {
-            return lhs.tp_ns.ns == rhs.tp_ns.ns && lhs.tp_ns.tp == rhs.tp_ns.tp
-                   && lhs.pid == rhs.pid;
-        }
-
-        bool operator()(const leader_key& lhs, leader_key_view rhs) const {
-            return lhs.tp_ns.ns == rhs.tp_ns.ns && lhs.tp_ns.tp == rhs.tp_ns.tp
-                   && lhs.pid == rhs.pid;
-        }
-
-        bool operator()(leader_key_view lhs, const leader_key& rhs) const {
-            return lhs.tp_ns.ns == rhs.tp_ns.ns && lhs.tp_ns.tp == rhs.tp_ns.tp
-                   && lhs.pid == rhs.pid;
-        }
-    };
-
     // in order to filter out reordered requests we store last update term
     struct leader_meta {
         // current leader id, this may be empty if a group is in the middle of
@@ -199,11 +153,30 @@ private:
         model::revision_id partition_revision;
     };
 
-    std::optional<leader_meta>
+    /**
+     * Leaders of the partitions of a single topic indexed by the partition
+     * id. Partition ids of a topic are dense so this avoids storing a copy of
+     * the topic name and a hash table node per partition. Stale updates are
+     * detected with the partition revision stored in each entry.
+     */
+    struct topic_leaders {
+        std::vector<std::optional<leader_meta>> partitions;
+        // number of engaged entries in partitions
+        size_t size{0};
+    };
+
+    const leader_meta*
       find_leader_meta(model::topic_namespace_view, model::partition_id) const;
 
-    absl::node_hash_map<leader_key, leader_meta, leader_key_hash, leader_key_eq>
-      _leaders;
+    using leaders_t = absl::node_hash_map<
+      model::topic_namespace,
+      topic_leaders,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>;
+
+    leaders_t _leaders;
+    // total number of partitions with a leader entry
+    size_t _leaders_count{0};
 
     // per-ntp notifications for leadership election. note that the
     // namespace is currently ignored pending an update to the metadata
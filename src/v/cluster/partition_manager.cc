@@ -21,6 +21,7 @@
 #include "cluster/partition_recovery_manager.h"
 #include "cluster/types.h"
 #include "config/configuration.h"
+#include "config/node_config.h"
 #include "model/metadata.h"
 #include "raft/consensus.h"
 #include "raft/consensus_utils.h"
@@ -210,7 +211,13 @@ ss::future<consensus_ptr> partition_manager::manage(
               ntp_cfg, manifest, max_offset);
         }
     }
-    auto log = co_await _storage.log_mgr().manage(std::move(ntp_cfg));
+    // The first replica has the highest raft voter priority, recovering its
+    // log ahead of the others brings the leadership back sooner on startup.
+    const auto prioritize = storage::prioritize_recovery(
+      !initial_nodes.empty()
+      && config::node().node_id() == initial_nodes.front().id());
+    auto log = co_await _storage.log_mgr().manage(
+      std::move(ntp_cfg), prioritize);
     vlog(
       clusterlog.debug,
       "Log created manage completed, ntp: {}, rev: {}, {} "
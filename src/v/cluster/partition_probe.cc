@@ -59,15 +59,11 @@ void replicated_partition_probe::setup_internal_metrics(const model::ntp& ntp) {
       partition_label(ntp.tp.partition()),
     };
 
+    // Offsets and leader ids are only meaningful per partition, they keep
+    // the partition label even if metrics are aggregated.
     _metrics.add_group(
       prometheus_sanitize::metrics_name("cluster:partition"),
       {
-        sm::make_gauge(
-          "leader",
-          [this] { return _partition.is_elected_leader() ? 1 : 0; },
-          sm::description(
-            "Flag indicating if this partition instance is a leader"),
-          labels),
         sm::make_gauge(
           "start_offset",
           [this] { return _partition.raft_start_offset(); },
@@ -104,6 +100,23 @@ void replicated_partition_probe::setup_internal_metrics(const model::ntp& ntp) {
           },
           sm::description("Id of current partition leader"),
           labels),
+      },
+      {},
+      {sm::shard_label});
+
+    // Totals over the partitions of a topic are meaningful for the rest, e.g.
+    // the number of leaders or the bytes produced to the topic, so these are
+    // aggregated per topic to keep the number of series independent of the
+    // partition count.
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cluster:partition"),
+      {
+        sm::make_gauge(
+          "leader",
+          [this] { return _partition.is_elected_leader() ? 1 : 0; },
+          sm::description(
+            "Flag indicating if this partition instance is a leader"),
+          labels),
         sm::make_gauge(
           "under_replicated_replicas",
           [this] {
@@ -146,7 +159,7 @@ void replicated_partition_probe::setup_internal_metrics(const model::ntp& ntp) {
           labels),
       },
       {},
-      {sm::shard_label});
+      {sm::shard_label, partition_label});
 
     if (
       config::shard_local_cfg().enable_schema_id_validation()
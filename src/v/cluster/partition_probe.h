@@ -30,6 +30,10 @@ public:
         virtual void add_bytes_produced(uint64_t) = 0;
         virtual void add_bytes_fetched(uint64_t) = 0;
         virtual void add_schema_id_validation_failed() = 0;
+        virtual uint64_t records_produced() const = 0;
+        virtual uint64_t records_fetched() const = 0;
+        virtual uint64_t bytes_produced() const = 0;
+        virtual uint64_t bytes_fetched() const = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
         virtual void clear_metrics() = 0;
         virtual ~impl() noexcept = default;
@@ -63,6 +67,12 @@ public:
 
     void clear_metrics() { _impl->clear_metrics(); }
 
+    // totals since the partition replica was created on this shard
+    uint64_t records_produced() const { return _impl->records_produced(); }
+    uint64_t records_fetched() const { return _impl->records_fetched(); }
+    uint64_t bytes_produced() const { return _impl->bytes_produced(); }
+    uint64_t bytes_fetched() const { return _impl->bytes_fetched(); }
+
 private:
     std::unique_ptr<impl> _impl;
 };
@@ -80,6 +90,11 @@ public:
         ++_schema_id_validation_records_failed;
     };
 
+    uint64_t records_produced() const final { return _records_produced; }
+    uint64_t records_fetched() const final { return _records_fetched; }
+    uint64_t bytes_produced() const final { return _bytes_produced; }
+    uint64_t bytes_fetched() const final { return _bytes_fetched; }
+
     void clear_metrics() final;
 
 private:
@@ -715,8 +715,14 @@ partition_downloader::download_segment_file(
           stream_stats);
     };
 
+    // The index embedded in the object isn't a part of the segment file
+    std::optional<cloud_storage_clients::http_byte_range> byte_range;
+    if (segm.sname_format >= cloud_storage::segment_name_format::v4) {
+        byte_range = std::make_pair(0, segm.size_bytes - 1);
+    }
+
     auto result = co_await _remote->download_segment(
-      _bucket, remote_path, stream, _rtcnode);
+      _bucket, remote_path, stream, _rtcnode, byte_range);
 
     if (result != download_result::success) {
         // The individual segment might be missing for varios reasons but
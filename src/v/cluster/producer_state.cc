@@ -15,6 +15,8 @@
 #include "cluster/producer_state_manager.h"
 #include "vassert.h"
 
+#include <algorithm>
+
 namespace cluster {
 
 result_promise_t::future_type request::result() const {
@@ -56,7 +58,7 @@ bool requests::operator==(const requests& other) const {
     // check size match
     bool result
       = (_inflight_requests.size() == other._inflight_requests.size())
-        && (_finished_requests.size() == other._finished_requests.size());
+        && (_finished_count == other._finished_count);
     if (!result) {
         return false;
     }
@@ -70,36 +72,38 @@ bool requests::operator==(const requests& other) const {
           return *left == *right;
       });
 
-    auto match_finished = std::equal(
-      _finished_requests.begin(),
-      _finished_requests.end(),
-      other._finished_requests.begin(),
-      other._finished_requests.end(),
-      [](const request_ptr& left, const request_ptr& right) {
-          return *left == *right;
-      });
+    auto match_finished = std::ranges::equal(finished(), other.finished());
 
     return match_inflight && match_finished;
 }
 
-std::optional<request_ptr> requests::last_request() const {
+std::optional<seq_t> requests::last_sequence() const {
     if (!_inflight_requests.empty()) {
-        return _inflight_requests.back();
-    } else if (!_finished_requests.empty()) {
-        return _finished_requests.back();
+        return _inflight_requests.back()->_last_sequence;
+    } else if (_finished_count > 0) {
+        return _finished_requests[_finished_count - 1].last_sequence;
     }
     return std::nullopt;
 }
 
 bool requests::is_valid_sequence(seq_t incoming) const {
-    auto last_req = last_request();
+    auto last_seq = last_sequence();
     return
       // this is the first request with seq=0
-      (!last_req && incoming == 0)
+      (!last_seq && incoming == 0)
       // incoming request forms a sequence with last_request
-      || (last_req && last_req.value()->_last_sequence + 1 == incoming)
+      || (last_seq && last_seq.value() + 1 == incoming)
       // sequence numbers got rolled over because they hit int32 max limit.
-      || (last_req && last_req.value()->_last_sequence == std::numeric_limits<seq_t>::max() && incoming == 0);
+      || (last_seq && last_seq.value() == std::numeric_limits<seq_t>::max() && incoming == 0);
+}
+
+void requests::push_finished(finished_request req) {
+    if (_finished_count == requests_cached_max) {
+        std::shift_left(
+          _finished_requests.begin(), _finished_requests.end(), 1);
+        --_finished_count;
+    }
+    _finished_requests[_finished_count++] = req;
 }
 
 result<request_ptr> requests::try_emplace(
@@ -113,7 +117,7 @@ result<request_ptr> requests::try_emplace(
             }
             _inflight_requests.pop_front();
         }
-        _finished_requests.clear();
+        _finished_count = 0;
     } else {
         // gc and fail any inflight requests from old terms
         // these are guaranteed to be failed because of sync() guarantees
@@ -129,19 +133,23 @@ result<request_ptr> requests::try_emplace(
         }
 
         // check if an existing request matches
-        auto match_it = std::find_if(
-          _finished_requests.begin(),
-          _finished_requests.end(),
-          [first, last](const auto& request) {
-              return request->_first_sequence == first
-                     && request->_last_sequence == last;
+        auto cached = finished();
+        auto finished_it = std::ranges::find_if(
+          cached, [first, last](const finished_request& request) {
+              return request.first_sequence == first
+                     && request.last_sequence == last;
           });
 
-        if (match_it != _finished_requests.end()) {
-            return *match_it;
+        if (finished_it != cached.end()) {
+            // the retried request is answered with the cached result
+            result_promise_t ready{};
+            ready.set_value(
+              kafka_result{.last_offset = finished_it->last_offset});
+            return ss::make_lw_shared<request>(
+              first, last, model::term_id{-1}, std::move(ready));
         }
 
-        match_it = std::find_if(
+        auto match_it = std::find_if(
           _inflight_requests.begin(),
           _inflight_requests.end(),
           [first, last, current](const auto& request) {
@@ -190,14 +198,8 @@ bool requests::stm_apply(
         // applying changes from a different leader thus prompting a relink.
         relink_producer = true;
     }
-    result_promise_t ready{};
-    ready.set_value(kafka_result{.last_offset = offset});
-    _finished_requests.emplace_back(ss::make_lw_shared<request>(
-      bid.first_seq, bid.last_seq, model::term_id{-1}, std::move(ready)));
-
-    while (_finished_requests.size() > requests_cached_max) {
-        _finished_requests.pop_front();
-    }
+    push_finished(finished_request{
+      .first_sequence = first, .last_sequence = last, .last_offset = offset});
     return relink_producer;
 }
 
@@ -208,7 +210,7 @@ void requests::shutdown() {
         }
     }
     _inflight_requests.clear();
-    _finished_requests.clear();
+    _finished_count = 0;
 }
 
 producer_state::producer_state(
@@ -221,13 +223,10 @@ producer_state::producer_state(
   , _post_eviction_hook(std::move(hook)) {
     // Hydrate from snapshot.
     for (auto& req : snapshot._finished_requests) {
-        result_promise_t ready{};
-        ready.set_value(kafka_result{req._last_offset});
-        _requests._finished_requests.push_back(ss::make_lw_shared<request>(
-          req._first_sequence,
-          req._last_sequence,
-          model::term_id{-1},
-          std::move(ready)));
+        _requests.push_finished(requests::finished_request{
+          .first_sequence = req._first_sequence,
+          .last_sequence = req._last_sequence,
+          .last_offset = req._last_offset});
     }
     register_self();
 }
@@ -242,7 +241,7 @@ std::ostream& operator<<(std::ostream& o, const requests& requests) {
       o,
       "{{ inflight: {}, finished: {} }}",
       requests._inflight_requests.size(),
-      requests._finished_requests.size());
+      requests._finished_count);
     return o;
 }
 
@@ -259,6 +258,35 @@ std::ostream& operator<<(std::ostream& o, const producer_state& state) {
     return o;
 }
 
+producer_state::locked_scope::locked_scope(
+  producer_state& producer,
+  ss::gate::holder holder,
+  ssx::semaphore_units units)
+  : units(std::move(units))
+  , _producer(&producer)
+  , _holder(std::move(holder)) {
+    _producer->unlink_self();
+    _producer->_ops_in_progress++;
+}
+
+producer_state::locked_scope::~locked_scope() noexcept {
+    if (_producer) {
+        _producer->_ops_in_progress--;
+        _producer->link_self();
+    }
+}
+
+std::optional<producer_state::locked_scope> producer_state::try_lock() {
+    if (_gate.is_closed()) {
+        return std::nullopt;
+    }
+    auto units = _op_lock.try_get_units();
+    if (!units) {
+        return std::nullopt;
+    }
+    return locked_scope(*this, _gate.hold(), std::move(*units));
+}
+
 ss::future<> producer_state::shutdown_input() {
     if (_evicted) {
         return ss::now();
@@ -347,11 +375,7 @@ void producer_state::update(
 }
 
 std::optional<seq_t> producer_state::last_sequence_number() const {
-    auto maybe_ptr = _requests.last_request();
-    if (!maybe_ptr) {
-        return std::nullopt;
-    }
-    return maybe_ptr.value()->_last_sequence;
+    return _requests.last_sequence();
 }
 
 producer_state_snapshot
@@ -360,23 +384,15 @@ producer_state::snapshot(kafka::offset log_start_offset) const {
     snapshot._id = _id;
     snapshot._group = _group;
     snapshot._ms_since_last_update = ms_since_last_update();
-    snapshot._finished_requests.reserve(_requests._finished_requests.size());
-    for (auto& req : _requests._finished_requests) {
-        vassert(
-          req->has_completed(),
-          "_finished_requests has unresolved promise: {}, range:[{}, {}]",
-          *this,
-          req->_first_sequence,
-          req->_last_sequence);
-        auto kafka_offset
-          = req->_result.get_shared_future().get().value().last_offset;
+    snapshot._finished_requests.reserve(_requests._finished_count);
+    for (const auto& req : _requests.finished()) {
         // offsets older than log start are no longer interesting.
-        if (kafka_offset >= log_start_offset) {
+        if (req.last_offset >= log_start_offset) {
             snapshot._finished_requests.push_back(
               producer_state_snapshot::finished_request{
-                ._first_sequence = req->_first_sequence,
-                ._last_sequence = req->_last_sequence,
-                ._last_offset = kafka_offset});
+                ._first_sequence = req.first_sequence,
+                ._last_sequence = req.last_sequence,
+                ._last_offset = req.last_offset});
         }
     }
     return snapshot;
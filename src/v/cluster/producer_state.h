@@ -17,10 +17,14 @@
 #include "utils/mutex.h"
 #include "utils/rwlock.h"
 
+#include <seastar/core/gate.hh>
 #include <seastar/core/shared_future.hh>
 #include <seastar/util/defer.hh>
 
+#include <array>
 #include <bit>
+#include <optional>
+#include <span>
 
 // Befriended to expose internal state in tests.
 struct test_fixture;
@@ -111,6 +115,11 @@ private:
 // We retain a maximum of `requests_cached_max` finished requests.
 // Kafka clients only issue requests in batches of 5, the queue is fairly small
 // at all times.
+//
+// Finished requests are retained for every producer on the shard, so they are
+// kept inline in their compact form (sequence range and offset) rather than as
+// requests with a resolved promise. A request handle is only materialized when
+// a client retries a finished request.
 class requests {
 public:
     result<request_ptr> try_emplace(
@@ -128,10 +137,26 @@ private:
     // chunk size of the request containers to avoid wastage.
     static constexpr size_t chunk_size = std::bit_ceil(
       static_cast<unsigned long>(requests_cached_max));
+
+    struct finished_request {
+        seq_t first_sequence;
+        seq_t last_sequence;
+        kafka::offset last_offset;
+
+        bool operator==(const finished_request&) const = default;
+    };
+
     bool is_valid_sequence(seq_t incoming) const;
-    std::optional<request_ptr> last_request() const;
+    std::optional<seq_t> last_sequence() const;
+    void push_finished(finished_request);
+    std::span<const finished_request> finished() const {
+        return {_finished_requests.data(), _finished_count};
+    }
+
     ss::chunked_fifo<request_ptr, chunk_size> _inflight_requests;
-    ss::chunked_fifo<request_ptr, chunk_size> _finished_requests;
+    // oldest first, the first `_finished_count` entries are valid
+    std::array<finished_request, requests_cached_max> _finished_requests{};
+    uint8_t _finished_count{0};
     friend producer_state;
 };
 
@@ -141,6 +166,33 @@ private:
 /// producers on a given shard.
 class producer_state {
 public:
+    /// Scope of an operation entered with try_lock, the counterpart of the
+    /// scope of the function passed to run_with_lock.
+    class locked_scope {
+    public:
+        locked_scope(locked_scope&& other) noexcept
+          : units(std::move(other.units))
+          , _producer(std::exchange(other._producer, nullptr))
+          , _holder(std::move(other._holder)) {}
+        locked_scope& operator=(locked_scope&&) = delete;
+        locked_scope(const locked_scope&) = delete;
+        locked_scope& operator=(const locked_scope&) = delete;
+        ~locked_scope() noexcept;
+
+        /// Units of the op lock, may be returned before the scope ends
+        ssx::semaphore_units units;
+
+    private:
+        locked_scope(
+          producer_state& producer,
+          ss::gate::holder holder,
+          ssx::semaphore_units units);
+
+        producer_state* _producer;
+        ss::gate::holder _holder;
+        friend class producer_state;
+    };
+
     producer_state(
       producer_state_manager& mgr,
       model::producer_identity id,
@@ -196,6 +248,13 @@ public:
           });
     }
 
+    /// Non waiting variant of run_with_lock: the op lock is taken only if it
+    /// is free and no other operation is queued for it, the producer is then
+    /// unlinked from the manager until the returned scope is destroyed.
+    /// Returns nullopt if the lock is taken or the producer is shutting down,
+    /// the caller is expected to fall back to run_with_lock.
+    std::optional<locked_scope> try_lock();
+
     ss::future<> shutdown_input();
     ss::future<> evict();
     bool is_evicted() const { return _evicted; }
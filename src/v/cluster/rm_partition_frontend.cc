@@ -18,6 +18,7 @@
 #include "cluster/tx_gateway_service.h"
 #include "cluster/tx_helpers.h"
 #include "config/configuration.h"
+#include "features/feature_table.h"
 #include "errc.h"
 #include "rpc/connection_cache.h"
 #include "types.h"
@@ -25,6 +26,8 @@
 
 #include <seastar/core/coroutine.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <algorithm>
 
 namespace cluster {
@@ -257,21 +260,32 @@ ss::future<begin_tx_reply> rm_partition_frontend::do_begin_tx(
       });
 }
 
-ss::future<commit_tx_reply> rm_partition_frontend::commit_tx(
-  model::ntp ntp,
-  model::producer_identity pid,
-  model::tx_seq tx_seq,
-  model::timeout_clock::duration timeout) {
-    auto nt = model::topic_namespace(ntp.ns, ntp.tp.topic);
+std::optional<tx_errc>
+rm_partition_frontend::validate_tx_partition(const model::ntp& ntp) const {
+    auto nt = model::topic_namespace_view(ntp.ns, ntp.tp.topic);
 
     if (!_metadata_cache.local().contains(nt, ntp.tp.partition)) {
-        return ss::make_ready_future<commit_tx_reply>(
-          commit_tx_reply{tx_errc::partition_not_exists});
+        return tx_errc::partition_not_exists;
     }
 
     if (_metadata_cache.local().is_disabled(nt, ntp.tp.partition)) {
-        return ss::make_ready_future<commit_tx_reply>(
-          commit_tx_reply{tx_errc::partition_disabled});
+        return tx_errc::partition_disabled;
+    }
+    return std::nullopt;
+}
+
+bool rm_partition_frontend::is_commit_txs_supported() const {
+    return _controller->get_feature_table().local().is_active(
+      features::feature::tx_commit_batch);
+}
+
+ss::future<commit_tx_reply> rm_partition_frontend::commit_tx(
+  model::ntp ntp,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    if (auto ec = validate_tx_partition(ntp); ec) {
+        return ss::make_ready_future<commit_tx_reply>(commit_tx_reply{*ec});
     }
 
     auto leader = _leaders.local().get_leader(ntp);
@@ -400,6 +414,123 @@ ss::future<commit_tx_reply> rm_partition_frontend::do_commit_tx(
       });
 }
 
+ss::future<std::vector<commit_tx_reply>> rm_partition_frontend::commit_txs(
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    std::vector<commit_tx_reply> replies(ntps.size());
+    std::vector<ss::future<>> fs;
+    fs.reserve(ntps.size());
+    // indexes of the partitions led by each of the other nodes
+    absl::flat_hash_map<model::node_id, std::vector<size_t>> remote;
+    const auto batched = is_commit_txs_supported();
+    const auto self = _controller->self();
+
+    for (size_t i = 0; i < ntps.size(); ++i) {
+        const auto& ntp = ntps[i];
+        if (auto ec = validate_tx_partition(ntp); ec) {
+            replies[i] = commit_tx_reply{*ec};
+            continue;
+        }
+        auto leader = _leaders.local().get_leader(ntp);
+        if (!leader) {
+            vlog(txlog.warn, "can't find a leader for {} pid:{}", ntp, pid);
+            replies[i] = commit_tx_reply{tx_errc::leader_not_found};
+            continue;
+        }
+        if (*leader == self || !batched) {
+            fs.push_back(commit_tx(ntp, pid, tx_seq, timeout)
+                           .then([&replies, i](commit_tx_reply reply) {
+                               replies[i] = reply;
+                           }));
+            continue;
+        }
+        remote[*leader].push_back(i);
+    }
+
+    for (auto& [leader, indexes] : remote) {
+        std::vector<model::ntp> leader_ntps;
+        leader_ntps.reserve(indexes.size());
+        for (auto i : indexes) {
+            leader_ntps.push_back(ntps[i]);
+        }
+        vlog(
+          txlog.trace,
+          "dispatching name:commit_txs, ntps:{}, pid:{}, tx_seq:{}, from:{}, "
+          "to:{}",
+          leader_ntps,
+          pid,
+          tx_seq,
+          self,
+          leader);
+        auto f = dispatch_commit_txs(
+          leader, std::move(leader_ntps), pid, tx_seq, timeout);
+        fs.push_back(std::move(f).then(
+          [&replies, &indexes, pid, tx_seq](commit_txs_reply reply) {
+              vlog(
+                txlog.trace,
+                "received name:commit_txs, pid:{}, tx_seq:{}, replies:{}",
+                pid,
+                tx_seq,
+                reply.replies);
+              for (size_t j = 0; j < indexes.size(); ++j) {
+                  replies[indexes[j]] = j < reply.replies.size()
+                                          ? reply.replies[j]
+                                          : commit_tx_reply{tx_errc::timeout};
+              }
+          }));
+    }
+
+    co_await ss::when_all_succeed(fs.begin(), fs.end());
+    co_return replies;
+}
+
+ss::future<commit_txs_reply> rm_partition_frontend::dispatch_commit_txs(
+  model::node_id leader,
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    const auto num_partitions = ntps.size();
+    return _connection_cache.local()
+      .with_node_client<cluster::tx_gateway_client_protocol>(
+        _controller->self(),
+        ss::this_shard_id(),
+        leader,
+        timeout,
+        [request = commit_txs_request{std::move(ntps), pid, tx_seq, timeout}](
+          tx_gateway_client_protocol cp) mutable {
+            auto opts = rpc::client_opts(
+              model::timeout_clock::now() + request.timeout);
+            return cp.commit_txs(std::move(request), std::move(opts));
+        })
+      .then(&rpc::get_ctx_data<commit_txs_reply>)
+      .then([num_partitions](result<commit_txs_reply> r) {
+          if (r.has_error()) {
+              vlog(txlog.warn, "got error {} on remote commit txs", r.error());
+              return commit_txs_reply{std::vector<commit_tx_reply>(
+                num_partitions, commit_tx_reply{tx_errc::timeout})};
+          }
+
+          return std::move(r.value());
+      });
+}
+
+ss::future<commit_txs_reply> rm_partition_frontend::commit_txs_locally(
+  std::vector<model::ntp> ntps,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  model::timeout_clock::duration timeout) {
+    std::vector<ss::future<commit_tx_reply>> fs;
+    fs.reserve(ntps.size());
+    for (auto& ntp : ntps) {
+        fs.push_back(commit_tx_locally(std::move(ntp), pid, tx_seq, timeout));
+    }
+    auto replies = co_await ss::when_all_succeed(fs.begin(), fs.end());
+    co_return commit_txs_reply{std::move(replies)};
+}
+
 ss::future<abort_tx_reply> rm_partition_frontend::abort_tx(
   model::ntp ntp,
   model::producer_identity pid,
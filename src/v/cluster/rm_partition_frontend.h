@@ -19,6 +19,8 @@
 
 #include <seastar/core/abort_source.hh>
 
+#include <vector>
+
 namespace cluster {
 
 class rm_partition_frontend {
@@ -44,6 +46,14 @@ public:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    /// Commits the transaction on all the given partitions. The commits of
+    /// the partitions led by the same node are sent in a single RPC. The
+    /// replies are in the order of the partitions.
+    ss::future<std::vector<commit_tx_reply>> commit_txs(
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration);
     ss::future<abort_tx_reply> abort_tx(
       model::ntp,
       model::producer_identity,
@@ -67,6 +77,8 @@ private:
     std::chrono::milliseconds _metadata_dissemination_retry_delay_ms;
 
     bool is_leader_of(const model::ntp&) const;
+    std::optional<tx_errc> validate_tx_partition(const model::ntp&) const;
+    bool is_commit_txs_supported() const;
 
     ss::future<begin_tx_reply> dispatch_begin_tx(
       model::node_id,
@@ -104,6 +116,17 @@ private:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    ss::future<commit_txs_reply> dispatch_commit_txs(
+      model::node_id,
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration);
+    ss::future<commit_txs_reply> commit_txs_locally(
+      std::vector<model::ntp>,
+      model::producer_identity,
+      model::tx_seq,
+      model::timeout_clock::duration);
     ss::future<abort_tx_reply> dispatch_abort_tx(
       model::node_id,
       model::ntp,
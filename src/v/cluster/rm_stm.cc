@@ -1238,7 +1238,24 @@ ss::future<result<kafka_result>> rm_stm::do_sync_and_idempotent_replicate(
         // the safety check in replicate_in_stages sets it automatically
         co_return errc::not_leader;
     }
-    auto synced_term = _insync_term;
+    co_return co_await do_checked_idempotent_replicate(
+      _insync_term,
+      std::move(producer),
+      bid,
+      std::move(br),
+      opts,
+      std::move(enqueued),
+      units);
+}
+
+ss::future<result<kafka_result>> rm_stm::do_checked_idempotent_replicate(
+  model::term_id synced_term,
+  producer_ptr producer,
+  model::batch_identity bid,
+  model::record_batch_reader br,
+  raft::replicate_options opts,
+  ss::lw_shared_ptr<available_promise<>> enqueued,
+  ssx::semaphore_units& units) {
     auto result = co_await do_idempotent_replicate(
       synced_term,
       producer,
@@ -1338,6 +1355,24 @@ ss::future<result<kafka_result>> rm_stm::idempotent_replicate(
   raft::replicate_options opts,
   ss::lw_shared_ptr<available_promise<>> enqueued) {
     auto producer = maybe_create_producer(bid.pid);
+    // Fast path for the bulk of the produce traffic, idempotence being the
+    // default of the clients: when the stm is already in sync in the current
+    // term and no other request of the producer is queued, the request is
+    // checked against the sequence window of the producer and replicated
+    // right away, without waiting on the op queue of the producer or going
+    // through sync() and the transactional state it maintains.
+    if (is_synced_leader()) {
+        if (auto scope = producer->try_lock(); scope) {
+            co_return co_await do_checked_idempotent_replicate(
+              _insync_term,
+              producer,
+              bid,
+              std::move(br),
+              opts,
+              std::move(enqueued),
+              scope->units);
+        }
+    }
     co_return co_await producer->run_with_lock([&](ssx::semaphore_units units) {
         return do_sync_and_idempotent_replicate(
           producer,
@@ -1448,6 +1483,23 @@ static void filter_intersecting(
     }
 }
 
+// the ranges of an abort snapshot are sorted by their first offset
+static void filter_intersecting_sorted(
+  fragmented_vector<rm_stm::tx_range>& target,
+  const fragmented_vector<rm_stm::tx_range>& source,
+  model::offset from,
+  model::offset to) {
+    for (auto& range : source) {
+        if (range.first > to) {
+            break;
+        }
+        if (range.last < from) {
+            continue;
+        }
+        target.push_back(range);
+    }
+}
+
 ss::future<fragmented_vector<rm_stm::tx_range>>
 rm_stm::aborted_transactions(model::offset from, model::offset to) {
     return _state_lock.hold_read_lock().then(
@@ -1477,7 +1529,9 @@ rm_stm::do_aborted_transactions(model::offset from, model::offset to) {
         }
         if (_log_state.last_abort_snapshot.match(idx)) {
             const auto& opt = _log_state.last_abort_snapshot;
-            filter_intersecting(result, opt.aborted, from, to);
+            filter_intersecting_sorted(result, opt.aborted, from, to);
+        } else if (auto loaded = find_loaded_abort_snapshot(idx); loaded) {
+            filter_intersecting_sorted(result, loaded->aborted, from, to);
         } else {
             intersecting_idxes.push_back(idx);
         }
@@ -1488,7 +1542,8 @@ rm_stm::do_aborted_transactions(model::offset from, model::offset to) {
     for (const auto& idx : intersecting_idxes) {
         auto opt = co_await load_abort_snapshot(idx);
         if (opt) {
-            filter_intersecting(result, opt->aborted, from, to);
+            filter_intersecting_sorted(result, opt->aborted, from, to);
+            cache_loaded_abort_snapshot(std::move(*opt));
         }
     }
     vlog(
@@ -2188,6 +2243,11 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
         }
     }
     _log_state.abort_indexes = std::move(abort_indexes);
+    std::erase_if(
+      _log_state.loaded_abort_snapshots,
+      [start_offset](const abort_snapshot& snapshot) {
+          return snapshot.last < start_offset;
+      });
 
     vlog(
       _ctx_log.debug,
@@ -2237,6 +2297,7 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
         return ss::do_with(
           iobuf{},
           [this, start_kafka_offset, version](iobuf& tx_ss_buf) mutable {
+              const auto snapshot_offset = last_applied_offset();
               auto fut_serialize = ss::now();
               if (version == tx_snapshot_v4::version) {
                   tx_snapshot_v4 tx_ss;
@@ -2261,7 +2322,7 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
                           tx_ss.seqs.push_back(std::move(seq_entry));
                       }
                   }
-                  tx_ss.offset = last_applied_offset();
+                  tx_ss.offset = snapshot_offset;
 
                   for (const auto& entry : _log_state.current_txes) {
                       tx_ss.tx_data.push_back(tx_data_snapshot{
@@ -2280,13 +2341,7 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
               } else if (version == tx_snapshot::version) {
                   tx_snapshot tx_ss;
                   fill_snapshot_wo_seqs(tx_ss);
-                  for (const auto& [_, state] : _producers) {
-                      auto snapshot = state->snapshot(start_kafka_offset);
-                      if (!snapshot._finished_requests.empty()) {
-                          tx_ss.producers.push_back(std::move(snapshot));
-                      }
-                  }
-                  tx_ss.offset = last_applied_offset();
+                  tx_ss.offset = snapshot_offset;
 
                   for (const auto& entry : _log_state.current_txes) {
                       tx_ss.tx_data.push_back(tx_data_snapshot{
@@ -2301,16 +2356,52 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
                   }
                   tx_ss.highest_producer_id = _highest_producer_id;
 
-                  fut_serialize = reflection::async_adl<tx_snapshot>{}.to(
-                    tx_ss_buf, std::move(tx_ss));
+                  /**
+                   * Snapshotting all the producers at once stalls the reactor
+                   * when the partition has many of them, they are snapshotted
+                   * in a preemptible loop instead. The loop only holds
+                   * references to the producers as the map may change in the
+                   * meantime. A producer may then contain requests finished
+                   * after the snapshot offset, replaying the log tolerates
+                   * them in the same way as it tolerates the requests that
+                   * the leader finishes before they are applied.
+                   */
+                  fragmented_vector<producer_ptr> producers;
+                  for (const auto& [_, state] : _producers) {
+                      producers.push_back(state);
+                  }
+                  fut_serialize = ss::do_with(
+                    std::move(producers),
+                    std::move(tx_ss),
+                    [start_kafka_offset, &tx_ss_buf](
+                      fragmented_vector<producer_ptr>& producers,
+                      tx_snapshot& tx_ss) {
+                        return ss::do_for_each(
+                                 producers,
+                                 [start_kafka_offset,
+                                  &tx_ss](const producer_ptr& state) {
+                                     auto snapshot = state->snapshot(
+                                       start_kafka_offset);
+                                     if (!snapshot._finished_requests
+                                            .empty()) {
+                                         tx_ss.producers.push_back(
+                                           std::move(snapshot));
+                                     }
+                                 })
+                          .then([&tx_ss, &tx_ss_buf] {
+                              return reflection::async_adl<tx_snapshot>{}.to(
+                                tx_ss_buf, std::move(tx_ss));
+                          });
+                    });
 
               } else {
                   vassert(false, "unsupported tx_snapshot version {}", version);
               }
-              return fut_serialize.then([version, &tx_ss_buf, this]() {
-                  return raft::stm_snapshot::create(
-                    version, last_applied_offset(), std::move(tx_ss_buf));
-              });
+              return fut_serialize.then(
+                [version, snapshot_offset, &tx_ss_buf]() {
+                    return raft::stm_snapshot::create(
+                      version, snapshot_offset, std::move(tx_ss_buf));
+                });
           });
     });
 }
@@ -2388,6 +2479,35 @@ rm_stm::load_abort_snapshot(abort_index index) {
     co_return data;
 }
 
+const rm_stm::abort_snapshot*
+rm_stm::find_loaded_abort_snapshot(abort_index idx) {
+    auto& loaded = _log_state.loaded_abort_snapshots;
+    auto it = std::find_if(
+      loaded.begin(), loaded.end(), [idx](abort_snapshot& snapshot) {
+          return snapshot.match(idx);
+      });
+    if (it == loaded.end()) {
+        return nullptr;
+    }
+    if (it != loaded.begin()) {
+        std::rotate(loaded.begin(), it, std::next(it));
+    }
+    return &loaded.front();
+}
+
+void rm_stm::cache_loaded_abort_snapshot(abort_snapshot snapshot) {
+    auto& loaded = _log_state.loaded_abort_snapshots;
+    // the snapshot may have been loaded concurrently by another fetch
+    auto idx = abort_index{.first = snapshot.first, .last = snapshot.last};
+    if (find_loaded_abort_snapshot(idx)) {
+        return;
+    }
+    loaded.push_front(std::move(snapshot));
+    if (loaded.size() > max_loaded_abort_snapshots) {
+        loaded.pop_back();
+    }
+}
+
 ss::future<> rm_stm::remove_persistent_state() {
     // the write lock drains all ongoing operations and prevents
     // modification of _log_state.abort_indexes while we iterate
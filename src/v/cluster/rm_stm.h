@@ -43,6 +43,7 @@
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
 
+#include <deque>
 #include <system_error>
 
 namespace mt = util::mem_tracked;
@@ -298,6 +299,8 @@ private:
     ss::future<raft::stm_snapshot> take_local_snapshot() override;
     ss::future<raft::stm_snapshot> do_take_local_snapshot(uint8_t version);
     ss::future<std::optional<abort_snapshot>> load_abort_snapshot(abort_index);
+    const abort_snapshot* find_loaded_abort_snapshot(abort_index);
+    void cache_loaded_abort_snapshot(abort_snapshot);
     ss::future<> save_abort_snapshot(abort_snapshot);
 
     ss::future<result<kafka_result>> do_replicate(
@@ -344,6 +347,22 @@ private:
       ss::lw_shared_ptr<available_promise<>>,
       ssx::semaphore_units);
 
+    ss::future<result<kafka_result>> do_checked_idempotent_replicate(
+      model::term_id,
+      producer_ptr,
+      model::batch_identity,
+      model::record_batch_reader,
+      raft::replicate_options,
+      ss::lw_shared_ptr<available_promise<>>,
+      ssx::semaphore_units&);
+
+    // True if the stm caught up with the log of the current term and the
+    // requests can skip sync()
+    bool is_synced_leader() const {
+        return _raft->is_leader() && _insync_term == _raft->term()
+               && _mem_state.term == _insync_term;
+    }
+
     ss::future<result<kafka_result>> replicate_msg(
       model::record_batch_reader,
       raft::replicate_options,
@@ -470,6 +489,9 @@ private:
         fragmented_vector<tx_range> aborted;
         fragmented_vector<abort_index> abort_indexes;
         abort_snapshot last_abort_snapshot{.last = model::offset(-1)};
+        // abort snapshots recently loaded from disk to serve
+        // aborted_transactions, the most recently used first
+        std::deque<abort_snapshot> loaded_abort_snapshots;
         mt::unordered_map_t<
           absl::flat_hash_map,
           model::producer_identity,
@@ -499,6 +521,7 @@ private:
             aborted.clear();
             abort_indexes.clear();
             last_abort_snapshot = {model::offset(-1)};
+            loaded_abort_snapshots.clear();
         }
     };
 
@@ -632,6 +655,9 @@ private:
     std::chrono::milliseconds _tx_timeout_delay;
     std::chrono::milliseconds _abort_interval_ms;
     uint32_t _abort_index_segment_size;
+    // a consumer catching up reads many fetches worth of data within the
+    // range of a single abort snapshot
+    static constexpr size_t max_loaded_abort_snapshots = 2;
     bool _is_autoabort_enabled{true};
     bool _is_autoabort_active{false};
     bool _is_tx_enabled{false};
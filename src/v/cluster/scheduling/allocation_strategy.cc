@@ -41,31 +41,38 @@ inline bool contains_node_already(
     return it != current_allocations.end();
 }
 
-std::vector<model::node_id> solve_hard_constraints(
+/**
+ * Nodes are passed between the steps as pointers to avoid looking them up in
+ * the allocation state for every level of constraints.
+ */
+using candidates_t = std::vector<const allocation_node*>;
+
+candidates_t solve_hard_constraints(
   const model::ntp& ntp,
   const std::vector<model::broker_shard>& current_replicas,
   const std::vector<hard_constraint_ptr>& constraints,
   const allocation_state::underlying_t& nodes) {
-    std::vector<hard_constraint_evaluator> evaluators;
-    evaluators.reserve(constraints.size());
-    for (auto& c : constraints) {
-        evaluators.push_back(c->make_evaluator(ntp, current_replicas));
-    }
+    candidates_t possible_nodes;
+    possible_nodes.reserve(nodes.size());
 
     // empty hard constraints, all nodes are eligible
-    std::vector<model::node_id> possible_nodes;
     if (unlikely(constraints.empty())) {
-        possible_nodes.reserve(nodes.size());
         std::transform(
           nodes.begin(),
           nodes.end(),
           std::back_inserter(possible_nodes),
           [](const allocation_state::underlying_t::value_type& v) {
-              return v.first;
+              return v.second.get();
           });
         return possible_nodes;
     }
 
+    std::vector<hard_constraint_evaluator> evaluators;
+    evaluators.reserve(constraints.size());
+    for (auto& c : constraints) {
+        evaluators.push_back(c->make_evaluator(ntp, current_replicas));
+    }
+
     for (auto& p : nodes) {
         auto& node = p.second;
         auto result = std::all_of(
@@ -74,7 +81,7 @@ std::vector<model::node_id> solve_hard_constraints(
           [&node](const hard_constraint_evaluator& ev) { return ev(*node); });
 
         if (result) {
-            possible_nodes.push_back(p.first);
+            possible_nodes.push_back(node.get());
         }
     }
     return possible_nodes;
@@ -83,11 +90,10 @@ std::vector<model::node_id> solve_hard_constraints(
  * Optimize a single level of constraints, i.e. it finds a best fit set of nodes
  * for a given level of constraints
  */
-std::vector<model::node_id> optimize_constraints(
-  const std::vector<model::node_id>& possible_nodes,
+candidates_t optimize_constraints(
+  const candidates_t& possible_nodes,
   const soft_constraints_level& constraints,
-  const std::vector<model::broker_shard>& current_replicas,
-  const allocation_state::underlying_t& allocation_nodes) {
+  const std::vector<model::broker_shard>& current_replicas) {
     std::vector<soft_constraint_evaluator> evaluators;
     evaluators.reserve(constraints.size());
     for (auto& c : constraints) {
@@ -95,13 +101,9 @@ std::vector<model::node_id> optimize_constraints(
     }
 
     uint32_t best_score = 0;
-    std::vector<model::node_id> best_fits;
+    candidates_t best_fits;
 
-    for (const auto& id : possible_nodes) {
-        auto it = allocation_nodes.find(id);
-        if (it == allocation_nodes.end()) {
-            continue;
-        }
+    for (const auto* node : possible_nodes) {
         /**
          * Score is normalized so that it is always in range [0, max_score_size]
          */
@@ -109,7 +111,7 @@ std::vector<model::node_id> optimize_constraints(
                            evaluators.begin(),
                            evaluators.end(),
                            uint32_t{0},
-                           [&node = it->second](
+                           [node](
                              uint32_t score,
                              const soft_constraint_evaluator& ev) {
                                const auto current_score = ev(*node);
@@ -120,7 +122,7 @@ std::vector<model::node_id> optimize_constraints(
         vlog(
           clusterlog.trace,
           "node: {}, total normalized score: {} ({})",
-          id,
+          node->id(),
           score,
           (double)score / soft_constraint::max_score);
         if (score >= best_score) {
@@ -129,7 +131,7 @@ std::vector<model::node_id> optimize_constraints(
                 best_score = score;
                 best_fits.clear();
             }
-            best_fits.push_back(it->first);
+            best_fits.push_back(node);
         }
     }
 
@@ -143,18 +145,20 @@ std::vector<model::node_id> optimize_constraints(
 model::node_id find_best_fit(
   const std::vector<model::broker_shard>& current_replicas,
   const soft_constraints_hierarchy& constraints,
-  std::vector<model::node_id> possible_nodes,
-  const allocation_state::underlying_t& allocation_nodes) {
-    std::vector<model::node_id> to_optimize = std::move(possible_nodes);
+  candidates_t possible_nodes) {
+    candidates_t to_optimize = std::move(possible_nodes);
     // this loop optimizes each level of constrains and then move on to the next
     // one leaving the previous error at the minimum
 
     for (const auto& lvl : constraints) {
-        to_optimize = optimize_constraints(
-          to_optimize, lvl, current_replicas, allocation_nodes);
+        // the following levels can't change the outcome anymore
+        if (to_optimize.size() == 1) {
+            break;
+        }
+        to_optimize = optimize_constraints(to_optimize, lvl, current_replicas);
     }
 
-    return random_generators::random_choice(to_optimize);
+    return random_generators::random_choice(to_optimize)->id();
 }
 
 allocation_strategy simple_allocation_strategy() {
@@ -166,11 +170,10 @@ allocation_strategy simple_allocation_strategy() {
           const allocation_constraints& request,
           allocation_state& state,
           const partition_allocation_domain) final {
-            const auto& nodes = state.allocation_nodes();
             /**
              * evaluate hard constraints
              */
-            std::vector<model::node_id> possible_nodes = solve_hard_constraints(
+            auto possible_nodes = solve_hard_constraints(
               ntp,
               current_replicas,
               request.hard_constraints,
@@ -183,13 +186,10 @@ allocation_strategy simple_allocation_strategy() {
             /**
              * soft constraints
              */
-            auto best_fit = find_best_fit(
+            return find_best_fit(
               current_replicas,
               request.soft_constraints,
-              possible_nodes,
-              nodes);
-
-            return best_fit;
+              std::move(possible_nodes));
         }
     };
     return make_allocation_strategy<impl>();
@@ -43,6 +43,7 @@
 #include <algorithm>
 #include <chrono>
 #include <memory>
+#include <vector>
 
 namespace cluster {
 
@@ -490,69 +491,102 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         co_return ss::stop_iteration::yes;
     }
 
+    /*
+     * plan a batch of transfers. every movement is applied to the strategy
+     * right away so that the following ones take it into account.
+     */
+    auto skip = muted_groups();
+    std::vector<reassignment> batch;
+    absl::flat_hash_map<model::node_id, size_t> transfers_from_node;
     for (size_t i = 0; i < allowed_change_cnt; i++) {
         if (should_stop_balance()) {
             co_return ss::stop_iteration::yes;
         }
 
-        auto transfer = strategy->find_movement(muted_groups());
+        auto transfer = strategy->find_movement(skip);
         if (!transfer) {
-            vlog(
-              clusterlog.debug,
-              "No leadership balance improvements found with total delta {}, "
-              "number of muted groups {}",
-              strategy->error(),
-              _muted.size());
-            if (!_timer.armed()) {
-                _timer.arm(_idle_timeout());
-            }
-            _probe.leader_transfer_no_improvement();
-            co_return ss::stop_iteration::yes;
+            break;
         }
+        skip.insert(transfer->group);
 
-        _in_flight_changes[transfer->group] = {
-          *transfer, clock_type::now() + _mute_timeout()};
-        check_register_leadership_change_notification();
+        auto& from_cnt = transfers_from_node[transfer->from.node_id];
+        if (from_cnt >= max_concurrent_transfers_per_node) {
+            continue;
+        }
+        ++from_cnt;
+        strategy->apply_movement(*transfer);
+        batch.push_back(*transfer);
+    }
 
-        auto success = co_await do_transfer(*transfer);
-        if (!success) {
-            vlog(
-              clusterlog.info,
-              "Error transferring leadership group {} from {} to {}",
-              transfer->group,
-              transfer->from,
-              transfer->to);
+    if (batch.empty()) {
+        vlog(
+          clusterlog.debug,
+          "No leadership balance improvements found with total delta {}, "
+          "number of muted groups {}",
+          strategy->error(),
+          _muted.size());
+        if (!_timer.armed()) {
+            _timer.arm(_idle_timeout());
+        }
+        _probe.leader_transfer_no_improvement();
+        co_return ss::stop_iteration::yes;
+    }
 
-            _in_flight_changes.erase(transfer->group);
-            check_unregister_leadership_change_notification();
+    for (const auto& transfer : batch) {
+        _in_flight_changes[transfer.group] = {
+          transfer, clock_type::now() + _mute_timeout()};
+    }
+    check_register_leadership_change_notification();
 
-            /*
-             * a common scenario is that a node loses all its leadership (e.g.
-             * restarts) and then it is recognized as having lots of extra
-             * capacity (which it does). but the balancer doesn't consider node
-             * health when making decisions. so when we fail transfer we inject
-             * a short delay to avoid spinning on sending transfer requests to a
-             * failed node. of course failure can happen for other reasons, so
-             * don't delay a lot.
-             */
-            _probe.leader_transfer_error();
-            co_await ss::sleep_abortable(5s, _as.local());
-            co_return ss::stop_iteration::no;
+    vlog(
+      clusterlog.debug,
+      "Leadership balancer tick: dispatching {} transfers",
+      batch.size());
+
+    size_t failed = 0;
+    co_await ss::parallel_for_each(
+      batch, [this, &failed](const reassignment& transfer) {
+          return do_transfer(transfer).then([this, &failed, &transfer](
+                                              bool success) {
+              if (!success) {
+                  vlog(
+                    clusterlog.info,
+                    "Error transferring leadership group {} from {} to {}",
+                    transfer.group,
+                    transfer.from,
+                    transfer.to);
+                  ++failed;
+                  _in_flight_changes.erase(transfer.group);
+                  _probe.leader_transfer_error();
+                  return;
+              }
+              _probe.leader_transfer_succeeded();
+              /*
+               * if leadership moved, or it timed out we'll mute the group for
+               * a while and continue to avoid any thrashing. notice that we
+               * don't check for movement to the exact shard we requested.
+               * this is because we want to avoid thrashing (we'll still mute
+               * the group), but also because we may have simply been racing
+               * with organic leadership movement.
+               */
+              _muted.try_emplace(
+                transfer.group, clock_type::now() + _mute_timeout());
+          });
+      });
 
-        } else {
-            _probe.leader_transfer_succeeded();
-            strategy->apply_movement(*transfer);
-        }
+    if (failed > 0) {
+        check_unregister_leadership_change_notification();
 
         /*
-         * if leadership moved, or it timed out we'll mute the group for a while
-         * and continue to avoid any thrashing. notice that we don't check for
-         * movement to the exact shard we requested. this is because we want to
-         * avoid thrashing (we'll still mute the group), but also because we may
-         * have simply been racing with organic leadership movement.
+         * a common scenario is that a node loses all its leadership (e.g.
+         * restarts) and then it is recognized as having lots of extra
+         * capacity (which it does). but the balancer doesn't consider node
+         * health when making decisions. so when we fail transfer we inject
+         * a short delay to avoid spinning on sending transfer requests to a
+         * failed node. of course failure can happen for other reasons, so
+         * don't delay a lot.
          */
-        _muted.try_emplace(
-          transfer->group, clock_type::now() + _mute_timeout());
+        co_await ss::sleep_abortable(5s, _as.local());
     }
 
     co_return ss::stop_iteration::no;
@@ -80,6 +80,14 @@ class leader_balancer {
       transfer_leadership_recovery_timeout
       = 25ms;
 
+    /*
+     * The transfers planned in a tick are dispatched concurrently. This bounds
+     * the number of concurrent transfers away from a single node, so that a
+     * node that lost all its leaderships (e.g. after a restart) isn't flooded
+     * with transfer requests from every other node at once.
+     */
+    static constexpr size_t max_concurrent_transfers_per_node = 32;
+
 public:
     leader_balancer(
       topic_table&,
@@ -0,0 +1,410 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/self_test/cloudcheck.h"
+
+#include "cloud_storage/types.h"
+#include "cluster/logger.h"
+#include "likely.h"
+#include "random/generators.h"
+#include "ssx/sformat.h"
+#include "units.h"
+#include "utils/retry_chain_node.h"
+#include "utils/uuid.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+
+#include <boost/range/irange.hpp>
+
+namespace cluster::self_test {
+
+namespace {
+
+/// Large enough for the slowest request that isn't a timeout
+constexpr int64_t one_minute_us = 60'000'000;
+constexpr auto request_backoff = std::chrono::milliseconds(100);
+constexpr size_t max_object_size = 128_MiB;
+
+void check_result(cloud_storage::upload_result r, std::string_view op) {
+    switch (r) {
+    case cloud_storage::upload_result::success:
+        return;
+    case cloud_storage::upload_result::timedout:
+        throw omit_measure_timed_out_exception();
+    case cloud_storage::upload_result::cancelled:
+        throw cloudcheck_aborted_exception();
+    case cloud_storage::upload_result::failed:
+        throw cloudcheck_exception(fmt::format("{} request failed", op));
+    }
+}
+
+void check_result(cloud_storage::download_result r, std::string_view op) {
+    switch (r) {
+    case cloud_storage::download_result::success:
+        return;
+    case cloud_storage::download_result::timedout:
+        throw omit_measure_timed_out_exception();
+    case cloud_storage::download_result::notfound:
+        throw cloudcheck_exception(
+          fmt::format("{} request failed, object not found", op));
+    case cloud_storage::download_result::failed:
+        throw cloudcheck_exception(fmt::format("{} request failed", op));
+    }
+}
+
+ss::future<uint64_t> drain(uint64_t, ss::input_stream<char> stream) {
+    uint64_t read = 0;
+    std::exception_ptr ex;
+    try {
+        while (true) {
+            auto buf = co_await stream.read();
+            if (buf.empty()) {
+                break;
+            }
+            read += buf.size();
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await stream.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return read;
+}
+
+iobuf make_payload(size_t size) {
+    static constexpr size_t fragment_size = 128_KiB;
+    iobuf payload;
+    while (payload.size_bytes() < size) {
+        const auto len = std::min(fragment_size, size - payload.size_bytes());
+        ss::temporary_buffer<char> buf(len);
+        random_generators::fill_buffer_randomchars(buf.get_write(), len);
+        payload.append(std::move(buf));
+    }
+    return payload;
+}
+
+} // namespace
+
+void cloudcheck::validate_options(const cloudcheck_opts& opts) {
+    using namespace std::chrono_literals;
+    if (opts.object_sizes.empty() || opts.parallelism.empty()) {
+        throw cloudcheck_option_out_of_range(
+          "At least one object size and one parallelism are required");
+    }
+    for (auto size : opts.object_sizes) {
+        if (size < 1 || size > max_object_size) {
+            throw cloudcheck_option_out_of_range(
+              "Object size out of range, min is 1 byte, max is 128MiB");
+        }
+    }
+    for (auto parallelism : opts.parallelism) {
+        if (parallelism < 1 || parallelism > 256) {
+            throw cloudcheck_option_out_of_range(
+              "Parallelism out of range, min is 1, max 256");
+        }
+    }
+    const auto duration = std::chrono::duration_cast<std::chrono::seconds>(
+      opts.duration);
+    if (duration < 1s || duration > (5 * 60s)) {
+        throw cloudcheck_option_out_of_range(
+          "Duration out of range, min is 1s max is 5 minutes");
+    }
+    if (opts.request_timeout < 1s || opts.request_timeout > 5min) {
+        throw cloudcheck_option_out_of_range(
+          "Request timeout out of range, min is 1s max is 5 minutes");
+    }
+}
+
+cloudcheck::cloudcheck(
+  model::node_id self, ss::sharded<cloud_storage::remote>& cloud)
+  : _self(self)
+  , _cloud(cloud) {}
+
+ss::future<> cloudcheck::start() { return ss::now(); }
+
+ss::future<> cloudcheck::stop() {
+    /// If test is currently running, expect `cloudcheck_aborted_exception`
+    auto f = _gate.close();
+    _as.request_abort();
+    return f;
+}
+
+void cloudcheck::cancel() { _cancelled = true; }
+
+ss::future<std::vector<self_test_result>>
+cloudcheck::run(cloudcheck_opts opts) {
+    if (_gate.is_closed()) {
+        vlog(clusterlog.debug, "cloudcheck - gate already closed");
+        co_return std::vector<self_test_result>();
+    }
+    auto g = _gate.hold();
+    co_await ss::futurize_invoke(validate_options, opts);
+    if (!_cloud.local_is_initialized()) {
+        throw cloudcheck_misconfigured_exception(
+          "Cloud storage is not enabled on this node");
+    }
+    const auto& bucket = cloud_storage::configuration::get_bucket_config();
+    if (!bucket().has_value()) {
+        throw cloudcheck_misconfigured_exception(
+          "No bucket is configured for cloud storage");
+    }
+    vlog(
+      clusterlog.info,
+      "Starting redpanda self-test cloud storage benchmark, with options: {}",
+      opts);
+    _cancelled = false;
+    _opts = std::move(opts);
+    _bucket = cloud_storage_clients::bucket_name(*bucket());
+    _keys.clear();
+    /// The objects of every run are under a prefix of their own, a node that
+    /// crashed mid run leaves them behind but never overwrites them
+    const auto prefix = ssx::sformat(
+      "self-test/{}/{}", _self, uuid_t::create());
+    std::vector<self_test_result> results;
+    std::exception_ptr ex;
+    try {
+        results = co_await ss::with_scheduling_group(
+          _opts.sg,
+          [this, &prefix] { return run_configured_benchmarks(prefix); });
+    } catch (const cloudcheck_aborted_exception&) {
+        vlog(clusterlog.debug, "cloudcheck stopped due to call to stop()");
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await remove_leftovers();
+    vlog(
+      clusterlog.debug,
+      "redpanda self-test cloud storage benchmark completed gracefully");
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return results;
+}
+
+ss::future<std::vector<self_test_result>>
+cloudcheck::run_configured_benchmarks(const ss::sstring& prefix) {
+    std::vector<self_test_result> r;
+    for (auto size : _opts.object_sizes) {
+        auto payload = make_payload(size);
+        for (auto parallelism : _opts.parallelism) {
+            if (_cancelled) {
+                co_return r;
+            }
+            std::vector<cloud_storage_clients::object_key> uploaded;
+            request_fn put_fn = [this, &prefix, &payload, &uploaded, size] {
+                cloud_storage_clients::object_key key(
+                  fmt::format("{}/{}/{}", prefix, size, _keys.size()));
+                _keys.push_back(key);
+                return put(key, payload).then([&uploaded, key](size_t n) {
+                    uploaded.push_back(key);
+                    return n;
+                });
+            };
+            auto put_metrics = co_await do_run_benchmark(parallelism, put_fn);
+            r.push_back(make_result(
+              put_metrics,
+              ssx::sformat(
+                "put run, object size: {}, parallelism: {}",
+                size,
+                parallelism)));
+            if (_cancelled) {
+                co_return r;
+            }
+            if (uploaded.empty()) {
+                auto result = make_result(
+                  metrics{one_minute_us},
+                  ssx::sformat(
+                    "get run, object size: {}, parallelism: {}",
+                    size,
+                    parallelism));
+                result.warning = "No object could be uploaded to download";
+                r.push_back(std::move(result));
+                continue;
+            }
+            size_t next = 0;
+            request_fn get_fn = [this, &uploaded, &next, size] {
+                return get(uploaded[next++ % uploaded.size()], size);
+            };
+            auto get_metrics = co_await do_run_benchmark(parallelism, get_fn);
+            r.push_back(make_result(
+              get_metrics,
+              ssx::sformat(
+                "get run, object size: {}, parallelism: {}",
+                size,
+                parallelism)));
+        }
+    }
+    if (!_opts.skip_list && !_cancelled) {
+        request_fn list_fn = [this, &prefix] { return list(prefix); };
+        auto list_metrics = co_await do_run_benchmark(1, list_fn);
+        r.push_back(make_result(
+          list_metrics,
+          ssx::sformat("list run, objects: {}", _keys.size())));
+    }
+    if (!_cancelled) {
+        const auto parallelism = *std::max_element(
+          _opts.parallelism.begin(), _opts.parallelism.end());
+        const auto objects = _keys.size();
+        auto delete_metrics = co_await do_run_delete_benchmark(parallelism);
+        r.push_back(make_result(
+          delete_metrics,
+          ssx::sformat(
+            "delete run, objects: {}, parallelism: {}",
+            objects,
+            parallelism)));
+    }
+    co_return r;
+}
+
+ss::future<metrics>
+cloudcheck::do_run_benchmark(uint16_t parallelism, request_fn& fn) {
+    auto irange = boost::irange<uint16_t>(0, parallelism);
+    auto start = ss::lowres_clock::now();
+    metrics m{one_minute_us};
+    co_await ss::parallel_for_each(
+      irange, [this, stop = start + _opts.duration, &fn, &m](auto) {
+          return run_benchmark_fiber(stop, fn, m);
+      });
+    m.set_total_time(ss::lowres_clock::now() - start);
+    co_return m;
+}
+
+ss::future<> cloudcheck::run_benchmark_fiber(
+  ss::lowres_clock::time_point stop, request_fn& fn, metrics& m) {
+    while (stop > ss::lowres_clock::now() && !_cancelled) {
+        if (unlikely(_as.abort_requested())) {
+            throw cloudcheck_aborted_exception();
+        }
+        co_await m.measure([&fn] { return fn(); });
+    }
+}
+
+ss::future<metrics> cloudcheck::do_run_delete_benchmark(uint16_t parallelism) {
+    auto irange = boost::irange<uint16_t>(0, parallelism);
+    auto start = ss::lowres_clock::now();
+    metrics m{one_minute_us};
+    co_await ss::parallel_for_each(
+      irange, [this, &m](auto) { return run_delete_fiber(m); });
+    m.set_total_time(ss::lowres_clock::now() - start);
+    co_return m;
+}
+
+ss::future<> cloudcheck::run_delete_fiber(metrics& m) {
+    while (!_keys.empty() && !_cancelled) {
+        if (unlikely(_as.abort_requested())) {
+            throw cloudcheck_aborted_exception();
+        }
+        auto key = std::move(_keys.back());
+        _keys.pop_back();
+        try {
+            co_await m.measure([this, &key] { return remove(key); });
+        } catch (...) {
+            /// Left for remove_leftovers()
+            _keys.push_back(std::move(key));
+            throw;
+        }
+    }
+}
+
+ss::future<size_t>
+cloudcheck::put(cloud_storage_clients::object_key key, iobuf& payload) {
+    retry_chain_node fib(
+      _as, _opts.request_timeout, request_backoff, retry_strategy::disallow);
+    const auto size = payload.size_bytes();
+    auto res = co_await _cloud.local().upload_object(
+      _bucket, key, payload.share(0, size), fib, "self-test object");
+    check_result(res, "Put");
+    co_return size;
+}
+
+ss::future<size_t>
+cloudcheck::get(const cloud_storage_clients::object_key& key, size_t size) {
+    static const cloud_storage::remote::download_metrics no_metrics{};
+    retry_chain_node fib(
+      _as, _opts.request_timeout, request_backoff, retry_strategy::disallow);
+    auto res = co_await _cloud.local().download_stream(
+      _bucket,
+      cloud_storage::remote_segment_path(key()),
+      drain,
+      fib,
+      "self-test object",
+      no_metrics);
+    check_result(res, "Get");
+    co_return size;
+}
+
+ss::future<size_t> cloudcheck::list(const ss::sstring& prefix) {
+    retry_chain_node fib(
+      _as, _opts.request_timeout, request_backoff, retry_strategy::disallow);
+    auto res = co_await _cloud.local().list_objects(
+      _bucket, fib, cloud_storage_clients::object_key(prefix));
+    if (res.has_error()) {
+        if (res.error() == cloud_storage_clients::error_outcome::retry) {
+            throw omit_measure_timed_out_exception();
+        }
+        throw cloudcheck_exception("List request failed");
+    }
+    co_return 0;
+}
+
+ss::future<size_t>
+cloudcheck::remove(const cloud_storage_clients::object_key& key) {
+    retry_chain_node fib(
+      _as, _opts.request_timeout, request_backoff, retry_strategy::disallow);
+    auto res = co_await _cloud.local().delete_object(_bucket, key, fib);
+    check_result(res, "Delete");
+    co_return 0;
+}
+
+ss::future<> cloudcheck::remove_leftovers() {
+    if (_keys.empty()) {
+        co_return;
+    }
+    if (_as.abort_requested()) {
+        vlog(
+          clusterlog.warn,
+          "Shutting down, {} self-test objects are left in bucket {}",
+          _keys.size(),
+          _bucket);
+        co_return;
+    }
+    retry_chain_node fib(_as, _opts.request_timeout * 2, request_backoff);
+    auto keys = std::exchange(_keys, {});
+    const auto count = keys.size();
+    auto res = co_await _cloud.local().delete_objects(
+      _bucket, std::move(keys), fib);
+    if (res != cloud_storage::upload_result::success) {
+        vlog(
+          clusterlog.warn,
+          "Couldn't delete {} self-test objects from bucket {}: {}",
+          count,
+          _bucket,
+          res);
+    }
+}
+
+self_test_result
+cloudcheck::make_result(const metrics& m, ss::sstring info) const {
+    auto result = m.to_st_result();
+    result.name = _opts.name;
+    result.info = std::move(info);
+    result.test_type = "cloud";
+    if (_cancelled) {
+        result.warning = "Run was manually cancelled";
+    }
+    return result;
+}
+
+} // namespace cluster::self_test
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cloud_storage/remote.h"
+#include "cluster/self_test/metrics.h"
+#include "cluster/self_test_rpc_types.h"
+#include "seastarx.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+namespace cluster::self_test {
+
+class cloudcheck_exception : public std::runtime_error {
+public:
+    explicit cloudcheck_exception(const std::string& msg)
+      : std::runtime_error(msg) {}
+};
+class cloudcheck_aborted_exception final : public cloudcheck_exception {
+public:
+    cloudcheck_aborted_exception()
+      : cloudcheck_exception("User aborted benchmark") {}
+};
+class cloudcheck_misconfigured_exception final : public cloudcheck_exception {
+public:
+    explicit cloudcheck_misconfigured_exception(const std::string& msg)
+      : cloudcheck_exception(msg) {}
+};
+class cloudcheck_option_out_of_range final : public cloudcheck_exception {
+public:
+    explicit cloudcheck_option_out_of_range(const std::string& msg)
+      : cloudcheck_exception(msg) {}
+};
+
+/// Object storage benchmark using the cloud_storage::remote of the node
+///
+/// For every object size and parallelism configured, objects are uploaded
+/// for the duration of the run and then the same objects are downloaded for
+/// as long. Then the objects are listed, and deleted one by one, which gives
+/// the list latency and the delete rate. The objects are written under a
+/// prefix of their own in the cluster bucket and always removed at the end.
+///
+/// The requests go through the client pool of the shard, a parallelism above
+/// cloud_storage_max_connections measures the queueing for a client too.
+class cloudcheck final {
+public:
+    /// Made public for unit testing, only used internally
+    ///
+    static void validate_options(const cloudcheck_opts& opts);
+
+    /// Class constructor
+    ///
+    cloudcheck(model::node_id self, ss::sharded<cloud_storage::remote>& cloud);
+
+    /// Initialize the benchmark
+    ///
+    ss::future<> start();
+
+    /// Stops the benchmark
+    ///
+    /// On resolution of the future returned all async work will have completed
+    /// upon success or with failure (abruptly stoppped - work incomplete)
+    ss::future<> stop();
+
+    /// Run the actual cloud storage benchmark
+    ///
+    /// Throws cloudcheck_misconfigured_exception if cloud storage isn't
+    /// enabled on the node.
+    ss::future<std::vector<self_test_result>> run(cloudcheck_opts);
+
+    /// Signal to stop all work as soon as possible
+    ///
+    /// Immediately returns, waiter can expect to wait on the results to be
+    /// returned by \run to be available shortly. The objects uploaded so far
+    /// are still removed.
+    void cancel();
+
+private:
+    using request_fn = ss::noncopyable_function<ss::future<size_t>()>;
+
+    ss::future<std::vector<self_test_result>>
+    run_configured_benchmarks(const ss::sstring& prefix);
+
+    /// Runs \p parallelism fibers issuing requests until the duration of the
+    /// run is reached
+    ss::future<metrics> do_run_benchmark(uint16_t parallelism, request_fn& fn);
+
+    ss::future<> run_benchmark_fiber(
+      ss::lowres_clock::time_point stop, request_fn& fn, metrics& m);
+
+    /// Deletes the uploaded objects one by one with \p parallelism fibers
+    ss::future<metrics> do_run_delete_benchmark(uint16_t parallelism);
+
+    ss::future<> run_delete_fiber(metrics& m);
+
+    ss::future<size_t> put(cloud_storage_clients::object_key, iobuf& payload);
+    ss::future<size_t> get(const cloud_storage_clients::object_key&, size_t);
+    ss::future<size_t> list(const ss::sstring& prefix);
+    ss::future<size_t> remove(const cloud_storage_clients::object_key&);
+
+    /// Deletes the objects that weren't deleted by the delete benchmark
+    ss::future<> remove_leftovers();
+
+    self_test_result make_result(const metrics&, ss::sstring info) const;
+
+private:
+    model::node_id _self;
+    ss::sharded<cloud_storage::remote>& _cloud;
+    cloud_storage_clients::bucket_name _bucket;
+    /// Every object the benchmark attempted to upload, removed at the end
+    std::vector<cloud_storage_clients::object_key> _keys;
+    bool _cancelled{false};
+    cloudcheck_opts _opts;
+    ss::abort_source _as;
+    ss::gate _gate;
+};
+
+} // namespace cluster::self_test
@@ -14,6 +14,8 @@
 #include "cluster/logger.h"
 #include "random/generators.h"
 #include "ssx/sformat.h"
+#include "storage/chunk_cache.h"
+#include "storage/segment_utils.h"
 #include "utils/uuid.h"
 #include "vassert.h"
 #include "vlog.h"
@@ -39,6 +41,20 @@ void diskcheck::validate_options(const diskcheck_opts& opts) {
         throw diskcheck_option_out_of_range(
           "IO Queue depth (parallelism) out of range, min is 1, max 256");
     }
+    if (opts.workload == diskcheck_workload::appender) {
+        if (opts.skip_write) {
+            throw diskcheck_option_out_of_range(
+              "The appender workload only writes, skip_write must be false");
+        }
+        if (opts.partitions < 1 || opts.partitions > 1024) {
+            throw diskcheck_option_out_of_range(
+              "Partitions out of range, min is 1, max 1024");
+        }
+        if (opts.request_size < 1) {
+            throw diskcheck_option_out_of_range(
+              "Batch size (request_size) must be at least 1 byte");
+        }
+    }
 }
 
 diskcheck::diskcheck(ss::sharded<node::local_monitor>& nlm)
@@ -100,6 +116,29 @@ ss::future<std::vector<self_test_result>> diskcheck::run(diskcheck_opts opts) {
       _opts.dir.string(),
       uuid_t::create(),
       ss::this_shard_id());
+    if (_opts.workload == diskcheck_workload::appender) {
+        co_return co_await ss::with_scheduling_group(
+                   _opts.sg,
+                   [this, fname] { return run_appender_benchmark(fname); })
+          .finally([this, fname] {
+              vlog(
+                clusterlog.debug,
+                "redpanda self-test disk benchmark completed gracefully");
+              return ss::parallel_for_each(
+                boost::irange<uint16_t>(0, _opts.partitions),
+                [fname](uint16_t p) {
+                    auto segment = ssx::sformat("{}-{}", fname, p);
+                    return ss::remove_file(segment).handle_exception(
+                      [segment](const std::exception_ptr& ex) {
+                          vlog(
+                            clusterlog.error,
+                            "Couldn't delete {}, reason {}",
+                            segment,
+                            ex);
+                      });
+                });
+          });
+    }
     co_return co_await initialize_benchmark(fname).finally([fname] {
         vlog(
           clusterlog.debug,
@@ -218,6 +257,122 @@ ss::future<> diskcheck::run_benchmark_fiber(
     }
 }
 
+ss::future<std::vector<self_test_result>>
+diskcheck::run_appender_benchmark(ss::sstring fname) {
+    if (_opts.request_size > _opts.file_size() / _opts.partitions) {
+        throw diskcheck_option_out_of_range(fmt::format(
+          "Batch size (request_size) {} larger than a segment, data_size / "
+          "shards / partitions: {}",
+          _opts.request_size,
+          _opts.file_size() / _opts.partitions));
+    }
+    /// A flush can take much longer than a read or a write
+    static const auto five_seconds_us = 5000000;
+    metrics appends{five_seconds_us};
+    metrics flushes{five_seconds_us};
+    iobuf batch;
+    {
+        auto buf = ss::temporary_buffer<char>(_opts.request_size);
+        random_generators::fill_buffer_randomchars(
+          buf.get_write(), buf.size());
+        batch.append(std::move(buf));
+    }
+    auto start = ss::lowres_clock::now();
+    auto stop = start + _opts.duration;
+    try {
+        co_await ss::parallel_for_each(
+          boost::irange<uint16_t>(0, _opts.partitions),
+          [this, stop, &fname, &batch, &appends, &flushes](uint16_t p) {
+              return run_appender_fiber(
+                stop, ssx::sformat("{}-{}", fname, p), batch, appends, flushes);
+          });
+    } catch (const diskcheck_aborted_exception&) {
+        vlog(clusterlog.debug, "diskcheck stopped due to call to stop()");
+        co_return std::vector<self_test_result>{};
+    }
+    const auto elapsed = ss::lowres_clock::now() - start;
+    appends.set_total_time(elapsed);
+    flushes.set_total_time(elapsed);
+
+    auto make_result = [this](const metrics& m, std::string_view info) {
+        auto result = m.to_st_result();
+        result.name = _opts.name;
+        result.info = ssx::sformat(
+          "{}, partitions: {}, flush_bytes: {}",
+          info,
+          _opts.partitions,
+          _opts.flush_bytes);
+        result.test_type = "disk";
+        if (_cancelled) {
+            result.warning = "Run was manually cancelled";
+        }
+        return result;
+    };
+    std::vector<self_test_result> r;
+    r.push_back(make_result(appends, "appender write run"));
+    r.push_back(make_result(flushes, "appender flush run"));
+    co_return r;
+}
+
+ss::future<> diskcheck::run_appender_fiber(
+  ss::lowres_clock::time_point stop,
+  ss::sstring fname,
+  const iobuf& batch,
+  metrics& appends,
+  metrics& flushes) {
+    const auto segment_size = _opts.file_size() / _opts.partitions;
+    const auto batch_size = batch.size_bytes();
+    auto appender = co_await make_appender(fname);
+    std::exception_ptr ex;
+    try {
+        uint64_t unflushed = 0;
+        while (stop > ss::lowres_clock::now() && !_cancelled) {
+            if (unlikely(_as.abort_requested())) {
+                throw diskcheck_aborted_exception();
+            }
+            if (appender->file_byte_offset() + batch_size > segment_size) {
+                /// Roll, the new segment reuses the name of the old one
+                co_await appender->close();
+                appender = co_await make_appender(fname);
+                unflushed = 0;
+            }
+            co_await appends.measure([&appender, &batch, batch_size] {
+                return appender->append(batch).then(
+                  [batch_size] { return batch_size; });
+            });
+            unflushed += batch_size;
+            if (unflushed >= _opts.flush_bytes) {
+                co_await flushes.measure([&appender, unflushed] {
+                    return appender->flush().then(
+                      [unflushed] { return size_t(unflushed); });
+                });
+                unflushed = 0;
+            }
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await appender->close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+ss::future<storage::segment_appender_ptr>
+diskcheck::make_appender(const ss::sstring& fname) {
+    /// Opened as the segments of a log are
+    auto file = co_await storage::internal::make_writer_handle(
+      std::filesystem::path(fname), std::nullopt, true);
+    co_return std::make_unique<storage::segment_appender>(
+      std::move(file),
+      storage::segment_appender::options(
+        ss::default_priority_class(),
+        storage::segment_appender::write_behind_memory
+          / storage::internal::chunks().chunk_size(),
+        _opts.file_size() / _opts.partitions,
+        _resources));
+}
+
 /// Gets the next offset in the file to write. All fibers will be accessing
 /// _last_pos without explicit synchronization, within one shard. The order of
 /// what is written is not important it is just random data. Functionally this
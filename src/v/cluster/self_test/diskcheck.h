@@ -17,6 +17,8 @@
 #include "config/node_config.h"
 #include "likely.h"
 #include "seastarx.h"
+#include "storage/segment_appender.h"
+#include "storage/storage_resources.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/aligned_buffer.hh>
@@ -81,8 +83,9 @@ public:
     /// Run the actual disk benchmark
     ///
     /// Runs sequential write then read benchmarks (unless otherwise either
-    /// marked as skip in configuration options). Note that each sub-benchmark
-    /// will run for at least the total run time desired.
+    /// marked as skip in configuration options), or the appender benchmark
+    /// if that is the workload. Note that each sub-benchmark will run for at
+    /// least the total run time desired.
     ss::future<std::vector<self_test_result>> run(diskcheck_opts);
 
     /// Signal to stop all work as soon as possible
@@ -107,6 +110,26 @@ private:
     ss::future<> run_benchmark_fiber(
       ss::lowres_clock::time_point start, ss::file& file, metrics& m);
 
+    /// The appender workload: _opts.partitions segment_appenders append
+    /// batches of _opts.request_size and flush them every _opts.flush_bytes,
+    /// which is what produce does to the segments of the partitions of a
+    /// shard. The results are the latencies of the appends with the write
+    /// throughput, and the latencies of the flushes (fdatasync).
+    ss::future<std::vector<self_test_result>>
+    run_appender_benchmark(ss::sstring fname);
+
+    /// Appends to one segment until the end of the benchmark, the segment is
+    /// rolled (truncated) when it reaches its share of the data size
+    ss::future<> run_appender_fiber(
+      ss::lowres_clock::time_point stop,
+      ss::sstring fname,
+      const iobuf& batch,
+      metrics& appends,
+      metrics& flushes);
+
+    ss::future<storage::segment_appender_ptr>
+    make_appender(const ss::sstring& fname);
+
     uint64_t get_pos();
 
 private:
@@ -121,6 +144,8 @@ private:
     ss::abort_source _as;
     ss::gate _gate;
     diskcheck_opts _opts;
+    /// Budgets of the segment appenders of the appender workload
+    storage::storage_resources _resources;
 };
 
 } // namespace cluster::self_test
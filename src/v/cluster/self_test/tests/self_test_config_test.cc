@@ -9,6 +9,7 @@
 
 #define BOOST_TEST_MODULE self_test
 
+#include "cluster/self_test/cloudcheck.h"
 #include "cluster/self_test/diskcheck.h"
 #include "cluster/self_test/netcheck.h"
 #include "json/document.h"
@@ -49,6 +50,48 @@ BOOST_AUTO_TEST_CASE(test_diskcheck_validation) {
         .skip_read = false,
         .duration = 5000ms,
         .parallelism = 50}));
+
+    using cluster::diskcheck_workload;
+    BOOST_CHECK_THROW(
+      cft::diskcheck::validate_options(cluster::diskcheck_opts{
+        .skip_write = true, .workload = diskcheck_workload::appender}),
+      cft::diskcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::diskcheck::validate_options(cluster::diskcheck_opts{
+        .workload = diskcheck_workload::appender, .partitions = 0}),
+      cft::diskcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::diskcheck::validate_options(cluster::diskcheck_opts{
+        .workload = diskcheck_workload::appender, .partitions = 2000}),
+      cft::diskcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::diskcheck::validate_options(cluster::diskcheck_opts{
+        .request_size = 0, .workload = diskcheck_workload::appender}),
+      cft::diskcheck_option_out_of_range);
+
+    BOOST_CHECK_NO_THROW(
+      cft::diskcheck::validate_options(cluster::diskcheck_opts{
+        .request_size = 16384,
+        .workload = diskcheck_workload::appender,
+        .partitions = 64,
+        .flush_bytes = 1048576}));
+}
+
+BOOST_AUTO_TEST_CASE(test_diskcheck_workload_json) {
+    json::Document doc;
+    doc.Parse(R"({"workload": "appender", "partitions": 32, )"
+              R"("flush_bytes": 65536})");
+    BOOST_REQUIRE(!doc.HasParseError());
+    auto opts = cluster::diskcheck_opts::from_json(doc);
+    BOOST_CHECK_EQUAL(opts.workload, cluster::diskcheck_workload::appender);
+    BOOST_CHECK_EQUAL(opts.partitions, 32);
+    BOOST_CHECK_EQUAL(opts.flush_bytes, 65536);
+
+    doc.Parse(R"({"workload": "random"})");
+    BOOST_REQUIRE(!doc.HasParseError());
+    BOOST_CHECK_THROW(
+      cluster::diskcheck_opts::from_json(doc),
+      std::invalid_argument);
 }
 
 BOOST_AUTO_TEST_CASE(test_netcheck_validation) {
@@ -93,6 +136,53 @@ BOOST_AUTO_TEST_CASE(test_netcheck_validation) {
       .parallelism = 25}));
 }
 
+BOOST_AUTO_TEST_CASE(test_cloudcheck_validation) {
+    namespace cft = cluster::self_test;
+
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.object_sizes = {}}),
+      cft::cloudcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.object_sizes = {1024, 0}}),
+      cft::cloudcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.object_sizes = {1ULL << 30}}),
+      cft::cloudcheck_option_out_of_range);
+
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.parallelism = {}}),
+      cft::cloudcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.parallelism = {4, 0}}),
+      cft::cloudcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.parallelism = {266}}),
+      cft::cloudcheck_option_out_of_range);
+
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.duration = 100ms}),
+      cft::cloudcheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::cloudcheck::validate_options(
+        cluster::cloudcheck_opts{.request_timeout = 10min}),
+      cft::cloudcheck_option_out_of_range);
+
+    BOOST_CHECK_NO_THROW(
+      cft::cloudcheck::validate_options(cluster::cloudcheck_opts{}));
+    BOOST_CHECK_NO_THROW(
+      cft::cloudcheck::validate_options(cluster::cloudcheck_opts{
+        .object_sizes = {1, 128ULL << 20},
+        .parallelism = {1, 256},
+        .duration = 5000ms}));
+}
+
 static const std::string sample_self_test_config = R"(
 {
     "tests": [
@@ -113,6 +203,14 @@ static const std::string sample_self_test_config = R"(
             "duration_ms": 7100,
             "parallelism": 25,
             "type" : "network"
+        },
+        {
+            "name": "my cloud test",
+            "object_sizes": [1024, 1048576],
+            "parallelism": [2, 8],
+            "duration_ms": 3000,
+            "skip_list": true,
+            "type" : "cloud"
         }
     ]
 }
@@ -126,7 +224,7 @@ BOOST_AUTO_TEST_CASE(test_self_test_json_serde) {
     BOOST_TEST(doc.HasMember("tests"), "Invalid JSON");
     BOOST_TEST(doc["tests"].IsArray(), "Invalid JSON");
     const auto& arr = doc["tests"].GetArray();
-    BOOST_TEST(arr.Size() == 2, "Invalid JSON");
+    BOOST_TEST(arr.Size() == 3, "Invalid JSON");
     BOOST_TEST(arr[0].IsObject(), "Invalid JSON");
     BOOST_TEST(arr[1].IsObject(), "Invalid JSON");
 
@@ -156,6 +254,15 @@ BOOST_AUTO_TEST_CASE(test_self_test_json_serde) {
     BOOST_CHECK_EQUAL(net_opts.request_size, 54321);
     BOOST_CHECK_EQUAL(net_opts.duration, 7100ms);
     BOOST_CHECK_EQUAL(net_opts.parallelism, 25);
+
+    const auto& cloud_json_obj = arr[2].GetObject();
+    auto cloud_opts = cluster::cloudcheck_opts::from_json(cloud_json_obj);
+    BOOST_CHECK_EQUAL(cloud_opts.name, "my cloud test");
+    BOOST_CHECK(
+      cloud_opts.object_sizes == std::vector<uint64_t>({1024, 1048576}));
+    BOOST_CHECK(cloud_opts.parallelism == std::vector<uint16_t>({2, 8}));
+    BOOST_CHECK_EQUAL(cloud_opts.duration, 3000ms);
+    BOOST_CHECK_EQUAL(cloud_opts.skip_list, true);
 }
 
 BOOST_AUTO_TEST_CASE(test_self_test_network_plan) {
@@ -12,6 +12,7 @@
 
 #include "cluster/node/local_monitor.h"
 #include "rpc/connection_cache.h"
+#include "self_test/cloudcheck.h"
 #include "self_test/diskcheck.h"
 #include "self_test/netcheck.h"
 #include "self_test_rpc_types.h"
@@ -38,6 +39,7 @@ public:
       model::node_id self,
       ss::sharded<node::local_monitor>& nlm,
       ss::sharded<rpc::connection_cache>& connections,
+      ss::sharded<cloud_storage::remote>& cloud_storage_api,
       ss::scheduling_group sg);
 
     ss::future<> start();
@@ -74,7 +76,9 @@ public:
 
 private:
     ss::future<std::vector<self_test_result>> do_start_test(
-      std::vector<diskcheck_opts> dtos, std::vector<netcheck_opts> ntos);
+      std::vector<diskcheck_opts> dtos,
+      std::vector<netcheck_opts> ntos,
+      std::vector<cloudcheck_opts> ctos);
 
     struct previous_netcheck_entity {
         static const inline model::node_id unassigned{-1};
@@ -95,5 +99,6 @@ private:
     mutex _lock;
     self_test::diskcheck _disk_test;
     self_test::netcheck _network_test;
+    self_test::cloudcheck _cloud_test;
 };
 } // namespace cluster
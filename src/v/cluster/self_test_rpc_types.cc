@@ -33,6 +33,16 @@ std::ostream& operator<<(std::ostream& o, self_test_status sts) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, diskcheck_workload w) {
+    switch (w) {
+    case diskcheck_workload::sequential:
+        return o << "sequential";
+    case diskcheck_workload::appender:
+        return o << "appender";
+    }
+    return o << "unknown";
+}
+
 ss::future<cluster::netcheck_request>
 make_netcheck_request(model::node_id src, size_t sz) {
     static const size_t fragment_size = 8192;
@@ -31,9 +31,19 @@ ss::sstring self_test_status_as_string(self_test_status sts);
 
 std::ostream& operator<<(std::ostream& o, self_test_status sts);
 
+/// The I/O pattern of a disk benchmark
+enum class diskcheck_workload : int8_t {
+    /// Fixed size read and write requests at increasing offsets of one file
+    sequential = 0,
+    /// Batches appended and flushed by segment_appenders, like partitions
+    appender,
+};
+
+std::ostream& operator<<(std::ostream& o, diskcheck_workload w);
+
 struct diskcheck_opts
   : serde::
-      envelope<diskcheck_opts, serde::version<0>, serde::compat_version<0>> {
+      envelope<diskcheck_opts, serde::version<1>, serde::compat_version<0>> {
     /// Descriptive name given to test run
     ss::sstring name{"512K sequential r/w disk test"};
     /// Where files this benchmark will read/write to exist
@@ -54,6 +64,15 @@ struct diskcheck_opts
     uint16_t parallelism{10};
     /// Scheduling group that the benchmark will operate under
     ss::scheduling_group sg;
+    /// The I/O pattern
+    diskcheck_workload workload{diskcheck_workload::sequential};
+    /// Appender workload: number of segments appended to concurrently, each
+    /// as a partition would. The request_size is the size of the batches,
+    /// dsync and parallelism don't apply.
+    uint16_t partitions{16};
+    /// Appender workload: a segment is flushed once this many bytes were
+    /// appended to it since its last flush, zero flushes after every batch
+    uint64_t flush_bytes{0};
 
     /// Total size a single shard will write/read to disk
     uint64_t file_size() const { return data_size / ss::smp::count; }
@@ -88,6 +107,25 @@ struct diskcheck_opts
         if (obj.HasMember("parallelism")) {
             opts.parallelism = obj["parallelism"].GetUint();
         }
+        if (obj.HasMember("workload")) {
+            const std::string_view workload = obj["workload"].GetString();
+            if (workload == "appender") {
+                opts.workload = diskcheck_workload::appender;
+            } else if (workload == "sequential") {
+                opts.workload = diskcheck_workload::sequential;
+            } else {
+                throw std::invalid_argument(fmt::format(
+                  "Unknown disk test workload: {}, valid options are "
+                  "'sequential' or 'appender'",
+                  workload));
+            }
+        }
+        if (obj.HasMember("partitions")) {
+            opts.partitions = obj["partitions"].GetUint();
+        }
+        if (obj.HasMember("flush_bytes")) {
+            opts.flush_bytes = obj["flush_bytes"].GetUint64();
+        }
         return opts;
     }
 
@@ -100,7 +138,10 @@ struct diskcheck_opts
           data_size,
           request_size,
           duration,
-          parallelism);
+          parallelism,
+          workload,
+          partitions,
+          flush_bytes);
     }
 
     friend std::ostream&
@@ -108,7 +149,8 @@ struct diskcheck_opts
         fmt::print(
           o,
           "{{name: {} dsync: {} skip_write: {} skip_read: {} data_size: {} "
-          "request_size: {} duration: {} parallelism: {}}}",
+          "request_size: {} duration: {} parallelism: {} workload: {} "
+          "partitions: {} flush_bytes: {}}}",
           opts.name,
           opts.dsync,
           opts.skip_write,
@@ -116,7 +158,10 @@ struct diskcheck_opts
           opts.data_size,
           opts.request_size,
           opts.duration,
-          opts.parallelism);
+          opts.parallelism,
+          opts.workload,
+          opts.partitions,
+          opts.flush_bytes);
         return o;
     }
 };
@@ -182,6 +227,88 @@ struct netcheck_opts
     }
 };
 
+struct cloudcheck_opts
+  : serde::
+      envelope<cloudcheck_opts, serde::version<0>, serde::compat_version<0>> {
+    /// Descriptive name given to test run
+    ss::sstring name{"Cloud storage test"};
+    /// Sizes of the objects uploaded then downloaded, a put and a get
+    /// benchmark run for every combination of object size and parallelism
+    std::vector<uint64_t> object_sizes{64ULL << 10, 1ULL << 20, 8ULL << 20};
+    /// Numbers of concurrent requests the put and get benchmarks run with
+    std::vector<uint16_t> parallelism{1, 16};
+    /// Total duration of an individual put, get or list benchmark
+    ss::lowres_clock::duration duration{std::chrono::milliseconds(5000)};
+    /// Requests taking longer than this are counted as timeouts
+    ss::lowres_clock::duration request_timeout{std::chrono::seconds(30)};
+    /// Set to true to disable the list benchmark
+    bool skip_list{false};
+    /// Scheduling group that the benchmark will operate under
+    ss::scheduling_group sg;
+
+    static cloudcheck_opts from_json(const json::Value& obj) {
+        /// The application using these parameters will perform any validation
+        cloudcheck_opts opts;
+        if (obj.HasMember("name")) {
+            opts.name = obj["name"].GetString();
+        }
+        if (obj.HasMember("object_sizes")) {
+            opts.object_sizes.clear();
+            for (const auto& v : obj["object_sizes"].GetArray()) {
+                opts.object_sizes.push_back(v.GetUint64());
+            }
+        }
+        if (obj.HasMember("parallelism")) {
+            /// A single value or the list of values to run with
+            opts.parallelism.clear();
+            if (obj["parallelism"].IsArray()) {
+                for (const auto& v : obj["parallelism"].GetArray()) {
+                    opts.parallelism.push_back(v.GetUint());
+                }
+            } else {
+                opts.parallelism.push_back(obj["parallelism"].GetUint());
+            }
+        }
+        if (obj.HasMember("duration_ms")) {
+            opts.duration = std::chrono::milliseconds(
+              obj["duration_ms"].GetInt());
+        }
+        if (obj.HasMember("request_timeout_ms")) {
+            opts.request_timeout = std::chrono::milliseconds(
+              obj["request_timeout_ms"].GetInt());
+        }
+        if (obj.HasMember("skip_list")) {
+            opts.skip_list = obj["skip_list"].GetBool();
+        }
+        return opts;
+    }
+
+    auto serde_fields() {
+        return std::tie(
+          name,
+          object_sizes,
+          parallelism,
+          duration,
+          request_timeout,
+          skip_list);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const cloudcheck_opts& opts) {
+        fmt::print(
+          o,
+          "{{name: {} object_sizes: {} parallelism: {} duration: {} "
+          "request_timeout: {} skip_list: {}}}",
+          opts.name,
+          opts.object_sizes,
+          opts.parallelism,
+          opts.duration.count(),
+          opts.request_timeout.count(),
+          opts.skip_list);
+        return o;
+    }
+};
+
 struct self_test_result
   : serde::
       envelope<self_test_result, serde::version<0>, serde::compat_version<0>> {
@@ -237,13 +364,14 @@ struct empty_request
 struct start_test_request
   : serde::envelope<
       start_test_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
 
     uuid_t id;
     std::vector<diskcheck_opts> dtos;
     std::vector<netcheck_opts> ntos;
+    std::vector<cloudcheck_opts> ctos;
 
     friend std::ostream&
     operator<<(std::ostream& o, const start_test_request& r) {
@@ -254,6 +382,9 @@ struct start_test_request
         for (auto& v : r.ntos) {
             fmt::print(ss, "netcheck_opts: {}", v);
         }
+        for (auto& v : r.ctos) {
+            fmt::print(ss, "cloudcheck_opts: {}", v);
+        }
         fmt::print(o, "{{id: {} {}}}", r.id, ss.str());
         return o;
     }
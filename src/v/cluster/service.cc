@@ -524,13 +524,30 @@ void clear_partition_sizes(node_health_report& report) {
 
 ss::future<get_node_health_reply>
 service::do_collect_node_health_report(get_node_health_request req) {
-    auto res = co_await _hm_frontend.local().collect_node_health(
-      std::move(req.filter));
-    if (res.has_error()) {
-        co_return get_node_health_reply{
-          .error = map_health_monitor_error_code(res.error())};
+    get_node_health_reply reply;
+    if (req.filter == node_report_filter{}) {
+        // requests for all partitions are answered with a delta when the
+        // requester holds the previous report of this node
+        auto res = co_await _hm_frontend.local().collect_node_health_delta(
+          req.last_version);
+        if (res.has_error()) {
+            co_return get_node_health_reply{
+              .error = map_health_monitor_error_code(res.error())};
+        }
+        reply = std::move(res.value());
+    } else {
+        auto res = co_await _hm_frontend.local().collect_node_health(
+          std::move(req.filter));
+        if (res.has_error()) {
+            co_return get_node_health_reply{
+              .error = map_health_monitor_error_code(res.error())};
+        }
+        reply = get_node_health_reply{
+          .error = errc::success,
+          .report = std::move(res.value()),
+        };
     }
-    auto report = std::move(res.value());
+    auto& report = *reply.report;
     // clear all revision ids to prevent sending them to old versioned redpanda
     // nodes
     if (req.decoded_version > get_node_health_request::revision_id_version) {
@@ -541,10 +558,7 @@ service::do_collect_node_health_report(get_node_health_request req) {
     if (req.decoded_version > get_node_health_request::size_bytes_version) {
         clear_partition_sizes(report);
     }
-    co_return get_node_health_reply{
-      .error = errc::success,
-      .report = std::move(report),
-    };
+    co_return reply;
 }
 
 ss::future<get_cluster_health_reply>
@@ -30,6 +30,18 @@ PERF_TEST_F(partition_allocator_fixture, allocation_3) {
         perf_tests::stop_measuring_time();
     });
 }
+PERF_TEST_F(partition_allocator_fixture, allocation_1000_on_100_nodes) {
+    for (int i = 0; i < 100; ++i) {
+        register_node(i, 8);
+    }
+    auto req = make_allocation_request(1000, 3);
+
+    perf_tests::start_measuring_time();
+    return allocator.allocate(std::move(req)).then([](auto vals) {
+        perf_tests::do_not_optimize(vals);
+        perf_tests::stop_measuring_time();
+    });
+}
 PERF_TEST_F(partition_allocator_fixture, deallocation_3) {
     register_node(0, 24);
     register_node(1, 24);
@@ -9,6 +9,7 @@
 
 #include "cluster/health_monitor_frontend.h"
 #include "cluster/health_monitor_types.h"
+#include "cluster/health_report_delta.h"
 #include "cluster/metadata_cache.h"
 #include "cluster/node/types.h"
 #include "cluster/shard_table.h"
@@ -587,3 +588,61 @@ FIXTURE_TEST(test_report_truncation, health_report_unit) {
     test_unhealthy(max_count + 1, LEADERLESS);
     test_unhealthy(max_count + 1, URP);
 }
+
+FIXTURE_TEST(test_report_delta, health_report_unit) {
+    auto to_fifo = [](std::vector<topic_status> topics) {
+        ss::chunked_fifo<topic_status> ret;
+        std::move(topics.begin(), topics.end(), std::back_inserter(ret));
+        return ret;
+    };
+
+    auto previous = to_fifo(
+      {make_ts("topic_a", {HEALTHY, HEALTHY, HEALTHY}),
+       make_ts("topic_b", {HEALTHY, URP})});
+
+    // partition 1 became leaderless, partition 2 was removed and partition 3
+    // added
+    auto topic_a = make_ts("topic_a", {HEALTHY, LEADERLESS, HEALTHY, HEALTHY});
+    ss::chunked_fifo<partition_status> topic_a_partitions;
+    for (auto& p : topic_a.partitions) {
+        if (p.id != partition_id{2}) {
+            topic_a_partitions.push_back(p);
+        }
+    }
+    topic_a.partitions = std::move(topic_a_partitions);
+    // topic_b was deleted and topic_c created
+    auto current = to_fifo({topic_a, make_ts("topic_c", {HEALTHY})});
+
+    auto previous_index = cluster::index_partition_statuses(previous).get();
+    auto current_index = cluster::index_partition_statuses(current).get();
+    auto delta = cluster::diff_partition_statuses(
+                   current, current_index, previous_index)
+                   .get();
+
+    BOOST_REQUIRE_EQUAL(delta.changed.size(), 2);
+    const auto& changed_a = delta.changed.front();
+    BOOST_REQUIRE_EQUAL(changed_a.tp_ns.tp, topic{"topic_a"});
+    BOOST_REQUIRE_EQUAL(changed_a.partitions.size(), 2);
+    BOOST_REQUIRE_EQUAL(changed_a.partitions.front().id, partition_id{1});
+    BOOST_REQUIRE_EQUAL(changed_a.partitions.back().id, partition_id{3});
+    BOOST_REQUIRE_EQUAL(delta.changed.back().tp_ns.tp, topic{"topic_c"});
+
+    size_t removed = 0;
+    for (const auto& r : delta.removed) {
+        removed += r.partitions.size();
+    }
+    BOOST_REQUIRE_EQUAL(removed, 3);
+
+    auto merged = cluster::apply_partition_statuses_delta(
+                    previous, std::move(delta.changed), delta.removed)
+                    .get();
+    BOOST_REQUIRE(std::equal(
+      merged.begin(), merged.end(), current.begin(), current.end()));
+
+    // nothing changed
+    auto empty = cluster::diff_partition_statuses(
+                   current, current_index, current_index)
+                   .get();
+    BOOST_REQUIRE(empty.changed.empty());
+    BOOST_REQUIRE(empty.removed.empty());
+}
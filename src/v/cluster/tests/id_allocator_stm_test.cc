@@ -39,9 +39,9 @@ using namespace std::chrono_literals;
 ss::logger idstmlog{"idstm-test"};
 
 struct id_allocator_stm_fixture : simple_raft_fixture {
-    void create_stm_and_start_raft() {
+    void create_stm_and_start_raft(int16_t batch_size = 1) {
         // set configuration parameters
-        test_local_cfg.get("id_allocator_batch_size").set_value(int16_t(1));
+        test_local_cfg.get("id_allocator_batch_size").set_value(batch_size);
         test_local_cfg.get("id_allocator_log_capacity").set_value(int16_t(2));
         create_raft();
         raft::state_machine_manager_builder stm_m_builder;
@@ -131,3 +131,30 @@ FIXTURE_TEST(stm_reset_batch_test, id_allocator_stm_fixture) {
     last_id = allocate_n(last_id, 1);
     BOOST_REQUIRE_EQUAL(last_id, 102);
 }
+
+FIXTURE_TEST(stm_allocate_ids_test, id_allocator_stm_fixture) {
+    create_stm_and_start_raft(10);
+    wait_for_confirmed_leader();
+    auto last_id = allocate_n(-1, 1);
+
+    // A block is cut from the current batch...
+    auto result = _stm->allocate_ids(4, 1s).get();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, result.raft_status);
+    BOOST_REQUIRE_EQUAL(result.id, last_id + 1);
+    BOOST_REQUIRE_EQUAL(result.count, 4);
+    last_id = result.id + result.count - 1;
+
+    // ...and is smaller if the batch has fewer ids left.
+    result = _stm->allocate_ids(10, 1s).get();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, result.raft_status);
+    BOOST_REQUIRE_EQUAL(result.id, last_id + 1);
+    BOOST_REQUIRE_EQUAL(result.count, 5);
+    last_id = result.id + result.count - 1;
+
+    // The ids of a block are never handed out again.
+    result = _stm->allocate_ids(10, 1s).get();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, result.raft_status);
+    BOOST_REQUIRE_GT(result.id, last_id);
+    BOOST_REQUIRE_EQUAL(result.count, 10);
+    allocate_n(result.id + result.count - 1, 5);
+}
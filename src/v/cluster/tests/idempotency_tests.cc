@@ -407,3 +407,71 @@ FIXTURE_TEST(test_rm_stm_passes_immediate_retry, rm_stm_test_fixture) {
     BOOST_REQUIRE((bool)r2);
     BOOST_REQUIRE_EQUAL(r1.value().last_offset, r2.value().last_offset);
 }
+
+FIXTURE_TEST(test_rm_stm_pipelined_idempotent_requests, rm_stm_test_fixture) {
+    create_stm_and_start_raft();
+    auto& stm = *_stm;
+    stm.testing_only_disable_auto_abort();
+
+    stm.start().get0();
+
+    wait_for_confirmed_leader();
+    wait_for_meta_initialized();
+
+    // the first request takes the fast path, the others are queued behind it
+    // for the lock of the producer
+    const int32_t count = 5;
+    const int32_t requests = 4;
+    std::vector<ss::future<result<cluster::kafka_result>>> results;
+    for (int32_t i = 0; i < requests; ++i) {
+        auto rdr = random_batch_reader(model::test::record_batch_spec{
+          .offset = model::offset(i * count),
+          .allow_compression = true,
+          .count = count,
+          .enable_idempotence = true,
+          .producer_id = 1,
+          .producer_epoch = 0,
+          .base_sequence = i * count});
+        auto bid = model::batch_identity{
+          .pid = model::producer_identity{1, 0},
+          .first_seq = i * count,
+          .last_seq = i * count + count - 1};
+        results.push_back(stm.replicate(
+          bid,
+          std::move(rdr),
+          raft::replicate_options(raft::consistency_level::quorum_ack)));
+    }
+
+    std::optional<kafka::offset> last;
+    for (auto& f : results) {
+        auto r = f.get();
+        BOOST_REQUIRE((bool)r);
+        if (last) {
+            BOOST_REQUIRE_EQUAL(
+              r.value().last_offset, kafka::offset{(*last)() + count});
+        }
+        last = r.value().last_offset;
+    }
+
+    // a sequence gap is still rejected on the fast path
+    auto rdr = random_batch_reader(model::test::record_batch_spec{
+      .offset = model::offset(requests * count),
+      .allow_compression = true,
+      .count = count,
+      .enable_idempotence = true,
+      .producer_id = 1,
+      .producer_epoch = 0,
+      .base_sequence = (requests + 1) * count});
+    auto bid = model::batch_identity{
+      .pid = model::producer_identity{1, 0},
+      .first_seq = (requests + 1) * count,
+      .last_seq = (requests + 1) * count + count - 1};
+    auto r = stm
+               .replicate(
+                 bid,
+                 std::move(rdr),
+                 raft::replicate_options(raft::consistency_level::quorum_ack))
+               .get0();
+    BOOST_REQUIRE(
+      r == failure_type<cluster::errc>(cluster::errc::sequence_out_of_order));
+}
@@ -150,7 +150,8 @@ struct partition_balancer_planner_fixture {
     cluster::partition_balancer_planner make_planner(
       model::partition_autobalancing_mode mode
       = model::partition_autobalancing_mode::continuous,
-      size_t max_concurrent_actions = 2) {
+      size_t max_concurrent_actions = 2,
+      size_t max_concurrent_moves_per_node = 0) {
         return cluster::partition_balancer_planner(
           cluster::planner_config{
             .mode = mode,
@@ -159,7 +160,8 @@ struct partition_balancer_planner_fixture {
             .max_concurrent_actions = max_concurrent_actions,
             .node_availability_timeout_sec = std::chrono::minutes(1),
             .segment_fallocation_step = 16,
-            .node_responsiveness_timeout = std::chrono::seconds(10)},
+            .node_responsiveness_timeout = std::chrono::seconds(10),
+            .max_concurrent_moves_per_node = max_concurrent_moves_per_node},
           workers.state.local(),
           workers.allocator.local());
     }
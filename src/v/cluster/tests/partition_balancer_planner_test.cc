@@ -12,6 +12,8 @@
 
 #include <seastar/testing/thread_test_case.hh>
 
+#include <map>
+
 static ss::logger logger("partition_balancer_planner");
 
 // a shorthand to avoid spelling out model::node_id
@@ -816,6 +818,50 @@ FIXTURE_TEST(
     BOOST_REQUIRE_EQUAL(plan_data.failed_actions_count, 0);
 }
 
+/*
+ * 6 nodes; 1 topic; 20 partitions; 1 decommissioning node
+ * At most 2 moves can be in progress towards a node, so the moves away from
+ * the decommissioning node are spread across the empty nodes.
+ *   node_0: partitions: 20; decommissioning: True
+ *   node_1: partitions: 20;
+ *   node_2: partitions: 20;
+ *   node_3: partitions: 0;
+ *   node_4: partitions: 0;
+ *   node_5: partitions: 0;
+ */
+FIXTURE_TEST(
+  test_decommission_moves_per_node_limit, partition_balancer_planner_fixture) {
+    allocator_register_nodes(3);
+    create_topic("topic-1", 20, 3);
+    allocator_register_nodes(3);
+
+    auto hr = create_health_report();
+    populate_node_status_table().get();
+
+    set_decommissioning(model::node_id{0});
+
+    auto planner = make_planner(
+      model::partition_autobalancing_mode::continuous, 20, 2);
+    auto plan_data = planner.plan_actions(hr, as).get();
+
+    BOOST_REQUIRE_EQUAL(plan_data.reassignments.size(), 6);
+    std::map<model::node_id, size_t> moves_to;
+    for (const auto& reassignment : plan_data.reassignments) {
+        for (const auto& r : reassignment.allocated.replicas()) {
+            BOOST_REQUIRE_NE(r.node_id, model::node_id{0});
+            if (r.node_id() >= 3) {
+                ++moves_to[r.node_id];
+            }
+        }
+    }
+    BOOST_REQUIRE_EQUAL(moves_to.size(), 3);
+    for (const auto& [_, count] : moves_to) {
+        BOOST_REQUIRE_EQUAL(count, 2);
+    }
+    // the partitions left are waiting for the moves to finish
+    BOOST_REQUIRE(plan_data.decommission_realloc_failures.empty());
+}
+
 FIXTURE_TEST(
   test_state_ntps_with_broken_rack_constraint,
   partition_balancer_planner_fixture) {
@@ -0,0 +1,73 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/partition_leaders_table.h"
+#include "cluster/topic_table.h"
+#include "model/namespace.h"
+#include "random/generators.h"
+
+#include <seastar/core/sharded.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <algorithm>
+
+/**
+ * Looks up the leaders of all the partitions of a large cluster in a random
+ * order, similarly to the lookups performed by the produce, fetch and
+ * metadata handlers.
+ */
+ss::future<> run_test(size_t topics, size_t partitions_per_topic) {
+    ss::sharded<cluster::topic_table> topic_table;
+    co_await topic_table.start();
+    cluster::partition_leaders_table leaders(topic_table);
+
+    std::vector<model::ntp> ntps;
+    ntps.reserve(topics * partitions_per_topic);
+    for (size_t t = 0; t < topics; ++t) {
+        model::topic topic(fmt::format("topic-with-a-realistic-name-{}", t));
+        for (size_t p = 0; p < partitions_per_topic; ++p) {
+            auto& ntp = ntps.emplace_back(
+              model::kafka_namespace,
+              topic,
+              model::partition_id(static_cast<int32_t>(p)));
+            leaders.update_partition_leader(
+              ntp,
+              model::revision_id(1),
+              model::term_id(1),
+              model::node_id(static_cast<int32_t>(p % 5)));
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    std::shuffle(ntps.begin(), ntps.end(), random_generators::internal::gen);
+
+    int64_t found = 0;
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < ntps.size(); ++i) {
+        auto lt = leaders.get_leader_term(
+          model::topic_namespace_view(ntps[i]), ntps[i].tp.partition);
+        found += lt.has_value();
+        if (i % 10'000 == 0) {
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(found);
+
+    co_await leaders.stop();
+    co_await topic_table.stop();
+}
+
+struct partition_leaders_table_bench {};
+PERF_TEST_C(partition_leaders_table_bench, lookup_20k_partitions) {
+    co_return co_await run_test(200, 100);
+}
+PERF_TEST_C(partition_leaders_table_bench, lookup_200k_partitions) {
+    co_return co_await run_test(2'000, 100);
+}
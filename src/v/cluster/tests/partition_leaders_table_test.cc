@@ -0,0 +1,94 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/partition_leaders_table.h"
+#include "cluster/topic_table.h"
+#include "model/namespace.h"
+
+#include <seastar/core/sharded.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+namespace {
+model::ntp make_ntp(ss::sstring topic, int32_t p) {
+    return {
+      model::kafka_namespace,
+      model::topic(std::move(topic)),
+      model::partition_id(p)};
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_leaders_table_sparse_partitions) {
+    ss::sharded<cluster::topic_table> topics;
+    topics.start().get();
+    cluster::partition_leaders_table leaders(topics);
+
+    const model::revision_id rev(10);
+    leaders.update_partition_leader(
+      make_ntp("a", 5), rev, model::term_id(1), model::node_id(1));
+    leaders.update_partition_leader(
+      make_ntp("a", 1), rev, model::term_id(1), model::node_id(2));
+    leaders.update_partition_leader(
+      make_ntp("b", 0), rev, model::term_id(1), std::nullopt);
+
+    BOOST_REQUIRE_EQUAL(leaders.get_leaders().size(), 3);
+    BOOST_REQUIRE(leaders.get_leader(make_ntp("a", 5)) == model::node_id(1));
+    BOOST_REQUIRE(leaders.get_leader(make_ntp("a", 1)) == model::node_id(2));
+    BOOST_REQUIRE(!leaders.get_leader(make_ntp("a", 0)).has_value());
+    BOOST_REQUIRE(!leaders.get_leader(make_ntp("a", 6)).has_value());
+    BOOST_REQUIRE(!leaders.get_leader(make_ntp("b", 0)).has_value());
+    BOOST_REQUIRE(leaders.get_leader_term(make_ntp("b", 0)).has_value());
+
+    // leadership change keeps track of the previous leader
+    leaders.update_partition_leader(
+      make_ntp("a", 5), rev, model::term_id(2), model::node_id(3));
+    BOOST_REQUIRE(leaders.get_leader(make_ntp("a", 5)) == model::node_id(3));
+    BOOST_REQUIRE(
+      leaders.get_previous_leader(
+        model::topic_namespace_view(make_ntp("a", 5)), model::partition_id(5))
+      == model::node_id(1));
+
+    // updates from older terms and revisions are ignored
+    leaders.update_partition_leader(
+      make_ntp("a", 5), rev, model::term_id(1), model::node_id(4));
+    leaders.update_partition_leader(
+      make_ntp("a", 5), model::revision_id(9), model::term_id(3), std::nullopt);
+    BOOST_REQUIRE(leaders.get_leader(make_ntp("a", 5)) == model::node_id(3));
+
+    // removals with an older revision are ignored
+    leaders.remove_leader(make_ntp("a", 5), model::revision_id(9));
+    BOOST_REQUIRE_EQUAL(leaders.get_leaders().size(), 3);
+
+    leaders.remove_leader(make_ntp("a", 5), rev);
+    leaders.remove_leader(make_ntp("b", 0), rev);
+    BOOST_REQUIRE_EQUAL(leaders.get_leaders().size(), 1);
+    BOOST_REQUIRE(!leaders.get_leader(make_ntp("a", 5)).has_value());
+    BOOST_REQUIRE(leaders.get_leader(make_ntp("a", 1)) == model::node_id(2));
+
+    size_t visited = 0;
+    leaders.for_each_leader(
+      [&visited](
+        model::topic_namespace_view tp_ns,
+        model::partition_id pid,
+        std::optional<model::node_id> leader,
+        model::term_id) {
+          BOOST_REQUIRE_EQUAL(tp_ns.tp, model::topic("a"));
+          BOOST_REQUIRE_EQUAL(pid, model::partition_id(1));
+          BOOST_REQUIRE(leader == model::node_id(2));
+          ++visited;
+      });
+    BOOST_REQUIRE_EQUAL(visited, 1);
+
+    leaders.reset();
+    BOOST_REQUIRE(leaders.get_leaders().empty());
+
+    leaders.stop().get();
+    topics.stop().get();
+}
@@ -0,0 +1,129 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/producer_state.h"
+#include "cluster/producer_state_manager.h"
+#include "config/configuration.h"
+#include "config/property.h"
+#include "vassert.h"
+
+#include <seastar/coroutine/maybe_yield.hh>
+#include <seastar/testing/perf_tests.hh>
+
+using namespace std::chrono_literals;
+
+/**
+ * Simulates the idempotent produce path of many producers on a single shard:
+ * every producer appends a window of batches and then retries one of them,
+ * which is answered from the cached finished requests.
+ */
+ss::future<> run_test(size_t num_producers) {
+    config::shard_local_cfg().disable_metrics.set_value(true);
+    cluster::producer_state_manager mgr(
+      config::mock_binding<uint64_t>(num_producers), 10min);
+    co_await mgr.start();
+
+    constexpr int32_t batches_per_producer = 5;
+    int64_t seq = 0;
+    std::vector<cluster::producer_ptr> producers;
+    producers.reserve(num_producers);
+
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < num_producers; ++i) {
+        model::producer_identity pid{static_cast<int64_t>(i), 0};
+        producers.push_back(ss::make_lw_shared<cluster::producer_state>(
+          mgr, pid, raft::group_id{static_cast<int64_t>(i % 1000)}, [] {}));
+        auto& producer = producers.back();
+        for (int32_t b = 0; b < batches_per_producer; ++b) {
+            model::batch_identity bid{
+              .pid = pid,
+              .first_seq = b * 10,
+              .last_seq = b * 10 + 9,
+            };
+            auto req = producer->try_emplace_request(bid, model::term_id{1});
+            vassert(req.has_value(), "unexpected sequence error");
+            producer->update(bid, kafka::offset{b});
+        }
+        model::batch_identity retry{
+          .pid = pid, .first_seq = 0, .last_seq = 9};
+        auto req = producer->try_emplace_request(retry, model::term_id{1});
+        vassert(req.has_value(), "retried request not found");
+        seq += producer->last_sequence_number().value_or(0);
+        if (i % 1000 == 0) {
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(seq);
+
+    for (auto& producer : producers) {
+        co_await producer->shutdown_input();
+    }
+    producers.clear();
+    co_await mgr.stop();
+}
+
+/**
+ * Cost of entering the op scope of a producer for every request, through the
+ * queue of run_with_lock or through the try_lock fast path of the idempotent
+ * produce.
+ */
+ss::future<> run_lock_test(bool fast_path) {
+    config::shard_local_cfg().disable_metrics.set_value(true);
+    cluster::producer_state_manager mgr(
+      config::mock_binding<uint64_t>(1), 10min);
+    co_await mgr.start();
+    auto producer = ss::make_lw_shared<cluster::producer_state>(
+      mgr, model::producer_identity{1, 0}, raft::group_id{1}, [] {});
+
+    constexpr size_t requests = 100'000;
+    int32_t seq = 0;
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < requests; ++i) {
+        model::batch_identity bid{
+          .pid = model::producer_identity{1, 0},
+          .first_seq = seq,
+          .last_seq = seq + 9};
+        seq += 10;
+        auto emplace = [&] {
+            auto req = producer->try_emplace_request(bid, model::term_id{1});
+            vassert(req.has_value(), "unexpected sequence error");
+            producer->update(bid, kafka::offset{static_cast<int64_t>(i)});
+        };
+        if (fast_path) {
+            auto scope = producer->try_lock();
+            vassert(scope.has_value(), "unexpected lock contention");
+            emplace();
+        } else {
+            co_await producer->run_with_lock([&](auto) { emplace(); });
+        }
+        if (i % 1000 == 0) {
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+    perf_tests::stop_measuring_time();
+
+    co_await producer->shutdown_input();
+    producer = nullptr;
+    co_await mgr.stop();
+}
+
+struct producer_state_bench {};
+PERF_TEST_C(producer_state_bench, idempotent_produce_10k) {
+    co_return co_await run_test(10'000);
+}
+PERF_TEST_C(producer_state_bench, idempotent_produce_1m) {
+    co_return co_await run_test(1'000'000);
+}
+PERF_TEST_C(producer_state_bench, idempotent_request_run_with_lock) {
+    co_return co_await run_lock_test(false);
+}
+PERF_TEST_C(producer_state_bench, idempotent_request_try_lock) {
+    co_return co_await run_lock_test(true);
+}
@@ -138,6 +138,44 @@ FIXTURE_TEST(test_lru_maintenance, test_fixture) {
     check_producers(0);
 }
 
+FIXTURE_TEST(test_try_lock, test_fixture) {
+    std::vector<cluster::producer_ptr> producers;
+    producers.push_back(new_producer());
+    producers.push_back(new_producer());
+    auto producer = producers[0];
+    check_producers(2);
+
+    {
+        // the producer is unlinked while the scope lives, even after the
+        // units are returned
+        auto scope = producer->try_lock();
+        BOOST_REQUIRE(scope.has_value());
+        check_producers(2, 1);
+        BOOST_REQUIRE(!producer->try_lock().has_value());
+        scope->units.return_all();
+        check_producers(2, 1);
+    }
+    check_producers(2);
+    check_last_producer(*producer);
+
+    // try_lock doesn't jump over the operations waiting for the lock
+    ss::promise<> wait;
+    auto held = producer->try_lock();
+    BOOST_REQUIRE(held.has_value());
+    auto f = producer->run_with_lock(
+      [&](auto units) { return wait.get_future(); });
+    held.reset();
+    BOOST_REQUIRE(!producer->try_lock().has_value());
+    wait.set_value();
+    f.get();
+    BOOST_REQUIRE(producer->try_lock().has_value());
+
+    producers.erase(producers.begin());
+    producer->shutdown_input().get();
+    BOOST_REQUIRE(!producer->try_lock().has_value());
+    clean(producers);
+}
+
 FIXTURE_TEST(test_eviction_max_pids, test_fixture) {
     int evicted_so_far = 0;
     std::vector<cluster::producer_ptr> producers;
@@ -197,3 +235,45 @@ FIXTURE_TEST(test_eviction_expired_pids, test_fixture) {
       10s, [&] { return evicted_so_far == total_producers; });
     clean(producers);
 }
+
+FIXTURE_TEST(test_cached_finished_requests, test_fixture) {
+    auto producer = new_producer();
+    auto make_bid = [](int32_t i) {
+        return model::batch_identity{
+          .first_seq = i * 10, .last_seq = i * 10 + 9};
+    };
+    const int32_t num_requests = 8;
+    for (int32_t i = 0; i < num_requests; i++) {
+        auto bid = make_bid(i);
+        auto req = producer->try_emplace_request(bid, model::term_id{1});
+        BOOST_REQUIRE(req.has_value());
+        producer->update(bid, kafka::offset{i});
+    }
+    BOOST_REQUIRE_EQUAL(
+      producer->last_sequence_number().value(), num_requests * 10 - 1);
+
+    // the most recent requests are answered from the cache with their offset
+    for (int32_t i = num_requests - 5; i < num_requests; i++) {
+        auto req = producer->try_emplace_request(
+          make_bid(i), model::term_id{2});
+        BOOST_REQUIRE(req.has_value());
+        BOOST_REQUIRE(
+          req.value()->state() == cluster::request_state::completed);
+        auto res = req.value()->result().get();
+        BOOST_REQUIRE(res.has_value());
+        BOOST_REQUIRE_EQUAL(res.value().last_offset, kafka::offset{i});
+    }
+
+    // older requests are no longer cached
+    auto req = producer->try_emplace_request(make_bid(0), model::term_id{2});
+    BOOST_REQUIRE(req.has_error());
+    BOOST_REQUIRE(req.error() == cluster::errc::sequence_out_of_order);
+
+    auto snapshot = producer->snapshot(kafka::offset{0});
+    BOOST_REQUIRE_EQUAL(snapshot._finished_requests.size(), 5);
+    BOOST_REQUIRE_EQUAL(
+      snapshot._finished_requests.front()._last_offset,
+      kafka::offset{num_requests - 5});
+
+    producer->shutdown_input().get();
+}
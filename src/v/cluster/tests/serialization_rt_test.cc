@@ -7,6 +7,8 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "bytes/bytes.h"
+#include "bytes/iostream.h"
 #include "cluster/commands.h"
 #include "cluster/controller_snapshot.h"
 #include "cluster/health_monitor_types.h"
@@ -1026,6 +1028,20 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         cluster::commit_tx_reply data{random_tx_errc()};
         roundtrip_test(data);
     }
+    {
+        cluster::commit_txs_request data{
+          tests::random_vector([] { return model::random_ntp(); }),
+          random_producer_identity(),
+          tests::random_named_int<model::tx_seq>(),
+          random_timeout_clock_duration()};
+
+        roundtrip_test(data);
+    }
+    {
+        cluster::commit_txs_reply data{tests::random_vector(
+          [] { return cluster::commit_tx_reply{random_tx_errc()}; })};
+        roundtrip_test(data);
+    }
     {
         cluster::abort_tx_request data{
           model::random_ntp(),
@@ -2336,3 +2352,45 @@ SEASTAR_THREAD_TEST_CASE(commands_serialization_test) {
             cluster::force_abort_update(tests::random_bool())));
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(controller_snapshot_streamed_read) {
+    auto make_snapshot = [] {
+        cluster::controller_snapshot snap;
+        snap.bootstrap.cluster_uuid = model::cluster_uuid{uuid_t::create()};
+        snap.config.version = cluster::config_version{42};
+        snap.config.values["log_segment_size"] = "1048576";
+        snap.topics.highest_group_id = raft::group_id{1000};
+        for (int t = 0; t < 10; ++t) {
+            auto& topic = snap.topics.topics[model::topic_namespace(
+              model::kafka_namespace, model::topic(fmt::format("t-{}", t)))];
+            for (int p = 0; p < 100; ++p) {
+                auto& partition = topic.partitions[model::partition_id(p)];
+                partition.group = raft::group_id(t * 100 + p);
+                partition.replicas = {
+                  model::broker_shard{model::node_id(p % 3), 0}};
+            }
+        }
+        return snap;
+    };
+
+    iobuf buf;
+    serde::write_async(buf, make_snapshot()).get();
+    auto const size = buf.size_bytes();
+
+    auto in = make_iobuf_input_stream(buf.copy());
+    auto streamed
+      = cluster::controller_snapshot::read_streamed(in, size).get();
+    iobuf_parser parser(buf.copy());
+    auto expected
+      = serde::read_async<cluster::controller_snapshot>(parser).get();
+    BOOST_REQUIRE(streamed == expected);
+    BOOST_REQUIRE_EQUAL(streamed.topics.topics.size(), 10);
+
+    // the stored checksum follows version, compat_version and size
+    auto corrupted = iobuf_to_bytes(buf);
+    corrupted[6] ^= 0xff;
+    auto corrupted_in = make_iobuf_input_stream(bytes_to_iobuf(corrupted));
+    BOOST_REQUIRE_THROW(
+      cluster::controller_snapshot::read_streamed(corrupted_in, size).get(),
+      serde::serde_exception);
+}
@@ -198,3 +198,44 @@ FIXTURE_TEST(test_tm_stm_re_tx, tm_stm_test_fixture) {
     BOOST_REQUIRE_EQUAL(tx7.status, tx_status::ready);
     BOOST_REQUIRE_EQUAL(tx7.partitions.size(), 0);
 }
+
+FIXTURE_TEST(test_tm_stm_cache_log_overwrites_past_terms, tm_cache_struct) {
+    auto& c = *cache;
+    std::vector<kafka::transactional_id> ids;
+    for (int i = 0; i < 100; ++i) {
+        ids.emplace_back(fmt::format("tx-{}", i));
+        tm_transaction tx;
+        tx.id = ids.back();
+        tx.pid = model::producer_identity{i, 0};
+        tx.etag = model::term_id(1);
+        tx.status = tx_status::ongoing;
+        tx.partitions.push_back(tm_transaction::tx_partition{
+          .ntp = model::ntp("kafka", "topic", i), .etag = model::term_id(1)});
+        c.set_mem(tx.etag, tx.id, tx);
+    }
+
+    // the log catches up with the in memory state in a later term
+    for (const auto& id : ids) {
+        auto tx = c.find_mem(id);
+        BOOST_REQUIRE(tx.has_value());
+        tx->etag = model::term_id(2);
+        tx->status = tx_status::ready;
+        tx->partitions.clear();
+        c.set_log(*tx);
+    }
+    BOOST_REQUIRE_EQUAL(c.tx_cache_size(), ids.size());
+
+    for (const auto& id : ids) {
+        BOOST_REQUIRE(!c.find_mem(id).has_value());
+    }
+    for (const auto& id : ids) {
+        // the past term entry is kept but no longer holds the tx
+        BOOST_REQUIRE(!c.find(model::term_id(1), id).has_value());
+        auto tx = c.find_log(id);
+        BOOST_REQUIRE(tx.has_value());
+        BOOST_REQUIRE_EQUAL(tx->id, id);
+        BOOST_REQUIRE_EQUAL(tx->etag, model::term_id(2));
+        BOOST_REQUIRE_EQUAL(tx->status, tx_status::ready);
+    }
+    BOOST_REQUIRE_EQUAL(c.oldest_tx()->id, ids.front());
+}
@@ -136,10 +136,9 @@ void tm_stm_cache::set_log(tm_transaction tx) {
       tx.pid,
       tx.tx_seq);
 
-    auto [tx_it, inserted] = _log_txes.try_emplace(tx.id, tx);
-    if (!inserted) {
-        tx_it->second.tx = tx;
-    }
+    const auto etag = tx.etag;
+    auto [tx_it, inserted] = _log_txes.try_emplace(tx.id);
+    tx_it->second.tx = std::move(tx);
 
     if (tx_it->second._hook.is_linked()) {
         tx_it->second._hook.unlink();
@@ -147,12 +146,21 @@ void tm_stm_cache::set_log(tm_transaction tx) {
     lru_txes.push_back(tx_it->second);
 
     for (auto& [term, entry] : _state) {
-        if (term < tx.etag) {
-            entry.txes.erase(tx.id);
+        if (term < etag) {
+            erase_from_entry(entry, tx_it->first);
         }
     }
 }
 
+void tm_stm_cache::erase_from_entry(
+  tm_stm_cache_entry& entry, const kafka::transactional_id& tx_id) {
+    if (entry.txes.erase(tx_id) > 0 && entry.txes.empty()) {
+        // the table of an entry doesn't shrink on its own; release it as
+        // the entries of past terms are kept for the lifetime of the stm
+        entry.txes.rehash(0);
+    }
+}
+
 void tm_stm_cache::erase_log(kafka::transactional_id tx_id) {
     auto tx_it = _log_txes.find(tx_id);
     if (tx_it == _log_txes.end()) {
@@ -223,7 +231,7 @@ void tm_stm_cache::erase_mem(kafka::transactional_id tx_id) {
     if (tx_it == entry_it->second.txes.end()) {
         return;
     }
-    auto tx = tx_it->second;
+    const auto& tx = tx_it->second;
     vlog(
       txlog.trace,
       "[tx_id={}] erasing tx with etag: {} pid: {} tx_seq: {} from mem",
@@ -231,7 +239,7 @@ void tm_stm_cache::erase_mem(kafka::transactional_id tx_id) {
       tx.etag,
       tx.pid,
       tx.tx_seq);
-    entry_it->second.txes.erase(tx_id);
+    erase_from_entry(entry_it->second, tx_id);
 }
 
 fragmented_vector<tm_transaction> tm_stm_cache::get_all_transactions() {
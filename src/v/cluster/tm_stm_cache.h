@@ -254,6 +254,8 @@ private:
         intrusive_list_hook _hook;
     };
 
+    void erase_from_entry(tm_stm_cache_entry&, const kafka::transactional_id&);
+
     // Tracks the LRU order of tx sessions. When the count exceeds
     // max_transactions_per_coordinator, we abort tx sessions in the
     // LRU order.
@@ -17,6 +17,7 @@
 #include "cluster/topic_recovery_status_frontend.h"
 #include "cluster/topics_frontend.h"
 
+#include <seastar/core/loop.hh>
 #include <seastar/http/request.hh>
 #include <seastar/util/defer.hh>
 
@@ -25,6 +26,7 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/outcome/try.hpp>
+#include <boost/range/irange.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
@@ -435,8 +437,8 @@ topic_recovery_service::filter_existing_topics(
         topic_index[topic.ns].insert(topic.tp);
     }
 
-    std::vector<topic_manifest> manifests;
-    manifests.reserve(items.size());
+    std::vector<ss::sstring> paths;
+    paths.reserve(items.size());
 
     std::optional<std::regex> requested_pattern = std::nullopt;
     if (request.topic_names_pattern().has_value()) {
@@ -480,9 +482,28 @@ topic_recovery_service::filter_existing_topics(
             continue;
         }
 
-        if (auto download_r = co_await download_manifest(path);
-            download_r.has_value()) {
-            manifests.push_back(std::move(download_r.value()));
+        paths.push_back(path);
+    }
+
+    // The manifests are small, the time to download them is dominated by the
+    // round trips, so several are downloaded at once. The results are kept in
+    // the order of the listing.
+    std::vector<std::optional<topic_manifest>> downloaded(paths.size());
+    co_await ss::max_concurrent_for_each(
+      boost::irange(paths.size()),
+      config::shard_local_cfg().cloud_storage_recovery_manifest_concurrency(),
+      [this, &paths, &downloaded](size_t i) -> ss::future<> {
+          if (auto download_r = co_await download_manifest(paths[i]);
+              download_r.has_value()) {
+              downloaded[i].emplace(std::move(download_r.value()));
+          }
+      });
+
+    std::vector<topic_manifest> manifests;
+    manifests.reserve(downloaded.size());
+    for (auto& m : downloaded) {
+        if (m.has_value()) {
+            manifests.push_back(std::move(m.value()));
         }
     }
     co_return manifests;
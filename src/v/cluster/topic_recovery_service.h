@@ -119,7 +119,8 @@ private:
 
     /// \brief Returns a list of manifests for topics to create, filtering
     /// against existing topics in cluster. The manifests are downloaded from
-    /// the bucket, and the downloads which fail are skipped from the recovery
+    /// the bucket, up to cloud_storage_recovery_manifest_concurrency at a
+    /// time, and the downloads which fail are skipped from the recovery
     /// process.
     ss::future<std::vector<cloud_storage::topic_manifest>>
     filter_existing_topics(
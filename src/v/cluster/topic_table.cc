@@ -52,13 +52,11 @@ topic_table::apply(create_topic_cmd cmd, model::offset offset) {
     _last_applied_revision_id = model::revision_id(offset);
     if (_topics.contains(cmd.key)) {
         // topic already exists
-        return ss::make_ready_future<std::error_code>(
-          errc::topic_already_exists);
+        co_return errc::topic_already_exists;
     }
 
     if (!schema_id_validation_validator::is_valid(cmd.value.cfg.properties)) {
-        return ss::make_ready_future<std::error_code>(
-          schema_id_validation_validator::ec);
+        co_return schema_id_validation_validator::ec;
     }
 
     std::optional<model::initial_revision_id> remote_revision
@@ -68,27 +66,35 @@ topic_table::apply(create_topic_cmd cmd, model::offset offset) {
     auto md = topic_metadata_item{
       .metadata = topic_metadata(
         std::move(cmd.value), model::revision_id(offset()), remote_revision)};
-    // calculate delta
-    md.partitions.reserve(cmd.value.assignments.size());
+    // calculate delta. Topics with a large number of partitions would stall
+    // the reactor of every shard, the partitions are processed in a
+    // preemptible loop and published together with the topic so that readers
+    // never observe a partially created topic.
+    md.partitions.reserve(md.get_assignments().size());
+    fragmented_vector<delta> deltas;
     auto rev_id = model::revision_id{offset};
     for (auto& pas : md.get_assignments()) {
         auto ntp = model::ntp(cmd.key.ns, cmd.key.tp, pas.id);
         replicas_revision_map replica_revisions;
-        _partition_count++;
         for (auto& r : pas.replicas) {
             replica_revisions[r.node_id] = rev_id;
         }
         md.partitions.emplace(
           pas.id,
           partition_meta{
-            .replicas_revisions = replica_revisions,
+            .replicas_revisions = std::move(replica_revisions),
             .last_update_finished_revision = rev_id});
-        _pending_deltas.emplace_back(
+        deltas.emplace_back(
           std::move(ntp),
           model::revision_id(offset),
           topic_table_delta_type::added);
+        co_await ss::coroutine::maybe_yield();
     }
 
+    _partition_count += md.partitions.size();
+    for (auto& d : deltas) {
+        _pending_deltas.push_back(std::move(d));
+    }
     _topics.insert({
       cmd.key,
       std::move(md),
@@ -97,7 +103,7 @@ topic_table::apply(create_topic_cmd cmd, model::offset offset) {
     notify_waiters();
 
     _probe.handle_topic_creation(std::move(cmd.key));
-    return ss::make_ready_future<std::error_code>(errc::success);
+    co_return errc::success;
 }
 
 ss::future<> topic_table::stop() {
@@ -210,29 +216,48 @@ topic_table::apply(create_partition_cmd cmd, model::offset offset) {
 
     // add partitions
     auto prev_partition_count = tp->second.get_configuration().partition_count;
-    // update partitions count
-    tp->second.get_configuration().partition_count
-      = cmd.value.cfg.new_total_partition_count;
-    // add assignments of newly created partitions
+    // the new partitions are prepared in a preemptible loop and added to the
+    // topic at once, see the creation of a topic
     auto rev_id = model::revision_id{offset};
+    std::vector<partition_meta> metas;
+    metas.reserve(cmd.value.assignments.size());
+    fragmented_vector<delta> deltas;
     for (auto& p_as : cmd.value.assignments) {
-        _partition_count++;
         p_as.id += model::partition_id(prev_partition_count);
-        tp->second.get_assignments().emplace(p_as);
         // propagate deltas
         auto ntp = model::ntp(cmd.key.ns, cmd.key.tp, p_as.id);
         replicas_revision_map replicas_revisions;
         for (auto& bs : p_as.replicas) {
             replicas_revisions[bs.node_id] = rev_id;
         }
-        tp->second.partitions[p_as.id] = partition_meta{
-          .replicas_revisions = replicas_revisions,
-          .last_update_finished_revision = rev_id};
-        _topics_map_revision++;
-        _pending_deltas.emplace_back(
+        metas.push_back(partition_meta{
+          .replicas_revisions = std::move(replicas_revisions),
+          .last_update_finished_revision = rev_id});
+        deltas.emplace_back(
           std::move(ntp),
           model::revision_id(offset),
           topic_table_delta_type::added);
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    // the topic may not be looked up before the loop as it yields
+    tp = _topics.find(cmd.key);
+    vassert(
+      tp != _topics.end(),
+      "topic {} removed while its partitions were being created",
+      cmd.key);
+    // update partitions count
+    tp->second.get_configuration().partition_count
+      = cmd.value.cfg.new_total_partition_count;
+    // add assignments of newly created partitions
+    size_t i = 0;
+    for (auto& p_as : cmd.value.assignments) {
+        _partition_count++;
+        tp->second.partitions[p_as.id] = std::move(metas[i]);
+        tp->second.get_assignments().emplace(std::move(p_as));
+        _topics_map_revision++;
+        _pending_deltas.push_back(std::move(deltas[i]));
+        ++i;
     }
     notify_waiters();
     co_return errc::success;
@@ -900,6 +925,9 @@ topic_table::apply(update_topic_properties_cmd cmd, model::offset o) {
     incremental_update(
       properties.initial_retention_local_target_ms,
       overrides.initial_retention_local_target_ms);
+    incremental_update(properties.write_caching, overrides.write_caching);
+    incremental_update(
+      properties.observer_replicas, overrides.observer_replicas);
     // no configuration change, no need to generate delta
     if (properties == properties_snapshot) {
         co_return errc::success;
@@ -21,6 +21,7 @@
 #include "raft/types.h"
 #include "ssx/future-util.h"
 
+#include <seastar/core/loop.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/container/node_hash_map.h>
@@ -503,19 +504,25 @@ topic_updates_dispatcher::collect_in_progress(
 
 ss::future<> topic_updates_dispatcher::update_leaders_with_estimates(
   ss::chunked_fifo<ntp_leader> leaders) {
-    return ss::do_with(
-      std::move(leaders), [this](ss::chunked_fifo<ntp_leader>& leaders) {
-          return ss::parallel_for_each(leaders, [this](ntp_leader& leader) {
-              vlog(
-                clusterlog.debug,
-                "update_leaders_with_estimates: new NTP {} leader {}",
-                leader.first,
-                leader.second);
-              return _partition_leaders_table.invoke_on_all(
-                [leader = std::move(leader)](partition_leaders_table& l) {
-                    return l.update_partition_leader(
-                      leader.first, model::term_id(1), leader.second);
-                });
+    if (leaders.empty()) {
+        co_return;
+    }
+    if (clusterlog.is_enabled(ss::log_level::debug)) {
+        for (const auto& leader : leaders) {
+            vlog(
+              clusterlog.debug,
+              "update_leaders_with_estimates: new NTP {} leader {}",
+              leader.first,
+              leader.second);
+        }
+    }
+    // a single cross shard round trip for all the partitions of the command,
+    // every shard reads the (immutable) list owned by this one
+    co_await _partition_leaders_table.invoke_on_all(
+      [&leaders](partition_leaders_table& l) {
+          return ss::do_for_each(leaders, [&l](const ntp_leader& leader) {
+              l.update_partition_leader(
+                leader.first, model::term_id(1), leader.second);
           });
       });
 }
@@ -81,6 +81,12 @@ tx_gateway::commit_tx(commit_tx_request&& request, rpc::streaming_context&) {
       request.ntp, request.pid, request.tx_seq, request.timeout);
 }
 
+ss::future<commit_txs_reply>
+tx_gateway::commit_txs(commit_txs_request&& request, rpc::streaming_context&) {
+    return _rm_partition_frontend.local().commit_txs_locally(
+      std::move(request.ntps), request.pid, request.tx_seq, request.timeout);
+}
+
 ss::future<abort_tx_reply>
 tx_gateway::abort_tx(abort_tx_request&& request, rpc::streaming_context&) {
     return _rm_partition_frontend.local().abort_tx_locally(
@@ -54,6 +54,9 @@ public:
     ss::future<commit_tx_reply>
     commit_tx(commit_tx_request&&, rpc::streaming_context&) override;
 
+    ss::future<commit_txs_reply>
+    commit_txs(commit_txs_request&&, rpc::streaming_context&) override;
+
     ss::future<abort_tx_reply>
     abort_tx(abort_tx_request&&, rpc::streaming_context&) override;
 
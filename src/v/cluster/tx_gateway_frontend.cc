@@ -2380,12 +2380,13 @@ tx_gateway_frontend::recommit_tm_tx(
             gfs.push_back(_rm_group_proxy->commit_group_tx(
               group.group_id, tx.pid, tx.tx_seq, timeout));
         }
-        std::vector<ss::future<commit_tx_reply>> cfs;
-        cfs.reserve(tx.partitions.size());
-        for (auto rm : tx.partitions) {
-            cfs.push_back(_rm_partition_frontend.local().commit_tx(
-              rm.ntp, tx.pid, tx.tx_seq, timeout));
+        std::vector<model::ntp> ntps;
+        ntps.reserve(tx.partitions.size());
+        for (const auto& rm : tx.partitions) {
+            ntps.push_back(rm.ntp);
         }
+        auto cf = _rm_partition_frontend.local().commit_txs(
+          std::move(ntps), tx.pid, tx.tx_seq, timeout);
         auto ok = true;
         auto failed = false;
         auto rejected = false;
@@ -2420,7 +2421,7 @@ tx_gateway_frontend::recommit_tm_tx(
             }
             ok = ok && (r.ec == tx_errc::none);
         }
-        auto crs = co_await when_all_succeed(cfs.begin(), cfs.end());
+        auto crs = co_await std::move(cf);
         for (const auto& r : crs) {
             if (r.ec == tx_errc::request_rejected) {
                 rejected = true;
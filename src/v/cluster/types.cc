@@ -197,7 +197,9 @@ bool topic_properties::has_overrides() const {
            || record_value_subject_name_strategy.has_value()
            || record_value_subject_name_strategy_compat.has_value()
            || initial_retention_local_target_bytes.is_engaged()
-           || initial_retention_local_target_ms.is_engaged();
+           || initial_retention_local_target_ms.is_engaged()
+           || compression.has_value() || write_caching.has_value()
+           || observer_replicas.has_value();
 }
 
 bool topic_properties::requires_remote_erase() const {
@@ -227,6 +229,9 @@ topic_properties::get_ntp_cfg_overrides() const {
     ret.initial_retention_local_target_bytes
       = initial_retention_local_target_bytes;
     ret.initial_retention_local_target_ms = initial_retention_local_target_ms;
+    ret.compression = compression;
+    ret.write_caching = write_caching;
+    ret.observer_replicas = observer_replicas;
     return ret;
 }
 
@@ -262,6 +267,9 @@ storage::ntp_config topic_configuration::make_ntp_config(
             = properties.initial_retention_local_target_bytes,
             .initial_retention_local_target_ms
             = properties.initial_retention_local_target_ms,
+            .compression = properties.compression,
+            .write_caching = properties.write_caching,
+            .observer_replicas = properties.observer_replicas,
           });
     }
     return {
@@ -353,7 +361,8 @@ std::ostream& operator<<(std::ostream& o, const topic_properties& properties) {
       "record_value_subject_name_strategy: {}, "
       "record_value_subject_name_strategy_compat: {}, "
       "initial_retention_local_target_bytes: {}, "
-      "initial_retention_local_target_ms: {}}}",
+      "initial_retention_local_target_ms: {}, write_caching: {}, "
+      "observer_replicas: {}}}",
       properties.compression,
       properties.cleanup_policy_bitflags,
       properties.compaction_strategy,
@@ -380,7 +389,9 @@ std::ostream& operator<<(std::ostream& o, const topic_properties& properties) {
       properties.record_value_subject_name_strategy,
       properties.record_value_subject_name_strategy_compat,
       properties.initial_retention_local_target_bytes,
-      properties.initial_retention_local_target_ms);
+      properties.initial_retention_local_target_ms,
+      properties.write_caching,
+      properties.observer_replicas);
 
     return o;
 }
@@ -652,7 +663,8 @@ std::ostream& operator<<(std::ostream& o, const incremental_topic_updates& i) {
       "record_value_subject_name_strategy: {}"
       "record_value_subject_name_strategy_compat: {}, "
       "initial_retention_local_target_bytes: {}, "
-      "initial_retention_local_target_ms: {}",
+      "initial_retention_local_target_ms: {}, write_caching: {}, "
+      "observer_replicas: {}",
       i.compression,
       i.cleanup_policy_bitflags,
       i.compaction_strategy,
@@ -675,7 +687,9 @@ std::ostream& operator<<(std::ostream& o, const incremental_topic_updates& i) {
       i.record_value_subject_name_strategy,
       i.record_value_subject_name_strategy_compat,
       i.initial_retention_local_target_bytes,
-      i.initial_retention_local_target_ms);
+      i.initial_retention_local_target_ms,
+      i.write_caching,
+      i.observer_replicas);
     return o;
 }
 
@@ -947,6 +961,22 @@ std::ostream& operator<<(std::ostream& o, const commit_tx_reply& r) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const commit_txs_request& r) {
+    fmt::print(
+      o,
+      "{{ntps {} pid {} tx_seq {} timeout {}}}",
+      r.ntps,
+      r.pid,
+      r.tx_seq,
+      r.timeout);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const commit_txs_reply& r) {
+    fmt::print(o, "{{replies {}}}", r.replies);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const abort_tx_request& r) {
     fmt::print(
       o,
@@ -1809,7 +1839,9 @@ void adl<cluster::incremental_topic_updates>::to(
       t.record_value_subject_name_strategy,
       t.record_value_subject_name_strategy_compat,
       t.initial_retention_local_target_bytes,
-      t.initial_retention_local_target_ms);
+      t.initial_retention_local_target_ms,
+      t.write_caching,
+      t.observer_replicas);
 }
 
 cluster::incremental_topic_updates
@@ -1931,6 +1963,20 @@ adl<cluster::incremental_topic_updates>::from(iobuf_parser& in) {
               .from(in);
     }
 
+    if (
+      version
+      <= cluster::incremental_topic_updates::version_with_write_caching) {
+        updates.write_caching
+          = adl<cluster::property_update<std::optional<bool>>>{}.from(in);
+    }
+
+    if (
+      version
+      <= cluster::incremental_topic_updates::version_with_observer_replicas) {
+        updates.observer_replicas
+          = adl<cluster::property_update<std::optional<int16_t>>>{}.from(in);
+    }
+
     return updates;
 }
 
@@ -2195,7 +2241,9 @@ adl<cluster::topic_properties>::from(iobuf_parser& parser) {
       std::nullopt,
       std::nullopt,
       tristate<size_t>{std::nullopt},
-      tristate<std::chrono::milliseconds>{std::nullopt}};
+      tristate<std::chrono::milliseconds>{std::nullopt},
+      std::nullopt,
+      std::nullopt};
 }
 
 void adl<cluster::cluster_property_kv>::to(
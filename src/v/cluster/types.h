@@ -68,33 +68,42 @@ using replicas_t = std::vector<model::broker_shard>;
 struct allocate_id_request
   : serde::envelope<
       allocate_id_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::timeout_clock::duration timeout;
+    // Number of consecutive ids requested, the reply may carry fewer
+    int64_t count{1};
 
     allocate_id_request() noexcept = default;
 
     explicit allocate_id_request(model::timeout_clock::duration timeout)
       : timeout(timeout) {}
 
+    allocate_id_request(model::timeout_clock::duration timeout, int64_t count)
+      : timeout(timeout)
+      , count(count) {}
+
     friend bool
     operator==(const allocate_id_request&, const allocate_id_request&)
       = default;
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_request& req) {
-        fmt::print(o, "timeout: {}", req.timeout.count());
+        fmt::print(
+          o, "timeout: {}, count: {}", req.timeout.count(), req.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(timeout); }
+    auto serde_fields() { return std::tie(timeout, count); }
 };
 
 struct allocate_id_reply
   : serde::
-      envelope<allocate_id_reply, serde::version<0>, serde::compat_version<0>> {
+      envelope<allocate_id_reply, serde::version<1>, serde::compat_version<0>> {
     int64_t id;
     errc ec;
+    // The reply holds the ids [id, id + count)
+    int64_t count{1};
 
     allocate_id_reply() noexcept = default;
 
@@ -102,16 +111,21 @@ struct allocate_id_reply
       : id(id)
       , ec(ec) {}
 
+    allocate_id_reply(int64_t id, errc ec, int64_t count)
+      : id(id)
+      , ec(ec)
+      , count(count) {}
+
     friend bool operator==(const allocate_id_reply&, const allocate_id_reply&)
       = default;
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_reply& rep) {
-        fmt::print(o, "id: {}, ec: {}", rep.id, rep.ec);
+        fmt::print(o, "id: {}, ec: {}, count: {}", rep.id, rep.ec, rep.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(id, ec); }
+    auto serde_fields() { return std::tie(id, ec, count); }
 };
 
 struct reset_id_allocator_request
@@ -716,6 +730,58 @@ struct commit_tx_reply
     friend std::ostream& operator<<(std::ostream& o, const commit_tx_reply& r);
 };
 
+/// Commits a transaction on all the partitions of a node in a single RPC.
+struct commit_txs_request
+  : serde::envelope<
+      commit_txs_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    std::vector<model::ntp> ntps;
+    model::producer_identity pid;
+    model::tx_seq tx_seq;
+    model::timeout_clock::duration timeout{};
+
+    commit_txs_request() noexcept = default;
+
+    commit_txs_request(
+      std::vector<model::ntp> ntps,
+      model::producer_identity pid,
+      model::tx_seq tx_seq,
+      model::timeout_clock::duration timeout)
+      : ntps(std::move(ntps))
+      , pid(pid)
+      , tx_seq(tx_seq)
+      , timeout(timeout) {}
+
+    friend bool
+    operator==(const commit_txs_request&, const commit_txs_request&)
+      = default;
+
+    auto serde_fields() { return std::tie(ntps, pid, tx_seq, timeout); }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const commit_txs_request& r);
+};
+
+struct commit_txs_reply
+  : serde::
+      envelope<commit_txs_reply, serde::version<0>, serde::compat_version<0>> {
+    // one reply per partition, in the order of the request
+    std::vector<commit_tx_reply> replies;
+
+    commit_txs_reply() noexcept = default;
+
+    explicit commit_txs_reply(std::vector<commit_tx_reply> replies)
+      : replies(std::move(replies)) {}
+
+    friend bool operator==(const commit_txs_reply&, const commit_txs_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(replies); }
+
+    friend std::ostream& operator<<(std::ostream& o, const commit_txs_reply& r);
+};
+
 struct abort_tx_request
   : serde::
       envelope<abort_tx_request, serde::version<0>, serde::compat_version<0>> {
@@ -1472,7 +1538,7 @@ struct remote_topic_properties
  */
 struct topic_properties
   : serde::
-      envelope<topic_properties, serde::version<6>, serde::compat_version<0>> {
+      envelope<topic_properties, serde::version<8>, serde::compat_version<0>> {
     topic_properties() noexcept = default;
     topic_properties(
       std::optional<model::compression> compression,
@@ -1505,7 +1571,9 @@ struct topic_properties
       std::optional<pandaproxy::schema_registry::subject_name_strategy>
         record_value_subject_name_strategy_compat,
       tristate<size_t> initial_retention_local_target_bytes,
-      tristate<std::chrono::milliseconds> initial_retention_local_target_ms)
+      tristate<std::chrono::milliseconds> initial_retention_local_target_ms,
+      std::optional<bool> write_caching,
+      std::optional<int16_t> observer_replicas)
       : compression(compression)
       , cleanup_policy_bitflags(cleanup_policy_bitflags)
       , compaction_strategy(compaction_strategy)
@@ -1537,7 +1605,9 @@ struct topic_properties
           record_value_subject_name_strategy_compat)
       , initial_retention_local_target_bytes(
           initial_retention_local_target_bytes)
-      , initial_retention_local_target_ms(initial_retention_local_target_ms) {}
+      , initial_retention_local_target_ms(initial_retention_local_target_ms)
+      , write_caching(write_caching)
+      , observer_replicas(observer_replicas) {}
 
     std::optional<model::compression> compression;
     std::optional<model::cleanup_policy_bitflags> cleanup_policy_bitflags;
@@ -1580,6 +1650,14 @@ struct topic_properties
     tristate<std::chrono::milliseconds> initial_retention_local_target_ms{
       std::nullopt};
 
+    // acknowledge acks=all writes once a majority of the replicas appended
+    // them, and flush them in the background
+    std::optional<bool> write_caching;
+
+    // number of replicas of every partition which replicate the log without
+    // voting, to serve reads
+    std::optional<int16_t> observer_replicas;
+
     bool is_compacted() const;
     bool has_overrides() const;
     bool requires_remote_erase() const;
@@ -1615,7 +1693,9 @@ struct topic_properties
           record_value_subject_name_strategy,
           record_value_subject_name_strategy_compat,
           initial_retention_local_target_bytes,
-          initial_retention_local_target_ms);
+          initial_retention_local_target_ms,
+          write_caching,
+          observer_replicas);
     }
 
     friend bool operator==(const topic_properties&, const topic_properties&)
@@ -1703,7 +1783,7 @@ struct property_update<tristate<T>>
 struct incremental_topic_updates
   : serde::envelope<
       incremental_topic_updates,
-      serde::version<5>,
+      serde::version<7>,
       serde::compat_version<0>> {
     static constexpr int8_t version_with_data_policy = -1;
     static constexpr int8_t version_with_shadow_indexing = -3;
@@ -1712,6 +1792,8 @@ struct incremental_topic_updates
     static constexpr int8_t version_with_segment_ms = -5;
     static constexpr int8_t version_with_schema_id_validation = -6;
     static constexpr int8_t version_with_initial_retention = -7;
+    static constexpr int8_t version_with_write_caching = -8;
+    static constexpr int8_t version_with_observer_replicas = -9;
     // negative version indicating different format:
     // -1 - topic_updates with data_policy
     // -2 - topic_updates without data_policy
@@ -1719,7 +1801,9 @@ struct incremental_topic_updates
     // -4 - topic update with batch_max_bytes and retention.local.target
     // -6 - topic updates with schema id validation
     // -7 - topic updates with initial retention
-    static constexpr int8_t version = version_with_initial_retention;
+    // -8 - topic updates with write caching
+    // -9 - topic updates with observer replicas
+    static constexpr int8_t version = version_with_observer_replicas;
     property_update<std::optional<model::compression>> compression;
     property_update<std::optional<model::cleanup_policy_bitflags>>
       cleanup_policy_bitflags;
@@ -1757,6 +1841,8 @@ struct incremental_topic_updates
     property_update<tristate<size_t>> initial_retention_local_target_bytes;
     property_update<tristate<std::chrono::milliseconds>>
       initial_retention_local_target_ms;
+    property_update<std::optional<bool>> write_caching;
+    property_update<std::optional<int16_t>> observer_replicas;
 
     auto serde_fields() {
         return std::tie(
@@ -1782,7 +1868,9 @@ struct incremental_topic_updates
           record_value_subject_name_strategy,
           record_value_subject_name_strategy_compat,
           initial_retention_local_target_bytes,
-          initial_retention_local_target_ms);
+          initial_retention_local_target_ms,
+          write_caching,
+          observer_replicas);
     }
 
     friend std::ostream&
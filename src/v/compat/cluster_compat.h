@@ -350,6 +350,8 @@ struct compat_check<cluster::topic_properties> {
         json_write(record_value_subject_name_strategy_compat);
         json_write(initial_retention_local_target_bytes);
         json_write(initial_retention_local_target_ms);
+        json_write(write_caching);
+        json_write(observer_replicas);
     }
 
     static cluster::topic_properties from_json(json::Value& rd) {
@@ -381,6 +383,8 @@ struct compat_check<cluster::topic_properties> {
         json_read(record_value_subject_name_strategy_compat);
         json_read(initial_retention_local_target_bytes);
         json_read(initial_retention_local_target_ms);
+        json_read(write_caching);
+        json_read(observer_replicas);
         return obj;
     }
 
@@ -407,6 +411,8 @@ struct compat_check<cluster::topic_properties> {
           std::nullopt};
         obj.initial_retention_local_target_ms
           = tristate<std::chrono::milliseconds>{std::nullopt};
+        obj.write_caching = std::nullopt;
+        obj.observer_replicas = std::nullopt;
 
         if (reply != obj) {
             throw compat_error(fmt::format(
@@ -481,6 +487,8 @@ struct compat_check<cluster::topic_configuration> {
           std::nullopt};
         obj.properties.initial_retention_local_target_ms
           = tristate<std::chrono::milliseconds>{std::nullopt};
+        obj.properties.write_caching = std::nullopt;
+        obj.properties.observer_replicas = std::nullopt;
 
         if (cfg != obj) {
             throw compat_error(fmt::format(
@@ -544,6 +552,8 @@ struct compat_check<cluster::create_topics_request> {
               = tristate<size_t>{std::nullopt};
             topic.properties.initial_retention_local_target_ms
               = tristate<std::chrono::milliseconds>{std::nullopt};
+            topic.properties.write_caching = std::nullopt;
+            topic.properties.observer_replicas = std::nullopt;
         }
         if (req != obj) {
             throw compat_error(fmt::format(
@@ -606,6 +616,8 @@ struct compat_check<cluster::create_topics_reply> {
               = tristate<size_t>{std::nullopt};
             topic.properties.initial_retention_local_target_ms
               = tristate<std::chrono::milliseconds>{std::nullopt};
+            topic.properties.write_caching = std::nullopt;
+            topic.properties.observer_replicas = std::nullopt;
         }
         if (reply != obj) {
             throw compat_error(fmt::format(
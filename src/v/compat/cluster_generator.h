@@ -625,7 +625,10 @@ struct instance_generator<cluster::topic_properties> {
           std::nullopt,
           tests::random_tristate(
             [] { return random_generators::get_int<size_t>(); }),
-          tests::random_tristate([] { return tests::random_duration_ms(); })};
+          tests::random_tristate([] { return tests::random_duration_ms(); }),
+          tests::random_optional([] { return tests::random_bool(); }),
+          tests::random_optional(
+            [] { return random_generators::get_int<int16_t>(0, 4); })};
     }
 
     static std::vector<cluster::topic_properties> limits() { return {}; }
@@ -604,6 +604,8 @@ inline void rjson_serialize(
       w,
       "initial_retention_local_target_ms",
       tps.initial_retention_local_target_ms);
+    write_member(w, "write_caching", tps.write_caching);
+    write_member(w, "observer_replicas", tps.observer_replicas);
     w.EndObject();
 }
 
@@ -666,6 +668,8 @@ inline void read_value(json::Value const& rd, cluster::topic_properties& obj) {
       rd,
       "initial_retention_local_target_ms",
       obj.initial_retention_local_target_ms);
+    read_member(rd, "write_caching", obj.write_caching);
+    read_member(rd, "observer_replicas", obj.observer_replicas);
 }
 
 inline void rjson_serialize(
@@ -20,8 +20,14 @@ namespace compat {
 
 GEN_COMPAT_CHECK_SERDE_ONLY(
   cluster::get_node_health_request,
-  { json_write(filter); },
-  { json_read(filter); });
+  {
+      json_write(filter);
+      json_write(last_version);
+  },
+  {
+      json_read(filter);
+      json_read(last_version);
+  });
 
 template<>
 struct compat_check<cluster::get_node_health_reply> {
@@ -36,12 +42,14 @@ struct compat_check<cluster::get_node_health_reply> {
       json::Writer<json::StringBuffer>& wr) {
         json_write(error);
         json_write(report);
+        json_write(version);
     }
 
     static cluster::get_node_health_reply from_json(json::Value& rd) {
         cluster::get_node_health_reply obj;
         json_read(error);
         json_read(report);
+        json_read(version);
         return obj;
     }
 
@@ -14,10 +14,13 @@
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
 #include "compression/internal/zstd_compressor.h"
+#include "ssx/thread_worker.h"
 #include "units.h"
 #include "vassert.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
+
 namespace compression {
 
 /*
@@ -33,6 +36,23 @@ namespace compression {
  */
 ss::logger complog{"compression"};
 
+namespace {
+struct offload_config {
+    ssx::singleton_thread_worker* worker = nullptr;
+    size_t min_bytes = 0;
+};
+thread_local offload_config offload;
+
+bool should_offload(const iobuf& io, type t) {
+    return offload.worker != nullptr && t != type::none && t != type::zstd
+           && io.size_bytes() >= offload.min_bytes;
+}
+} // namespace
+
+void set_offload_worker(ssx::singleton_thread_worker* w, size_t min_bytes) {
+    offload = {.worker = w, .min_bytes = min_bytes};
+}
+
 iobuf compressor::compress(const iobuf& io, type t) {
     switch (t) {
     case type::none:
@@ -81,7 +101,7 @@ ss::future<iobuf> stream_compressor::compress(iobuf io, type t) {
         return compression::async_stream_zstd_instance().compress(
           std::move(io));
     default:
-        return ss::make_ready_future<iobuf>(compressor::compress(io, t));
+        return offload_compressor::compress(std::move(io), t);
     }
 }
 ss::future<iobuf> stream_compressor::uncompress(iobuf io, type t) {
@@ -94,8 +114,25 @@ ss::future<iobuf> stream_compressor::uncompress(iobuf io, type t) {
         return compression::async_stream_zstd_instance().uncompress(
           std::move(io));
     default:
-        return ss::make_ready_future<iobuf>(compressor::uncompress(io, t));
+        return offload_compressor::uncompress(std::move(io), t);
+    }
+}
+
+ss::future<iobuf> offload_compressor::compress(iobuf io, type t) {
+    if (!should_offload(io, t)) {
+        co_return compressor::compress(io, t);
+    }
+    // The worker only reads the input, which is kept alive by this frame.
+    co_return co_await offload.worker->submit(
+      [&io, t] { return compressor::compress(io, t); });
+}
+
+ss::future<iobuf> offload_compressor::uncompress(iobuf io, type t) {
+    if (!should_offload(io, t)) {
+        co_return compressor::uncompress(io, t);
     }
+    co_return co_await offload.worker->submit(
+      [&io, t] { return compressor::uncompress(io, t); });
 }
 
 } // namespace compression
@@ -12,6 +12,7 @@
 #pragma once
 #include "bytes/iobuf.h"
 #include "model/compression.h"
+#include "ssx/fwd.h"
 namespace compression {
 
 using type = model::compression;
@@ -31,4 +32,20 @@ struct stream_compressor {
     static ss::future<iobuf> uncompress(iobuf, type);
 };
 
+// Runs the compression of buffers of at least min_bytes with the codecs that
+// can't yield (gzip, lz4 and snappy) on the given thread worker instead of the
+// reactor. zstd is never offloaded, async_stream_zstd yields between windows
+// and the stream_zstd workspaces only exist on the reactor threads.
+//
+// The offload is configured per shard, pass nullptr to disable it. The worker
+// must outlive the offload being enabled.
+void set_offload_worker(ssx::singleton_thread_worker*, size_t min_bytes);
+
+// Like compressor, but runs on the offload worker when one is set and the
+// buffer is large enough.
+struct offload_compressor {
+    static ss::future<iobuf> compress(iobuf, type);
+    static ss::future<iobuf> uncompress(iobuf, type);
+};
+
 } // namespace compression
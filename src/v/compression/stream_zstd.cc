@@ -85,11 +85,14 @@ ZSTD_DCtx* stream_zstd::decompressor() {
     return ctx;
 }
 
-iobuf stream_zstd::do_compress(const iobuf& x) {
+iobuf stream_zstd::do_compress(const iobuf& x, const zstd_dictionary* dict) {
     reset_compressor();
     ZSTD_CCtx* ctx = compressor().get();
     // NOTE: always enable content size. **decompression** depends on this
     throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx, x.size_bytes()));
+    if (dict) {
+        throw_if_error(ZSTD_CCtx_refCDict(ctx, dict->cdict()));
+    }
 
     const size_t max_chunk_size = details::io_allocation_size::max_chunk_size;
     auto output_chunk_size = std::min(
@@ -194,12 +197,16 @@ size_t decompression_step(const iobuf& x) {
     return std::min(64_KiB, ret);
 }
 
-iobuf stream_zstd::do_uncompress(const iobuf& x) {
+iobuf stream_zstd::do_uncompress(
+  const iobuf& x, const zstd_dictionary* dict) {
     if (unlikely(x.empty())) {
         throw std::runtime_error(
           "Asked to stream_zstd::uncompress empty buffer");
     }
     ZSTD_DCtx* dctx = decompressor();
+    if (dict) {
+        throw_if_error(ZSTD_DCtx_refDDict(dctx, dict->ddict()));
+    }
     iobuf ret;
     ss::temporary_buffer<char>& obuf = d_buffer;
     ZSTD_outBuffer out = {
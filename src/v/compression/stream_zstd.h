@@ -11,6 +11,7 @@
 
 #pragma once
 #include "bytes/iobuf.h"
+#include "compression/zstd_dictionary.h"
 #include "static_deleter_fn.h"
 
 #include <memory>
@@ -29,11 +30,19 @@ public:
     iobuf compress(iobuf&& b) { return do_compress(b); }
     iobuf uncompress(iobuf&& b) { return do_uncompress(b); }
 
+    // Frames compressed with a dictionary can only be decompressed with it.
+    iobuf compress(const iobuf& b, const zstd_dictionary& d) {
+        return do_compress(b, &d);
+    }
+    iobuf uncompress(const iobuf& b, const zstd_dictionary& d) {
+        return do_uncompress(b, &d);
+    }
+
     static void init_workspace(size_t);
 
 private:
-    iobuf do_compress(const iobuf&);
-    iobuf do_uncompress(const iobuf&);
+    iobuf do_compress(const iobuf&, const zstd_dictionary* = nullptr);
+    iobuf do_uncompress(const iobuf&, const zstd_dictionary* = nullptr);
 
     void reset_compressor();
     zstd_compress_ctx& compressor();
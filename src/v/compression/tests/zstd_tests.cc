@@ -7,14 +7,18 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "bytes/bytes.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "compression/internal/gzip_compressor.h"
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
 #include "compression/internal/zstd_compressor.h"
 #include "compression/snappy_standard_compressor.h"
 #include "compression/stream_zstd.h"
+#include "compression/zstd_dictionary.h"
 #include "random/generators.h"
+#include "ssx/thread_worker.h"
 #include "units.h"
 #include "vassert.h"
 
@@ -186,3 +190,58 @@ SEASTAR_THREAD_TEST_CASE(gzip_test) {
     using fn = compression::internal::gzip_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
 }
+SEASTAR_THREAD_TEST_CASE(offload_compressor_test) {
+    auto w = ssx::singleton_thread_worker{};
+    w.start({}).get();
+    compression::set_offload_worker(&w, 1_KiB);
+    for (auto t :
+         {compression::type::gzip,
+          compression::type::lz4,
+          compression::type::snappy}) {
+        for (size_t i : sizes) {
+            if (i == 0) {
+                continue;
+            }
+            iobuf buf = gen(i);
+            auto cbuf = compression::offload_compressor::compress(
+                          buf.share(0, i), t)
+                          .get();
+            auto dbuf = compression::offload_compressor::uncompress(
+                          std::move(cbuf), t)
+                          .get();
+            BOOST_CHECK_EQUAL(dbuf, buf);
+        }
+    }
+    compression::set_offload_worker(nullptr, 0);
+    w.stop().get();
+}
+SEASTAR_THREAD_TEST_CASE(zstd_dictionary_test) {
+    std::vector<iobuf> samples;
+    for (int i = 0; i < 1000; ++i) {
+        auto json = fmt::format(
+          R"({{"id": {}, "name": "user-{}", "active": {}, "tags": ["a"]}})",
+          i,
+          random_generators::gen_alphanum_string(8),
+          i % 2 == 0);
+        iobuf sample;
+        sample.append(json.data(), json.size());
+        samples.push_back(std::move(sample));
+    }
+    auto dict = compression::zstd_dictionary::train(samples, 4_KiB);
+    BOOST_REQUIRE_NE(dict.id(), 0);
+    BOOST_REQUIRE_LE(dict.content().size(), 4_KiB);
+
+    compression::stream_zstd fn;
+    size_t plain_size = 0;
+    size_t dict_size = 0;
+    for (const auto& sample : samples) {
+        auto cbuf = fn.compress(sample, dict);
+        auto frame = iobuf_to_bytes(cbuf);
+        BOOST_REQUIRE_EQUAL(
+          ZSTD_getDictID_fromFrame(frame.data(), frame.size()), dict.id());
+        BOOST_REQUIRE_EQUAL(fn.uncompress(cbuf, dict), sample);
+        plain_size += fn.compress(sample).size_bytes();
+        dict_size += cbuf.size_bytes();
+    }
+    BOOST_REQUIRE_LT(dict_size, plain_size);
+}
@@ -0,0 +1,70 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "compression/zstd_dictionary.h"
+
+#include <fmt/format.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <zdict.h>
+
+namespace compression {
+
+zstd_dictionary::zstd_dictionary(bytes content, int level)
+  : _content(std::move(content))
+  , _cdict(ZSTD_createCDict(_content.data(), _content.size(), level))
+  , _ddict(ZSTD_createDDict(_content.data(), _content.size())) {
+    if (!_cdict || !_ddict) {
+        throw std::bad_alloc{};
+    }
+}
+
+zstd_dictionary zstd_dictionary::train(
+  std::span<const iobuf> samples, size_t max_size, int level) {
+    // zdict wants all the samples in a single contiguous buffer
+    size_t total_size = 0;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto& sample : samples) {
+        sample_sizes.push_back(sample.size_bytes());
+        total_size += sample.size_bytes();
+    }
+    bytes buffer(bytes::initialized_later{}, total_size);
+    size_t pos = 0;
+    for (const auto& sample : samples) {
+        for (const auto& frag : sample) {
+            std::memcpy(buffer.data() + pos, frag.get(), frag.size());
+            pos += frag.size();
+        }
+    }
+
+    bytes dict(bytes::initialized_later{}, max_size);
+    auto rc = ZDICT_trainFromBuffer(
+      dict.data(),
+      dict.size(),
+      buffer.data(),
+      sample_sizes.data(),
+      sample_sizes.size());
+    if (ZDICT_isError(rc)) {
+        throw std::runtime_error(fmt::format(
+          "Failed to train zstd dictionary from {} samples: {}",
+          samples.size(),
+          ZDICT_getErrorName(rc)));
+    }
+    dict.resize(rc);
+    return zstd_dictionary(std::move(dict), level);
+}
+
+uint32_t zstd_dictionary::id() const {
+    return ZSTD_getDictID_fromDDict(_ddict.get());
+}
+
+} // namespace compression
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "static_deleter_fn.h"
+
+#include <memory>
+#include <span>
+#include <zstd.h>
+
+namespace compression {
+
+/*
+ * A zstd dictionary, prepared for both compression and decompression.
+ *
+ * Dictionaries help most with small payloads that share structure (such as
+ * small JSON records), where there is too little data in a single payload for
+ * zstd to learn from. Frames compressed with a dictionary can only be
+ * decompressed with the same dictionary, so they must never be handed to
+ * clients that expect standard zstd data, such as Kafka record batches.
+ */
+class zstd_dictionary {
+public:
+    using cdict_ptr = std::unique_ptr<
+      ZSTD_CDict,
+      static_sized_deleter_fn<ZSTD_CDict, &ZSTD_freeCDict>>;
+    using ddict_ptr = std::unique_ptr<
+      ZSTD_DDict,
+      static_sized_deleter_fn<ZSTD_DDict, &ZSTD_freeDDict>>;
+
+    static constexpr int default_level = ZSTD_CLEVEL_DEFAULT;
+
+    /// Creates a dictionary from its serialized content, as returned by
+    /// train() or zstd's own tooling.
+    explicit zstd_dictionary(bytes content, int level = default_level);
+
+    /// Trains a dictionary of at most max_size bytes on the given samples.
+    ///
+    /// zstd needs a reasonable number of samples (in the hundreds) compared
+    /// to the size of the dictionary, training throws if it can't produce a
+    /// dictionary out of them.
+    static zstd_dictionary train(
+      std::span<const iobuf> samples,
+      size_t max_size,
+      int level = default_level);
+
+    /// The dictionary ID, which zstd also writes in the frames it compresses.
+    uint32_t id() const;
+    const bytes& content() const { return _content; }
+
+    const ZSTD_CDict* cdict() const { return _cdict.get(); }
+    const ZSTD_DDict* ddict() const { return _ddict.get(); }
+
+private:
+    bytes _content;
+    cdict_ptr _cdict;
+    ddict_ptr _ddict;
+};
+
+} // namespace compression
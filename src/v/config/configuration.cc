@@ -85,6 +85,17 @@ configuration::configuration()
       "Duration after which inactive readers will be evicted from cache",
       {.visibility = visibility::tunable},
       30s)
+  , readers_cache_memory_budget(
+      *this,
+      "readers_cache_memory_budget",
+      "Per-shard budget in bytes for the estimated buffer memory of the "
+      "inactive readers kept in the readers caches of all partitions. When "
+      "the budget is exceeded the readers reused least per byte of memory "
+      "are evicted first",
+      {.needs_restart = needs_restart::no,
+       .example = "134217728",
+       .visibility = visibility::tunable},
+      128_MiB)
   , log_segment_ms(
       *this,
       "log_segment_ms",
@@ -134,6 +145,16 @@ configuration::configuration()
       {.example = "65536"},
       std::nullopt,
       {.min = 32_KiB, .align = 4_KiB})
+  , rpc_server_output_cork_us(
+      *this,
+      "rpc_server_output_cork_us",
+      "Internal RPC responses are written to the socket with a delay of up to "
+      "this amount of microseconds so that the responses completing in the "
+      "meantime share the same write. Trades latency for fewer syscalls on "
+      "connections carrying many small responses. Disabled by default.",
+      {.example = "100", .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 1, .max = 10000})
   , rpc_client_connections_per_peer(
       *this,
       "rpc_client_connections_per_peer",
@@ -142,6 +163,19 @@ configuration::configuration()
       {.example = "8"},
       8,
       {.min = 8})
+  , rpc_client_max_inflight_write_bytes(
+      *this,
+      "rpc_client_max_inflight_write_bytes",
+      "Maximum number of bytes of normal priority internal RPC requests "
+      "written to a connection at a time. Requests past this limit wait in "
+      "the client so that high priority ones (e.g. raft heartbeats) do not "
+      "queue behind large messages. If unset, requests are written to the "
+      "connection as soon as they are ready. Applies to new connections.",
+      {.needs_restart = needs_restart::no,
+       .example = "1048576",
+       .visibility = visibility::tunable},
+      1_MiB,
+      {.min = 64_KiB})
   , enable_coproc(*this, "enable_coproc")
   , coproc_max_inflight_bytes(*this, "coproc_max_inflight_bytes")
   , coproc_max_ingest_bytes(*this, "coproc_max_ingest_bytes")
@@ -159,6 +193,30 @@ configuration::configuration()
       "The interval at which Data Transforms commits progress.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       3s)
+  , data_transforms_write_linger_ms(
+      *this,
+      "data_transforms_write_linger_ms",
+      "How long Data Transforms wait for more transformed records before "
+      "writing them to the output topic, trading latency for larger writes.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
+  , data_transforms_write_max_batch_bytes(
+      *this,
+      "data_transforms_write_max_batch_bytes",
+      "The maximum amount of transformed data that Data Transforms write to "
+      "the output topic at once.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1_MiB,
+      {.min = 1_KiB, .max = 128_MiB})
+  , data_transforms_buffer_memory_per_partition(
+      *this,
+      "data_transforms_buffer_memory_per_partition",
+      "The amount of memory Data Transforms use per partition to buffer "
+      "records between reading, transforming and writing them. Applies to "
+      "transforms started after the change.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      2_MiB,
+      {.min = 64_KiB, .max = 1_GiB})
   , data_transforms_per_core_memory_reservation(
       *this,
       "data_transforms_per_core_memory_reservation",
@@ -292,12 +350,27 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512_KiB,
       {.min = 128, .max = 5_MiB})
+  , raft_recovery_snapshot_chunk_size(
+      *this,
+      "raft_recovery_snapshot_chunk_size",
+      "Size of a single chunk of a snapshot sent to a recovering follower",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      512_KiB,
+      {.min = 4_KiB, .max = 5_MiB})
   , raft_enable_lw_heartbeat(
       *this,
       "raft_enable_lw_heartbeat",
       "enables raft optimization of heartbeats",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , raft_enable_idle_group_hibernation(
+      *this,
+      "raft_enable_idle_group_hibernation",
+      "Let followers of idle raft groups hibernate on the lightweight "
+      "heartbeats of their leader node instead of being heartbeated one by "
+      "one. Requires raft_enable_lw_heartbeat.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , raft_recovery_concurrency_per_shard(
       *this,
       "raft_recovery_concurrency_per_shard",
@@ -307,6 +380,22 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       64,
       {.min = 1, .max = 16384})
+  , raft_recovery_batch_max_bytes(
+      *this,
+      "raft_recovery_batch_max_bytes",
+      "Maximum size of a single RPC coalescing recovery append entries "
+      "requests of many partitions sent to the same node. If not set every "
+      "partition sends its recovery requests separately.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , raft_enable_vote_batching(
+      *this,
+      "raft_enable_vote_batching",
+      "Coalesce the vote and prevote requests of many partitions sent to the "
+      "same node into a single RPC. Reduces the number of RPCs when many "
+      "partitions hold elections at once, e.g. after a node failure.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , raft_replica_max_pending_flush_bytes(
       *this,
       "raft_replica_max_pending_flush_bytes",
@@ -483,6 +572,27 @@ configuration::configuration()
       "set this option to true.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       false)
+  , group_offset_commit_coalesce_ms(
+      *this,
+      "group_offset_commit_coalesce_ms",
+      "Time window during which offset commits of the consumer groups "
+      "managed by a __consumer_offsets partition are coalesced into a single "
+      "batch before being replicated. Coalescing is disabled when not set.",
+      {.needs_restart = needs_restart::no,
+       .example = "5",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , group_recovery_checkpoint_interval_ms(
+      *this,
+      "group_recovery_checkpoint_interval_ms",
+      "How often the materialized state of the consumer groups of each "
+      "__consumer_offsets partition is checkpointed to disk. On leadership "
+      "change only the log following the checkpoint is replayed. "
+      "Checkpointing is disabled when not set.",
+      {.needs_restart = needs_restart::no,
+       .example = "600000",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , metadata_dissemination_interval_ms(
       *this,
       "metadata_dissemination_interval_ms",
@@ -850,6 +960,21 @@ configuration::configuration()
       "Max size of requests cached for replication",
       {.visibility = visibility::tunable},
       1_MiB)
+  , raft_replicate_batch_adaptive_window(
+      *this,
+      "raft_replicate_batch_adaptive_window",
+      "Delay dispatching replicate requests while earlier requests of the same "
+      "partition are in flight, so that more requests share one append and "
+      "flush. The delay follows the observed replication latency and is "
+      "bounded by raft_replicate_batch_max_delay_ms",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_replicate_batch_max_delay_ms(
+      *this,
+      "raft_replicate_batch_max_delay_ms",
+      "Maximum delay added to a replicate request by the adaptive batch window",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      2ms)
   , raft_learner_recovery_rate(
       *this,
       "raft_learner_recovery_rate",
@@ -874,7 +999,7 @@ configuration::configuration()
       "raft_max_concurrent_append_requests_per_follower",
       "Maximum number of concurrent append entries requests sent by leader to "
       "one follower",
-      {.visibility = visibility::tunable},
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       16)
   , reclaim_min_size(
       *this,
@@ -906,6 +1031,14 @@ configuration::configuration()
       "Free memory limit that will be kept by batch cache background reclaimer",
       {.visibility = visibility::tunable},
       64_MiB)
+  , batch_cache_admission_filter(
+      *this,
+      "batch_cache_admission_filter",
+      "Only insert a batch read from disk into the batch cache when it was "
+      "already read recently, so that scans reading every batch once do not "
+      "evict frequently read batches",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
   , auto_create_topics_enabled(
       *this,
       "auto_create_topics_enabled",
@@ -943,6 +1076,49 @@ configuration::configuration()
       "bytes limits is higher",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       64_MiB)
+  , kafka_fetch_zero_copy(
+      *this,
+      "kafka_fetch_zero_copy",
+      "Share the record payload of large batches read from the log with the "
+      "fetch response instead of copying it. Reduces fetch CPU usage at the "
+      "cost of keeping read buffers alive until the response is sent.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , kafka_fetch_coalesce_reads(
+      *this,
+      "kafka_fetch_coalesce_reads",
+      "Let concurrent fetches that read the same range of a partition share a "
+      "single read. Benefits fan-out workloads where many consumers poll the "
+      "same partition tail.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
+  , kafka_fetch_record_filters(
+      *this,
+      "kafka_fetch_record_filters",
+      "Filters applied by the broker to the records fetched by some clients. "
+      "A client uses the first filter whose clients_prefix its client_id "
+      "starts with, and only receives the records with a header_key header, "
+      "of value header_value if set, and a key starting with key_prefix if "
+      "set. The offsets of the records filtered out are still consumed.",
+      {.needs_restart = needs_restart::no,
+       .example
+       = R"([{'name': 'orders', 'clients_prefix': 'billing-', 'header_key': 'type', 'header_value': 'order'}])",
+       .visibility = visibility::user},
+      {},
+      [](const std::vector<fetch_record_filter>& v) {
+          return validate_fetch_record_filters(v);
+      })
+  , kafka_follower_fetch_lease_ms(
+      *this,
+      "kafka_follower_fetch_lease_ms",
+      "Maximum time since a follower last heard from the partition leader for "
+      "it to serve rack aware follower fetches. The lease is renewed by every "
+      "heartbeat and append entries request from the leader. A follower whose "
+      "lease expired replies with NOT_LEADER_FOR_PARTITION so that consumers "
+      "go back to the leader. If not set, followers serve fetches regardless "
+      "of the leader contact.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , raft_io_timeout_ms(
       *this,
       "raft_io_timeout_ms",
@@ -979,6 +1155,13 @@ configuration::configuration()
       "Maximum delay until buffered data is written",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::chrono::milliseconds(1s))
+  , storage_flush_coalescing_window_ms(
+      *this,
+      "storage_flush_coalescing_window_ms",
+      "Time window over which segment flushes on the same shard are batched "
+      "and dispatched together. Zero dispatches every flush immediately.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , fetch_session_eviction_timeout_ms(
       *this,
       "fetch_session_eviction_timeout_ms",
@@ -995,6 +1178,29 @@ configuration::configuration()
       {.example = "32768", .visibility = visibility::tunable},
       16_KiB,
       {.min = 4096, .max = 32_MiB, .align = 4096})
+  , append_large_chunk_size(
+      *this,
+      "append_large_chunk_size",
+      "Size of the direct write operations of segments appended to at a "
+      "high rate. A segment which fills several chunks of append_chunk_size "
+      "back to back switches to chunks of this size. Zero, or a size no "
+      "larger than append_chunk_size, disables large chunks.",
+      {.needs_restart = needs_restart::no,
+       .example = "131072",
+       .visibility = visibility::tunable},
+      0,
+      {.min = 0, .max = 32_MiB, .align = 4096})
+  , storage_max_inflight_dma_writes(
+      *this,
+      "storage_max_inflight_dma_writes",
+      "Maximum number of direct writes of segment appenders in flight on "
+      "each shard. The segments of a node share the data device, so this is "
+      "the write queue depth each shard presents to the device. Zero disables "
+      "the limit.",
+      {.needs_restart = needs_restart::no,
+       .example = "64",
+       .visibility = visibility::tunable},
+      0)
   , storage_read_buffer_size(
       *this,
       "storage_read_buffer_size",
@@ -1011,6 +1217,39 @@ configuration::configuration()
        .example = "1",
        .visibility = visibility::tunable},
       10)
+  , storage_read_page_cache_size(
+      *this,
+      "storage_read_page_cache_size",
+      "Per-shard capacity in bytes of the page cache used for segment reads. "
+      "Pages are storage_read_buffer_size bytes. A value of zero disables "
+      "the page cache.",
+      {.needs_restart = needs_restart::yes,
+       .example = "268435456",
+       .visibility = visibility::tunable},
+      0)
+  , storage_read_readahead_budget(
+      *this,
+      "storage_read_readahead_budget",
+      "Per-shard budget in bytes of the read-ahead that segment readers may "
+      "issue beyond storage_read_readahead_count when they detect a "
+      "sequential scan. Readers whose read-ahead goes unused shrink it below "
+      "storage_read_readahead_count regardless of the budget. A value of "
+      "zero disables the adaptive read-ahead.",
+      {.needs_restart = needs_restart::yes,
+       .example = "67108864",
+       .visibility = visibility::tunable},
+      64_MiB)
+  , storage_read_coalescing(
+      *this,
+      "storage_read_coalescing",
+      "Read segment files through a shard-level scheduler that batches the "
+      "reads of all the partitions of the shard and coalesces adjacent reads "
+      "of the same segment into larger aligned reads. Does not apply when "
+      "the segment page cache is enabled.",
+      {.needs_restart = needs_restart::yes,
+       .example = "true",
+       .visibility = visibility::tunable},
+      false)
   , segment_fallocation_step(
       *this,
       "segment_fallocation_step",
@@ -1040,6 +1279,28 @@ configuration::configuration()
        .visibility = visibility::tunable},
       1024,
       {.min = 128})
+  , storage_max_loaded_segment_indices(
+      *this,
+      "storage_max_loaded_segment_indices",
+      "Maximum number of offset indices of closed segments kept in memory on "
+      "each shard. The least recently read indices over the limit are "
+      "unloaded and read back from disk when their segment is read again. "
+      "Unlimited if not set.",
+      {.needs_restart = needs_restart::no,
+       .example = "4096",
+       .visibility = visibility::tunable},
+      std::nullopt)
+  , storage_segment_file_pool_size(
+      *this,
+      "storage_segment_file_pool_size",
+      "Number of pre-created and pre-allocated segment files kept on each "
+      "shard, so that rolling a segment only renames a file. The data files "
+      "of segments removed by retention are recycled into the pool. Zero "
+      "disables the pool.",
+      {.needs_restart = needs_restart::yes,
+       .example = "4",
+       .visibility = visibility::tunable},
+      0)
   , storage_compaction_index_memory(
       *this,
       "storage_compaction_index_memory",
@@ -1050,6 +1311,26 @@ configuration::configuration()
        .visibility = visibility::tunable},
       128_MiB,
       {.min = 16_MiB, .max = 100_GiB})
+  , storage_compaction_index_fingerprint_keys(
+      *this,
+      "storage_compaction_index_fingerprint_keys",
+      "Store keys longer than 18 bytes in compaction indices as a 128-bit "
+      "fingerprint instead of the full key. Reduces the disk and memory "
+      "used by compaction indices of topics with large keys. Indices that "
+      "are written with fingerprints are rebuilt by versions of Redpanda "
+      "that do not support them.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , storage_index_zone_maps(
+      *this,
+      "storage_index_zone_maps",
+      "Store zone maps in the indices of new segments: for every index entry, "
+      "the lowest and highest timestamps and a sketch of the record keys of "
+      "its batches. Timequeries and key lookups use them to skip the batches "
+      "that can't match. The sketch makes appends parse the records of "
+      "uncompressed batches.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , storage_compaction_key_map_memory(
       *this,
       "storage_compaction_key_map_memory",
@@ -1074,6 +1355,16 @@ configuration::configuration()
        .visibility = visibility::tunable},
       12.0,
       {.min = 1.0, .max = 100.0})
+  , storage_compaction_max_concurrent_partitions(
+      *this,
+      "storage_compaction_max_concurrent_partitions",
+      "Maximum number of partitions that each shard runs sliding window "
+      "compaction on at the same time. The compaction key-offset map memory "
+      "is split evenly between them. Only respected when "
+      "`log_compaction_use_sliding_window` is true.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      1,
+      {.min = 1, .max = 64})
   , max_compacted_log_segment_size(
       *this,
       "max_compacted_log_segment_size",
@@ -1130,6 +1421,16 @@ configuration::configuration()
       "touching the log until the batch is exhausted.",
       {.visibility = visibility::tunable},
       1000)
+  , id_allocator_lease_size(
+      *this,
+      "id_allocator_lease_size",
+      "Number of producer ids every shard leases from the id allocator and "
+      "then hands out without a request to its leader. The lease is refilled "
+      "in the background when it runs low. 0 allocates every id on the "
+      "leader. The leased ids aren't reused: the ids of a lease are skipped "
+      "when the shard restarts.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , enable_sasl(
       *this,
       "enable_sasl",
@@ -1292,6 +1593,33 @@ configuration::configuration()
       "target compaction backlog would be equal to ",
       {.visibility = visibility::tunable},
       std::nullopt)
+  , compaction_ctrl_priority(
+      *this,
+      "compaction_ctrl_priority",
+      "Weight of the compaction controller when the shares of "
+      "backlog_ctrl_shares_budget are shared out between the backlog "
+      "controllers",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      1)
+  , backlog_ctrl_shares_budget(
+      *this,
+      "backlog_ctrl_shares_budget",
+      "Number of IO and CPU shares the backlog controllers of a shard "
+      "(compaction and archival upload) can use together. When their demands "
+      "exceed it, the budget is shared out in proportion to the demand and "
+      "the priority of each controller. If unset, every controller gets the "
+      "shares it asks for.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , backlog_ctrl_latency_target_ms(
+      *this,
+      "backlog_ctrl_latency_target_ms",
+      "Target for the average end-to-end latency of the produce requests of "
+      "a shard. Above it, backlog_ctrl_shares_budget shrinks by the ratio of "
+      "the target to the latency. If unset, the budget doesn't depend on the "
+      "foreground latency.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , members_backend_retry_ms(
       *this,
       "members_backend_retry_ms",
@@ -1369,6 +1697,16 @@ configuration::configuration()
       // permit setting a max below the min).  The maximum is set to forbid
       // contiguous allocations beyond that size.
       {.min = 512, .max = 512_KiB, .align = 4_KiB})
+  , kafka_rpc_server_output_cork_us(
+      *this,
+      "kafka_rpc_server_output_cork_us",
+      "Kafka responses are written to the socket with a delay of up to this "
+      "amount of microseconds so that the responses completing in the "
+      "meantime share the same write. Trades latency for fewer syscalls on "
+      "connections carrying many small responses. Disabled by default.",
+      {.example = "100", .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 1, .max = 10000})
   , kafka_enable_describe_log_dirs_remote_storage(
       *this,
       "kafka_enable_describe_log_dirs_remote_storage",
@@ -1623,6 +1961,16 @@ configuration::configuration()
       "metadata will be updated after each segment upload.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       60s)
+  , cloud_storage_manifest_max_deltas(
+      *this,
+      "cloud_storage_manifest_max_deltas",
+      "Maximum number of deltas uploaded after a full partition manifest "
+      "before the manifest is uploaded in full again. A delta only contains "
+      "the segments added since the previous upload. Zero disables deltas. "
+      "Clusters reading the bucket, such as read replicas, need a non-zero "
+      "value to apply the deltas.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , cloud_storage_readreplica_manifest_sync_timeout_ms(
       *this,
       "cloud_storage_readreplica_manifest_sync_timeout_ms",
@@ -1630,12 +1978,33 @@ configuration::configuration()
       "replica",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30s)
+  , cloud_storage_readreplica_manifest_sync_max_interval_ms(
+      *this,
+      "cloud_storage_readreplica_manifest_sync_max_interval_ms",
+      "Longest interval between two checks for new data of a read replica "
+      "partition. The interval doubles, from "
+      "cloud_storage_readreplica_manifest_sync_timeout_ms up to this value, "
+      "every time a check finds no new data, and drops back once new data "
+      "shows up. If not set, the partition is always checked every "
+      "cloud_storage_readreplica_manifest_sync_timeout_ms",
+      {.needs_restart = needs_restart::no,
+       .example = "300000",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , cloud_storage_metadata_sync_timeout_ms(
       *this,
       "cloud_storage_metadata_sync_timeout_ms",
       "Timeout for SI metadata synchronization",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10s)
+  , cloud_storage_metadata_coalescing_interval_ms(
+      *this,
+      "cloud_storage_metadata_coalescing_interval_ms",
+      "Maximum time for which retention and garbage collection updates of "
+      "the archival metadata are held back to be replicated together with "
+      "other updates of the same partition. Zero replicates them right away.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , cloud_storage_housekeeping_interval_ms(
       *this,
       "cloud_storage_housekeeping_interval_ms",
@@ -1671,6 +2040,14 @@ configuration::configuration()
       "smaller snapshots are uploaded.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1000)
+  , cloud_storage_cluster_metadata_max_offsets_deltas(
+      *this,
+      "cloud_storage_cluster_metadata_max_offsets_deltas",
+      "Number of consumer offsets uploads that only contain the offsets that "
+      "changed since the previous upload, before the offsets are consolidated "
+      "in a full snapshot again. Setting 0 uploads a full snapshot every time.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      10)
   , cloud_storage_cluster_metadata_retries(
       *this,
       "cloud_storage_cluster_metadata_retries",
@@ -1740,6 +2117,18 @@ configuration::configuration()
       "Jitter applied to the cloud storage scrubbing interval.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10min)
+  , cloud_storage_scrubbing_segment_sample_percent(
+      *this,
+      "cloud_storage_scrubbing_segment_sample_percent",
+      "Percentage of the segments whose existence in the bucket is checked "
+      "by a scrub. The metadata of every segment is always checked. Lower "
+      "values reduce the number of requests a scrub issues, missing segments "
+      "are then found by one of the following scrubs.",
+      {.needs_restart = needs_restart::no,
+       .example = "10",
+       .visibility = visibility::tunable},
+      100,
+      {.min = 1, .max = 100})
   , cloud_storage_disable_upload_loop_for_tests(
       *this,
       "cloud_storage_disable_upload_loop_for_tests",
@@ -1778,6 +2167,17 @@ configuration::configuration()
       "orphaned in the cloud and will have to be removed manually",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       5000)
+  , cloud_storage_max_concurrent_uploads_per_partition(
+      *this,
+      "cloud_storage_max_concurrent_uploads_per_partition",
+      "Maximum number of segments of a partition that are uploaded to the "
+      "cloud storage in parallel. The segments uploaded together are added to "
+      "the partition manifest in offset order by one metadata update, so a "
+      "larger window lets a partition that fell behind catch up in fewer "
+      "round trips.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 64})
   , cloud_storage_enable_compacted_topic_reupload(
       *this,
       "cloud_storage_enable_compacted_topic_reupload",
@@ -1790,6 +2190,13 @@ configuration::configuration()
       "Retention in bytes for topics created during automated recovery",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1_GiB)
+  , cloud_storage_recovery_manifest_concurrency(
+      *this,
+      "cloud_storage_recovery_manifest_concurrency",
+      "Number of topic manifests downloaded in parallel by topic recovery",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16,
+      {.min = 1, .max = 256})
   , cloud_storage_segment_size_target(
       *this,
       "cloud_storage_segment_size_target",
@@ -1803,6 +2210,47 @@ configuration::configuration()
       "cloud_storage_segment_size_target/2",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::nullopt)
+  , cloud_storage_multipart_upload_part_size(
+      *this,
+      "cloud_storage_multipart_upload_part_size",
+      "Segments larger than this are uploaded to the cloud storage as "
+      "multipart uploads with parts of this size, read directly from the "
+      "segment file. Parts are uploaded in parallel and retried individually. "
+      "If not set, every segment is uploaded with a single request.",
+      {.needs_restart = needs_restart::no,
+       .example = "67108864",
+       .visibility = visibility::tunable},
+      std::nullopt,
+      // the smallest part size accepted by S3
+      {.min = 5_MiB})
+  , cloud_storage_multipart_upload_concurrency(
+      *this,
+      "cloud_storage_multipart_upload_concurrency",
+      "Number of parts of a multipart segment upload that are uploaded in "
+      "parallel",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 64})
+  , cloud_storage_upload_buffer_memory_per_shard(
+      *this,
+      "cloud_storage_upload_buffer_memory_per_shard",
+      "Maximum number of bytes that may be used on each shard to keep a copy "
+      "of the data appended to the partitions it leads with tiered storage "
+      "enabled, so that their segments are uploaded from memory instead of "
+      "being read back from disk. Zero disables the upload buffers.",
+      {.needs_restart = needs_restart::no,
+       .example = "268435456",
+       .visibility = visibility::tunable},
+      0)
+  , cloud_storage_embed_segment_index(
+      *this,
+      "cloud_storage_embed_segment_index",
+      "Append the index of the segments uploaded to the object storage to "
+      "the segment object instead of uploading it as an object of its own, "
+      "so that reading a segment takes one request less. Segments uploaded "
+      "this way can only be read by this version of Redpanda or later.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , cloud_storage_max_throughput_per_shard(
       *this,
       "cloud_storage_max_throughput_per_shard",
@@ -1831,6 +2279,32 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       50,
       {.min = 0, .max = 100})
+  , cloud_storage_max_partition_uploads_per_shard(
+      *this,
+      "cloud_storage_max_partition_uploads_per_shard",
+      "Max number of partitions that upload segments to the cloud storage "
+      "concurrently on each shard. Partitions waiting for their turn are "
+      "served in order of their upload lag, the one that did not upload for "
+      "the longest time goes first. If null, the number of concurrently "
+      "uploading partitions is not limited.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , cloud_storage_max_upload_throughput_per_shard(
+      *this,
+      "cloud_storage_max_upload_throughput_per_shard",
+      "Max throughput of segment uploads to the cloud storage per shard in "
+      "bytes per second. If null, segment uploads are not throttled.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , cloud_storage_segment_key_filter_max_keys(
+      *this,
+      "cloud_storage_segment_key_filter_max_keys",
+      "If set, a Bloom filter of the record keys is uploaded next to the "
+      "index of every segment with at most this many records. Key lookups "
+      "use the filters to skip segments which can't contain the key. If "
+      "null, no filters are uploaded.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , cloud_storage_graceful_transfer_timeout_ms(
       *this,
       "cloud_storage_graceful_transfer_timeout_ms",
@@ -2013,6 +2487,14 @@ configuration::configuration()
       "maximum number of IO and CPU shares that archival upload can use",
       {.visibility = visibility::tunable},
       1000)
+  , cloud_storage_upload_ctrl_priority(
+      *this,
+      "cloud_storage_upload_ctrl_priority",
+      "Weight of the archival upload controller when the shares of "
+      "backlog_ctrl_shares_budget are shared out between the backlog "
+      "controllers",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      2)
   , retention_local_target_bytes_default(
       *this,
       "retention_local_target_bytes_default",
@@ -2157,6 +2639,16 @@ configuration::configuration()
       "joining partition replica set",
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       std::nullopt)
+  , initial_retention_use_local_target(
+      *this,
+      "initial_retention_use_local_target",
+      "When no initial local retention target is configured, the learners "
+      "joining the replica set of a partition of a topic with cloud storage "
+      "write enabled start their log at the local retention target of the "
+      "partition instead of receiving all locally retained data. The data "
+      "below the start offset is already in the cloud storage",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      false)
   , cloud_storage_cache_size(
       *this,
       "cloud_storage_cache_size",
@@ -2218,6 +2710,18 @@ configuration::configuration()
       {.needs_restart = needs_restart::no,
        .visibility = visibility::deprecated},
       std::nullopt)
+  , cloud_storage_fair_readers_per_shard(
+      *this,
+      "cloud_storage_fair_readers_per_shard",
+      "Number of remote partition readers a shard admits concurrently. When "
+      "the readers are at the limit, a released slot goes to the waiting "
+      "client that holds the fewest slots, so that a consumer scanning many "
+      "partitions doesn't starve the others. Half of the slots are reserved "
+      "for reads of the last uploaded segment of a partition, the other half "
+      "for historical reads. If unset, partition readers are only limited by "
+      "the memory of the tiered storage read path.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , cloud_storage_max_concurrent_hydrations_per_shard(
       *this,
       "cloud_storage_max_concurrent_hydrations_per_shard",
@@ -2251,6 +2755,23 @@ configuration::configuration()
       "space usage by only downloading the necessary chunk from a segment.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       16_MiB)
+  , cloud_storage_cache_slabs_per_shard(
+      *this,
+      "cloud_storage_cache_slabs_per_shard",
+      "Number of slab files of each shard in which segment chunks are stored "
+      "in the tiered storage cache, instead of a file per chunk. The slabs "
+      "are preallocated and count towards the size of the cache. Chunks that "
+      "don't fit in the slabs are stored as files. 0 disables the slabs.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_cache_slab_size(
+      *this,
+      "cloud_storage_cache_slab_size",
+      "Size of the slab files of the tiered storage cache, see "
+      "`cloud_storage_cache_slabs_per_shard`. The least recently read slab is "
+      "evicted as a whole when the slabs of a shard are full.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      256_MiB)
   , cloud_storage_hydrated_chunks_per_segment_ratio(
       *this,
       "cloud_storage_hydrated_chunks_per_segment_ratio",
@@ -2290,6 +2811,28 @@ configuration::configuration()
       "Number of chunks to prefetch ahead of every downloaded chunk",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       0)
+  , cloud_storage_chunk_read_ahead(
+      *this,
+      "cloud_storage_chunk_read_ahead",
+      "Maximum number of chunks a chunked segment reader hydrates in parallel "
+      "ahead of the chunk it is reading. The read-ahead window starts at one "
+      "chunk and doubles every time the reader catches up with it. When "
+      "non-zero, readers download one chunk per request and "
+      "cloud_storage_chunk_prefetch is not used. 0 disables read-ahead.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_stream_read_buffer_size(
+      *this,
+      "cloud_storage_stream_read_buffer_size",
+      "Size in bytes of the in-memory buffer of a read which streams segment "
+      "data from object storage without writing it to the cache. Such reads "
+      "are used for data that is not cached when the cache is blocking new "
+      "downloads for lack of disk space, or when a sequential scan reads a "
+      "segment from its beginning. 0 disables these streaming reads; time "
+      "queries on data that is not cached always stream the batch they "
+      "look up.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , superusers(
       *this,
       "superusers",
@@ -2356,12 +2899,46 @@ configuration::configuration()
       "Update frequency for kafka queue depth control.",
       {.visibility = visibility::tunable},
       7s)
+  , kafka_admission_control_target_latency_ms(
+      *this,
+      "kafka_admission_control_target_latency_ms",
+      "Target for the average end-to-end latency of the produce requests of "
+      "a shard. Above it, the requests of the APIs in "
+      "kafka_admission_control_api_keys are delayed and throttled, so that "
+      "an overloaded broker sheds the low priority work before it runs out "
+      "of memory. Admission control is disabled if unset.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      std::nullopt)
+  , kafka_admission_control_max_delay_ms(
+      *this,
+      "kafka_admission_control_max_delay_ms",
+      "Delay of the throttled requests when the produce latency is twice "
+      "kafka_admission_control_target_latency_ms or more. Below that the "
+      "delay is proportional to the excess latency.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1s)
+  , kafka_admission_control_api_keys(
+      *this,
+      "kafka_admission_control_api_keys",
+      "List of Kafka API keys of low priority, which are throttled when the "
+      "produce latency is above kafka_admission_control_target_latency_ms",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      {"fetch", "list_offsets"})
   , zstd_decompress_workspace_bytes(
       *this,
       "zstd_decompress_workspace_bytes",
       "Size of the zstd decompression workspace",
       {.visibility = visibility::tunable},
       8_MiB)
+  , compression_offload_min_bytes(
+      *this,
+      "compression_offload_min_bytes",
+      "When set, gzip, lz4 and snappy batches of at least this size are "
+      "compressed and decompressed on a background thread instead of the "
+      "reactor during compaction and data transforms. zstd is never "
+      "offloaded.",
+      {.visibility = visibility::tunable},
+      std::nullopt)
   , full_raft_configuration_recovery_pattern(
       *this,
       "full_raft_configuration_recovery_pattern",
@@ -2424,6 +3001,14 @@ configuration::configuration()
       "Number of partitions that can be reassigned at once",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       50)
+  , partition_autobalancing_concurrent_moves_per_node(
+      *this,
+      "partition_autobalancing_concurrent_moves_per_node",
+      "Number of partition reassignments that can be in progress towards a "
+      "single node at once, so that the moves of a drain are spread across "
+      "the nodes. 0 means no limit.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      10)
   , partition_autobalancing_tick_moves_drop_threshold(
       *this,
       "partition_autobalancing_tick_moves_drop_threshold",
@@ -2486,6 +3071,14 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512,
       {.min = 1, .max = 2048})
+  , maintenance_mode_transfer_limit_per_node(
+      *this,
+      "maintenance_mode_transfer_limit_per_node",
+      "Per shard limit for in progress leadership transfers away from a node "
+      "in maintenance mode, for each node the leadership can move to",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16,
+      {.min = 1, .max = 512})
   , internal_topic_replication_factor(
       *this,
       "internal_topic_replication_factor",
@@ -2762,6 +3355,23 @@ configuration::configuration()
       [](auto& v) {
           return validate_throughput_control_groups(v.cbegin(), v.cend());
       })
+  , kafka_tenant_groups(
+      *this,
+      "kafka_tenant_groups",
+      "List of kafka tenants which are isolated from the others. The produce "
+      "and fetch requests of a tenant run in a scheduling group and read "
+      "with an I/O priority class of its own, with the given shares out of "
+      "1000 for the shared ones. A tenant is set as "
+      "'principal:<name>=<shares>' or 'topic:<prefix>=<shares>', a request "
+      "is assigned the first matching tenant. At most 2 tenants are "
+      "supported.",
+      {
+        .needs_restart = needs_restart::no,
+        .example = R"(['principal:etl=200', 'topic:backfill-=100'])",
+        .visibility = visibility::user,
+      },
+      {},
+      validate_kafka_tenant_groups)
   , node_isolation_heartbeat_timeout(
       *this,
       "node_isolation_heartbeat_timeout",
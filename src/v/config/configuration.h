@@ -13,6 +13,7 @@
 #include "config/bounded_property.h"
 #include "config/broker_endpoint.h"
 #include "config/client_group_byte_rate_quota.h"
+#include "config/fetch_record_filter.h"
 #include "config/config_store.h"
 #include "config/convert.h"
 #include "config/data_directory_path.h"
@@ -51,6 +52,7 @@ struct configuration final : public config_store {
     bounded_property<uint16_t> log_segment_size_jitter_percent;
     bounded_property<uint64_t> compacted_log_segment_size;
     property<std::chrono::milliseconds> readers_cache_eviction_timeout_ms;
+    property<size_t> readers_cache_memory_budget;
     bounded_property<std::optional<std::chrono::milliseconds>> log_segment_ms;
     property<std::chrono::milliseconds> log_segment_ms_min;
     property<std::chrono::milliseconds> log_segment_ms_max;
@@ -59,7 +61,9 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> rpc_server_listen_backlog;
     bounded_property<std::optional<int>> rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> rpc_server_tcp_send_buf;
+    bounded_property<std::optional<uint32_t>> rpc_server_output_cork_us;
     bounded_property<int> rpc_client_connections_per_peer;
+    bounded_property<std::optional<size_t>> rpc_client_max_inflight_write_bytes;
     // Coproc
     deprecated_property enable_coproc;
     deprecated_property coproc_max_inflight_bytes;
@@ -70,6 +74,9 @@ struct configuration final : public config_store {
     // Data Transforms
     property<bool> data_transforms_enabled;
     property<std::chrono::milliseconds> data_transforms_commit_interval_ms;
+    property<std::chrono::milliseconds> data_transforms_write_linger_ms;
+    bounded_property<size_t> data_transforms_write_max_batch_bytes;
+    bounded_property<size_t> data_transforms_buffer_memory_per_partition;
     bounded_property<size_t> data_transforms_per_core_memory_reservation;
     bounded_property<size_t> data_transforms_per_function_memory_limit;
 
@@ -91,8 +98,12 @@ struct configuration final : public config_store {
     deprecated_property max_version;
     bounded_property<std::optional<size_t>> raft_max_recovery_memory;
     bounded_property<size_t> raft_recovery_default_read_size;
+    bounded_property<size_t> raft_recovery_snapshot_chunk_size;
     property<bool> raft_enable_lw_heartbeat;
+    property<bool> raft_enable_idle_group_hibernation;
     bounded_property<size_t> raft_recovery_concurrency_per_shard;
+    property<std::optional<size_t>> raft_recovery_batch_max_bytes;
+    property<bool> raft_enable_vote_batching;
     property<std::optional<size_t>> raft_replica_max_pending_flush_bytes;
     property<std::chrono::milliseconds> raft_flush_timer_interval_ms;
     // Kafka
@@ -119,6 +130,10 @@ struct configuration final : public config_store {
     property<std::optional<std::chrono::seconds>> group_offset_retention_sec;
     property<std::chrono::milliseconds> group_offset_retention_check_ms;
     property<bool> legacy_group_offset_retention_enabled;
+    property<std::optional<std::chrono::milliseconds>>
+      group_offset_commit_coalesce_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      group_recovery_checkpoint_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_retry_delay_ms;
     property<int16_t> metadata_dissemination_retries;
@@ -183,6 +198,8 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> replicate_append_timeout_ms;
     property<std::chrono::milliseconds> recovery_append_timeout_ms;
     property<size_t> raft_replicate_batch_window_size;
+    property<bool> raft_replicate_batch_adaptive_window;
+    property<std::chrono::milliseconds> raft_replicate_batch_max_delay_ms;
     property<size_t> raft_learner_recovery_rate;
     property<bool> raft_recovery_throttle_disable_dynamic_mode;
     property<std::optional<uint32_t>> raft_smp_max_non_local_requests;
@@ -193,12 +210,18 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> reclaim_growth_window;
     property<std::chrono::milliseconds> reclaim_stable_window;
     property<size_t> reclaim_batch_cache_min_free;
+    property<bool> batch_cache_admission_filter;
     property<bool> auto_create_topics_enabled;
     property<bool> enable_pid_file;
     property<std::chrono::milliseconds> kvstore_flush_interval;
     property<size_t> kvstore_max_segment_size;
     property<std::chrono::milliseconds> max_kafka_throttle_delay_ms;
     property<size_t> kafka_max_bytes_per_fetch;
+    property<bool> kafka_fetch_zero_copy;
+    property<bool> kafka_fetch_coalesce_reads;
+    property<std::vector<fetch_record_filter>> kafka_fetch_record_filters;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_follower_fetch_lease_ms;
     property<std::chrono::milliseconds> raft_io_timeout_ms;
     property<std::chrono::milliseconds> join_retry_timeout_ms;
     property<std::chrono::milliseconds> raft_timeout_now_timeout_ms;
@@ -206,17 +229,28 @@ struct configuration final : public config_store {
       raft_transfer_leader_recovery_timeout_ms;
     property<bool> release_cache_on_segment_roll;
     property<std::chrono::milliseconds> segment_appender_flush_timeout_ms;
+    property<std::chrono::milliseconds> storage_flush_coalescing_window_ms;
     property<std::chrono::milliseconds> fetch_session_eviction_timeout_ms;
     bounded_property<size_t> append_chunk_size;
+    bounded_property<size_t> append_large_chunk_size;
+    property<size_t> storage_max_inflight_dma_writes;
     property<size_t> storage_read_buffer_size;
     property<int16_t> storage_read_readahead_count;
+    property<size_t> storage_read_page_cache_size;
+    property<size_t> storage_read_readahead_budget;
+    property<bool> storage_read_coalescing;
     property<size_t> segment_fallocation_step;
     bounded_property<uint64_t> storage_target_replay_bytes;
     bounded_property<uint64_t> storage_max_concurrent_replay;
+    property<std::optional<size_t>> storage_max_loaded_segment_indices;
+    property<size_t> storage_segment_file_pool_size;
     bounded_property<uint64_t> storage_compaction_index_memory;
+    property<bool> storage_compaction_index_fingerprint_keys;
+    property<bool> storage_index_zone_maps;
     bounded_property<uint64_t> storage_compaction_key_map_memory;
     bounded_property<double, numeric_bounds>
       storage_compaction_key_map_memory_limit_percent;
+    bounded_property<uint16_t> storage_compaction_max_concurrent_partitions;
     property<size_t> max_compacted_log_segment_size;
     property<std::optional<std::chrono::seconds>>
       storage_ignore_timestamps_in_future_sec;
@@ -226,6 +260,7 @@ struct configuration final : public config_store {
     deprecated_property tx_registry_log_capacity;
     property<int16_t> id_allocator_log_capacity;
     property<int16_t> id_allocator_batch_size;
+    property<int16_t> id_allocator_lease_size;
     property<bool> enable_sasl;
     property<std::vector<ss::sstring>> sasl_mechanisms;
     property<ss::sstring> sasl_kerberos_config;
@@ -254,6 +289,11 @@ struct configuration final : public config_store {
     property<int16_t> compaction_ctrl_min_shares;
     property<int16_t> compaction_ctrl_max_shares;
     property<std::optional<size_t>> compaction_ctrl_backlog_size;
+    property<int16_t> compaction_ctrl_priority;
+    // Shard budget of the backlog controllers
+    property<std::optional<int32_t>> backlog_ctrl_shares_budget;
+    property<std::optional<std::chrono::milliseconds>>
+      backlog_ctrl_latency_target_ms;
     property<std::chrono::milliseconds> members_backend_retry_ms;
     property<std::optional<uint32_t>> kafka_connections_max;
     property<std::optional<uint32_t>> kafka_connections_max_per_ip;
@@ -265,6 +305,7 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_send_buf;
     bounded_property<std::optional<size_t>> kafka_rpc_server_stream_recv_buf;
+    bounded_property<std::optional<uint32_t>> kafka_rpc_server_output_cork_us;
     property<bool> kafka_enable_describe_log_dirs_remote_storage;
 
     // Audit logging
@@ -312,9 +353,14 @@ struct configuration final : public config_store {
       cloud_storage_segment_max_upload_interval_sec;
     property<std::optional<std::chrono::seconds>>
       cloud_storage_manifest_max_upload_interval_sec;
+    property<size_t> cloud_storage_manifest_max_deltas;
     property<std::chrono::milliseconds>
       cloud_storage_readreplica_manifest_sync_timeout_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      cloud_storage_readreplica_manifest_sync_max_interval_ms;
     property<std::chrono::milliseconds> cloud_storage_metadata_sync_timeout_ms;
+    property<std::chrono::milliseconds>
+      cloud_storage_metadata_coalescing_interval_ms;
     property<std::chrono::milliseconds> cloud_storage_housekeeping_interval_ms;
     property<std::chrono::milliseconds> cloud_storage_idle_timeout_ms;
     property<std::chrono::milliseconds>
@@ -323,6 +369,7 @@ struct configuration final : public config_store {
       cloud_storage_cluster_metadata_upload_timeout_ms;
     property<size_t>
       cloud_storage_cluster_metadata_num_consumer_groups_per_upload;
+    property<size_t> cloud_storage_cluster_metadata_max_offsets_deltas;
     property<int16_t> cloud_storage_cluster_metadata_retries;
     property<bool> cloud_storage_attempt_cluster_restore_on_bootstrap;
     property<double> cloud_storage_idle_threshold_rps;
@@ -333,18 +380,32 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> cloud_storage_full_scrub_interval_ms;
     property<std::chrono::milliseconds>
       cloud_storage_scrubbing_interval_jitter_ms;
+    bounded_property<uint16_t> cloud_storage_scrubbing_segment_sample_percent;
     property<bool> cloud_storage_disable_upload_loop_for_tests;
     property<bool> cloud_storage_disable_read_replica_loop_for_tests;
     property<bool> disable_cluster_recovery_loop_for_tests;
     property<bool> enable_cluster_metadata_upload_loop;
     property<size_t> cloud_storage_max_segments_pending_deletion_per_partition;
+    bounded_property<uint16_t>
+      cloud_storage_max_concurrent_uploads_per_partition;
     property<bool> cloud_storage_enable_compacted_topic_reupload;
     property<size_t> cloud_storage_recovery_temporary_retention_bytes_default;
+    bounded_property<uint16_t> cloud_storage_recovery_manifest_concurrency;
     property<std::optional<size_t>> cloud_storage_segment_size_target;
     property<std::optional<size_t>> cloud_storage_segment_size_min;
+    bounded_property<std::optional<size_t>>
+      cloud_storage_multipart_upload_part_size;
+    bounded_property<uint16_t> cloud_storage_multipart_upload_concurrency;
+    property<size_t> cloud_storage_upload_buffer_memory_per_shard;
+    property<bool> cloud_storage_embed_segment_index;
     property<std::optional<size_t>> cloud_storage_max_throughput_per_shard;
     bounded_property<std::optional<size_t>>
       cloud_storage_throughput_limit_percent;
+    property<std::optional<size_t>>
+      cloud_storage_max_partition_uploads_per_shard;
+    property<std::optional<size_t>>
+      cloud_storage_max_upload_throughput_per_shard;
+    property<std::optional<size_t>> cloud_storage_segment_key_filter_max_keys;
     property<std::optional<std::chrono::milliseconds>>
       cloud_storage_graceful_transfer_timeout_ms;
     enum_property<model::cloud_storage_backend> cloud_storage_backend;
@@ -375,6 +436,7 @@ struct configuration final : public config_store {
     property<double> cloud_storage_upload_ctrl_d_coeff;
     property<int16_t> cloud_storage_upload_ctrl_min_shares;
     property<int16_t> cloud_storage_upload_ctrl_max_shares;
+    property<int16_t> cloud_storage_upload_ctrl_priority;
 
     // Defaults for local retention for partitions of topics with
     // cloud storage read and write enabled
@@ -396,6 +458,7 @@ struct configuration final : public config_store {
       initial_retention_local_target_bytes_default;
     property<std::optional<std::chrono::milliseconds>>
       initial_retention_local_target_ms_default;
+    property<bool> initial_retention_use_local_target;
 
     // Archival cache
     property<uint64_t> cloud_storage_cache_size;
@@ -407,17 +470,22 @@ struct configuration final : public config_store {
       cloud_storage_max_segment_readers_per_shard;
     property<std::optional<uint32_t>>
       cloud_storage_max_partition_readers_per_shard;
+    property<std::optional<uint32_t>> cloud_storage_fair_readers_per_shard;
     property<std::optional<uint32_t>>
       cloud_storage_max_concurrent_hydrations_per_shard;
     property<std::optional<uint32_t>>
       cloud_storage_max_materialized_segments_per_shard;
     property<uint64_t> cloud_storage_cache_chunk_size;
+    property<uint32_t> cloud_storage_cache_slabs_per_shard;
+    property<uint64_t> cloud_storage_cache_slab_size;
     property<double> cloud_storage_hydrated_chunks_per_segment_ratio;
     property<uint64_t> cloud_storage_min_chunks_per_segment_threshold;
     property<bool> cloud_storage_disable_chunk_reads;
     enum_property<model::cloud_storage_chunk_eviction_strategy>
       cloud_storage_chunk_eviction_strategy;
     property<uint16_t> cloud_storage_chunk_prefetch;
+    property<uint16_t> cloud_storage_chunk_read_ahead;
+    property<uint64_t> cloud_storage_stream_read_buffer_size;
 
     one_or_many_property<ss::sstring> superusers;
 
@@ -434,7 +502,13 @@ struct configuration final : public config_store {
     property<size_t> kafka_qdc_min_depth;
     property<size_t> kafka_qdc_max_depth;
     property<std::chrono::milliseconds> kafka_qdc_depth_update_ms;
+    // latency driven admission control
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_admission_control_target_latency_ms;
+    property<std::chrono::milliseconds> kafka_admission_control_max_delay_ms;
+    property<std::vector<ss::sstring>> kafka_admission_control_api_keys;
     property<size_t> zstd_decompress_workspace_bytes;
+    property<std::optional<size_t>> compression_offload_min_bytes;
     one_or_many_property<ss::sstring> full_raft_configuration_recovery_pattern;
     property<bool> enable_auto_rebalance_on_node_add;
 
@@ -447,6 +521,7 @@ struct configuration final : public config_store {
       partition_autobalancing_tick_interval_ms;
     property<size_t> partition_autobalancing_movement_batch_size_bytes;
     property<size_t> partition_autobalancing_concurrent_moves;
+    property<size_t> partition_autobalancing_concurrent_moves_per_node;
     property<double> partition_autobalancing_tick_moves_drop_threshold;
     property<std::optional<size_t>> partition_autobalancing_min_size_threshold;
 
@@ -456,6 +531,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> leader_balancer_mute_timeout;
     property<std::chrono::milliseconds> leader_balancer_node_mute_timeout;
     bounded_property<size_t> leader_balancer_transfer_limit_per_shard;
+    bounded_property<size_t> maintenance_mode_transfer_limit_per_node;
     property<int> internal_topic_replication_factor;
     property<std::chrono::milliseconds> health_manager_tick_interval;
 
@@ -513,6 +589,7 @@ struct configuration final : public config_store {
     bounded_property<int64_t> kafka_quota_balancer_min_shard_throughput_bps;
     property<std::vector<ss::sstring>> kafka_throughput_controlled_api_keys;
     property<std::vector<throughput_control_group>> kafka_throughput_control;
+    property<std::vector<ss::sstring>> kafka_tenant_groups;
 
     bounded_property<int64_t> node_isolation_heartbeat_timeout;
 
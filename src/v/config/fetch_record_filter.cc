@@ -0,0 +1,144 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/fetch_record_filter.h"
+
+#include "utils/to_string.h"
+
+#include <algorithm>
+
+namespace config {
+
+ss::sstring fetch_record_filter::validate() const {
+    if (name.empty()) {
+        return "name is empty";
+    }
+    if (clients_prefix.empty()) {
+        return "clients_prefix is empty";
+    }
+    if (header_value && !header_key) {
+        return "header_value is set without header_key";
+    }
+    if (!header_key && !key_prefix) {
+        return "neither header_key nor key_prefix is set";
+    }
+    return {};
+}
+
+std::ostream& operator<<(std::ostream& os, const fetch_record_filter& f) {
+    fmt::print(
+      os,
+      "{{name: {}, clients_prefix: {}, header_key: {}, header_value: {}, "
+      "key_prefix: {}}}",
+      f.name,
+      f.clients_prefix,
+      f.header_key,
+      f.header_value,
+      f.key_prefix);
+    return os;
+}
+
+const fetch_record_filter* find_fetch_record_filter(
+  const std::vector<fetch_record_filter>& filters,
+  std::optional<std::string_view> client_id) {
+    auto it = std::find_if(
+      filters.begin(),
+      filters.end(),
+      [&client_id](const fetch_record_filter& f) {
+          return f.match_client_id(client_id);
+      });
+    return it == filters.end() ? nullptr : &*it;
+}
+
+std::optional<ss::sstring>
+validate_fetch_record_filters(const std::vector<fetch_record_filter>& filters) {
+    for (auto it = filters.begin(); it != filters.end(); ++it) {
+        if (auto err = it->validate(); !err.empty()) {
+            return ss::format("Invalid fetch record filter {}: {}", *it, err);
+        }
+        if (std::any_of(
+              filters.begin(), it, [it](const fetch_record_filter& f) {
+                  return f.name == it->name;
+              })) {
+            return ss::format(
+              "Duplicate fetch record filter name: {}", it->name);
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace config
+
+namespace YAML {
+
+Node convert<config::fetch_record_filter>::encode(const type& rhs) {
+    Node node;
+    node["name"] = rhs.name;
+    node["clients_prefix"] = rhs.clients_prefix;
+    if (rhs.header_key) {
+        node["header_key"] = *rhs.header_key;
+    }
+    if (rhs.header_value) {
+        node["header_value"] = *rhs.header_value;
+    }
+    if (rhs.key_prefix) {
+        node["key_prefix"] = *rhs.key_prefix;
+    }
+    return node;
+}
+
+bool convert<config::fetch_record_filter>::decode(
+  const Node& node, type& rhs) {
+    for (const auto& s : {"name", "clients_prefix"}) {
+        if (!node[s]) {
+            return false;
+        }
+    }
+    auto optional_string = [&node](const char* s) {
+        return node[s] && !node[s].IsNull()
+                 ? std::make_optional(node[s].as<ss::sstring>())
+                 : std::nullopt;
+    };
+    rhs = config::fetch_record_filter{
+      .name = node["name"].as<ss::sstring>(),
+      .clients_prefix = node["clients_prefix"].as<ss::sstring>(),
+      .header_key = optional_string("header_key"),
+      .header_value = optional_string("header_value"),
+      .key_prefix = optional_string("key_prefix")};
+    return true;
+}
+
+} // namespace YAML
+
+namespace json {
+
+void rjson_serialize(
+  json::Writer<json::StringBuffer>& w, const config::fetch_record_filter& f) {
+    auto optional_string = [&w](const std::optional<ss::sstring>& s) {
+        if (s) {
+            w.String(*s);
+        } else {
+            w.Null();
+        }
+    };
+    w.StartObject();
+    w.Key("name");
+    w.String(f.name);
+    w.Key("clients_prefix");
+    w.String(f.clients_prefix);
+    w.Key("header_key");
+    optional_string(f.header_key);
+    w.Key("header_value");
+    optional_string(f.header_value);
+    w.Key("key_prefix");
+    optional_string(f.key_prefix);
+    w.EndObject();
+}
+
+} // namespace json
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/convert.h"
+#include "config/property.h"
+#include "json/_include_first.h"
+#include "json/stringbuffer.h"
+#include "json/writer.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <yaml-cpp/node/node.h>
+
+#include <iosfwd>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace config {
+
+/**
+ * A filter applied by the broker to the records fetched by the clients whose
+ * client_id starts with clients_prefix. Only the records matching every
+ * criteria set are returned: a header with the key header_key, and the value
+ * header_value if set, and a key starting with key_prefix.
+ */
+struct fetch_record_filter {
+    ss::sstring name;
+    ss::sstring clients_prefix;
+    std::optional<ss::sstring> header_key;
+    std::optional<ss::sstring> header_value;
+    std::optional<ss::sstring> key_prefix;
+
+    bool match_client_id(std::optional<std::string_view> client_id) const {
+        return client_id && client_id->starts_with(clients_prefix);
+    }
+
+    /// Empty if the filter is valid, the reason it isn't otherwise.
+    ss::sstring validate() const;
+
+    friend bool
+    operator==(const fetch_record_filter&, const fetch_record_filter&)
+      = default;
+
+    friend std::ostream&
+    operator<<(std::ostream& os, const fetch_record_filter& f);
+};
+
+/// The filter of the fetches of \p client_id, the first one matching it.
+const fetch_record_filter* find_fetch_record_filter(
+  const std::vector<fetch_record_filter>& filters,
+  std::optional<std::string_view> client_id);
+
+std::optional<ss::sstring>
+validate_fetch_record_filters(const std::vector<fetch_record_filter>&);
+
+namespace detail {
+
+template<>
+consteval std::string_view property_type_name<fetch_record_filter>() {
+    return "config::fetch_record_filter";
+}
+
+} // namespace detail
+
+} // namespace config
+
+namespace YAML {
+template<>
+struct convert<config::fetch_record_filter> {
+    using type = config::fetch_record_filter;
+    static Node encode(const type& rhs);
+    static bool decode(const Node& node, type& rhs);
+};
+
+} // namespace YAML
+
+namespace json {
+
+void rjson_serialize(
+  json::Writer<json::StringBuffer>& w, const config::fetch_record_filter& f);
+
+} // namespace json
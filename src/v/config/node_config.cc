@@ -27,6 +27,15 @@ node_config::node_config() noexcept
       "data_directory",
       "Place where redpanda will keep the data",
       {.required = required::yes, .visibility = visibility::user})
+  , extra_data_directories(
+      *this,
+      "extra_data_directories",
+      "Additional directories, each on its own device, across which the "
+      "partition data is placed by free space and load. The data_directory "
+      "keeps the node state (e.g. the kvstore and the controller log) and "
+      "also holds partitions.",
+      {.visibility = visibility::user},
+      {})
   , node_id(
       *this,
       "node_id",
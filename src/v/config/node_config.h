@@ -26,6 +26,7 @@ struct node_config final : public config_store {
 public:
     property<bool> developer_mode;
     property<data_directory_path> data_directory;
+    property<std::vector<data_directory_path>> extra_data_directories;
 
     // NOTE: during the normal runtime of a cluster, it is safe to assume that
     // the value of the node ID has been determined, and that there is a value
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "config/tenant_group.h"
+
+#include <fmt/ostream.h>
+
+#include <charconv>
+#include <ostream>
+
+namespace config {
+
+std::optional<tenant_group> tenant_group::parse(std::string_view s) {
+    auto type_end = s.find(':');
+    auto match_end = s.rfind('=');
+    if (
+      type_end == std::string_view::npos || match_end == std::string_view::npos
+      || match_end <= type_end + 1) {
+        return std::nullopt;
+    }
+
+    tenant_group g;
+    auto type = s.substr(0, type_end);
+    if (type == "principal") {
+        g.type = match_type::principal;
+    } else if (type == "topic") {
+        g.type = match_type::topic_prefix;
+    } else {
+        return std::nullopt;
+    }
+    g.match = ss::sstring(s.substr(type_end + 1, match_end - type_end - 1));
+
+    auto shares = s.substr(match_end + 1);
+    auto [ptr, ec] = std::from_chars(
+      shares.data(), shares.data() + shares.size(), g.shares);
+    if (
+      ec != std::errc{} || ptr != shares.data() + shares.size()
+      || g.shares == 0 || g.shares > max_shares) {
+        return std::nullopt;
+    }
+    return g;
+}
+
+std::ostream& operator<<(std::ostream& o, const tenant_group& g) {
+    fmt::print(
+      o,
+      "{}:{}={}",
+      g.type == tenant_group::match_type::principal ? "principal" : "topic",
+      g.match,
+      g.shares);
+    return o;
+}
+
+} // namespace config
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string_view>
+
+namespace config {
+
+/**
+ * A tenant of the kafka API which gets its own scheduling group and I/O
+ * priority class, so that its load doesn't degrade the other tenants.
+ *
+ * Set as "principal:<name>=<shares>" to match the requests of a principal,
+ * or as "topic:<prefix>=<shares>" to match the requests for the topics
+ * with a name prefix.
+ */
+struct tenant_group {
+    // the tenant groups are created at startup, and the scheduling groups
+    // of a process are limited
+    static constexpr size_t max_groups = 2;
+    static constexpr uint32_t max_shares = 1000;
+
+    enum class match_type { principal, topic_prefix };
+
+    match_type type;
+    ss::sstring match;
+    uint32_t shares;
+
+    static std::optional<tenant_group> parse(std::string_view);
+
+    friend bool operator==(const tenant_group&, const tenant_group&)
+      = default;
+
+    friend std::ostream& operator<<(std::ostream&, const tenant_group&);
+};
+
+} // namespace config
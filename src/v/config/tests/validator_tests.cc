@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/tenant_group.h"
 #include "config/validators.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -100,3 +101,36 @@ SEASTAR_THREAD_TEST_CASE(test_audit_event_types) {
       "management", "consume", "hello world", "heartbeat"};
     BOOST_TEST(validate_audit_event_types(one_bad_apple).has_value());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_kafka_tenant_groups) {
+    auto etl = config::tenant_group::parse("principal:etl=200");
+    BOOST_REQUIRE(etl.has_value());
+    BOOST_TEST(etl->type == config::tenant_group::match_type::principal);
+    BOOST_TEST(etl->match == "etl");
+    BOOST_TEST(etl->shares == 200);
+
+    // the shares follow the last '='
+    auto backfill = config::tenant_group::parse("topic:a=b-=1000");
+    BOOST_REQUIRE(backfill.has_value());
+    BOOST_TEST(
+      backfill->type == config::tenant_group::match_type::topic_prefix);
+    BOOST_TEST(backfill->match == "a=b-");
+
+    BOOST_TEST(!config::validate_kafka_tenant_groups({}).has_value());
+    BOOST_TEST(!config::validate_kafka_tenant_groups(
+                  {"principal:etl=200", "topic:backfill-=100"})
+                  .has_value());
+    for (const auto& invalid : std::vector<ss::sstring>{
+           "principal:etl",
+           "principal:=100",
+           "group:etl=100",
+           "topic:backfill-=0",
+           "topic:backfill-=1001",
+           "topic:backfill-=10x"}) {
+        BOOST_TEST(
+          config::validate_kafka_tenant_groups({invalid}).has_value());
+    }
+    BOOST_TEST(config::validate_kafka_tenant_groups(
+                 {"topic:a=1", "topic:b=1", "topic:c=1"})
+                 .has_value());
+}
@@ -12,6 +12,7 @@
 #include "config/validators.h"
 
 #include "config/client_group_byte_rate_quota.h"
+#include "config/tenant_group.h"
 #include "model/namespace.h"
 #include "model/validation.h"
 #include "net/inet_address_wrapper.h"
@@ -125,6 +126,25 @@ validate_sasl_mechanisms(const std::vector<ss::sstring>& mechanisms) {
     return std::nullopt;
 }
 
+std::optional<ss::sstring>
+validate_kafka_tenant_groups(const std::vector<ss::sstring>& groups) {
+    if (groups.size() > tenant_group::max_groups) {
+        return ssx::sformat(
+          "At most {} tenant groups are supported", tenant_group::max_groups);
+    }
+    for (const auto& g : groups) {
+        if (!tenant_group::parse(g)) {
+            return ssx::sformat(
+              "'{}' is not a tenant group, expected "
+              "'principal:<name>=<shares>' or 'topic:<prefix>=<shares>' with "
+              "shares in [1, {}]",
+              g,
+              tenant_group::max_shares);
+        }
+    }
+    return std::nullopt;
+}
+
 std::optional<ss::sstring>
 validate_http_authn_mechanisms(const std::vector<ss::sstring>& mechanisms) {
     constexpr auto supported = std::to_array<std::string_view>(
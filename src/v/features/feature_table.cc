@@ -97,6 +97,16 @@ std::string_view to_string_view(feature f) {
         return "cloud_metadata_cluster_recovery";
     case feature::audit_logging:
         return "audit_logging";
+    case feature::lightweight_heartbeat_deltas:
+        return "lightweight_heartbeat_deltas";
+    case feature::raft_append_entries_batch:
+        return "raft_append_entries_batch";
+    case feature::tx_commit_batch:
+        return "tx_commit_batch";
+    case feature::raft_vote_batch:
+        return "raft_vote_batch";
+    case feature::cloud_storage_embedded_segment_index:
+        return "cloud_storage_embedded_segment_index";
 
     /*
      * testing features
@@ -73,6 +73,11 @@ enum class feature : std::uint64_t {
     disabling_partitions = 1ULL << 39U,
     cloud_metadata_cluster_recovery = 1ULL << 40U,
     audit_logging = 1ULL << 41U,
+    lightweight_heartbeat_deltas = 1ULL << 42U,
+    raft_append_entries_batch = 1ULL << 43U,
+    tx_commit_batch = 1ULL << 44U,
+    raft_vote_batch = 1ULL << 45U,
+    cloud_storage_embedded_segment_index = 1ULL << 46U,
 
     // Dummy features for testing only
     test_alpha = 1ULL << 61U,
@@ -363,6 +368,36 @@ constexpr static std::array feature_schema{
     "audit_logging",
     feature::audit_logging,
     feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "lightweight_heartbeat_deltas",
+    feature::lightweight_heartbeat_deltas,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "raft_append_entries_batch",
+    feature::raft_append_entries_batch,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "tx_commit_batch",
+    feature::tx_commit_batch,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "raft_vote_batch",
+    feature::raft_vote_batch,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "cloud_storage_embedded_segment_index",
+    feature::cloud_storage_embedded_segment_index,
+    feature_spec::available_policy::always,
     feature_spec::prepare_policy::always}};
 
 std::string_view to_string_view(feature);
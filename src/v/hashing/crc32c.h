@@ -14,6 +14,8 @@
 
 #include <crc32c/crc32c.h>
 
+#include <array>
+#include <cstring>
 #include <type_traits>
 
 namespace crc {
@@ -25,6 +27,20 @@ public:
         // NOLINTNEXTLINE
         extend(reinterpret_cast<const uint8_t*>(&num), sizeof(T));
     }
+    /**
+     * Equivalent to calling extend() on each integer in order, but the
+     * integers are packed into one buffer first so that the checksum is
+     * computed in a single pass. This matters for batch headers, which are
+     * made of a dozen small fields.
+     */
+    template<typename... T>
+    requires(std::is_integral_v<T> && ...)
+    void extend_all(T... nums) noexcept {
+        std::array<uint8_t, (sizeof(T) + ...)> buf;
+        auto* dst = buf.data();
+        ((std::memcpy(dst, &nums, sizeof(T)), dst += sizeof(T)), ...);
+        extend(buf.data(), buf.size());
+    }
     void extend(const uint8_t* data, size_t size) {
         _crc = ::crc32c::Extend(_crc, data, size);
     }
@@ -129,6 +129,45 @@ PERF_TEST(header_hash, crc32_fn) {
     });
 }
 
+PERF_TEST(header_hash, crc32c_per_field) {
+    return header_body([](auto& buffer) {
+        crc::crc32c crc;
+        crc.extend(static_cast<int32_t>(buffer.size()));
+        crc.extend(static_cast<int64_t>(buffer[0]));
+        crc.extend(static_cast<int8_t>(buffer[1]));
+        crc.extend(static_cast<int32_t>(buffer[2]));
+        crc.extend(static_cast<int16_t>(buffer[3]));
+        crc.extend(static_cast<int32_t>(buffer[4]));
+        crc.extend(static_cast<int64_t>(buffer[5]));
+        crc.extend(static_cast<int64_t>(buffer[6]));
+        crc.extend(static_cast<int64_t>(buffer[7]));
+        crc.extend(static_cast<int16_t>(buffer[8]));
+        crc.extend(static_cast<int32_t>(buffer[9]));
+        crc.extend(static_cast<int32_t>(buffer[10]));
+        return crc.value();
+    });
+}
+
+PERF_TEST(header_hash, crc32c_extend_all) {
+    return header_body([](auto& buffer) {
+        crc::crc32c crc;
+        crc.extend_all(
+          static_cast<int32_t>(buffer.size()),
+          static_cast<int64_t>(buffer[0]),
+          static_cast<int8_t>(buffer[1]),
+          static_cast<int32_t>(buffer[2]),
+          static_cast<int16_t>(buffer[3]),
+          static_cast<int32_t>(buffer[4]),
+          static_cast<int64_t>(buffer[5]),
+          static_cast<int64_t>(buffer[6]),
+          static_cast<int64_t>(buffer[7]),
+          static_cast<int16_t>(buffer[8]),
+          static_cast<int32_t>(buffer[9]),
+          static_cast<int32_t>(buffer[10]));
+        return crc.value();
+    });
+}
+
 PERF_TEST(header_hash, xx32_fn) {
     return header_body(
       [](auto& buffer) { return xxhash_32(buffer.data(), buffer.size()); });
@@ -140,6 +179,25 @@ PERF_TEST(header_hash, xx64_twang_fn) {
     });
 }
 
+template<size_t Size>
+static size_t crc32c_body() {
+    auto buffer = random_generators::gen_alphanum_string(Size);
+    perf_tests::start_measuring_time();
+    for (auto i = inner_iters; i--;) {
+        crc::crc32c crc;
+        crc.extend(buffer.data(), buffer.size());
+        perf_tests::do_not_optimize(crc.value());
+    }
+    perf_tests::stop_measuring_time();
+    return inner_iters * Size;
+}
+
+PERF_TEST(crc32c, record_1k) { return crc32c_body<1024>(); }
+
+PERF_TEST(crc32c, batch_16k) { return crc32c_body<16384>(); }
+
+PERF_TEST(crc32c, batch_1m) { return crc32c_body<1048576>(); }
+
 using model::ktp;
 using model::ktp_with_hash;
 using model::ntp;
@@ -348,6 +348,12 @@ ss::future<iobuf> client::response_stream::recv_some() {
           }
           auto out = _parser.get().body().consume();
           _buffer.trim_front(noctets);
+          if (_parser.is_done() && !_parser.keep_alive()) {
+              // The server closes the connection after the response, a next
+              // request has to reconnect.
+              vlog(_ctxlog.debug, "server doesn't keep the connection alive");
+              _client->shutdown();
+          }
           if (!_buffer.empty()) {
               vlog(
                 _ctxlog.trace,
@@ -564,6 +570,39 @@ struct request_data_sink final : ss::data_sink_impl {
     client::request_stream_ref _io;
 };
 
+/// Buffers of the request body are accumulated until at least this many
+/// bytes are available before they are sent
+static constexpr size_t body_send_min_size = 32_KiB;
+
+/// Send request body read from the input stream.
+///
+/// Unlike ss::copy to the output_stream of the request, the buffers produced
+/// by the input stream are not copied into the buffer of the output_stream.
+/// Files are read using DMA so the aligned file buffers become fragments of
+/// the iobuf written to the connection. Small buffers are linearized by
+/// iobuf::append to avoid sending tiny chunks.
+static ss::future<>
+send_body(client::request_stream_ref request, ss::input_stream<char>& input) {
+    iobuf pending;
+    bool sent = false;
+    while (true) {
+        auto buf = co_await input.read();
+        if (buf.empty()) {
+            break;
+        }
+        pending.append(std::move(buf));
+        if (pending.size_bytes() >= body_send_min_size) {
+            co_await request->send_some(std::exchange(pending, iobuf{}));
+            sent = true;
+        }
+    }
+    // the first call also sends the header
+    if (!sent || !pending.empty()) {
+        co_await request->send_some(std::move(pending));
+    }
+    co_await request->send_eof();
+}
+
 ss::future<client::response_stream_ref> client::request(
   client::request_header&& header,
   ss::input_stream<char>& input,
@@ -583,15 +622,7 @@ ss::future<client::response_stream_ref> client::request(
               fsend = request->send_some(iobuf()).then(
                 [request = request]() { return request->send_eof(); });
           } else {
-              // since the input stream has some data we can use
-              // output_stream interace of the request
-              fsend = ss::do_with(
-                request->as_output_stream(),
-                [&input](ss::output_stream<char>& output) {
-                    return ss::copy(input, output).finally([&output] {
-                        return output.close();
-                    });
-                });
+              fsend = send_body(request, input);
           }
           return fsend.then([response = response]() {
               return ss::make_ready_future<response_stream_ref>(response);
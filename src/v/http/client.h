@@ -80,9 +80,14 @@ public:
       ss::lowres_clock::duration max_idle_time = {});
 
     ss::future<> stop();
+    using net::base_transport::is_valid;
     using net::base_transport::shutdown;
     using net::base_transport::wait_input_shutdown;
 
+    /// Abort source checked by the requests, used when a client is handed
+    /// over to a new owner
+    void set_abort_source(const ss::abort_source* as) { _as = as; }
+
     /// Return immediately if connected or make connection attempts
     /// until success, timeout or error
     ss::future<reconnect_result_t>
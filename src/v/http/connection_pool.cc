@@ -0,0 +1,152 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "http/connection_pool.h"
+
+#include "http/logger.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <boost/beast/http/error.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <cerrno>
+#include <system_error>
+
+namespace http {
+
+connection_pool::endpoint::endpoint(
+  const net::base_transport::configuration& cfg)
+  : address(cfg.server_addr)
+  , tls_sni_hostname(cfg.tls_sni_hostname)
+  , credentials(cfg.credentials.get()) {}
+
+connection_pool::connection_pool(
+  ss::lowres_clock::duration max_idle_time, size_t max_idle_per_endpoint)
+  : _max_idle_time(max_idle_time)
+  , _max_idle_per_endpoint(max_idle_per_endpoint) {
+    _evict_timer.set_callback([this] { evict_idle(); });
+}
+
+connection_pool& connection_pool::local() {
+    static thread_local connection_pool pool(
+      default_max_idle_time, default_max_idle_per_endpoint);
+    return pool;
+}
+
+client connection_pool::acquire(
+  const net::base_transport::configuration& cfg, const ss::abort_source* as) {
+    if (auto it = _idle.find(endpoint{cfg}); it != _idle.end()) {
+        // The most recently used client is the least likely to have been
+        // closed by the server.
+        auto c = std::move(it->second.back().c);
+        it->second.pop_back();
+        if (it->second.empty()) {
+            _idle.erase(it);
+        }
+        vlog(http_log.trace, "reusing connection to {}", cfg.server_addr);
+        c.set_abort_source(as);
+        return c;
+    }
+    return connect(cfg, as);
+}
+
+client connection_pool::connect(
+  const net::base_transport::configuration& cfg, const ss::abort_source* as) {
+    return client(cfg, as, nullptr, _max_idle_time);
+}
+
+void connection_pool::release(
+  const net::base_transport::configuration& cfg, client c) {
+    c.set_abort_source(nullptr);
+    if (_gate.is_closed() || !c.is_valid()) {
+        close(std::move(c));
+        return;
+    }
+    auto& clients = _idle[endpoint{cfg}];
+    if (clients.size() >= _max_idle_per_endpoint) {
+        close(std::move(clients.front().c));
+        clients.pop_front();
+    }
+    clients.push_back(
+      idle_client{.c = std::move(c), .since = ss::lowres_clock::now()});
+    if (!_evict_timer.armed()) {
+        _evict_timer.arm(_max_idle_time);
+    }
+}
+
+void connection_pool::evict_idle() {
+    const auto deadline = ss::lowres_clock::now() - _max_idle_time;
+    for (auto it = _idle.begin(); it != _idle.end();) {
+        auto& clients = it->second;
+        while (!clients.empty() && clients.front().since <= deadline) {
+            close(std::move(clients.front().c));
+            clients.pop_front();
+        }
+        if (clients.empty()) {
+            _idle.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    if (!_idle.empty()) {
+        _evict_timer.arm(_max_idle_time);
+    }
+}
+
+void connection_pool::close(client c) {
+    if (_gate.is_closed()) {
+        // The pool is stopping, the client is stopped before the gate closes
+        // or dropped with the pool.
+        c.shutdown();
+        return;
+    }
+    ssx::spawn_with_gate(_gate, [c = std::move(c)]() mutable {
+        return ss::do_with(std::move(c), [](client& c) {
+            return c.stop().then([&c] { c.shutdown(); });
+        });
+    });
+}
+
+ss::future<> connection_pool::stop() {
+    _evict_timer.cancel();
+    for (auto& [_, clients] : _idle) {
+        for (auto& ic : clients) {
+            close(std::move(ic.c));
+        }
+    }
+    _idle.clear();
+    co_await _gate.close();
+}
+
+bool connection_pool::is_closed_connection_error(const std::exception_ptr& e) {
+    try {
+        std::rethrow_exception(e);
+    } catch (const boost::system::system_error& err) {
+        return err.code() == boost::beast::http::error::end_of_stream;
+    } catch (const std::system_error& err) {
+        return err.code().value() == EPIPE || err.code().value() == ECONNRESET;
+    } catch (...) {
+        return false;
+    }
+}
+
+size_t connection_pool::idle_clients() const {
+    size_t n = 0;
+    for (const auto& [_, clients] : _idle) {
+        n += clients.size();
+    }
+    return n;
+}
+
+} // namespace http
@@ -0,0 +1,191 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "http/client.h"
+#include "net/transport.h"
+#include "net/unresolved_address.h"
+#include "seastarx.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <deque>
+#include <exception>
+#include <optional>
+#include <string_view>
+
+namespace http {
+
+/// Connected http clients of a shard which aren't in use, by endpoint
+///
+/// The clients used for a few requests at a time, like the ones of the
+/// credentials refreshes of cloud_roles or of the OIDC key fetches, are put
+/// back in the pool when the requests are done instead of being stopped, so
+/// that the next request to the same endpoint skips the connection and TLS
+/// handshakes. A connection is only reused while it is younger than the idle
+/// timeout of common servers, and if the server didn't close it or ask for it
+/// to be closed.
+///
+/// The clients which keep their connection for the lifetime of a service,
+/// like the ones of cloud_storage_clients::client_pool, don't use this pool.
+class connection_pool {
+public:
+    static constexpr ss::lowres_clock::duration default_max_idle_time = 5s;
+    static constexpr size_t default_max_idle_per_endpoint = 4;
+
+    connection_pool(
+      ss::lowres_clock::duration max_idle_time, size_t max_idle_per_endpoint);
+
+    connection_pool(const connection_pool&) = delete;
+    connection_pool& operator=(const connection_pool&) = delete;
+
+    /// Pool of the current shard
+    static connection_pool& local();
+
+    /// Client of the endpoint of \p cfg, already connected if an idle
+    /// connection was reused. \p as is checked by the requests of the client
+    /// until it is released.
+    client acquire(
+      const net::base_transport::configuration& cfg,
+      const ss::abort_source* as = nullptr);
+
+    /// New client of the endpoint of \p cfg, which doesn't reuse an idle
+    /// connection
+    client connect(
+      const net::base_transport::configuration& cfg,
+      const ss::abort_source* as = nullptr);
+
+    /// True if acquire would reuse an idle connection to the endpoint of
+    /// \p cfg
+    bool has_idle(const net::base_transport::configuration& cfg) const {
+        return _idle.contains(endpoint{cfg});
+    }
+
+    /// Put back a client acquired for \p cfg. The client is kept if it is
+    /// still connected and stopped otherwise.
+    void release(const net::base_transport::configuration& cfg, client c);
+
+    /// Stop the idle clients, the clients released afterwards are stopped
+    ss::future<> stop();
+
+    /// Number of idle clients, exposed for testing
+    size_t idle_clients() const;
+
+    /// True if \p e is the error of a request sent on a connection which the
+    /// server had already closed
+    static bool is_closed_connection_error(const std::exception_ptr& e);
+
+private:
+    struct endpoint {
+        net::unresolved_address address;
+        std::optional<ss::sstring> tls_sni_hostname;
+        /// The credentials are shared by the clients of a service, the
+        /// clients of different services don't share connections.
+        const ss::tls::certificate_credentials* credentials;
+
+        explicit endpoint(const net::base_transport::configuration&);
+
+        bool operator==(const endpoint&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const endpoint& e) {
+            return H::combine(
+              std::move(h),
+              std::string_view{e.address.host()},
+              e.address.port(),
+              std::string_view{e.tls_sni_hostname.value_or("")},
+              e.credentials);
+        }
+    };
+
+    struct idle_client {
+        client c;
+        ss::lowres_clock::time_point since;
+    };
+
+    /// Stop the clients idle for longer than the idle timeout
+    void evict_idle();
+
+    /// Stop \p c in the background
+    void close(client c);
+
+    ss::lowres_clock::duration _max_idle_time;
+    size_t _max_idle_per_endpoint;
+    absl::flat_hash_map<endpoint, std::deque<idle_client>> _idle;
+    ss::timer<ss::lowres_clock> _evict_timer;
+    ss::gate _gate;
+};
+
+namespace detail {
+
+template<typename T, typename Func>
+ss::future<T> run_on_pooled_client(
+  connection_pool& pool,
+  const net::base_transport::configuration& cfg,
+  client cl,
+  Func& func) {
+    std::exception_ptr ep;
+    try {
+        auto res = co_await ss::futurize_invoke(func, cl);
+        pool.release(cfg, std::move(cl));
+        co_return res;
+    } catch (...) {
+        ep = std::current_exception();
+    }
+    co_await cl.stop();
+    cl.shutdown();
+    std::rethrow_exception(ep);
+}
+
+} // namespace detail
+
+/// Helper to run \p func on a client of the pool of the shard for the
+/// endpoint of \p cfg. The client is put back in the pool if \p func
+/// succeeds, and stopped otherwise. Modeled after with_client.
+///
+/// The server may have closed a reused connection while it was idle, the
+/// request then fails before any response is received and \p func is called
+/// again with a new connection: the requests made by \p func must be safe
+/// to send twice.
+template<
+  typename Func,
+  typename T =
+    typename ss::futurize_t<std::invoke_result_t<Func&, client&>>::value_type>
+ss::future<T> with_pooled_client(
+  net::base_transport::configuration cfg,
+  const ss::abort_source* as,
+  Func func) {
+    auto& pool = connection_pool::local();
+    if (pool.has_idle(cfg)) {
+        std::exception_ptr ep;
+        try {
+            co_return co_await detail::run_on_pooled_client<T>(
+              pool, cfg, pool.acquire(cfg, as), func);
+        } catch (...) {
+            ep = std::current_exception();
+        }
+        if (!connection_pool::is_closed_connection_error(ep)) {
+            std::rethrow_exception(ep);
+        }
+    }
+    co_return co_await detail::run_on_pooled_client<T>(
+      pool, cfg, pool.connect(cfg, as), func);
+}
+
+} // namespace http
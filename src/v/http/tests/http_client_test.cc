@@ -12,6 +12,7 @@
 #include "bytes/iostream.h"
 #include "http/chunk_encoding.h"
 #include "http/client.h"
+#include "http/connection_pool.h"
 #include "http/logger.h"
 #include "net/dns.h"
 #include "net/transport.h"
@@ -392,6 +393,54 @@ SEASTAR_THREAD_TEST_CASE(test_http_PUT_empty_roundtrip) {
       });
 }
 
+SEASTAR_THREAD_TEST_CASE(test_connection_pool_reuse) {
+    auto config = transport_configuration();
+    auto [server, unused] = started_client_and_server(config);
+    http::connection_pool pool(5s, 1);
+
+    auto get = [&config](http::client& client) {
+        http::client::request_header header;
+        header.method(boost::beast::http::verb::get);
+        header.target("/get");
+        header_set_host(header, config.server_addr);
+        auto resp = client.request(std::move(header)).get();
+        while (!resp->is_done()) {
+            resp->recv_some().get();
+        }
+        BOOST_REQUIRE_EQUAL(
+          resp->get_headers().result(), boost::beast::http::status::ok);
+    };
+
+    auto client = pool.acquire(config);
+    get(client);
+    pool.release(config, std::move(client));
+    BOOST_REQUIRE_EQUAL(pool.idle_clients(), 1);
+
+    // the idle connection is reused
+    auto reused = pool.acquire(config);
+    BOOST_REQUIRE_EQUAL(pool.idle_clients(), 0);
+    BOOST_REQUIRE(reused.is_valid());
+    get(reused);
+
+    // a closed connection isn't kept
+    auto closed = pool.acquire(config);
+    get(closed);
+    closed.shutdown();
+    pool.release(config, std::move(closed));
+    BOOST_REQUIRE_EQUAL(pool.idle_clients(), 0);
+
+    // at most one connection per endpoint is kept
+    auto other = pool.acquire(config);
+    get(other);
+    pool.release(config, std::move(reused));
+    pool.release(config, std::move(other));
+    BOOST_REQUIRE_EQUAL(pool.idle_clients(), 1);
+
+    pool.stop().get();
+    BOOST_REQUIRE_EQUAL(pool.idle_clients(), 0);
+    server->stop().get();
+}
+
 /// Simple tcp server that can receive pre-defined request and
 /// reply with pre-defined response.
 /// Seastar.Httpd doesn't support chunked encoding at the moment
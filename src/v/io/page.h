@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include "io/cache.h"
+
 #include <seastar/core/temporary_buffer.hh>
 
 #include <cstdint>
@@ -51,6 +53,26 @@ public:
      */
     [[nodiscard]] const seastar::temporary_buffer<char>& data() const noexcept;
 
+    /**
+     * Replace the data stored in this page.
+     *
+     * The size of \p data must match the size of the page. This is used to
+     * rehydrate a page in place after it has been evicted, which preserves the
+     * page's cache metadata (e.g. ghost queue membership).
+     */
+    void set_data(seastar::temporary_buffer<char> data) noexcept;
+
+    /**
+     * Release the data stored in this page. The size of the page is not
+     * changed.
+     */
+    void clear() noexcept;
+
+    /**
+     * Cache metadata used when the page is managed by \ref io::cache.
+     */
+    cache_hook hook;
+
 private:
     uint64_t offset_;
     uint64_t size_;
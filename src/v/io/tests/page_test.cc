@@ -28,3 +28,15 @@ TEST(Page, NonEmpty) {
     EXPECT_EQ(p.size(), size);
     EXPECT_EQ(p.data().size(), size);
 }
+
+TEST(Page, ClearAndSetData) {
+    constexpr auto size = 10;
+    seastar::temporary_buffer<char> data(size);
+    io::page p(1, std::move(data));
+    p.clear();
+    EXPECT_EQ(p.size(), size);
+    EXPECT_TRUE(p.data().empty());
+    p.set_data(seastar::temporary_buffer<char>(size));
+    EXPECT_EQ(p.size(), size);
+    EXPECT_EQ(p.data().size(), size);
+}
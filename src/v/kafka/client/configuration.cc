@@ -99,6 +99,15 @@ configuration::configuration()
           }
           return std::nullopt;
       })
+  , produce_max_in_flight(
+      *this,
+      "produce_max_in_flight",
+      "Number of batches of a partition the producer sends without waiting "
+      "for the response to the previous ones. With more than one, the "
+      "batches of a partition may be reordered when they are retried",
+      {},
+      1,
+      {.min = 1})
   , consumer_request_timeout(
       *this,
       "consumer_request_timeout_ms",
@@ -119,6 +128,14 @@ configuration::configuration()
       {},
       1_MiB,
       {.min = 0})
+  , consumer_prefetch_max_bytes(
+      *this,
+      "consumer_prefetch_max_bytes",
+      "Max bytes a consumer fetches ahead of the next fetch of its client, "
+      "while the client handles the previous response. 0 disables prefetching",
+      {},
+      0,
+      {.min = 0})
   , consumer_session_timeout(
       *this,
       "consumer_session_timeout_ms",
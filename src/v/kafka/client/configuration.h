@@ -37,9 +37,11 @@ struct configuration final : public config::config_store {
     config::property<ss::sstring> produce_compression_type;
     config::property<std::chrono::milliseconds> produce_shutdown_delay;
     config::property<int16_t> produce_ack_level;
+    config::bounded_property<int16_t> produce_max_in_flight;
     config::property<std::chrono::milliseconds> consumer_request_timeout;
     config::bounded_property<int32_t> consumer_request_min_bytes;
     config::bounded_property<int32_t> consumer_request_max_bytes;
+    config::bounded_property<int32_t> consumer_prefetch_max_bytes;
     config::property<std::chrono::milliseconds> consumer_session_timeout;
     config::property<std::chrono::milliseconds> consumer_rebalance_timeout;
     config::property<std::chrono::milliseconds> consumer_heartbeat_interval;
@@ -143,6 +143,19 @@ ss::future<> consumer::stop() {
     _as.request_abort();
     return _coordinator->stop()
       .then([this]() { return _gate.close(); })
+      .then([this]() {
+          if (!_prefetch) {
+              return ss::now();
+          }
+          auto f = std::exchange(_prefetch, std::nullopt).value();
+          return std::move(f).then_wrapped([this](ss::future<prefetch> f) {
+              if (!f.failed()) {
+                  skip_prefetched(f.get());
+              } else {
+                  f.ignore_ready_future();
+              }
+          });
+      })
       .finally([me{shared_from_this()}] {});
 }
 
@@ -427,6 +440,30 @@ consumer::dispatch_fetch(broker_reqs_t::value_type br) {
 ss::future<fetch_response> consumer::fetch(
   std::chrono::milliseconds timeout, std::optional<int32_t> max_bytes) {
     refresh_inactivity_timer();
+    auto fetch_max_bytes = max_bytes.value_or(
+      _config.consumer_request_max_bytes);
+    if (auto res = co_await take_prefetched(fetch_max_bytes); res) {
+        maybe_prefetch(timeout, fetch_max_bytes);
+        co_return std::move(*res);
+    }
+
+    auto broker_reqs = co_await make_fetch_requests(timeout, fetch_max_bytes);
+    auto res = co_await ss::map_reduce(
+      std::make_move_iterator(broker_reqs.begin()),
+      std::make_move_iterator(broker_reqs.end()),
+      [this](broker_reqs_t::value_type br) {
+          return dispatch_fetch(std::move(br));
+      },
+      fetch_response{
+        .data
+        = {.throttle_time_ms{}, .error_code = error_code::none, .session_id = kafka::invalid_fetch_session_id}},
+      detail::reduce_fetch_response);
+    maybe_prefetch(timeout, fetch_max_bytes);
+    co_return res;
+}
+
+ss::future<consumer::broker_reqs_t> consumer::make_fetch_requests(
+  std::chrono::milliseconds timeout, int32_t max_bytes) {
     // Split requests by broker
     broker_reqs_t broker_reqs;
     for (auto const& [t, ps] : _assignment) {
@@ -444,8 +481,7 @@ ss::future<fetch_response> consumer::fetch(
                               .replica_id = consumer_replica_id,
                               .max_wait_ms = timeout,
                               .min_bytes = _config.consumer_request_min_bytes,
-                              .max_bytes = max_bytes.value_or(
-                                _config.consumer_request_max_bytes),
+                              .max_bytes = max_bytes,
                               .isolation_level = model::isolation_level::
                                 read_uncommitted, // READ_UNCOMMITTED
                               .session_id = session.id(),
@@ -461,21 +497,99 @@ ss::future<fetch_response> consumer::fetch(
               fetch_request::partition{
                 .partition_index = p,
                 .fetch_offset = session.offset(tp),
-                .max_bytes = max_bytes.value_or(
-                  _config.consumer_request_max_bytes)});
+                .max_bytes = max_bytes});
         }
     }
+    co_return broker_reqs;
+}
+
+void consumer::maybe_prefetch(
+  std::chrono::milliseconds timeout, int32_t max_bytes) {
+    auto budget = _config.consumer_prefetch_max_bytes();
+    if (
+      budget == 0 || _prefetch || _assignment.empty()
+      || _as.abort_requested()) {
+        return;
+    }
+    max_bytes = std::min(max_bytes, budget);
+    _prefetch = ss::try_with_gate(
+      _gate, [me{shared_from_this()}, timeout, max_bytes] {
+          return me->do_prefetch(timeout, max_bytes);
+      });
+}
 
-    co_return co_await ss::map_reduce(
+ss::future<consumer::prefetch> consumer::do_prefetch(
+  std::chrono::milliseconds timeout, int32_t max_bytes) {
+    prefetch p{.assignment = _assignment, .max_bytes = max_bytes};
+    auto broker_reqs = co_await make_fetch_requests(timeout, max_bytes);
+    co_await ss::parallel_for_each(
       std::make_move_iterator(broker_reqs.begin()),
       std::make_move_iterator(broker_reqs.end()),
-      [this](broker_reqs_t::value_type br) {
-          return dispatch_fetch(std::move(br));
-      },
-      fetch_response{
-        .data
-        = {.throttle_time_ms{}, .error_code = error_code::none, .session_id = kafka::invalid_fetch_session_id}},
-      detail::reduce_fetch_response);
+      [this, &p](broker_reqs_t::value_type br) {
+          return prefetch_one(std::move(br), p);
+      });
+    co_return p;
+}
+
+ss::future<>
+consumer::prefetch_one(broker_reqs_t::value_type br, prefetch& p) {
+    auto& [broker, req] = br;
+    try {
+        auto res = co_await broker->dispatch(std::move(req));
+        if (res.data.error_code == error_code::none) {
+            p.responses.emplace_back(broker, std::move(res));
+        }
+    } catch (...) {
+        // the next fetch asks the broker again
+        vlog(
+          kclog.debug,
+          "Consumer: {}, prefetch from {} failed: {}",
+          *this,
+          broker->id(),
+          std::current_exception());
+    }
+}
+
+ss::future<std::optional<fetch_response>>
+consumer::take_prefetched(int32_t max_bytes) {
+    if (!_prefetch) {
+        co_return std::nullopt;
+    }
+    auto f = std::exchange(_prefetch, std::nullopt).value();
+    std::optional<prefetch> p;
+    try {
+        p = co_await std::move(f);
+    } catch (...) {
+        vlog(
+          kclog.debug,
+          "Consumer: {}, prefetch failed: {}",
+          *this,
+          std::current_exception());
+        co_return std::nullopt;
+    }
+    if (
+      p->responses.empty() || p->assignment != _assignment
+      || p->max_bytes > max_bytes) {
+        skip_prefetched(*p);
+        co_return std::nullopt;
+    }
+    fetch_response res{
+      .data = {
+        .throttle_time_ms{},
+        .error_code = error_code::none,
+        .session_id = kafka::invalid_fetch_session_id}};
+    for (auto& [broker, r] : p->responses) {
+        _fetch_sessions[broker].apply(r);
+        res = detail::reduce_fetch_response(std::move(res), std::move(r));
+    }
+    co_return res;
+}
+
+void consumer::skip_prefetched(const prefetch& p) {
+    // the broker moved its fetch session on, the records are fetched again
+    for (const auto& [broker, r] : p.responses) {
+        _fetch_sessions[broker].skip(r);
+    }
 }
 
 template<typename request_factory>
@@ -23,6 +23,7 @@
 #include "kafka/protocol/offset_fetch.h"
 #include "kafka/types.h"
 
+#include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
 
 #include <absl/container/node_hash_map.h>
@@ -75,10 +76,23 @@ public:
     offset_fetch(std::vector<offset_fetch_request_topic> topics);
     ss::future<offset_commit_response>
     offset_commit(std::vector<offset_commit_request_topic> topics);
+    /// \brief Fetch the next records of the assignment
+    ///
+    /// With consumer_prefetch_max_bytes set, the next records are fetched in
+    /// the background once the response is returned, and the next call
+    /// returns them if the assignment didn't change. The records count as
+    /// consumed, and their offsets are committed, only once they are returned.
     ss::future<fetch_response>
     fetch(std::chrono::milliseconds timeout, std::optional<int32_t> max_bytes);
 
 private:
+    /// The responses of a background fetch
+    struct prefetch {
+        assignment_t assignment;
+        int32_t max_bytes;
+        std::vector<std::pair<shared_broker_t, fetch_response>> responses;
+    };
+
     bool is_leader() const {
         return _member_id != no_member && _leader_id == _member_id;
     }
@@ -100,6 +114,16 @@ private:
     ss::future<describe_groups_response> describe_group();
 
     ss::future<fetch_response> dispatch_fetch(broker_reqs_t::value_type br);
+    ss::future<broker_reqs_t>
+    make_fetch_requests(std::chrono::milliseconds timeout, int32_t max_bytes);
+
+    void maybe_prefetch(std::chrono::milliseconds timeout, int32_t max_bytes);
+    ss::future<prefetch>
+    do_prefetch(std::chrono::milliseconds timeout, int32_t max_bytes);
+    ss::future<> prefetch_one(broker_reqs_t::value_type br, prefetch& p);
+    ss::future<std::optional<fetch_response>>
+    take_prefetched(int32_t max_bytes);
+    void skip_prefetched(const prefetch& p);
 
     template<typename RequestFactory>
     ss::future<
@@ -171,6 +195,7 @@ private:
     std::unique_ptr<assignment_plan> _plan{};
     assignment_t _assignment{};
     absl::node_hash_map<shared_broker_t, fetch_session> _fetch_sessions;
+    std::optional<ss::future<prefetch>> _prefetch;
     ss::noncopyable_function<void(const kafka::member_id&)> _on_stopped;
     ss::noncopyable_function<ss::future<>(std::exception_ptr)>
       _external_mitigate;
@@ -30,13 +30,17 @@ model::offset fetch_session::offset(model::topic_partition_view tpv) const {
     return part_it->second;
 }
 
-bool fetch_session::apply(fetch_response& res) {
+void fetch_session::skip(const fetch_response& res) {
     if (_id == invalid_fetch_session_id) {
         _id = fetch_session_id{res.data.session_id};
     }
     vassert(res.data.session_id == _id, "session mismatch: {}", *this);
 
     ++_epoch;
+}
+
+bool fetch_session::apply(fetch_response& res) {
+    skip(res);
     for (auto& part : res) {
         if (part.partition_response->error_code != error_code::none) {
             continue;
@@ -41,6 +41,9 @@ public:
     kafka::fetch_session_epoch epoch() const { return _epoch; }
     model::offset offset(model::topic_partition_view tpv) const;
     bool apply(fetch_response& res);
+    /// Advance the session past the response without consuming its records,
+    /// for a response which isn't returned to the client.
+    void skip(const fetch_response& res);
     std::vector<kafka::offset_commit_request_topic>
     make_offset_commit_request() const;
 
@@ -21,11 +21,17 @@
 #include <seastar/core/timer.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
 
 namespace kafka::client {
 
 /// \brief Batch multiple client requests, flush them based on size or time.
+///
+/// Up to produce_max_in_flight batches are sent without waiting for the
+/// responses to the previous ones. The batches are numbered in the order they
+/// are passed to the consumer, starting at 0, and their responses may arrive
+/// in any order: they are applied in the order of the batches.
 class produce_partition {
 public:
     using response = produce_batcher::partition_response;
@@ -45,10 +51,36 @@ public:
         return fut;
     }
 
+    /// Handle the response to the oldest batch without one.
     void handle_response(response&& res) {
-        vassert(_in_flight, "handle_response requires a batch in flight");
+        auto sequence = _acked_sequence;
+        while (_early_responses.contains(sequence)) {
+            ++sequence;
+        }
+        handle_response(sequence, std::move(res));
+    }
+
+    /// Handle the response to the batch with the given sequence number.
+    void handle_response(uint64_t sequence, response&& res) {
+        vassert(
+          sequence >= _acked_sequence && sequence < _next_sequence,
+          "handle_response requires batch {} to be in flight, in flight: [{}, "
+          "{})",
+          sequence,
+          _acked_sequence,
+          _next_sequence);
+        if (sequence != _acked_sequence) {
+            _early_responses.emplace(sequence, std::move(res));
+            return;
+        }
         _batcher.handle_response(std::move(res));
-        _in_flight = false;
+        ++_acked_sequence;
+        for (auto it = _early_responses.begin();
+             it != _early_responses.end() && it->first == _acked_sequence;
+             it = _early_responses.erase(it)) {
+            _batcher.handle_response(std::move(it->second));
+            ++_acked_sequence;
+        }
         try_consume(false);
     }
 
@@ -59,17 +91,28 @@ public:
     }
 
 private:
+    uint64_t in_flight() const { return _next_sequence - _acked_sequence; }
+
     model::record_batch do_consume() {
-        vassert(!_in_flight, "do_consume should not run concurrently");
+        vassert(
+          in_flight() < static_cast<uint64_t>(_config.produce_max_in_flight()),
+          "do_consume should not exceed the batches in flight");
 
-        _in_flight = true;
+        ++_next_sequence;
         _record_count = 0;
         _size_bytes = 0;
         return _batcher.consume();
     }
 
     bool try_consume(bool timed_out) {
-        if (_in_flight || _record_count == 0) {
+        if (_record_count == 0) {
+            return false;
+        }
+        if (
+          in_flight()
+          >= static_cast<uint64_t>(_config.produce_max_in_flight())) {
+            // send as soon as a batch in flight completes
+            _linger_expired = _linger_expired || timed_out;
             return false;
         }
 
@@ -79,12 +122,17 @@ private:
         auto threshold_met = _record_count >= batch_record_count
                              || _size_bytes >= batch_size_bytes;
 
-        if (!timed_out && !threshold_met) {
-            _timer.cancel();
-            _timer.arm(_config.produce_batch_delay());
+        if (!timed_out && !_linger_expired && !threshold_met) {
+            // the delay runs from the first record of the batch, it is not
+            // extended by the records produced after it
+            if (!_timer.armed()) {
+                _timer.arm(_config.produce_batch_delay());
+            }
             return false;
         }
 
+        _timer.cancel();
+        _linger_expired = false;
         _consumer(do_consume());
         return true;
     }
@@ -95,7 +143,13 @@ private:
     consumer _consumer;
     int32_t _record_count{};
     int32_t _size_bytes{};
-    bool _in_flight{};
+    // sequence of the next batch passed to the consumer
+    uint64_t _next_sequence{};
+    // sequence of the oldest batch in flight
+    uint64_t _acked_sequence{};
+    // responses which arrived before the responses to earlier batches
+    absl::btree_map<uint64_t, response> _early_responses;
+    bool _linger_expired{};
 };
 
 } // namespace kafka::client
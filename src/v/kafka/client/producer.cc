@@ -19,25 +19,13 @@
 #include "model/fundamental.h"
 
 #include <seastar/core/gate.hh>
+#include <seastar/core/later.hh>
 
+#include <algorithm>
 #include <exception>
 
 namespace kafka::client {
 
-produce_request make_produce_request(
-  model::topic_partition tp, model::record_batch&& batch, int16_t acks) {
-    std::vector<produce_request::partition> partitions;
-    partitions.emplace_back(produce_request::partition{
-      .partition_index{tp.partition},
-      .records = produce_request_record_data(std::move(batch))});
-
-    std::vector<produce_request::topic> topics;
-    topics.emplace_back(produce_request::topic{
-      .name{std::move(tp.topic)}, .partitions{std::move(partitions)}});
-    std::optional<ss::sstring> t_id;
-    return produce_request(t_id, acks, std::move(topics));
-}
-
 produce_response::partition
 make_produce_response(model::partition_id p_id, std::exception_ptr ex) {
     auto response = produce_response::partition{
@@ -123,21 +111,115 @@ ss::future<produce_response::partition>
 producer::do_send(model::topic_partition tp, model::record_batch batch) {
     auto leader = co_await _topic_cache.leader(tp);
     auto broker = co_await _brokers.find(leader);
-    auto res = co_await broker->dispatch(
-      make_produce_request(std::move(tp), std::move(batch), _acks));
-    auto topic = std::move(res.data.responses[0]);
-    auto partition = std::move(topic.partitions[0]);
+    auto partition = co_await dispatch(std::move(broker), tp, std::move(batch));
     if (partition.error_code != error_code::none) {
-        throw partition_error(
-          model::topic_partition(topic.name, partition.partition_index),
-          partition.error_code);
+        throw partition_error(std::move(tp), partition.error_code);
     }
 
     co_return partition;
 }
 
-ss::future<>
-producer::send(model::topic_partition tp, model::record_batch&& batch) {
+ss::future<produce_response::partition> producer::dispatch(
+  shared_broker_t broker,
+  model::topic_partition tp,
+  model::record_batch batch) {
+    auto& pending = _pending_sends[broker->id()];
+    pending.push_back(
+      pending_send{.tp = std::move(tp), .batch = std::move(batch)});
+    auto response = pending.back().response.get_future();
+    if (pending.size() == 1) {
+        // the caller holds the gate until the response is set, so the
+        // pending sends are dispatched even if the producer is stopping
+        ssx::background = ss::yield().then(
+          [this, broker = std::move(broker)]() mutable {
+              return dispatch_pending(std::move(broker));
+          });
+    }
+    return response;
+}
+
+ss::future<> producer::dispatch_pending(shared_broker_t broker) {
+    auto sends = std::exchange(_pending_sends[broker->id()], {});
+    _pending_sends.erase(broker->id());
+
+    // a partition appears once in a request, the batches of a partition
+    // which are both in flight go in separate requests
+    std::vector<pending_sends_t> requests;
+    for (auto& send : sends) {
+        auto it = std::find_if(
+          requests.begin(), requests.end(), [&send](const pending_sends_t& r) {
+              return std::none_of(
+                r.begin(), r.end(), [&send](const pending_send& s) {
+                    return s.tp == send.tp;
+                });
+          });
+        if (it == requests.end()) {
+            it = requests.emplace(requests.end());
+        }
+        it->push_back(std::move(send));
+    }
+    co_await ss::parallel_for_each(
+      requests, [this, &broker](pending_sends_t& sends) {
+          return dispatch_request(broker, sends);
+      });
+}
+
+ss::future<> producer::dispatch_request(
+  const shared_broker_t& broker, pending_sends_t& sends) {
+    std::vector<produce_request::topic> topics;
+    for (auto& send : sends) {
+        auto it = std::find_if(
+          topics.begin(), topics.end(), [&send](const auto& t) {
+              return t.name == send.tp.topic;
+          });
+        if (it == topics.end()) {
+            it = topics.emplace(
+              topics.end(), produce_request::topic{.name{send.tp.topic}});
+        }
+        it->partitions.emplace_back(produce_request::partition{
+          .partition_index{send.tp.partition},
+          .records = produce_request_record_data(std::move(send.batch))});
+    }
+    vlog(
+      kclog.trace,
+      "dispatch {} batches to broker {}",
+      sends.size(),
+      broker->id());
+
+    std::exception_ptr ex;
+    try {
+        std::optional<ss::sstring> t_id;
+        auto res = co_await broker->dispatch(
+          produce_request(t_id, _acks, std::move(topics)));
+        for (auto& topic : res.data.responses) {
+            for (auto& partition : topic.partitions) {
+                auto it = std::find_if(
+                  sends.begin(), sends.end(), [&](const pending_send& s) {
+                      return !s.responded && s.tp.topic == topic.name
+                             && s.tp.partition == partition.partition_index;
+                  });
+                if (it != sends.end()) {
+                    it->response.set_value(std::move(partition));
+                    it->responded = true;
+                }
+            }
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    for (auto& send : sends) {
+        if (send.responded) {
+            continue;
+        }
+        send.response.set_exception(
+          ex ? ex
+             : std::make_exception_ptr(partition_error(
+               send.tp, error_code::unknown_server_error)));
+    }
+}
+
+ss::future<> producer::send(
+  model::topic_partition tp, model::record_batch&& batch, uint64_t seq) {
     auto record_count = batch.record_count();
     vlog(
       kclog.debug,
@@ -171,14 +253,15 @@ producer::send(model::topic_partition tp, model::record_batch&& batch) {
       .handle_exception([p_id](std::exception_ptr ex) {
           return make_produce_response(p_id, std::move(ex));
       })
-      .then([this, tp, record_count](produce_response::partition res) mutable {
+      .then([this, tp, record_count, seq](
+              produce_response::partition res) mutable {
           vlog(
             kclog.debug,
             "sent record_batch: {}, {{record_count: {}}}, {}",
             tp,
             record_count,
             res.error_code);
-          get_context(std::move(tp))->handle_response(std::move(res));
+          get_context(std::move(tp))->handle_response(seq, std::move(res));
       });
 }
 
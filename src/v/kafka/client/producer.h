@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "kafka/client/broker.h"
 #include "kafka/client/logger.h"
 #include "kafka/client/produce_batcher.h"
 #include "kafka/client/produce_partition.h"
@@ -51,14 +52,35 @@ public:
     ss::future<> stop();
 
 private:
-    ss::future<> send(model::topic_partition tp, model::record_batch&& batch);
+    /// A batch waiting to be sent to the leader of its partition
+    struct pending_send {
+        model::topic_partition tp;
+        model::record_batch batch;
+        ss::promise<produce_response::partition> response;
+        bool responded{false};
+    };
+    using pending_sends_t = std::vector<pending_send>;
+
+    ss::future<> send(
+      model::topic_partition tp, model::record_batch&& batch, uint64_t seq);
 
     ss::future<produce_response::partition>
     do_send(model::topic_partition tp, model::record_batch batch);
 
+    /// Queue the batch for the broker. The batches queued for a broker within
+    /// a task are sent to it in one produce request.
+    ss::future<produce_response::partition> dispatch(
+      shared_broker_t broker,
+      model::topic_partition tp,
+      model::record_batch batch);
+    ss::future<> dispatch_pending(shared_broker_t broker);
+    ss::future<>
+    dispatch_request(const shared_broker_t& broker, pending_sends_t& sends);
+
     auto make_consumer(model::topic_partition tp) {
-        return [this, tp](model::record_batch&& batch) {
-            (void)send(tp, std::move(batch));
+        return [this, tp, seq = uint64_t{0}](
+                 model::record_batch&& batch) mutable {
+            (void)send(tp, std::move(batch), seq++);
         };
     }
 
@@ -80,6 +102,7 @@ private:
     topic_cache& _topic_cache;
     brokers& _brokers;
     int16_t _acks;
+    absl::flat_hash_map<model::node_id, pending_sends_t> _pending_sends;
     ss::abort_source _as;
     ss::abort_source _ingest_as;
     ss::gate _gate;
@@ -407,3 +407,72 @@ FIXTURE_TEST(consumer_group, kafka_client_fixture) {
         }
     }
 }
+
+FIXTURE_TEST(consumer_prefetch, kafka_client_fixture) {
+    using namespace std::chrono_literals;
+
+    info("Waiting for leadership");
+    wait_for_controller_leadership().get();
+
+    info("Connecting client");
+    auto client = make_connected_client();
+    client.config().retry_base_backoff.set_value(10ms);
+    client.config().retries.set_value(size_t(10));
+    // configuration under test
+    client.config().consumer_prefetch_max_bytes.set_value(int32_t(1));
+    client.connect().get();
+    auto stop_client = ss::defer([&client]() { client.stop().get(); });
+
+    auto tp_ns = create_topic(1, 0);
+    auto tp = model::topic_partition(tp_ns.tp, model::partition_id(0));
+    wait_for_partition_offset(
+      model::ntp(tp_ns.ns, tp_ns.tp, tp.partition), model::offset{0})
+      .get();
+    constexpr int batch_count = 10;
+    for (auto b = 0; b < batch_count; ++b) {
+        client.produce_record_batch(tp, make_batch(model::offset(0), 2)).get();
+    }
+
+    kafka::group_id group_id{"test_prefetch_group_id"};
+    tests::cooperative_spin_wait_with_timeout(10s, [&client, &group_id] {
+        kafka::describe_groups_request req;
+        req.data.groups.push_back(group_id);
+        return client.dispatch(std::move(req))
+          .then([](kafka::describe_groups_response res) {
+              return res.data.groups.size() == 1
+                     && res.data.groups[0].error_code
+                          != kafka::error_code::not_coordinator;
+          });
+    }).get();
+
+    auto m_id = client.create_consumer(group_id).get();
+    auto remove_consumer = ss::defer([&client, &group_id, &m_id]() {
+        client.remove_consumer(group_id, m_id)
+          .handle_exception([](std::exception_ptr) {})
+          .get();
+    });
+    client.subscribe_consumer(group_id, m_id, {tp.topic}).get();
+
+    // the fetches return a batch at a time, the prefetched batches come
+    // back in order and none is skipped
+    model::offset next_offset{0};
+    for (int i = 0; i < 10 * batch_count && next_offset() < 2 * batch_count;
+         ++i) {
+        auto res = client.consumer_fetch(group_id, m_id, 200ms, 1).get();
+        BOOST_REQUIRE_EQUAL(res.data.error_code, kafka::error_code::none);
+        for (auto& part : res) {
+            auto& records = part.partition_response->records;
+            if (!records || records->empty()) {
+                continue;
+            }
+            while (!records->empty()) {
+                auto adapter = records->consume_batch();
+                BOOST_REQUIRE(adapter.batch);
+                BOOST_REQUIRE_EQUAL(adapter.batch->base_offset(), next_offset);
+                next_offset = model::next_offset(
+                  adapter.batch->last_offset());
+            }
+        }
+    }
+    BOOST_REQUIRE_EQUAL(next_offset, model::offset(2 * batch_count));
+}
@@ -17,6 +17,7 @@
 #include "model/fundamental.h"
 #include "model/record.h"
 
+#include <seastar/core/sleep.hh>
 #include <seastar/testing/thread_test_case.hh>
 
 #include <boost/test/tools/old/interface.hpp>
@@ -65,3 +66,86 @@ SEASTAR_THREAD_TEST_CASE(test_produce_partition_record_count) {
     auto c_res2 = c_res2_fut.get0();
     BOOST_REQUIRE_EQUAL(c_res2.base_offset, model::offset{3});
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_partition_batch_delay) {
+    std::vector<model::record_batch> consumed_batches;
+    auto consumer = [&consumed_batches](model::record_batch&& batch) {
+        consumed_batches.push_back(std::move(batch));
+    };
+
+    auto cfg = kc::configuration{};
+    cfg.produce_batch_size_bytes.set_value(1024 * 1024);
+    cfg.produce_batch_record_count.set_value(1000);
+    // configuration under test
+    cfg.produce_batch_delay.set_value(std::chrono::milliseconds(100));
+
+    kc::produce_partition producer(cfg, consumer);
+
+    // records keep arriving faster than the delay, the batch is sent once
+    // the delay since its first record elapses
+    std::vector<ss::future<kc::produce_partition::response>> results;
+    for (int i = 0; i < 50 && consumed_batches.empty(); ++i) {
+        results.push_back(producer.produce(make_batch(model::offset(i), 1)));
+        ss::sleep(std::chrono::milliseconds(10)).get();
+    }
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 1);
+
+    producer.handle_response(kafka::produce_response::partition{
+      .partition_index{model::partition_id{42}},
+      .error_code = kafka::error_code::none,
+      .base_offset{model::offset{0}}});
+    for (auto& f : results) {
+        BOOST_REQUIRE_EQUAL(f.get0().error_code, kafka::error_code::none);
+    }
+    producer.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_produce_partition_max_in_flight) {
+    std::vector<model::record_batch> consumed_batches;
+    auto consumer = [&consumed_batches](model::record_batch&& batch) {
+        consumed_batches.push_back(std::move(batch));
+    };
+
+    auto cfg = kc::configuration{};
+    cfg.produce_batch_size_bytes.set_value(1024 * 1024);
+    cfg.produce_batch_record_count.set_value(1);
+    // configuration under test
+    cfg.produce_max_in_flight.set_value(int16_t(2));
+
+    kc::produce_partition producer(cfg, consumer);
+
+    // two batches are sent without a response, the third waits
+    auto c_res0_fut = producer.produce(make_batch(model::offset(0), 1));
+    auto c_res1_fut = producer.produce(make_batch(model::offset(1), 1));
+    auto c_res2_fut = producer.produce(make_batch(model::offset(2), 1));
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 2);
+
+    // the response to the second batch arrives first, it is applied after
+    // the response to the first one
+    producer.handle_response(
+      1,
+      kafka::produce_response::partition{
+        .partition_index{model::partition_id{42}},
+        .error_code = kafka::error_code::none,
+        .base_offset{model::offset{11}}});
+    BOOST_REQUIRE(!c_res0_fut.available());
+    BOOST_REQUIRE(!c_res1_fut.available());
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 2);
+
+    producer.handle_response(
+      0,
+      kafka::produce_response::partition{
+        .partition_index{model::partition_id{42}},
+        .error_code = kafka::error_code::none,
+        .base_offset{model::offset{10}}});
+    BOOST_REQUIRE_EQUAL(c_res0_fut.get0().base_offset, model::offset{10});
+    BOOST_REQUIRE_EQUAL(c_res1_fut.get0().base_offset, model::offset{11});
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 3);
+
+    producer.handle_response(kafka::produce_response::partition{
+      .partition_index{model::partition_id{42}},
+      .error_code = kafka::error_code::none,
+      .base_offset{model::offset{12}}});
+    BOOST_REQUIRE_EQUAL(c_res2_fut.get0().base_offset, model::offset{12});
+    producer.stop().get();
+}
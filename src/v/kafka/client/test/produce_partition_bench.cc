@@ -0,0 +1,79 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/configuration.h"
+#include "kafka/client/produce_partition.h"
+#include "kafka/client/test/utils.h"
+#include "kafka/protocol/errors.h"
+#include "kafka/protocol/produce.h"
+#include "model/fundamental.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace kc = kafka::client;
+using namespace std::chrono_literals;
+
+/**
+ * Produces records to a partition whose broker responds after a fixed
+ * latency, to compare the throughput of a single batch in flight with a
+ * pipeline of batches.
+ */
+ss::future<> run_test(int16_t max_in_flight, size_t records) {
+    constexpr auto broker_latency = 1ms;
+    auto cfg = kc::configuration{};
+    cfg.produce_batch_size_bytes.set_value(1024 * 1024);
+    cfg.produce_batch_record_count.set_value(100);
+    cfg.produce_batch_delay.set_value(0ms);
+    cfg.produce_max_in_flight.set_value(max_in_flight);
+
+    ss::gate broker;
+    std::optional<kc::produce_partition> partition;
+    model::offset next_offset{0};
+    partition.emplace(cfg, [&](model::record_batch&& batch) {
+        auto base_offset = next_offset;
+        next_offset += model::offset(batch.record_count());
+        ssx::spawn_with_gate(broker, [&partition, base_offset] {
+            return ss::sleep(broker_latency).then([&partition, base_offset] {
+                partition->handle_response(kafka::produce_response::partition{
+                  .partition_index{model::partition_id{0}},
+                  .error_code = kafka::error_code::none,
+                  .base_offset{base_offset}});
+            });
+        });
+    });
+
+    std::vector<ss::future<kc::produce_partition::response>> responses;
+    responses.reserve(records);
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < records; ++i) {
+        responses.push_back(
+          partition->produce(make_batch(model::offset(i), 1)));
+    }
+    for (auto& f : responses) {
+        perf_tests::do_not_optimize(co_await std::move(f));
+    }
+    perf_tests::stop_measuring_time();
+    co_await partition->stop();
+    co_await broker.close();
+}
+
+struct produce_partition_bench {};
+PERF_TEST_C(produce_partition_bench, in_flight_1) {
+    co_return co_await run_test(1, 10'000);
+}
+PERF_TEST_C(produce_partition_bench, in_flight_5) {
+    co_return co_await run_test(5, 10'000);
+}
@@ -43,13 +43,25 @@ public:
     kafka_batch_serializer() noexcept
       : _wr(_buf) {}
 
+    /**
+     * When \p share_records is set, the record payload of large batches is
+     * appended to the output by sharing its fragments rather than possibly
+     * copying them. This avoids copying segment data into the response at
+     * the cost of keeping the underlying read buffers alive for as long as
+     * the response is.
+     */
+    explicit kafka_batch_serializer(bool share_records) noexcept
+      : _wr(_buf)
+      , _share_records(share_records) {}
+
     kafka_batch_serializer(const kafka_batch_serializer& o) = delete;
     kafka_batch_serializer& operator=(const kafka_batch_serializer& o) = delete;
     kafka_batch_serializer& operator=(kafka_batch_serializer&& o) = delete;
 
     kafka_batch_serializer(kafka_batch_serializer&& o) noexcept
       : _buf(std::move(o._buf))
-      , _wr(_buf) {}
+      , _wr(_buf)
+      , _share_records(o._share_records) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch&& batch) {
         if (unlikely(record_count_ == 0)) {
@@ -79,12 +91,14 @@ public:
 
 private:
     void write_batch(model::record_batch&& batch) {
-        protocol::writer_serialize_batch(_wr, std::move(batch));
+        protocol::writer_serialize_batch(
+          _wr, std::move(batch), _share_records);
     }
 
 private:
     iobuf _buf;
     protocol::encoder _wr;
+    bool _share_records{false};
     model::offset _base_offset;
     model::offset _last_offset;
     std::optional<model::offset> _first_tx_batch_offset;
@@ -29,7 +29,8 @@
 
 namespace kafka {
 
-model::record_batch_header kafka_batch_adapter::read_header(iobuf_parser& in) {
+model::record_batch_header
+kafka_batch_adapter::read_header(iobuf_parser_base& in) {
     const size_t initial_bytes_consumed = in.bytes_consumed();
 
     auto base_offset = model::offset(in.consume_be_type<int64_t>());
@@ -96,7 +97,8 @@ model::record_batch_header kafka_batch_adapter::read_header(iobuf_parser& in) {
     return header;
 }
 
-void kafka_batch_adapter::verify_crc(int32_t expected_crc, iobuf_parser in) {
+void kafka_batch_adapter::verify_crc(
+  int32_t expected_crc, iobuf_const_parser in) {
     auto crc = crc::crc32c();
 
     // move the cursor to correct offset where the data to be checksummed
@@ -145,19 +147,19 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return iobuf{};
     }
 
-    auto batch_length =
-      [peeker{iobuf_parser(kbatch.share(0, kafka_length_diff))}]() mutable {
-          peeker.skip(sizeof(model::record_batch_header::base_offset));
-          return peeker.consume_be_type<int32_t>() + kafka_length_diff;
-      }();
+    auto batch_length = [&kbatch] {
+        iobuf_const_parser peeker(kbatch);
+        peeker.skip(sizeof(model::record_batch_header::base_offset));
+        return peeker.consume_be_type<int32_t>() + kafka_length_diff;
+    }();
 
     auto remainder = kbatch.share(
       batch_length, kbatch.size_bytes() - batch_length);
     kbatch.trim_back(remainder.size_bytes());
 
-    auto crcparser = iobuf_parser(kbatch.share(0, kbatch.size_bytes()));
-    auto parser = iobuf_parser(std::move(kbatch));
-
+    // the parsers below reference kbatch rather than sharing it, which saves
+    // an allocation per parser and the shared fragments of each copy
+    iobuf_const_parser parser(kbatch);
     auto header = read_header(parser);
     if (unlikely(!v2_format)) {
         vlog(
@@ -166,7 +168,7 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return remainder;
     }
 
-    verify_crc(header.crc, std::move(crcparser));
+    verify_crc(header.crc, iobuf_const_parser(kbatch));
     if (unlikely(!valid_crc)) {
         vlog(klog.warn, "batch has invalid CRC: {}", header);
         return remainder;
@@ -174,7 +176,7 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
 
     auto records_size = header.size_bytes
                         - model::packed_record_batch_header_size;
-    auto records = parser.share(records_size);
+    auto records = kbatch.share(parser.bytes_consumed(), records_size);
 
     auto new_batch = model::record_batch(
       header, std::move(records), model::record_batch::tag_ctor_ng{});
@@ -182,11 +184,12 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
     /**
      * Perform some type of validation on the uncompressed input. In this case
      * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
+     * re-encoding them using the lazy-record optimization. The records are
+     * walked without copying out keys, values and headers.
      */
     if (!new_batch.compressed()) {
         try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
+            new_batch.verify_records();
         } catch (const std::exception& e) {
             vlog(klog.error, "Parsing uncompressed records: {}", e.what());
             return remainder;
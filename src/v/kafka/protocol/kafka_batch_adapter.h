@@ -71,8 +71,8 @@ public:
     void adapt_with_version(iobuf, api_version);
 
 private:
-    void verify_crc(int32_t, iobuf_parser);
-    model::record_batch_header read_header(iobuf_parser&);
+    void verify_crc(int32_t, iobuf_const_parser);
+    model::record_batch_header read_header(iobuf_parser_base&);
     void convert_message_set(storage::record_batch_builder&, iobuf, bool);
 };
 
@@ -248,6 +248,9 @@ path_type_map = {
                 "BaseOffset": ("model::offset", "int64"),
                 "LogAppendTimeMs": ("model::timestamp", "int64"),
                 "LogStartOffset": ("model::offset", "int64"),
+                "CurrentLeader": {
+                    "LeaderEpoch": ("kafka::leader_epoch", "int32"),
+                },
             },
         },
     },
@@ -469,6 +472,15 @@ override_member_container = {
     'fetchable_partition_response': 'small_fragment_vector'
 }
 
+# The requests on the hot path of the broker. Their decoders are specialized
+# for each version, so that the version checks of the fields are constants,
+# and they skip the unknown tagged fields instead of keeping a copy of them:
+# the broker never forwards a request it decodes.
+specialized_decoders = {
+    'produce_request_data',
+    'fetch_request_data',
+}
+
 
 def make_context_field(path):
     """
@@ -531,6 +543,8 @@ STRUCT_TYPES = [
     "TopicProduceResponse",
     "PartitionProduceResponse",
     "BatchIndexAndErrorMessage",
+    "LeaderIdAndEpoch",
+    "NodeEndpoint",
     "TopicProduceData",
     "PartitionProduceData",
     "MetadataResponseBroker",
@@ -708,9 +722,9 @@ class FieldType:
             int32 -> Int32Type
             []int32 -> ArrayType(Int32Type)
             []FooType -> ArrayType(StructType)
+            FooType -> StructType
 
-        Verifies that structs are only stored in arrays and that there are no array
-        of array types like [][]FooType.
+        Verifies that there are no array of array types like [][]FooType.
         """
         type_name = field["type"]
 
@@ -727,7 +741,6 @@ class FieldType:
             # Its possible for tagged types to contain fields where the type is not
             # prefixed with [], these types are listed in the TAGGED_WITH_FIELDS map
             is_array = is_array or (type_name in TAGGED_WITH_FIELDS)
-            assert is_array
             path = path + (field["name"], )
             type_name = apply_struct_renames(path, type_name)
             t = StructType(type_name, field["fields"], path)
@@ -809,9 +822,9 @@ class StructType(FieldType):
                 if isinstance(t, ArrayType):
                     t = t.value_type()  # unwrap value type
                 if isinstance(t, StructType):
-                    yield from type_iterator(t.fields)
+                    yield from type_iterator(t.fields + t.tags)
 
-        types = set(type_iterator(self.fields))
+        types = set(type_iterator(self.fields + self.tags))
 
         def maybe_strings(s):
             if isinstance(s, str):
@@ -1201,10 +1214,17 @@ class response;
 {%- if  struct.is_streamable %}
     friend std::ostream& operator<<(std::ostream&, const {{ struct.name }}&);
 {%- endif %}
-{%- if first_flex > 0 %}
+{%- if first_flex > 0 or specialized_decoder %}
 private:
+{%- endif %}
+{%- if first_flex > 0 %}
     void encode_flex(protocol::encoder&, api_version);
     void encode_standard(protocol::encoder&, api_version);
+{%- endif %}
+{%- if specialized_decoder %}
+    template<int16_t Version>
+    void decode_version(protocol::decoder&);
+{%- elif first_flex > 0 %}
 {%- if op_type == "request" %}
     void decode_flex(protocol::decoder&, api_version);
     void decode_standard(protocol::decoder&, api_version);
@@ -1326,6 +1346,11 @@ if ({{ cond }}) {
     {{ writer }}.write(v);
 {%- endif %}
 });
+{%- elif field.type().is_struct %}
+[version]({{ field.type_name.0 }}& v, protocol::encoder& writer) {
+    (void)version;
+{{- struct_serde(field.type(), methods, "v") | indent }}
+}({{ fname }}, {{ writer }});
 {%- elif flex and field.type().potentially_flexible_type %}
 {{ writer }}.write_flex({{ fname }});
 {%- else %}
@@ -1359,6 +1384,13 @@ if ({{ cond }}) {
 {%- endif %}
 {%- endif %}
 });
+{%- elif field.type().is_struct %}
+{{ fname }} = [version](protocol::decoder& reader) {
+    (void)version;
+    {{ field.type_name.0 }} v;
+{{- struct_serde(field.type(), methods, "v") | indent }}
+    return v;
+}(reader);
 {%- else %}
 {%- set decoder, named_type = field.decoder(flex) %}
 {%- if named_type == None %}
@@ -1380,7 +1412,7 @@ if ({{ cond }}) {
 {%- endif %}
 {%- endmacro %}
 
-{% macro tag_decoder_impl(tag_definitions, obj = "") %}
+{% macro tag_decoder_impl(tag_definitions, obj = "", skip_unknown = False) %}
 /// Tags decoding section
 auto num_tags = reader.read_unsigned_varint();
 while(num_tags-- > 0) {
@@ -1393,11 +1425,15 @@ while(num_tags-- > 0) {
         break;
 {%- endfor %}
     default:
+{%- if skip_unknown %}
+        reader.skip(sz);
+{%- else %}
 {%- set tf = "unknown_tags" %}
 {%- if obj != "" %}
 {%- set tf = obj + '.unknown_tags' %}
 {%- endif %}
         reader.consume_unknown_tag({{ tf }}, tag, sz);
+{%- endif %}
     }
 }
 {%- endmacro %}
@@ -1416,6 +1452,16 @@ while(num_tags-- > 0) {
 {%- endif %}
 {%- endmacro %}
 
+{% macro tag_skipper(tag_definitions, obj = "") %}
+{%- if tag_definitions|length == 0 %}
+reader.skip_tags();
+{%- else %}
+{
+{{- tag_decoder_impl(tag_definitions, obj, True) | indent }}
+}
+{%- endif %}
+{%- endmacro %}
+
 {% macro conditional_tag_encode(tdef, vec, obj = "") %}
 {%- if obj %}
 {%- set fname = obj + "." + tdef.name %}
@@ -1430,6 +1476,10 @@ if ({{ fname }}) {
 if (!{{ fname }}.empty()) {
     {{ vec }}.push_back({{ tdef.tag() }});
 }
+{%- elif tdef.type().is_struct %}
+if ({{ fname }} != {{ tdef.type_name.0 }}{}) {
+    {{ vec }}.push_back({{ tdef.tag() }});
+}
 {%- elif tdef.default_value() != "" %}
 if ({{ fname }} != {{ tdef.default_value() }}) {
     {{ vec }}.push_back({{ tdef.tag() }});
@@ -1489,6 +1539,7 @@ writer.write_tags(std::move({{ tf }}));
 {% set decoder = (field_decoder,) %}
 {% set flex_encoder = (field_encoder, tag_encoder) %}
 {% set flex_decoder = (field_decoder, tag_decoder) %}
+{% set skipping_flex_decoder = (field_decoder, tag_skipper) %}
 
 {% macro struct_serde(struct, serde_methods, obj = "") %}
 {%- set flex = serde_methods|length > 1 %}
@@ -1611,7 +1662,37 @@ void {{ struct.name }}::encode(protocol::encoder& writer, [[maybe_unused]] api_v
 
 
 {%- if op_type == "request" %}
-{%- if first_flex > 0 %}
+{%- if specialized_decoder %}
+template<int16_t Version>
+void {{ struct.name }}::decode_version([[maybe_unused]] protocol::decoder& reader) {
+    // a constant, the version checks of the fields fold away
+    [[maybe_unused]] const api_version version(Version);
+{%- if first_flex == 0 %}
+{{- struct_serde(struct, skipping_flex_decoder) | indent }}
+{%- elif first_flex < 0 %}
+{{- struct_serde(struct, decoder) | indent }}
+{%- else %}
+    if constexpr (Version >= {{ first_flex }}) {
+{{- struct_serde(struct, skipping_flex_decoder) | indent | indent }}
+    } else {
+{{- struct_serde(struct, decoder) | indent | indent }}
+    }
+{%- endif %}
+}
+
+void {{ struct.name }}::decode(protocol::decoder& reader, api_version version) {
+    switch (version()) {
+{%- for v in range(valid_versions.min, valid_versions.max + 1) %}
+    case {{ v }}:
+        decode_version<{{ v }}>(reader);
+        return;
+{%- endfor %}
+    default:
+        throw std::out_of_range(fmt::format(
+          "Unsupported {{ struct.name }} version: {}", version()));
+    }
+}
+{%- elif first_flex > 0 %}
 void {{ struct.name }}::decode(protocol::decoder& reader, api_version version) {
     if (version >= api_version({{ first_flex }})) {
         decode_flex(reader, version);
@@ -1753,7 +1834,7 @@ ALLOWED_SCALAR_TYPES = list(set(SCALAR_TYPES) - set(["iobuf"]))
 ALLOWED_TYPES = \
     ALLOWED_SCALAR_TYPES + \
     [f"[]{t}" for t in ALLOWED_SCALAR_TYPES +
-        STRUCT_TYPES] + TAGGED_WITH_FIELDS
+        STRUCT_TYPES] + STRUCT_TYPES + TAGGED_WITH_FIELDS
 
 # yapf: disable
 SCHEMA = {
@@ -1931,6 +2012,10 @@ def codegen(schema_path):
     # either 'none' or 'VersionRange'
     first_flex = parse_flexible_versions(msg["flexibleVersions"])
 
+    valid_versions = VersionRange(msg["validVersions"])
+    specialized_decoder = op_type == "request" and \
+        struct.name in specialized_decoders
+
     def fail(msg):
         assert False, msg
 
@@ -1941,12 +2026,16 @@ def codegen(schema_path):
         fail=fail,
         api_key=api_key,
         request_name=request_name,
-        first_flex=first_flex)
+        first_flex=first_flex,
+        specialized_decoder=specialized_decoder)
 
-    src = jinja2.Template(SOURCE_TEMPLATE).render(struct=struct,
-                                                  op_type=op_type,
-                                                  fail=fail,
-                                                  first_flex=first_flex)
+    src = jinja2.Template(SOURCE_TEMPLATE).render(
+        struct=struct,
+        op_type=op_type,
+        fail=fail,
+        first_flex=first_flex,
+        valid_versions=valid_versions,
+        specialized_decoder=specialized_decoder)
 
     return hdr, src, struct.headers("source")
 
@@ -223,3 +223,30 @@ SEASTAR_THREAD_TEST_CASE(batch_reader_record_batch_reader_impl_fail_magic) {
           return e.error == kafka::error_code::corrupt_message;
       });
 }
+
+SEASTAR_THREAD_TEST_CASE(batch_serializer_share_records_same_bytes) {
+    auto batches = model::test::make_random_batches(base_offset, many_batches);
+    ss::circular_buffer<model::record_batch> copy;
+    for (auto& b : batches) {
+        copy.push_back(b.copy());
+    }
+
+    auto copied = model::make_memory_record_batch_reader(std::move(batches))
+                    .consume(kafka::kafka_batch_serializer{}, model::no_timeout)
+                    .get();
+    auto shared = model::make_memory_record_batch_reader(std::move(copy))
+                    .consume(
+                      kafka::kafka_batch_serializer{true}, model::no_timeout)
+                    .get();
+
+    BOOST_REQUIRE_EQUAL(copied.record_count, shared.record_count);
+    BOOST_REQUIRE_EQUAL(copied.last_offset, shared.last_offset);
+    BOOST_REQUIRE(copied.data == shared.data);
+
+    auto crs = kafka::batch_reader(std::move(shared.data));
+    while (!crs.empty()) {
+        auto kba = crs.consume_batch();
+        BOOST_REQUIRE(kba.v2_format);
+        BOOST_REQUIRE(kba.valid_crc);
+    }
+}
@@ -64,6 +64,23 @@ SEASTAR_THREAD_TEST_CASE(serde_tags) {
     BOOST_CHECK_EQUAL(iobuf_to_bytes(result), iobuf_to_bytes(copy));
 }
 
+SEASTAR_THREAD_TEST_CASE(skip_tags) {
+    iobuf buf;
+    kafka::tagged_fields::type tags;
+    for (uint32_t i = 0; i < 5; ++i) {
+        tags.emplace(i, random_generators::get_bytes());
+    }
+    kafka::protocol::encoder writer(buf);
+    writer.write_tags(kafka::tagged_fields(std::move(tags)));
+    writer.write(int32_t(42));
+
+    /// The tags are consumed up to the field which follows them
+    kafka::protocol::decoder reader(std::move(buf));
+    reader.skip_tags();
+    BOOST_REQUIRE_EQUAL(reader.read_int32(), 42);
+    BOOST_REQUIRE_EQUAL(reader.bytes_left(), 0);
+}
+
 struct test_struct {
     ss::sstring field_a;
     int32_t field_b;
@@ -207,7 +207,8 @@ struct tag_field_entry {
 
 using tag_field_entries = kafka::type_list<
   tag_field_entry<create_topics_handler, 5, false>,
-  tag_field_entry<api_versions_handler, 3, false>>;
+  tag_field_entry<api_versions_handler, 3, false>,
+  tag_field_entry<produce_handler, 10, false>>;
 
 template<typename T>
 long create_default_and_non_default_data(T& non_default_data, T& default_data);
@@ -248,6 +249,25 @@ long create_default_and_non_default_data(
     return 10;
 }
 
+template<>
+long create_default_and_non_default_data(
+  decltype(produce_response::data)& non_default_data,
+  decltype(produce_response::data)& default_data) {
+    topic_produce_response topic{.name = model::topic{"topic1"}};
+    topic.partitions.push_back(partition_produce_response{
+      .partition_index = model::partition_id{0},
+      .error_code = kafka::error_code::not_leader_for_partition,
+      .current_leader = leader_id_and_epoch{
+        .leader_id = model::node_id{1}, .leader_epoch = leader_epoch{5}}});
+    non_default_data.responses.push_back(std::move(topic));
+
+    default_data = non_default_data;
+    default_data.responses.at(0).partitions.at(0).current_leader = {};
+
+    // 2 x int32 (8 bytes) + struct tags (1 byte) + tag (2 bytes)
+    return 11;
+}
+
 template<typename T>
 bool validate_buffer_against_data(
   const T& check_data, api_version version, const bytes& buffer) {
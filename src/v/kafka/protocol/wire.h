@@ -25,6 +25,8 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <cstring>
 #include <optional>
 #include <type_traits>
 
@@ -270,6 +272,26 @@ public:
         return tagged_fields(std::move(tags));
     }
 
+    // Only relevent when reading flex requests, consumes the tags without
+    // keeping a copy of them
+    void skip_tags() {
+        auto num_tags = read_unsigned_varint();
+        int64_t prev_tag_id = -1;
+        while (num_tags-- > 0) {
+            auto id = read_unsigned_varint();
+            if (id <= prev_tag_id) {
+                throw std::out_of_range(fmt::format(
+                  "Protocol error encountered when skipping tags, tags must be "
+                  "serialized in ascending order with no duplicates, tag: {}",
+                  id));
+            }
+            prev_tag_id = id;
+            _parser.skip(read_unsigned_varint());
+        }
+    }
+
+    void skip(size_t n) { _parser.skip(n); }
+
     void consume_unknown_tag(tagged_fields& fields, uint32_t id, size_t n) {
         tagged_fields::type fs(std::move(fields));
         auto [_, succeded] = fs.emplace(tag_id(id), _parser.read_bytes(n));
@@ -341,7 +363,8 @@ concept SizedContainer = requires(C c, const C cc) {
 };
 
 class encoder;
-void writer_serialize_batch(encoder& w, model::record_batch&& batch);
+void writer_serialize_batch(
+  encoder& w, model::record_batch&& batch, bool share_records = false);
 
 class encoder {
     template<typename ExplicitIntegerType, typename IntegerType>
@@ -520,6 +543,20 @@ public:
         return size;
     }
 
+    // write raw bytes directly to output without a length prefix
+    uint32_t write_direct(const char* data, size_t size) {
+        _out->append(data, size);
+        return size;
+    }
+
+    // like write_direct but always shares the fragments of \p f with the
+    // output instead of possibly copying small fragments
+    uint32_t write_direct_shared(iobuf&& f) {
+        auto size = f.size_bytes();
+        _out->append_fragments(std::move(f));
+        return size;
+    }
+
     template<typename T, typename Tag>
     uint32_t write(const named_type<T, Tag>& t) {
         return write(t());
@@ -673,7 +710,26 @@ private:
     iobuf* _out;
 };
 
-inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
+namespace detail {
+
+template<typename T>
+inline char* write_be(char* out, T v) {
+    auto nv = ss::cpu_to_be(v);
+    std::memcpy(out, &nv, sizeof(nv));
+    return out + sizeof(nv);
+}
+
+} // namespace detail
+
+/*
+ * record payloads at least this large are shared with the output when
+ * share_records is requested. smaller payloads are copied since sharing a
+ * fragment pins the entire underlying read buffer.
+ */
+inline constexpr size_t share_records_min_bytes = 4096;
+
+inline void writer_serialize_batch(
+  encoder& w, model::record_batch&& batch, bool share_records) {
     /*
      * calculate batch size expected by kafka client.
      *
@@ -694,21 +750,36 @@ inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
                 + internal::kafka_header_size - sizeof(int64_t)
                 - sizeof(int32_t);
 
-    w.write(int64_t(batch.base_offset()));
-    w.write(int32_t(size)); // batch length
-    w.write(
+    /*
+     * the header is assembled on the stack and appended in one go, rather
+     * than appending each of its fields to the output separately.
+     */
+    const auto& hdr = batch.header();
+    std::array<char, internal::kafka_header_size> buf;
+    char* out = buf.data();
+    out = detail::write_be(out, int64_t(batch.base_offset()));
+    out = detail::write_be(out, int32_t(size)); // batch length
+    out = detail::write_be(
+      out,
       int32_t(leader_epoch_from_term(batch.term()))); // partition leader epoch
-    w.write(int8_t(2));                               // magic
-    w.write(batch.header().crc);
-    w.write(int16_t(batch.header().attrs.value()));
-    w.write(int32_t(batch.header().last_offset_delta));
-    w.write(int64_t(batch.header().first_timestamp.value()));
-    w.write(int64_t(batch.header().max_timestamp.value()));
-    w.write(int64_t(batch.header().producer_id));
-    w.write(int16_t(batch.header().producer_epoch));
-    w.write(int32_t(batch.header().base_sequence));
-    w.write(int32_t(batch.record_count()));
-    w.write_direct(std::move(batch).release_data());
+    out = detail::write_be(out, int8_t(2));           // magic
+    out = detail::write_be(out, int32_t(hdr.crc));
+    out = detail::write_be(out, int16_t(hdr.attrs.value()));
+    out = detail::write_be(out, int32_t(hdr.last_offset_delta));
+    out = detail::write_be(out, int64_t(hdr.first_timestamp.value()));
+    out = detail::write_be(out, int64_t(hdr.max_timestamp.value()));
+    out = detail::write_be(out, int64_t(hdr.producer_id));
+    out = detail::write_be(out, int16_t(hdr.producer_epoch));
+    out = detail::write_be(out, int32_t(hdr.base_sequence));
+    out = detail::write_be(out, int32_t(batch.record_count()));
+    w.write_direct(buf.data(), buf.size());
+
+    auto records = std::move(batch).release_data();
+    if (share_records && records.size_bytes() >= share_records_min_bytes) {
+        w.write_direct_shared(std::move(records));
+    } else {
+        w.write_direct(std::move(records));
+    }
 }
 
 } // namespace kafka::protocol
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/admission_controller.h"
+
+#include "kafka/protocol/produce.h"
+#include "kafka/server/handlers/handler_interface.h"
+
+#include <algorithm>
+
+namespace kafka {
+
+admission_controller::admission_controller(
+  config::binding<std::optional<std::chrono::milliseconds>> target,
+  config::binding<std::chrono::milliseconds> max_delay,
+  config::conversion_binding<std::vector<bool>, std::vector<ss::sstring>>
+    api_keys)
+  : _target(std::move(target))
+  , _max_delay(std::move(max_delay))
+  , _api_keys(std::move(api_keys))
+  , _latency_us(max_api_key() + 1, 0.0) {}
+
+void admission_controller::record(api_key key, clock::duration latency) {
+    if (key() < 0 || static_cast<size_t>(key()) >= _latency_us.size()) {
+        return;
+    }
+    auto sample = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    auto& avg = _latency_us[key()];
+    avg = avg == 0.0 ? sample
+                     : latency_alpha * sample + (1.0 - latency_alpha) * avg;
+}
+
+admission_controller::delay_clock::duration
+admission_controller::delay(api_key key) {
+    const auto& target = _target();
+    if (!target || target->count() <= 0) {
+        return delay_clock::duration::zero();
+    }
+    const auto& low_priority = _api_keys();
+    if (
+      key() < 0 || static_cast<size_t>(key()) >= low_priority.size()
+      || !low_priority[key()]) {
+        return delay_clock::duration::zero();
+    }
+
+    auto target_us = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(*target).count());
+    auto excess = _latency_us[produce_api::key()] / target_us - 1.0;
+    if (excess <= 0.0) {
+        return delay_clock::duration::zero();
+    }
+    ++_throttled;
+    auto max = std::chrono::duration_cast<delay_clock::duration>(_max_delay());
+    return std::chrono::duration_cast<delay_clock::duration>(
+      max * std::min(excess, 1.0));
+}
+
+admission_controller::clock::duration
+admission_controller::latency(api_key key) const {
+    if (key() < 0 || static_cast<size_t>(key()) >= _latency_us.size()) {
+        return clock::duration::zero();
+    }
+    return std::chrono::duration_cast<clock::duration>(
+      std::chrono::duration<double, std::micro>(_latency_us[key()]));
+}
+
+} // namespace kafka
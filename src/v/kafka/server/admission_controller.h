@@ -0,0 +1,78 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "kafka/protocol/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/lowres_clock.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Shard-level admission control driven by the end-to-end latency of the
+ * kafka requests, from their admission to the write of their response.
+ *
+ * The latency is tracked per API with an exponential moving average. Once
+ * the produce latency is over the target
+ * (kafka_admission_control_target_latency_ms), the requests of the low
+ * priority APIs (kafka_admission_control_api_keys) are throttled before
+ * they reserve any memory: they are delayed in the broker and the delay is
+ * reported to the client in throttle_time_ms. The delay grows linearly with
+ * the excess latency and reaches kafka_admission_control_max_delay_ms when
+ * the produce latency is twice the target.
+ *
+ * Without it, an overloaded broker accepts work until the memory semaphores
+ * block, and the latency of every request grows without a bound.
+ */
+class admission_controller {
+public:
+    using clock = std::chrono::steady_clock;
+    using delay_clock = ss::lowres_clock;
+
+    admission_controller(
+      config::binding<std::optional<std::chrono::milliseconds>> target,
+      config::binding<std::chrono::milliseconds> max_delay,
+      config::conversion_binding<std::vector<bool>, std::vector<ss::sstring>>
+        api_keys);
+
+    /// Record the end-to-end latency of a request of \p key.
+    void record(api_key key, clock::duration latency);
+
+    /// The delay to apply to a new request of \p key, zero to admit it now.
+    delay_clock::duration delay(api_key key);
+
+    /// The average latency of the requests of \p key.
+    clock::duration latency(api_key key) const;
+
+    /// The number of requests delayed so far.
+    uint64_t throttled() const { return _throttled; }
+
+private:
+    // weight of a new sample in the moving average of the latency
+    static constexpr double latency_alpha = 0.05;
+
+    config::binding<std::optional<std::chrono::milliseconds>> _target;
+    config::binding<std::chrono::milliseconds> _max_delay;
+    config::conversion_binding<std::vector<bool>, std::vector<ss::sstring>>
+      _api_keys;
+    // the moving average of the latencies in microseconds, by api key
+    std::vector<double> _latency_us;
+    uint64_t _throttled{0};
+};
+
+} // namespace kafka
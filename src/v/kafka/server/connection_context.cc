@@ -433,12 +433,20 @@ connection_context::record_tp_and_calculate_throttle(
           *_snc_quota_context, now);
     }
 
+    // Throttle low priority requests on the shard's produce latency, the
+    // delay is both applied now and reported to the client
+    const clock::duration admission_delay = _server.admission().delay(
+      hdr.key);
+
     // Sum up
     const clock::duration delay_enforce = std::max(
-      shard_delays.enforce, client_quota_delay.enforce_duration());
+      {shard_delays.enforce,
+       client_quota_delay.enforce_duration(),
+       admission_delay});
     const clock::duration delay_request = std::max(
       {shard_delays.request,
        client_quota_delay.duration,
+       admission_delay,
        clock::duration::zero()});
     if (
       delay_enforce != clock::duration::zero()
@@ -446,13 +454,15 @@ connection_context::record_tp_and_calculate_throttle(
         vlog(
           klog.trace,
           "[{}:{}] throttle request:{{snc:{}, client:{}}}, "
-          "enforce:{{snc:{}, client:{}}}, key:{}, request_size:{}",
+          "enforce:{{snc:{}, client:{}}}, admission:{}, key:{}, "
+          "request_size:{}",
           _client_addr,
           client_port(),
           shard_delays.request,
           client_quota_delay.duration,
           shard_delays.enforce,
           client_quota_delay.enforce_duration(),
+          admission_delay,
           hdr.key,
           request_size);
     }
@@ -539,7 +549,9 @@ connection_context::reserve_request_units(api_key key, size_t size) {
 
 ss::future<>
 connection_context::dispatch_method_once(request_header hdr, size_t size) {
+    const auto received_at = std::chrono::steady_clock::now();
     auto sres_in = co_await throttle_request(hdr, size);
+    sres_in.received_at = received_at;
     if (abort_requested()) {
         // protect against shutdown behavior
         co_return;
@@ -679,6 +691,12 @@ ss::future<> connection_context::handle_response(
     self->conn->shutdown_input();
 }
 
+void connection_context::record_latency(const session_resources& r) {
+    _server.admission().record(
+      r.request_data.request_key,
+      std::chrono::steady_clock::now() - r.received_at);
+}
+
 /**
  * This method processes as many responses as possible, in request order. Since
  * we proces the second stage asynchronously within a given connection, reponses
@@ -707,6 +725,7 @@ ss::future<> connection_context::maybe_process_responses() {
         _responses.erase(it);
 
         if (resp_and_res.response->is_noop()) {
+            record_latency(*resp_and_res.resources);
             return ss::make_ready_future<ss::stop_iteration>(
               ss::stop_iteration::no);
         }
@@ -742,7 +761,9 @@ ss::future<> connection_context::maybe_process_responses() {
               })
               // release the resources only once it has been written to the
               // connection.
-              .finally([resources = resp_and_res.resources] {});
+              .finally([this, resources = resp_and_res.resources] {
+                  record_latency(*resources);
+              });
         } catch (...) {
             resp_and_res.resources->tracker->mark_errored();
             vlog(
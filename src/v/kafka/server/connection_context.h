@@ -118,6 +118,8 @@ struct session_resources {
     std::unique_ptr<handler_probe::hist_t::measurement> handler_latency;
     std::unique_ptr<request_tracker> tracker;
     request_data request_data;
+    // when the request was received, for the end-to-end latency
+    std::chrono::steady_clock::time_point received_at;
 };
 
 class connection_context final
@@ -171,14 +173,6 @@ public:
 
     bool tls_enabled() const { return conn->tls_enabled(); }
 
-private:
-    template<typename T>
-    security::auth_result authorized_user(
-      security::acl_principal principal,
-      security::acl_operation operation,
-      const T& name,
-      authz_quiet quiet);
-
     security::acl_principal get_principal() const {
         if (_mtls_state) {
             return _mtls_state->principal();
@@ -189,8 +183,19 @@ private:
         return security::acl_principal{security::principal_type::user, {}};
     }
 
+private:
+    template<typename T>
+    security::auth_result authorized_user(
+      security::acl_principal principal,
+      security::acl_operation operation,
+      const T& name,
+      authz_quiet quiet);
+
     bool is_finished_parsing() const;
 
+    /// Record the end-to-end latency of a request for admission control.
+    void record_latency(const session_resources&);
+
     // Reserve units from memory from the memory semaphore in proportion
     // to the number of bytes the request procesisng is expected to
     // take.
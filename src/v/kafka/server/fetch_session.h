@@ -126,13 +126,19 @@ public:
           "Can not insert {} to partitions map as it is already present.",
           it->second->partition.topic_partition);
         insertion_order.push_back(*it->second);
+        entries_mem_usage += entry_mem_usage(*it->second);
     }
 
     bool contains(model::topic_partition_view v) {
         return partitions.contains(v);
     }
 
-    void erase(model::topic_partition_view v) { partitions.erase(v); }
+    void erase(model::topic_partition_view v) {
+        if (auto it = partitions.find(v); it != partitions.end()) {
+            entries_mem_usage -= entry_mem_usage(*it->second);
+            partitions.erase(it);
+        }
+    }
 
     iterator find(model::topic_partition_view v) { return partitions.find(v); }
 
@@ -152,11 +158,10 @@ public:
         return make_partition_iterator(insertion_order.cend());
     }
 
-    size_t mem_usage() {
+    size_t mem_usage() const {
         using debug = absl::container_internal::hashtable_debug_internal::
           HashtableDebugAccess<underlying_t>;
-        return debug::AllocatedByteSize(partitions)
-               + partitions.size() * sizeof(fetch_session_partition);
+        return debug::AllocatedByteSize(partitions) + entries_mem_usage;
     }
 
     void move_to_end(iterator it) {
@@ -174,8 +179,18 @@ public:
     underlying_t::const_iterator cend() { return partitions.cend(); }
 
 private:
+    static size_t entry_mem_usage(const entry& e) {
+        // short topic names are stored inline by sstring
+        constexpr size_t max_inline_size = 15;
+        const auto& topic = e.partition.topic_partition.get_topic()();
+        return sizeof(entry)
+               + (topic.size() > max_inline_size ? topic.size() + 1 : 0);
+    }
+
     underlying_t partitions;
     intrusive_list<entry, &entry::_hook> insertion_order;
+    // memory used by the entries, including the topic names
+    size_t entries_mem_usage{0};
 };
 
 inline fetch_session_epoch next_epoch(fetch_session_epoch current) {
@@ -214,7 +229,7 @@ public:
 
     bool is_locked() const { return _locked; }
 
-    size_t mem_usage() {
+    size_t mem_usage() const {
         return sizeof(fetch_session) + _partitions.mem_usage();
     }
 
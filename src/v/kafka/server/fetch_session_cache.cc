@@ -51,6 +51,14 @@ void update_fetch_session(fetch_session& session, const fetch_request& req) {
     }
 }
 
+static size_t full_fetch_partition_count(const fetch_request& req) {
+    size_t count = 0;
+    for (const auto& t : req.data.topics) {
+        count += t.fetch_partitions.size();
+    }
+    return count;
+}
+
 fetch_session_cache::fetch_session_cache(
   std::chrono::milliseconds eviction_timeout)
   : _min_session_id(max_sessions_per_core() * seastar::this_shard_id())
@@ -87,6 +95,7 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
             // session.
             return fetch_session_ctx{};
         }
+        maybe_evict_for(full_fetch_partition_count(req));
         // create new session
         auto new_id = new_session_id();
         if (!new_id) {
@@ -179,6 +188,43 @@ void fetch_session_cache::gc_sessions() {
     }
 }
 
+void fetch_session_cache::maybe_evict_for(size_t partition_count) {
+    if (likely(mem_usage() <= max_mem_usage)) {
+        return;
+    }
+    gc_sessions();
+    /**
+     * Evict the least recently used sessions that are smaller than the new
+     * one. A session that is about to be created is likely to be used by an
+     * active consumer while stale sessions are only reclaimed by the periodic
+     * gc, preferring bigger sessions keeps the ones saving most of the
+     * response size.
+     */
+    while (mem_usage() > max_mem_usage) {
+        auto victim = _sessions.end();
+        for (auto it = _sessions.begin(); it != _sessions.end(); ++it) {
+            const auto& s = *it->second;
+            if (s.is_locked() || s.partitions().size() >= partition_count) {
+                continue;
+            }
+            if (
+              victim == _sessions.end()
+              || s._last_used < victim->second->_last_used) {
+                victim = it;
+            }
+        }
+        if (victim == _sessions.end()) {
+            return;
+        }
+        vlog(
+          klog.debug,
+          "evicting session {} to make room for a new session",
+          victim->second->id());
+        _sessions_mem_usage -= victim->second->mem_usage();
+        _sessions.erase(victim);
+    }
+}
+
 void fetch_session_cache::register_metrics() {
     if (config::shard_local_cfg().disable_metrics()) {
         return;
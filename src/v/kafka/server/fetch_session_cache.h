@@ -31,8 +31,9 @@ struct fetch_request;
  * for the node (non overlapping ranges of ids are assigned to each core).
  *
  * The cache evicts not used sessions after configurable period of inactivity.
- * Fetch session cache will stop adding new sessions after its max memory usage
- * is reached.
+ * When its max memory usage is reached the cache makes room for a new session
+ * by evicting the least recently used sessions tracking fewer partitions than
+ * the new one, if there are none the new session is not created.
  **/
 class fetch_session_cache {
 public:
@@ -57,6 +58,7 @@ private:
 
     std::optional<fetch_session_id> new_session_id();
     void gc_sessions();
+    void maybe_evict_for(size_t partition_count);
 
     size_t mem_usage() const {
         using debug = absl::container_internal::hashtable_debug_internal::
@@ -55,7 +55,8 @@ group::group(
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
   group_metadata_serializer serializer,
-  enable_group_metrics group_metrics)
+  enable_group_metrics group_metrics,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher)
   : _id(std::move(id))
   , _state(s)
   , _state_timestamp(model::timestamp::now())
@@ -65,6 +66,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -92,7 +94,8 @@ group::group(
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
   group_metadata_serializer serializer,
-  enable_group_metrics group_metrics)
+  enable_group_metrics group_metrics,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher)
   : _id(std::move(id))
   , _state(md.members.empty() ? group_state::empty : group_state::stable)
   , _state_timestamp(
@@ -108,6 +111,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -209,7 +213,9 @@ group_state group::set_state(group_state s) {
       s);
     vlog(_ctxlog.trace, "Changing state from {} to {}", _state, s);
     _state_timestamp = model::timestamp::now();
-    return std::exchange(_state, s);
+    auto prev = std::exchange(_state, s);
+    summary_changed();
+    return prev;
 }
 
 bool group::supports_protocols(const join_group_request& r) const {
@@ -277,6 +283,7 @@ void group::add_member_no_join(member_ptr member) {
     for (auto& p : member->protocols()) {
         _supported_protocols[p.name]++;
     }
+    summary_changed();
 }
 
 ss::future<join_group_response> group::add_member(member_ptr member) {
@@ -355,17 +362,16 @@ std::vector<member_config> group::member_metadata() const {
     }
 
     std::vector<member_config> out;
+    out.reserve(_members.size());
     std::transform(
       std::cbegin(_members),
       std::cend(_members),
       std::back_inserter(out),
       [this](const member_map::value_type& m) {
-          auto& group_inst = m.second->group_instance_id();
-          auto metadata = m.second->get_protocol_metadata(_protocol.value());
           return member_config{
             .member_id = m.first,
-            .group_instance_id = group_inst,
-            .metadata = std::move(metadata)};
+            .group_instance_id = m.second->group_instance_id(),
+            .metadata = m.second->get_protocol_metadata(_protocol.value())};
       });
     return out;
 }
@@ -1051,6 +1057,7 @@ void group::complete_join() {
     // <kafka>remove dynamic members who haven't joined the group yet</kafka>
     // this is the old group->remove_unjoined_members();
     const auto prev_leader = _leader;
+    const auto members = _members.size();
     for (auto it = _members.begin(); it != _members.end();) {
         if (!it->second->is_joining() && !it->second->is_static()) {
             vlog(_ctxlog.trace, "Removing unjoined member {}", it->first);
@@ -1084,6 +1091,9 @@ void group::complete_join() {
             ++it;
         }
     }
+    if (_members.size() != members) {
+        summary_changed();
+    }
 
     if (_leader != prev_leader) {
         vlog(
@@ -1287,6 +1297,7 @@ void group::remove_member(member_ptr member) {
             _static_members.erase(it->second->group_instance_id().value());
         }
         _members.erase(it);
+        summary_changed();
     }
 
     const auto prev_leader = _leader;
@@ -1415,8 +1426,9 @@ group::sync_group_stages group::handle_sync_group(sync_group_request&& r) {
 }
 
 model::record_batch group::checkpoint(const assignments_type& assignments) {
-    return do_checkpoint(
-      [&assignments](const member_id& id) { return assignments.at(id); });
+    return do_checkpoint([&assignments](const member_id& id) {
+        return bytes_to_iobuf(assignments.at(id));
+    });
 }
 
 model::record_batch group::checkpoint() {
@@ -1427,7 +1439,7 @@ model::record_batch group::checkpoint() {
           "Checkpointed member {} must be part of the group {}",
           id,
           *this);
-        return it->second->assignment();
+        return it->second->share_assignment();
     });
 }
 
@@ -2285,15 +2297,7 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
         }
     }
 
-    auto batch = std::move(builder).build();
-    auto reader = model::make_memory_record_batch_reader(std::move(batch));
-
-    auto replicate_stages = _partition->raft()->replicate_in_stages(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
-
-    auto f = replicate_stages.replicate_finished.then(
+    auto on_replicated =
       [this, req = std::move(r), commits = std::move(offset_commits)](
         result<raft::replicate_result> r) mutable {
           auto error = error_code::none;
@@ -2320,7 +2324,25 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
           }
 
           return offset_commit_response(req, error);
-      });
+      };
+
+    auto batch = std::move(builder).build();
+    if (_commit_batcher && _commit_batcher->is_enabled()) {
+        // commits are ordered once they are handed over to the batcher
+        auto f = _commit_batcher->replicate(_term, std::move(batch))
+                   .then(std::move(on_replicated));
+        return {ss::now(), std::move(f)};
+    }
+
+    auto reader = model::make_memory_record_batch_reader(std::move(batch));
+
+    auto replicate_stages = _partition->raft()->replicate_in_stages(
+      _term,
+      std::move(reader),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+
+    auto f = replicate_stages.replicate_finished.then(
+      std::move(on_replicated));
     return {std::move(replicate_stages.request_enqueued), std::move(f)};
 }
 
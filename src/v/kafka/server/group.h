@@ -22,6 +22,7 @@
 #include "kafka/server/group_metadata.h"
 #include "kafka/server/logger.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -36,6 +37,7 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/util/bool_class.hh>
 #include <seastar/util/log.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <absl/container/node_hash_map.h>
 #include <absl/container/node_hash_set.h>
@@ -208,7 +210,8 @@ public:
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
       group_metadata_serializer,
-      enable_group_metrics);
+      enable_group_metrics,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher = nullptr);
 
     // constructor used when loading state from log
     group(
@@ -221,7 +224,8 @@ public:
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
       group_metadata_serializer,
-      enable_group_metrics);
+      enable_group_metrics,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher = nullptr);
 
     /// Get the group id.
     const kafka::group_id& id() const { return _id; }
@@ -259,6 +263,16 @@ public:
     /// Check if the group has members.
     bool has_members() const { return !_members.empty(); }
 
+    /// Number of members of the group.
+    size_t member_count() const { return _members.size(); }
+
+    /// Invoked when the protocol type, the state or the members of the group
+    /// change. The group_manager keeps the group index up to date with it.
+    using summary_listener = ss::noncopyable_function<void(const group&)>;
+    void set_summary_listener(summary_listener l) {
+        _summary_listener = std::move(l);
+    }
+
     /// Check if all members have joined.
     bool all_members_joined() const {
         vassert(
@@ -789,15 +803,26 @@ private:
         metadata.state_timestamp = _state_timestamp.value_or(
           model::timestamp(-1));
 
+        metadata.members.reserve(_members.size());
         for (const auto& [id, member] : _members) {
-            auto state = member->state().copy();
+            // the assignment and subscription are filled in below, copying
+            // them from the member state would be wasted work.
+            const auto& current = member->state();
+            metadata.members.push_back(member_state{
+              .id = current.id,
+              .instance_id = current.instance_id,
+              .client_id = current.client_id,
+              .client_host = current.client_host,
+              .rebalance_timeout = current.rebalance_timeout,
+              .session_timeout = current.session_timeout,
+            });
+            auto& state = metadata.members.back();
             // this is not coming from the member itself because the checkpoint
             // occurs right before the members go live and get their
             // assignments.
-            state.assignment = bytes_to_iobuf(assignments_provider(id));
+            state.assignment = assignments_provider(id);
             state.subscription = bytes_to_iobuf(
               member->get_protocol_metadata(_protocol.value()));
-            metadata.members.push_back(std::move(state));
         }
 
         cluster::simple_batch_builder builder(
@@ -893,6 +918,12 @@ private:
     std::vector<model::topic_partition>
     get_expired_offsets(std::chrono::seconds retention_period);
 
+    void summary_changed() {
+        if (_summary_listener) {
+            _summary_listener(*this);
+        }
+    }
+
     kafka::group_id _id;
     group_state _state;
     std::optional<model::timestamp> _state_timestamp;
@@ -911,6 +942,9 @@ private:
     config::configuration& _conf;
     ss::lw_shared_ptr<ssx::rwlock> _catchup_lock;
     ss::lw_shared_ptr<cluster::partition> _partition;
+    // coalesces offset commits of the groups of the partition, when enabled
+    ss::lw_shared_ptr<offset_commit_batcher> _commit_batcher;
+    summary_listener _summary_listener;
     absl::node_hash_map<
       model::topic_partition,
       std::unique_ptr<offset_metadata_with_probe>>
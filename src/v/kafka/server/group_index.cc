@@ -0,0 +1,47 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/group_index.h"
+
+namespace kafka {
+
+void group_index::upsert(group_id g, entry e) {
+    _groups.insert_or_assign(std::move(g), std::move(e));
+}
+
+void group_index::remove(const group_id& g, ss::shard_id shard) {
+    auto it = _groups.find(g);
+    if (it != _groups.end() && it->second.shard == shard) {
+        _groups.erase(it);
+    }
+}
+
+void group_index::set_loading(ss::shard_id shard, bool loading) {
+    if (loading) {
+        _loading.insert(shard);
+    } else {
+        _loading.erase(shard);
+    }
+}
+
+std::pair<error_code, std::vector<listed_group>>
+group_index::list_groups() const {
+    std::vector<listed_group> groups;
+    groups.reserve(_groups.size());
+    for (const auto& [id, e] : _groups) {
+        groups.push_back({id, e.protocol});
+    }
+    auto error = _loading.empty() ? error_code::none
+                                  : error_code::coordinator_load_in_progress;
+    return std::make_pair(error, std::move(groups));
+}
+
+} // namespace kafka
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "kafka/protocol/errors.h"
+#include "kafka/protocol/list_groups.h"
+#include "kafka/server/group.h"
+#include "kafka/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/smp.hh>
+
+#include <absl/container/flat_hash_set.h>
+#include <absl/container/node_hash_map.h>
+
+#include <vector>
+
+namespace kafka {
+
+/**
+ * The groups coordinated by the node, with their protocol type, state and
+ * number of members.
+ *
+ * The index of the node is kept by the group_manager of shard 0, every shard
+ * sends it the changes of its groups as they happen. ListGroups is answered
+ * from the index rather than from the group_managers of every shard, which
+ * monitoring tools call all the time.
+ *
+ * A group moves between shards when its coordinator partition does: the
+ * group is added by the new shard and removed by the old one, in any order,
+ * so an entry is only removed by the shard it belongs to.
+ */
+class group_index {
+public:
+    struct entry {
+        protocol_type protocol;
+        group_state state{group_state::empty};
+        size_t members{0};
+        ss::shard_id shard{0};
+    };
+
+    static entry make_entry(const group& g) {
+        return {
+          .protocol = g.protocol_type().value_or(protocol_type()),
+          .state = g.state(),
+          .members = g.member_count(),
+          .shard = ss::this_shard_id()};
+    }
+
+    void upsert(group_id, entry);
+    void remove(const group_id&, ss::shard_id);
+
+    /// Set if the groups of \p shard are being loaded, the index of that
+    /// shard is incomplete until they are.
+    void set_loading(ss::shard_id shard, bool loading);
+
+    /// As group_manager::list_groups() for every shard of the node.
+    std::pair<error_code, std::vector<listed_group>> list_groups() const;
+
+    const entry* find(const group_id& g) const {
+        auto it = _groups.find(g);
+        return it == _groups.end() ? nullptr : &it->second;
+    }
+
+    size_t size() const { return _groups.size(); }
+
+private:
+    absl::node_hash_map<group_id, entry> _groups;
+    absl::flat_hash_set<ss::shard_id> _loading;
+};
+
+} // namespace kafka
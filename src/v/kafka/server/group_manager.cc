@@ -25,14 +25,18 @@
 #include "kafka/protocol/offset_fetch.h"
 #include "kafka/protocol/wire.h"
 #include "kafka/server/group_metadata.h"
+#include "kafka/server/group_recovery_checkpoint.h"
 #include "kafka/server/group_recovery_consumer.h"
 #include "kafka/server/logger.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
 #include "model/record.h"
+#include "model/timeout_clock.h"
 #include "raft/errc.h"
 #include "raft/types.h"
 #include "resource_mgmt/io_priority.h"
+#include "serde/serde.h"
+#include "serde/serde_exception.h"
 #include "ssx/future-util.h"
 
 #include <seastar/core/abort_source.hh>
@@ -68,7 +72,9 @@ group_manager::group_manager(
   , _conf(config::shard_local_cfg())
   , _self(cluster::make_self_broker(config::node()))
   , _enable_group_metrics(enable_metrics)
-  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind()) {}
+  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind())
+  , _recovery_checkpoint_interval(
+      _conf.group_recovery_checkpoint_interval_ms.bind()) {}
 
 ss::future<> group_manager::start() {
     /*
@@ -139,6 +145,22 @@ ss::future<> group_manager::start() {
         }
     });
 
+    /*
+     * periodically checkpoint the materialized state of the groups to speed
+     * up the recovery on leadership changes.
+     */
+    _checkpoint_timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] {
+            return write_recovery_checkpoints().finally(
+              [this] { arm_checkpoint_timer(); });
+        });
+    });
+    arm_checkpoint_timer();
+    _recovery_checkpoint_interval.watch([this] {
+        _checkpoint_timer.cancel();
+        arm_checkpoint_timer();
+    });
+
     return ss::make_ready_future<>();
 }
 /*
@@ -298,6 +320,7 @@ ss::future<size_t> group_manager::delete_offsets(
         auto it = _groups.find(group->id());
         if (it != _groups.end() && it->second == group) {
             co_await it->second->shutdown();
+            unindex_group(it->second);
             _groups.erase(it);
             if (group->generation() > 0) {
                 vlog(
@@ -392,6 +415,7 @@ ss::future<> group_manager::stop() {
     }
 
     _timer.cancel();
+    _checkpoint_timer.cancel();
 
     return _gate.close().then([this]() {
         /**
@@ -399,6 +423,11 @@ ss::future<> group_manager::stop() {
          */
         return ss::do_for_each(
                  _groups, [](auto& p) { return p.second->shutdown(); })
+          .then([this] {
+              return ss::do_for_each(_partitions, [](auto& p) {
+                  return p.second->commit_batcher->stop();
+              });
+          })
           .then([this] { _partitions.clear(); });
     });
 }
@@ -424,6 +453,7 @@ ss::future<> group_manager::do_detach_partition(model::ntp ntp) {
     for (auto g_it = _groups.begin(); g_it != _groups.end();) {
         if (g_it->second->partition()->ntp() == p->partition->ntp()) {
             groups_for_shutdown.push_back(g_it->second);
+            unindex_group(g_it->second);
             _groups.erase(g_it++);
             continue;
         }
@@ -436,20 +466,24 @@ ss::future<> group_manager::do_detach_partition(model::ntp ntp) {
         p->as.request_abort();
     }
     _partitions.erase(ntp);
+    publish_loading();
     _partitions.rehash(0);
 
+    co_await p->commit_batcher->stop();
     co_await shutdown_groups(std::move(groups_for_shutdown));
 }
 
 void group_manager::attach_partition(ss::lw_shared_ptr<cluster::partition> p) {
     klog.debug("attaching group metadata partition {}", p->ntp());
-    auto attached = ss::make_lw_shared<attached_partition>(p);
+    auto attached = ss::make_lw_shared<attached_partition>(
+      p, _conf.group_offset_commit_coalesce_ms.bind());
     auto res = _partitions.try_emplace(p->ntp(), attached);
     // TODO: this is not a forever assertion. this should just generally never
     // happen _now_ because we don't support partition migration / removal.
     // however, group manager is also not prepared for such scenarios.
     vassert(
       res.second, "double registration of ntp in group manager {}", p->ntp());
+    publish_loading();
     _partitions.rehash(0);
 }
 
@@ -480,6 +514,7 @@ ss::future<> group_manager::cleanup_removed_topic_partitions(
                         return ss::now();
                     }
                     vlog(klog.trace, "Removed group {}", g);
+                    unindex_group(it->second);
                     _groups.erase(it);
                     _groups.rehash(0);
                     return ss::now();
@@ -540,7 +575,7 @@ void group_manager::handle_leader_change(
              * above.
              */
             if (leader == _self.id()) {
-                it->second->loading = true;
+                set_loading(*it->second, true);
             }
             return ss::with_semaphore(
                      it->second->sem,
@@ -594,6 +629,7 @@ group_manager::gc_partition_state(ss::lw_shared_ptr<attached_partition> p) {
         if (it->second->partition()->ntp() == p->partition->ntp()) {
             groups_for_shutdown.push_back(it->second);
             vlog(klog.trace, "Removed group {}", it->second);
+            unindex_group(it->second);
             _groups.erase(it++);
             continue;
         }
@@ -609,7 +645,7 @@ ss::future<> group_manager::reload_groups() {
     for (auto& [ntp, attached] : _partitions) {
         auto leader = attached->partition->get_leader_id();
         if (leader == _self.id()) {
-            attached->loading = true;
+            set_loading(*attached, true);
         }
         auto term = attached->partition->term();
         auto f = ss::with_semaphore(
@@ -793,13 +829,13 @@ ss::future<> group_manager::handle_partition_leader_change(
   ss::lw_shared_ptr<attached_partition> p,
   std::optional<model::node_id> leader_id) {
     if (leader_id != _self.id()) {
-        p->loading = false;
+        set_loading(*p, false);
         return gc_partition_state(p);
     }
 
     vlog(klog.trace, "Recovering groups of {}", p->partition->ntp());
 
-    p->loading = true;
+    set_loading(*p, true);
     auto timeout
       = ss::lowres_clock::now()
         + config::shard_local_cfg().kafka_group_recovery_timeout_ms();
@@ -823,45 +859,177 @@ ss::future<> group_manager::handle_partition_leader_change(
                       "unable to recover group");
                 }
 
-                /*
-                 * the full log is read and deduplicated. the dedupe
-                 * processing is based on the record keys, so this code
-                 * should be ready to transparently take advantage of
-                 * key-based compaction in the future.
-                 */
-                storage::log_reader_config reader_config(
-                  p->partition->raft_start_offset(),
-                  model::model_limits<model::offset>::max(),
-                  0,
-                  std::numeric_limits<size_t>::max(),
-                  kafka_read_priority(),
-                  std::nullopt,
-                  std::nullopt,
-                  std::nullopt);
-
-                return p->partition->make_reader(reader_config)
-                  .then([this, term, p, timeout](
-                          model::record_batch_reader reader) {
-                      return std::move(reader)
-                        .consume(
-                          group_recovery_consumer(_serializer_factory(), p->as),
-                          timeout)
-                        .then([this, term, p](
-                                group_recovery_consumer_state state) {
-                            // avoid trying to recover if we stopped the
-                            // reader because an abort was requested
-                            if (p->as.abort_requested()) {
-                                return ss::make_ready_future<>();
-                            }
-                            return recover_partition(term, p, std::move(state))
-                              .then([p] { p->loading = false; });
-                        });
+                return read_partition_state(
+                         p, model::model_limits<model::offset>::max(), timeout)
+                  .then([this, term, p](group_recovery_consumer_state state) {
+                      // avoid trying to recover if we stopped the
+                      // reader because an abort was requested
+                      if (p->as.abort_requested()) {
+                          return ss::make_ready_future<>();
+                      }
+                      return recover_partition(term, p, std::move(state))
+                        .then([this, p] { set_loading(*p, false); });
                   });
             })
             .finally([unit = std::move(unit)] {});
       });
 }
 
+ss::future<std::optional<group_recovery_checkpoint>>
+group_manager::load_recovery_checkpoint(
+  ss::lw_shared_ptr<attached_partition> p) {
+    std::optional<raft::stm_snapshot> snapshot;
+    try {
+        snapshot = co_await p->checkpoint.load_snapshot();
+    } catch (...) {
+        vlog(
+          p->checkpoint_log.warn,
+          "unable to load group recovery checkpoint - {}",
+          std::current_exception());
+        co_return std::nullopt;
+    }
+    if (!snapshot) {
+        co_return std::nullopt;
+    }
+    if (snapshot->header.version != recovery_checkpoint_version) {
+        vlog(
+          p->checkpoint_log.warn,
+          "skipping group recovery checkpoint with unknown version {}",
+          snapshot->header.version);
+        co_return std::nullopt;
+    }
+    /*
+     * the checkpoint can only be used if the log following it is still
+     * available and it doesn't cover offsets the log no longer has.
+     */
+    const auto last_offset = snapshot->header.offset;
+    if (
+      model::next_offset(last_offset) < p->partition->raft_start_offset()
+      || last_offset > p->partition->dirty_offset()) {
+        vlog(
+          p->checkpoint_log.info,
+          "skipping group recovery checkpoint at {}, log range: [{}, {}]",
+          last_offset,
+          p->partition->raft_start_offset(),
+          p->partition->dirty_offset());
+        co_return std::nullopt;
+    }
+    try {
+        co_return serde::from_iobuf<group_recovery_checkpoint>(
+          std::move(snapshot->data));
+    } catch (const serde::serde_exception& e) {
+        vlog(
+          p->checkpoint_log.warn,
+          "unable to decode group recovery checkpoint - {}",
+          e.what());
+    }
+    co_return std::nullopt;
+}
+
+ss::future<group_recovery_consumer_state> group_manager::read_partition_state(
+  ss::lw_shared_ptr<attached_partition> p,
+  model::offset max_offset,
+  model::timeout_clock::time_point timeout) {
+    /*
+     * the log is read and deduplicated starting from the last recovery
+     * checkpoint, or from its beginning if there is none. the dedupe
+     * processing is based on the record keys, so this code should be ready to
+     * transparently take advantage of key-based compaction in the future.
+     */
+    auto start_offset = p->partition->raft_start_offset();
+    group_recovery_consumer_state initial_state;
+    auto checkpoint = co_await load_recovery_checkpoint(p);
+    if (checkpoint) {
+        vlog(
+          p->checkpoint_log.debug,
+          "recovering groups from checkpoint at {}",
+          checkpoint->last_offset);
+        start_offset = model::next_offset(checkpoint->last_offset);
+        initial_state = std::move(*checkpoint).to_state();
+    }
+
+    storage::log_reader_config reader_config(
+      start_offset,
+      max_offset,
+      0,
+      std::numeric_limits<size_t>::max(),
+      kafka_read_priority(),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt);
+
+    auto reader = co_await p->partition->make_reader(reader_config);
+    co_return co_await std::move(reader).consume(
+      group_recovery_consumer(
+        _serializer_factory(), p->as, std::move(initial_state)),
+      timeout);
+}
+
+ss::future<> group_manager::write_recovery_checkpoint(
+  ss::lw_shared_ptr<attached_partition> p) {
+    // only committed batches are checkpointed as they can not be truncated
+    const auto max_offset = p->partition->committed_offset();
+    if (max_offset < p->partition->raft_start_offset()) {
+        co_return;
+    }
+    if (p->checkpoint_offset && *p->checkpoint_offset >= max_offset) {
+        // nothing was committed since the last checkpoint
+        co_return;
+    }
+
+    auto timeout
+      = ss::lowres_clock::now()
+        + config::shard_local_cfg().kafka_group_recovery_timeout_ms();
+    auto state = co_await read_partition_state(p, max_offset, timeout);
+    if (p->as.abort_requested()) {
+        co_return;
+    }
+    auto checkpoint = group_recovery_checkpoint::from_state(state);
+    checkpoint.last_offset = max_offset;
+    auto groups = checkpoint.groups.size();
+    co_await p->checkpoint.persist_local_snapshot(raft::stm_snapshot::create(
+      recovery_checkpoint_version,
+      max_offset,
+      serde::to_iobuf(std::move(checkpoint))));
+    p->checkpoint_offset = max_offset;
+    vlog(
+      p->checkpoint_log.debug,
+      "written group recovery checkpoint of {} groups at {}",
+      groups,
+      max_offset);
+}
+
+ss::future<> group_manager::write_recovery_checkpoints() {
+    std::vector<ss::lw_shared_ptr<attached_partition>> partitions;
+    partitions.reserve(_partitions.size());
+    for (auto& [_, p] : _partitions) {
+        partitions.push_back(p);
+    }
+    for (auto& p : partitions) {
+        if (_gate.is_closed()) {
+            co_return;
+        }
+        if (p->as.abort_requested() || p->loading) {
+            continue;
+        }
+        try {
+            co_await write_recovery_checkpoint(p);
+        } catch (...) {
+            vlog(
+              p->checkpoint_log.warn,
+              "unable to write group recovery checkpoint - {}",
+              std::current_exception());
+        }
+    }
+}
+
+void group_manager::arm_checkpoint_timer() {
+    auto interval = _recovery_checkpoint_interval();
+    if (interval && !_gate.is_closed()) {
+        _checkpoint_timer.arm(*interval);
+    }
+}
+
 /*
  * TODO: this routine can be improved from a copy vs move perspective, but is
  * rather complicated at the moment to start having to also analyze all the data
@@ -924,8 +1092,10 @@ ss::future<> group_manager::do_recover_group(
               _tx_frontend,
               _feature_table,
               _serializer_factory(),
-              _enable_group_metrics);
+              _enable_group_metrics,
+              p->commit_batcher);
             _groups.emplace(group_id, group);
+            index_group(group);
             group->reschedule_all_member_heartbeats();
         }
 
@@ -1125,8 +1295,10 @@ group::join_group_stages group_manager::join_group(join_group_request&& r) {
           _tx_frontend,
           _feature_table,
           _serializer_factory(),
-          _enable_group_metrics);
+          _enable_group_metrics,
+          it->second->commit_batcher);
         _groups.emplace(r.data.group_id, group);
+        index_group(group);
         _groups.rehash(0);
         is_new_group = true;
         vlog(klog.trace, "Created new group {} while joining", r.data.group_id);
@@ -1274,8 +1446,10 @@ group_manager::txn_offset_commit(txn_offset_commit_request&& r) {
                 _tx_frontend,
                 _feature_table,
                 _serializer_factory(),
-                _enable_group_metrics);
+                _enable_group_metrics,
+                p->commit_batcher);
               _groups.emplace(r.data.group_id, group);
+              index_group(group);
               _groups.rehash(0);
           }
 
@@ -1361,8 +1535,10 @@ group_manager::begin_tx(cluster::begin_group_tx_request&& r) {
                 _tx_frontend,
                 _feature_table,
                 _serializer_factory(),
-                _enable_group_metrics);
+                _enable_group_metrics,
+                p->commit_batcher);
               _groups.emplace(r.group_id, group);
+              index_group(group);
               _groups.rehash(0);
           }
 
@@ -1432,8 +1608,10 @@ group_manager::offset_commit(offset_commit_request&& r) {
               _tx_frontend,
               _feature_table,
               _serializer_factory(),
-              _enable_group_metrics);
+              _enable_group_metrics,
+              p->commit_batcher);
             _groups.emplace(r.data.group_id, group);
+            index_group(group);
             _groups.rehash(0);
         } else {
             // <kafka>or this is a request coming from an older generation.
@@ -1519,15 +1697,70 @@ group_manager::offset_delete(offset_delete_request&& r) {
     co_return response;
 }
 
-std::pair<error_code, std::vector<listed_group>>
-group_manager::list_groups() const {
-    auto loading = std::any_of(
+bool group_manager::loading() const {
+    return std::any_of(
       _partitions.cbegin(),
       _partitions.cend(),
       [](const std::
            pair<const model::ntp, ss::lw_shared_ptr<attached_partition>>& p) {
           return p.second->loading;
       });
+}
+
+void group_manager::update_index(
+  ss::noncopyable_function<void(group_index&)> update) {
+    if (ss::this_shard_id() == index_shard) {
+        update(_index);
+        return;
+    }
+    // the changes of a shard are applied in the order they are sent
+    ssx::spawn_with_gate(_gate, [this, update = std::move(update)]() mutable {
+        return container().invoke_on(
+          index_shard, [update = std::move(update)](group_manager& m) mutable {
+              update(m._index);
+          });
+    });
+}
+
+void group_manager::index_group(const group_ptr& group) {
+    group->set_summary_listener([this](const kafka::group& g) {
+        update_index([id = g.id(), e = group_index::make_entry(g)](
+                       group_index& index) mutable {
+            index.upsert(std::move(id), std::move(e));
+        });
+    });
+    update_index([id = group->id(), e = group_index::make_entry(*group)](
+                   group_index& index) mutable {
+        index.upsert(std::move(id), std::move(e));
+    });
+}
+
+void group_manager::unindex_group(const group_ptr& group) {
+    group->set_summary_listener({});
+    update_index([id = group->id(), shard = ss::this_shard_id()](
+                   group_index& index) { index.remove(id, shard); });
+}
+
+void group_manager::set_loading(attached_partition& p, bool loading) {
+    p.loading = loading;
+    publish_loading();
+}
+
+void group_manager::publish_loading() {
+    auto now_loading = loading();
+    if (now_loading == _published_loading) {
+        return;
+    }
+    _published_loading = now_loading;
+    update_index(
+      [shard = ss::this_shard_id(), now_loading](group_index& index) {
+          index.set_loading(shard, now_loading);
+      });
+}
+
+std::pair<error_code, std::vector<listed_group>>
+group_manager::list_groups() const {
+    auto loading = this->loading();
 
     std::vector<listed_group> groups;
     for (const auto& it : _groups) {
@@ -1586,6 +1819,7 @@ ss::future<std::vector<deletable_group_result>> group_manager::delete_groups(
         // - batch tombstones same backing partition
         error = co_await group->remove();
         if (error == error_code::none) {
+            unindex_group(group);
             _groups.erase(group_info.second);
         }
         results.push_back(deletable_group_result{
@@ -26,14 +26,21 @@
 #include "kafka/protocol/sync_group.h"
 #include "kafka/protocol/txn_offset_commit.h"
 #include "kafka/server/group.h"
+#include "kafka/server/group_index.h"
+#include "kafka/server/group_recovery_checkpoint.h"
 #include "kafka/server/group_recovery_consumer.h"
 #include "kafka/server/group_stm.h"
+#include "kafka/server/logger.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
 #include "raft/group_manager.h"
+#include "raft/persisted_stm.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
+#include "ssx/sformat.h"
+#include "utils/prefix_logger.h"
 #include "utils/rwlock.h"
 
 #include <seastar/core/abort_source.hh>
@@ -119,7 +126,7 @@ namespace kafka {
  *
  *     - This is not yet implemented.
  */
-class group_manager {
+class group_manager : public ss::peering_sharded_service<group_manager> {
 public:
     group_manager(
       model::topic_namespace,
@@ -173,6 +180,19 @@ public:
     // retrieving the group list (e.g. coordinator_load_in_progress).
     std::pair<error_code, std::vector<listed_group>> list_groups() const;
 
+    /// The shard keeping the group index of the node
+    static constexpr ss::shard_id index_shard = 0;
+
+    /// The groups of all the shards of the node, from the group index. Only
+    /// available on the index_shard.
+    const group_index& node_groups() const {
+        vassert(
+          ss::this_shard_id() == index_shard,
+          "group index accessed on shard {}",
+          ss::this_shard_id());
+        return _index;
+    }
+
     described_group describe_group(const model::ntp&, const kafka::group_id&);
 
     ss::future<std::vector<deletable_group_result>>
@@ -219,12 +239,27 @@ private:
         ss::abort_source as;
         ss::lw_shared_ptr<cluster::partition> partition;
         ss::lw_shared_ptr<ssx::rwlock> catchup_lock;
+        ss::lw_shared_ptr<offset_commit_batcher> commit_batcher;
         model::term_id term{-1};
-
-        explicit attached_partition(ss::lw_shared_ptr<cluster::partition> p)
+        prefix_logger checkpoint_log;
+        raft::file_backed_stm_snapshot checkpoint;
+        // offset of the last recovery checkpoint written by this node
+        std::optional<model::offset> checkpoint_offset;
+
+        attached_partition(
+          ss::lw_shared_ptr<cluster::partition> p,
+          config::binding<std::optional<std::chrono::milliseconds>>
+            commit_coalesce_window)
           : loading(true)
-          , partition(std::move(p)) {
+          , partition(std::move(p))
+          , checkpoint_log(klog, ssx::sformat("[{}]", partition->ntp()))
+          , checkpoint(
+              ss::sstring(recovery_checkpoint_name),
+              checkpoint_log,
+              partition->raft().get()) {
             catchup_lock = ss::make_lw_shared<ssx::rwlock>();
+            commit_batcher = ss::make_lw_shared<offset_commit_batcher>(
+              partition, std::move(commit_coalesce_window));
         }
     };
 
@@ -254,6 +289,26 @@ private:
       ss::lw_shared_ptr<attached_partition>,
       group_recovery_consumer_state);
 
+    /*
+     * Recovery checkpoints. The materialized state of the groups of each
+     * attached partition is periodically written to a side file so the
+     * recovery only needs to replay the log following the checkpoint.
+     */
+    static constexpr std::string_view recovery_checkpoint_name
+      = "group_recovery.snapshot";
+    static constexpr int8_t recovery_checkpoint_version = 0;
+
+    ss::future<std::optional<group_recovery_checkpoint>>
+      load_recovery_checkpoint(ss::lw_shared_ptr<attached_partition>);
+    ss::future<group_recovery_consumer_state> read_partition_state(
+      ss::lw_shared_ptr<attached_partition>,
+      model::offset max_offset,
+      model::timeout_clock::time_point timeout);
+    ss::future<> write_recovery_checkpoint(
+      ss::lw_shared_ptr<attached_partition>);
+    ss::future<> write_recovery_checkpoints();
+    void arm_checkpoint_timer();
+
     ss::future<size_t> delete_offsets(
       group_ptr group, std::vector<model::topic_partition> offsets);
 
@@ -283,6 +338,18 @@ private:
           groups, [](auto group_ptr) { return group_ptr->shutdown(); });
     }
 
+    /// True if the groups of a partition are still being loaded
+    bool loading() const;
+    void set_loading(attached_partition&, bool);
+    /// Sends the loading state of the shard to the group index if it changed
+    void publish_loading();
+
+    /// Applies \p update to the group index, on the index_shard
+    void update_index(ss::noncopyable_function<void(group_index&)> update);
+    /// Adds the group to the group index and keeps its entry up to date
+    void index_group(const group_ptr&);
+    void unindex_group(const group_ptr&);
+
     std::optional<std::chrono::seconds> offset_retention_enabled();
     std::optional<bool> _prev_offset_retention_enabled;
 
@@ -301,9 +368,16 @@ private:
       _partitions;
     //
 
+    // only used on the index_shard
+    group_index _index;
+    bool _published_loading{false};
+
     model::broker _self;
     enable_group_metrics _enable_group_metrics;
     config::binding<std::chrono::milliseconds> _offset_retention_check;
+    ss::timer<> _checkpoint_timer;
+    config::binding<std::optional<std::chrono::milliseconds>>
+      _recovery_checkpoint_interval;
 };
 
 } // namespace kafka
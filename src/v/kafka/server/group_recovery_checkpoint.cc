@@ -0,0 +1,165 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/group_recovery_checkpoint.h"
+
+#include "kafka/protocol/wire.h"
+#include "kafka/server/group_metadata.h"
+
+namespace kafka {
+
+namespace {
+iobuf encode_metadata(const group_metadata_value& md) {
+    iobuf buffer;
+    protocol::encoder writer(buffer);
+    group_metadata_value::encode(writer, md);
+    return buffer;
+}
+
+group_metadata_value decode_metadata(iobuf buffer) {
+    protocol::decoder reader(std::move(buffer));
+    return group_metadata_value::decode(reader);
+}
+
+} // namespace
+
+group_recovery_checkpoint::group group_recovery_checkpoint::from_stm(
+  const kafka::group_id& id, const group_stm& stm) {
+    group ret;
+    ret.id = id;
+    ret.is_loaded = stm._is_loaded;
+    ret.is_removed = stm._is_removed;
+    if (stm._is_loaded) {
+        ret.metadata = encode_metadata(stm._metadata);
+    }
+
+    ret.offsets.reserve(stm._offsets.size());
+    for (const auto& [tp, md] : stm._offsets) {
+        ret.offsets.push_back(offset{
+          .tp = tp,
+          .log_offset = md.log_offset,
+          .committed_offset = md.metadata.offset,
+          .leader_epoch = md.metadata.leader_epoch,
+          .metadata = md.metadata.metadata,
+          .commit_timestamp = md.metadata.commit_timestamp,
+          .expiry_timestamp = md.metadata.expiry_timestamp,
+          .non_reclaimable = md.metadata.non_reclaimable,
+        });
+    }
+
+    ret.prepared_txs.reserve(stm._prepared_txs.size());
+    for (const auto& [_, ongoing] : stm._prepared_txs) {
+        auto& prepared = ret.prepared_txs.emplace_back();
+        prepared.pid = ongoing.pid;
+        prepared.tx_seq = ongoing.tx_seq;
+        prepared.offsets.reserve(ongoing.offsets.size());
+        for (const auto& [tp, md] : ongoing.offsets) {
+            prepared.offsets.push_back(prepared_tx::offset{
+              .tp = tp,
+              .log_offset = md.log_offset,
+              .committed_offset = md.offset,
+              .metadata = md.metadata,
+              .leader_epoch = md.committed_leader_epoch,
+              .commit_timestamp = md.commit_timestamp,
+              .expiry_timestamp = md.expiry_timestamp,
+              .non_reclaimable = md.non_reclaimable,
+            });
+        }
+    }
+
+    ret.fences.reserve(stm._fence_pid_epoch.size());
+    for (const auto& [producer_id, epoch] : stm._fence_pid_epoch) {
+        ret.fences.push_back(fence{.id = producer_id, .epoch = epoch});
+    }
+
+    ret.tx_data.reserve(stm._tx_data.size());
+    for (const auto& [pid, info] : stm._tx_data) {
+        ret.tx_data.push_back(tx{
+          .pid = pid,
+          .tx_seq = info.tx_seq,
+          .tm_partition = info.tm_partition,
+        });
+    }
+
+    ret.timeouts.reserve(stm._timeouts.size());
+    for (const auto& [pid, timeout] : stm._timeouts) {
+        ret.timeouts.push_back(tx_timeout{.pid = pid, .timeout = timeout});
+    }
+    return ret;
+}
+
+group_recovery_checkpoint group_recovery_checkpoint::from_state(
+  const group_recovery_consumer_state& state) {
+    group_recovery_checkpoint ret;
+    ret.has_offset_retention_feature_fence
+      = state.has_offset_retention_feature_fence;
+    ret.groups.reserve(state.groups.size());
+    for (const auto& [id, stm] : state.groups) {
+        ret.groups.push_back(from_stm(id, stm));
+    }
+    return ret;
+}
+
+group_recovery_consumer_state group_recovery_checkpoint::to_state() && {
+    group_recovery_consumer_state state;
+    state.has_offset_retention_feature_fence
+      = has_offset_retention_feature_fence;
+    state.groups.reserve(groups.size());
+    for (auto& g : groups) {
+        auto& stm = state.groups[g.id];
+        stm._is_loaded = g.is_loaded;
+        stm._is_removed = g.is_removed;
+        if (g.is_loaded) {
+            stm._metadata = decode_metadata(std::move(g.metadata));
+        }
+        for (auto& o : g.offsets) {
+            stm._offsets[o.tp] = group_stm::logged_metadata{
+              .log_offset = o.log_offset,
+              .metadata = offset_metadata_value{
+                .offset = o.committed_offset,
+                .leader_epoch = o.leader_epoch,
+                .metadata = std::move(o.metadata),
+                .commit_timestamp = o.commit_timestamp,
+                .expiry_timestamp = o.expiry_timestamp,
+                .non_reclaimable = o.non_reclaimable,
+              }};
+        }
+        for (auto& ongoing : g.prepared_txs) {
+            auto& prepared = stm._prepared_txs[ongoing.pid.get_id()];
+            prepared.pid = ongoing.pid;
+            prepared.tx_seq = ongoing.tx_seq;
+            for (auto& o : ongoing.offsets) {
+                prepared.offsets[o.tp] = kafka::group::offset_metadata{
+                  .log_offset = o.log_offset,
+                  .offset = o.committed_offset,
+                  .metadata = std::move(o.metadata),
+                  .committed_leader_epoch = o.leader_epoch,
+                  .commit_timestamp = o.commit_timestamp,
+                  .expiry_timestamp = o.expiry_timestamp,
+                  .non_reclaimable = o.non_reclaimable,
+                };
+            }
+        }
+        for (const auto& f : g.fences) {
+            stm._fence_pid_epoch[f.id] = f.epoch;
+        }
+        for (const auto& info : g.tx_data) {
+            stm._tx_data[info.pid] = group_stm::tx_info{
+              .tx_seq = info.tx_seq, .tm_partition = info.tm_partition};
+        }
+        for (const auto& t : g.timeouts) {
+            stm._timeouts[t.pid] = t.timeout;
+        }
+    }
+    return state;
+}
+
+} // namespace kafka
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "bytes/iobuf.h"
+#include "kafka/server/group_recovery_consumer.h"
+#include "kafka/types.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "model/timeout_clock.h"
+#include "model/timestamp.h"
+#include "serde/envelope.h"
+
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Materialized state of the groups of a __consumer_offsets partition as of
+ * a given log offset.
+ *
+ * The checkpoint is periodically written to a side file next to the
+ * partition log so that the recovery on leadership change only needs to
+ * replay the part of the log following the checkpoint. Group metadata is
+ * stored in the same encoding as in the log.
+ */
+struct group_recovery_checkpoint
+  : serde::envelope<
+      group_recovery_checkpoint,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    struct offset
+      : serde::envelope<offset, serde::version<0>, serde::compat_version<0>> {
+        model::topic_partition tp;
+        model::offset log_offset;
+        model::offset committed_offset;
+        kafka::leader_epoch leader_epoch;
+        ss::sstring metadata;
+        model::timestamp commit_timestamp;
+        model::timestamp expiry_timestamp;
+        bool non_reclaimable{true};
+
+        auto serde_fields() {
+            return std::tie(
+              tp,
+              log_offset,
+              committed_offset,
+              leader_epoch,
+              metadata,
+              commit_timestamp,
+              expiry_timestamp,
+              non_reclaimable);
+        }
+    };
+
+    struct prepared_tx
+      : serde::
+          envelope<prepared_tx, serde::version<0>, serde::compat_version<0>> {
+        struct offset
+          : serde::
+              envelope<offset, serde::version<0>, serde::compat_version<0>> {
+            model::topic_partition tp;
+            model::offset log_offset;
+            model::offset committed_offset;
+            ss::sstring metadata;
+            kafka::leader_epoch leader_epoch;
+            model::timestamp commit_timestamp;
+            std::optional<model::timestamp> expiry_timestamp;
+            bool non_reclaimable{false};
+
+            auto serde_fields() {
+                return std::tie(
+                  tp,
+                  log_offset,
+                  committed_offset,
+                  metadata,
+                  leader_epoch,
+                  commit_timestamp,
+                  expiry_timestamp,
+                  non_reclaimable);
+            }
+        };
+
+        model::producer_identity pid;
+        model::tx_seq tx_seq;
+        std::vector<offset> offsets;
+
+        auto serde_fields() { return std::tie(pid, tx_seq, offsets); }
+    };
+
+    struct tx
+      : serde::envelope<tx, serde::version<0>, serde::compat_version<0>> {
+        model::producer_identity pid;
+        model::tx_seq tx_seq;
+        model::partition_id tm_partition;
+
+        auto serde_fields() { return std::tie(pid, tx_seq, tm_partition); }
+    };
+
+    struct tx_timeout
+      : serde::
+          envelope<tx_timeout, serde::version<0>, serde::compat_version<0>> {
+        model::producer_identity pid;
+        model::timeout_clock::duration timeout;
+
+        auto serde_fields() { return std::tie(pid, timeout); }
+    };
+
+    struct fence
+      : serde::envelope<fence, serde::version<0>, serde::compat_version<0>> {
+        model::producer_id id;
+        model::producer_epoch epoch;
+
+        auto serde_fields() { return std::tie(id, epoch); }
+    };
+
+    struct group
+      : serde::envelope<group, serde::version<0>, serde::compat_version<0>> {
+        kafka::group_id id;
+        bool is_loaded{false};
+        bool is_removed{false};
+        // group_metadata_value in the __consumer_offsets encoding
+        iobuf metadata;
+        std::vector<offset> offsets;
+        std::vector<prepared_tx> prepared_txs;
+        std::vector<fence> fences;
+        std::vector<tx> tx_data;
+        std::vector<tx_timeout> timeouts;
+
+        auto serde_fields() {
+            return std::tie(
+              id,
+              is_loaded,
+              is_removed,
+              metadata,
+              offsets,
+              prepared_txs,
+              fences,
+              tx_data,
+              timeouts);
+        }
+    };
+
+    // the state includes all the batches up to and including this offset
+    model::offset last_offset;
+    bool has_offset_retention_feature_fence{false};
+    std::vector<group> groups;
+
+    auto serde_fields() {
+        return std::tie(
+          last_offset, has_offset_retention_feature_fence, groups);
+    }
+
+    static group_recovery_checkpoint
+    from_state(const group_recovery_consumer_state&);
+
+    group_recovery_consumer_state to_state() &&;
+
+private:
+    static group from_stm(const kafka::group_id&, const group_stm&);
+};
+
+} // namespace kafka
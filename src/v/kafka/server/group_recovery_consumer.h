@@ -41,8 +41,11 @@ public:
      */
 
     explicit group_recovery_consumer(
-      group_metadata_serializer serializer, ss::abort_source& as)
-      : _serializer(std::move(serializer))
+      group_metadata_serializer serializer,
+      ss::abort_source& as,
+      group_recovery_consumer_state initial_state = {})
+      : _state(std::move(initial_state))
+      , _serializer(std::move(serializer))
       , _as(as) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch batch);
@@ -293,18 +293,11 @@ group_router::abort_tx(cluster::abort_group_tx_request request) {
 
 ss::future<std::pair<error_code, std::vector<listed_group>>>
 group_router::list_groups() {
-    using type = std::pair<error_code, std::vector<listed_group>>;
-    return get_group_manager().map_reduce0(
-      [](group_manager& mgr) { return mgr.list_groups(); },
-      type{},
-      [](type a, type b) {
-          // reduce errors into `a` and retain the first
-          if (a.first == error_code::none) {
-              a.first = b.first;
-          }
-          a.second.insert(a.second.end(), b.second.begin(), b.second.end());
-          return a;
-      });
+    // every shard keeps the group index of the node up to date, so a single
+    // shard answers for the whole node
+    return get_group_manager().invoke_on(
+      group_manager::index_shard,
+      [](group_manager& mgr) { return mgr.node_groups().list_groups(); });
 }
 
 } // namespace kafka
@@ -24,6 +24,8 @@
 
 namespace kafka {
 
+struct group_recovery_checkpoint;
+
 struct group_log_prepared_tx_offset {
     model::topic_partition tp;
     model::offset offset;
@@ -146,6 +148,8 @@ public:
     const group_metadata_value& get_metadata() const { return _metadata; }
 
 private:
+    friend struct group_recovery_checkpoint;
+
     absl::node_hash_map<model::topic_partition, logged_metadata> _offsets;
     absl::node_hash_map<model::producer_id, group::prepared_tx> _prepared_txs;
     absl::node_hash_map<model::producer_id, model::producer_epoch>
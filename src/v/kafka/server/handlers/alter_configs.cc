@@ -248,6 +248,21 @@ create_topic_properties_update(
                   kafka::config_resource_operation::set);
                 continue;
             }
+            if (cfg.name == topic_property_write_caching) {
+                parse_and_set_optional_bool_alpha(
+                  update.properties.write_caching,
+                  cfg.value,
+                  kafka::config_resource_operation::set);
+                continue;
+            }
+            if (cfg.name == topic_property_observer_replicas) {
+                parse_and_set_optional(
+                  update.properties.observer_replicas,
+                  cfg.value,
+                  kafka::config_resource_operation::set,
+                  observer_replicas_validator{});
+                continue;
+            }
             if (
               config::shard_local_cfg().enable_schema_id_validation()
               != pandaproxy::schema_registry::schema_id_validation_mode::none) {
@@ -307,6 +307,19 @@ struct segment_size_validator {
     }
 };
 
+struct observer_replicas_validator {
+    std::optional<ss::sstring>
+    operator()(const ss::sstring&, const int16_t& value) {
+        // the replication factor isn't known here, the partition leaders
+        // always keep at least one voter
+        if (value < 0) {
+            return fmt::format(
+              "observer replicas {} must not be negative", value);
+        }
+        return std::nullopt;
+    }
+};
+
 struct replication_factor_must_be_positive {
     std::optional<ss::sstring>
     operator()(const ss::sstring& raw, const cluster::replication_factor&) {
@@ -61,7 +61,9 @@ static constexpr auto supported_configs = std::to_array(
    topic_property_record_value_subject_name_strategy,
    topic_property_record_value_subject_name_strategy_compat,
    topic_property_initial_retention_local_target_bytes,
-   topic_property_initial_retention_local_target_ms});
+   topic_property_initial_retention_local_target_ms,
+   topic_property_write_caching,
+   topic_property_observer_replicas});
 
 bool is_supported(std::string_view name) {
     return std::any_of(
@@ -83,6 +85,7 @@ using validators = make_validator_types<
   cleanup_policy_validator,
   remote_read_and_write_are_not_supported_for_read_replica,
   batch_max_bytes_limits,
+  observer_replicas_limits,
   subject_name_strategy_validator>;
 
 static std::vector<creatable_topic_configs>
@@ -18,6 +18,8 @@
 #include "model/fundamental.h"
 #include "model/ktp.h"
 
+#include <absl/container/flat_hash_map.h>
+
 #include <vector>
 
 namespace kafka {
@@ -165,6 +167,32 @@ ss::future<result_t> prefix_truncate(
     co_return make_partition_response(ktp, kafka_start_offset);
 }
 
+struct truncation_request {
+    model::ktp ktp;
+    model::offset offset;
+};
+
+/// Prefix truncates all partitions of a request that are on this shard at
+/// once, so that the request costs one cross-shard call per shard rather than
+/// one per partition.
+ss::future<std::vector<result_t>> prefix_truncate_on_shard(
+  cluster::partition_manager& pm,
+  std::vector<truncation_request> requests,
+  std::chrono::milliseconds timeout_ms) {
+    std::vector<ss::future<result_t>> fs;
+    fs.reserve(requests.size());
+    for (auto& r : requests) {
+        fs.push_back(
+          prefix_truncate(pm, r.ktp, r.offset, timeout_ms)
+            .handle_exception([ktp = r.ktp](std::exception_ptr eptr) {
+                vlog(klog.error, "Caught unexpected exception: {}", eptr);
+                return make_partition_error(
+                  ktp, error_code::unknown_server_error);
+            }));
+    }
+    return ss::when_all_succeed(fs.begin(), fs.end());
+}
+
 } // namespace
 
 template<>
@@ -214,12 +242,15 @@ delete_records_handler::handle(request_context ctx, ss::smp_service_group) {
       });
     valid_range_end = unauthorized_it;
 
-    std::vector<ss::future<result_t>> fs;
+    std::vector<result_t> results;
+    absl::flat_hash_map<ss::shard_id, std::vector<truncation_request>>
+      requests_per_shard;
 
     std::for_each(
       begin,
       valid_range_end,
-      [&fs, &ctx, &response, &request](const delete_records_topic& topic) {
+      [&results, &requests_per_shard, &ctx, &response](
+        const delete_records_topic& topic) {
           /// Topic level validation, errors will be all the same for each
           /// partition under the topic. Validation for individual partitions
           /// may happen in the inner for loop below.
@@ -240,39 +271,57 @@ delete_records_handler::handle(request_context ctx, ss::smp_service_group) {
               if (
                 disabled_set
                 && disabled_set->is_disabled(partition.partition_index)) {
-                  fs.push_back(
-                    ss::make_ready_future<result_t>(make_partition_error(
-                      ktp, error_code::replica_not_available)));
+                  results.push_back(make_partition_error(
+                    ktp, error_code::replica_not_available));
                   continue;
               }
               auto shard = ctx.shards().shard_for(ktp);
               if (!shard) {
-                  fs.push_back(
-                    ss::make_ready_future<result_t>(make_partition_error(
-                      ktp, error_code::unknown_topic_or_partition)));
-                  return;
+                  results.push_back(make_partition_error(
+                    ktp, error_code::unknown_topic_or_partition));
+                  continue;
               }
-              auto f
-                = ctx.partition_manager()
-                    .invoke_on(
-                      *shard,
-                      [ktp,
-                       timeout = request.data.timeout_ms,
-                       o = partition.offset](cluster::partition_manager& pm) {
-                          return prefix_truncate(pm, ktp, o, timeout);
-                      })
-                    .handle_exception([ktp](std::exception_ptr eptr) {
-                        vlog(
-                          klog.error, "Caught unexpected exception: {}", eptr);
-                        return make_partition_error(
-                          ktp, error_code::unknown_server_error);
-                    });
-              fs.push_back(std::move(f));
+              requests_per_shard[*shard].push_back(truncation_request{
+                .ktp = std::move(ktp), .offset = partition.offset});
           }
       });
 
-    /// Perform prefix truncation on partitions
-    auto results = co_await ss::when_all_succeed(fs.begin(), fs.end());
+    /// Perform prefix truncation on partitions, all partitions of a shard in
+    /// one call
+    std::vector<ss::future<std::vector<result_t>>> fs;
+    fs.reserve(requests_per_shard.size());
+    for (auto& [shard, requests] : requests_per_shard) {
+        std::vector<model::ktp> ktps;
+        ktps.reserve(requests.size());
+        for (const auto& r : requests) {
+            ktps.push_back(r.ktp);
+        }
+        fs.push_back(
+          ctx.partition_manager()
+            .invoke_on(
+              shard,
+              [requests = std::move(requests),
+               timeout = request.data.timeout_ms](
+                cluster::partition_manager& pm) mutable {
+                  return prefix_truncate_on_shard(
+                    pm, std::move(requests), timeout);
+              })
+            .handle_exception(
+              [ktps = std::move(ktps)](std::exception_ptr eptr) {
+                  vlog(klog.error, "Caught unexpected exception: {}", eptr);
+                  std::vector<result_t> errors;
+                  errors.reserve(ktps.size());
+                  for (const auto& ktp : ktps) {
+                      errors.push_back(make_partition_error(
+                        ktp, error_code::unknown_server_error));
+                  }
+                  return errors;
+              }));
+    }
+    auto shard_results = co_await ss::when_all_succeed(fs.begin(), fs.end());
+    for (auto& rs : shard_results) {
+        std::move(rs.begin(), rs.end(), std::back_inserter(results));
+    }
 
     /// Group results by topic
     using partition_results = std::vector<delete_records_partition_result>;
@@ -991,6 +991,34 @@ ss::future<response_ptr> describe_configs_handler::handle(
                 config::shard_local_cfg()
                   .initial_retention_local_target_ms_default.desc()));
 
+            add_topic_config_if_requested(
+              resource,
+              result,
+              topic_property_write_caching,
+              storage::ntp_config::default_write_caching,
+              topic_property_write_caching,
+              topic_config->properties.write_caching,
+              request.data.include_synonyms,
+              maybe_make_documentation(
+                request.data.include_documentation,
+                "Acknowledge acks=all writes once a majority of the replicas "
+                "appended them, before they are flushed to disk"),
+              &describe_as_string<bool>);
+
+            add_topic_config_if_requested(
+              resource,
+              result,
+              topic_property_observer_replicas,
+              storage::ntp_config::default_observer_replicas,
+              topic_property_observer_replicas,
+              topic_config->properties.observer_replicas,
+              request.data.include_synonyms,
+              maybe_make_documentation(
+                request.data.include_documentation,
+                "Number of replicas of every partition which replicate the "
+                "log without voting and serve fetches"),
+              &describe_as_string<int16_t>);
+
             break;
         }
 
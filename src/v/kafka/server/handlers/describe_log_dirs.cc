@@ -95,7 +95,9 @@ static partition_dir_set collect_mapper(
 }
 
 /*
- * collect log directory information for partitions
+ * collect log directory information for partitions. the sizes are counters
+ * maintained by the log and the manifest, so this is O(partitions) and the
+ * per-shard results are moved rather than copied into the reply.
  */
 static ss::future<partition_dir_set> collect(
   request_context& ctx,
@@ -105,11 +107,17 @@ static ss::future<partition_dir_set> collect(
           return collect_mapper(pm, filter);
       },
       partition_dir_set{},
-      [](partition_dir_set acc, const partition_dir_set& update) {
-          for (auto& topic : update) {
-              for (auto partition : topic.second) {
-                  acc[topic.first].push_back(partition);
+      [](partition_dir_set acc, partition_dir_set update) {
+          for (auto& [topic, partitions] : update) {
+              auto& acc_partitions = acc[topic];
+              if (acc_partitions.empty()) {
+                  acc_partitions = std::move(partitions);
+                  continue;
               }
+              std::move(
+                partitions.begin(),
+                partitions.end(),
+                std::back_inserter(acc_partitions));
           }
           return acc;
       });
@@ -161,6 +169,7 @@ ss::future<response_ptr> describe_log_dirs_handler::handle(
 
         std::vector<describe_log_dirs_partition> local_partitions;
         std::vector<describe_log_dirs_partition> remote_partitions;
+        local_partitions.reserve(node.mapped().size());
         for (const auto& i : node.mapped()) {
             local_partitions.push_back(i.local);
             if (i.remote.has_value()) {
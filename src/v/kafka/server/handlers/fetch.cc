@@ -20,8 +20,11 @@
 #include "kafka/server/fetch_session.h"
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/details/leader_epoch.h"
+#include "kafka/server/handlers/fetch/data_waiters.h"
 #include "kafka/server/handlers/fetch/fetch_plan_executor.h"
 #include "kafka/server/handlers/fetch/fetch_planner.h"
+#include "kafka/server/handlers/fetch/read_coalescer.h"
+#include "kafka/server/handlers/fetch/record_filter.h"
 #include "kafka/server/handlers/fetch/replica_selector.h"
 #include "kafka/server/partition_proxy.h"
 #include "kafka/server/replicated_partition.h"
@@ -38,6 +41,7 @@
 
 #include <seastar/core/do_with.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
@@ -67,54 +71,49 @@ make_partition_response_error(model::partition_id p_id, error_code error) {
 }
 
 /**
- * Low-level handler for reading from an ntp. Runs on ntp's home core.
+ * Read the data for \p config from \p part. The returned result does not
+ * depend on which fetch performed the read and may be shared between fetches.
  */
-static ss::future<read_result> read_from_partition(
-  kafka::partition_proxy part,
-  fetch_config config,
-  bool foreign_read,
+static ss::future<fetch_read_coalescer::read_ptr> read_partition_data(
+  kafka::partition_proxy& part,
+  const fetch_config& config,
+  storage::opt_abort_source_t abort_source,
   std::optional<model::timeout_clock::time_point> deadline) {
-    auto lso = part.last_stable_offset();
-    if (unlikely(!lso)) {
-        co_return read_result(lso.error());
-    }
-    auto hw = part.high_watermark();
-    auto start_o = part.start_offset();
-    // if we have no data read, return fast
-    if (
-      hw < config.start_offset || config.skip_read
-      || config.start_offset > config.max_offset) {
-        co_return read_result(start_o, hw, lso.value());
-    }
-
     storage::log_reader_config reader_config(
       config.start_offset,
       config.max_offset,
       0,
       config.max_bytes,
-      kafka_read_priority(),
+      config.io_priority.value_or(kafka_read_priority()),
       std::nullopt,
       std::nullopt,
-      config.abort_source.has_value()
-        ? config.abort_source.value().get().local()
-        : storage::opt_abort_source_t{},
+      abort_source,
       config.client_address);
 
     reader_config.strict_max_bytes = config.strict_max_bytes;
     auto rdr = co_await part.make_reader(reader_config);
     std::exception_ptr e;
-    std::unique_ptr<iobuf> data;
-    std::vector<cluster::rm_stm::tx_range> aborted_transactions;
+    auto read = ss::make_lw_shared<fetch_partition_read>();
     try {
-        auto result = co_await rdr.reader.consume(
-          kafka_batch_serializer(), deadline ? *deadline : model::no_timeout);
-        data = std::make_unique<iobuf>(std::move(result.data));
-        part.probe().add_records_fetched(result.record_count);
-        part.probe().add_bytes_fetched(data->size_bytes());
+        const auto share_records
+          = config::shard_local_cfg().kafka_fetch_zero_copy();
+        const auto read_deadline = deadline ? *deadline : model::no_timeout;
+        kafka_batch_serializer::result result;
+        if (config.record_filter) {
+            result = co_await rdr.reader.consume(
+              filtering_batch_serializer(
+                *config.record_filter, share_records),
+              read_deadline);
+        } else {
+            result = co_await rdr.reader.consume(
+              kafka_batch_serializer(share_records), read_deadline);
+        }
+        read->data = std::move(result.data);
+        read->record_count = result.record_count;
         if (result.first_tx_batch_offset && result.record_count > 0) {
             // Reader should live at least until this point to hold on to the
             // segment locks so that prefix truncation doesn't happen.
-            aborted_transactions = co_await part.aborted_transactions(
+            read->aborted_transactions = co_await part.aborted_transactions(
               result.first_tx_batch_offset.value(),
               result.last_offset,
               std::move(rdr.ot_state));
@@ -125,10 +124,9 @@ static ss::future<read_result> read_from_partition(
             // read batches.
             auto start_o = part.start_offset();
             if (config.start_offset < start_o) {
-                co_return read_result(
-                  error_code::offset_out_of_range,
-                  start_o,
-                  part.high_watermark());
+                read->error = error_code::offset_out_of_range;
+                read->start_offset = start_o;
+                read->high_watermark = part.high_watermark();
             }
         }
 
@@ -141,6 +139,73 @@ static ss::future<read_result> read_from_partition(
     if (e) {
         std::rethrow_exception(e);
     }
+    co_return read;
+}
+
+/**
+ * Low-level handler for reading from an ntp. Runs on ntp's home core.
+ *
+ * When a \p coalescer is provided, concurrent reads of the same partition
+ * range, typically many consumers polling the same tail, share a single read.
+ */
+static ss::future<read_result> read_from_partition(
+  const model::ktp& ktp,
+  kafka::partition_proxy part,
+  fetch_config config,
+  bool foreign_read,
+  std::optional<model::timeout_clock::time_point> deadline,
+  fetch_read_coalescer* coalescer) {
+    auto lso = part.last_stable_offset();
+    if (unlikely(!lso)) {
+        co_return read_result(lso.error());
+    }
+    auto hw = part.high_watermark();
+    auto start_o = part.start_offset();
+    // if we have no data read, return fast
+    if (
+      hw < config.start_offset || config.skip_read
+      || config.start_offset > config.max_offset) {
+        co_return read_result(start_o, hw, lso.value());
+    }
+
+    fetch_read_coalescer::read_ptr read;
+    // a filtered read depends on the client, it can't be shared
+    if (
+      coalescer && !config.record_filter
+      && config::shard_local_cfg().kafka_fetch_coalesce_reads()) {
+        // a shared read must not be cancelled when the connection of the
+        // fetch that started it goes away, it is bounded by the deadline.
+        read = co_await coalescer->read(
+          fetch_read_key{
+            .ktp = ktp,
+            .start_offset = config.start_offset,
+            .max_offset = config.max_offset,
+            .max_bytes = config.max_bytes,
+            .strict_max_bytes = config.strict_max_bytes,
+          },
+          [&part, &config, deadline] {
+              return read_partition_data(
+                part, config, storage::opt_abort_source_t{}, deadline);
+          });
+    } else {
+        read = co_await read_partition_data(
+          part,
+          config,
+          config.abort_source.has_value()
+            ? config.abort_source.value().get().local()
+            : storage::opt_abort_source_t{},
+          deadline);
+    }
+
+    if (read->error) {
+        co_return read_result(
+          *read->error, read->start_offset, read->high_watermark);
+    }
+
+    auto data = std::make_unique<iobuf>(
+      read->data.share(0, read->data.size_bytes()));
+    part.probe().add_records_fetched(read->record_count);
+    part.probe().add_bytes_fetched(data->size_bytes());
 
     if (foreign_read) {
         co_return read_result(
@@ -148,15 +213,11 @@ static ss::future<read_result> read_from_partition(
           start_o,
           hw,
           lso.value(),
-          std::move(aborted_transactions));
+          read->aborted_transactions);
     }
 
     co_return read_result(
-      std::move(data),
-      start_o,
-      hw,
-      lso.value(),
-      std::move(aborted_transactions));
+      std::move(data), start_o, hw, lso.value(), read->aborted_transactions);
 }
 
 read_result::memory_units_t::memory_units_t(
@@ -277,7 +338,8 @@ static ss::future<read_result> do_read_from_ntp(
   std::optional<model::timeout_clock::time_point> deadline,
   const bool obligatory_batch_read,
   ssx::semaphore& memory_sem,
-  ssx::semaphore& memory_fetch_sem) {
+  ssx::semaphore& memory_fetch_sem,
+  fetch_read_coalescer* coalescer) {
     // control available memory
     read_result::memory_units_t memory_units(memory_sem, memory_fetch_sem);
     if (!ntp_config.cfg.skip_read) {
@@ -300,6 +362,11 @@ static ss::future<read_result> do_read_from_ntp(
     if (unlikely(!kafka_partition)) {
         co_return read_result(error_code::unknown_topic_or_partition);
     }
+    // observers serve the consumers the leader redirected to them, with or
+    // without a rack id
+    if (!ntp_config.cfg.read_from_follower && kafka_partition->is_observer()) {
+        ntp_config.cfg.read_from_follower = true;
+    }
     if (!ntp_config.cfg.read_from_follower && !kafka_partition->is_leader()) {
         co_return read_result(error_code::not_leader_for_partition);
     }
@@ -367,7 +434,12 @@ static ss::future<read_result> do_read_from_ntp(
         }
     }
     read_result result = co_await read_from_partition(
-      std::move(*kafka_partition), ntp_config.cfg, foreign_read, deadline);
+      ntp_config.ktp(),
+      std::move(*kafka_partition),
+      ntp_config.cfg,
+      foreign_read,
+      deadline,
+      coalescer);
 
     adjust_memory_units(
       memory_sem, memory_fetch_sem, memory_units, result.data_size_bytes());
@@ -395,7 +467,8 @@ ss::future<read_result> read_from_ntp(
       deadline,
       obligatory_batch_read,
       memory_sem,
-      memory_fetch_sem);
+      memory_fetch_sem,
+      nullptr);
 }
 
 read_result::memory_units_t reserve_memory_units(
@@ -409,9 +482,72 @@ read_result::memory_units_t reserve_memory_units(
 
 } // namespace testing
 
+/**
+ * A partition response assembled on the shard that served the read. All the
+ * fields except for the records are filled in. The data is kept in the read
+ * result until the response budget is applied on the connection shard.
+ */
+struct prepared_partition_response {
+    fetch_response::partition_response response;
+    read_result result;
+};
+
+static prepared_partition_response
+prepare_partition_response(read_result res) {
+    if (unlikely(res.error != error_code::none)) {
+        auto resp = make_partition_response_error(res.partition, res.error);
+        return {std::move(resp), std::move(res)};
+    }
+
+    fetch_response::partition_response resp;
+    resp.partition_index = res.partition;
+    resp.error_code = error_code::none;
+    resp.log_start_offset = res.start_offset;
+    resp.high_watermark = res.high_watermark;
+    resp.last_stable_offset = res.last_stable_offset;
+    if (res.preferred_replica) {
+        resp.preferred_read_replica = *res.preferred_replica;
+    }
+
+    /**
+     * set aborted transactions if present
+     */
+    if (!res.aborted_transactions.empty()) {
+        std::vector<fetch_response::aborted_transaction> aborted;
+        aborted.reserve(res.aborted_transactions.size());
+        std::transform(
+          res.aborted_transactions.begin(),
+          res.aborted_transactions.end(),
+          std::back_inserter(aborted),
+          [](cluster::rm_stm::tx_range range) {
+              return fetch_response::aborted_transaction{
+                .producer_id = kafka::producer_id(range.pid.id),
+                .first_offset = range.first};
+          });
+        resp.aborted = std::move(aborted);
+        res.aborted_transactions.clear();
+    }
+    return {std::move(resp), std::move(res)};
+}
+
+/**
+ * Assemble the partition responses of a shard fetch. This runs on the shard
+ * that owns the partitions so that the connection shard, which has to merge
+ * the responses of every shard, only applies the response budget.
+ */
+static std::vector<prepared_partition_response>
+prepare_partition_responses(std::vector<read_result> results) {
+    std::vector<prepared_partition_response> prepared;
+    prepared.reserve(results.size());
+    for (auto& res : results) {
+        prepared.push_back(prepare_partition_response(std::move(res)));
+    }
+    return prepared;
+}
+
 static void fill_fetch_responses(
   op_context& octx,
-  std::vector<read_result> results,
+  std::vector<prepared_partition_response> results,
   std::vector<op_context::response_placeholder_ptr> responses,
   op_context::latency_point start_time) {
     auto range = boost::irange<size_t>(0, results.size());
@@ -431,14 +567,19 @@ static void fill_fetch_responses(
     // Used to aggregate semaphore_units from results.
     std::optional<read_result::memory_units_t> total_memory_units;
 
+    // all the partitions of a shard fetch complete together
+    const auto fetch_latency
+      = std::chrono::duration_cast<std::chrono::microseconds>(
+        op_context::latency_clock::now() - start_time);
+
     for (auto idx : range) {
-        auto& res = results[idx];
+        auto& resp = results[idx].response;
+        auto& res = results[idx].result;
         auto& resp_it = responses[idx];
 
         // error case
-        if (unlikely(res.error != error_code::none)) {
-            resp_it->set(
-              make_partition_response_error(res.partition, res.error));
+        if (unlikely(resp.error_code != error_code::none)) {
+            resp_it->set(std::move(resp));
             continue;
         }
 
@@ -450,19 +591,6 @@ static void fill_fetch_responses(
           res.start_offset,
           res.high_watermark,
           res.last_stable_offset);
-        /**
-         * Over response budget, we will just waste this read, it will cause
-         * data to be stored in the cache so next read is fast
-         */
-        fetch_response::partition_response resp;
-        resp.partition_index = res.partition;
-        resp.error_code = error_code::none;
-        resp.log_start_offset = res.start_offset;
-        resp.high_watermark = res.high_watermark;
-        resp.last_stable_offset = res.last_stable_offset;
-        if (res.preferred_replica) {
-            resp.preferred_read_replica = *res.preferred_replica;
-        }
 
         // Aggregate memory_units from all results together to avoid
         // making more than one cross-shard function call to free them.
@@ -485,33 +613,18 @@ static void fill_fetch_responses(
         if (
           res.has_data()
           && (octx.bytes_left >= res.data_size_bytes() || octx.response_size == 0)) {
-            /**
-             * set aborted transactions if present
-             */
-            if (!res.aborted_transactions.empty()) {
-                std::vector<fetch_response::aborted_transaction> aborted;
-                aborted.reserve(res.aborted_transactions.size());
-                std::transform(
-                  res.aborted_transactions.begin(),
-                  res.aborted_transactions.end(),
-                  std::back_inserter(aborted),
-                  [](cluster::rm_stm::tx_range range) {
-                      return fetch_response::aborted_transaction{
-                        .producer_id = kafka::producer_id(range.pid.id),
-                        .first_offset = range.first};
-                  });
-                resp.aborted = std::move(aborted);
-            }
             resp.records = batch_reader(std::move(res).release_data());
         } else {
+            /**
+             * Over response budget, we will just waste this read, it will
+             * cause data to be stored in the cache so next read is fast
+             */
             // TODO: add probe to measure how much of read data is discarded
+            resp.aborted.reset();
             resp.records = batch_reader();
         }
 
         resp_it->set(std::move(resp));
-        std::chrono::microseconds fetch_latency
-          = std::chrono::duration_cast<std::chrono::microseconds>(
-            op_context::latency_clock::now() - start_time);
         octx.rctx.probe().record_fetch_latency(fetch_latency);
     }
 }
@@ -524,7 +637,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
   std::optional<model::timeout_clock::time_point> deadline,
   const size_t bytes_left,
   ssx::semaphore& memory_sem,
-  ssx::semaphore& memory_fetch_sem) {
+  ssx::semaphore& memory_fetch_sem,
+  fetch_read_coalescer& coalescer) {
     size_t total_max_bytes = 0;
     for (const auto& c : ntp_fetch_configs) {
         total_max_bytes += c.cfg.max_bytes;
@@ -557,7 +671,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
        foreign_read,
        first_p_id,
        &memory_sem,
-       &memory_fetch_sem](const ntp_fetch_config& ntp_cfg) {
+       &memory_fetch_sem,
+       &coalescer](const ntp_fetch_config& ntp_cfg) {
           auto p_id = ntp_cfg.ktp().get_partition();
           return do_read_from_ntp(
                    cluster_pm,
@@ -567,7 +682,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
                    deadline,
                    first_p_id == p_id,
                    memory_sem,
-                   memory_fetch_sem)
+                   memory_fetch_sem,
+                   &coalescer)
             .then([p_id](read_result res) {
                 res.partition = p_id;
                 return res;
@@ -636,11 +752,13 @@ handle_shard_fetch(ss::shard_id shard, op_context& octx, shard_fetch fetch) {
               octx.deadline,
               octx.bytes_left,
               octx.rctx.server().local().memory(),
-              octx.rctx.server().local().memory_fetch_sem());
+              octx.rctx.server().local().memory_fetch_sem(),
+              octx.rctx.server().local().read_coalescer())
+              .then(prepare_partition_responses);
         })
       .then([responses = std::move(fetch.responses),
              start_time = fetch.start_time,
-             &octx](std::vector<read_result> results) mutable {
+             &octx](std::vector<prepared_partition_response> results) mutable {
           fill_fetch_responses(
             octx, std::move(results), std::move(responses), start_time);
       });
@@ -717,13 +835,37 @@ class simple_fetch_planner final : public fetch_planner::impl {
 
         plan.reserve_from_partition_count(octx.fetch_partition_count());
 
+        // the same for every partition in the request, built once per plan
+        const model::client_address_t client_address{fmt::format(
+          "{}:{}",
+          octx.rctx.connection()->client_host(),
+          octx.rctx.connection()->client_port())};
+        const bool read_from_follower = octx.request.has_rack_id();
+        const auto timeout = octx.deadline.value_or(model::no_timeout);
+        std::optional<ss::io_priority_class> io_priority;
+        if (octx.tenant) {
+            io_priority = octx.tenant->io_priority;
+        }
+        std::optional<config::fetch_record_filter> record_filter;
+        if (const auto* f = config::find_fetch_record_filter(
+              config::shard_local_cfg().kafka_fetch_record_filters(),
+              octx.rctx.header().client_id);
+            f != nullptr) {
+            record_filter = *f;
+        }
+
         /**
          * group fetch requests by shard
          */
         octx.for_each_fetch_partition([&resp_it,
                                        &octx,
                                        &plan,
-                                       &bytes_left_in_plan](
+                                       &bytes_left_in_plan,
+                                       &client_address,
+                                       &record_filter,
+                                       io_priority,
+                                       read_from_follower,
+                                       timeout](
                                         const fetch_session_partition& fp) {
             // if this is not an initial fetch we are allowed to skip
             // partions that aleready have an error or we have enough data
@@ -795,24 +937,21 @@ class simple_fetch_planner final : public fetch_planner::impl {
                 bytes_left_in_plan -= max_bytes;
             }
 
-            const auto client_address = fmt::format(
-              "{}:{}",
-              octx.rctx.connection()->client_host(),
-              octx.rctx.connection()->client_port());
-
             fetch_config config{
               .start_offset = fp.fetch_offset,
               .max_offset = model::model_limits<model::offset>::max(),
               .max_bytes = max_bytes,
-              .timeout = octx.deadline.value_or(model::no_timeout),
+              .timeout = timeout,
               .current_leader_epoch = fp.current_leader_epoch,
               .isolation_level = octx.request.data.isolation_level,
               .strict_max_bytes = octx.response_size > 0,
               .skip_read = bytes_left_in_plan == 0 && max_bytes == 0,
-              .read_from_follower = octx.request.has_rack_id(),
+              .read_from_follower = read_from_follower,
               .consumer_rack_id = octx.request.data.rack_id,
               .abort_source = octx.rctx.abort_source(),
-              .client_address = model::client_address_t{client_address},
+              .client_address = client_address,
+              .io_priority = io_priority,
+              .record_filter = record_filter,
             };
 
             plan.fetches_per_shard[*shard].push_back({tp, config}, &(*resp_it));
@@ -846,6 +985,95 @@ class simple_fetch_planner final : public fetch_planner::impl {
  * order as the partitions in the request.
  */
 
+/**
+ * Wait until new data may be visible to the fetch on any of the partitions it
+ * keeps reading, rather than polling the partitions until the deadline. Every
+ * shard hosting one of the partitions registers a waiter on their visible
+ * offset monitors, the first one to resolve cancels the other ones.
+ */
+static ss::future<> wait_for_new_data(op_context& octx) {
+    std::vector<std::vector<fetch_wait_partition>> per_shard(ss::smp::count);
+    bool has_partitions = false;
+    auto resp_it = octx.response_begin();
+    octx.for_each_fetch_partition(
+      [&octx, &resp_it, &per_shard, &has_partitions](
+        const fetch_session_partition& fp) {
+          auto& resp = *resp_it;
+          ++resp_it;
+          if (resp.has_error()) {
+              return;
+          }
+          auto shard = octx.rctx.shards().shard_for(fp.topic_partition);
+          if (!shard) {
+              return;
+          }
+          per_shard[*shard].push_back(fetch_wait_partition{
+            .ktp = fp.topic_partition,
+            .threshold = std::max(fp.fetch_offset, resp.high_watermark()),
+          });
+          has_partitions = true;
+      });
+
+    if (!has_partitions) {
+        // nothing to wait on, debounce next read retry
+        co_await ss::sleep(std::min(
+          config::shard_local_cfg().fetch_reads_debounce_timeout(),
+          octx.request.data.max_wait_ms));
+        co_return;
+    }
+
+    const auto id = octx.rctx.server().local().fetch_waiters().next_wait_id();
+    const auto deadline = octx.deadline.value_or(model::no_timeout);
+    const auto isolation_level = octx.request.data.isolation_level;
+
+    ss::promise<> woken;
+    bool done = false;
+    std::vector<ss::shard_id> shards;
+    std::vector<ss::future<>> waits;
+    for (ss::shard_id shard = 0; shard < ss::smp::count; ++shard) {
+        if (per_shard[shard].empty()) {
+            continue;
+        }
+        shards.push_back(shard);
+        waits.push_back(
+          octx.rctx.partition_manager()
+            .invoke_on(
+              shard,
+              octx.ssg,
+              [id,
+               deadline,
+               isolation_level,
+               partitions = std::move(per_shard[shard]),
+               &octx](cluster::partition_manager& mgr) mutable {
+                  return octx.rctx.server().local().fetch_waiters().wait(
+                    id,
+                    mgr,
+                    std::move(partitions),
+                    isolation_level,
+                    deadline,
+                    octx.rctx.abort_source().local());
+              })
+            .handle_exception([](const std::exception_ptr& e) {
+                vlog(klog.debug, "error waiting for fetch data: {}", e);
+            })
+            .finally([&woken, &done] {
+                if (!done) {
+                    done = true;
+                    woken.set_value();
+                }
+            }));
+    }
+
+    co_await woken.get_future();
+    // the cancel is submitted with the same service group as the wait so it
+    // is always processed after the wait was registered
+    co_await ss::parallel_for_each(shards, [id, &octx](ss::shard_id shard) {
+        return octx.rctx.server().invoke_on(
+          shard, octx.ssg, [id](server& s) { s.fetch_waiters().cancel(id); });
+    });
+    co_await ss::when_all_succeed(waits.begin(), waits.end());
+}
+
 static ss::future<> fetch_topic_partitions(op_context& octx) {
     auto bytes_left_before = octx.bytes_left;
 
@@ -871,10 +1099,7 @@ static ss::future<> fetch_topic_partitions(op_context& octx) {
     }
 
     octx.reset_context();
-    // debounce next read retry
-    co_await ss::sleep(std::min(
-      config::shard_local_cfg().fetch_reads_debounce_timeout(),
-      octx.request.data.max_wait_ms));
+    co_await wait_for_new_data(octx);
 }
 
 namespace testing {
@@ -890,8 +1115,14 @@ fetch_handler::handle(request_context rctx, ss::smp_service_group ssg) {
     return ss::do_with(
       std::make_unique<op_context>(std::move(rctx), ssg),
       [](std::unique_ptr<op_context>& octx_ptr) {
-          auto sg
-            = octx_ptr->rctx.connection()->server().fetch_scheduling_group();
+          auto& conn = *octx_ptr->rctx.connection();
+          auto sg = conn.server().fetch_scheduling_group();
+          // the fetches of an isolated tenant run in its own group
+          octx_ptr->tenant = conn.server().tenants().find(
+            conn.get_principal(), octx_ptr->request.data.topics);
+          if (octx_ptr->tenant) {
+              sg = octx_ptr->tenant->sg;
+          }
           return ss::with_scheduling_group(sg, [&octx_ptr] {
               auto& octx = *octx_ptr;
 
@@ -1201,7 +1432,11 @@ rack_aware_replica_selector::rack_aware_replica_selector(
 
 std::optional<model::node_id> rack_aware_replica_selector::select_replica(
   const consumer_info& c_info, const partition_info& p_info) const {
-    if (!c_info.rack_id.has_value()) {
+    const bool has_observers = std::any_of(
+      p_info.replicas.begin(),
+      p_info.replicas.end(),
+      [](const replica_info& r) { return r.is_observer; });
+    if (!c_info.rack_id.has_value() && !has_observers) {
         return select_leader_replica{}.select_replica(c_info, p_info);
     }
     if (p_info.replicas.empty()) {
@@ -1209,6 +1444,7 @@ std::optional<model::node_id> rack_aware_replica_selector::select_replica(
     }
 
     std::vector<replica_info> rack_replicas;
+    std::vector<replica_info> observers;
     model::offset highest_hw;
     for (auto& replica : p_info.replicas) {
         // filter out replicas which are not responsive
@@ -1228,22 +1464,42 @@ std::optional<model::node_id> rack_aware_replica_selector::select_replica(
             continue;
         }
 
+        if (replica.log_end_offset < c_info.fetch_offset) {
+            continue;
+        }
         if (
-          node_it->second.broker.rack() == c_info.rack_id
-          && replica.log_end_offset >= c_info.fetch_offset) {
+          c_info.rack_id.has_value()
+          && node_it->second.broker.rack() == c_info.rack_id) {
             if (replica.high_watermark >= highest_hw) {
                 highest_hw = replica.high_watermark;
                 rack_replicas.push_back(replica);
             }
         }
+        if (replica.is_observer) {
+            observers.push_back(replica);
+        }
     }
 
-    if (rack_replicas.empty()) {
-        return std::nullopt;
+    // the observers in the requested rack take the reads off the voters,
+    // then the observers in any rack
+    std::vector<replica_info> rack_observers;
+    std::copy_if(
+      rack_replicas.begin(),
+      rack_replicas.end(),
+      std::back_inserter(rack_observers),
+      [](const replica_info& r) { return r.is_observer; });
+    if (!rack_observers.empty()) {
+        return random_generators::random_choice(rack_observers).id;
+    }
+    if (!rack_replicas.empty()) {
+        // if there are multiple replicas with the same high watermark in
+        // requested rack, return random one
+        return random_generators::random_choice(rack_replicas).id;
+    }
+    if (!observers.empty()) {
+        return random_generators::random_choice(observers).id;
     }
-    // if there are multiple replicas with the same high watermark in
-    // requested rack, return random one
-    return random_generators::random_choice(rack_replicas).id;
+    return std::nullopt;
 }
 
 std::ostream& operator<<(std::ostream& o, const consumer_info& ci) {
@@ -9,10 +9,13 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "bytes/foreign_iobuf.h"
 #include "cluster/rm_stm.h"
+#include "config/fetch_record_filter.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/server/handlers/fetch/replica_selector.h"
 #include "kafka/server/handlers/handler.h"
+#include "kafka/server/tenant_isolation.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/ktp.h"
@@ -21,9 +24,11 @@
 #include "utils/intrusive_list_helpers.h"
 #include "utils/log_hist.h"
 
+#include <seastar/core/io_priority_class.hh>
 #include <seastar/core/smp.hh>
 
 #include <memory>
+#include <optional>
 
 namespace kafka {
 
@@ -51,6 +56,9 @@ struct op_context {
         bool has_error() {
             return _it->partition_response->error_code != error_code::none;
         }
+        model::offset high_watermark() {
+            return _it->partition_response->high_watermark;
+        }
         void move_to_end() {
             _ctx->iteration_order.erase(
               _ctx->iteration_order.iterator_to(*this));
@@ -157,6 +165,8 @@ struct op_context {
     // for fetches that have preferred replica set we skip read, therefore we
     // need other indicator of finished fetch request.
     bool contains_preferred_replica = false;
+    // the isolated tenant the fetch is made for, if any
+    std::optional<tenant_isolation::tenant> tenant;
 };
 
 struct fetch_config {
@@ -173,11 +183,15 @@ struct fetch_config {
     std::optional<std::reference_wrapper<ssx::sharded_abort_source>>
       abort_source;
     std::optional<model::client_address_t> client_address;
+    // the I/O priority class of the reads, kafka_read_priority() if unset
+    std::optional<ss::io_priority_class> io_priority;
+    // the kafka_fetch_record_filters entry of the client, if any
+    std::optional<config::fetch_record_filter> record_filter;
 
     friend std::ostream& operator<<(std::ostream& o, const fetch_config& cfg) {
         fmt::print(
           o,
-          R"({{"start_offset": {}, "max_offset": {}, "isolation_lvl": {}, "max_bytes": {}, "strict_max_bytes": {}, "skip_read": {}, "current_leader_epoch:" {}, "follower_read:" {}, "consumer_rack_id": {}, "abortable": {}, "aborted": {}, "client_address": {}}})",
+          R"({{"start_offset": {}, "max_offset": {}, "isolation_lvl": {}, "max_bytes": {}, "strict_max_bytes": {}, "skip_read": {}, "current_leader_epoch:" {}, "follower_read:" {}, "consumer_rack_id": {}, "abortable": {}, "aborted": {}, "client_address": {}, "record_filter": {}}})",
           cfg.start_offset,
           cfg.max_offset,
           cfg.isolation_level,
@@ -191,7 +205,8 @@ struct fetch_config {
           cfg.abort_source.has_value()
             ? cfg.abort_source.value().get().abort_requested()
             : false,
-          cfg.client_address.value_or(model::client_address_t{"unknown"}));
+          cfg.client_address.value_or(model::client_address_t{"unknown"}),
+          cfg.record_filter ? cfg.record_filter->name : "none");
         return o;
     }
 };
@@ -216,7 +231,7 @@ struct ntp_fetch_config {
  * Simple type aggregating either data or an error
  */
 struct read_result {
-    using foreign_data_t = ss::foreign_ptr<std::unique_ptr<iobuf>>;
+    using foreign_data_t = foreign_iobuf;
     using data_t = std::unique_ptr<iobuf>;
     using variant_t = std::variant<data_t, foreign_data_t>;
 
@@ -311,11 +326,7 @@ struct read_result {
         return ss::visit(
           data,
           [](data_t& d) { return std::move(*d); },
-          [](foreign_data_t& d) {
-              auto ret = d->copy();
-              d.reset();
-              return ret;
-          });
+          [](foreign_data_t& d) { return adopt_foreign_iobuf(std::move(d)); });
     }
 
     variant_t data;
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/handlers/fetch/data_waiters.h"
+
+#include "cluster/partition.h"
+#include "cluster/partition_manager.h"
+#include "kafka/server/partition_proxy.h"
+#include "raft/consensus.h"
+#include "ssx/future-util.h"
+
+namespace kafka {
+
+namespace {
+
+model::offset
+visible_offset(const partition_proxy& part, model::isolation_level level) {
+    if (level == model::isolation_level::read_committed) {
+        auto lso = part.last_stable_offset();
+        // wake the fetch up so that it reports the error
+        return lso.has_error() ? model::offset::max() : lso.value();
+    }
+    return part.high_watermark();
+}
+
+ss::future<> wait_for_partition(
+  partition_proxy part,
+  raft::consensus_ptr raft,
+  model::offset threshold,
+  model::isolation_level level,
+  model::timeout_clock::time_point deadline,
+  ss::abort_source& as) {
+    auto next = model::next_offset(raft->last_visible_index());
+    while (visible_offset(part, level) <= threshold) {
+        co_await raft->visible_offset_monitor().wait(next, deadline, as);
+        // always wait for an offset past the one just notified, the visible
+        // offset may advance without changing the offset visible to kafka
+        next = std::max(
+          model::next_offset(next),
+          model::next_offset(raft->last_visible_index()));
+    }
+}
+
+} // namespace
+
+void fetch_data_waiters::waiter::wake() {
+    if (done) {
+        return;
+    }
+    done = true;
+    woken.set_value();
+    // stop waiting on the remaining partitions
+    as.request_abort();
+}
+
+ss::future<> fetch_data_waiters::wait(
+  fetch_wait_id id,
+  cluster::partition_manager& mgr,
+  std::vector<fetch_wait_partition> partitions,
+  model::isolation_level level,
+  model::timeout_clock::time_point deadline,
+  ss::abort_source& connection_as) {
+    auto w = ss::make_lw_shared<waiter>();
+    _waiters.emplace(id, w);
+
+    auto sub = connection_as.subscribe([w]() noexcept { w->wake(); });
+    if (!sub || partitions.empty()) {
+        w->wake();
+    }
+
+    for (auto& p : partitions) {
+        if (w->done) {
+            break;
+        }
+        auto partition = mgr.get(p.ktp);
+        auto proxy = make_partition_proxy(p.ktp, mgr);
+        if (!partition || !proxy) {
+            // the partition was moved away, let the fetch report it
+            w->wake();
+            break;
+        }
+        ssx::background = wait_for_partition(
+                            std::move(*proxy),
+                            partition->raft(),
+                            p.threshold,
+                            level,
+                            deadline,
+                            w->as)
+                            .then_wrapped([w](ss::future<> f) {
+                                f.ignore_ready_future();
+                                w->wake();
+                            });
+    }
+
+    co_await w->woken.get_future();
+    _waiters.erase(id);
+}
+
+void fetch_data_waiters::cancel(fetch_wait_id id) {
+    if (auto it = _waiters.find(id); it != _waiters.end()) {
+        it->second->wake();
+    }
+}
+
+} // namespace kafka
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/fwd.h"
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "model/timeout_clock.h"
+#include "seastarx.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/smp.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Identifies a long-polling fetch waiting for new data. Ids are unique for the
+ * node as the sequence is assigned by the shard the fetch is handled on.
+ */
+struct fetch_wait_id {
+    ss::shard_id shard;
+    uint64_t seq{0};
+
+    bool operator==(const fetch_wait_id&) const = default;
+
+    template<typename H>
+    friend H AbslHashValue(H h, const fetch_wait_id& id) {
+        return H::combine(std::move(h), id.shard, id.seq);
+    }
+};
+
+/**
+ * A partition a fetch waits on. The fetch is woken as soon as the offset
+ * visible to it (high watermark or last stable offset depending on the
+ * isolation level) advances past the threshold.
+ */
+struct fetch_wait_partition {
+    model::ktp ktp;
+    model::offset threshold;
+};
+
+/**
+ * Shard-local registry of the long-polling fetches waiting for new data on
+ * the partitions of the shard.
+ *
+ * A fetch that did not collect min_bytes registers a waiter on every shard
+ * hosting the partitions it reads. The waiter subscribes to the visible offset
+ * monitor of each of the partitions and resolves as soon as the offset visible
+ * to the fetch advances on any of them, the deadline expires, the connection
+ * is aborted or the wait is cancelled. The shard the fetch is handled on
+ * cancels the waiters of the remaining shards once the first one resolves.
+ */
+class fetch_data_waiters {
+public:
+    fetch_wait_id next_wait_id() {
+        return fetch_wait_id{.shard = ss::this_shard_id(), .seq = ++_last_seq};
+    }
+
+    ss::future<> wait(
+      fetch_wait_id,
+      cluster::partition_manager&,
+      std::vector<fetch_wait_partition>,
+      model::isolation_level,
+      model::timeout_clock::time_point deadline,
+      ss::abort_source&);
+
+    /// Resolve the wait with the given id if it is still pending. The cancel
+    /// has to be submitted by the shard that submitted the wait, after it, so
+    /// that it is never processed before the wait is registered.
+    void cancel(fetch_wait_id);
+
+    size_t size() const { return _waiters.size(); }
+
+private:
+    struct waiter {
+        ss::abort_source as;
+        ss::promise<> woken;
+        bool done{false};
+
+        void wake();
+    };
+
+    absl::flat_hash_map<fetch_wait_id, ss::lw_shared_ptr<waiter>> _waiters;
+    uint64_t _last_seq{0};
+};
+
+} // namespace kafka
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cluster/rm_stm.h"
+#include "kafka/protocol/errors.h"
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+namespace kafka {
+
+/**
+ * Identifies a partition read. Two fetches that read the same partition with
+ * the same key observe the same data while their reads overlap in time.
+ */
+struct fetch_read_key {
+    model::ktp ktp;
+    model::offset start_offset;
+    model::offset max_offset;
+    size_t max_bytes{0};
+    bool strict_max_bytes{false};
+
+    bool operator==(const fetch_read_key&) const = default;
+
+    template<typename H>
+    friend H AbslHashValue(H h, const fetch_read_key& k) {
+        return H::combine(
+          std::move(h),
+          std::hash<model::ktp>{}(k.ktp),
+          k.start_offset(),
+          k.max_offset(),
+          k.max_bytes,
+          k.strict_max_bytes);
+    }
+};
+
+/**
+ * The data read from a partition on behalf of one or more fetches.
+ */
+struct fetch_partition_read {
+    iobuf data;
+    uint32_t record_count{0};
+    std::vector<cluster::rm_stm::tx_range> aborted_transactions;
+
+    // set when the log was prefix truncated while reading
+    std::optional<error_code> error;
+    model::offset start_offset;
+    model::offset high_watermark;
+};
+
+/**
+ * Shard-local registry of in-flight partition reads.
+ *
+ * When many consumers long-poll the tail of the same partition, their fetches
+ * wake up together and each one would create a reader and decode the same
+ * newly appended batches. The coalescer lets a fetch join a read that is
+ * already in flight for the same key, so N concurrent reads turn into one
+ * read whose immutable result is shared by all of them. Every participant
+ * receives its own iobuf sharing the fragments of the original result.
+ *
+ * Only reads that are in flight are shared; nothing is retained once the read
+ * completes so no invalidation is required.
+ */
+class fetch_read_coalescer {
+public:
+    using read_ptr = ss::lw_shared_ptr<fetch_partition_read>;
+
+    /**
+     * Return the result of the in-flight read for \p key, or start a new read
+     * by invoking \p read_fn.
+     */
+    template<typename Func>
+    requires std::is_invocable_r_v<ss::future<read_ptr>, Func>
+    ss::future<read_ptr> read(const fetch_read_key& key, Func&& read_fn) {
+        if (auto it = _inflight.find(key); it != _inflight.end()) {
+            ++_coalesced_reads;
+            return it->second.get_future();
+        }
+
+        ss::shared_future<read_ptr> read(
+          ss::futurize_invoke(std::forward<Func>(read_fn)));
+        auto f = read.get_future();
+        if (f.available()) {
+            return f;
+        }
+        _inflight.emplace(key, std::move(read));
+        return f.finally([this, key] { _inflight.erase(key); });
+    }
+
+    size_t inflight_reads() const { return _inflight.size(); }
+    uint64_t coalesced_reads() const { return _coalesced_reads; }
+
+private:
+    absl::flat_hash_map<fetch_read_key, ss::shared_future<read_ptr>> _inflight;
+    uint64_t _coalesced_reads{0};
+};
+
+} // namespace kafka
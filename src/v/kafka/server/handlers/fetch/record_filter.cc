@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/handlers/fetch/record_filter.h"
+
+#include "model/record_utils.h"
+#include "storage/parser_utils.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <algorithm>
+#include <string_view>
+
+namespace kafka {
+
+namespace {
+
+bool starts_with(const iobuf& buf, std::string_view prefix) {
+    if (buf.size_bytes() < prefix.size()) {
+        return false;
+    }
+    for (const auto& frag : buf) {
+        if (prefix.empty()) {
+            break;
+        }
+        auto n = std::min(frag.size(), prefix.size());
+        if (std::string_view(frag.get(), n) != prefix.substr(0, n)) {
+            return false;
+        }
+        prefix.remove_prefix(n);
+    }
+    return true;
+}
+
+} // namespace
+
+bool record_filter_matches(
+  const config::fetch_record_filter& filter, const model::record& record) {
+    if (filter.key_prefix && !starts_with(record.key(), *filter.key_prefix)) {
+        return false;
+    }
+    if (!filter.header_key) {
+        return true;
+    }
+    return std::any_of(
+      record.headers().begin(),
+      record.headers().end(),
+      [&filter](const model::record_header& h) {
+          return h.key() == *filter.header_key
+                 && (!filter.header_value || h.value() == *filter.header_value);
+      });
+}
+
+ss::future<model::record_batch> filter_batch(
+  const config::fetch_record_filter& filter, model::record_batch batch) {
+    if (
+      batch.header().type != model::record_batch_type::raft_data
+      || batch.header().attrs.is_control()) {
+        co_return batch;
+    }
+
+    const auto compression = batch.header().attrs.compression();
+    // kept to be returned as is if every record matches
+    auto original = batch.share();
+    if (batch.compressed()) {
+        batch = co_await storage::internal::decompress_batch(std::move(batch));
+    }
+
+    iobuf records;
+    int32_t record_count = 0;
+    batch.for_each_record([&filter, &records, &record_count](
+                            model::record record) {
+        if (record_filter_matches(filter, record)) {
+            model::append_record_to_buffer(records, record);
+            ++record_count;
+        }
+    });
+    if (record_count == batch.record_count()) {
+        co_return original;
+    }
+
+    // the records keep their offset and timestamp deltas, so the header keeps
+    // its base offset, last offset delta and timestamps.
+    auto hdr = batch.header();
+    hdr.record_count = record_count;
+    storage::internal::reset_size_checksum_metadata(hdr, records);
+    model::record_batch filtered(
+      hdr, std::move(records), model::record_batch::tag_ctor_ng{});
+    if (record_count == 0 || compression == model::compression::none) {
+        co_return filtered;
+    }
+    co_return co_await storage::internal::compress_batch(
+      compression, std::move(filtered));
+}
+
+ss::future<ss::stop_iteration>
+filtering_batch_serializer::operator()(model::record_batch&& batch) {
+    auto filtered = co_await filter_batch(_filter, std::move(batch));
+    co_return co_await _serializer(std::move(filtered));
+}
+
+} // namespace kafka
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "config/fetch_record_filter.h"
+#include "kafka/protocol/batch_consumer.h"
+#include "model/record.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+
+namespace kafka {
+
+/// True if \p record is returned to the clients using \p filter.
+bool record_filter_matches(
+  const config::fetch_record_filter& filter, const model::record& record);
+
+/**
+ * Only keeps the records of \p batch matching \p filter.
+ *
+ * The batch keeps its base offset and last offset delta, like a compacted
+ * batch does, so that the consumer moves past the records filtered out. A
+ * batch without any matching record is returned empty rather than dropped,
+ * otherwise a consumer whose every fetched record is filtered out would
+ * never make progress. A compressed batch is compressed again with the same
+ * codec when some of its records are filtered out.
+ *
+ * Control batches and batches other than raft_data are returned as they are.
+ */
+ss::future<model::record_batch>
+filter_batch(const config::fetch_record_filter& filter, model::record_batch);
+
+/**
+ * A kafka_batch_serializer applying a fetch_record_filter to the batches it
+ * serializes. The filter must outlive the serializer.
+ */
+class filtering_batch_serializer {
+public:
+    filtering_batch_serializer(
+      const config::fetch_record_filter& filter, bool share_records) noexcept
+      : _filter(filter)
+      , _serializer(share_records) {}
+
+    ss::future<ss::stop_iteration> operator()(model::record_batch&& batch);
+
+    kafka_batch_serializer::result end_of_stream() {
+        return _serializer.end_of_stream();
+    }
+
+private:
+    const config::fetch_record_filter& _filter;
+    kafka_batch_serializer _serializer;
+};
+
+} // namespace kafka
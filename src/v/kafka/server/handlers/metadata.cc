@@ -36,6 +36,7 @@
 #include <boost/numeric/conversion/cast.hpp>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
 
@@ -237,6 +238,54 @@ make_error_topic_response(model::topic tp, error_code ec) {
     return metadata_response::topic{.error_code = ec, .name = std::move(tp)};
 }
 
+/**
+ * The response of a topic can be cached when it only depends on the state
+ * tracked by the metadata topic cache, i.e. every partition either reports an
+ * error or has a current leader. The leader returned for a partition without
+ * a leader may be picked at random, see get_leader_term.
+ */
+static bool is_cacheable(
+  const cluster::metadata_cache& md_cache,
+  model::topic_namespace_view tp_ns,
+  const metadata_response::topic& tp) {
+    return std::all_of(
+      tp.partitions.begin(),
+      tp.partitions.end(),
+      [&md_cache, tp_ns](const metadata_response::partition& p) {
+          return p.error_code != error_code::none
+                 || md_cache.get_leader_id(tp_ns, p.partition_index)
+                      .has_value();
+      });
+}
+
+static metadata_response::topic get_topic_response(
+  request_context& ctx,
+  const cluster::topic_metadata& md,
+  const is_node_isolated_or_decommissioned is_node_isolated) {
+    // neither the randomized leaders reported by an isolated node nor the
+    // errors of the recovery mode are tracked by the cache
+    if (is_node_isolated || ctx.recovery_mode_enabled()) {
+        return make_topic_response_from_topic_metadata(
+          ctx.metadata_cache(),
+          md,
+          is_node_isolated,
+          ctx.recovery_mode_enabled());
+    }
+
+    auto& cache = ctx.get_metadata_topic_cache();
+    const auto& tp_ns = md.get_configuration().tp_ns;
+    if (auto cached = cache.get(tp_ns); cached) {
+        return std::move(*cached);
+    }
+
+    auto res = make_topic_response_from_topic_metadata(
+      ctx.metadata_cache(), md, is_node_isolated_or_decommissioned::no, false);
+    if (is_cacheable(ctx.metadata_cache(), tp_ns, res)) {
+        cache.put(tp_ns, res);
+    }
+    return res;
+}
+
 static metadata_response::topic make_topic_response(
   request_context& ctx,
   metadata_request& rq,
@@ -251,8 +300,7 @@ static metadata_response::topic make_topic_response(
           details::authorized_operations(ctx, md.get_configuration().tp_ns.tp));
     }
 
-    auto res = make_topic_response_from_topic_metadata(
-      ctx.metadata_cache(), md, is_node_isolated, ctx.recovery_mode_enabled());
+    auto res = get_topic_response(ctx, md, is_node_isolated);
     res.topic_authorized_operations = auth_operations;
     return res;
 }
@@ -447,6 +495,17 @@ guess_peer_listener(request_context& ctx, const cluster::node_metadata& nm) {
     }
 }
 
+std::optional<model::broker_endpoint>
+get_peer_listener(request_context& ctx, const cluster::node_metadata& nm) {
+    for (const auto& listener : nm.broker.kafka_advertised_listeners()) {
+        // filter broker listeners by active connection
+        if (listener.name == ctx.listener()) {
+            return listener;
+        }
+    }
+    return guess_peer_listener(ctx, nm);
+}
+
 // If node isolated or decomissioned it can not handle kafka requests from
 // client, so in this case we need to signal client comunicate with another
 // broker. For this we need to exclude isolated node from brokers list and
@@ -468,19 +527,7 @@ static ss::future<metadata_response> fill_info_about_brokers_and_controller_id(
             continue;
         }
 
-        std::optional<model::broker_endpoint> peer_listener;
-        for (const auto& listener : nm.broker.kafka_advertised_listeners()) {
-            // filter broker listeners by active connection
-            if (listener.name == ctx.listener()) {
-                peer_listener = listener;
-                break;
-            }
-        }
-
-        if (!peer_listener) {
-            peer_listener = guess_peer_listener(ctx, nm);
-        }
-
+        auto peer_listener = get_peer_listener(ctx, nm);
         if (peer_listener) {
             reply.data.brokers.push_back(metadata_response::broker{
               .node_id = nm.broker.id(),
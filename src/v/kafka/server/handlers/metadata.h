@@ -9,8 +9,12 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "cluster/types.h"
 #include "kafka/protocol/metadata.h"
 #include "kafka/server/handlers/handler.h"
+#include "model/metadata.h"
+
+#include <optional>
 
 namespace kafka {
 
@@ -24,6 +28,13 @@ namespace kafka {
  */
 memory_estimate_fn metadata_memory_estimator;
 
+/**
+ * The listener of the peer \p nm which a client of the listener serving \p ctx
+ * should connect to, or nullopt if the peer has no kafka listener.
+ */
+std::optional<model::broker_endpoint>
+get_peer_listener(request_context& ctx, const cluster::node_metadata& nm);
+
 using metadata_handler
   = single_stage_handler<metadata_api, 0, 7, metadata_memory_estimator>;
 
@@ -9,6 +9,7 @@
 
 #include "kafka/server/handlers/produce.h"
 
+#include "bytes/foreign_iobuf.h"
 #include "bytes/iobuf.h"
 #include "cluster/metadata_cache.h"
 #include "cluster/partition_manager.h"
@@ -16,7 +17,10 @@
 #include "config/configuration.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
+#include "kafka/server/handlers/metadata.h"
 #include "kafka/server/replicated_partition.h"
+#include "kafka/server/server.h"
+#include "kafka/types.h"
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -34,10 +38,12 @@
 
 #include <seastar/core/execution_stage.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/util/log.hh>
 
+#include <absl/container/flat_hash_set.h>
 #include <boost/container_hash/extensions.hpp>
 #include <fmt/ostream.h>
 
@@ -50,6 +56,9 @@ namespace kafka {
 
 static constexpr auto despam_interval = std::chrono::minutes(5);
 
+// first version with the current leaders of the partitions (KIP-951)
+static constexpr api_version current_leader_version{10};
+
 produce_response produce_request::make_error_response(error_code error) const {
     produce_response response;
 
@@ -126,16 +135,34 @@ acks_to_replicate_options(int16_t acks, std::chrono::milliseconds timeout) {
     };
 }
 
+/*
+ * A produced batch on its way to the home core of its partition.
+ *
+ * Only the ownership of the records is handed over, the fragments are
+ * referenced in place by the home core and released back on the connection
+ * core once the partition is done with them. When the partition is managed by
+ * the connection core the records are simply moved.
+ */
+struct lcore_batch {
+    model::record_batch_header header;
+    foreign_iobuf records;
+};
+
+static inline lcore_batch make_lcore_batch(model::record_batch&& batch) {
+    auto header = batch.header();
+    return lcore_batch{
+      .header = header,
+      .records = make_foreign_iobuf(std::move(batch).release_data()),
+    };
+}
+
 static inline model::record_batch_reader
-reader_from_lcore_batch(model::record_batch&& batch) {
-    /*
-     * The remainder of work for this partition is handled on its home
-     * core. The foreign memory record batch reader requires that once the
-     * reader is sent to the foreign core that it has exclusive access to the
-     * data in reader. That is true here and is generally trivial with readers
-     * that hold a copy of their data in memory.
-     */
-    return model::make_foreign_memory_record_batch_reader(std::move(batch));
+reader_from_lcore_batch(lcore_batch&& batch) {
+    auto header = batch.header.copy();
+    return model::make_memory_record_batch_reader(model::record_batch(
+      header,
+      adopt_foreign_iobuf(std::move(batch.records)),
+      model::record_batch::tag_ctor_ng{}));
 }
 
 static error_code map_produce_error_code(std::error_code ec) {
@@ -367,7 +394,7 @@ static partition_produce_stages produce_topic_partition(
     auto bid = model::batch_identity::from(hdr);
     auto batch_size = batch.size_bytes();
     auto num_records = batch.record_count();
-    auto reader = reader_from_lcore_batch(std::move(batch));
+    auto records = make_lcore_batch(std::move(batch));
     auto validator
       = pandaproxy::schema_registry::maybe_make_schema_id_validator(
         octx.rctx.schema_registry(), topic.name, topic_cfg->properties);
@@ -381,7 +408,7 @@ static partition_produce_stages produce_topic_partition(
           .invoke_on(
             *shard,
             octx.ssg,
-            [reader = std::move(reader),
+            [records = std::move(records),
              validator = std::move(validator),
              ntp = std::move(ntp),
              dispatch = std::move(dispatch),
@@ -419,7 +446,9 @@ static partition_produce_stages produce_topic_partition(
 
                 auto probe = std::addressof(partition->probe());
                 return pandaproxy::schema_registry::maybe_validate_schema_id(
-                         std::move(validator), std::move(reader), probe)
+                         std::move(validator),
+                         reader_from_lcore_batch(std::move(records)),
+                         probe)
                   .then([ntp{std::move(ntp)},
                          partition{std::move(partition)},
                          dispatch = std::move(dispatch),
@@ -602,6 +631,50 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
     };
 }
 
+/**
+ * \brief Point the clients of the partitions this node doesn't lead to their
+ * current leaders (KIP-951), so that they can retry against the new leader
+ * without refreshing their metadata first.
+ */
+static void fill_current_leaders(produce_ctx& octx) {
+    const auto& md_cache = octx.rctx.metadata_cache();
+    absl::flat_hash_set<model::node_id> leaders;
+    for (auto& topic : octx.response.data.responses) {
+        for (auto& p : topic.partitions) {
+            if (p.error_code != error_code::not_leader_for_partition) {
+                continue;
+            }
+            auto leader_term = md_cache.get_leader_term(
+              model::topic_namespace_view(model::kafka_namespace, topic.name),
+              p.partition_index);
+            if (!leader_term || !leader_term->leader) {
+                continue;
+            }
+            p.current_leader = leader_id_and_epoch{
+              .leader_id = *leader_term->leader,
+              .leader_epoch = leader_epoch_from_term(leader_term->term),
+            };
+            leaders.insert(*leader_term->leader);
+        }
+    }
+
+    for (auto id : leaders) {
+        auto nm = md_cache.get_node_metadata(id);
+        if (!nm) {
+            continue;
+        }
+        auto listener = get_peer_listener(octx.rctx, *nm);
+        if (listener) {
+            octx.response.data.node_endpoints.push_back(node_endpoint{
+              .node_id = id,
+              .host = listener->address.host(),
+              .port = listener->address.port(),
+              .rack = nm->broker.rack(),
+            });
+        }
+    }
+}
+
 /**
  * \brief Dispatch and collect topic produce responses
  */
@@ -759,9 +832,22 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
 
     request.data.topics.erase(unauthorized_it, request.data.topics.end());
 
+    // the requests of an isolated tenant are processed in its own group. the
+    // group is inherited by the tasks on the partition shards.
+    auto sg = ss::current_scheduling_group();
+    if (auto tenant = ctx.connection()->server().tenants().find(
+          ctx.connection()->get_principal(), request.data.topics);
+        tenant) {
+        sg = tenant->sg;
+    }
+
     ss::promise<> dispatched_promise;
     auto dispatched_f = dispatched_promise.get_future();
-    auto produced_f = ss::do_with(
+    auto produced_f = ss::with_scheduling_group(
+      sg,
+      [](produce_ctx octx, auto f) {
+          return ss::do_with(std::move(octx), std::move(f));
+      },
       produce_ctx(std::move(ctx), std::move(request), std::move(resp), ssg),
       [dispatched_promise = std::move(dispatched_promise)](
         produce_ctx& octx) mutable {
@@ -794,6 +880,12 @@ produce_handler::handle(request_context ctx, ss::smp_service_group ssg) {
                               std::back_inserter(octx.response.data.responses));
                         })
                       .then([&octx] {
+                          if (
+                            octx.rctx.header().version
+                            >= current_leader_version) {
+                              fill_current_leaders(octx);
+                          }
+
                           // send response immediately
                           if (octx.request.data.acks != 0) {
                               return octx.rctx.respond(
@@ -14,6 +14,6 @@
 
 namespace kafka {
 
-using produce_handler = two_phase_handler<produce_api, 0, 7>;
+using produce_handler = two_phase_handler<produce_api, 0, 10>;
 
 } // namespace kafka
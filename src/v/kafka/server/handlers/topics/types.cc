@@ -194,6 +194,12 @@ to_cluster_type(const creatable_topic& t) {
       = get_tristate_value<std::chrono::milliseconds>(
         config_entries, topic_property_initial_retention_local_target_ms);
 
+    cfg.properties.write_caching = get_bool_value(
+      config_entries, topic_property_write_caching);
+
+    cfg.properties.observer_replicas = get_config_value<int16_t>(
+      config_entries, topic_property_observer_replicas);
+
     schema_id_validation_config_parser schema_id_validation_config_parser{
       cfg.properties};
 
@@ -362,6 +368,14 @@ config_map_t from_cluster_type(const cluster::topic_properties& properties) {
         config_entries[topic_property_initial_retention_local_target_ms]
           = from_config_type(*properties.initial_retention_local_target_ms);
     }
+    if (properties.write_caching.has_value()) {
+        config_entries[topic_property_write_caching] = from_config_type(
+          *properties.write_caching);
+    }
+    if (properties.observer_replicas.has_value()) {
+        config_entries[topic_property_observer_replicas] = from_config_type(
+          *properties.observer_replicas);
+    }
 
     /// Final topic_property not encoded here is \ref remote_topic_properties,
     /// is more of an implementation detail no need to ever show user
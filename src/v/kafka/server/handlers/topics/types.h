@@ -101,6 +101,12 @@ static constexpr std::string_view
   topic_property_initial_retention_local_target_ms
   = "initial.retention.local.target.ms";
 
+static constexpr std::string_view topic_property_write_caching
+  = "write.caching";
+
+static constexpr std::string_view topic_property_observer_replicas
+  = "redpanda.observer.replicas";
+
 // Kafka topic properties that is not relevant for Redpanda
 // Or cannot be altered with kafka alter handler
 static constexpr std::array<std::string_view, 20> allowlist_topic_noop_confs = {
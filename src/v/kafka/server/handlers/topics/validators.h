@@ -184,6 +184,31 @@ struct batch_max_bytes_limits {
     }
 };
 
+struct observer_replicas_limits {
+    static constexpr error_code ec = error_code::invalid_config;
+    static constexpr const char* error_message
+      = "Property redpanda.observer.replicas value must not be negative and "
+        "must be lower than the replication factor";
+
+    static bool is_valid(const creatable_topic& c) {
+        auto it = std::find_if(
+          c.configs.begin(),
+          c.configs.end(),
+          [](const createable_topic_config& cfg) {
+              return cfg.name == topic_property_observer_replicas;
+          });
+        if (it == c.configs.end() || !it->value.has_value()) {
+            return true;
+        }
+        auto observers = boost::lexical_cast<int16_t>(it->value.value());
+        if (observers < 0) {
+            return false;
+        }
+        // with custom assignments the leader keeps at least one voter
+        return !c.assignments.empty() || observers < c.replication_factor;
+    }
+};
+
 struct compression_type_validator_details {
     using validated_type = model::compression;
 
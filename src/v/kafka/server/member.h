@@ -107,6 +107,11 @@ public:
     /// Get the member's assignment.
     const bytes assignment() const { return iobuf_to_bytes(_state.assignment); }
 
+    /// Get the member's assignment sharing the underlying buffers.
+    iobuf share_assignment() {
+        return _state.assignment.share(0, _state.assignment.size_bytes());
+    }
+
     /// Set the member's assignment.
     void set_assignment(bytes assignment) {
         _state.assignment = bytes_to_iobuf(assignment);
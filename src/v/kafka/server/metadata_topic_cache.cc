@@ -0,0 +1,72 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/metadata_topic_cache.h"
+
+#include "cluster/metadata_cache.h"
+
+namespace kafka {
+
+namespace {
+metadata_response::topic copy_topic(const metadata_response::topic& t) {
+    return metadata_response::topic{
+      .error_code = t.error_code,
+      .name = t.name,
+      .is_internal = t.is_internal,
+      .partitions = t.partitions.copy(),
+      .topic_authorized_operations = t.topic_authorized_operations,
+    };
+}
+} // namespace
+
+metadata_topic_cache::metadata_topic_cache(cluster::metadata_cache& md_cache)
+  : _metadata_cache(md_cache)
+  , _topic_delta_notification(
+      _metadata_cache.register_topic_delta_notification(
+        [this](cluster::topic_table::delta_range_t deltas) {
+            for (const auto& d : deltas) {
+                invalidate(model::topic_namespace_view(d.ntp));
+            }
+        }))
+  , _leadership_notification(
+      _metadata_cache.register_leadership_change_notification(
+        [this](
+          model::ntp ntp, model::term_id, std::optional<model::node_id>) {
+            invalidate(model::topic_namespace_view(ntp));
+        })) {}
+
+metadata_topic_cache::~metadata_topic_cache() {
+    _metadata_cache.unregister_topic_delta_notification(
+      _topic_delta_notification);
+    _metadata_cache.unregister_leadership_change_notification(
+      _leadership_notification);
+}
+
+std::optional<metadata_response::topic>
+metadata_topic_cache::get(model::topic_namespace_view tp_ns) const {
+    auto it = _cache.find(tp_ns);
+    if (it == _cache.end()) {
+        return std::nullopt;
+    }
+    return copy_topic(it->second);
+}
+
+void metadata_topic_cache::put(
+  model::topic_namespace tp_ns, const metadata_response::topic& t) {
+    _cache.insert_or_assign(std::move(tp_ns), copy_topic(t));
+}
+
+void metadata_topic_cache::invalidate(model::topic_namespace_view tp_ns) {
+    if (auto it = _cache.find(tp_ns); it != _cache.end()) {
+        _cache.erase(it);
+    }
+}
+
+} // namespace kafka
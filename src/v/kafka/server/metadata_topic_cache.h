@@ -0,0 +1,72 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/fwd.h"
+#include "cluster/types.h"
+#include "kafka/protocol/metadata.h"
+#include "model/metadata.h"
+
+#include <absl/container/node_hash_map.h>
+
+#include <optional>
+
+namespace kafka {
+
+/**
+ * Per-shard cache of the topic level part of the metadata responses.
+ *
+ * Building the response of a topic requires the leader of each of its
+ * partitions to be looked up, which dominates the cost of the metadata
+ * requests listing all the topics of a large cluster. The responses are
+ * cached per topic and dropped when either the topic table applies a delta to
+ * the topic or the leadership of one of its partitions changes.
+ *
+ * The cached responses do not include the parts which depend on the
+ * requester, i.e. the topic authorized operations.
+ */
+class metadata_topic_cache {
+public:
+    explicit metadata_topic_cache(cluster::metadata_cache&);
+
+    metadata_topic_cache(const metadata_topic_cache&) = delete;
+    metadata_topic_cache(metadata_topic_cache&&) = delete;
+    metadata_topic_cache& operator=(const metadata_topic_cache&) = delete;
+    metadata_topic_cache& operator=(metadata_topic_cache&&) = delete;
+    ~metadata_topic_cache();
+
+    /// Returns a copy of the cached response of the topic.
+    std::optional<metadata_response::topic>
+      get(model::topic_namespace_view) const;
+
+    /// Caches a copy of the response of the topic.
+    void put(model::topic_namespace, const metadata_response::topic&);
+
+    /**
+     * @brief Return the number of topics currently cached.
+     */
+    size_t size() const { return _cache.size(); }
+
+private:
+    void invalidate(model::topic_namespace_view);
+
+    cluster::metadata_cache& _metadata_cache;
+    cluster::notification_id_type _topic_delta_notification;
+    cluster::notification_id_type _leadership_notification;
+    absl::node_hash_map<
+      model::topic_namespace,
+      metadata_response::topic,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _cache;
+};
+
+} // namespace kafka
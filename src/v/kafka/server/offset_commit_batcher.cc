@@ -0,0 +1,131 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/offset_commit_batcher.h"
+
+#include "cluster/partition.h"
+#include "kafka/server/logger.h"
+#include "raft/errc.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+namespace kafka {
+
+offset_commit_batcher::pending_batch::pending_batch(model::term_id t)
+  : term(t)
+  , builder(model::record_batch_type::raft_data, model::offset(0)) {}
+
+offset_commit_batcher::offset_commit_batcher(
+  ss::lw_shared_ptr<cluster::partition> partition,
+  config::binding<std::optional<std::chrono::milliseconds>> window)
+  : _partition(std::move(partition))
+  , _window(std::move(window)) {
+    _flush_timer.set_callback([this] { flush_pending(); });
+}
+
+ss::future<> offset_commit_batcher::stop() {
+    _flush_timer.cancel();
+    if (_pending) {
+        for (auto& waiter : _pending->waiters) {
+            waiter.set_value(raft::errc::shutting_down);
+        }
+        _pending.reset();
+    }
+    return _gate.close();
+}
+
+ss::future<result<raft::replicate_result>>
+offset_commit_batcher::replicate(model::term_id term, model::record_batch b) {
+    if (_gate.is_closed()) {
+        return ss::make_ready_future<result<raft::replicate_result>>(
+          raft::errc::shutting_down);
+    }
+    // a batch is replicated in a single term, commits from a newer term
+    // seal the batch of the previous one.
+    if (_pending && _pending->term != term) {
+        flush_pending();
+    }
+    if (!_pending) {
+        _pending.emplace(term);
+        _flush_timer.arm(_window().value_or(std::chrono::milliseconds(0)));
+    }
+
+    b.for_each_record([this](model::record r) {
+        std::optional<iobuf> value;
+        if (r.has_value()) {
+            value = r.release_value();
+        }
+        auto key = r.release_key();
+        _pending->size_bytes += key.size_bytes()
+                                + (value ? value->size_bytes() : 0);
+        _pending->builder.add_raw_kv(std::move(key), std::move(value));
+    });
+    auto f = _pending->waiters.emplace_back().get_future();
+
+    if (_pending->size_bytes >= max_batch_bytes) {
+        flush_pending();
+    }
+    return f;
+}
+
+void offset_commit_batcher::flush_pending() {
+    _flush_timer.cancel();
+    if (!_pending) {
+        return;
+    }
+    auto pending = std::move(*_pending);
+    _pending.reset();
+    ssx::spawn_with_gate(
+      _gate, [this, pending = std::move(pending)]() mutable {
+          return dispatch(std::move(pending));
+      });
+}
+
+ss::future<> offset_commit_batcher::dispatch(pending_batch pending) {
+    auto waiters = std::move(pending.waiters);
+    vlog(
+      klog.trace,
+      "replicating {} coalesced offset commits ({} bytes) to {}",
+      waiters.size(),
+      pending.size_bytes,
+      _partition->ntp());
+
+    auto reader = model::make_memory_record_batch_reader(
+      std::move(pending.builder).build());
+    std::exception_ptr error;
+    std::optional<result<raft::replicate_result>> res;
+    try {
+        auto units = co_await _dispatch_lock.get_units();
+        auto stages = _partition->raft()->replicate_in_stages(
+          pending.term,
+          std::move(reader),
+          raft::replicate_options(raft::consistency_level::quorum_ack));
+        try {
+            co_await std::move(stages.request_enqueued);
+        } catch (...) {
+            // the failure is reported by the replicate_finished stage
+        }
+        units.return_all();
+        res = co_await std::move(stages.replicate_finished);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    for (auto& waiter : waiters) {
+        if (error) {
+            waiter.set_exception(error);
+        } else {
+            waiter.set_value(*res);
+        }
+    }
+}
+
+} // namespace kafka
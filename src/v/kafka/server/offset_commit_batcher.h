@@ -0,0 +1,84 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/fwd.h"
+#include "config/property.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "outcome.h"
+#include "raft/types.h"
+#include "seastarx.h"
+#include "storage/record_batch_builder.h"
+#include "utils/mutex.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Coalesces the offset commits of the consumer groups managed by a single
+ * __consumer_offsets partition.
+ *
+ * The records of every commit submitted within the coalescing window are
+ * appended to a single batch which is replicated once the window elapses (or
+ * the batch grows past its size limit). All the commits of a batch complete
+ * together when the batch is replicated. Batches are enqueued in raft in the
+ * order they are sealed, so the commits of a group are never reordered.
+ *
+ * The window is controlled by the group_offset_commit_coalesce_ms property,
+ * commits are replicated by the groups directly when it is not set.
+ */
+class offset_commit_batcher {
+public:
+    static constexpr size_t max_batch_bytes = 512 * 1024;
+
+    offset_commit_batcher(
+      ss::lw_shared_ptr<cluster::partition>,
+      config::binding<std::optional<std::chrono::milliseconds>> window);
+
+    ss::future<> stop();
+
+    bool is_enabled() const { return _window().has_value(); }
+
+    /// Replicate the records of the batch in the given term as a part of the
+    /// batch of commits currently being coalesced.
+    ss::future<result<raft::replicate_result>>
+    replicate(model::term_id, model::record_batch);
+
+private:
+    struct pending_batch {
+        explicit pending_batch(model::term_id);
+
+        model::term_id term;
+        storage::record_batch_builder builder;
+        size_t size_bytes{0};
+        std::vector<ss::promise<result<raft::replicate_result>>> waiters;
+    };
+
+    void flush_pending();
+    ss::future<> dispatch(pending_batch);
+
+    ss::lw_shared_ptr<cluster::partition> _partition;
+    config::binding<std::optional<std::chrono::milliseconds>> _window;
+    std::optional<pending_batch> _pending;
+    ss::timer<> _flush_timer;
+    // held until a batch is enqueued in raft to preserve the commit order
+    mutex _dispatch_lock{"k/offset-commit-batcher"};
+    ss::gate _gate;
+};
+
+} // namespace kafka
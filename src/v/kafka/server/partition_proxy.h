@@ -44,6 +44,8 @@ public:
           get_leader_epoch_last_offset(kafka::leader_epoch) const = 0;
 
         virtual bool is_leader() const = 0;
+        virtual bool is_observer() const = 0;
+        virtual bool has_observers() const = 0;
         virtual ss::future<std::error_code> linearizable_barrier() = 0;
         virtual ss::future<error_code>
           prefix_truncate(model::offset, ss::lowres_clock::time_point) = 0;
@@ -104,6 +106,13 @@ public:
 
     bool is_leader() const { return _impl->is_leader(); }
 
+    /// True if the local replica is an observer, which serves the fetches of
+    /// the consumers the leader redirects to it
+    bool is_observer() const { return _impl->is_observer(); }
+
+    /// True if the partition has observers
+    bool has_observers() const { return _impl->has_observers(); }
+
     const model::ntp& ntp() const { return _impl->ntp(); }
 
     ss::future<std::vector<cluster::rm_stm::tx_range>> aborted_transactions(
@@ -15,6 +15,7 @@
 
 #include <seastar/core/temporary_buffer.hh>
 
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
@@ -101,6 +102,9 @@ ss::scattered_message<char> response_as_scattered(response_ptr response) {
      *   - int32_t: size (correlation + response size)
      *   - int32_t: correlation
      *   - std::vector<vint, optional<iobuf>>: tagged fields
+     *
+     * The header is encoded into a single buffer owned by the message, the
+     * fragments of the response body are referenced in place.
      */
     iobuf tags_header;
     if (response->is_flexible()) {
@@ -108,32 +112,35 @@ ss::scattered_message<char> response_as_scattered(response_ptr response) {
         vassert(response->tags(), "If flexible, tags should be filled");
         writer.write_tags(std::move(*response->tags()));
     }
+    auto& buf = response->buf();
+    const auto correlation = response->correlation()();
     const auto size = static_cast<int32_t>(
-      sizeof(response->correlation()) + tags_header.size_bytes()
-      + response->buf().size_bytes());
-    iobuf header;
-    protocol::encoder writer(header);
-    writer.write(size);
-    writer.write(response->correlation());
-    header.append(std::move(tags_header));
+      sizeof(correlation) + tags_header.size_bytes() + buf.size_bytes());
+
+    ss::temporary_buffer<char> header(
+      sizeof(size) + sizeof(correlation) + tags_header.size_bytes());
+    auto out = protocol::detail::write_be(header.get_write(), size);
+    out = protocol::detail::write_be(out, correlation);
+    for (const auto& frag : tags_header) {
+        out = std::copy_n(frag.get(), frag.size(), out);
+    }
 
-    auto& buf = response->buf();
-    buf.prepend(std::move(header));
     ss::scattered_message<char> msg;
-    auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
-    int32_t chunk_no = 0;
-    in.consume(
-      buf.size_bytes(), [&msg, &chunk_no, &buf](const char* src, size_t sz) {
-          ++chunk_no;
-          vassert(
-            chunk_no <= std::numeric_limits<int16_t>::max(),
-            "Invalid construction of scattered_message. max count:{}. Usually "
-            "a bug with small append() to iobuf. {}",
-            chunk_no,
-            buf);
-          msg.append_static(src, sz);
-          return ss::stop_iteration::no;
-      });
+    msg.append(std::move(header));
+    int32_t chunk_no = 1;
+    for (const auto& frag : buf) {
+        if (frag.is_empty()) {
+            continue;
+        }
+        ++chunk_no;
+        vassert(
+          chunk_no <= std::numeric_limits<int16_t>::max(),
+          "Invalid construction of scattered_message. max count:{}. Usually "
+          "a bug with small append() to iobuf. {}",
+          chunk_no,
+          buf);
+        msg.append_static(frag.get(), frag.size());
+    }
     // MUST be the foreign ptr not the iobuf
     msg.on_delete([response = std::move(response)] {});
     return msg;
@@ -64,33 +64,33 @@ quota_manager::maybe_add_and_retrieve_quota(
     // shares a default quota. the anonymous group is keyed on empty string.
     auto qid = quota_id ? *quota_id : "";
 
-    // find or create the throughput tracker for this client
-    //
-    // c++20: heterogeneous lookup for unordered_map can avoid creation of
-    // an sstring here but std::unordered_map::find isn't using an
-    // equal_to<> overload. this is a general issue we'll be looking at. for
-    // now, these client-name strings are small. This will be solved in
-    // c++20 via Hash::transparent_key_equal.
-    auto [it, inserted] = _client_quotas.try_emplace(
-      ss::sstring(qid),
-      client_quota{
-        now,
-        clock::duration(0),
-        {static_cast<size_t>(_default_num_windows()), _default_window_width()},
-        {static_cast<size_t>(_default_num_windows()), _default_window_width()},
-        /// pm_rate is only non-nullopt on the qm home shard
-        (ss::this_shard_id() == quota_manager_shard)
-          ? std::optional<token_bucket_rate_tracker>(
-            {*_target_partition_mutation_quota(),
-             static_cast<uint32_t>(_default_num_windows()),
-             _default_window_width()})
-          : std::optional<token_bucket_rate_tracker>()});
-
-    // bump to prevent gc
-    if (!inserted) {
+    // find or create the throughput tracker for this client. the tracker is
+    // only built for new clients as it allocates its windows.
+    auto it = _client_quotas.find(qid);
+    if (it != _client_quotas.end()) {
+        // bump to prevent gc
         it->second.last_seen = now;
+        return it;
     }
 
+    it = _client_quotas
+           .emplace(
+             ss::sstring(qid),
+             client_quota{
+               now,
+               clock::duration(0),
+               {static_cast<size_t>(_default_num_windows()),
+                _default_window_width()},
+               {static_cast<size_t>(_default_num_windows()),
+                _default_window_width()},
+               /// pm_rate is only non-nullopt on the qm home shard
+               (ss::this_shard_id() == quota_manager_shard)
+                 ? std::optional<token_bucket_rate_tracker>(
+                   {*_target_partition_mutation_quota(),
+                    static_cast<uint32_t>(_default_num_windows()),
+                    _default_window_width()})
+                 : std::optional<token_bucket_rate_tracker>()})
+           .first;
     return it;
 }
 
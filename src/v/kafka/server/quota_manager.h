@@ -23,6 +23,7 @@
 #include <seastar/core/timer.hh>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
 
 #include <chrono>
 #include <optional>
@@ -130,7 +131,27 @@ private:
         rate_tracker tp_fetch_rate;
         std::optional<token_bucket_rate_tracker> pm_rate;
     };
-    using client_quotas_t = absl::flat_hash_map<ss::sstring, client_quota>;
+
+    // client quotas are looked up on every produce and fetch request, the
+    // lookup must not allocate
+    struct client_id_hash {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view v) const {
+            return absl::Hash<std::string_view>{}(v);
+        }
+    };
+
+    struct client_id_eq {
+        using is_transparent = void;
+
+        bool operator()(std::string_view lhs, std::string_view rhs) const {
+            return lhs == rhs;
+        }
+    };
+
+    using client_quotas_t = absl::
+      flat_hash_map<ss::sstring, client_quota, client_id_hash, client_id_eq>;
 
 private:
     // erase inactive tracked quotas. windows are considered inactive if they
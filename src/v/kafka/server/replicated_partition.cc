@@ -12,6 +12,7 @@
 
 #include "cloud_storage/types.h"
 #include "cluster/errc.h"
+#include "config/configuration.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/server/errors.h"
 #include "kafka/server/logger.h"
@@ -471,6 +472,26 @@ ss::future<error_code> replicated_partition::validate_fetch_offset(
 
     // offset validation logic on follower
     if (reading_from_follower && !_partition->is_leader()) {
+        /**
+         * The follower only knows the leader high watermark it was told
+         * about. A follower which didn't hear from the leader for longer than
+         * the lease may be partitioned away and serving stale data, make the
+         * consumer go back to the leader.
+         */
+        const auto lease
+          = config::shard_local_cfg().kafka_follower_fetch_lease_ms();
+        const auto last_leader_contact = _partition->raft()->last_heartbeat();
+        if (
+          lease.has_value()
+          && last_leader_contact + *lease < raft::clock_type::now()) {
+            vlog(
+              klog.debug,
+              "ntp {}: follower fetch lease of {}ms expired",
+              ntp(),
+              lease->count());
+            co_return error_code::not_leader_for_partition;
+        }
+
         auto ec = error_code::none;
         if (fetch_offset < start_offset()) {
             ec = error_code::offset_out_of_range;
@@ -554,6 +575,7 @@ result<partition_info> replicated_partition::get_partition_info() const {
           .log_end_offset = model::next_offset(
             clamped_translate(follower_metric.dirty_log_index)),
           .is_alive = follower_metric.is_live,
+          .is_observer = follower_metric.is_observer,
         });
     }
 
@@ -138,6 +138,12 @@ public:
 
     bool is_leader() const final { return _partition->is_leader(); }
 
+    bool is_observer() const final { return _partition->raft()->is_observer(); }
+
+    bool has_observers() const final {
+        return _partition->raft()->has_observers();
+    }
+
     ss::future<error_code>
       prefix_truncate(model::offset, ss::lowres_clock::time_point) final;
 
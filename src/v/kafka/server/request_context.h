@@ -194,6 +194,10 @@ public:
         return _conn->server().get_fetch_metadata_cache();
     }
 
+    metadata_topic_cache& get_metadata_topic_cache() {
+        return _conn->server().get_metadata_topic_cache();
+    }
+
     template<typename ResponseType>
     requires requires(
       ResponseType r, protocol::encoder& writer, api_version version) {
@@ -15,6 +15,7 @@
 #include "config/configuration.h"
 #include "config/node_config.h"
 #include "features/feature_table.h"
+#include "kafka/protocol/produce.h"
 #include "kafka/protocol/schemata/list_groups_response.h"
 #include "kafka/server/connection_context.h"
 #include "kafka/server/coordinator_ntp_mapper.h"
@@ -48,6 +49,7 @@
 #include "kafka/server/response.h"
 #include "kafka/server/usage_manager.h"
 #include "net/connection.h"
+#include "resource_mgmt/io_priority.h"
 #include "security/acl.h"
 #include "security/audit/schemas/iam.h"
 #include "security/audit/schemas/utils.h"
@@ -108,6 +110,7 @@ server::server(
   ss::sharded<net::server_configuration>* cfg,
   ss::smp_service_group smp,
   ss::scheduling_group fetch_sg,
+  std::vector<ss::scheduling_group> tenant_sgs,
   ss::sharded<cluster::metadata_cache>& meta,
   ss::sharded<cluster::topics_frontend>& tf,
   ss::sharded<cluster::config_frontend>& cf,
@@ -132,6 +135,10 @@ server::server(
   : net::server(cfg, klog)
   , _smp_group(smp)
   , _fetch_scheduling_group(fetch_sg)
+  , _tenant_isolation(
+      config::shard_local_cfg().kafka_tenant_groups.bind(),
+      std::move(tenant_sgs),
+      priority_manager::local().kafka_tenant_read_priorities())
   , _topics_frontend(tf)
   , _config_frontend(cf)
   , _feature_table(ft)
@@ -157,6 +164,14 @@ server::server(
   , _security_frontend(sec_fe)
   , _controller_api(controller_api)
   , _tx_gateway_frontend(tx_gateway_frontend)
+  , _admission_controller(
+      config::shard_local_cfg()
+        .kafka_admission_control_target_latency_ms.bind(),
+      config::shard_local_cfg().kafka_admission_control_max_delay_ms.bind(),
+      config::shard_local_cfg()
+        .kafka_admission_control_api_keys.bind<std::vector<bool>>(
+          &convert_api_names_to_key_bitmap))
+  , _metadata_topic_cache(_metadata_cache.local())
   , _mtls_principal_mapper(
       config::shard_local_cfg().kafka_mtls_principal_mapping_rules.bind())
   , _gssapi_principal_mapper(
@@ -201,6 +216,23 @@ void server::setup_metrics() {
           [this] { return _memory_fetch_sem.current(); },
           sm::description(ssx::sformat(
             "{}: Memory available for fetch request processing", cfg.name))),
+        sm::make_gauge(
+          "admission_produce_latency_us",
+          [this] {
+              return std::chrono::duration_cast<std::chrono::microseconds>(
+                       _admission_controller.latency(produce_api::key))
+                .count();
+          },
+          sm::description(ssx::sformat(
+            "{}: Moving average of the end-to-end produce latency used by the "
+            "admission control",
+            cfg.name))),
+        sm::make_counter(
+          "admission_throttled_requests",
+          [this] { return _admission_controller.throttled(); },
+          sm::description(ssx::sformat(
+            "{}: Number of requests delayed by the admission control",
+            cfg.name))),
       });
 }
 
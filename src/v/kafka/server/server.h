@@ -17,13 +17,18 @@
 #include "kafka/latency_probe.h"
 #include "kafka/protocol/types.h"
 #include "kafka/sasl_probe.h"
+#include "kafka/server/admission_controller.h"
 #include "kafka/server/connection_context.h"
 #include "kafka/server/fetch_metadata_cache.hh"
 #include "kafka/server/fetch_session_cache.h"
 #include "kafka/server/fwd.h"
+#include "kafka/server/handlers/fetch/data_waiters.h"
+#include "kafka/server/handlers/fetch/read_coalescer.h"
 #include "kafka/server/handlers/fetch/replica_selector.h"
 #include "kafka/server/handlers/handler_probe.h"
+#include "kafka/server/metadata_topic_cache.h"
 #include "kafka/server/queue_depth_monitor.h"
+#include "kafka/server/tenant_isolation.h"
 #include "metrics/metrics.h"
 #include "net/server.h"
 #include "pandaproxy/schema_registry/fwd.h"
@@ -33,6 +38,7 @@
 #include "security/krb5_configurator.h"
 #include "security/mtls.h"
 #include "ssx/fwd.h"
+#include "storage/backlog_coordinator.h"
 #include "utils/ema.h"
 
 #include <seastar/core/future.hh>
@@ -50,6 +56,7 @@ public:
       ss::sharded<net::server_configuration>*,
       ss::smp_service_group,
       ss::scheduling_group,
+      std::vector<ss::scheduling_group>,
       ss::sharded<cluster::metadata_cache>&,
       ss::sharded<cluster::topics_frontend>&,
       ss::sharded<cluster::config_frontend>&,
@@ -94,6 +101,9 @@ public:
      */
     ss::scheduling_group fetch_scheduling_group() const;
 
+    /// The kafka tenants which produce and fetch in groups of their own.
+    const tenant_isolation& tenants() const { return _tenant_isolation; }
+
     cluster::topics_frontend& topics_frontend() {
         return _topics_frontend.local();
     }
@@ -148,8 +158,11 @@ public:
         if (_qdc_mon) {
             _qdc_mon->ema.update(x);
         }
+        storage::backlog_coordinator::local().record_foreground_latency(x);
     }
 
+    admission_controller& admission() { return _admission_controller; }
+
     ss::future<ssx::semaphore_units> get_request_unit() {
         if (_qdc_mon) {
             return _qdc_mon->qdc.get_unit();
@@ -166,6 +179,10 @@ public:
         return _fetch_metadata_cache;
     }
 
+    kafka::metadata_topic_cache& get_metadata_topic_cache() {
+        return _metadata_topic_cache;
+    }
+
     security::gssapi_principal_mapper& gssapi_principal_mapper() {
         return _gssapi_principal_mapper;
     }
@@ -199,6 +216,12 @@ public:
 
     ssx::semaphore& memory_fetch_sem() noexcept { return _memory_fetch_sem; }
 
+    fetch_read_coalescer& read_coalescer() noexcept {
+        return _fetch_read_coalescer;
+    }
+
+    fetch_data_waiters& fetch_waiters() noexcept { return _fetch_data_waiters; }
+
     ss::future<> revoke_credentials(std::string_view name);
 
 private:
@@ -206,6 +229,7 @@ private:
 
     ss::smp_service_group _smp_group;
     ss::scheduling_group _fetch_scheduling_group;
+    tenant_isolation _tenant_isolation;
     ss::sharded<cluster::topics_frontend>& _topics_frontend;
     ss::sharded<cluster::config_frontend>& _config_frontend;
     ss::sharded<features::feature_table>& _feature_table;
@@ -229,11 +253,15 @@ private:
     ss::sharded<cluster::controller_api>& _controller_api;
     ss::sharded<cluster::tx_gateway_frontend>& _tx_gateway_frontend;
     std::optional<qdc_monitor> _qdc_mon;
+    admission_controller _admission_controller;
     kafka::fetch_metadata_cache _fetch_metadata_cache;
+    kafka::metadata_topic_cache _metadata_topic_cache;
     security::tls::principal_mapper _mtls_principal_mapper;
     security::gssapi_principal_mapper _gssapi_principal_mapper;
     security::krb5::configurator _krb_configurator;
     ssx::semaphore _memory_fetch_sem;
+    kafka::fetch_read_coalescer _fetch_read_coalescer;
+    kafka::fetch_data_waiters _fetch_data_waiters;
 
     handler_probe_manager _handler_probes;
     metrics::internal_metric_groups _metrics;
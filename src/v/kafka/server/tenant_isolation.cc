@@ -0,0 +1,62 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/tenant_isolation.h"
+
+#include "kafka/server/logger.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+namespace kafka {
+
+tenant_isolation::tenant_isolation(
+  config::binding<std::vector<ss::sstring>> groups,
+  std::vector<ss::scheduling_group> sgs,
+  std::vector<ss::io_priority_class> io_priorities)
+  : _config(std::move(groups))
+  , _sgs(std::move(sgs))
+  , _io_priorities(std::move(io_priorities)) {
+    _config.watch([this] { update(); });
+    update();
+}
+
+void tenant_isolation::update() {
+    _groups.clear();
+    // the config is validated, but a group without a scheduling group
+    // (e.g. in tests) is ignored rather than crashing
+    auto slots = std::min(_sgs.size(), _io_priorities.size());
+    for (const auto& entry : _config()) {
+        auto cfg = config::tenant_group::parse(entry);
+        if (!cfg || _groups.size() >= slots) {
+            vlog(klog.warn, "Ignoring kafka tenant group {}", entry);
+            continue;
+        }
+        auto slot = _groups.size();
+        _groups.push_back(group{
+          .cfg = std::move(*cfg),
+          .assigned = {.sg = _sgs[slot], .io_priority = _io_priorities[slot]}});
+
+        auto shares = _groups.back().cfg.shares;
+        vlog(klog.info, "Kafka tenant {} in slot {}", entry, slot);
+        _sgs[slot].set_shares(static_cast<float>(shares));
+        auto f = _io_priorities[slot].update_shares(shares);
+        ssx::background = std::move(f).handle_exception(
+          [entry](const std::exception_ptr& e) {
+              vlog(
+                klog.warn,
+                "Unable to set the I/O shares of kafka tenant {}: {}",
+                entry,
+                e);
+          });
+    }
+}
+
+} // namespace kafka
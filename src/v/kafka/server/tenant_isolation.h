@@ -0,0 +1,94 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "config/tenant_group.h"
+#include "security/acl.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/io_priority_class.hh>
+#include <seastar/core/scheduling.hh>
+
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Assigns the produce and fetch requests of the kafka tenants configured
+ * in kafka_tenant_groups to the scheduling group and I/O priority class of
+ * their tenant, so that a tenant's heavy load (e.g. a backfill) only eats
+ * into its own shares.
+ *
+ * There is one instance per shard: the shares of the groups are per shard
+ * too, and every instance sets them on its own shard.
+ */
+class tenant_isolation {
+public:
+    struct tenant {
+        ss::scheduling_group sg;
+        ss::io_priority_class io_priority;
+    };
+
+    tenant_isolation(
+      config::binding<std::vector<ss::sstring>> groups,
+      std::vector<ss::scheduling_group> sgs,
+      std::vector<ss::io_priority_class> io_priorities);
+
+    /**
+     * The tenant of the requests of \p principal for \p topics, the first
+     * configured tenant matching the principal or one of the topics.
+     */
+    template<typename Topics>
+    std::optional<tenant> find(
+      const security::acl_principal& principal, const Topics& topics) const {
+        for (const auto& g : _groups) {
+            if (matches(g.cfg, principal, topics)) {
+                return g.assigned;
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    struct group {
+        config::tenant_group cfg;
+        tenant assigned;
+    };
+
+    template<typename Topics>
+    static bool matches(
+      const config::tenant_group& g,
+      const security::acl_principal& principal,
+      const Topics& topics) {
+        if (g.type == config::tenant_group::match_type::principal) {
+            return principal.name() == g.match;
+        }
+        return std::any_of(
+          topics.begin(), topics.end(), [&g](const auto& t) {
+              return std::string_view(t.name()).starts_with(g.match);
+          });
+    }
+
+    void update();
+
+    config::binding<std::vector<ss::sstring>> _config;
+    std::vector<ss::scheduling_group> _sgs;
+    std::vector<ss::io_priority_class> _io_priorities;
+    std::vector<group> _groups;
+};
+
+} // namespace kafka
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "config/mock_property.h"
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/server/admission_controller.h"
+#include "kafka/server/server.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace std::chrono_literals;
+
+SEASTAR_THREAD_TEST_CASE(throttle_low_priority_on_produce_latency) {
+    config::mock_property<std::optional<std::chrono::milliseconds>> target(
+      std::nullopt);
+    config::mock_property<std::chrono::milliseconds> max_delay(1000ms);
+    config::mock_property<std::vector<ss::sstring>> api_keys({"fetch"});
+    kafka::admission_controller ac(
+      target.bind(),
+      max_delay.bind(),
+      api_keys.bind<std::vector<bool>>(
+        &kafka::server::convert_api_names_to_key_bitmap));
+
+    // disabled
+    ac.record(kafka::produce_api::key, 100ms);
+    BOOST_REQUIRE(ac.delay(kafka::fetch_api::key) == 0ms);
+
+    // below the target
+    target.update(200ms);
+    BOOST_REQUIRE(ac.delay(kafka::fetch_api::key) == 0ms);
+
+    // 1.5x the target, half the max delay for the low priority APIs only
+    for (int i = 0; i < 1000; ++i) {
+        ac.record(kafka::produce_api::key, 300ms);
+    }
+    auto delay = ac.delay(kafka::fetch_api::key);
+    BOOST_REQUIRE_GT(delay, 490ms);
+    BOOST_REQUIRE_LT(delay, 510ms);
+    BOOST_REQUIRE(ac.delay(kafka::produce_api::key) == 0ms);
+    BOOST_REQUIRE(ac.delay(kafka::metadata_api::key) == 0ms);
+    BOOST_REQUIRE_EQUAL(ac.throttled(), 1);
+
+    // capped at the max delay
+    for (int i = 0; i < 1000; ++i) {
+        ac.record(kafka::produce_api::key, 2s);
+    }
+    BOOST_REQUIRE(ac.delay(kafka::fetch_api::key) == 1000ms);
+}
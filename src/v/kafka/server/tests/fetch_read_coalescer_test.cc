@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/handlers/fetch/read_coalescer.h"
+#include "units.h"
+
+#include <seastar/core/future-util.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace std::chrono_literals;
+
+namespace {
+kafka::fetch_read_key make_key(int partition, int64_t offset) {
+    return kafka::fetch_read_key{
+      .ktp = model::ktp(model::topic("tapioca"), model::partition_id(partition)),
+      .start_offset = model::offset(offset),
+      .max_offset = model::offset::max(),
+      .max_bytes = 1_MiB,
+    };
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(coalesce_concurrent_reads) {
+    kafka::fetch_read_coalescer coalescer;
+    ss::promise<kafka::fetch_read_coalescer::read_ptr> p;
+    size_t reads = 0;
+
+    auto read_fn = [&reads, &p] {
+        ++reads;
+        return p.get_future();
+    };
+
+    auto f1 = coalescer.read(make_key(0, 10), read_fn);
+    auto f2 = coalescer.read(make_key(0, 10), read_fn);
+    // different offset and partition are not coalesced
+    auto f3 = coalescer.read(make_key(0, 11), [] {
+        return ss::make_ready_future<kafka::fetch_read_coalescer::read_ptr>(
+          ss::make_lw_shared<kafka::fetch_partition_read>());
+    });
+    BOOST_REQUIRE_EQUAL(reads, 1);
+    BOOST_REQUIRE_EQUAL(coalescer.inflight_reads(), 1);
+    BOOST_REQUIRE_EQUAL(coalescer.coalesced_reads(), 1);
+
+    auto read = ss::make_lw_shared<kafka::fetch_partition_read>();
+    read->record_count = 3;
+    p.set_value(read);
+
+    auto r1 = f1.get();
+    auto r2 = f2.get();
+    f3.get();
+    BOOST_REQUIRE_EQUAL(r1.get(), r2.get());
+    BOOST_REQUIRE_EQUAL(r1->record_count, 3);
+    BOOST_REQUIRE_EQUAL(coalescer.inflight_reads(), 0);
+
+    // once complete, the next read is performed again
+    ss::promise<kafka::fetch_read_coalescer::read_ptr> p2;
+    auto f4 = coalescer.read(make_key(0, 10), [&reads, &p2] {
+        ++reads;
+        return p2.get_future();
+    });
+    BOOST_REQUIRE_EQUAL(reads, 2);
+    p2.set_value(ss::make_lw_shared<kafka::fetch_partition_read>());
+    f4.get();
+}
+
+SEASTAR_THREAD_TEST_CASE(coalesce_read_exception) {
+    kafka::fetch_read_coalescer coalescer;
+    ss::promise<kafka::fetch_read_coalescer::read_ptr> p;
+
+    auto f1 = coalescer.read(make_key(1, 0), [&p] { return p.get_future(); });
+    auto f2 = coalescer.read(make_key(1, 0), [&p] { return p.get_future(); });
+    p.set_exception(std::runtime_error("read failed"));
+
+    BOOST_REQUIRE_THROW(f1.get(), std::runtime_error);
+    BOOST_REQUIRE_THROW(f2.get(), std::runtime_error);
+    BOOST_REQUIRE_EQUAL(coalescer.inflight_reads(), 0);
+}
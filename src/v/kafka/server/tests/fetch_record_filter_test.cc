@@ -0,0 +1,135 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "config/fetch_record_filter.h"
+#include "kafka/server/handlers/fetch/record_filter.h"
+#include "model/compression.h"
+#include "storage/parser_utils.h"
+#include "storage/record_batch_builder.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+iobuf to_iobuf(std::string_view s) {
+    iobuf buf;
+    buf.append(s.data(), s.size());
+    return buf;
+}
+
+model::record_header make_header(std::string_view k, std::string_view v) {
+    auto key = to_iobuf(k);
+    auto value = to_iobuf(v);
+    return {
+      static_cast<int32_t>(key.size_bytes()),
+      std::move(key),
+      static_cast<int32_t>(value.size_bytes()),
+      std::move(value)};
+}
+
+/// Ten records, keyed "even-<i>" or "odd-<i>" with a header "type" of the
+/// same parity
+model::record_batch make_batch(model::compression c) {
+    storage::record_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(100));
+    builder.set_compression(c);
+    for (int i = 0; i < 10; ++i) {
+        std::string_view parity = i % 2 == 0 ? "even" : "odd";
+        std::vector<model::record_header> headers;
+        headers.push_back(make_header("type", parity));
+        builder.add_raw_kw(
+          to_iobuf(fmt::format("{}-{}", parity, i)),
+          to_iobuf("value"),
+          std::move(headers));
+    }
+    return std::move(builder).build();
+}
+
+std::vector<int32_t> offset_deltas(const model::record_batch& b) {
+    std::vector<int32_t> deltas;
+    auto batch = storage::internal::decompress_batch_sync(b.copy());
+    batch.for_each_record([&deltas](const model::record& r) {
+        deltas.push_back(r.offset_delta());
+    });
+    return deltas;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(fetch_record_filter_validation) {
+    config::fetch_record_filter f{
+      .name = "f", .clients_prefix = "client-", .header_key = "type"};
+    BOOST_REQUIRE(f.validate().empty());
+
+    auto no_criteria = f;
+    no_criteria.header_key = std::nullopt;
+    BOOST_REQUIRE(!no_criteria.validate().empty());
+
+    auto value_only = no_criteria;
+    value_only.header_value = "even";
+    BOOST_REQUIRE(!value_only.validate().empty());
+
+    BOOST_REQUIRE(config::validate_fetch_record_filters({f, f}).has_value());
+    BOOST_REQUIRE(!config::validate_fetch_record_filters({f}).has_value());
+
+    std::vector<config::fetch_record_filter> filters{f};
+    BOOST_REQUIRE(
+      config::find_fetch_record_filter(filters, "client-1") == &filters[0]);
+    BOOST_REQUIRE(
+      config::find_fetch_record_filter(filters, "other") == nullptr);
+    BOOST_REQUIRE(
+      config::find_fetch_record_filter(filters, std::nullopt) == nullptr);
+}
+
+SEASTAR_THREAD_TEST_CASE(filter_batch_by_header) {
+    config::fetch_record_filter f{
+      .name = "f",
+      .clients_prefix = "client-",
+      .header_key = "type",
+      .header_value = "even"};
+    for (auto c : {model::compression::none, model::compression::zstd}) {
+        auto batch = make_batch(c);
+        auto filtered = kafka::filter_batch(f, batch.copy()).get();
+        BOOST_REQUIRE_EQUAL(filtered.base_offset(), batch.base_offset());
+        BOOST_REQUIRE_EQUAL(filtered.last_offset(), batch.last_offset());
+        BOOST_REQUIRE_EQUAL(filtered.record_count(), 5);
+        BOOST_REQUIRE_EQUAL(filtered.header().attrs.compression(), c);
+        BOOST_REQUIRE(
+          offset_deltas(filtered) == std::vector<int32_t>({0, 2, 4, 6, 8}));
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(filter_batch_by_key_prefix) {
+    config::fetch_record_filter f{
+      .name = "f", .clients_prefix = "client-", .key_prefix = "odd-"};
+    auto filtered
+      = kafka::filter_batch(f, make_batch(model::compression::none)).get();
+    BOOST_REQUIRE(
+      offset_deltas(filtered) == std::vector<int32_t>({1, 3, 5, 7, 9}));
+
+    // every record matches, the batch is returned as it is
+    f.key_prefix = "";
+    auto batch = make_batch(model::compression::lz4);
+    auto unchanged = kafka::filter_batch(f, batch.copy()).get();
+    BOOST_REQUIRE_EQUAL(unchanged.header(), batch.header());
+}
+
+SEASTAR_THREAD_TEST_CASE(filter_batch_without_match) {
+    config::fetch_record_filter f{
+      .name = "f", .clients_prefix = "client-", .header_key = "missing"};
+    auto batch = make_batch(model::compression::snappy);
+    auto filtered = kafka::filter_batch(f, batch.copy()).get();
+    // kept, so that the consumer moves past the records of the batch
+    BOOST_REQUIRE_EQUAL(filtered.record_count(), 0);
+    BOOST_REQUIRE_EQUAL(filtered.last_offset(), batch.last_offset());
+    BOOST_REQUIRE(filtered.data().empty());
+}
@@ -225,3 +225,60 @@ FIXTURE_TEST(test_session_operations, fixture) {
         BOOST_REQUIRE(cache.size() == 0);
     }
 }
+
+FIXTURE_TEST(test_fetch_session_mem_usage, fixture) {
+    kafka::fetch_session session(kafka::fetch_session_id(123));
+    const auto empty_mem_usage = session.mem_usage();
+
+    model::topic short_name("short");
+    model::topic long_name(random_generators::gen_alphanum_string(128));
+    session.partitions().emplace(
+      make_fetch_partition(short_name, model::partition_id(0), {}));
+    const auto short_mem_usage = session.mem_usage();
+    session.partitions().erase({short_name, model::partition_id(0)});
+    session.partitions().emplace(
+      make_fetch_partition(long_name, model::partition_id(0), {}));
+
+    // heap allocated topic names are accounted for
+    BOOST_REQUIRE_GE(session.mem_usage(), short_mem_usage + long_name().size());
+
+    session.partitions().erase({long_name, model::partition_id(0)});
+    BOOST_REQUIRE_GE(session.mem_usage(), empty_mem_usage);
+    BOOST_REQUIRE_LT(session.mem_usage(), short_mem_usage);
+}
+
+FIXTURE_TEST(test_session_eviction_when_cache_is_full, fixture) {
+    kafka::fetch_session_cache cache(120s);
+    auto make_full_fetch = [](int partitions) {
+        kafka::fetch_request req;
+        req.data.session_epoch = kafka::initial_fetch_session_epoch;
+        req.data.session_id = kafka::invalid_fetch_session_id;
+        req.data.topics = {
+          make_fetch_request_topic(model::topic("test"), partitions)};
+        return req;
+    };
+
+    BOOST_TEST_MESSAGE("fill the cache up to its memory limit");
+    auto req = make_full_fetch(1000);
+    size_t created = 0;
+    while (!cache.maybe_get_session(req).is_sessionless()) {
+        ++created;
+        BOOST_REQUIRE_LT(created, 10000);
+    }
+    BOOST_REQUIRE_EQUAL(cache.size(), created);
+
+    BOOST_TEST_MESSAGE("bigger session evicts the smaller ones");
+    auto big_req = make_full_fetch(2000);
+    {
+        auto ctx = cache.maybe_get_session(big_req);
+        BOOST_REQUIRE(!ctx.is_sessionless());
+        BOOST_REQUIRE_EQUAL(ctx.session()->partitions().size(), 2000);
+    }
+    BOOST_REQUIRE_LT(cache.size(), created + 1);
+
+    BOOST_TEST_MESSAGE("smaller session does not evict bigger ones");
+    auto size_before = cache.size();
+    auto small_req = make_full_fetch(500);
+    BOOST_REQUIRE(cache.maybe_get_session(small_req).is_sessionless());
+    BOOST_REQUIRE_EQUAL(cache.size(), size_before);
+}
@@ -507,6 +507,75 @@ FIXTURE_TEST(fetch_one_debounce, redpanda_thread_fixture) {
     BOOST_REQUIRE(resp.data.topics[0].partitions[0].records->size_bytes() > 0);
 }
 
+FIXTURE_TEST(fetch_long_poll_wakes_up_on_new_data, redpanda_thread_fixture) {
+    model::topic topic("foo");
+    model::partition_id pid(0);
+    auto ntp = make_default_ntp(topic, pid);
+
+    wait_for_controller_leadership().get0();
+
+    add_topic(model::topic_namespace_view(ntp)).get();
+    wait_for_partition_offset(ntp, model::offset(0)).get0();
+
+    kafka::fetch_request req;
+    req.data.max_bytes = std::numeric_limits<int32_t>::max();
+    req.data.min_bytes = 1;
+    req.data.max_wait_ms = std::chrono::milliseconds(60000);
+    req.data.session_id = kafka::invalid_fetch_session_id;
+    req.data.topics = {{
+      .name = topic,
+      .fetch_partitions = {{
+        .partition_index = pid,
+        .fetch_offset = model::offset(0),
+      }},
+    }};
+
+    auto client = make_kafka_client().get0();
+    client.connect().get();
+    auto start = model::timeout_clock::now();
+    auto fresp = client.dispatch(req, kafka::api_version(4));
+
+    auto waiting_fetches = [this] {
+        return app._kafka_server.map_reduce0(
+          [](kafka::server& s) { return s.fetch_waiters().size(); },
+          size_t(0),
+          std::plus<>());
+    };
+    // the fetch parks until the data arrives
+    tests::cooperative_spin_wait_with_timeout(10s, [&waiting_fetches] {
+        return waiting_fetches().then([](size_t n) { return n > 0; });
+    }).get();
+
+    auto shard = app.shard_table.local().shard_for(ntp);
+    app.partition_manager
+      .invoke_on(
+        *shard,
+        [ntp](cluster::partition_manager& mgr) {
+            auto partition = mgr.get(ntp);
+            auto batches = model::test::make_random_batches(
+              model::offset(0), 5);
+            auto rdr = model::make_memory_record_batch_reader(
+              std::move(batches));
+            return partition->raft()->replicate(
+              std::move(rdr),
+              raft::replicate_options(raft::consistency_level::quorum_ack));
+        })
+      .discard_result()
+      .get0();
+
+    auto resp = fresp.get0();
+    client.stop().then([&client] { client.shutdown(); }).get();
+
+    BOOST_REQUIRE_LT(model::timeout_clock::now() - start, 30s);
+    BOOST_REQUIRE(resp.data.topics.size() == 1);
+    BOOST_REQUIRE(resp.data.topics[0].partitions.size() == 1);
+    BOOST_REQUIRE(
+      resp.data.topics[0].partitions[0].error_code == kafka::error_code::none);
+    BOOST_REQUIRE(resp.data.topics[0].partitions[0].records);
+    BOOST_REQUIRE(resp.data.topics[0].partitions[0].records->size_bytes() > 0);
+    BOOST_REQUIRE_EQUAL(waiting_fetches().get0(), 0);
+}
+
 FIXTURE_TEST(fetch_multi_topics, redpanda_thread_fixture) {
     // create a topic partition with some data
     model::topic topic_1("foo");
@@ -0,0 +1,89 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/tx_gateway_frontend.h"
+#include "config/configuration.h"
+#include "features/feature_table.h"
+#include "kafka/server/group.h"
+#include "kafka/server/group_metadata.h"
+#include "kafka/server/member.h"
+
+#include <seastar/core/sharded.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+#include <seastar/testing/perf_tests.hh>
+
+/**
+ * Simulates the coordinator side of a join/sync round of a large group: the
+ * protocol selection, the collection of the member metadata for the leader
+ * and the distribution of the assignments computed by the leader.
+ */
+ss::future<> run_test(size_t num_members, size_t rounds) {
+    static config::configuration conf;
+    ss::sharded<cluster::tx_gateway_frontend> tx_frontend;
+    ss::sharded<features::feature_table> feature_table;
+    auto g = ss::make_lw_shared<kafka::group>(
+      kafka::group_id("g"),
+      kafka::group_state::empty,
+      conf,
+      nullptr,
+      nullptr,
+      model::term_id(),
+      tx_frontend,
+      feature_table,
+      kafka::make_consumer_offsets_serializer(),
+      kafka::enable_group_metrics::no);
+
+    const bytes metadata(bytes::initialized_later{}, 256);
+    const bytes assignment(bytes::initialized_later{}, 1024);
+    const std::vector<kafka::member_protocol> protocols = {
+      {kafka::protocol_name("range"), metadata},
+      {kafka::protocol_name("cooperative-sticky"), metadata}};
+
+    for (size_t i = 0; i < num_members; ++i) {
+        g->add_member_no_join(ss::make_lw_shared<kafka::group_member>(
+          kafka::member_id(fmt::format("member-{}", i)),
+          kafka::group_id("g"),
+          std::nullopt,
+          kafka::client_id("client-id"),
+          kafka::client_host("client-host"),
+          std::chrono::seconds(10),
+          std::chrono::seconds(30),
+          kafka::protocol_type("bench"),
+          protocols));
+    }
+
+    size_t total = 0;
+    perf_tests::start_measuring_time();
+    for (size_t r = 0; r < rounds; ++r) {
+        g->set_state(kafka::group_state::preparing_rebalance);
+        g->advance_generation();
+
+        auto members = g->member_metadata();
+        kafka::assignments_type assignments;
+        assignments.reserve(members.size());
+        for (auto& m : members) {
+            total += m.metadata.size();
+            assignments.emplace(std::move(m.member_id), assignment);
+        }
+        g->add_missing_assignments(assignments);
+        g->set_assignments(std::move(assignments));
+        g->set_state(kafka::group_state::stable);
+        co_await ss::coroutine::maybe_yield();
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(total);
+}
+
+struct group_bench {};
+PERF_TEST_C(group_bench, join_sync_1k_members) {
+    co_return co_await run_test(1'000, 10);
+}
+PERF_TEST_C(group_bench, join_sync_5k_members) {
+    co_return co_await run_test(5'000, 10);
+}
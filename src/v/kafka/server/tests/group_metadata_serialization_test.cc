@@ -10,6 +10,7 @@
 #include "bytes/bytes.h"
 #include "kafka/protocol/wire.h"
 #include "kafka/server/group_metadata.h"
+#include "kafka/server/group_recovery_checkpoint.h"
 #include "kafka/server/server.h"
 #include "kafka/types.h"
 #include "model/adl_serde.h"
@@ -19,6 +20,7 @@
 #include "model/timestamp.h"
 #include "random/generators.h"
 #include "reflection/adl.h"
+#include "serde/serde.h"
 #include "storage/record_batch_builder.h"
 #include "test_utils/fixture.h"
 
@@ -263,3 +265,90 @@ FIXTURE_TEST(test_unwrapping_tombstones_from_iobuf, fixture) {
         BOOST_REQUIRE_EQUAL(offset_key, iobuf_offset_md_kv.key);
     }
 }
+
+FIXTURE_TEST(test_group_recovery_checkpoint_roundtrip, fixture) {
+    kafka::group_recovery_consumer_state state;
+    state.has_offset_retention_feature_fence = true;
+
+    auto& stm = state.groups[kafka::group_id("g-0")];
+    kafka::group_metadata_value md;
+    md.protocol_type = kafka::protocol_type("consumer");
+    md.generation = kafka::generation_id(7);
+    md.protocol = kafka::protocol_name("range");
+    md.leader = kafka::member_id("m-0");
+    md.state_timestamp = model::timestamp(1000);
+    kafka::member_state member;
+    member.id = kafka::member_id("m-0");
+    member.client_id = kafka::client_id("c-0");
+    member.client_host = kafka::client_host("h-0");
+    member.rebalance_timeout = std::chrono::milliseconds(100);
+    member.session_timeout = std::chrono::milliseconds(200);
+    member.subscription = bytes_to_iobuf(random_generators::get_bytes(16));
+    member.assignment = bytes_to_iobuf(random_generators::get_bytes(16));
+    md.members.push_back(std::move(member));
+    auto expected_md = md.copy();
+    stm.overwrite_metadata(std::move(md));
+
+    model::topic_partition tp(model::topic("t"), model::partition_id(1));
+    stm.update_offset(
+      tp,
+      model::offset(10),
+      kafka::offset_metadata_value{
+        .offset = model::offset(100),
+        .leader_epoch = kafka::leader_epoch(2),
+        .metadata = "meta",
+        .commit_timestamp = model::timestamp(2000),
+        .non_reclaimable = false,
+      });
+
+    model::producer_identity pid(5, 1);
+    stm.try_set_fence(
+      pid.get_id(),
+      pid.get_epoch(),
+      model::tx_seq(3),
+      std::chrono::milliseconds(500),
+      model::partition_id(0));
+    stm.update_prepared(
+      model::offset(11),
+      kafka::group_log_prepared_tx{
+        .group_id = kafka::group_id("g-0"),
+        .pid = pid,
+        .tx_seq = model::tx_seq(3),
+        .offsets = {{
+          .tp = tp, .offset = model::offset(101), .leader_epoch = 2}},
+      });
+
+    // a removed group only retains its flags
+    state.groups[kafka::group_id("g-1")].remove();
+
+    auto buf = serde::to_iobuf(
+      kafka::group_recovery_checkpoint::from_state(state));
+    auto decoded = serde::from_iobuf<kafka::group_recovery_checkpoint>(
+                     std::move(buf))
+                     .to_state();
+
+    BOOST_REQUIRE(decoded.has_offset_retention_feature_fence);
+    BOOST_REQUIRE_EQUAL(decoded.groups.size(), 2);
+    BOOST_REQUIRE(decoded.groups[kafka::group_id("g-1")].is_removed());
+
+    auto& restored = decoded.groups[kafka::group_id("g-0")];
+    BOOST_REQUIRE(restored.has_data());
+    BOOST_REQUIRE_EQUAL(restored.get_metadata(), expected_md);
+
+    BOOST_REQUIRE_EQUAL(restored.offsets().size(), 1);
+    const auto& offset = restored.offsets().at(tp);
+    BOOST_REQUIRE_EQUAL(offset.log_offset, model::offset(10));
+    BOOST_REQUIRE_EQUAL(offset.metadata, stm.offsets().at(tp).metadata);
+
+    BOOST_REQUIRE(restored.fences() == stm.fences());
+    BOOST_REQUIRE_EQUAL(restored.tx_data().size(), 1);
+    BOOST_REQUIRE_EQUAL(restored.tx_data().at(pid).tx_seq, model::tx_seq(3));
+    BOOST_REQUIRE(restored.timeouts().at(pid) == stm.timeouts().at(pid));
+
+    BOOST_REQUIRE_EQUAL(restored.prepared_txs().size(), 1);
+    const auto& prepared = restored.prepared_txs().at(pid.get_id());
+    BOOST_REQUIRE_EQUAL(prepared.pid, pid);
+    const auto& prepared_offset = prepared.offsets.at(tp);
+    BOOST_REQUIRE_EQUAL(prepared_offset.offset, model::offset(101));
+    BOOST_REQUIRE_EQUAL(prepared_offset.log_offset, model::offset(11));
+}
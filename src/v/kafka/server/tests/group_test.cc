@@ -9,6 +9,7 @@
 
 #include "config/configuration.h"
 #include "kafka/server/group.h"
+#include "kafka/server/group_index.h"
 #include "kafka/server/group_metadata.h"
 #include "utils/to_string.h"
 
@@ -489,4 +490,45 @@ SEASTAR_THREAD_TEST_CASE(group_state_output) {
     BOOST_TEST(s == "PreparingRebalance");
 }
 
+SEASTAR_THREAD_TEST_CASE(group_index_follows_group) {
+    auto g = get();
+    group_index index;
+    g.set_summary_listener([&index](const group& g) {
+        index.upsert(g.id(), group_index::make_entry(g));
+    });
+
+    (void)g.add_member(get_group_member());
+    auto* e = index.find(g.id());
+    BOOST_REQUIRE(e != nullptr);
+    BOOST_TEST(e->members == 1);
+    BOOST_TEST(e->protocol == kafka::protocol_type("p"));
+
+    g.set_state(group_state::preparing_rebalance);
+    BOOST_TEST(index.find(g.id())->state == group_state::preparing_rebalance);
+}
+
+SEASTAR_THREAD_TEST_CASE(group_index_moved_group) {
+    group_index index;
+    auto id = kafka::group_id("g");
+    index.upsert(id, {.protocol = kafka::protocol_type("p"), .shard = 1});
+    // the old shard of the group removes it after the new one added it
+    index.upsert(id, {.protocol = kafka::protocol_type("p"), .shard = 2});
+    index.remove(id, 1);
+    BOOST_REQUIRE(index.find(id) != nullptr);
+    BOOST_TEST(index.find(id)->shard == 2);
+    index.remove(id, 2);
+    BOOST_TEST(index.size() == 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(group_index_loading) {
+    group_index index;
+    index.upsert(kafka::group_id("g"), {.protocol = kafka::protocol_type("p")});
+    index.set_loading(1, true);
+    auto [error, groups] = index.list_groups();
+    BOOST_TEST(error == error_code::coordinator_load_in_progress);
+    BOOST_TEST(groups.size() == 1);
+    index.set_loading(1, false);
+    BOOST_TEST(index.list_groups().first == error_code::none);
+}
+
 } // namespace kafka
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/tests/produce_consume_utils.h"
+#include "model/fundamental.h"
+#include "model/namespace.h"
+#include "random/generators.h"
+#include "redpanda/tests/fixture.h"
+#include "utils/hdr_hist.h"
+
+#include <seastar/core/loop.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/lexical_cast.hpp>
+#include <fmt/core.h>
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+/*
+ * In-process end to end produce and fetch throughput of a single node, going
+ * through the kafka protocol. The perf_tests output reports records per
+ * second, and the request latency percentiles are printed as a JSON line per
+ * test when the fixture is torn down.
+ *
+ * The topology is configured with environment variables:
+ *  - RP_BENCH_PARTITIONS: partitions of the topic (default 16)
+ *  - RP_BENCH_CLIENTS: concurrent kafka connections (default 4)
+ *  - RP_BENCH_RECORD_SIZE: bytes per record value (default 1024)
+ *  - RP_BENCH_RECORDS_PER_BATCH: records per partition batch (default 10)
+ */
+namespace {
+
+size_t env_or(const char* name, size_t def) {
+    const char* v = std::getenv(name);
+    if (v == nullptr) {
+        return def;
+    }
+    return boost::lexical_cast<size_t>(v);
+}
+
+struct bench_config {
+    size_t partitions = env_or("RP_BENCH_PARTITIONS", 16);
+    size_t clients = env_or("RP_BENCH_CLIENTS", 4);
+    size_t record_size = env_or("RP_BENCH_RECORD_SIZE", 1024);
+    size_t records_per_batch = env_or("RP_BENCH_RECORDS_PER_BATCH", 10);
+};
+
+} // namespace
+
+struct produce_consume_bench_fixture : redpanda_thread_fixture {
+    static constexpr size_t prefill_batches = 100;
+
+    bench_config cfg;
+    model::topic topic{"bench"};
+    std::vector<model::partition_id> pids;
+    std::vector<tests::kv_t> batch;
+    // per request latency in microseconds
+    hdr_hist latency;
+    ss::sstring bench_name;
+    // connections are opened by the first iteration of a test, outside of
+    // the measured section, and live as long as the fixture
+    std::vector<std::unique_ptr<tests::kafka_produce_transport>> producers;
+    std::vector<std::unique_ptr<tests::kafka_consume_transport>> consumers;
+
+    produce_consume_bench_fixture() {
+        wait_for_controller_leadership().get();
+        add_topic(
+          model::topic_namespace_view(model::kafka_namespace, topic),
+          static_cast<int>(cfg.partitions))
+          .get();
+        for (size_t i = 0; i < cfg.partitions; ++i) {
+            auto pid = model::partition_id(static_cast<int32_t>(i));
+            wait_for_leader(model::ntp(model::kafka_namespace, topic, pid))
+              .get();
+            pids.push_back(pid);
+        }
+
+        batch.reserve(cfg.records_per_batch);
+        for (size_t i = 0; i < cfg.records_per_batch; ++i) {
+            batch.emplace_back(
+              ssx::sformat("key{}", i),
+              random_generators::gen_alphanum_string(cfg.record_size));
+        }
+    }
+
+    produce_consume_bench_fixture(const produce_consume_bench_fixture&)
+      = delete;
+    produce_consume_bench_fixture&
+    operator=(const produce_consume_bench_fixture&)
+      = delete;
+    produce_consume_bench_fixture(produce_consume_bench_fixture&&) = delete;
+    produce_consume_bench_fixture& operator=(produce_consume_bench_fixture&&)
+      = delete;
+
+    ~produce_consume_bench_fixture() {
+        if (bench_name.empty()) {
+            return;
+        }
+        fmt::print(
+          "{{\"bench\": \"{}\", \"partitions\": {}, \"clients\": {}, "
+          "\"record_size\": {}, \"records_per_batch\": {}, "
+          "\"p50_us\": {}, \"p99_us\": {}, \"p999_us\": {}, "
+          "\"mean_us\": {}}}\n",
+          bench_name,
+          cfg.partitions,
+          cfg.clients,
+          cfg.record_size,
+          cfg.records_per_batch,
+          latency.get_value_at(50.0),
+          latency.get_value_at(99.0),
+          latency.get_value_at(99.9),
+          latency.mean());
+    }
+
+    tests::pid_to_kvs_map_t make_request() const {
+        tests::pid_to_kvs_map_t records;
+        for (auto pid : pids) {
+            records.emplace(pid, batch);
+        }
+        return records;
+    }
+
+    template<typename Transport>
+    std::vector<std::unique_ptr<Transport>> make_clients() {
+        std::vector<std::unique_ptr<Transport>> clients;
+        for (size_t i = 0; i < cfg.clients; ++i) {
+            auto& c = clients.emplace_back(
+              std::make_unique<Transport>(make_kafka_client().get()));
+            c->start().get();
+        }
+        return clients;
+    }
+
+    /// Runs f once per client concurrently, measuring every call
+    template<typename Transport, typename F>
+    ss::future<>
+    run_clients(std::vector<std::unique_ptr<Transport>>& clients, F f) {
+        return ss::parallel_for_each(
+          clients, [this, &f](std::unique_ptr<Transport>& c) {
+              auto m = latency.auto_measure();
+              return f(*c).finally([m = std::move(m)] {});
+          });
+    }
+};
+
+PERF_TEST_F(produce_consume_bench_fixture, produce_throughput) {
+    bench_name = "produce";
+    if (producers.empty()) {
+        producers = make_clients<tests::kafka_produce_transport>();
+    }
+
+    perf_tests::start_measuring_time();
+    run_clients(producers, [this](tests::kafka_produce_transport& c) {
+        return c.produce(topic, make_request()).discard_result();
+    }).get();
+    perf_tests::stop_measuring_time();
+
+    return cfg.clients * cfg.partitions * cfg.records_per_batch;
+}
+
+PERF_TEST_F(produce_consume_bench_fixture, fetch_throughput) {
+    bench_name = "fetch";
+    if (consumers.empty()) {
+        auto producer = make_clients<tests::kafka_produce_transport>();
+        for (size_t i = 0; i < prefill_batches; ++i) {
+            producer.front()->produce(topic, make_request()).get();
+        }
+        consumers = make_clients<tests::kafka_consume_transport>();
+    }
+
+    size_t records = 0;
+    perf_tests::start_measuring_time();
+    run_clients(consumers, [this, &records](tests::kafka_consume_transport& c) {
+        return c.consume(topic, pids, model::offset(0))
+          .then([&records](tests::pid_to_kvs_map_t fetched) {
+              for (const auto& [_, kvs] : fetched) {
+                  records += kvs.size();
+              }
+          });
+    }).get();
+    perf_tests::stop_measuring_time();
+
+    return records;
+}
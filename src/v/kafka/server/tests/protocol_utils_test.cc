@@ -0,0 +1,72 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "kafka/server/protocol_utils.h"
+#include "kafka/server/response.h"
+#include "random/generators.h"
+
+#include <seastar/net/packet.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+kafka::response_ptr make_response(kafka::flex_enabled flex) {
+    auto resp = std::make_unique<kafka::response>(flex);
+    resp->set_correlation(kafka::correlation_id{42});
+    // a body made of many fragments
+    for (int i = 0; i < 100; ++i) {
+        auto str = random_generators::gen_alphanum_string(1000);
+        iobuf frag;
+        frag.append(str.data(), str.size());
+        resp->buf().append_fragments(std::move(frag));
+    }
+    return ss::make_foreign(std::move(resp));
+}
+
+iobuf packet_to_iobuf(ss::scattered_message<char> msg) {
+    auto p = std::move(msg).release();
+    iobuf ret;
+    for (const auto& f : p.fragments()) {
+        ret.append(f.base, f.size);
+    }
+    return ret;
+}
+
+void check_framing(kafka::flex_enabled flex) {
+    auto resp = make_response(flex);
+    auto body = resp->buf().copy();
+
+    iobuf_parser parser(
+      packet_to_iobuf(kafka::response_as_scattered(std::move(resp))));
+    const size_t tags_size = flex ? 1 : 0;
+    BOOST_REQUIRE_EQUAL(
+      parser.consume_be_type<int32_t>(),
+      static_cast<int32_t>(sizeof(int32_t) + tags_size + body.size_bytes()));
+    BOOST_REQUIRE_EQUAL(parser.consume_be_type<int32_t>(), 42);
+    if (flex) {
+        // empty tagged fields
+        BOOST_REQUIRE_EQUAL(parser.consume_type<int8_t>(), 0);
+    }
+    BOOST_REQUIRE_EQUAL(parser.bytes_left(), body.size_bytes());
+    BOOST_REQUIRE_EQUAL(parser.share(parser.bytes_left()), body);
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(response_as_scattered_framing) {
+    check_framing(kafka::flex_enabled::no);
+}
+
+SEASTAR_THREAD_TEST_CASE(response_as_scattered_flexible_framing) {
+    check_framing(kafka::flex_enabled::yes);
+}
@@ -0,0 +1,57 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/quota_manager.h"
+
+#include <seastar/coroutine/maybe_yield.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <fmt/format.h>
+
+#include <vector>
+
+/**
+ * Records the throughput of produce and fetch requests issued by many
+ * distinct client ids against the quota manager of a single shard.
+ */
+ss::future<> run_test(size_t num_clients, size_t requests_per_client) {
+    kafka::quota_manager qm;
+    std::vector<ss::sstring> client_ids;
+    client_ids.reserve(num_clients);
+    for (size_t i = 0; i < num_clients; ++i) {
+        client_ids.push_back(fmt::format("producer-client-{}", i));
+    }
+
+    int64_t total = 0;
+    perf_tests::start_measuring_time();
+    for (size_t r = 0; r < requests_per_client; ++r) {
+        for (size_t i = 0; i < num_clients; ++i) {
+            auto now = kafka::quota_manager::clock::now();
+            std::optional<std::string_view> client_id = client_ids[i];
+            auto d = qm.record_produce_tp_and_throttle(client_id, 1024, now);
+            qm.record_fetch_tp(client_id, 1024, now);
+            total += d.duration.count()
+                     + qm.throttle_fetch_tp(client_id, now).duration.count();
+            if (i % 1000 == 0) {
+                co_await ss::coroutine::maybe_yield();
+            }
+        }
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(total);
+    co_await qm.stop();
+}
+
+struct quota_manager_bench {};
+PERF_TEST_C(quota_manager_bench, throttle_1k_clients) {
+    co_return co_await run_test(1'000, 100);
+}
+PERF_TEST_C(quota_manager_bench, throttle_100k_clients) {
+    co_return co_await run_test(100'000, 1);
+}
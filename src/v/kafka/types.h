@@ -132,6 +132,7 @@ struct replica_info {
     model::offset high_watermark;
     model::offset log_end_offset;
     bool is_alive;
+    bool is_observer{false};
 };
 
 struct partition_info {
@@ -35,6 +35,20 @@ record_batch_iterator::create(const model::record_batch& b) {
     return {b.record_count(), iobuf_const_parser(b._records)};
 }
 
+void record_batch::verify_records() const {
+    verify_iterable();
+    iobuf_const_parser parser(_records);
+    for (int32_t i = 0; i < record_count(); ++i) {
+        model::skip_one_record_from_buffer(parser);
+    }
+    // same as the check done by the iterator after the last record
+    if (record_count() > 0 && parser.bytes_left()) [[unlikely]] {
+        throw std::out_of_range(fmt::format(
+          "Record iteration stopped with {} bytes remaining",
+          parser.bytes_left()));
+    }
+}
+
 record_batch_iterator::record_batch_iterator(int32_t rc, iobuf_const_parser p)
   : _record_count(rc)
   , _parser(std::move(p)) {}
@@ -792,6 +792,15 @@ public:
         }
     }
 
+    /**
+     * Check that the records can be materialized without materializing them.
+     * Keys, values and headers are skipped over rather than copied, which
+     * makes this much cheaper than iterating with `for_each_record(..)` when
+     * only validation is needed. Throws std::out_of_range on malformed
+     * records.
+     */
+    void verify_records() const;
+
     /**
      * Materialize records.
      *
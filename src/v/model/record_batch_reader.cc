@@ -281,17 +281,24 @@ ss::future<record_batch_reader::data_t> consume_reader_to_memory(
   record_batch_reader reader, timeout_clock::time_point timeout) {
     class memory_batch_consumer {
     public:
-        ss::future<ss::stop_iteration> operator()(model::record_batch b) {
-            _result.push_back(std::move(b));
-            return ss::make_ready_future<ss::stop_iteration>(
-              ss::stop_iteration::no);
+        ss::stop_iteration operator()(data_t batches) {
+            if (_result.empty()) {
+                // the common single slice case, no copy of the buffer
+                _result = std::move(batches);
+            } else {
+                _result.reserve(_result.size() + batches.size());
+                for (auto& b : batches) {
+                    _result.push_back(std::move(b));
+                }
+            }
+            return ss::stop_iteration::no;
         }
         data_t end_of_stream() { return std::move(_result); }
 
     private:
         data_t _result;
     };
-    return std::move(reader).consume(memory_batch_consumer{}, timeout);
+    return std::move(reader).consume_bulk(memory_batch_consumer{}, timeout);
 }
 
 ss::future<fragmented_vector<model::record_batch>>
@@ -299,10 +306,11 @@ consume_reader_to_fragmented_memory(
   record_batch_reader reader, timeout_clock::time_point timeout) {
     class fragmented_memory_batch_consumer {
     public:
-        ss::future<ss::stop_iteration> operator()(model::record_batch b) {
-            _result.push_back(std::move(b));
-            return ss::make_ready_future<ss::stop_iteration>(
-              ss::stop_iteration::no);
+        ss::stop_iteration operator()(data_t batches) {
+            for (auto& b : batches) {
+                _result.push_back(std::move(b));
+            }
+            return ss::stop_iteration::no;
         }
         fragmented_vector<model::record_batch> end_of_stream() {
             return std::move(_result);
@@ -311,7 +319,7 @@ consume_reader_to_fragmented_memory(
     private:
         fragmented_vector<model::record_batch> _result;
     };
-    return std::move(reader).consume(
+    return std::move(reader).consume_bulk(
       fragmented_memory_batch_consumer{}, timeout);
 }
 
@@ -27,6 +27,7 @@
 #include <seastar/util/variant_utils.hh>
 
 #include <memory>
+#include <utility>
 #include <variant>
 
 namespace model {
@@ -44,6 +45,15 @@ concept ReferenceBatchReaderConsumer = requires(
     c.end_of_stream();
 };
 
+/// A consumer taking all the batches of a loaded slice in one synchronous
+/// call, see record_batch_reader::consume_bulk
+template<typename BulkConsumer>
+concept BulkBatchReaderConsumer = requires(
+  BulkConsumer c, ss::circular_buffer<record_batch>&& batches) {
+    { c(std::move(batches)) } -> std::same_as<ss::stop_iteration>;
+    c.end_of_stream();
+};
+
 class record_batch_reader final {
 public:
     using data_t = ss::circular_buffer<model::record_batch>;
@@ -98,6 +108,14 @@ public:
                   return do_consume(consumer, timeout);
               });
         }
+        template<typename BulkConsumer>
+        auto
+        consume_bulk(BulkConsumer consumer, timeout_clock::time_point timeout) {
+            return ss::do_with(
+              std::move(consumer), [this, timeout](BulkConsumer& consumer) {
+                  return do_consume_bulk(consumer, timeout);
+              });
+        }
 
     private:
         record_batch pop_batch() {
@@ -114,6 +132,20 @@ public:
                   return (*d.buffer)[d.index++].copy();
               });
         }
+        data_t take_slice() {
+            return ss::visit(
+              _slice,
+              [](data_t& d) { return std::exchange(d, {}); },
+              [](foreign_data_t& d) {
+                  // same as pop_batch, batches of a remote core are copied
+                  data_t batches;
+                  batches.reserve(d.buffer->size() - d.index);
+                  for (; d.index < d.buffer->size(); ++d.index) {
+                      batches.push_back((*d.buffer)[d.index].copy());
+                  }
+                  return batches;
+              });
+        }
         ss::future<> load_slice(timeout_clock::time_point timeout) {
             return do_load_slice(timeout).then([this](storage_t s) {
                 // reassign the local cache
@@ -142,6 +174,14 @@ public:
                 return c(pop_batch());
             });
         }
+        template<typename BulkConsumer>
+        auto do_consume_bulk(
+          BulkConsumer& consumer, timeout_clock::time_point timeout) {
+            return do_action(consumer, timeout, [this](BulkConsumer& c) {
+                return ss::make_ready_future<ss::stop_iteration>(
+                  c(take_slice()));
+            });
+        }
         template<typename ConsumerType, typename ActionFn>
         auto do_action(
           ConsumerType& consumer,
@@ -249,6 +289,33 @@ public:
           });
     }
 
+    /// \brief Bulk version of consume(): the consumer is handed all the
+    /// batches of a slice at once, in a single synchronous call, instead of
+    /// one future per batch. When the slices are already in memory (memory
+    /// readers, batch cache hits) the whole read completes without a single
+    /// continuation being scheduled.
+    ///
+    /// The batches handed over are consumed even if the consumer returns
+    /// stop_iteration::yes, the next call starts from the next slice.
+    template<typename BulkConsumer>
+    requires BulkBatchReaderConsumer<BulkConsumer>
+    auto consume_bulk(
+      BulkConsumer consumer, timeout_clock::time_point timeout) & {
+        return _impl->consume_bulk(std::move(consumer), timeout);
+    }
+
+    /// r-value version of consume_bulk(), see consume()
+    template<typename BulkConsumer>
+    requires BulkBatchReaderConsumer<BulkConsumer>
+    auto consume_bulk(
+      BulkConsumer consumer, timeout_clock::time_point timeout) && {
+        auto raw = _impl.get();
+        return raw->consume_bulk(std::move(consumer), timeout)
+          .finally([raw, i = std::move(_impl)]() mutable {
+              return raw->finally().finally([i = std::move(i)] {});
+          });
+    }
+
     std::unique_ptr<impl> release() && { return std::move(_impl); }
 
 private:
@@ -18,15 +18,9 @@
 
 namespace model {
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_le(crc::crc32c& crc, T i) {
-    auto j = ss::cpu_to_le(i);
-    crc.extend(j);
-}
-
 template<typename... T>
 void crc_extend_all_cpu_to_le(crc::crc32c& crc, T... t) {
-    ((crc_extend_cpu_to_le(crc, t)), ...);
+    crc.extend_all(ss::cpu_to_le(t)...);
 }
 
 /// \brief uint32_t because that's what crc32c uses
@@ -54,15 +48,9 @@ uint32_t internal_header_only_crc(const record_batch_header& header) {
     return c.value();
 }
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_be(crc::crc32c& crc, T i) {
-    auto j = ss::cpu_to_be(i);
-    crc.extend(j);
-}
-
 template<typename... T>
 void crc_extend_all_cpu_to_be(crc::crc32c& crc, T... t) {
-    ((crc_extend_cpu_to_be(crc, t)), ...);
+    crc.extend_all(ss::cpu_to_be(t)...);
 }
 
 void crc_record_batch_header(
@@ -175,6 +163,25 @@ model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser) {
       });
 }
 
+void skip_one_record_from_buffer(iobuf_const_parser& parser) {
+    auto skip_field = [&parser] {
+        auto [length, _] = parser.read_varlong();
+        if (length > 0) {
+            parser.skip(length);
+        }
+    };
+    parse_record_meta_from_buffer(parser);
+    parser.read_varlong(); // timestamp delta
+    parser.read_varlong(); // offset delta
+    skip_field();          // key
+    skip_field();          // value
+    auto [header_count, _] = parser.read_varlong();
+    for (int i = 0; i < header_count; ++i) {
+        skip_field(); // header key
+        skip_field(); // header value
+    }
+}
+
 static inline void append_vint_to_iobuf(iobuf& b, int64_t v) {
     auto vb = vint::to_bytes(v);
     b.append(vb.data(), vb.size());
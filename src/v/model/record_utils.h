@@ -32,6 +32,9 @@ uint32_t internal_header_only_crc(const record_batch_header&);
 
 model::record parse_one_record_from_buffer(iobuf_parser& parser);
 model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser);
+/// \brief parses one record like parse_one_record_copy_from_buffer, but skips
+/// over the key, value and headers instead of copying them
+void skip_one_record_from_buffer(iobuf_const_parser& parser);
 void append_record_to_buffer(iobuf& a, const model::record& r);
 
 } // namespace model
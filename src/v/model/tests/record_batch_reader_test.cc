@@ -10,6 +10,7 @@
 #include "model/record.h"
 #include "model/record_batch_reader.h"
 #include "model/tests/random_batch.h"
+#include "utils/fragmented_vector.h"
 
 #include <seastar/core/thread.hh>
 #include <seastar/testing/thread_test_case.hh>
@@ -170,3 +171,70 @@ SEASTAR_THREAD_TEST_CASE(record_batch_sharing) {
         BOOST_CHECK(v1[i] == v2[i]);
     }
 }
+
+class bulk_consumer {
+public:
+    explicit bulk_consumer(size_t max_calls)
+      : _max_calls(max_calls) {}
+
+    ss::stop_iteration operator()(ss::circular_buffer<record_batch> batches) {
+        for (auto& b : batches) {
+            _result.push_back(std::move(b));
+        }
+        return ss::stop_iteration(++_calls == _max_calls);
+    }
+
+    std::pair<size_t, ss::circular_buffer<record_batch>> end_of_stream() {
+        return {_calls, std::move(_result)};
+    }
+
+private:
+    ss::circular_buffer<record_batch> _result;
+    size_t _calls{0};
+    size_t _max_calls;
+};
+
+SEASTAR_THREAD_TEST_CASE(test_consume_bulk) {
+    auto reader = make_memory_record_batch_reader(
+      make_batches(offset(1), offset(2), offset(3), offset(4)));
+    auto [calls, batches] = reader.consume_bulk(bulk_consumer(10), no_timeout)
+                              .get0();
+    // a single slice is delivered in a single call
+    BOOST_CHECK_EQUAL(calls, 1);
+    BOOST_REQUIRE_EQUAL(batches.size(), 4);
+    auto o = offset(1);
+    for (auto& batch : batches) {
+        BOOST_CHECK_EQUAL(batch.base_offset(), o);
+        o += 1;
+    }
+    BOOST_CHECK(reader.is_end_of_stream());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_interrupt_consume_bulk_multiple_slices) {
+    fragmented_vector<record_batch> data;
+    const auto per_slice
+      = fragmented_vector<record_batch>::elements_per_fragment();
+    const auto total = 3 * per_slice;
+    for (size_t i = 0; i < total; ++i) {
+        data.push_back(model::test::make_random_batch(
+          offset(static_cast<int64_t>(i)), 1, false));
+    }
+    auto reader = make_foreign_fragmented_memory_record_batch_reader(
+      std::move(data));
+
+    auto [calls, batches] = reader.consume_bulk(bulk_consumer(1), no_timeout)
+                              .get0();
+    BOOST_CHECK_EQUAL(calls, 1);
+    BOOST_CHECK_EQUAL(batches.size(), per_slice);
+    auto remaining = consume_reader_to_memory(std::move(reader), no_timeout)
+                       .get0();
+    BOOST_REQUIRE_EQUAL(batches.size() + remaining.size(), total);
+    for (auto& b : remaining) {
+        batches.push_back(std::move(b));
+    }
+    auto o = offset(0);
+    for (auto& batch : batches) {
+        BOOST_CHECK_EQUAL(batch.base_offset(), o);
+        o += 1;
+    }
+}
@@ -106,3 +106,24 @@ SEASTAR_THREAD_TEST_CASE(extra_bytes_iterator) {
     BOOST_TEST(it.has_next());
     BOOST_REQUIRE_THROW(it.next(), std::out_of_range);
 }
+
+SEASTAR_THREAD_TEST_CASE(verify_records) {
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+    BOOST_REQUIRE_NO_THROW(b.verify_records());
+
+    // extra bytes at the end of the batch
+    auto buf = b.data().copy();
+    constexpr std::string_view extra_data = "foobar";
+    buf.append(extra_data.data(), extra_data.size());
+    auto header = b.header();
+    auto extra = model::record_batch(
+      header, std::move(buf), model::record_batch::tag_ctor_ng{});
+    BOOST_REQUIRE_THROW(extra.verify_records(), std::out_of_range);
+
+    // truncated records
+    auto truncated_buf = b.data().copy();
+    truncated_buf.trim_back(truncated_buf.size_bytes() / 2);
+    auto truncated = model::record_batch(
+      header, std::move(truncated_buf), model::record_batch::tag_ctor_ng{});
+    BOOST_REQUIRE_THROW(truncated.verify_records(), std::out_of_range);
+}
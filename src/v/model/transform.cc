@@ -167,6 +167,10 @@ std::optional<transformed_data> transformed_data::create_validated(iobuf buf) {
     return transformed_data(std::move(buf));
 }
 
+transformed_data transformed_data::from_record_payload(iobuf buf) {
+    return transformed_data(std::move(buf));
+}
+
 model::record_batch transformed_data::make_batch(
   model::timestamp timestamp, ss::chunked_fifo<transformed_data> records) {
     model::record_batch::compressed_records serialized_records;
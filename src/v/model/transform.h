@@ -228,6 +228,12 @@ public:
      */
     static std::optional<transformed_data> create_validated(iobuf);
 
+    /**
+     * Create a transformed record from the payload of an input record, which
+     * is known to be well formed. The payload's fragments are reused as is.
+     */
+    static transformed_data from_record_payload(iobuf);
+
     /**
      * Create a batch from transformed_data.
      */
@@ -10,6 +10,7 @@
 #include "net/batched_output_stream.h"
 
 #include "likely.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 #include "vassert.h"
 
@@ -21,10 +22,16 @@
 namespace net {
 
 batched_output_stream::batched_output_stream(
-  ss::output_stream<char> o, size_t cache)
+  ss::output_stream<char> o,
+  size_t cache,
+  std::optional<std::chrono::microseconds> cork_window,
+  probe* probe)
   : _out(std::move(o))
   , _cache_size(cache)
-  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream")) {
+  , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream"))
+  , _cork_window(cork_window)
+  , _cork_timer([this] { flush_corked(); })
+  , _probe(probe) {
     // Size zero reserved for identifying default-initialized
     // instances in stop()
     vassert(_cache_size > 0, "Size must be > 0");
@@ -48,10 +55,20 @@ ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
           const size_t vbytes = v.size();
           return _out.write(std::move(v)).then([this, vbytes] {
               _unflushed_bytes += vbytes;
-              if (
-                _write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
+              if (_probe) {
+                  ++_probe->messages;
+              }
+              if (_unflushed_bytes >= _cache_size) {
                   return do_flush().then([] { return true; });
               }
+              if (_write_sem->waiters() == 0) {
+                  if (!_cork_window) {
+                      return do_flush().then([] { return true; });
+                  }
+                  if (!_cork_timer.armed()) {
+                      _cork_timer.arm(*_cork_window);
+                  }
+              }
               return ss::make_ready_future<bool>(false);
           });
       });
@@ -61,8 +78,19 @@ ss::future<> batched_output_stream::do_flush() {
         return ss::make_ready_future<>();
     }
     _unflushed_bytes = 0;
+    _cork_timer.cancel();
+    if (_probe) {
+        ++_probe->flushes;
+    }
     return _out.flush();
 }
+void batched_output_stream::flush_corked() {
+    // the flush is sequenced before the one of stop() by the semaphore. A
+    // failed flush has no writer to report to: the owner of the stream
+    // notices the broken connection on its next read or write.
+    ssx::background = flush().handle_exception(
+      [](const std::exception_ptr&) {});
+}
 ss::future<> batched_output_stream::flush() {
     return ss::with_semaphore(*_write_sem, 1, [this] { return do_flush(); });
 }
@@ -71,6 +99,7 @@ ss::future<> batched_output_stream::stop() {
         return ss::make_ready_future<>();
     }
     _closed = true;
+    _cork_timer.cancel();
 
     if (_cache_size == 0) {
         // A default-initialized batched_output_stream has a default
@@ -13,11 +13,15 @@
 
 #include "seastarx.h"
 #include "ssx/semaphore.h"
+#include "vassert.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/core/timer.hh>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
+#include <optional>
 
 namespace net {
 
@@ -43,14 +47,30 @@ private:
  * flushes when multiple writes are in progress on the stream: a flush occurs
  * only when the last pending writer completes or when a configured amount of
  * unflushed bytes have accumulated.
+ *
+ * With a cork window, the flush of the last pending writer is further delayed
+ * by up to the window, so that the messages written in the meantime go out
+ * with the same flush, i.e. in a single vectored write to the socket. This
+ * trades a bounded amount of latency for fewer syscalls on streams carrying
+ * many small messages. The amount of unflushed bytes is still bounded by the
+ * cache size.
  */
 class batched_output_stream {
 public:
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
 
+    /// Counters shared by a set of streams, e.g. the connections of a server
+    struct probe {
+        uint64_t messages{0};
+        uint64_t flushes{0};
+    };
+
     batched_output_stream() = default;
     explicit batched_output_stream(
-      ss::output_stream<char>, size_t cache = default_max_unflushed_bytes);
+      ss::output_stream<char>,
+      size_t cache = default_max_unflushed_bytes,
+      std::optional<std::chrono::microseconds> cork_window = std::nullopt,
+      probe* probe = nullptr);
     ~batched_output_stream() noexcept = default;
     // NOTE: explicitly defined for a gcc
     batched_output_stream(batched_output_stream&& o) noexcept
@@ -58,7 +78,14 @@ public:
       , _cache_size(o._cache_size)
       , _write_sem(std::move(o._write_sem))
       , _unflushed_bytes(o._unflushed_bytes)
-      , _closed(o._closed) {}
+      , _closed(o._closed)
+      , _cork_window(o._cork_window)
+      , _probe(o._probe) {
+        // the timer callback refers to the stream, so a stream with a pending
+        // corked flush can't be moved
+        vassert(!o._cork_timer.armed(), "moving a corked stream");
+        _cork_timer.set_callback([this] { flush_corked(); });
+    }
     batched_output_stream& operator=(batched_output_stream&& o) noexcept {
         if (this != &o) {
             this->~batched_output_stream();
@@ -92,11 +119,15 @@ public:
 
 private:
     ss::future<> do_flush();
+    void flush_corked();
 
     ss::output_stream<char> _out;
     size_t _cache_size{0};
     std::unique_ptr<ssx::semaphore> _write_sem;
     size_t _unflushed_bytes{0};
     bool _closed = false;
+    std::optional<std::chrono::microseconds> _cork_window;
+    ss::timer<> _cork_timer;
+    probe* _probe{nullptr};
 };
 } // namespace net
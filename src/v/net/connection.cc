@@ -10,6 +10,7 @@
 #include "net/connection.h"
 
 #include "net/exceptions.h"
+#include "net/tls.h"
 #include "rpc/service.h"
 #include "seastarx.h"
 #include "ssx/abort_source.h"
@@ -128,13 +129,18 @@ connection::connection(
   ss::socket_address a,
   server_probe& p,
   std::optional<size_t> in_max_buffer_size,
-  bool tls_enabled)
+  bool tls_enabled,
+  std::optional<std::chrono::microseconds> out_cork_window)
   : addr(a)
   , _hook(hook)
   , _name(std::move(name))
   , _fd(std::move(f))
   , _in(_fd.input())
-  , _out(_fd.output())
+  , _out(
+      _fd.output(),
+      batched_output_stream::default_max_unflushed_bytes,
+      out_cork_window,
+      &p.output_probe())
   , _probe(p)
   , _tls_enabled(tls_enabled) {
     if (in_max_buffer_size.has_value()) {
@@ -168,6 +174,9 @@ ss::future<> connection::shutdown() {
 
 ss::future<> connection::write(ss::scattered_message<char> msg) {
     _probe.add_bytes_sent(msg.size());
+    if (_tls_enabled) {
+        msg = coalesce_tls_records(std::move(msg));
+    }
     return _out.write(std::move(msg)).discard_result();
 }
 
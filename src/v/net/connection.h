@@ -22,6 +22,9 @@
 
 #include <boost/intrusive/list.hpp>
 
+#include <chrono>
+#include <optional>
+
 /*
  * FIXME:
  *  - server_probe contains bits from simple_protocol
@@ -42,7 +45,9 @@ public:
       ss::socket_address a,
       server_probe& p,
       std::optional<size_t> in_max_buffer_size,
-      bool tls_enabled);
+      bool tls_enabled,
+      std::optional<std::chrono::microseconds> out_cork_window
+      = std::nullopt);
     ~connection() noexcept;
     connection(const connection&) = delete;
     connection& operator=(const connection&) = delete;
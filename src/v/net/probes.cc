@@ -80,6 +80,18 @@ void server_probe::setup_metrics(
           [this] { return _out_bytes; },
           sm::description(
             ssx::sformat("{}: Number of bytes sent to clients", proto))),
+        sm::make_counter(
+          "sent_messages",
+          [this] { return _output.messages; },
+          sm::description(
+            ssx::sformat("{}: Number of messages sent to clients", proto))),
+        sm::make_counter(
+          "output_flushes",
+          [this] { return _output.flushes; },
+          sm::description(ssx::sformat(
+            "{}: Number of flushes of the connections output, each being a "
+            "write to the socket",
+            proto))),
         sm::make_counter(
           "method_not_found_errors",
           [this] { return _method_not_found_errors; },
@@ -28,6 +28,7 @@
 
 #include <boost/intrusive/list.hpp>
 
+#include <chrono>
 #include <list>
 #include <optional>
 #include <type_traits>
@@ -85,13 +86,18 @@ struct server_configuration {
     std::optional<int> tcp_recv_buf;
     std::optional<int> tcp_send_buf;
     std::optional<size_t> stream_recv_buf;
+    // delay of the flush of the responses, see batched_output_stream
+    std::optional<std::chrono::microseconds> stream_cork_window;
     net::metrics_disabled disable_metrics = net::metrics_disabled::no;
     net::public_metrics_disabled disable_public_metrics
       = net::public_metrics_disabled::no;
     ss::sstring name;
     std::optional<config_connection_rate_bindings> connection_rate_bindings;
     std::optional<tcp_keepalive_bindings> tcp_keepalive_bindings;
-    // we use the same default as seastar for load balancing algorithm
+    // we use the same default as seastar for load balancing algorithm.
+    // connections are assigned to a shard when accepted and stay there for
+    // their lifetime: a connected socket is bound to the reactor of the shard
+    // that accepted it and can't be handed over to another one.
     ss::server_socket::load_balancing_algorithm load_balancing_algo
       = ss::server_socket::load_balancing_algorithm::connection_distribution;
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "metrics/metrics.h"
+#include "net/batched_output_stream.h"
 #include "seastarx.h"
 
 #include <seastar/core/metrics_registration.hh>
@@ -65,6 +66,9 @@ public:
     // log_message_timestamp_alert_after_ms and
     // log_message_timestamp_alert_before_ms
     void produce_bad_create_time() { _produce_bad_create_time++; }
+
+    /// Shared by the output streams of all the connections
+    batched_output_stream::probe& output_probe() { return _output; }
     // for testing
     auto get_produce_bad_create_time() const {
         return _produce_bad_create_time;
@@ -92,6 +96,7 @@ private:
     uint32_t _declined_new_connections = 0;
     uint32_t _connections_wait_rate = 0;
     uint32_t _produce_bad_create_time = 0;
+    batched_output_stream::probe _output;
     friend std::ostream& operator<<(std::ostream& o, const server_probe& p);
 };
 
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "net/batched_output_stream.h"
+#include "seastarx.h"
+
+#include <seastar/core/iostream.hh>
+#include <seastar/core/scattered_message.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+// counts the writes reaching the "socket"
+class counting_sink final : public ss::data_sink_impl {
+public:
+    explicit counting_sink(size_t& puts)
+      : _puts(puts) {}
+
+    ss::future<> put(ss::net::packet) final {
+        ++_puts;
+        return ss::make_ready_future<>();
+    }
+    ss::future<> flush() final { return ss::make_ready_future<>(); }
+    ss::future<> close() final { return ss::make_ready_future<>(); }
+
+private:
+    size_t& _puts;
+};
+
+net::batched_output_stream make_stream(
+  size_t& puts,
+  net::batched_output_stream::probe& probe,
+  std::optional<std::chrono::microseconds> cork_window) {
+    return net::batched_output_stream(
+      ss::output_stream<char>(
+        ss::data_sink(std::make_unique<counting_sink>(puts)), 8192),
+      net::batched_output_stream::default_max_unflushed_bytes,
+      cork_window,
+      &probe);
+}
+
+ss::scattered_message<char> make_msg() {
+    ss::scattered_message<char> msg;
+    msg.append(ss::sstring("small message"));
+    return msg;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(flush_per_message_without_cork) {
+    size_t puts = 0;
+    net::batched_output_stream::probe probe;
+    auto out = make_stream(puts, probe, std::nullopt);
+    for (int i = 0; i < 3; ++i) {
+        BOOST_REQUIRE(out.write(make_msg()).get0());
+        ss::sleep(1ms).get();
+    }
+    BOOST_REQUIRE_EQUAL(puts, 3);
+    BOOST_REQUIRE_EQUAL(probe.messages, 3);
+    BOOST_REQUIRE_EQUAL(probe.flushes, 3);
+    out.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(cork_window_batches_messages) {
+    size_t puts = 0;
+    net::batched_output_stream::probe probe;
+    auto out = make_stream(puts, probe, 50ms);
+    for (int i = 0; i < 3; ++i) {
+        // the writes complete without flushing
+        BOOST_REQUIRE(!out.write(make_msg()).get0());
+        ss::sleep(1ms).get();
+    }
+    BOOST_REQUIRE_EQUAL(puts, 0);
+    ss::sleep(100ms).get();
+    // a single write to the socket once the window elapses
+    BOOST_REQUIRE_EQUAL(puts, 1);
+    BOOST_REQUIRE_EQUAL(probe.messages, 3);
+    BOOST_REQUIRE_EQUAL(probe.flushes, 1);
+    out.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(stop_flushes_corked_messages) {
+    size_t puts = 0;
+    net::batched_output_stream::probe probe;
+    auto out = make_stream(puts, probe, 10s);
+    BOOST_REQUIRE(!out.write(make_msg()).get0());
+    out.stop().get();
+    BOOST_REQUIRE_EQUAL(puts, 1);
+    BOOST_REQUIRE_EQUAL(probe.flushes, 1);
+}
@@ -9,6 +9,7 @@
  */
 
 #include "net/connection.h"
+#include "net/tls.h"
 
 #include <seastar/core/future.hh>
 
@@ -16,6 +17,8 @@
 #include <boost/test/test_tools.hpp>
 
 #include <exception>
+#include <string>
+#include <vector>
 #include <system_error>
 
 BOOST_AUTO_TEST_CASE(test_is_disconnect_error) {
@@ -48,3 +51,40 @@ BOOST_AUTO_TEST_CASE(test_is_disconnect_error) {
                      std::make_exception_ptr(not_a_de))))
                    .has_value());
 }
+
+BOOST_AUTO_TEST_CASE(test_coalesce_tls_records) {
+    constexpr size_t record_size = 64;
+    std::string expected;
+    ss::scattered_message<char> msg;
+    // small fragments filling a bit more than two records
+    for (int i = 0; i < 30; ++i) {
+        auto s = std::to_string(i) + "-abc";
+        expected += s;
+        msg.append(ss::sstring(s));
+    }
+    // a large fragment passed through as is
+    auto large = std::string(record_size * 2, 'x');
+    expected += large;
+    msg.append(ss::sstring(large));
+    expected += "tail";
+    msg.append(ss::sstring("tail"));
+
+    auto ret = net::coalesce_tls_records(std::move(msg), record_size);
+    BOOST_REQUIRE_EQUAL(ret.size(), expected.size());
+
+    auto p = std::move(ret).release();
+    std::vector<size_t> sizes;
+    std::string actual;
+    for (const auto& f : p.fragments()) {
+        sizes.push_back(f.size);
+        actual.append(f.base, f.size);
+    }
+    BOOST_REQUIRE_EQUAL(actual, expected);
+    // 30 small fragments, 170 bytes: two full records and a partial one
+    BOOST_REQUIRE_EQUAL(sizes.size(), 5);
+    BOOST_CHECK_EQUAL(sizes[0], record_size);
+    BOOST_CHECK_EQUAL(sizes[1], record_size);
+    BOOST_CHECK_EQUAL(sizes[2], 170 - 2 * record_size);
+    BOOST_CHECK_EQUAL(sizes[3], large.size());
+    BOOST_CHECK_EQUAL(sizes[4], 4);
+}
@@ -13,8 +13,11 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/seastar.hh>
+#include <seastar/core/temporary_buffer.hh>
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 
 namespace net {
 ss::future<std::optional<ss::sstring>> find_ca_file() {
@@ -35,4 +38,50 @@ ss::future<std::optional<ss::sstring>> find_ca_file() {
     }
     co_return std::nullopt;
 }
+
+ss::scattered_message<char>
+coalesce_tls_records(ss::scattered_message<char> msg, size_t record_size) {
+    auto p = std::move(msg).release();
+    ss::scattered_message<char> ret;
+    const bool single_fragment = p.nr_frags() <= 1;
+    bool references_p = false;
+    ss::temporary_buffer<char> buf;
+    size_t buf_used = 0;
+    auto flush_buf = [&] {
+        if (buf_used > 0) {
+            buf.trim(buf_used);
+            ret.append(std::move(buf));
+            buf = {};
+            buf_used = 0;
+        }
+    };
+    for (const auto& f : p.fragments()) {
+        if (single_fragment || f.size >= record_size) {
+            flush_buf();
+            ret.append_static(f.base, f.size);
+            references_p = true;
+            continue;
+        }
+        size_t copied = 0;
+        while (copied < f.size) {
+            if (buf.empty()) {
+                buf = ss::temporary_buffer<char>(record_size);
+            }
+            auto n = std::min(f.size - copied, record_size - buf_used);
+            std::memcpy(buf.get_write() + buf_used, f.base + copied, n);
+            buf_used += n;
+            copied += n;
+            if (buf_used == record_size) {
+                flush_buf();
+            }
+        }
+    }
+    flush_buf();
+    if (references_p) {
+        // the fragments passed through are owned by the original message
+        ret.on_delete([p = std::move(p)] {});
+    }
+    return ret;
+}
+
 } // namespace net
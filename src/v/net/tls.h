@@ -12,6 +12,7 @@
 #include "seastarx.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/scattered_message.hh>
 
 namespace net {
 
@@ -30,4 +31,19 @@ namespace net {
 /// the one that exists. This path is then passed to GnuTLS.
 ss::future<std::optional<ss::sstring>> find_ca_file();
 
+/// Maximum plaintext size of a TLS record
+inline constexpr size_t max_tls_record_size = 16 * 1024;
+
+/// Coalesce the small fragments of a message into record sized buffers
+///
+/// The TLS session encrypts the data it's handed fragment by fragment, so a
+/// message made of many small fragments (e.g. a fetch response) turns into
+/// as many small records, each paying the record header, the AEAD tag and a
+/// cipher invocation. Fragments of at least `record_size` bytes are passed
+/// through without copying, while runs of smaller ones are copied into
+/// buffers of up to `record_size` bytes.
+ss::scattered_message<char> coalesce_tls_records(
+  ss::scattered_message<char> msg,
+  size_t record_size = max_tls_record_size);
+
 } // namespace net
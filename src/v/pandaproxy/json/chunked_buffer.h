@@ -0,0 +1,40 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+
+namespace pandaproxy::json {
+
+/**
+ * A rapidjson output stream that writes the document into an iobuf.
+ *
+ * Unlike ::json::StringBuffer the document is never linearized, it grows
+ * fragment by fragment and can be handed to the http reply without a copy.
+ */
+class chunked_buffer {
+public:
+    using Ch = char;
+
+    void Put(Ch c) { _impl.append(&c, sizeof(Ch)); }
+    void Flush() {}
+
+    void Clear() { _impl.clear(); }
+    size_t GetSize() const { return _impl.size_bytes(); }
+
+    iobuf as_iobuf() && { return std::move(_impl); }
+
+private:
+    iobuf _impl;
+};
+
+} // namespace pandaproxy::json
@@ -43,13 +43,13 @@ public:
       , _tpv(tpv)
       , _base_offset(base_offset) {}
 
-    bool
-    operator()(::json::Writer<::json::StringBuffer>& w, model::record record) {
+    template<typename Buffer>
+    bool operator()(::json::Writer<Buffer>& w, model::record record) {
         auto offset = _base_offset() + record.offset_delta();
 
         w.StartObject();
         w.Key("topic");
-        ::json::rjson_serialize(w, _tpv.topic);
+        w.String(_tpv.topic().data(), _tpv.topic().size());
         w.Key("key");
         if (!rjson_serialize_fmt(_fmt)(w, record.release_key())) {
             throw serialize_error(
@@ -73,9 +73,9 @@ public:
                 _tpv.partition()));
         }
         w.Key("partition");
-        ::json::rjson_serialize(w, _tpv.partition);
+        w.Int(_tpv.partition());
         w.Key("offset");
-        ::json::rjson_serialize(w, offset);
+        w.Int64(offset);
         w.EndObject();
 
         return true;
@@ -97,8 +97,8 @@ public:
     explicit rjson_serialize_impl(serialization_format fmt)
       : _fmt(fmt) {}
 
-    bool operator()(
-      ::json::Writer<::json::StringBuffer>& w, kafka::fetch_response&& res) {
+    template<typename Buffer>
+    bool operator()(::json::Writer<Buffer>& w, kafka::fetch_response&& res) {
         // Eager check for errors
         for (auto& v : res) {
             if (v.partition_response->error_code != kafka::error_code::none) {
@@ -9,6 +9,7 @@
 
 #include "pandaproxy/json/requests/fetch.h"
 
+#include "bytes/iobuf_parser.h"
 #include "json/stringbuffer.h"
 #include "json/writer.h"
 #include "kafka/client/test/utils.h"
@@ -18,6 +19,7 @@
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "model/timestamp.h"
+#include "pandaproxy/json/chunked_buffer.h"
 #include "pandaproxy/json/requests/fetch.h"
 #include "pandaproxy/json/rjson_util.h"
 #include "pandaproxy/json/types.h"
@@ -97,3 +99,27 @@ SEASTAR_THREAD_TEST_CASE(test_produce_fetch_one) {
 
     BOOST_REQUIRE_EQUAL(str_buf.GetString(), expected);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_fetch_chunked) {
+    std::vector<model::topic_partition> tps = {
+      {model::topic{"topic1"}, model::partition_id{1}},
+      {model::topic{"topic2"}, model::partition_id{2}},
+    };
+    auto fmt = ppj::serialization_format::binary_v2;
+
+    ::json::StringBuffer str_buf;
+    ::json::Writer<::json::StringBuffer> str_w(str_buf);
+    ppj::rjson_serialize_fmt(fmt)(
+      str_w, make_fetch_response(tps, model::offset{42}, 100));
+
+    ppj::chunked_buffer chunked_buf;
+    ::json::Writer<ppj::chunked_buffer> chunked_w(chunked_buf);
+    ppj::rjson_serialize_fmt(fmt)(
+      chunked_w, make_fetch_response(tps, model::offset{42}, 100));
+
+    BOOST_REQUIRE_EQUAL(chunked_buf.GetSize(), str_buf.GetSize());
+    iobuf_parser p{std::move(chunked_buf).as_iobuf()};
+    BOOST_REQUIRE_EQUAL(
+      p.read_string(p.bytes_left()),
+      ss::sstring(str_buf.GetString(), str_buf.GetSize()));
+}
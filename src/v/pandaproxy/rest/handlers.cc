@@ -9,6 +9,7 @@
 
 #include "handlers.h"
 
+#include "bytes/iostream.h"
 #include "config/rest_authn_endpoint.h"
 #include "hashing/jump_consistent_hash.h"
 #include "hashing/xx.h"
@@ -21,6 +22,7 @@
 #include "kafka/protocol/schemata/offset_commit_request.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
+#include "pandaproxy/json/chunked_buffer.h"
 #include "pandaproxy/json/exceptions.h"
 #include "pandaproxy/json/requests/brokers.h"
 #include "pandaproxy/json/requests/create_consumer.h"
@@ -64,6 +66,31 @@ namespace {
 
 using server = proxy::server;
 
+/// Serialize the response into an iobuf and stream it to the client with
+/// chunked transfer encoding, the document is never linearized nor copied.
+///
+/// The document is fully serialized before the reply is returned so that a
+/// serialization error still results in an error reply.
+template<typename T>
+void write_chunked_body(
+  ss::http::reply& rep, ppj::serialization_format fmt, T&& t) {
+    ppj::chunked_buffer buf;
+    ::json::Writer<ppj::chunked_buffer> w(buf);
+    ppj::rjson_serialize_fmt(fmt)(w, std::forward<T>(t));
+    rep.write_body(
+      "json",
+      [body = std::move(buf).as_iobuf()](
+        ss::output_stream<char>&& output_stream) mutable {
+          return ss::do_with(
+            std::move(output_stream),
+            std::move(body),
+            [](auto& os, auto& body) {
+                return write_iobuf_to_output_stream(std::move(body), os)
+                  .finally([&os] { return os.close(); });
+            });
+      });
+}
+
 } // namespace
 
 ss::future<server::reply_t>
@@ -154,24 +181,21 @@ get_topics_records(server::request_t rq, server::reply_t rp) {
       timeout,
       max_bytes);
 
-    co_return co_await rq
-      .dispatch([offset, timeout, max_bytes, res_fmt, tp{std::move(tp)}](
-                  kafka::client::client& client) mutable {
+    co_return co_await rq.dispatch(
+      [offset,
+       timeout,
+       max_bytes,
+       res_fmt,
+       tp{std::move(tp)},
+       rp{std::move(rp)}](kafka::client::client& client) mutable {
           return client
             .fetch_partition(std::move(tp), offset, max_bytes, timeout)
-            .then([res_fmt](kafka::fetch_response res) {
-                ::json::StringBuffer str_buf;
-                ::json::Writer<::json::StringBuffer> w(str_buf);
-
-                ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-                // TODO Ben: Prevent this linearization
-                return ss::make_ready_future<ss::sstring>(str_buf.GetString());
+            .then([res_fmt, rp{std::move(rp)}](
+                    kafka::fetch_response res) mutable {
+                write_chunked_body(*rp.rep, res_fmt, std::move(res));
+                rp.mime_type = res_fmt;
+                return std::move(rp);
             });
-      })
-      .then([res_fmt, rp = std::move(rp)](ss::sstring json_rslt) mutable {
-          rp.rep->write_body("json", json_rslt);
-          rp.mime_type = res_fmt;
-          return std::move(rp);
       });
 }
 
@@ -410,14 +434,7 @@ consumer_fetch(server::request_t rq, server::reply_t rp) {
 
           return client.consumer_fetch(group_id, name, timeout, max_bytes)
             .then([res_fmt, rp{std::move(rp)}](auto res) mutable {
-                ::json::StringBuffer str_buf;
-                ::json::Writer<::json::StringBuffer> w(str_buf);
-
-                ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-
-                // TODO Ben: Prevent this linearization
-                ss::sstring json_rslt = str_buf.GetString();
-                rp.rep->write_body("json", json_rslt);
+                write_chunked_body(*rp.rep, res_fmt, std::move(res));
                 rp.mime_type = res_fmt;
                 return std::move(rp);
             });
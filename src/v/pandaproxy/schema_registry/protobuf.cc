@@ -20,6 +20,7 @@
 #include "vlog.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/container/flat_hash_set.h>
 #include <boost/algorithm/string/trim.hpp>
@@ -287,6 +288,8 @@ ss::future<const pb::FileDescriptor*> build_file_with_refs(
           dp,
           store,
           canonical_schema{subject{ref.name}, std::move(dep.schema).def()});
+        // building deep reference graphs is CPU bound
+        co_await ss::coroutine::maybe_yield();
     }
 
     parser p;
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "pandaproxy/schema_registry/types.h"
+#include "seastarx.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <optional>
+
+namespace pandaproxy::schema_registry {
+
+///\brief A shard-local replica of the schema definitions owned by other
+/// shards.
+///
+/// The definition of a schema id does not change once it is written, so a
+/// shard serving lookups keeps a copy of the definitions it read from their
+/// owning shard to avoid the cross shard hop on the next lookup.
+///
+/// Replicas are invalidated on every shard when a definition is overwritten.
+/// A lookup that misses records the generation before reading from the
+/// owning shard, the definition it read is not cached if an invalidation
+/// happened meanwhile as it may be stale.
+class schema_definition_cache {
+public:
+    using generation_t = uint64_t;
+
+    static constexpr size_t max_entries = 10'000;
+
+    std::optional<canonical_schema_definition> get(schema_id id) const {
+        auto it = _definitions.find(id);
+        if (it == _definitions.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    generation_t generation() const { return _generation; }
+
+    ///\brief Cache the definition read at the given generation.
+    void put(
+      generation_t gen, schema_id id, const canonical_schema_definition& def) {
+        if (gen != _generation) {
+            return;
+        }
+        if (_definitions.size() >= max_entries) {
+            // there is no locality between schema ids, evict any entry
+            _definitions.erase(_definitions.begin());
+        }
+        _definitions.insert_or_assign(id, def);
+    }
+
+    void invalidate(schema_id id) {
+        ++_generation;
+        _definitions.erase(id);
+    }
+
+    size_t size() const { return _definitions.size(); }
+
+private:
+    absl::flat_hash_map<schema_id, canonical_schema_definition> _definitions;
+    generation_t _generation{0};
+};
+
+} // namespace pandaproxy::schema_registry
@@ -26,10 +26,13 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/map_reduce.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/coroutine/exception.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/algorithm/container.h>
+#include <boost/range/irange.hpp>
 #include <fmt/core.h>
 
 #include <functional>
@@ -59,6 +62,15 @@ bool check_compatible(const valid_schema& reader, const valid_schema& writer) {
     });
 }
 
+std::optional<canonical_schema_definition>
+find_definition(const store& s, schema_id id) {
+    auto def = s.get_schema_definition(id);
+    if (def.has_error()) {
+        return std::nullopt;
+    }
+    return std::move(def).value();
+}
+
 constexpr auto set_accumulator =
   [](store::schema_id_set acc, store::schema_id_set refs) {
       acc.insert(refs.begin(), refs.end());
@@ -69,10 +81,14 @@ constexpr auto set_accumulator =
 
 ss::future<> sharded_store::start(ss::smp_service_group sg) {
     _smp_opts = ss::smp_submit_to_options{sg};
-    return _store.start();
+    co_await _store.start();
+    co_await _definition_cache.start();
 }
 
-ss::future<> sharded_store::stop() { return _store.stop(); }
+ss::future<> sharded_store::stop() {
+    co_await _definition_cache.stop();
+    co_await _store.stop();
+}
 
 ss::future<canonical_schema>
 sharded_store::make_canonical_schema(unparsed_schema schema) {
@@ -258,10 +274,7 @@ ss::future<bool> sharded_store::upsert(
 }
 
 ss::future<bool> sharded_store::has_schema(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id), _smp_opts, [id](store& s) {
-          return s.get_schema_definition(id).has_value();
-      });
+    co_return (co_await find_schema_definition(id)).has_value();
 }
 
 ss::future<subject_schema> sharded_store::has_schema(canonical_schema schema) {
@@ -299,10 +312,31 @@ ss::future<subject_schema> sharded_store::has_schema(canonical_schema schema) {
 
 ss::future<canonical_schema_definition>
 sharded_store::get_schema_definition(schema_id id) {
-    co_return co_await _store.invoke_on(
-      shard_for(id), _smp_opts, [id](store& s) {
-          return s.get_schema_definition(id).value();
-      });
+    auto def = co_await find_schema_definition(id);
+    if (!def.has_value()) {
+        throw as_exception(not_found(id));
+    }
+    co_return std::move(def).value();
+}
+
+ss::future<std::optional<canonical_schema_definition>>
+sharded_store::find_schema_definition(schema_id id) {
+    auto shard = shard_for(id);
+    if (shard == ss::this_shard_id()) {
+        co_return find_definition(_store.local(), id);
+    }
+
+    auto& cache = _definition_cache.local();
+    if (auto def = cache.get(id); def.has_value()) {
+        co_return def;
+    }
+    const auto gen = cache.generation();
+    auto def = co_await _store.invoke_on(
+      shard, _smp_opts, [id](store& s) { return find_definition(s, id); });
+    if (def.has_value()) {
+        cache.put(gen, id, *def);
+    }
+    co_return def;
 }
 
 ss::future<std::vector<subject_version>>
@@ -343,10 +377,7 @@ ss::future<subject_schema> sharded_store::get_subject_schema(
           return s.get_subject_version_id(sub, version, inc_del).value();
       });
 
-    auto def = co_await _store.invoke_on(
-      shard_for(v_id.id), _smp_opts, [id{v_id.id}](store& s) {
-          return s.get_schema_definition(id).value();
-      });
+    auto def = co_await get_schema_definition(v_id.id);
 
     co_return subject_schema{
       .schema = {sub, std::move(def)},
@@ -541,10 +572,17 @@ sharded_store::clear_compatibility(seq_marker marker, subject sub) {
 ss::future<bool>
 sharded_store::upsert_schema(schema_id id, canonical_schema_definition def) {
     co_await maybe_update_max_schema_id(id);
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id, def{std::move(def)}](store& s) mutable {
           return s.upsert_schema(id, std::move(def));
       });
+    if (!inserted) {
+        // the definition was overwritten, drop the stale replicas
+        co_await _definition_cache.invoke_on_all(
+          _smp_opts,
+          [id](schema_definition_cache& cache) { cache.invalidate(id); });
+    }
+    co_return inserted;
 }
 
 ss::future<sharded_store::insert_subject_result>
@@ -652,16 +690,55 @@ ss::future<bool> sharded_store::is_compatible(
         ver_it = versions.begin();
     }
 
+    std::vector<schema_version> to_check;
+    for (; ver_it != versions.end(); ++ver_it) {
+        if (!ver_it->deleted) {
+            to_check.push_back(ver_it->version);
+        }
+    }
+
+    if (to_check.size() < min_versions_per_shard * 2 || ss::smp::count == 1) {
+        co_return co_await check_compatible_versions(
+          compat, std::move(new_schema), std::move(to_check));
+    }
+
+    // Compiling the schemas is CPU bound, spread the versions to check over
+    // the shards. Every shard compiles the new schema once.
+    const auto shards = std::min<size_t>(
+      ss::smp::count, to_check.size() / min_versions_per_shard);
+    std::vector<std::vector<schema_version>> per_shard(shards);
+    for (size_t i = 0; i < to_check.size(); ++i) {
+        per_shard[i % shards].push_back(to_check[i]);
+    }
+    co_return co_await ss::map_reduce(
+      boost::irange<ss::shard_id>(0, shards),
+      [this, compat, &new_schema, &per_shard](ss::shard_id shard) {
+          return ss::smp::submit_to(
+            shard,
+            _smp_opts,
+            [this,
+             compat,
+             schema = new_schema,
+             vers = std::move(per_shard[shard])]() mutable {
+                return check_compatible_versions(
+                  compat, std::move(schema), std::move(vers));
+            });
+      },
+      true,
+      std::logical_and<>());
+}
+
+ss::future<bool> sharded_store::check_compatible_versions(
+  compatibility_level compat,
+  canonical_schema new_schema,
+  std::vector<schema_version> versions) {
     auto new_valid = co_await make_valid_schema(new_schema);
+    const auto& sub = new_schema.sub();
 
     auto is_compat = true;
-    for (; is_compat && ver_it != versions.end(); ++ver_it) {
-        if (ver_it->deleted) {
-            continue;
-        }
-
+    for (auto it = versions.begin(); is_compat && it != versions.end(); ++it) {
         auto old_schema = co_await get_subject_schema(
-          sub, ver_it->version, include_deleted::no);
+          sub, *it, include_deleted::no);
         auto old_valid = co_await make_valid_schema(old_schema.schema);
 
         if (
@@ -678,6 +755,7 @@ ss::future<bool> sharded_store::is_compatible(
           || compat == compatibility_level::full_transitive) {
             is_compat = is_compat && check_compatible(old_valid, new_valid);
         }
+        co_await ss::coroutine::maybe_yield();
     }
     co_return is_compat;
 }
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "pandaproxy/schema_registry/schema_definition_cache.h"
 #include "pandaproxy/schema_registry/types.h"
 
 #include <seastar/core/sharded.hh>
@@ -149,6 +150,16 @@ public:
     ss::future<bool> has_version(const subject&, schema_id, include_deleted);
 
 private:
+    ///\brief The compatibility checks are spread over the shards when there
+    /// are at least twice this many versions to check.
+    static constexpr size_t min_versions_per_shard = 8;
+
+    ///\brief Check the new schema against the given versions on this shard.
+    ss::future<bool> check_compatible_versions(
+      compatibility_level compat,
+      canonical_schema new_schema,
+      std::vector<schema_version> versions);
+
     ss::future<bool>
     upsert_schema(schema_id id, canonical_schema_definition def);
 
@@ -169,8 +180,14 @@ private:
 
     ss::future<schema_id> project_schema_id();
 
+    ///\brief Look up the definition in the local replica before asking the
+    /// shard owning the id.
+    ss::future<std::optional<canonical_schema_definition>>
+    find_schema_definition(schema_id id);
+
     ss::smp_submit_to_options _smp_opts;
     ss::sharded<store> _store;
+    ss::sharded<schema_definition_cache> _definition_cache;
 
     ///\brief Access must occur only on shard 0.
     schema_id _next_schema_id{1};
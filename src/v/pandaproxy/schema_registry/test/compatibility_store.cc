@@ -86,3 +86,38 @@ SEASTAR_THREAD_TEST_CASE(test_avro_basic_backwards_store_compat) {
                       {sub, pps::canonical_schema_definition{schema3}})
                      .get());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_avro_transitive_store_compat_many_versions) {
+    pps::sharded_store s;
+    s.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&s]() { s.stop().get(); });
+
+    pps::seq_marker dummy_marker;
+    auto sub = pps::subject{"sub"};
+
+    // the first version lacks the defaulted field, the other ones have it
+    constexpr int32_t versions = 40;
+    for (int32_t v = 1; v <= versions; ++v) {
+        s.upsert(
+           dummy_marker,
+           {sub, pps::canonical_schema_definition{v == 1 ? schema1 : schema2}},
+           pps::schema_id{v},
+           pps::schema_version{v},
+           pps::is_deleted::no)
+          .get();
+    }
+
+    // removing the defaulted field is compatible with the latest version
+    s.set_compatibility(pps::compatibility_level::backward).get();
+    BOOST_REQUIRE(s.is_compatible(
+                     pps::schema_version{versions},
+                     {sub, pps::canonical_schema_definition{schema3}})
+                    .get());
+
+    // but not with the first one
+    s.set_compatibility(pps::compatibility_level::backward_transitive).get();
+    BOOST_REQUIRE(!s.is_compatible(
+                      pps::schema_version{versions},
+                      {sub, pps::canonical_schema_definition{schema3}})
+                     .get());
+}
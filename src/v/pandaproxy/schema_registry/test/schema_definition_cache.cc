@@ -0,0 +1,58 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/schema_registry/schema_definition_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace pps = pandaproxy::schema_registry;
+
+const pps::canonical_schema_definition def1{
+  R"({"type":"string"})", pps::schema_type::avro};
+const pps::canonical_schema_definition def2{
+  R"({"type":"int"})", pps::schema_type::avro};
+
+BOOST_AUTO_TEST_CASE(test_schema_definition_cache_get_put) {
+    pps::schema_definition_cache c;
+    BOOST_REQUIRE(!c.get(pps::schema_id{1}).has_value());
+
+    c.put(c.generation(), pps::schema_id{1}, def1);
+    auto def = c.get(pps::schema_id{1});
+    BOOST_REQUIRE(def.has_value());
+    BOOST_REQUIRE(*def == def1);
+    BOOST_REQUIRE(!c.get(pps::schema_id{2}).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(test_schema_definition_cache_invalidate) {
+    pps::schema_definition_cache c;
+    c.put(c.generation(), pps::schema_id{1}, def1);
+    c.put(c.generation(), pps::schema_id{2}, def2);
+
+    // a lookup started before the invalidation must not be cached
+    auto gen = c.generation();
+    c.invalidate(pps::schema_id{1});
+    BOOST_REQUIRE(!c.get(pps::schema_id{1}).has_value());
+    BOOST_REQUIRE(c.get(pps::schema_id{2}).has_value());
+    c.put(gen, pps::schema_id{1}, def1);
+    BOOST_REQUIRE(!c.get(pps::schema_id{1}).has_value());
+
+    c.put(c.generation(), pps::schema_id{1}, def2);
+    auto def = c.get(pps::schema_id{1});
+    BOOST_REQUIRE(def.has_value());
+    BOOST_REQUIRE(*def == def2);
+}
+
+BOOST_AUTO_TEST_CASE(test_schema_definition_cache_capacity) {
+    pps::schema_definition_cache c;
+    constexpr auto max_entries = pps::schema_definition_cache::max_entries;
+    for (size_t i = 0; i < 2 * max_entries; ++i) {
+        c.put(c.generation(), pps::schema_id{static_cast<int32_t>(i)}, def1);
+    }
+    BOOST_REQUIRE_EQUAL(c.size(), max_entries);
+}
@@ -78,7 +78,7 @@ auto make_subject(
     }
 };
 
-std::vector<int32_t> get_proto_offsets(iobuf_parser& p) {
+std::vector<int32_t> get_proto_offsets(iobuf_parser_base& p) {
     // The encoding is a length, followed by indexes into the file or message.
     // Each number is a zigzag encoded integer.
     std::vector<int32_t> offsets;
@@ -141,6 +141,50 @@ ss::future<std::optional<ss::sstring>> get_record_name(
     co_return std::nullopt;
 }
 
+///\brief Parse the magic byte and the schema id prefixing a field.
+std::optional<schema_id> get_schema_id(iobuf_parser_base& p) {
+    if (p.bytes_left() < 5 || p.consume_type<int8_t>() != 0) {
+        return std::nullopt;
+    }
+    return schema_id{p.consume_be_type<int32_t>()};
+}
+
+///\brief A field encoding validated for the records of a batch.
+struct validated_field {
+    field f;
+    schema_id id;
+    schema_id_cache::offsets_t offsets;
+};
+
+///\brief Producers encode the records of a batch with one or a few schemas,
+/// so a field matching an encoding already validated for the batch is valid
+/// without resolving it again.
+bool is_validated(
+  const std::vector<validated_field>& validated, field f, const iobuf& buf) {
+    iobuf_const_parser parser(buf);
+    auto id = get_schema_id(parser);
+    if (!id) {
+        return false;
+    }
+    bool is_protobuf = false;
+    for (const auto& v : validated) {
+        if (v.f == f && v.id == *id) {
+            if (!v.offsets) {
+                return true;
+            }
+            is_protobuf = true;
+            break;
+        }
+    }
+    if (!is_protobuf) {
+        return false;
+    }
+    auto offsets = get_proto_offsets(parser);
+    return absl::c_any_of(validated, [f, &id, &offsets](const auto& v) {
+        return v.f == f && v.id == *id && v.offsets == offsets;
+    });
+}
+
 template<typename T>
 T combine(
   pandaproxy::schema_registry::schema_id_validation_mode mode,
@@ -193,10 +237,13 @@ public:
           props.record_value_subject_name_strategy_compat,
           subject_name_strategy::topic_name)} {}
 
-    auto validate_field(
-      field field, model::topic topic, subject_name_strategy sns, iobuf buf)
-      -> ss::future<bool> {
-        iobuf_parser parser(std::move(buf));
+    ///\brief Resolve the schema of a field, \p buf must outlive the future.
+    auto resolve_field(
+      field field,
+      const model::topic& topic,
+      subject_name_strategy sns,
+      const iobuf& buf) -> ss::future<std::optional<validated_field>> {
+        iobuf_const_parser parser(buf);
 
         if (parser.bytes_left() < 5) {
             vlog(
@@ -205,7 +252,7 @@ public:
               topic(),
               to_string_view(field),
               parser.bytes_left());
-            co_return false;
+            co_return std::nullopt;
         }
 
         auto magic = parser.consume_type<int8_t>();
@@ -216,7 +263,7 @@ public:
               topic(),
               to_string_view(field),
               magic);
-            co_return false;
+            co_return std::nullopt;
         }
 
         auto id = schema_id{parser.consume_be_type<int32_t>()};
@@ -231,7 +278,7 @@ public:
               topic(),
               to_string_view(field));
             _api->_schema_id_validation_probe.local().hit();
-            co_return true;
+            co_return validated_field{field, id, std::nullopt};
         }
 
         // Determine the schema type
@@ -245,7 +292,7 @@ public:
               topic(),
               to_string_view(field),
               ex.message());
-            co_return false;
+            co_return std::nullopt;
         }
 
         std::optional<std::vector<int32_t>> proto_offsets;
@@ -257,7 +304,7 @@ public:
                   "validating: topic: {}, field: {}, invalid protobuf offsets",
                   topic(),
                   to_string_view(field));
-                co_return false;
+                co_return std::nullopt;
             }
 
             if (_api->_schema_id_cache.local().has(
@@ -268,7 +315,7 @@ public:
                   topic(),
                   to_string_view(field));
                 _api->_schema_id_validation_probe.local().hit();
-                co_return true;
+                co_return validated_field{field, id, std::move(offsets)};
             }
 
             proto_offsets.emplace(std::move(offsets));
@@ -282,7 +329,7 @@ public:
               "validating: topic: {}, field: {}, unable to extract record_name",
               topic(),
               to_string_view(field));
-            co_return false;
+            co_return std::nullopt;
         }
 
         auto sub = make_subject(sns, topic, field, *record_name);
@@ -296,15 +343,33 @@ public:
               sub,
               id,
               has_id);
-            co_return false;
+            co_return std::nullopt;
         }
 
         _api->_schema_id_cache.local().put(
-          topic, field, sns, id, std::move(proto_offsets));
+          topic, field, sns, id, proto_offsets);
         _api->_schema_id_validation_probe.local().miss();
-        co_return true;
+        co_return validated_field{field, id, std::move(proto_offsets)};
     };
 
+    ss::future<bool> validate_field(
+      field field,
+      subject_name_strategy sns,
+      const iobuf& buf,
+      std::vector<validated_field>& validated) {
+        if (is_validated(validated, field, buf)) {
+            return ss::make_ready_future<bool>(true);
+        }
+        return resolve_field(field, _topic, sns, buf)
+          .then([&validated](std::optional<validated_field> v) {
+              if (!v) {
+                  return false;
+              }
+              validated.push_back(std::move(*v));
+              return true;
+          });
+    }
+
     ss::future<bool> validate(const model::record_batch& batch) {
         if (
           !_record_key_schema_id_validation
@@ -312,30 +377,6 @@ public:
             co_return true;
         }
 
-        auto key_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_key_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::key,
-              _topic,
-              _record_key_subject_name_strategy,
-              record.key().copy());
-        };
-
-        auto value_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_value_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::val,
-              _topic,
-              _record_value_subject_name_strategy,
-              record.value().copy());
-        };
-
         const model::record_batch& b = batch;
         std::optional<const model::record_batch> u;
         bool compressed = batch.compressed();
@@ -345,18 +386,33 @@ public:
             _api->_schema_id_validation_probe.local().decompressed();
         }
 
-        bool valid{true};
-        co_await model::for_each_record(
-          compressed ? u.value() : b,
-          [&valid, k{std::move(key_is_valid)}, v{std::move(value_is_valid)}](
-            const model::record& r) {
-              return k(r)
-                .then([&r, v{std::move(v)}](bool k) {
-                    return k ? v(r) : ss::make_ready_future<bool>(false);
-                })
-                .then([&valid](bool v) { valid = v; });
-          });
-        co_return valid;
+        // Resolved fields are only looked up in the shard cache once per
+        // batch, the records are then matched against the ones validated
+        std::vector<validated_field> validated;
+        auto it = model::record_batch_iterator::create(
+          compressed ? u.value() : b);
+        while (it.has_next()) {
+            auto r = it.next();
+            if (
+              _record_key_schema_id_validation
+              && !co_await validate_field(
+                field::key,
+                _record_key_subject_name_strategy,
+                r.key(),
+                validated)) {
+                co_return false;
+            }
+            if (
+              _record_value_schema_id_validation
+              && !co_await validate_field(
+                field::val,
+                _record_value_subject_name_strategy,
+                r.value(),
+                validated)) {
+                co_return false;
+            }
+        }
+        co_return true;
     }
 
     ss::future<bool> validate(const data_t& data) {
@@ -103,6 +103,8 @@ consensus::consensus(
     recovery_throttle,
   recovery_memory_quota& recovery_mem_quota,
   recovery_scheduler& recovery_scheduler,
+  recovery_batcher& recovery_batcher,
+  vote_batcher& vote_batcher,
   features::feature_table& ft,
   std::optional<voter_priority> voter_priority_override,
   keep_snapshotted_log should_keep_snapshotted_log)
@@ -122,7 +124,7 @@ consensus::consensus(
   , _fstats(
       _self,
       config::shard_local_cfg()
-        .raft_max_concurrent_append_requests_per_follower())
+        .raft_max_concurrent_append_requests_per_follower.bind())
   , _batcher(this, config::shard_local_cfg().raft_replicate_batch_window_size())
   , _event_manager(this)
   , _probe(std::make_unique<probe>())
@@ -137,6 +139,8 @@ consensus::consensus(
   , _recovery_throttle(recovery_throttle)
   , _recovery_mem_quota(recovery_mem_quota)
   , _recovery_scheduler(recovery_scheduler)
+  , _recovery_batcher(recovery_batcher)
+  , _vote_batcher(vote_batcher)
   , _features(ft)
   , _snapshot_mgr(
       std::filesystem::path(_log->config().work_directory()),
@@ -197,6 +201,7 @@ void consensus::setup_public_metrics() {
 }
 
 void consensus::do_step_down(std::string_view ctx) {
+    wake_up();
     _hbeat = clock_type::now();
     if (_vstate == vote_state::leader) {
         vlog(
@@ -264,6 +269,8 @@ void consensus::shutdown_input() {
 
 ss::future<> consensus::stop() {
     vlog(_ctxlog.info, "Stopping");
+    // the leader learns that the group is gone from the next heartbeat
+    wake_up();
     shutdown_input();
     for (auto& idx : _fstats) {
         idx.second.follower_state_change.broken();
@@ -502,6 +509,11 @@ void consensus::maybe_promote_to_voter(vnode id) {
         if (latest_cfg.is_voter(id)) {
             return ss::now();
         }
+
+        // observers are never promoted
+        if (latest_cfg.is_observer(id)) {
+            return ss::now();
+        }
         auto it = _fstats.find(id);
 
         // already removed
@@ -530,6 +542,99 @@ void consensus::maybe_promote_to_voter(vnode id) {
     });
 }
 
+std::optional<size_t>
+consensus::observers_target(const group_configuration& cfg) const {
+    const auto& nodes = cfg.current_config();
+    const auto requested = static_cast<size_t>(
+      std::max<int16_t>(log_config().observer_replicas(), 0));
+    if (requested == nodes.observers.size()) {
+        return std::nullopt;
+    }
+    /**
+     * Observers only change in a simple configuration, one node at a time
+     * like the promotions of learners: the configuration is not changing,
+     * the previous one is committed and there is no learner to promote.
+     * Observers are only serialized by the current configuration version.
+     */
+    if (
+      cfg.version() < group_configuration::v_6
+      || cfg.get_state() != configuration_state::simple
+      || nodes.learners.size() != nodes.observers.size()
+      || _configuration_manager.get_latest_offset() > _commit_index) {
+        return std::nullopt;
+    }
+    // the leader remains a voter
+    const auto target = std::min(
+      requested, nodes.voters.size() + nodes.observers.size() - 1);
+    if (target == nodes.observers.size()) {
+        return std::nullopt;
+    }
+    return target;
+}
+
+void consensus::update_observers(
+  group_configuration& cfg, size_t target) const {
+    auto match_index = [this](const vnode& id) {
+        auto it = _fstats.find(id);
+        return it == _fstats.end() ? model::offset{} : it->second.match_index;
+    };
+    const auto& nodes = cfg.current_config();
+    if (nodes.observers.size() < target) {
+        // the voter which is the furthest behind is the one the majority
+        // waits for the least
+        std::optional<vnode> candidate;
+        for (const auto& v : nodes.voters) {
+            if (
+              v != _self
+              && (!candidate || match_index(v) < match_index(*candidate))) {
+                candidate = v;
+            }
+        }
+        if (candidate) {
+            vlog(_ctxlog.info, "making node {} an observer", *candidate);
+            cfg.demote_to_observer(*candidate);
+        }
+        return;
+    }
+    // the observer which is the most up to date is promoted first
+    auto observer = *std::max_element(
+      nodes.observers.begin(),
+      nodes.observers.end(),
+      [&match_index](const vnode& a, const vnode& b) {
+          return match_index(a) < match_index(b);
+      });
+    vlog(_ctxlog.info, "node {} is no longer an observer", observer);
+    cfg.revert_observer(observer);
+}
+
+void consensus::maybe_update_observers() {
+    if (
+      _updating_observers || !is_leader()
+      || !observers_target(_configuration_manager.get_latest())) {
+        return;
+    }
+    _updating_observers = true;
+    ssx::spawn_with_gate(_bg, [this] {
+        return _op_lock.get_units()
+          .then([this](ssx::semaphore_units u) mutable {
+              auto latest_cfg = _configuration_manager.get_latest();
+              auto target = observers_target(latest_cfg);
+              if (!is_leader() || !target) {
+                  return ss::make_ready_future<std::error_code>(
+                    errc::success);
+              }
+              update_observers(latest_cfg, *target);
+              return replicate_configuration(
+                std::move(u), std::move(latest_cfg));
+          })
+          .then([this](std::error_code ec) {
+              vlog(
+                _ctxlog.trace, "observers update result {}", ec.message());
+          })
+          .finally([this] { _updating_observers = false; });
+    });
+}
+
 void consensus::process_append_entries_reply(
   model::node_id physical_node,
   result<append_entries_reply> r,
@@ -539,6 +644,7 @@ void consensus::process_append_entries_reply(
       physical_node, r, seq_id, dirty_offset);
     if (is_success) {
         maybe_promote_to_voter(r.value().node_id);
+        maybe_update_observers();
         maybe_update_majority_replicated_index();
         maybe_update_leader_commit_idx();
         _follower_reply.broadcast();
@@ -874,7 +980,7 @@ bool consensus::should_skip_vote(bool ignore_heartbeat) {
 
     if (likely(!ignore_heartbeat)) {
         auto last_election = clock_type::now() - _jit.base_duration();
-        skip_vote |= (_hbeat > last_election); // nothing to do.
+        skip_vote |= (last_heartbeat() > last_election); // nothing to do.
     }
 
     skip_vote |= _vstate == vote_state::leader; // already a leader
@@ -922,6 +1028,7 @@ void consensus::dispatch_vote(bool leadership_transfer) {
         arm_vote_timeout();
         return;
     }
+    wake_up();
     auto self_priority = get_node_priority(_self);
     // check if current node priority is high enough
     // update target priority
@@ -1713,6 +1820,7 @@ ss::future<vote_reply> consensus::do_vote(vote_request r) {
         reply.granted = false;
         co_return reply;
     }
+    wake_up();
 
     // Optimization: for vote requests from nodes that are likely
     // to have been recently restarted (have failed heartbeats
@@ -1877,6 +1985,7 @@ consensus::do_append_entries(append_entries_request&& r) {
     if (unlikely(is_request_target_node_invalid("append_entries", r))) {
         return ss::make_ready_future<append_entries_reply>(reply);
     }
+    wake_up();
     // no need to trigger timeout
     vlog(_ctxlog.trace, "Received append entries request: {}", r);
 
@@ -3035,6 +3144,16 @@ std::ostream& operator<<(std::ostream& o, const consensus& c) {
     return o;
 }
 
+bool consensus::is_observer() const {
+    return _configuration_manager.get_latest().is_observer(_self);
+}
+
+bool consensus::has_observers() const {
+    return !_configuration_manager.get_latest()
+              .current_config()
+              .observers.empty();
+}
+
 group_configuration consensus::config() const {
     return _configuration_manager.get_latest();
 }
@@ -3650,12 +3769,14 @@ follower_metrics build_follower_metrics(
   model::node_id id,
   const storage::offset_stats& lstats,
   std::chrono::milliseconds liveness_timeout,
-  const follower_index_metadata& meta) {
+  const follower_index_metadata& meta,
+  bool is_observer) {
     const auto is_live = meta.last_received_reply_timestamp + liveness_timeout
                          > clock_type::now();
     return follower_metrics{
       .id = id,
       .is_learner = meta.is_learner,
+      .is_observer = is_observer,
       .committed_log_index = meta.last_flushed_log_index,
       .dirty_log_index = meta.last_dirty_log_index,
       .match_index = meta.match_index,
@@ -3663,7 +3784,7 @@ follower_metrics build_follower_metrics(
       .is_live = is_live,
       .under_replicated = (meta.is_recovering || !is_live)
                           && meta.match_index < lstats.dirty_offset
-                          && !meta.is_learner};
+                          && !meta.is_learner && !is_observer};
 }
 
 std::vector<follower_metrics> consensus::get_follower_metrics() const {
@@ -3674,13 +3795,15 @@ std::vector<follower_metrics> consensus::get_follower_metrics() const {
     std::vector<follower_metrics> ret;
     ret.reserve(_fstats.size());
     const auto offsets = _log->offsets();
+    const auto& cfg = _configuration_manager.get_latest();
     for (const auto& f : _fstats) {
         ret.push_back(build_follower_metrics(
           f.first.id(),
           offsets,
           std::chrono::duration_cast<std::chrono::milliseconds>(
             _jit.base_duration()),
-          f.second));
+          f.second,
+          cfg.is_observer(f.first)));
     }
 
     return ret;
@@ -3703,7 +3826,8 @@ consensus::get_follower_metrics(model::node_id id) const {
       _log->offsets(),
       std::chrono::duration_cast<std::chrono::milliseconds>(
         _jit.base_duration()),
-      it->second);
+      it->second,
+      _configuration_manager.get_latest().is_observer(it->first));
 }
 
 size_t consensus::get_follower_count() const {
@@ -3721,13 +3845,15 @@ std::optional<uint8_t> consensus::get_under_replicated() const {
     }
 
     uint8_t count = 0;
+    const auto& cfg = _configuration_manager.get_latest();
     for (const auto& f : _fstats) {
         auto f_metrics = build_follower_metrics(
           f.first.id(),
           _log->offsets(),
           std::chrono::duration_cast<std::chrono::milliseconds>(
             _jit.base_duration()),
-          f.second);
+          f.second,
+          cfg.is_observer(f.first));
         if (f_metrics.under_replicated) {
             count += 1;
         }
@@ -3786,6 +3912,37 @@ reply_result consensus::lightweight_heartbeat(
     _hbeat = clock_type::now();
     return reply_result::success;
 }
+
+bool consensus::hibernate(ss::lw_shared_ptr<lw_hibernation_session> session) {
+    if (
+      _vstate != vote_state::follower || !_leader_id.has_value()
+      || _bg.is_closed()) {
+        return false;
+    }
+    if (_hibernation && _hibernation != session) {
+        _hbeat = std::max(_hbeat, _hibernation->last_heartbeat);
+    }
+    _hibernation = std::move(session);
+    return true;
+}
+
+void consensus::leave_hibernation(const lw_hibernation_session& session) {
+    if (_hibernation.get() != &session) {
+        return;
+    }
+    // the last heartbeat of the session was the last heartbeat of the group
+    _hbeat = std::max(_hbeat, session.last_heartbeat);
+    _hibernation = nullptr;
+}
+
+void consensus::wake_up() {
+    if (!_hibernation) {
+        return;
+    }
+    vlog(_ctxlog.trace, "leaving hibernation");
+    _hibernation->woken.push_back(_group);
+    leave_hibernation(*_hibernation);
+}
 ss::future<full_heartbeat_reply> consensus::full_heartbeat(
   group_id group,
   model::node_id source_node,
@@ -32,10 +32,12 @@
 #include "raft/prevote_stm.h"
 #include "raft/probe.h"
 #include "raft/recovery_memory_quota.h"
+#include "raft/recovery_batcher.h"
 #include "raft/recovery_scheduler.h"
 #include "raft/replicate_batcher.h"
 #include "raft/state_machine_manager.h"
 #include "raft/timeout_jitter.h"
+#include "raft/vote_batcher.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 #include "storage/fwd.h"
@@ -107,6 +109,8 @@ public:
       std::optional<std::reference_wrapper<coordinated_recovery_throttle>>,
       recovery_memory_quota&,
       recovery_scheduler&,
+      recovery_batcher&,
+      vote_batcher&,
       features::feature_table&,
       std::optional<voter_priority> = std::nullopt,
       keep_snapshotted_log = keep_snapshotted_log::no);
@@ -199,12 +203,22 @@ public:
     ss::future<result<model::offset>> linearizable_barrier();
 
     vnode self() const { return _self; }
+    /// True if this replica is an observer: it replicates the log to serve
+    /// reads but neither votes nor counts towards the majority
+    bool is_observer() const;
+    /// True if the current configuration has observers
+    bool has_observers() const;
     protocol_metadata meta() const;
     raft::group_id group() const { return _group; }
     model::term_id term() const { return _term; }
     group_configuration config() const;
     const model::ntp& ntp() const { return _log->config().ntp(); }
-    clock_type::time_point last_heartbeat() const { return _hbeat; };
+    clock_type::time_point last_heartbeat() const {
+        if (_hibernation) {
+            return std::max(_hbeat, _hibernation->last_heartbeat);
+        }
+        return _hbeat;
+    };
     clock_type::time_point became_leader_at() const {
         return _became_leader_at;
     };
@@ -498,6 +512,19 @@ public:
     reply_result lightweight_heartbeat(
       model::node_id source_node, model::node_id target_node);
 
+    /**
+     * Hibernate the follower on the lightweight heartbeats \p session of its
+     * leader, right after a successful lightweight heartbeat of the session.
+     * The follower then takes the heartbeats of the session as its own until
+     * it leaves hibernation. Returns false if the follower can't hibernate,
+     * i.e. it isn't the follower of a known leader.
+     */
+    bool hibernate(ss::lw_shared_ptr<lw_hibernation_session> session);
+    /// Leave hibernation on \p session, e.g. when the leader no longer
+    /// heartbeats the group in the session.
+    void leave_hibernation(const lw_hibernation_session& session);
+    bool is_hibernating() const { return _hibernation != nullptr; }
+
     ss::future<full_heartbeat_reply> full_heartbeat(
       group_id group,
       model::node_id source_node,
@@ -532,6 +559,8 @@ private:
     // all these private functions assume that we are under exclusive operations
     // via the _op_sem
     void do_step_down(std::string_view);
+    // leave hibernation because of a change of the raft state
+    void wake_up();
     ss::future<vote_reply> do_vote(vote_request);
     ss::future<append_entries_reply>
     do_append_entries(append_entries_request&&);
@@ -639,6 +668,11 @@ private:
 
     ss::future<> maybe_commit_configuration(ssx::semaphore_units);
     void maybe_promote_to_voter(vnode);
+    /// Demotes a voter to observer, or turns an observer back into a learner,
+    /// when the number of observers differs from the one of the topic
+    void maybe_update_observers();
+    std::optional<size_t> observers_target(const group_configuration&) const;
+    void update_observers(group_configuration&, size_t target) const;
 
     ss::future<model::record_batch_reader>
       do_make_reader(storage::log_reader_config);
@@ -800,9 +834,12 @@ private:
     vnode _voted_for;
     std::optional<vnode> _leader_id;
     bool _transferring_leadership{false};
+    bool _updating_observers{false};
 
     /// useful for when we are not the leader
     clock_type::time_point _hbeat = clock_type::now();
+    /// the lightweight heartbeats session the follower hibernates on
+    ss::lw_shared_ptr<lw_hibernation_session> _hibernation;
     clock_type::time_point _became_leader_at = clock_type::now();
     clock_type::time_point _instantiated_at = clock_type::now();
 
@@ -845,6 +882,8 @@ private:
       _recovery_throttle;
     recovery_memory_quota& _recovery_mem_quota;
     recovery_scheduler& _recovery_scheduler;
+    recovery_batcher& _recovery_batcher;
+    vote_batcher& _vote_batcher;
     features::feature_table& _features;
     storage::simple_snapshot_manager _snapshot_mgr;
     uint64_t _snapshot_size{0};
@@ -37,6 +37,15 @@ public:
           bool use_all_serde_encoding)
           = 0;
 
+        virtual ss::future<result<append_entries_batch_reply>>
+        append_entries_batch(
+          model::node_id, append_entries_batch_request&&, rpc::client_opts)
+          = 0;
+
+        virtual ss::future<result<vote_batch_reply>>
+        vote_batch(model::node_id, vote_batch_request&&, rpc::client_opts)
+          = 0;
+
         virtual ss::future<result<heartbeat_reply>>
         heartbeat(model::node_id, heartbeat_request&&, rpc::client_opts) = 0;
         virtual ss::future<result<heartbeat_reply_v2>>
@@ -80,6 +89,21 @@ public:
           target_node, std::move(r), std::move(opts), use_all_serde_encoding);
     }
 
+    ss::future<result<append_entries_batch_reply>> append_entries_batch(
+      model::node_id target_node,
+      append_entries_batch_request&& r,
+      rpc::client_opts opts) {
+        return _impl->append_entries_batch(
+          target_node, std::move(r), std::move(opts));
+    }
+
+    ss::future<result<vote_batch_reply>> vote_batch(
+      model::node_id target_node,
+      vote_batch_request&& r,
+      rpc::client_opts opts) {
+        return _impl->vote_batch(target_node, std::move(r), std::move(opts));
+    }
+
     ss::future<result<heartbeat_reply>> heartbeat(
       model::node_id target_node,
       heartbeat_request&& r,
@@ -26,4 +26,17 @@ ss::future<ssx::semaphore_units> follower_queue::get_append_entries_unit() {
     co_return co_await ss::get_units(*_sem, 1);
 }
 
+void follower_queue::set_max_concurrent_append_entries(uint32_t max) {
+    max = std::max<uint32_t>(max, 1);
+    if (max > _max_concurrent_append_entries) {
+        _sem->signal(max - _max_concurrent_append_entries);
+    } else if (max < _max_concurrent_append_entries) {
+        // units held by in flight requests are returned to the semaphore
+        // when they finish, consuming the difference may temporarily make
+        // the available units negative
+        _sem->consume(_max_concurrent_append_entries - max);
+    }
+    _max_concurrent_append_entries = max;
+}
+
 } // namespace raft
@@ -28,6 +28,14 @@ public:
 
     ss::future<ssx::semaphore_units> get_append_entries_unit();
 
+    /**
+     * Resize the window of in flight requests. Shrinking the window doesn't
+     * affect the requests which are already in flight, new requests are
+     * dispatched once the number of in flight requests drops below the new
+     * limit.
+     */
+    void set_max_concurrent_append_entries(uint32_t);
+
     ss::future<> stop();
 
     bool is_idle() const {
@@ -37,12 +45,13 @@ public:
 
 private:
     /**
+     * The leader pipelines append entries requests to the follower, up to
+     * this number of requests may be in flight at the same time. On links
+     * with high round trip time the window bounds the throughput of a single
+     * partition, hence it can be resized at runtime.
+     *
      * TODO: consider using queue depth control to automatically adjust number
-     * of concurrent requests per follower. In general it should be fine to make
-     * this static since scaling throughput is usually achieved by increasing
-     * partition count. We may need to increase number of concurrent requests
-     * per partition to increase throughput when partition number is low and we
-     * are fine with increasing latency.
+     * of concurrent requests per follower.
      *
      * Things to consider:
      * - per shard concurrency controll
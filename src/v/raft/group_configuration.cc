@@ -251,6 +251,11 @@ std::optional<vnode> group_nodes::find(model::node_id id) const {
     return l_it != learners.cend() ? std::make_optional(*l_it) : std::nullopt;
 }
 
+bool group_nodes::is_observer(const vnode& id) const {
+    return std::find(observers.cbegin(), observers.cend(), id)
+           != observers.cend();
+}
+
 group_configuration::group_configuration(
   std::vector<model::broker> brokers, model::revision_id revision)
   : _version(v_4)
@@ -335,6 +340,10 @@ bool group_configuration::is_voter(vnode id) const {
     return old_it != _old->voters.cend();
 }
 
+bool group_configuration::is_observer(vnode id) const {
+    return _current.is_observer(id);
+}
+
 bool group_configuration::is_allowed_to_request_votes(vnode id) const {
     // either current voter
     auto it = std::find(_current.voters.cbegin(), _current.voters.cend(), id);
@@ -469,7 +478,8 @@ void group_configuration::add(
       get_state() == configuration_state::simple,
       "can not add node to configuration when update is in progress - {}",
       *this);
-
+    // the change is finished once all learners are promoted
+    _current.observers.clear();
     make_change_strategy()->add(node, rev, learner_start_offset);
 }
 
@@ -478,6 +488,7 @@ void group_configuration::remove(vnode node, model::revision_id rev) {
       get_state() == configuration_state::simple,
       "can not remove node from configuration when update is in progress - {}",
       *this);
+    _current.observers.clear();
     make_change_strategy()->remove(node, rev);
 }
 
@@ -489,10 +500,48 @@ void group_configuration::replace(
       get_state() == configuration_state::simple,
       "can not replace configuration when update is in progress - {}",
       *this);
+    if (!_current.observers.empty()) {
+        const bool are_equal
+          = _current.learners.size() == _current.observers.size()
+            && _current.voters.size() + _current.observers.size()
+                 == nodes.size()
+            && std::all_of(nodes.begin(), nodes.end(), [this](const vnode& vn) {
+                   return _current.contains(vn);
+               });
+        if (are_equal) {
+            _revision = rev;
+            return;
+        }
+        // the observers which are kept are added back as learners, like the
+        // new replicas
+        std::erase_if(_current.learners, [this](const vnode& vn) {
+            return _current.is_observer(vn);
+        });
+        _current.observers.clear();
+    }
     make_change_strategy()->replace(
       std::move(nodes), rev, learner_start_offset);
 }
 
+void group_configuration::demote_to_observer(vnode id) {
+    vassert(
+      get_state() == configuration_state::simple,
+      "can not demote voter to observer when update is in progress - {}",
+      *this);
+    auto it = std::find(_current.voters.cbegin(), _current.voters.cend(), id);
+    // do nothing
+    if (it == _current.voters.cend()) {
+        return;
+    }
+    _current.voters.erase(it);
+    _current.learners.push_back(id);
+    _current.observers.push_back(id);
+}
+
+void group_configuration::revert_observer(vnode id) {
+    std::erase(_current.observers, id);
+}
+
 void group_configuration::discard_old_config() {
     vassert(
       get_state() == configuration_state::joint,
@@ -1247,7 +1296,12 @@ std::ostream& operator<<(std::ostream& o, const group_configuration& c) {
 }
 
 std::ostream& operator<<(std::ostream& o, const group_nodes& n) {
-    fmt::print(o, "{{voters: {}, learners: {}}}", n.voters, n.learners);
+    fmt::print(
+      o,
+      "{{voters: {}, learners: {}, observers: {}}}",
+      n.voters,
+      n.learners,
+      n.observers);
     return o;
 }
 
@@ -90,18 +90,27 @@ enum class configuration_state : uint8_t { simple, transitional, joint };
 std::ostream& operator<<(std::ostream& o, configuration_state t);
 
 struct group_nodes
-  : serde::envelope<group_nodes, serde::version<0>, serde::compat_version<0>> {
+  : serde::envelope<group_nodes, serde::version<1>, serde::compat_version<0>> {
     std::vector<vnode> voters;
     std::vector<vnode> learners;
+    /**
+     * Learners which are never promoted to voters. Observers replicate the
+     * log to serve reads but neither vote nor count towards the majority.
+     * Every observer is also listed in learners, so that the nodes which do
+     * not know about observers treat them as learners.
+     */
+    std::vector<vnode> observers;
 
     bool contains(const vnode&) const;
 
     std::optional<vnode> find(model::node_id) const;
 
+    bool is_observer(const vnode&) const;
+
     friend std::ostream& operator<<(std::ostream&, const group_nodes&);
     friend bool operator==(const group_nodes&, const group_nodes&) = default;
 
-    auto serde_fields() { return std::tie(voters, learners); }
+    auto serde_fields() { return std::tie(voters, learners, observers); }
 };
 
 struct configuration_update
@@ -212,6 +221,11 @@ public:
      */
     bool is_voter(vnode) const;
 
+    /**
+     * Check if node is an observer of the current configuration
+     */
+    bool is_observer(vnode) const;
+
     /**
      * Check if node with given id is allowed to request for votes
      */
@@ -231,11 +245,28 @@ public:
      */
     void update(model::broker);
 
+    /**
+     * A configuration change turns the observers back into learners, which
+     * are promoted to voters like the replicas being added. The leader makes
+     * them observers again once the change is finished.
+     */
     void add(vnode, model::revision_id, std::optional<model::offset>);
     void remove(vnode, model::revision_id);
     void replace(
       std::vector<vnode>, model::revision_id, std::optional<model::offset>);
 
+    /**
+     * Turns a voter into an observer. Like a promotion this changes the
+     * majority by a single node and does not require entering joint
+     * consensus, only one node may change per configuration.
+     */
+    void demote_to_observer(vnode);
+    /**
+     * Turns an observer back into a learner, which is promoted to voter once
+     * it caught up with the leader
+     */
+    void revert_observer(vnode);
+
     /**
      * Discards the old configuration, after this operation joint configuration
      * become simple
@@ -15,9 +15,11 @@
 #include "model/metadata.h"
 #include "prometheus/prometheus_sanitize.h"
 #include "raft/group_configuration.h"
+#include "raft/replicate_latency_probe.h"
 #include "raft/rpc_client_protocol.h"
 #include "resource_mgmt/io_priority.h"
 
+#include <seastar/core/metrics.hh>
 #include <seastar/core/scheduling.hh>
 
 #include <optional>
@@ -50,6 +52,10 @@ group_manager::group_manager(
   , _recovery_scheduler(
       _configuration.recovery_concurrency_per_shard,
       _configuration.heartbeat_interval)
+  , _recovery_batcher(
+      _client, feature_table.local(), _configuration.recovery_batch_max_bytes)
+  , _vote_batcher(
+      _client, feature_table.local(), _configuration.enable_vote_batching)
   , _feature_table(feature_table.local())
   , _flush_timer_jitter(_configuration.flush_timer_interval_ms)
   , _is_ready(false) {
@@ -77,6 +83,8 @@ ss::future<> group_manager::stop() {
     _flush_timer.cancel();
 
     f = f.then([this] { return _recovery_scheduler.stop(); });
+    f = f.then([this] { return _recovery_batcher.stop(); });
+    f = f.then([this] { return _vote_batcher.stop(); });
 
     if (!_heartbeats.is_stopped()) {
         // In normal redpanda process shutdown, heartbeats would
@@ -129,6 +137,8 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
                                        : std::nullopt,
       _recovery_mem_quota,
       _recovery_scheduler,
+      _recovery_batcher,
+      _vote_batcher,
       _feature_table,
       _is_ready ? std::nullopt : std::make_optional(min_voter_priority),
       keep_snapshotted_log);
@@ -221,6 +231,45 @@ void group_manager::setup_metrics() {
         "group_count",
         [this] { return _groups.size(); },
         sm::description("Number of raft groups"))});
+
+    std::vector<sm::label_instance> labels{
+      sm::label("latency_metric")("microseconds")};
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("raft:replicate"),
+      {
+        sm::make_histogram(
+          "batcher_queue_latency_us",
+          sm::description("Time replicate requests wait in the batcher "
+                          "before being flushed"),
+          labels,
+          [] {
+              return replicate_latency()
+                .batcher_queue()
+                .internal_histogram_logform();
+          }),
+        sm::make_histogram(
+          "leader_append_latency_us",
+          sm::description("Latency of appending flushed batches to the leader "
+                          "log and dispatching them to the followers"),
+          labels,
+          [] {
+              return replicate_latency()
+                .leader_append()
+                .internal_histogram_logform();
+          }),
+        sm::make_histogram(
+          "quorum_ack_latency_us",
+          sm::description("Time from the leader append until the majority of "
+                          "replicas acknowledged the batches"),
+          labels,
+          [] {
+              return replicate_latency()
+                .quorum_ack()
+                .internal_histogram_logform();
+          }),
+      },
+      {},
+      {sm::shard_label});
 }
 
 ss::future<> group_manager::flush_groups() {
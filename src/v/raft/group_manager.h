@@ -15,9 +15,11 @@
 #include "model/metadata.h"
 #include "raft/consensus_client_protocol.h"
 #include "raft/heartbeat_manager.h"
+#include "raft/recovery_batcher.h"
 #include "raft/recovery_memory_quota.h"
 #include "raft/recovery_scheduler.h"
 #include "raft/timeout_jitter.h"
+#include "raft/vote_batcher.h"
 #include "raft/types.h"
 #include "rpc/fwd.h"
 #include "storage/fwd.h"
@@ -49,6 +51,8 @@ public:
         config::binding<std::chrono::milliseconds> election_timeout_ms;
         config::binding<std::optional<size_t>> replica_max_not_flushed_bytes;
         config::binding<std::chrono::milliseconds> flush_timer_interval_ms;
+        config::binding<std::optional<size_t>> recovery_batch_max_bytes;
+        config::binding<bool> enable_vote_batching;
     };
     using config_provider_fn = ss::noncopyable_function<configuration()>;
 
@@ -118,6 +122,8 @@ private:
     coordinated_recovery_throttle& _recovery_throttle;
     recovery_memory_quota _recovery_mem_quota;
     recovery_scheduler _recovery_scheduler;
+    recovery_batcher _recovery_batcher;
+    vote_batcher _vote_batcher;
     features::feature_table& _feature_table;
     ss::timer<clock_type> _flush_timer;
     timeout_jitter _flush_timer_jitter;
@@ -20,6 +20,7 @@
 #include "raft/group_configuration.h"
 #include "raft/raftgen_service.h"
 #include "raft/types.h"
+#include "random/generators.h"
 #include "rpc/errc.h"
 #include "rpc/reconnect_transport.h"
 #include "rpc/types.h"
@@ -36,11 +37,23 @@
 #include <bits/stdint-uintn.h>
 #include <boost/range/iterator_range.hpp>
 
+#include <limits>
+
 namespace raft {
 ss::logger hbeatlog{"r/heartbeat"};
 using consensus_ptr = heartbeat_manager::consensus_ptr;
 using consensus_set = heartbeat_manager::consensus_set;
 
+namespace {
+rpc::client_opts heartbeat_opts(rpc::timeout_spec timeout) {
+    auto opts = rpc::client_opts(timeout, rpc::compression_type::zstd, 512);
+    // heartbeats must not queue behind large append entries requests sharing
+    // the connection, a late heartbeat may trigger an election
+    opts.priority = rpc::request_priority::high;
+    return opts;
+}
+} // namespace
+
 heartbeat_manager::follower_request_meta::follower_request_meta(
   consensus_ptr ptr,
   follower_req_seq seq,
@@ -195,6 +208,11 @@ heartbeat_manager::requests_for_range_v2() {
         }
     }
 
+    const bool lw_deltas = lw_heartbeat_deltas_enabled();
+    if (!lw_deltas) {
+        _lw_sessions.clear();
+    }
+
     std::vector<heartbeat_manager::node_heartbeat_v2> reqs;
     reqs.reserve(pending_beats.size());
     for (auto& p : pending_beats) {
@@ -205,17 +223,83 @@ heartbeat_manager::requests_for_range_v2() {
           meta_map;
         requests.reserve(p.second.size());
         heartbeat_request_v2 req(_self, p.first);
+        heartbeat_request_v2::lw_groups_t lw_groups;
         for (auto& [hb, follower_meta] : p.second) {
-            meta_map.emplace(hb.group, std::move(follower_meta));
+            auto [_, inserted] = meta_map.emplace(
+              hb.group, std::move(follower_meta));
+            if (lw_deltas && !hb.data) {
+                // groups are visited in order of their ids
+                if (inserted) {
+                    lw_groups.push_back(hb.group);
+                }
+                continue;
+            }
             req.add(hb);
         }
-        reqs.emplace_back(p.first, std::move(req), std::move(meta_map));
+        uint64_t lw_seq = 0;
+        if (lw_deltas) {
+            lw_seq = set_lw_heartbeats(p.first, req, std::move(lw_groups));
+        }
+        auto& node_hb = reqs.emplace_back(
+          p.first, std::move(req), std::move(meta_map));
+        node_hb.lw_seq = lw_seq;
     }
 
     return heartbeat_requests_v2{
       .requests{std::move(reqs)}, .reconnect_nodes{reconnect_nodes}};
 }
 
+bool heartbeat_manager::lw_heartbeat_deltas_enabled() const {
+    return _enable_lw_heartbeat()
+           && _feature_table.is_active(
+             features::feature::lightweight_heartbeat_deltas);
+}
+
+uint64_t heartbeat_manager::set_lw_heartbeats(
+  model::node_id target,
+  heartbeat_request_v2& req,
+  heartbeat_request_v2::lw_groups_t groups) {
+    auto [it, inserted] = _lw_sessions.try_emplace(target);
+    auto& session = it->second;
+    if (inserted) {
+        session.id = random_generators::get_int<uint64_t>(
+          1, std::numeric_limits<uint64_t>::max());
+    }
+    const auto seq = session.next_seq++;
+    req.set_lw_heartbeats(
+      session.id, seq, session.acked_seq, session.acked_groups, groups);
+    session.pending_seq = seq;
+    session.pending_groups = std::move(groups);
+    return seq;
+}
+
+void heartbeat_manager::process_lw_ack(
+  model::node_id target, uint64_t seq, uint64_t acked) {
+    auto it = _lw_sessions.find(target);
+    if (it == _lw_sessions.end()) {
+        return;
+    }
+    auto& session = it->second;
+    if (acked == 0) {
+        // the node doesn't know the base set, start over with the full set
+        vlog(
+          hbeatlog.debug,
+          "Lightweight heartbeats delta {} not resolved by node {}",
+          seq,
+          target);
+        session.acked_seq = 0;
+        session.acked_groups = {};
+        return;
+    }
+    // replies to older requests are stale, the node already moved on to the
+    // set of the latest request
+    if (acked == seq && seq == session.pending_seq) {
+        session.acked_seq = seq;
+        session.acked_groups = std::move(session.pending_groups);
+        session.pending_seq = 0;
+    }
+}
+
 bool heartbeat_manager::needs_full_heartbeat(
   const follower_index_metadata& f_meta,
   const protocol_metadata& p_meta,
@@ -327,10 +411,8 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat&& r) {
                .heartbeat(
                  r.target,
                  std::move(r.request),
-                 rpc::client_opts(
-                   rpc::timeout_spec::from_now(_heartbeat_timeout()),
-                   rpc::compression_type::zstd,
-                   512))
+                 heartbeat_opts(
+                   rpc::timeout_spec::from_now(_heartbeat_timeout())))
                .then([node = r.target,
                       groups = std::move(r.meta_map),
                       gate = std::move(gate),
@@ -365,17 +447,16 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat_v2 r) {
                .heartbeat_v2(
                  r.target,
                  std::move(r.request),
-                 rpc::client_opts(
-                   rpc::timeout_spec::from_now(_heartbeat_timeout()),
-                   rpc::compression_type::zstd,
-                   512))
+                 heartbeat_opts(
+                   rpc::timeout_spec::from_now(_heartbeat_timeout())))
                .then([node = r.target,
                       groups = std::move(r.meta_map),
+                      lw_seq = r.lw_seq,
                       gate = std::move(gate),
                       this](result<heartbeat_reply_v2> ret) mutable {
                    // this will happen after RPC client will return and resume
                    // sending heartbeats to follower
-                   process_reply(node, groups, std::move(ret));
+                   process_reply(node, groups, lw_seq, std::move(ret));
                });
     // fail fast to make sure that not lagging nodes will be able to receive
     // hearteats
@@ -394,6 +475,7 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat_v2 r) {
 void heartbeat_manager::process_reply(
   model::node_id n,
   const absl::node_hash_map<raft::group_id, follower_request_meta>& groups,
+  uint64_t lw_seq,
   result<heartbeat_reply_v2> r) {
     if (!r) {
         vlog(
@@ -439,8 +521,24 @@ void heartbeat_manager::process_reply(
         return;
     }
     auto& reply = r.value();
-    reply.for_each_lw_reply([this, n, target = reply.target(), &groups](
+    // successful replies of an acknowledged delta are implicit, only the
+    // lightweight heartbeats which didn't succeed are listed
+    const bool implicit_lw_success = lw_seq != 0
+                                     && reply.lw_acked_seq() == lw_seq;
+    absl::flat_hash_set<group_id> explicit_lw_replies;
+    if (lw_seq != 0) {
+        process_lw_ack(n, lw_seq, reply.lw_acked_seq());
+    }
+    reply.for_each_lw_reply([this,
+                             n,
+                             target = reply.target(),
+                             &groups,
+                             implicit_lw_success,
+                             &explicit_lw_replies](
                               group_id group, reply_result result) {
+        if (implicit_lw_success) {
+            explicit_lw_replies.insert(group);
+        }
         auto it = _consensus_groups.find(group);
         if (it == _consensus_groups.end()) {
             vlog(
@@ -505,6 +603,22 @@ void heartbeat_manager::process_reply(
           meta_it->second.follower_vnode, true);
     });
 
+    if (implicit_lw_success && reply.target() == _self) {
+        for (const auto& [group, req_meta] : groups) {
+            // full heartbeats always carry a follower request sequence
+            if (
+              req_meta.seq != follower_req_seq{}
+              || explicit_lw_replies.contains(group)) {
+                continue;
+            }
+            auto it = _consensus_groups.find(group);
+            if (it == _consensus_groups.end()) {
+                continue;
+            }
+            (*it)->update_heartbeat_status(req_meta.follower_vnode, true);
+        }
+    }
+
     for (auto& m : reply.full_replies()) {
         auto it = _consensus_groups.find(m.group);
         if (it == _consensus_groups.end()) {
@@ -17,6 +17,7 @@
 #include "raft/consensus.h"
 #include "raft/consensus_client_protocol.h"
 #include "raft/group_configuration.h"
+#include "raft/heartbeats.h"
 #include "raft/types.h"
 #include "utils/mutex.h"
 
@@ -24,6 +25,7 @@
 #include <seastar/util/log.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
 #include <boost/container/flat_set.hpp>
 
@@ -135,6 +137,9 @@ public:
         // each raft group has its own follower metadata hence we need map to
         // track a sequence per group
         absl::node_hash_map<raft::group_id, follower_request_meta> meta_map;
+        // sequence of the delta encoded lightweight heartbeats, zero if the
+        // request lists all of them
+        uint64_t lw_seq{0};
     };
 
     heartbeat_manager(
@@ -205,8 +210,39 @@ private:
     void process_reply(
       model::node_id n,
       const absl::node_hash_map<raft::group_id, follower_request_meta>& groups,
+      uint64_t lw_seq,
       result<heartbeat_reply_v2> result);
 
+    /**
+     * Sender side of the delta encoded lightweight heartbeats sent to a
+     * single node. The node keeps the set of groups of the last request it
+     * acknowledged, every following request carries only the groups which
+     * joined or left that set. Idle groups, which make the bulk of the
+     * lightweight heartbeats, are not serialized at all and successful
+     * replies to them are implicit.
+     */
+    struct lw_heartbeat_session {
+        uint64_t id{0};
+        uint64_t next_seq{1};
+        // set acknowledged by the node, base of the next delta
+        uint64_t acked_seq{0};
+        heartbeat_request_v2::lw_groups_t acked_groups;
+        // set sent in the last request which wasn't acknowledged yet
+        uint64_t pending_seq{0};
+        heartbeat_request_v2::lw_groups_t pending_groups;
+    };
+
+    bool lw_heartbeat_deltas_enabled() const;
+
+    /// Encode \p groups as a delta of the set acknowledged by \p target and
+    /// return the sequence of the request
+    uint64_t set_lw_heartbeats(
+      model::node_id target,
+      heartbeat_request_v2& req,
+      heartbeat_request_v2::lw_groups_t groups);
+
+    void process_lw_ack(model::node_id target, uint64_t seq, uint64_t acked);
+
     consensus_ptr validate_heartbeat_reply(
       model::node_id reply_source_node,
       model::node_id target_node,
@@ -233,5 +269,6 @@ private:
     model::node_id _self;
     config::binding<bool> _enable_lw_heartbeat;
     features::feature_table& _feature_table;
+    absl::flat_hash_map<model::node_id, lw_heartbeat_session> _lw_sessions;
 };
 } // namespace raft
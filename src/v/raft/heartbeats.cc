@@ -28,6 +28,68 @@ void heartbeat_request_v2::add(const group_heartbeat& hb) {
     }
 }
 
+void heartbeat_request_v2::set_lw_heartbeats(
+  uint64_t session,
+  uint64_t seq,
+  uint64_t base_seq,
+  const lw_groups_t& base,
+  const lw_groups_t& current) {
+    _lw_session = session;
+    _lw_seq = seq;
+    _lw_base_seq = base_seq;
+    auto b_it = base.begin();
+    auto c_it = current.begin();
+    while (b_it != base.end() || c_it != current.end()) {
+        if (c_it == current.end() || (b_it != base.end() && *b_it < *c_it)) {
+            _lw_removed.add(*b_it++);
+        } else if (b_it == base.end() || *c_it < *b_it) {
+            _lw_heartbeats.add(*c_it++);
+        } else {
+            ++b_it;
+            ++c_it;
+        }
+    }
+}
+
+std::optional<heartbeat_request_v2::lw_groups_t>
+heartbeat_request_v2::apply_lw_delta(const lw_groups_t& base) const {
+    lw_groups_t added;
+    lw_groups_t removed;
+    for_each_column(
+      [&added](int64_t g) { added.push_back(group_id(g)); }, _lw_heartbeats);
+    for_each_column(
+      [&removed](int64_t g) { removed.push_back(group_id(g)); }, _lw_removed);
+
+    lw_groups_t ret;
+    auto a_it = added.begin();
+    auto r_it = removed.begin();
+    for (auto g : base) {
+        for (; a_it != added.end() && *a_it < g; ++a_it) {
+            ret.push_back(*a_it);
+        }
+        if (a_it != added.end() && *a_it == g) {
+            // the group is already part of the base set
+            return std::nullopt;
+        }
+        if (r_it != removed.end() && *r_it < g) {
+            // the group is not part of the base set
+            return std::nullopt;
+        }
+        if (r_it != removed.end() && *r_it == g) {
+            ++r_it;
+            continue;
+        }
+        ret.push_back(g);
+    }
+    if (r_it != removed.end()) {
+        return std::nullopt;
+    }
+    for (; a_it != added.end(); ++a_it) {
+        ret.push_back(*a_it);
+    }
+    return ret;
+}
+
 heartbeat_request_v2 heartbeat_request_v2::copy() const {
     heartbeat_request_v2 ret;
     ret._source_node = _source_node;
@@ -40,6 +102,10 @@ heartbeat_request_v2 heartbeat_request_v2::copy() const {
       _full_heartbeats.end(),
       std::back_inserter(ret._full_heartbeats));
     ret._lw_cnt = _lw_cnt;
+    ret._lw_session = _lw_session;
+    ret._lw_seq = _lw_seq;
+    ret._lw_base_seq = _lw_base_seq;
+    ret._lw_removed = _lw_removed.copy();
 
     return ret;
 }
@@ -54,6 +120,11 @@ ss::future<> heartbeat_request_v2::serde_async_write(iobuf& out) {
     co_await write_async(out, std::move(_lw_heartbeats));
     co_await ss::coroutine::maybe_yield();
     co_await write_async(out, std::move(_full_heartbeats));
+
+    write(out, _lw_session);
+    write(out, _lw_seq);
+    write(out, _lw_base_seq);
+    co_await write_async(out, std::move(_lw_removed));
 }
 
 ss::future<> heartbeat_request_v2::serde_async_read(
@@ -73,6 +144,14 @@ ss::future<> heartbeat_request_v2::serde_async_read(
 
     _full_heartbeats = co_await read_async_nested<full_heartbeats_t>(
       in, hdr._bytes_left_limit);
+
+    if (hdr._version >= 1) {
+        _lw_session = read_nested<uint64_t>(in, hdr._bytes_left_limit);
+        _lw_seq = read_nested<uint64_t>(in, hdr._bytes_left_limit);
+        _lw_base_seq = read_nested<uint64_t>(in, hdr._bytes_left_limit);
+        _lw_removed = co_await read_async_nested<lw_column_t>(
+          in, hdr._bytes_left_limit);
+    }
 }
 
 heartbeat_reply_v2 heartbeat_reply_v2::copy() const {
@@ -86,6 +165,7 @@ heartbeat_reply_v2 heartbeat_reply_v2::copy() const {
       _full_replies.begin(),
       _full_replies.end(),
       std::back_inserter(ret._full_replies));
+    ret._lw_acked_seq = _lw_acked_seq;
 
     return ret;
 }
@@ -115,6 +195,8 @@ ss::future<> heartbeat_reply_v2::serde_async_write(iobuf& out) {
     co_await write_async(out, std::move(_results));
     co_await ss::coroutine::maybe_yield();
     co_await write_async(out, std::move(_full_replies));
+
+    write(out, _lw_acked_seq);
 }
 
 ss::future<> heartbeat_reply_v2::serde_async_read(
@@ -137,5 +219,9 @@ ss::future<> heartbeat_reply_v2::serde_async_read(
     _full_replies
       = co_await read_async_nested<ss::chunked_fifo<full_heartbeat_reply>>(
         in, hdr._bytes_left_limit);
+
+    if (hdr._version >= 1) {
+        _lw_acked_seq = read_nested<uint64_t>(in, hdr._bytes_left_limit);
+    }
 }
 } // namespace raft
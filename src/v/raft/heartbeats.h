@@ -17,12 +17,15 @@
 #include "serde/envelope.h"
 #include "serde/serde.h"
 #include "utils/delta_for.h"
+#include "utils/fragmented_vector.h"
 
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/shared_ptr.hh>
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 
 namespace raft {
 
@@ -315,7 +318,7 @@ struct full_heartbeat {
 class heartbeat_request_v2
   : public serde::envelope<
       heartbeat_request_v2,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
 public:
     using rpc_adl_exempt = std::true_type;
@@ -324,6 +327,8 @@ public:
       = deltafor_column<int64_t, ::details::delta_delta<int64_t>, int64_t>;
 
     using full_heartbeats_t = ss::chunked_fifo<full_heartbeat>;
+    /// Sorted set of groups receiving lightweight heartbeats
+    using lw_groups_t = fragmented_vector<raft::group_id>;
 
     heartbeat_request_v2() noexcept = default;
 
@@ -333,12 +338,44 @@ public:
 
     void add(const group_heartbeat&);
 
+    /**
+     * Encode the lightweight heartbeats of \p current as a delta of the set
+     * \p base which the receiver acknowledged under \p base_seq. Only the
+     * groups which joined or left the set are serialized. With a zero
+     * \p base_seq the base set is empty and all groups are encoded.
+     *
+     * Both sets must be sorted by group id.
+     */
+    void set_lw_heartbeats(
+      uint64_t session,
+      uint64_t seq,
+      uint64_t base_seq,
+      const lw_groups_t& base,
+      const lw_groups_t& current);
+
+    /**
+     * Apply the delta carried by the request to the \p base set. Returns
+     * nullopt if the delta doesn't match the base, i.e. it removes a group
+     * which isn't part of the set or adds one which already is.
+     */
+    std::optional<lw_groups_t> apply_lw_delta(const lw_groups_t& base) const;
+
+    /// Lightweight heartbeats are delta encoded if the session is set
+    bool has_lw_session() const { return _lw_session != 0; }
+    uint64_t lw_session() const { return _lw_session; }
+    uint64_t lw_seq() const { return _lw_seq; }
+    uint64_t lw_base_seq() const { return _lw_base_seq; }
+
     friend bool operator==(
       const heartbeat_request_v2& lhs, const heartbeat_request_v2& rhs) {
         return lhs._source_node == rhs._source_node
                && lhs._target_node == rhs._target_node
                && lhs._lw_cnt == rhs._lw_cnt
                && lhs._lw_heartbeats == rhs._lw_heartbeats
+               && lhs._lw_session == rhs._lw_session
+               && lhs._lw_seq == rhs._lw_seq
+               && lhs._lw_base_seq == rhs._lw_base_seq
+               && lhs._lw_removed == rhs._lw_removed
                && lhs._full_heartbeats.size() == rhs._full_heartbeats.size()
                && std::equal(
                  lhs._full_heartbeats.begin(),
@@ -364,6 +401,16 @@ public:
           _lw_heartbeats);
     }
 
+    /// Groups which left the lightweight heartbeats set of the session
+    template<typename Func>
+    void for_each_lw_removed(Func&& f) const {
+        for_each_column(
+          [f = std::forward<Func>(f)](int64_t g) mutable {
+              f(raft::group_id(g));
+          },
+          _lw_removed);
+    }
+
     model::node_id source() const { return _source_node; }
     model::node_id target() const { return _target_node; }
     uint64_t lw_heartbeats_count() const { return _lw_cnt; }
@@ -388,12 +435,24 @@ private:
      */
     lw_column_t _lw_heartbeats;
     full_heartbeats_t _full_heartbeats;
+    /**
+     * When the lightweight heartbeat session is set the receiver keeps the
+     * set of groups from the last request it acknowledged. The following
+     * requests carry only the difference to that set, _lw_heartbeats holds
+     * the groups which were added and _lw_removed the ones which left. This
+     * way an idle group costs nothing on the wire and the request size
+     * grows with the rate of changes rather than with the number of groups.
+     */
+    uint64_t _lw_session{0};
+    uint64_t _lw_seq{0};
+    uint64_t _lw_base_seq{0};
+    lw_column_t _lw_removed;
 };
 
 class heartbeat_reply_v2
   : public serde::envelope<
       heartbeat_reply_v2,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
 public:
     using rpc_adl_exempt = std::true_type;
@@ -423,6 +482,7 @@ public:
                && lhs._target_node == rhs._target_node
                && lhs._lw_replies == rhs._lw_replies
                && lhs._results == rhs._results
+               && lhs._lw_acked_seq == rhs._lw_acked_seq
                && lhs._full_replies.size() == rhs._full_replies.size()
                && std::equal(
                  lhs._full_replies.begin(),
@@ -438,6 +498,16 @@ public:
     void add(group_id, reply_result);
     void add(group_id, reply_result, const heartbeat_reply_data&);
 
+    /**
+     * Acknowledge the delta encoded lightweight heartbeats of the request
+     * with sequence \p seq. The reply then lists only the lightweight
+     * heartbeats which didn't succeed, all other groups of the set
+     * succeeded. Zero means that the receiver couldn't resolve the delta and
+     * the sender has to send the full set again.
+     */
+    void set_lw_acked_seq(uint64_t seq) { _lw_acked_seq = seq; }
+    uint64_t lw_acked_seq() const { return _lw_acked_seq; }
+
     template<typename Func>
     void for_each_lw_reply(Func&& f) const {
         for_each_column(
@@ -466,5 +536,27 @@ private:
     result_column_t _results;
 
     ss::chunked_fifo<full_heartbeat_reply> _full_replies;
+
+    uint64_t _lw_acked_seq{0};
+};
+
+/**
+ * Lightweight heartbeats session of a sender on a shard of the receiver.
+ *
+ * Followers of idle groups hibernate on the session: instead of receiving a
+ * lightweight heartbeat of their own on every tick they take the last
+ * heartbeat of the session as theirs, for as long as the sender keeps them
+ * in the set of the session. The session is the node level liveness signal
+ * of the leader, so that the per tick cost of a follower shard grows with
+ * the number of its active groups rather than with all of them.
+ */
+struct lw_hibernation_session
+  : public ss::enable_lw_shared_from_this<lw_hibernation_session> {
+    // sequence of the latest request of the session seen by the shard
+    uint64_t seq{0};
+    clock_type::time_point last_heartbeat = clock_type::time_point::min();
+    // groups which left hibernation on their own, e.g. because of a term
+    // change, to be heartbeated individually again
+    fragmented_vector<group_id> woken;
 };
 } // namespace raft
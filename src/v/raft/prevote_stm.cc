@@ -50,7 +50,7 @@ ss::future<result<vote_reply>> prevote_stm::do_dispatch_prevote(vnode n) {
       tout_ms);
     auto r = _req;
     r.target_node_id = n;
-    return _ptr->_client_protocol
+    return _ptr->_vote_batcher
       .vote(n.id(), std::move(r), rpc::client_opts(_prevote_timeout))
       .then([this, target_node_id = n.id()](result<vote_reply> reply) {
           return _ptr->validate_reply_target_node(
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "raft/recovery_batcher.h"
+
+#include "features/feature_table.h"
+#include "raft/errc.h"
+#include "raft/logger.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+namespace raft {
+
+recovery_batcher::recovery_batcher(
+  consensus_client_protocol client,
+  features::feature_table& features,
+  config::binding<std::optional<size_t>> max_batch_bytes)
+  : _client(std::move(client))
+  , _features(features)
+  , _max_batch_bytes(std::move(max_batch_bytes)) {}
+
+ss::future<> recovery_batcher::stop() { return _gate.close(); }
+
+bool recovery_batcher::is_enabled() const {
+    return _max_batch_bytes().has_value()
+           && _features.is_active(features::feature::raft_append_entries_batch);
+}
+
+ss::future<result<append_entries_reply>> recovery_batcher::append_entries(
+  model::node_id target,
+  append_entries_request&& r,
+  size_t size_bytes,
+  rpc::client_opts opts,
+  bool use_all_serde_encoding) {
+    if (!is_enabled()) {
+        return _client.append_entries(
+          target, std::move(r), std::move(opts), use_all_serde_encoding);
+    }
+    if (_gate.is_closed()) {
+        return ss::make_ready_future<result<append_entries_reply>>(
+          errc::shutting_down);
+    }
+
+    ss::promise<result<append_entries_reply>> p;
+    auto f = p.get_future();
+    auto [it, inserted] = _queues.try_emplace(target);
+    it->second.push_back(pending_request{
+      .request = std::move(r),
+      .size_bytes = size_bytes,
+      .opts = std::move(opts),
+      .promise = std::move(p),
+    });
+    if (inserted) {
+        ssx::spawn_with_gate(
+          _gate, [this, target] { return dispatch_loop(target); });
+    }
+    return f;
+}
+
+ss::future<> recovery_batcher::dispatch_loop(model::node_id target) {
+    while (true) {
+        // the queue is looked up in every iteration as the map may rehash
+        // while the batch is in flight
+        auto it = _queues.find(target);
+        if (it->second.empty()) {
+            _queues.erase(it);
+            co_return;
+        }
+        auto& queue = it->second;
+        const size_t limit = _max_batch_bytes().value_or(0);
+
+        pending_requests_t batch;
+        size_t batch_bytes = 0;
+        // a single request larger than the limit is sent on its own
+        while (!queue.empty()
+               && (batch.empty()
+                   || batch_bytes + queue.front().size_bytes <= limit)) {
+            batch_bytes += queue.front().size_bytes;
+            batch.push_back(std::move(queue.front()));
+            queue.pop_front();
+        }
+        co_await dispatch_batch(target, std::move(batch));
+    }
+}
+
+ss::future<> recovery_batcher::dispatch_batch(
+  model::node_id target, pending_requests_t batch) {
+    if (batch.size() == 1) {
+        // batching is only enabled when all the nodes support full serde
+        // encoding of append entries requests
+        auto& req = batch.front();
+        try {
+            auto reply = co_await _client.append_entries(
+              target, std::move(req.request), std::move(req.opts), true);
+            req.promise.set_value(std::move(reply));
+        } catch (...) {
+            req.promise.set_to_current_exception();
+        }
+        co_return;
+    }
+
+    auto timeout = rpc::clock_type::time_point::max();
+    std::vector<append_entries_request> requests;
+    requests.reserve(batch.size());
+    for (auto& req : batch) {
+        timeout = std::min(timeout, req.opts.timeout.timeout_at());
+        requests.push_back(std::move(req.request));
+    }
+    vlog(
+      raftlog.trace,
+      "dispatching {} recovery append entries requests to node {}",
+      requests.size(),
+      target);
+
+    try {
+        // the requests options including their memory units are kept in
+        // the batch until the reply is received
+        auto reply = co_await _client.append_entries_batch(
+          target,
+          append_entries_batch_request(std::move(requests)),
+          rpc::client_opts(timeout));
+
+        if (reply.has_error()) {
+            for (auto& req : batch) {
+                req.promise.set_value(reply.error());
+            }
+            co_return;
+        }
+        auto& replies = reply.value().replies;
+        if (replies.size() != batch.size()) {
+            vlog(
+              raftlog.warn,
+              "unexpected number of append entries batch replies from node "
+              "{}, expected: {}, got: {}",
+              target,
+              batch.size(),
+              replies.size());
+            for (auto& req : batch) {
+                req.promise.set_value(errc::append_entries_dispatch_error);
+            }
+            co_return;
+        }
+        for (size_t i = 0; i < batch.size(); ++i) {
+            batch[i].promise.set_value(replies[i]);
+        }
+    } catch (...) {
+        auto e = std::current_exception();
+        for (auto& req : batch) {
+            req.promise.set_exception(e);
+        }
+    }
+}
+
+} // namespace raft
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "config/property.h"
+#include "features/fwd.h"
+#include "model/metadata.h"
+#include "outcome.h"
+#include "raft/consensus_client_protocol.h"
+#include "raft/types.h"
+#include "rpc/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/chunked_fifo.hh>
+#include <seastar/core/gate.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <optional>
+#include <vector>
+
+namespace raft {
+
+/**
+ * Shard local batcher of recovery append entries requests.
+ *
+ * Requests of the raft groups of a shard that are sent to the same node are
+ * coalesced into a single append_entries_batch RPC. A request is dispatched
+ * right away if there is nothing in flight to its target node, otherwise it
+ * is queued and sent together with the other requests queued in the meantime
+ * as soon as the in flight RPC finishes. This keeps the latency of a single
+ * recovering group unchanged while the number of RPCs sent when many groups
+ * recover at once (e.g. when a node rejoins the cluster) is bounded by the
+ * round trip time rather than by the number of groups.
+ *
+ * The batch size is limited by the raft_recovery_batch_max_bytes property,
+ * batching is disabled when the property is not set.
+ */
+class recovery_batcher {
+public:
+    recovery_batcher(
+      consensus_client_protocol,
+      features::feature_table&,
+      config::binding<std::optional<size_t>> max_batch_bytes);
+
+    ss::future<> stop();
+
+    /// Send a recovery request of \p size_bytes to the target node, coalesced
+    /// with the requests of other groups if batching is enabled
+    ss::future<result<append_entries_reply>> append_entries(
+      model::node_id,
+      append_entries_request&&,
+      size_t size_bytes,
+      rpc::client_opts,
+      bool use_all_serde_encoding);
+
+private:
+    struct pending_request {
+        append_entries_request request;
+        size_t size_bytes;
+        rpc::client_opts opts;
+        ss::promise<result<append_entries_reply>> promise;
+    };
+    using pending_requests_t = std::vector<pending_request>;
+
+    bool is_enabled() const;
+
+    ss::future<> dispatch_loop(model::node_id);
+    ss::future<> dispatch_batch(model::node_id, pending_requests_t);
+
+    consensus_client_protocol _client;
+    features::feature_table& _features;
+    config::binding<std::optional<size_t>> _max_batch_bytes;
+    /**
+     * Requests waiting for the in flight RPC to their target node. A node is
+     * present in the map as long as its dispatch loop is running.
+     */
+    absl::flat_hash_map<model::node_id, ss::chunked_fifo<pending_request>>
+      _queues;
+    ss::gate _gate;
+};
+
+} // namespace raft
@@ -17,6 +17,8 @@
 
 #include <seastar/core/memory.hh>
 
+#include <algorithm>
+
 namespace raft {
 
 recovery_memory_quota::recovery_memory_quota(
@@ -24,7 +26,15 @@ recovery_memory_quota::recovery_memory_quota(
   : _cfg(config_provider())
   , _current_max_recovery_mem(_cfg.max_recovery_memory().value_or(
       memory_groups().recovery_max_memory()))
-  , _memory(_current_max_recovery_mem, "raft/recovery-quota") {
+  , _memory(_current_max_recovery_mem, "raft/recovery-quota")
+  , _usage_deregister(
+      resources::available_memory::local().register_usage_reporter(
+        "raft_recovery", [this] {
+            auto available = static_cast<size_t>(
+              std::max<ssize_t>(_memory.available_units(), 0));
+            return _current_max_recovery_mem
+                   - std::min(_current_max_recovery_mem, available);
+        })) {
     _cfg.max_recovery_memory.watch([this] { on_max_memory_changed(); });
 }
 
@@ -10,6 +10,7 @@
  */
 #pragma once
 #include "config/property.h"
+#include "resource_mgmt/available_memory.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 
@@ -37,6 +38,7 @@ private:
     configuration _cfg;
     size_t _current_max_recovery_mem;
     ssx::semaphore _memory;
+    resources::available_memory::deregister_holder _usage_deregister;
 };
 
 } // namespace raft
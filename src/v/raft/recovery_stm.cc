@@ -10,6 +10,7 @@
 #include "raft/recovery_stm.h"
 
 #include "bytes/iostream.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "outcome_future_utils.h"
@@ -254,7 +255,7 @@ recovery_stm::read_range_for_recovery(
         //
         // also skip if there is only one replica recovering as there is no
         // need to add batches to the cache for read-once workloads.
-        cfg.skip_batch_cache = true;
+        cfg.cache_hint = storage::batch_cache_hint::read_once;
     }
 
     vlog(_ctxlog.trace, "Reading batches, starting from: {}", start_offset);
@@ -288,6 +289,7 @@ recovery_stm::read_range_for_recovery(
               return acc + batch.size_bytes();
           });
         _recovered_bytes_since_flush += size;
+        _last_read_bytes = size;
 
         if (is_learner && _ptr->_recovery_throttle) {
             vlog(
@@ -380,9 +382,31 @@ ss::future<> recovery_stm::send_install_snapshot_request() {
     });
 }
 ss::future<iobuf> recovery_stm::read_snapshot_chunk() {
-    return ss::visit(*_snapshot_reader, [](auto& rdr) {
-        return read_iobuf_exactly(rdr.input(), 32_KiB);
-    });
+    const auto chunk_size
+      = config::shard_local_cfg().raft_recovery_snapshot_chunk_size();
+    auto chunk = co_await ss::visit(
+      *_snapshot_reader, [chunk_size](auto& rdr) {
+          return read_iobuf_exactly(rdr.input(), chunk_size);
+      });
+
+    // snapshot chunks delivered to learners share the recovery bandwidth
+    // with the log ranges, otherwise a large snapshot of a new replica
+    // could saturate the link during a rebalance
+    auto meta = get_follower_meta();
+    if (meta && (*meta)->is_learner && _ptr->_recovery_throttle) {
+        vlog(
+          _ctxlog.trace,
+          "Requesting throttle for {} snapshot bytes, available in "
+          "throttle: {}",
+          chunk.size_bytes(),
+          _ptr->_recovery_throttle->get().available());
+        co_await _ptr->_recovery_throttle->get()
+          .throttle(chunk.size_bytes(), _ptr->_as)
+          .handle_exception_type([this](const ss::broken_semaphore&) {
+              vlog(_ctxlog.info, "Recovery throttling has stopped");
+          });
+    }
+    co_return chunk;
 }
 
 ss::future<> recovery_stm::close_snapshot_reader() {
@@ -643,10 +667,11 @@ ss::future<result<append_entries_reply>> recovery_stm::dispatch_append_entries(
     opts.resource_units = ss::make_foreign(
       ss::make_lw_shared<std::vector<ssx::semaphore_units>>(std::move(units)));
 
-    return _ptr->_client_protocol
+    return _ptr->_recovery_batcher
       .append_entries(
         _node_id.id(),
         std::move(r),
+        _last_read_bytes,
         std::move(opts),
         _ptr->use_all_serde_append_entries())
       .then([this](result<append_entries_reply> reply) {
@@ -102,6 +102,8 @@ private:
     bool _stop_requested = false;
     recovery_memory_quota& _memory_quota;
     size_t _recovered_bytes_since_flush = 0;
+    // size of the batches read in the current recovery round
+    size_t _last_read_bytes = 0;
 };
 
 } // namespace raft
@@ -9,8 +9,10 @@
 
 #include "raft/replicate_batcher.h"
 
+#include "config/configuration.h"
 #include "raft/consensus.h"
 #include "raft/replicate_entries_stm.h"
+#include "raft/replicate_latency_probe.h"
 #include "raft/types.h"
 #include "ssx/future-util.h"
 
@@ -18,15 +20,46 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/util/defer.hh>
 
+#include <algorithm>
 #include <optional>
 
 namespace raft {
 using namespace std::chrono_literals; // NOLINT
+static constexpr double flush_latency_alpha = 0.5;
+static constexpr size_t flush_latency_windows = 8;
+
 replicate_batcher::replicate_batcher(consensus* ptr, size_t cache_size)
   : _ptr(ptr)
   , _max_batch_size_sem(cache_size, "raft/repl-batch")
-  , _max_batch_size(cache_size) {}
+  , _max_batch_size(cache_size)
+  , _flush_latency(
+      flush_latency_alpha,
+      std::chrono::steady_clock::duration{0},
+      flush_latency_windows) {}
+
+std::chrono::microseconds replicate_batcher::flush_delay() {
+    if (
+      _inflight_flushes == 0
+      || !config::shard_local_cfg().raft_replicate_batch_adaptive_window()) {
+        return std::chrono::microseconds{0};
+    }
+    // sample() is in milliseconds
+    constexpr double us_per_ms = 1000.0;
+    const auto latency = std::chrono::microseconds(
+      static_cast<int64_t>(_flush_latency.sample() * us_per_ms));
+    return std::min<std::chrono::microseconds>(
+      latency / 2,
+      config::shard_local_cfg().raft_replicate_batch_max_delay_ms());
+}
+
+void replicate_batcher::record_flush_latency(
+  std::chrono::steady_clock::duration latency) {
+    _flush_latency.tick();
+    _flush_latency.update(latency);
+}
 
 replicate_stages replicate_batcher::replicate(
   std::optional<model::term_id> expected_term,
@@ -74,7 +107,10 @@ replicate_batcher::cache_and_wait_for_result(
         if (!_flush_pending) {
             _flush_pending = true;
             ssx::background = ssx::spawn_with_gate_then(_bg, [this]() {
-                return _lock.get_units()
+                auto delay = flush_delay();
+                auto wait = delay.count() > 0 ? ss::sleep(delay) : ss::now();
+                return std::move(wait)
+                  .then([this] { return _lock.get_units(); })
                   .then([this](auto units) {
                       return flush(std::move(units), false);
                   })
@@ -228,15 +264,22 @@ ss::future<> replicate_batcher::flush(
         std::vector<item_ptr> notifications;
         ssx::semaphore_units item_memory_units(_max_batch_size_sem, 0);
         auto needs_flush = flush_after_append::no;
+        // with write caching quorum_ack requests are acknowledged once a
+        // majority appended them, the log is flushed in the background
+        const bool write_caching = _ptr->log_config().write_caching();
+        const auto dequeued_at = std::chrono::steady_clock::now();
 
         for (auto& n : item_cache) {
             if (
               !n->get_expected_term().has_value()
               || n->get_expected_term().value() == term) {
+                replicate_latency().record_batcher_queue(
+                  dequeued_at - n->enqueued_at());
                 auto [batches, units] = n->release_data();
                 item_memory_units.adopt(std::move(units));
                 if (
-                  n->get_consistency_level() == consistency_level::quorum_ack) {
+                  n->get_consistency_level() == consistency_level::quorum_ack
+                  && !write_caching) {
                     needs_flush = flush_after_append::yes;
                 }
                 for (auto& b : batches) {
@@ -316,13 +359,27 @@ ss::future<> replicate_batcher::do_flush(
   append_entries_request req,
   std::vector<ssx::semaphore_units> u,
   absl::flat_hash_map<vnode, follower_req_seq> seqs) {
-    auto needs_flush = req.is_flush_required();
+    const bool has_quorum_requests = std::any_of(
+      notifications.begin(), notifications.end(), [](const item_ptr& item) {
+          return item->get_consistency_level()
+                 == consistency_level::quorum_ack;
+      });
     _ptr->_probe->replicate_batch_flushed();
     auto stm = ss::make_lw_shared<replicate_entries_stm>(
       _ptr, std::move(req), std::move(seqs));
+    const auto start = std::chrono::steady_clock::now();
+    ++_inflight_flushes;
+    // completes the flush for the adaptive window once the requests have
+    // been acknowledged, or failed
+    auto flush_done = ss::defer([this, start]() noexcept {
+        --_inflight_flushes;
+        record_flush_latency(std::chrono::steady_clock::now() - start);
+    });
     try {
         auto holder = _bg.hold();
         auto leader_result = co_await stm->apply(std::move(u));
+        const auto appended_at = std::chrono::steady_clock::now();
+        replicate_latency().record_leader_append(appended_at - start);
 
         /**
          * First phase, if leader result has error just propagate error
@@ -343,11 +400,15 @@ ss::future<> replicate_batcher::do_flush(
          * NOTE: this happens in background since we do not want to block
          * replicate batcher
          */
-        if (leader_result && needs_flush) {
+        if (leader_result && has_quorum_requests) {
             (void)stm->wait_for_majority()
               .then([holder = std::move(holder),
-                     notifications = std::move(notifications)](
+                     notifications = std::move(notifications),
+                     flush_done = std::move(flush_done),
+                     appended_at](
                       result<replicate_result> quorum_result) mutable {
+                  replicate_latency().record_quorum_ack(
+                    std::chrono::steady_clock::now() - appended_at);
                   propagate_result(
                     quorum_result, notifications, [](const item_ptr& item) {
                         return item->get_consistency_level()
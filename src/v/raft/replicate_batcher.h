@@ -16,6 +16,7 @@
 #include "raft/types.h"
 #include "ssx/semaphore.h"
 #include "units.h"
+#include "utils/ema.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/gate.hh>
@@ -59,6 +60,9 @@ public:
         }
 
         size_t get_record_count() const { return _record_count; }
+        std::chrono::steady_clock::time_point enqueued_at() const {
+            return _enqueued_at;
+        }
         consistency_level get_consistency_level() const {
             return _consistency_lvl;
         }
@@ -103,6 +107,8 @@ public:
         // consistency level is stored to distinguish when an item promise
         // should be signaled with replication result
         consistency_level _consistency_lvl;
+        std::chrono::steady_clock::time_point _enqueued_at{
+          std::chrono::steady_clock::now()};
         /**
          * Item keeps semaphore units until replicate batcher is done with
          * processing the request.
@@ -132,6 +138,16 @@ public:
     ss::future<> stop();
 
 private:
+    /**
+     * The delay before a background flush is dispatched. Zero unless the
+     * adaptive window is enabled and earlier flushes are still in flight, in
+     * which case new requests would only queue behind them anyway; waiting a
+     * fraction of the observed replication latency lets more of them share
+     * the next append and flush.
+     */
+    std::chrono::microseconds flush_delay();
+    void record_flush_latency(std::chrono::steady_clock::duration);
+
     ss::future<> do_flush(
       std::vector<item_ptr>,
       append_entries_request,
@@ -171,6 +187,12 @@ private:
     // flush task execution can be lower than the rate at which new
     // items are added to the cache.
     bool _flush_pending = false;
+
+    // replication latency of the recent flushes, one window per flush, and
+    // the number of flushes not yet completed.
+    exponential_moving_average<std::chrono::steady_clock::duration>
+      _flush_latency;
+    size_t _inflight_flushes{0};
 };
 
 } // namespace raft
@@ -367,6 +367,23 @@ replicate_entries_stm::wait_for_majority() {
         return committed || truncated;
     };
     try {
+        if (!_is_flush_required) {
+            /**
+             * Write caching, the entries are acknowledged as soon as a
+             * majority of replicas appended them. If the term changes first
+             * we fall back to waiting for the entries to be either committed
+             * or truncated.
+             */
+            co_await _ptr->_follower_reply.wait([this,
+                                                 appended_offset,
+                                                 appended_term] {
+                return _ptr->_majority_replicated_index >= appended_offset
+                       || _ptr->term() != appended_term;
+            });
+            if (_ptr->term() == appended_term) {
+                co_return build_replicate_result();
+            }
+        }
         co_await _ptr->_commit_index_updated.wait(stop_cond);
         co_return process_result(appended_offset, appended_term);
 
@@ -101,7 +101,8 @@ public:
 
     /**
      * Waits for majority of replicas to successfully execute dispatched
-     * append_entries_request
+     * append_entries_request. When the request doesn't require a flush (write
+     * caching) the entries are acknowledged once a majority appended them.
      */
     ss::future<result<replicate_result>> wait_for_majority();
 
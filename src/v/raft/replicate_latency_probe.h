@@ -0,0 +1,63 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "utils/log_hist.h"
+
+#include <chrono>
+
+namespace raft {
+
+/**
+ * Shard wide latency of the stages of a replicate request on the leader,
+ * recorded by the replicate batcher of every raft group of the shard:
+ *
+ * - batcher queue: from the request being cached by the batcher until the
+ *   flush which takes it,
+ * - leader append: appending the flushed batches to the leader log and
+ *   dispatching them to the followers,
+ * - quorum ack: from the leader append until the majority of the replicas
+ *   acknowledged the batches (only for quorum_ack requests).
+ *
+ * The stages add up to the replication part of the produce latency, on top
+ * of which kafka adds the request parsing and response building.
+ */
+class replicate_latency_probe {
+public:
+    using hist_t = log_hist_internal;
+    using clock_t = std::chrono::steady_clock;
+
+    void record_batcher_queue(clock_t::duration d) { record(_queue, d); }
+    void record_leader_append(clock_t::duration d) { record(_append, d); }
+    void record_quorum_ack(clock_t::duration d) { record(_quorum_ack, d); }
+
+    const hist_t& batcher_queue() const { return _queue; }
+    const hist_t& leader_append() const { return _append; }
+    const hist_t& quorum_ack() const { return _quorum_ack; }
+
+private:
+    static void record(hist_t& h, clock_t::duration d) {
+        h.record(
+          std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+    }
+
+    hist_t _queue;
+    hist_t _append;
+    hist_t _quorum_ack;
+};
+
+inline replicate_latency_probe& replicate_latency() {
+    static thread_local replicate_latency_probe probe;
+    return probe;
+}
+
+} // namespace raft
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "config/property.h"
 #include "likely.h"
 #include "model/metadata.h"
 #include "raft/consensus.h"
@@ -28,7 +29,9 @@
 #include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -57,12 +60,14 @@ public:
       ss::sharded<ConsensusManager>& mngr,
       ShardLookup& tbl,
       clock_type::duration heartbeat_interval,
-      model::node_id self)
+      model::node_id self,
+      config::binding<bool> enable_hibernation)
       : raftgen_service(sc, ssg)
       , _group_manager(mngr)
       , _shard_table(tbl)
       , _heartbeat_interval(heartbeat_interval)
-      , _self(self) {
+      , _self(self)
+      , _enable_hibernation(std::move(enable_hibernation)) {
         finjector::shard_local_badger().register_probe(
           failure_probes::name(), &_probe);
     }
@@ -115,7 +120,31 @@ public:
     heartbeat_v2(heartbeat_request_v2&& r, rpc::streaming_context&) final {
         const auto source = r.source();
         const auto target = r.target();
-        auto grouped = group_hbeats_by_shard(std::move(r));
+        /**
+         * Delta encoded lightweight heartbeats are resolved against the set
+         * of their session. If the base set is not known no lightweight
+         * heartbeats are dispatched and the reply asks the sender to start
+         * over with the full set.
+         */
+        const auto lw_session_id = r.lw_session();
+        uint64_t lw_acked_seq = 0;
+        const heartbeat_request_v2::lw_groups_t* lw_groups = nullptr;
+        heartbeat_request_v2::lw_groups_t unresolved_lw_groups;
+        heartbeat_request_v2::lw_groups_t lw_removed;
+        lw_heartbeat_session* session = nullptr;
+        if (r.has_lw_session()) {
+            session = resolve_lw_heartbeats(r, lw_removed);
+            if (session != nullptr) {
+                lw_acked_seq = r.lw_seq();
+                lw_groups = &session->groups;
+            } else {
+                lw_groups = &unresolved_lw_groups;
+            }
+        }
+        // the session must not be used after the first scheduling point as
+        // concurrent requests may modify the sessions map
+        auto grouped = group_hbeats_by_shard(
+          std::move(r), lw_groups, session, lw_removed);
 
         std::vector<ss::future<shard_heartbeat_replies>> futures;
         futures.reserve(grouped.shard_requests.size());
@@ -139,11 +168,23 @@ public:
         std::vector<shard_heartbeat_replies> replies
           = co_await ss::when_all_succeed(futures.begin(), futures.end());
 
+        if (lw_acked_seq != 0) {
+            update_hibernation(lw_session_id, replies);
+        }
+
         heartbeat_reply_v2 reply(_self, source);
+        reply.set_lw_acked_seq(lw_acked_seq);
 
         // flatten responses
         for (shard_heartbeat_replies& shard_replies : replies) {
             for (const auto& lw_reply : shard_replies.lw_replies) {
+                // successful lightweight heartbeats of an acknowledged
+                // delta are implicit
+                if (
+                  lw_acked_seq != 0
+                  && lw_reply.result == reply_result::success) {
+                    continue;
+                }
                 reply.add(lw_reply.group, lw_reply.result);
             }
             for (const auto& full_reply : shard_replies.full_heartbeats) {
@@ -198,6 +239,92 @@ public:
         });
     }
 
+    ss::future<append_entries_batch_reply> append_entries_batch(
+      append_entries_batch_request&& r, rpc::streaming_context&) final {
+        co_await _probe.append_entries_batch();
+        auto requests = std::move(r).release();
+
+        append_entries_batch_reply reply;
+        reply.replies.resize(requests.size());
+
+        // requests of groups living on the same shard are dispatched together
+        struct shard_requests {
+            std::vector<size_t> indices;
+            std::vector<append_entries_request> requests;
+        };
+        absl::flat_hash_map<ss::shard_id, shard_requests> grouped;
+        for (size_t i = 0; i < requests.size(); ++i) {
+            const auto group = requests[i].target_group();
+            const auto shard = _shard_table.shard_for(group);
+            if (unlikely(!shard)) {
+                reply.replies[i] = append_entries_reply{
+                  .group = group, .result = reply_result::group_unavailable};
+                continue;
+            }
+            auto& shard_reqs = grouped[*shard];
+            shard_reqs.indices.push_back(i);
+            shard_reqs.requests.push_back(
+              append_entries_request::make_foreign(std::move(requests[i])));
+        }
+
+        std::vector<ss::future<>> futures;
+        futures.reserve(grouped.size());
+        for (auto& [shard, shard_reqs] : grouped) {
+            futures.push_back(
+              dispatch_append_entries_to_core(
+                shard, std::move(shard_reqs.requests))
+                .then([&reply, indices = std::move(shard_reqs.indices)](
+                        std::vector<append_entries_reply> replies) {
+                    for (size_t i = 0; i < replies.size(); ++i) {
+                        reply.replies[indices[i]] = replies[i];
+                    }
+                }));
+        }
+        co_await ss::when_all_succeed(futures.begin(), futures.end());
+        co_return reply;
+    }
+
+    ss::future<vote_batch_reply>
+    vote_batch(vote_batch_request&& r, rpc::streaming_context&) final {
+        co_await _probe.vote_batch();
+
+        vote_batch_reply reply;
+        reply.replies.resize(r.requests.size());
+
+        // requests of groups living on the same shard are dispatched together
+        struct shard_requests {
+            std::vector<size_t> indices;
+            std::vector<vote_request> requests;
+        };
+        absl::flat_hash_map<ss::shard_id, shard_requests> grouped;
+        for (size_t i = 0; i < r.requests.size(); ++i) {
+            const auto shard = _shard_table.shard_for(
+              r.requests[i].target_group());
+            if (unlikely(!shard)) {
+                reply.replies[i] = co_await make_failed_vote_reply();
+                continue;
+            }
+            auto& shard_reqs = grouped[*shard];
+            shard_reqs.indices.push_back(i);
+            shard_reqs.requests.push_back(std::move(r.requests[i]));
+        }
+
+        std::vector<ss::future<>> futures;
+        futures.reserve(grouped.size());
+        for (auto& [shard, shard_reqs] : grouped) {
+            futures.push_back(
+              dispatch_votes_to_core(shard, std::move(shard_reqs.requests))
+                .then([&reply, indices = std::move(shard_reqs.indices)](
+                        std::vector<vote_reply> replies) {
+                    for (size_t i = 0; i < replies.size(); ++i) {
+                        reply.replies[indices[i]] = replies[i];
+                    }
+                }));
+        }
+        co_await ss::when_all_succeed(futures.begin(), futures.end());
+        co_return reply;
+    }
+
     [[gnu::always_inline]] ss::future<install_snapshot_reply> install_snapshot(
       install_snapshot_request&& r, rpc::streaming_context&) final {
         return _probe.install_snapshot().then([this,
@@ -246,9 +373,19 @@ private:
           shard_requests;
         std::vector<heartbeat_metadata> group_missing_requests;
     };
+    using hibernation_ptr
+      = ss::foreign_ptr<ss::lw_shared_ptr<lw_hibernation_session>>;
+
     struct shard_heartbeats {
         ss::chunked_fifo<full_heartbeat> full_heartbeats;
         ss::chunked_fifo<group_id> lw_heartbeats;
+        // groups which left the lightweight heartbeats set of the session
+        ss::chunked_fifo<group_id> lw_removed;
+        uint64_t lw_seq{0};
+        // the session on the target shard, kept alive by the request
+        lw_hibernation_session* hibernation{nullptr};
+        // create the session on the target shard if it doesn't have one
+        bool create_hibernation{false};
     };
     struct lw_reply {
         lw_reply(group_id gr, reply_result result)
@@ -259,12 +396,19 @@ private:
         reply_result result;
     };
     struct shard_heartbeat_replies {
+        ss::shard_id shard;
         ss::chunked_fifo<full_heartbeat_reply> full_heartbeats;
         ss::chunked_fifo<lw_reply> lw_replies;
+        // groups which hibernated on the session, or left it on their own
+        ss::chunked_fifo<group_id> hibernated;
+        ss::chunked_fifo<group_id> woken;
+        std::optional<hibernation_ptr> created_hibernation;
     };
     struct shard_groupped_hbeat_requests_v2 {
         absl::flat_hash_map<ss::shard_id, shard_heartbeats> shard_requests;
         std::vector<group_heartbeat> group_missing_requests;
+        // sessions on the target shards used by the requests
+        std::vector<ss::lw_shared_ptr<hibernation_ptr>> hibernations;
     };
 
     static ss::future<vote_reply> make_failed_vote_reply() {
@@ -395,6 +539,53 @@ private:
           flush_after_append::no};
     }
 
+    ss::future<std::vector<append_entries_reply>>
+    dispatch_append_entries_to_core(
+      ss::shard_id shard, std::vector<append_entries_request> requests) {
+        return with_scheduling_group(
+          get_scheduling_group(),
+          [this, shard, r = std::move(requests)]() mutable {
+              return _group_manager.invoke_on(
+                shard,
+                get_smp_service_group(),
+                [this, r = std::move(r)](ConsensusManager& m) mutable {
+                    std::vector<ss::future<append_entries_reply>> futures;
+                    futures.reserve(r.size());
+                    for (auto& req : r) {
+                        futures.push_back(
+                          dispatch_append_entries(m, std::move(req)));
+                    }
+                    return ss::when_all_succeed(
+                      futures.begin(), futures.end());
+                });
+          });
+    }
+
+    ss::future<std::vector<vote_reply>> dispatch_votes_to_core(
+      ss::shard_id shard, std::vector<vote_request> requests) {
+        return with_scheduling_group(
+          get_scheduling_group(),
+          [this, shard, r = std::move(requests)]() mutable {
+              return _group_manager.invoke_on(
+                shard,
+                get_smp_service_group(),
+                [r = std::move(r)](ConsensusManager& m) mutable {
+                    std::vector<ss::future<vote_reply>> futures;
+                    futures.reserve(r.size());
+                    for (auto& req : r) {
+                        auto c = m.consensus_for(req.target_group());
+                        if (unlikely(!c)) {
+                            futures.push_back(make_failed_vote_reply());
+                            continue;
+                        }
+                        futures.push_back(c->vote(std::move(req)));
+                    }
+                    return ss::when_all_succeed(
+                      futures.begin(), futures.end());
+                });
+          });
+    }
+
     ss::future<std::vector<append_entries_reply>> dispatch_hbeats_to_groups(
       ConsensusManager& m, ss::chunked_fifo<heartbeat_metadata> reqs) {
         std::vector<ss::future<append_entries_reply>> futures;
@@ -424,7 +615,35 @@ private:
       model::node_id source_node,
       model::node_id target_node,
       shard_heartbeats reqs) {
-        shard_heartbeat_replies replies;
+        shard_heartbeat_replies replies{.shard = ss::this_shard_id()};
+        /**
+         * The request is the heartbeat of all the groups hibernating on the
+         * session. Groups which left the set of the session stop hibernating,
+         * and the ones which left on their own are reported back so that
+         * they get their own heartbeats again.
+         */
+        auto* hibernation = reqs.hibernation;
+        bool may_hibernate = false;
+        if (hibernation != nullptr) {
+            hibernation->last_heartbeat = std::max(
+              hibernation->last_heartbeat, clock_type::now());
+            // a newer request may have already woken the groups up
+            may_hibernate = reqs.lw_seq >= hibernation->seq;
+            hibernation->seq = std::max(hibernation->seq, reqs.lw_seq);
+            for (auto gr : std::exchange(hibernation->woken, {})) {
+                replies.woken.push_back(gr);
+            }
+            for (auto gr : reqs.lw_removed) {
+                if (auto c = m.consensus_for(gr); c) {
+                    c->leave_hibernation(*hibernation);
+                }
+                co_await ss::coroutine::maybe_yield();
+            }
+        } else if (reqs.create_hibernation) {
+            auto created = ss::make_lw_shared<lw_hibernation_session>();
+            created->seq = reqs.lw_seq;
+            replies.created_hibernation = ss::make_foreign(std::move(created));
+        }
         /**
          * Dispatch lightweight heartbeats
          */
@@ -437,6 +656,11 @@ private:
             }
             auto result = c->lightweight_heartbeat(source_node, target_node);
             replies.lw_replies.emplace_back(gr, result);
+            if (
+              result == reply_result::success && may_hibernate
+              && c->hibernate(hibernation->shared_from_this())) {
+                replies.hibernated.push_back(gr);
+            }
             co_await ss::coroutine::maybe_yield();
         }
 
@@ -485,8 +709,112 @@ private:
         return ret;
     }
 
-    shard_groupped_hbeat_requests_v2
-    group_hbeats_by_shard(heartbeat_request_v2 hb_request) {
+    /**
+     * Apply the lightweight heartbeats delta of the request to the set of its
+     * session and store the result as the new set of the session. The groups
+     * which left the set are added to \p removed. Returns nullptr if the base
+     * set of the delta is not known, e.g. after a restart or when the
+     * connection was re-established on another shard.
+     */
+    lw_heartbeat_session* resolve_lw_heartbeats(
+      const heartbeat_request_v2& r,
+      heartbeat_request_v2::lw_groups_t& removed) {
+        const auto now = clock_type::now();
+        auto it = _lw_sessions.find(r.lw_session());
+        std::optional<heartbeat_request_v2::lw_groups_t> groups;
+        if (r.lw_base_seq() == 0) {
+            groups = r.apply_lw_delta({});
+        } else if (
+          it != _lw_sessions.end() && it->second.seq == r.lw_base_seq()) {
+            groups = r.apply_lw_delta(it->second.groups);
+        }
+
+        if (!groups) {
+            if (it != _lw_sessions.end()) {
+                // groups hibernating on the session fall back to their
+                // election timeouts as the session isn't heartbeated anymore
+                _lw_sessions.erase(it);
+            }
+            return nullptr;
+        }
+
+        if (it != _lw_sessions.end()) {
+            auto& session = it->second;
+            if (r.lw_base_seq() == 0) {
+                // the sender started over with the full set
+                std::set_difference(
+                  session.groups.begin(),
+                  session.groups.end(),
+                  groups->begin(),
+                  groups->end(),
+                  std::back_inserter(removed));
+                session.hibernated.clear();
+            } else {
+                r.for_each_lw_removed(
+                  [&removed](group_id g) { removed.push_back(g); });
+                // groups which joined the set are heartbeated until they
+                // hibernate again
+                r.for_each_lw_heartbeat(
+                  [&session](group_id g) { session.hibernated.erase(g); });
+            }
+            for (auto g : removed) {
+                session.hibernated.erase(g);
+            }
+            if (!_enable_hibernation()) {
+                session.hibernated.clear();
+                session.hibernations.clear();
+            }
+        }
+
+        if (it == _lw_sessions.end()) {
+            // sessions of senders which went away are dropped when new ones
+            // show up
+            absl::erase_if(_lw_sessions, [this, now](const auto& p) {
+                return now - p.second.last_used > lw_session_idle_timeout();
+            });
+            it = _lw_sessions.try_emplace(r.lw_session()).first;
+        }
+        it->second.seq = r.lw_seq();
+        it->second.groups = std::move(*groups);
+        it->second.last_used = now;
+        return &it->second;
+    }
+
+    /// Record the groups which hibernated on the session, or left it.
+    void update_hibernation(
+      uint64_t session_id, std::vector<shard_heartbeat_replies>& replies) {
+        auto it = _lw_sessions.find(session_id);
+        if (it == _lw_sessions.end()) {
+            return;
+        }
+        auto& session = it->second;
+        for (auto& shard_replies : replies) {
+            if (shard_replies.created_hibernation) {
+                // a concurrent request may have created one already, no
+                // group hibernated on the one created by this request
+                session.hibernations.try_emplace(
+                  shard_replies.shard,
+                  ss::make_lw_shared<hibernation_ptr>(
+                    std::move(*shard_replies.created_hibernation)));
+            }
+            for (auto g : shard_replies.hibernated) {
+                session.hibernated.insert(g);
+            }
+            for (auto g : shard_replies.woken) {
+                session.hibernated.erase(g);
+            }
+        }
+    }
+
+    clock_type::duration lw_session_idle_timeout() const {
+        return _heartbeat_interval * 100;
+    }
+
+    shard_groupped_hbeat_requests_v2 group_hbeats_by_shard(
+      heartbeat_request_v2 hb_request,
+      const heartbeat_request_v2::lw_groups_t* lw_groups,
+      lw_heartbeat_session* session,
+      const heartbeat_request_v2::lw_groups_t& lw_removed) {
         shard_groupped_hbeat_requests_v2 ret;
 
         for (const auto& full_beat : hb_request.full_heartbeats()) {
@@ -501,8 +829,7 @@ private:
             it->second.full_heartbeats.push_back(
               full_heartbeat{.group = full_beat.group, .data = full_beat.data});
         }
-        hb_request.for_each_lw_heartbeat([this, &ret](int64_t group_id) {
-            auto const lw_beat = raft::group_id(group_id);
+        auto add_lw_heartbeat = [this, &ret](raft::group_id lw_beat) {
             auto const shard = _shard_table.shard_for(lw_beat);
             if (unlikely(!shard)) {
                 ret.group_missing_requests.push_back(
@@ -512,7 +839,40 @@ private:
 
             auto [it, _] = ret.shard_requests.try_emplace(*shard);
             it->second.lw_heartbeats.push_back(lw_beat);
-        });
+        };
+        if (lw_groups != nullptr) {
+            for (auto g : *lw_groups) {
+                if (session != nullptr && session->hibernated.contains(g)) {
+                    continue;
+                }
+                add_lw_heartbeat(g);
+            }
+        } else {
+            hb_request.for_each_lw_heartbeat(add_lw_heartbeat);
+        }
+
+        if (session != nullptr) {
+            // only groups of shards with a session may be hibernating
+            for (auto g : lw_removed) {
+                auto const shard = _shard_table.shard_for(g);
+                if (shard && session->hibernations.contains(*shard)) {
+                    auto [it, _] = ret.shard_requests.try_emplace(*shard);
+                    it->second.lw_removed.push_back(g);
+                }
+            }
+            // every shard with a session gets the node level heartbeat
+            for (auto& [shard, hibernation] : session->hibernations) {
+                auto [it, _] = ret.shard_requests.try_emplace(shard);
+                it->second.hibernation = hibernation->get();
+                ret.hibernations.push_back(hibernation);
+            }
+            const bool enabled = _enable_hibernation();
+            for (auto& [shard, req] : ret.shard_requests) {
+                req.lw_seq = hb_request.lw_seq();
+                req.create_hibernation = enabled && req.hibernation == nullptr
+                                         && !req.lw_heartbeats.empty();
+            }
+        }
 
         return ret;
     }
@@ -540,10 +900,26 @@ private:
           req.group, source_node, target_node, req.data);
     }
 
+    /// Set of groups of the last acknowledged delta encoded lightweight
+    /// heartbeats request of a sender
+    struct lw_heartbeat_session {
+        uint64_t seq{0};
+        heartbeat_request_v2::lw_groups_t groups;
+        clock_type::time_point last_used;
+        // groups of the set hibernating on the session, they aren't
+        // heartbeated individually
+        absl::flat_hash_set<group_id> hibernated;
+        // the sessions on the shards the groups hibernate on
+        absl::flat_hash_map<ss::shard_id, ss::lw_shared_ptr<hibernation_ptr>>
+          hibernations;
+    };
+
     failure_probes _probe;
     ss::sharded<ConsensusManager>& _group_manager;
     ShardLookup& _shard_table;
     clock_type::duration _heartbeat_interval;
     model::node_id _self;
+    config::binding<bool> _enable_hibernation;
+    absl::flat_hash_map<uint64_t, lw_heartbeat_session> _lw_sessions;
 };
 } // namespace raft
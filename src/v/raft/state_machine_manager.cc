@@ -31,7 +31,6 @@
 #include <seastar/coroutine/as_future.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/coroutine/parallel_for_each.hh>
-#include <seastar/coroutine/switch_to.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/later.hh>
 
@@ -41,116 +40,53 @@
 namespace raft {
 
 /**
- * Applicator which is a batch consumer that applies the same batch to multiple
- * state machines. If one of the STMs throws an exception from `apply` method
- * then not further batches are applied to that STM but the others continue
+ * Applicator is a batch consumer that applies batches to a single state
+ * machine. Exceptions thrown from the STM `apply` method are propagated to the
+ * apply fiber of the STM.
  */
 class batch_applicator {
 public:
     batch_applicator(
-      const char* ctx,
-      const std::vector<state_machine_manager::entry_ptr>& machines,
+      state_machine_manager::entry_ptr entry,
       ss::abort_source& as,
-      ctx_log& log);
+      ctx_log& log)
+      : _entry(std::move(entry))
+      , _as(as)
+      , _log(log) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch);
 
-    model::offset end_of_stream() const { return _max_last_applied; }
+    model::offset end_of_stream() const { return _last_applied; }
 
 private:
-    struct apply_state {
-        state_machine_manager::entry_ptr stm_entry;
-        bool error{false};
-    };
-    using applied_successfully
-      = ss::bool_class<struct applied_successfully_tag>;
-    ss::future<applied_successfully>
-    apply_to_stm(const model::record_batch& batch, apply_state& state);
-
-    const char* _ctx;
-    std::vector<apply_state> _machines;
-    model::offset _max_last_applied;
+    state_machine_manager::entry_ptr _entry;
+    model::offset _last_applied;
     ss::abort_source& _as;
     ctx_log& _log;
 };
 
-batch_applicator::batch_applicator(
-  const char* ctx,
-  const std::vector<state_machine_manager::entry_ptr>& entries,
-  ss::abort_source& as,
-  ctx_log& log)
-  : _ctx(ctx)
-  , _as(as)
-  , _log(log) {
-    for (auto& m : entries) {
-        _machines.push_back(apply_state{.stm_entry = m});
-    }
-}
-
 ss::future<ss::stop_iteration>
 batch_applicator::operator()(model::record_batch batch) {
+    auto& stm = *_entry->stm;
     const auto last_offset = batch.last_offset();
-    std::vector<ss::future<applied_successfully>> futures;
-    futures.reserve(_machines.size());
-    for (auto& state : _machines) {
-        if (state.error) {
-            continue;
-        }
-        futures.push_back(apply_to_stm(batch, state));
-    }
-    if (futures.empty()) {
-        co_return ss::stop_iteration::yes;
-    }
-
-    auto results = co_await ss::when_all_succeed(
-      futures.begin(), futures.end());
     /**
-     * If any of the STMs applied batch successfully update _max_last_applied
+     * The stm may already be past the batch if it applied a raft snapshot
      */
-    if (std::any_of(
-          results.begin(),
-          results.end(),
-          std::bind_front(std::equal_to<>(), applied_successfully::yes))) {
-        _max_last_applied = last_offset;
+    if (stm.next() > batch.base_offset()) {
+        co_return ss::stop_iteration(_as.abort_requested());
     }
-
-    co_return ss::stop_iteration(_as.abort_requested());
-}
-ss::future<batch_applicator::applied_successfully>
-batch_applicator::apply_to_stm(
-  const model::record_batch& batch, apply_state& state) {
-    const auto last_offset = batch.last_offset();
     vlog(
       _log.trace,
-      "[{}][{}] applying batch with base {} and last {} offsets",
-      _ctx,
-      state.stm_entry->stm->get_name(),
+      "[{}] applying batch with base {} and last {} offsets",
+      stm.get_name(),
       batch.header().base_offset,
       last_offset);
 
-    try {
-        /**
-         * If an apply timed out (took long time) the stm may already advanced
-         * past what was requested to read
-         */
-        if (state.stm_entry->stm->next() > batch.base_offset()) {
-            co_return applied_successfully::no;
-        }
+    co_await stm.apply(batch);
+    stm.set_next(model::next_offset(last_offset));
+    _last_applied = last_offset;
 
-        co_await state.stm_entry->stm->apply(batch);
-        state.stm_entry->stm->set_next(model::next_offset(last_offset));
-        co_return applied_successfully::yes;
-    } catch (...) {
-        vlog(
-          _log.warn,
-          "[{}][{}] error applying batch with base_offset: {} - {}",
-          _ctx,
-          state.stm_entry->stm->get_name(),
-          batch.base_offset(),
-          std::current_exception());
-        state.error = true;
-        co_return applied_successfully::no;
-    }
+    co_return ss::stop_iteration(_as.abort_requested());
 }
 
 state_machine_manager::state_machine_manager(
@@ -175,20 +111,17 @@ ss::future<> state_machine_manager::start() {
         vlog(_log.trace, "starting {} state machine", pair.first);
         return pair.second->stm->start();
     });
-    std::vector<model::offset> offsets;
-    for (const auto& [name, stm_meta] : _machines) {
-        offsets.push_back(stm_meta->stm->last_applied_offset());
-    }
-    std::sort(offsets.begin(), offsets.end());
-    _next = model::next_offset(offsets.front());
+    update_next();
     vlog(
       _log.debug,
       "started state machine manager with initial next offset: {}",
       _next);
-    ssx::spawn_with_gate(_gate, [this] {
-        return ss::do_until(
-          [this] { return _as.abort_requested(); }, [this] { return apply(); });
-    });
+    for (auto& [_, entry] : _machines) {
+        ssx::spawn_with_gate(_gate, [this, entry] {
+            return ss::with_scheduling_group(
+              _apply_sg, [this, entry] { return apply_fiber(entry); });
+        });
+    }
 }
 
 ss::future<> state_machine_manager::stop() {
@@ -196,7 +129,6 @@ ss::future<> state_machine_manager::stop() {
       _log.debug,
       "stopping state machine manager with {} state machines",
       _machines.size());
-    _apply_mutex.broken();
     _as.request_abort();
 
     co_await _gate.close();
@@ -204,29 +136,37 @@ ss::future<> state_machine_manager::stop() {
       _machines, [](auto p) { return p.second->stm->stop(); });
 }
 
-ss::future<> state_machine_manager::apply_raft_snapshot() {
+ss::future<>
+state_machine_manager::apply_raft_snapshot(const entry_ptr& entry) {
     auto snapshot = co_await _raft->open_snapshot();
     if (!snapshot) {
         co_return;
     }
 
-    auto fut = co_await ss::coroutine::as_future(
-      do_apply_raft_snapshot(std::move(snapshot->metadata), snapshot->reader));
+    auto fut = co_await ss::coroutine::as_future(do_apply_raft_snapshot(
+      entry, std::move(snapshot->metadata), snapshot->reader));
     co_await snapshot->reader.close();
     if (fut.failed()) {
         const auto e = fut.get_exception();
         // do not log known shutdown exceptions as errors
         if (!ssx::is_shutdown_exception(e)) {
-            vlog(_log.error, "error applying raft snapshot - {}", e);
+            vlog(
+              _log.error,
+              "error applying raft snapshot to '{}' state machine - {}",
+              entry->stm->get_name(),
+              e);
         }
         std::rethrow_exception(e);
     }
 }
 
 ss::future<> state_machine_manager::do_apply_raft_snapshot(
-  snapshot_metadata metadata, storage::snapshot_reader& reader) {
+  const entry_ptr& entry,
+  snapshot_metadata metadata,
+  storage::snapshot_reader& reader) {
     const auto snapshot_file_sz = co_await reader.get_snapshot_size();
     const auto last_offset = metadata.last_included_index;
+    auto stm = entry->stm;
 
     auto snapshot_content = co_await read_iobuf_exactly(
       reader.input(), snapshot_file_sz);
@@ -234,199 +174,118 @@ ss::future<> state_machine_manager::do_apply_raft_snapshot(
 
     vlog(
       _log.debug,
-      "applying snapshot of size {} with last included offset: {}.",
+      "applying snapshot of size {} with last included offset: {} to '{}' "
+      "state machine",
       snapshot_content_sz,
-      last_offset);
-    /**
-     * Previously all the STMs in Redpanda (excluding controller) were
-     * using empty Raft snapshots. If snapshot is empty we still apply
-     * it to maintain backward compatibility.
-     */
-    if (snapshot_content_sz == 0) {
-        vlog(
-          _log.debug,
-          "applying empty snapshot at offset: {} for backward "
-          "compatibility",
-          metadata.last_included_index);
-        co_await ss::coroutine::parallel_for_each(
-          _machines, [metadata, last_offset](auto& pair) {
-              auto stm = pair.second->stm;
-              if (stm->last_applied_offset() >= metadata.last_included_index) {
-                  return ss::now();
-              }
-              return stm->apply_raft_snapshot(iobuf{}).then([stm, last_offset] {
-                  stm->set_next(
-                    std::max(model::next_offset(last_offset), stm->next()));
-              });
-          });
-
-    } else {
-        iobuf_parser parser(std::move(snapshot_content));
-        auto snap = co_await serde::read_async<managed_snapshot>(parser);
-
-        co_await ss::coroutine::parallel_for_each(
-          snap.snapshot_map,
-          [this, metadata, last_offset](auto& snapshot_pair) {
-              auto it = _machines.find(snapshot_pair.first);
-              if (
-                it == _machines.end()
-                || it->second->stm->last_applied_offset()
-                     >= metadata.last_included_index) {
-                  return ss::now();
-              }
-
-              return it->second->stm
-                ->apply_raft_snapshot(std::move(snapshot_pair.second))
-                .then([stm = it->second->stm, last_offset] {
-                    stm->set_next(
-                      std::max(model::next_offset(last_offset), stm->next()));
-                });
-          });
-    }
-    _next = model::next_offset(metadata.last_included_index);
-}
-
-ss::future<> state_machine_manager::apply() {
-    try {
-        ss::coroutine::switch_to sg_sw(_apply_sg);
-        // wait until consensus commit index is >= _next
-        co_await _raft->events().wait(_next, model::no_timeout, _as);
-        auto u = co_await _apply_mutex.get_units();
-
-        if (_next < _raft->start_offset()) {
-            /**
-             * We need to return here as applied snapshot may not yet be
-             * committed.
-             */
-            co_return co_await apply_raft_snapshot();
-        }
-
+      last_offset,
+      stm->get_name());
+    if (stm->last_applied_offset() < last_offset) {
         /**
-         * Raft make_reader method allows callers reading up to
-         * last_visible index. In order to make the STMs safe and working
-         * with the raft semantics (i.e. what is applied must be comitted)
-         * we have to limit reading to the committed offset.
+         * Previously all the STMs in Redpanda (excluding controller) were
+         * using empty Raft snapshots. If snapshot is empty we still apply
+         * it to maintain backward compatibility.
          */
-        vlog(
-          _log.trace,
-          "reading batches in range [{}, {}]",
-          _next,
-          _raft->committed_offset());
-        /**
-         * Use default priority for now, it is going to be unified with apply
-         * scheduling group soon
-         */
-        storage::log_reader_config config(
-          _next, _raft->committed_offset(), ss::default_priority_class());
-
-        model::record_batch_reader reader = co_await _raft->make_reader(config);
-        // collect STMs which has the same _next offset as the offset in
-        // manager and there is no background apply taking place
-        std::vector<entry_ptr> machines;
-        for (auto& [_, entry] : _machines) {
-            /**
-             * We can simply check if a mutex is ready here as calling
-             * maybe_start_background_apply() will make the mutex underlying
-             * semaphore immediately not ready as there are no scheduling points
-             * before calling `get_units`
-             */
-            if (
-              entry->stm->next() == _next
-              && entry->background_apply_mutex.ready()) {
-                machines.push_back(entry);
+        if (snapshot_content_sz == 0) {
+            vlog(
+              _log.debug,
+              "applying empty snapshot at offset: {} for backward "
+              "compatibility",
+              last_offset);
+            co_await stm->apply_raft_snapshot(iobuf{});
+        } else {
+            iobuf_parser parser(std::move(snapshot_content));
+            auto snap = co_await serde::read_async<managed_snapshot>(parser);
+            auto it = snap.snapshot_map.find(ss::sstring(stm->get_name()));
+            if (it != snap.snapshot_map.end()) {
+                co_await stm->apply_raft_snapshot(std::move(it->second));
             }
         }
-        auto last_applied = co_await std::move(reader).consume(
-          batch_applicator(default_ctx, machines, _as, _log),
-          model::no_timeout);
-
-        _next = std::max(model::next_offset(last_applied), _next);
-        vlog(_log.trace, "updating _next offset with: {}", _next);
-    } catch (const ss::timed_out_error&) {
-        vlog(_log.debug, "state machine apply timeout");
-    } catch (const ss::abort_requested_exception&) {
-    } catch (const ss::gate_closed_exception&) {
-    } catch (const ss::broken_semaphore&) {
-    } catch (...) {
-        vlog(
-          _log.warn, "manager apply exception: {}", std::current_exception());
-    }
-    /**
-     * If any of the state machine is behind, dispatch background apply fibers
-     */
-    if (!_as.abort_requested()) {
-        for (auto& [_, entry] : _machines) {
-            maybe_start_background_apply(entry);
-        }
     }
+    stm->set_next(std::max(model::next_offset(last_offset), stm->next()));
 }
 
-void state_machine_manager::maybe_start_background_apply(
-  const entry_ptr& entry) {
-    if (likely(entry->stm->next() == _next)) {
-        return;
-    }
-
-    /**
-     * Do not wait for a mutex if background apply fiber is already active
-     */
-    if (!entry->background_apply_mutex.ready()) {
-        return;
-    }
-
-    vlog(
-      _log.debug,
-      "starting background apply fiber for '{}' state machine",
-      entry->stm->get_name());
-
-    ssx::spawn_with_gate(_gate, [this, entry] {
-        return entry->background_apply_mutex.get_units().then(
-          [this, entry](auto u) {
-              return ss::with_scheduling_group(
-                       _apply_sg,
-                       [this, entry] { return background_apply_fiber(entry); })
-                .finally([u = std::move(u)] {});
-          });
-    });
-}
-
-ss::future<> state_machine_manager::background_apply_fiber(entry_ptr entry) {
-    while (!_as.abort_requested() && entry->stm->next() < _next) {
-        storage::log_reader_config config(
-          entry->stm->next(), _next, ss::default_priority_class());
-
-        vlog(
-          _log.debug,
-          "reading batches in range [{}, {}] for '{}' stm background apply",
-          entry->stm->next(),
-          _next,
-          entry->stm->get_name());
+ss::future<> state_machine_manager::apply_fiber(entry_ptr entry) {
+    while (!_as.abort_requested()) {
         bool error = false;
         try {
-            model::record_batch_reader reader = co_await _raft->make_reader(
-              config);
-            co_await std::move(reader).consume(
-              batch_applicator(background_ctx, {entry}, _as, _log),
-              model::no_timeout);
-
+            co_await apply(entry);
+        } catch (const ss::abort_requested_exception&) {
+        } catch (const ss::gate_closed_exception&) {
+        } catch (const ss::broken_semaphore&) {
         } catch (...) {
             error = true;
             vlog(
               _log.warn,
-              "exception thrown from background apply fiber for {} - {}",
+              "error applying batches to '{}' state machine - {}",
               entry->stm->get_name(),
               std::current_exception());
         }
+        update_next();
         if (error) {
-            co_await ss::sleep_abortable(1s, _as);
+            // back off, the apply is retried from the STM next offset
+            co_await ss::sleep_abortable(1s, _as).handle_exception_type(
+              [](const ss::sleep_aborted&) {});
         }
     }
     vlog(
       _log.debug,
-      "finished background apply for '{}' state machine",
+      "finished apply fiber of '{}' state machine",
       entry->stm->get_name());
 }
 
+ss::future<> state_machine_manager::apply(const entry_ptr& entry) {
+    auto& stm = *entry->stm;
+    // wait until consensus commit index is >= stm next offset
+    co_await _raft->events().wait(stm.next(), model::no_timeout, _as);
+    auto u = co_await entry->apply_mutex.get_units(_as);
+
+    if (stm.next() < _raft->start_offset()) {
+        /**
+         * We need to return here as applied snapshot may not yet be
+         * committed.
+         */
+        co_return co_await apply_raft_snapshot(entry);
+    }
+
+    /**
+     * Raft make_reader method allows callers reading up to
+     * last_visible index. In order to make the STMs safe and working
+     * with the raft semantics (i.e. what is applied must be comitted)
+     * we have to limit reading to the committed offset.
+     */
+    vlog(
+      _log.trace,
+      "reading batches in range [{}, {}] for '{}' state machine",
+      stm.next(),
+      _raft->committed_offset(),
+      stm.get_name());
+    /**
+     * Use default priority for now, it is going to be unified with apply
+     * scheduling group soon
+     */
+    storage::log_reader_config config(
+      stm.next(),
+      _raft->committed_offset(),
+      0,
+      max_apply_bytes,
+      ss::default_priority_class(),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt);
+
+    model::record_batch_reader reader = co_await _raft->make_reader(config);
+    co_await std::move(reader).consume(
+      batch_applicator(entry, _as, _log), model::no_timeout);
+}
+
+void state_machine_manager::update_next() {
+    auto next = model::offset::max();
+    for (const auto& [_, entry] : _machines) {
+        next = std::min(next, entry->stm->next());
+    }
+    _next = std::max(_next, next);
+}
+
 ss::future<iobuf>
 state_machine_manager::take_snapshot(model::offset last_included_offset) {
     vlog(
@@ -444,9 +303,8 @@ state_machine_manager::take_snapshot(model::offset last_included_offset) {
     // wait for all STMs to be on the same page
     co_await wait(last_included_offset, model::no_timeout, _as);
 
-    auto u = co_await _apply_mutex.get_units();
-    // snapshot can only be taken  after  all background applies finished
-    auto units = co_await acquire_background_apply_mutexes();
+    // snapshot can only be taken when none of the STMs is applying batches
+    auto units = co_await acquire_apply_mutexes();
 
     managed_snapshot snapshot;
     co_await ss::coroutine::parallel_for_each(
@@ -474,11 +332,11 @@ ss::future<> state_machine_manager::wait(
 }
 
 ss::future<std::vector<ssx::semaphore_units>>
-state_machine_manager::acquire_background_apply_mutexes() {
+state_machine_manager::acquire_apply_mutexes() {
     std::vector<ss::future<ssx::semaphore_units>> futures;
     futures.reserve(_machines.size());
     for (auto& [_, entry] : _machines) {
-        futures.push_back(entry->background_apply_mutex.get_units(_as));
+        futures.push_back(entry->apply_mutex.get_units(_as));
     }
     return ss::when_all_succeed(futures.begin(), futures.end());
 }
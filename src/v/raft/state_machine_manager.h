@@ -20,6 +20,7 @@
 #include "serde/envelope.h"
 #include "storage/snapshot.h"
 #include "storage/types.h"
+#include "units.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/scheduling.hh>
@@ -42,12 +43,15 @@ concept StateMachineIterateFunc = requires(
 };
 /**
  * State machine manager is an entry point for registering state machines
- * built on top of replicated log. State machine managers uses a single
- * fiber to read and apply record batches to all managed state machines.
+ * built on top of replicated log. Every managed state machine is applied by
+ * its own fiber which reads committed batches from the log starting at the
+ * STM next offset. The STMs don't share state, so a slow STM doesn't delay
+ * the others, each of them makes progress independently.
  *
- * When a machine throws an exception or timeouts when applying batches to
- * its state subsequent applies are executed in the separate apply fiber
- * specific for that STM.
+ * A fiber reads at most max_apply_bytes at a time, the log reader is the
+ * only buffer between the log and the STM, a slow STM just reads less often.
+ * When a machine throws an exception when applying batches its fiber backs
+ * off and retries from the STM next offset.
  *
  * State machine manager also takes care of the snapshot consistency. It
  * wraps state machine snapshots in its own snapshot format which is a map
@@ -58,6 +62,9 @@ concept StateMachineIterateFunc = requires(
  */
 class state_machine_manager final {
 public:
+    // batches read from the log by an apply fiber in one go
+    static constexpr size_t max_apply_bytes = 512_KiB;
+
     // wait until at least offset is applied to all the state machines
     ss::future<> wait(
       model::offset,
@@ -75,6 +82,7 @@ public:
     ss::future<> start();
     ss::future<> stop();
 
+    // the offset applied to all the state machines
     model::offset last_applied() const { return model::prev_offset(_next); }
 
     template<StateMachineIterateFunc Func>
@@ -94,8 +102,6 @@ private:
 
     friend class batch_applicator;
     friend class state_machine_manager_builder;
-    static constexpr const char* default_ctx = "default";
-    static constexpr const char* background_ctx = "background";
 
     struct state_machine_entry {
         explicit state_machine_entry(ss::shared_ptr<state_machine_base> stm)
@@ -108,21 +114,24 @@ private:
         ~state_machine_entry() = default;
 
         ss::shared_ptr<state_machine_base> stm;
-        mutex background_apply_mutex;
+        // held by the apply fiber of the STM while it applies batches
+        mutex apply_mutex;
     };
     using entry_ptr = ss::lw_shared_ptr<state_machine_entry>;
     using state_machines_t = absl::flat_hash_map<ss::sstring, entry_ptr>;
 
-    void maybe_start_background_apply(const entry_ptr&);
-    ss::future<> background_apply_fiber(entry_ptr);
+    ss::future<> apply_fiber(entry_ptr);
+    ss::future<> apply(const entry_ptr&);
 
-    ss::future<> apply_raft_snapshot();
+    ss::future<> apply_raft_snapshot(const entry_ptr&);
     ss::future<> do_apply_raft_snapshot(
-      raft::snapshot_metadata metadata, storage::snapshot_reader& reader);
-    ss::future<> apply();
+      const entry_ptr&,
+      raft::snapshot_metadata metadata,
+      storage::snapshot_reader& reader);
+
+    void update_next();
 
-    ss::future<std::vector<ssx::semaphore_units>>
-    acquire_background_apply_mutexes();
+    ss::future<std::vector<ssx::semaphore_units>> acquire_apply_mutexes();
     /**
      * Simple data structure allowing manager to store independent snapshot
      * for each of the STMs
@@ -142,7 +151,6 @@ private:
 
     consensus* _raft;
     ctx_log _log;
-    mutex _apply_mutex;
     state_machines_t _machines;
     model::offset _next{0};
     ss::gate _gate;
@@ -172,3 +172,103 @@ TEST_F_CORO(
       [](auto& n) { return n.raft()->maybe_flush_log(0); });
     co_await wait_for_committed_offset(result.value().last_offset, 10s);
 }
+
+TEST_F_CORO(raft_fixture, test_follower_hibernation) {
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+    auto ids = all_ids();
+    auto follower_id = *std::find_if(
+      ids.begin(), ids.end(), [leader](model::node_id id) {
+          return id != leader;
+      });
+    auto follower = node(follower_id).raft();
+    co_await tests::cooperative_spin_wait_with_timeout(
+      10s, [follower, leader] { return follower->get_leader_id() == leader; });
+
+    // only followers hibernate
+    auto session = ss::make_lw_shared<lw_hibernation_session>();
+    ASSERT_FALSE_CORO(leader_node.raft()->hibernate(session));
+    ASSERT_TRUE_CORO(follower->hibernate(session));
+
+    // the heartbeats of the session are the heartbeats of the follower
+    session->last_heartbeat = clock_type::now() + 10s;
+    ASSERT_EQ_CORO(follower->last_heartbeat(), session->last_heartbeat);
+
+    // leaving another session is a no-op
+    follower->leave_hibernation(lw_hibernation_session{});
+    ASSERT_TRUE_CORO(follower->is_hibernating());
+    follower->leave_hibernation(*session);
+    ASSERT_FALSE_CORO(follower->is_hibernating());
+    ASSERT_TRUE_CORO(session->woken.empty());
+    ASSERT_EQ_CORO(follower->last_heartbeat(), session->last_heartbeat);
+
+    // an append from the leader wakes the follower up
+    ASSERT_TRUE_CORO(follower->hibernate(session));
+    auto result = co_await leader_node.raft()->replicate(
+      make_batches({{"k_1", "v_1"}}),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+    co_await tests::cooperative_spin_wait_with_timeout(
+      10s, [follower] { return !follower->is_hibernating(); });
+    ASSERT_EQ_CORO(session->woken.size(), 1);
+    ASSERT_EQ_CORO(session->woken[0], follower->group());
+}
+
+TEST_F_CORO(raft_fixture, test_write_caching) {
+    co_await create_simple_group(3);
+    for (auto& [_, n] : nodes()) {
+        co_await n->raft()->log()->update_configuration(
+          {.write_caching = true});
+    }
+    auto leader = co_await wait_for_leader(10s);
+    auto raft = node(leader).raft();
+
+    // acknowledged once a majority appended the entries, before any flush
+    auto result = co_await raft->replicate(
+      make_batches({{"k_1", "v_1"}, {"k_2", "v_2"}}),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+    ASSERT_GE_CORO(raft->last_visible_index(), result.value().last_offset);
+
+    // the background flush commits the entries
+    for (auto& [_, n] : nodes()) {
+        co_await n->raft()->maybe_flush_log(0);
+    }
+    co_await wait_for_committed_offset(result.value().last_offset, 10s);
+    co_await assert_logs_equal();
+}
+
+TEST_F_CORO(raft_fixture, test_observers) {
+    co_await create_simple_group(5);
+    for (auto& [_, n] : nodes()) {
+        co_await n->raft()->log()->update_configuration(
+          {.observer_replicas = 2});
+    }
+    auto leader = co_await wait_for_leader(10s);
+    auto raft = node(leader).raft();
+
+    // the leader demotes the voters one at a time
+    co_await tests::cooperative_spin_wait_with_timeout(10s, [raft] {
+        return raft->config().current_config().observers.size() == 2;
+    });
+    ASSERT_EQ_CORO(raft->config().current_config().voters.size(), 3);
+    ASSERT_FALSE_CORO(raft->config().is_observer(raft->self()));
+
+    // observers replicate the log without being part of the majority
+    auto result = co_await raft->replicate(
+      make_batches({{"k_1", "v_1"}, {"k_2", "v_2"}}),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+    co_await wait_for_committed_offset(result.value().last_offset, 10s);
+    co_await assert_logs_equal();
+
+    // and are turned back into voters when they are no longer requested
+    for (auto& [_, n] : nodes()) {
+        co_await n->raft()->log()->update_configuration({});
+    }
+    co_await tests::cooperative_spin_wait_with_timeout(10s, [raft] {
+        const auto& current = raft->config().current_config();
+        return current.observers.empty() && current.voters.size() == 5;
+    });
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "raft/follower_queue.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <vector>
+
+SEASTAR_THREAD_TEST_CASE(follower_queue_resize_window) {
+    raft::follower_queue q(2);
+    std::vector<ssx::semaphore_units> units;
+    units.push_back(q.get_append_entries_unit().get());
+    units.push_back(q.get_append_entries_unit().get());
+
+    auto waiting = q.get_append_entries_unit();
+    BOOST_REQUIRE(!waiting.available());
+
+    // growing the window releases the waiter right away
+    q.set_max_concurrent_append_entries(3);
+    units.push_back(waiting.get());
+
+    // shrinking the window doesn't affect requests in flight
+    q.set_max_concurrent_append_entries(1);
+    units.pop_back();
+    units.pop_back();
+    waiting = q.get_append_entries_unit();
+    BOOST_REQUIRE(!waiting.available());
+
+    units.pop_back();
+    units.push_back(waiting.get());
+    units.clear();
+    BOOST_REQUIRE(q.is_idle());
+}
@@ -118,3 +118,61 @@ BOOST_AUTO_TEST_CASE(test_reverting_configuration_change_when_adding) {
     BOOST_REQUIRE_EQUAL(test_grp.current_config().voters.size(), 1);
     BOOST_REQUIRE_EQUAL(test_grp.current_config().learners.size(), 0);
 }
+
+BOOST_AUTO_TEST_CASE(test_observers) {
+    std::vector<raft::vnode> nodes;
+    for (int i = 0; i < 5; ++i) {
+        nodes.emplace_back(model::node_id(i), model::revision_id(0));
+    }
+    raft::group_configuration test_grp(nodes, model::revision_id(0));
+
+    test_grp.demote_to_observer(nodes[3]);
+    test_grp.demote_to_observer(nodes[4]);
+    BOOST_REQUIRE_EQUAL(
+      test_grp.get_state(), raft::configuration_state::simple);
+    BOOST_REQUIRE_EQUAL(test_grp.current_config().voters.size(), 3);
+    BOOST_REQUIRE(test_grp.is_observer(nodes[3]));
+    BOOST_REQUIRE(!test_grp.is_voter(nodes[3]));
+    BOOST_REQUIRE(test_grp.contains(nodes[4]));
+    BOOST_REQUIRE(!test_grp.is_allowed_to_request_votes(nodes[4]));
+
+    // observers are part of the replica set
+    test_grp.replace(nodes, model::revision_id(1), std::nullopt);
+    BOOST_REQUIRE_EQUAL(
+      test_grp.get_state(), raft::configuration_state::simple);
+    BOOST_REQUIRE_EQUAL(test_grp.current_config().observers.size(), 2);
+    BOOST_REQUIRE_EQUAL(test_grp.revision_id(), model::revision_id(1));
+
+    // an observer turned back into a learner is promoted like a new replica
+    test_grp.revert_observer(nodes[4]);
+    BOOST_REQUIRE(!test_grp.is_observer(nodes[4]));
+    BOOST_REQUIRE_EQUAL(test_grp.current_config().learners.size(), 2);
+    test_grp.promote_to_voter(nodes[4]);
+    BOOST_REQUIRE(test_grp.is_voter(nodes[4]));
+}
+
+BOOST_AUTO_TEST_CASE(test_changing_configuration_with_observers) {
+    std::vector<raft::vnode> nodes;
+    for (int i = 0; i < 5; ++i) {
+        nodes.emplace_back(model::node_id(i), model::revision_id(0));
+    }
+    raft::group_configuration test_grp(nodes, model::revision_id(0));
+    test_grp.demote_to_observer(nodes[3]);
+    test_grp.demote_to_observer(nodes[4]);
+
+    // the observer which is kept is added back as a learner, the removed one
+    // is dropped right away
+    raft::vnode new_node(model::node_id(5), model::revision_id(1));
+    test_grp.replace(
+      {nodes[0], nodes[1], nodes[2], nodes[3], new_node},
+      model::revision_id(1),
+      std::nullopt);
+    BOOST_REQUIRE_EQUAL(
+      test_grp.get_state(), raft::configuration_state::transitional);
+    BOOST_REQUIRE(test_grp.current_config().observers.empty());
+    BOOST_REQUIRE(!test_grp.contains(nodes[4]));
+    BOOST_REQUIRE_EQUAL(test_grp.current_config().voters.size(), 3);
+    BOOST_REQUIRE_EQUAL(
+      test_grp.current_config().learners,
+      std::vector<raft::vnode>({nodes[3], new_node}));
+}
@@ -100,6 +100,26 @@ struct fixture {
         return req;
     }
 
+    /**
+     * Lightweight heartbeats encoded as a delta of the set acknowledged by
+     * the follower, \p changed_pct percent of the groups left the set.
+     */
+    raft::heartbeat_request_v2 make_lw_delta_request(int changed_pct) {
+        raft::heartbeat_request_v2 req(
+          old_req.heartbeats.front().node_id.id(),
+          old_req.heartbeats.front().target_node_id.id());
+        raft::heartbeat_request_v2::lw_groups_t base;
+        raft::heartbeat_request_v2::lw_groups_t current;
+        for (auto& hb_meta : old_req.heartbeats) {
+            base.push_back(hb_meta.meta.group);
+            if (random_generators::get_int(0, 99) >= changed_pct) {
+                current.push_back(hb_meta.meta.group);
+            }
+        }
+        req.set_lw_heartbeats(1, 2, 1, base, current);
+        return req;
+    }
+
     raft::heartbeat_reply make_reply() {
         raft::heartbeat_reply reply;
         reply.meta.reserve(old_req.heartbeats.size());
@@ -159,6 +179,12 @@ struct fixture {
         new_reply_full = make_new_reply(new_req_full);
         new_reply_mixed = make_new_reply(new_req_mixed);
         new_reply_lw = make_new_reply(new_req_lw);
+        new_req_lw_delta_idle = make_lw_delta_request(0);
+        new_req_lw_delta_changed = make_lw_delta_request(1);
+        // only the heartbeats which didn't succeed are listed
+        new_reply_lw_delta = raft::heartbeat_reply_v2(
+          new_req_lw.target(), new_req_lw.source());
+        new_reply_lw_delta.set_lw_acked_seq(2);
     }
 
     raft::heartbeat_request old_req;
@@ -166,11 +192,14 @@ struct fixture {
     raft::heartbeat_request_v2 new_req_full;
     raft::heartbeat_request_v2 new_req_mixed;
     raft::heartbeat_request_v2 new_req_lw;
+    raft::heartbeat_request_v2 new_req_lw_delta_idle;
+    raft::heartbeat_request_v2 new_req_lw_delta_changed;
 
     raft::heartbeat_reply old_reply;
     raft::heartbeat_reply_v2 new_reply_full;
     raft::heartbeat_reply_v2 new_reply_mixed;
     raft::heartbeat_reply_v2 new_reply_lw;
+    raft::heartbeat_reply_v2 new_reply_lw_delta;
 
     size_t cnt = 0;
     size_t sz = 0;
@@ -203,6 +232,14 @@ PERF_TEST_C(fixture, test_new_hb_request_lw) {
     co_await test_serde_write(new_req_lw);
 }
 
+PERF_TEST_C(fixture, test_new_hb_request_lw_delta_idle) {
+    co_await test_serde_write(new_req_lw_delta_idle);
+}
+
+PERF_TEST_C(fixture, test_new_hb_request_lw_delta_changed) {
+    co_await test_serde_write(new_req_lw_delta_changed);
+}
+
 PERF_TEST_C(fixture, test_old_hb_reply) {
     perf_tests::start_measuring_time();
 
@@ -225,3 +262,7 @@ PERF_TEST_C(fixture, test_new_hb_reply_mixed) {
 PERF_TEST_C(fixture, test_new_hb_reply_lw) {
     co_await test_serde_write(new_reply_lw);
 }
+
+PERF_TEST_C(fixture, test_new_hb_reply_lw_delta) {
+    co_await test_serde_write(new_reply_lw_delta);
+}
@@ -202,3 +202,81 @@ SEASTAR_THREAD_TEST_CASE(heartbeat_request_for_each) {
     BOOST_REQUIRE_EQUAL(expected.size(), actual.size());
     BOOST_REQUIRE(expected == actual);
 }
+
+namespace {
+raft::heartbeat_request_v2::lw_groups_t
+to_lw_groups(const std::vector<raft::group_id>& groups) {
+    raft::heartbeat_request_v2::lw_groups_t ret;
+    for (auto g : groups) {
+        ret.push_back(g);
+    }
+    return ret;
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(heartbeat_request_lw_delta) {
+    auto groups = random_group_list();
+    auto base = to_lw_groups(groups);
+
+    // some groups leave the set, e.g. because they need a full heartbeat
+    // and some new ones join it
+    std::vector<raft::group_id> current_groups;
+    for (auto g : groups) {
+        if (random_generators::get_int(0, 100) > 5) {
+            current_groups.push_back(g);
+        }
+    }
+    for (int i = 1; i <= 10; ++i) {
+        current_groups.push_back(groups.back() + raft::group_id(i));
+    }
+    auto current = to_lw_groups(current_groups);
+
+    raft::heartbeat_request_v2 req(
+      tests::random_named_int<model::node_id>(),
+      tests::random_named_int<model::node_id>());
+    req.set_lw_heartbeats(1, 2, 1, base, current);
+    BOOST_REQUIRE(req.has_lw_session());
+    BOOST_REQUIRE_EQUAL(req.lw_base_seq(), 1);
+    BOOST_REQUIRE_EQUAL(req.lw_seq(), 2);
+    serde_rt(req);
+
+    iobuf buf;
+    serde::write_async(buf, req.copy()).get();
+    iobuf_parser parser(std::move(buf));
+    auto decoded = serde::read_async<raft::heartbeat_request_v2>(parser).get();
+
+    auto applied = decoded.apply_lw_delta(base);
+    BOOST_REQUIRE(applied.has_value());
+    BOOST_REQUIRE(*applied == current);
+
+    // the delta doesn't match an unrelated base set
+    BOOST_REQUIRE(!decoded.apply_lw_delta({}).has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(heartbeat_request_lw_delta_idle) {
+    auto base = to_lw_groups(random_group_list());
+    raft::heartbeat_request_v2 full(
+      tests::random_named_int<model::node_id>(),
+      tests::random_named_int<model::node_id>());
+    full.set_lw_heartbeats(1, 1, 0, {}, base);
+    auto applied = full.apply_lw_delta({});
+    BOOST_REQUIRE(applied.has_value());
+    BOOST_REQUIRE(*applied == base);
+
+    // nothing changed, the request is independent of the number of groups
+    raft::heartbeat_request_v2 idle(full.source(), full.target());
+    idle.set_lw_heartbeats(1, 2, 1, base, base);
+    applied = idle.apply_lw_delta(base);
+    BOOST_REQUIRE(applied.has_value());
+    BOOST_REQUIRE(*applied == base);
+
+    iobuf full_buf;
+    serde::write_async(full_buf, full.copy()).get();
+    iobuf idle_buf;
+    serde::write_async(idle_buf, idle.copy()).get();
+    BOOST_REQUIRE_LT(idle_buf.size_bytes(), full_buf.size_bytes());
+
+    raft::heartbeat_reply_v2 reply(full.target(), full.source());
+    reply.set_lw_acked_seq(2);
+    serde_rt(reply);
+}
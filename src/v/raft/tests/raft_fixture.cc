@@ -209,6 +209,33 @@ ss::future<> channel::dispatch_loop() {
                 msg.resp_data.set_value(std::move(resp_buf));
                 break;
             }
+            case msg_type::append_entries_batch: {
+                auto req
+                  = co_await serde::read_async<append_entries_batch_request>(
+                    req_parser);
+                append_entries_batch_reply reply;
+                for (auto& r : std::move(req).release()) {
+                    reply.replies.push_back(
+                      co_await raft()->append_entries(std::move(r)));
+                }
+                iobuf resp_buf;
+                co_await serde::write_async(resp_buf, std::move(reply));
+                msg.resp_data.set_value(std::move(resp_buf));
+                break;
+            }
+            case msg_type::vote_batch: {
+                auto req = co_await serde::read_async<vote_batch_request>(
+                  req_parser);
+                vote_batch_reply reply;
+                for (auto& r : req.requests) {
+                    reply.replies.push_back(
+                      co_await raft()->vote(std::move(r)));
+                }
+                iobuf resp_buf;
+                co_await serde::write_async(resp_buf, std::move(reply));
+                msg.resp_data.set_value(std::move(resp_buf));
+                break;
+            }
             }
         } catch (...) {
             msg.resp_data.set_to_current_exception();
@@ -267,6 +294,10 @@ static constexpr msg_type map_msg_type() {
         return msg_type::timeout_now;
     } else if constexpr (std::is_same_v<ReqT, transfer_leadership_request>) {
         return msg_type::transfer_leadership;
+    } else if constexpr (std::is_same_v<ReqT, append_entries_batch_request>) {
+        return msg_type::append_entries_batch;
+    } else if constexpr (std::is_same_v<ReqT, vote_batch_request>) {
+        return msg_type::vote_batch;
     }
     __builtin_unreachable();
 }
@@ -323,6 +354,18 @@ in_memory_test_protocol::append_entries(
       id, std::move(req));
 };
 
+ss::future<result<append_entries_batch_reply>>
+in_memory_test_protocol::append_entries_batch(
+  model::node_id id, append_entries_batch_request&& req, rpc::client_opts) {
+    return dispatch<append_entries_batch_request, append_entries_batch_reply>(
+      id, std::move(req));
+}
+
+ss::future<result<vote_batch_reply>> in_memory_test_protocol::vote_batch(
+  model::node_id id, vote_batch_request&& req, rpc::client_opts) {
+    return dispatch<vote_batch_request, vote_batch_reply>(id, std::move(req));
+}
+
 ss::future<result<heartbeat_reply>> in_memory_test_protocol::heartbeat(
   model::node_id id, heartbeat_request&& req, rpc::client_opts) {
     return dispatch<heartbeat_request, heartbeat_reply>(id, std::move(req));
@@ -416,6 +459,15 @@ raft_node_instance::initialise(std::vector<raft::vnode> initial_nodes) {
       _features.local());
     co_await _hb_manager->start();
 
+    _recovery_batcher = std::make_unique<recovery_batcher>(
+      consensus_client_protocol(_protocol),
+      _features.local(),
+      config::mock_binding<std::optional<size_t>>(std::nullopt));
+    _vote_batcher = std::make_unique<vote_batcher>(
+      consensus_client_protocol(_protocol),
+      _features.local(),
+      config::mock_binding<bool>(false));
+
     co_await _recovery_throttle.start(
       config::mock_binding<size_t>(100_MiB), config::mock_binding<bool>(false));
     co_await _recovery_throttle.invoke_on_all(
@@ -451,6 +503,8 @@ raft_node_instance::initialise(std::vector<raft::vnode> initial_nodes) {
       _recovery_throttle.local(),
       _recovery_mem_quota,
       _recovery_scheduler,
+      *_recovery_batcher,
+      *_vote_batcher,
       _features.local());
     co_await _hb_manager->register_group(_raft);
 }
@@ -476,6 +530,10 @@ ss::future<> raft_node_instance::stop() {
         co_await _protocol->stop();
         vlog(_logger.debug, "stopping raft");
         co_await _raft->stop();
+        vlog(_logger.debug, "stopping recovery batcher");
+        co_await _recovery_batcher->stop();
+        vlog(_logger.debug, "stopping vote batcher");
+        co_await _vote_batcher->stop();
         vlog(_logger.debug, "stopping recovery throttle");
         co_await _recovery_throttle.stop();
         vlog(_logger.debug, "stopping log");
@@ -699,6 +757,12 @@ std::ostream& operator<<(std::ostream& o, msg_type type) {
     case msg_type::transfer_leadership:
         o << "transfer_leadership";
         return o;
+    case msg_type::append_entries_batch:
+        o << "append_entries_batch";
+        return o;
+    case msg_type::vote_batch:
+        o << "vote_batch";
+        return o;
     }
 }
 
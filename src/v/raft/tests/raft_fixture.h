@@ -56,6 +56,8 @@ enum class msg_type {
     install_snapshot,
     timeout_now,
     transfer_leadership,
+    append_entries_batch,
+    vote_batch,
 };
 
 struct msg {
@@ -104,6 +106,12 @@ public:
       rpc::client_opts,
       bool use_all_serde_encoding) final;
 
+    ss::future<result<append_entries_batch_reply>> append_entries_batch(
+      model::node_id, append_entries_batch_request&&, rpc::client_opts) final;
+
+    ss::future<result<vote_batch_reply>>
+    vote_batch(model::node_id, vote_batch_request&&, rpc::client_opts) final;
+
     ss::future<result<heartbeat_reply>>
     heartbeat(model::node_id, heartbeat_request&&, rpc::client_opts) final;
 
@@ -237,6 +245,8 @@ private:
     ss::sharded<coordinated_recovery_throttle> _recovery_throttle;
     recovery_memory_quota _recovery_mem_quota;
     recovery_scheduler _recovery_scheduler;
+    std::unique_ptr<recovery_batcher> _recovery_batcher;
+    std::unique_ptr<vote_batcher> _vote_batcher;
     std::unique_ptr<heartbeat_manager> _hb_manager;
     leader_update_clb_t _leader_clb;
     ss::lw_shared_ptr<consensus> _raft;
@@ -167,6 +167,14 @@ struct raft_node {
 
         // setup consensus
         auto self_id = this->broker.id();
+        recovery_batcher = std::make_unique<raft::recovery_batcher>(
+          raft::make_rpc_client_protocol(self_id, cache),
+          feature_table.local(),
+          config::mock_binding<std::optional<size_t>>(std::nullopt));
+        vote_batcher = std::make_unique<raft::vote_batcher>(
+          raft::make_rpc_client_protocol(self_id, cache),
+          feature_table.local(),
+          config::mock_binding<bool>(false));
         consensus = ss::make_lw_shared<raft::consensus>(
           self_id,
           gr_id,
@@ -183,6 +191,8 @@ struct raft_node {
           recovery_throttle.local(),
           recovery_mem_quota,
           recovery_scheduler.local(),
+          *recovery_batcher,
+          *vote_batcher,
           feature_table.local(),
           std::nullopt);
     }
@@ -213,7 +223,8 @@ struct raft_node {
                 raft_manager,
                 *this,
                 heartbeat_interval,
-                broker.id());
+                broker.id(),
+                config::mock_binding<bool>(true));
           })
           .get0();
         server.invoke_on_all(&rpc::rpc_server::start).get0();
@@ -293,6 +304,14 @@ struct raft_node {
                 "Stopping recovery_scheduler at node {}", broker.id());
               return recovery_scheduler.stop();
           })
+          .then([this] {
+              tstlog.info("Stopping recovery_batcher at node {}", broker.id());
+              return recovery_batcher->stop();
+          })
+          .then([this] {
+              tstlog.info("Stopping vote_batcher at node {}", broker.id());
+              return vote_batcher->stop();
+          })
           .then([this] {
               tstlog.info("Stopping cache at node {}", broker.id());
               return cache.stop();
@@ -353,6 +372,8 @@ struct raft_node {
     ss::sharded<storage::api> storage;
     ss::sharded<raft::coordinated_recovery_throttle> recovery_throttle;
     ss::sharded<raft::recovery_scheduler> recovery_scheduler;
+    std::unique_ptr<raft::recovery_batcher> recovery_batcher;
+    std::unique_ptr<raft::vote_batcher> vote_batcher;
     ss::shared_ptr<storage::log> log;
     ss::sharded<ss::abort_source> as_service;
     ss::sharded<rpc::connection_cache> cache;
@@ -97,6 +97,9 @@ struct simple_raft_fixture {
                   .replica_max_not_flushed_bytes
                   = config::mock_binding<std::optional<size_t>>(std::nullopt),
                   .flush_timer_interval_ms = config::mock_binding(100ms),
+                  .recovery_batch_max_bytes
+                  = config::mock_binding<std::optional<size_t>>(std::nullopt),
+                  .enable_vote_batching = config::mock_binding<bool>(false),
 
                 };
             },
@@ -9,6 +9,9 @@
 
 #include "raft/tests/stm_test_fixture.h"
 
+#include <seastar/core/shared_future.hh>
+#include <seastar/util/defer.hh>
+
 using namespace raft;
 
 inline ss::logger logger("stm-test-logger");
@@ -49,6 +52,31 @@ struct throwing_kv : public simple_kv {
 
     bool _tried_applying = false;
 };
+/**
+ * Doesn't apply any batches until it is unblocked.
+ */
+struct blocked_kv : public simple_kv {
+    explicit blocked_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    std::string_view get_name() const override { return "blocked_kv"; };
+
+    ss::future<> apply(const model::record_batch& batch) override {
+        co_await _unblocked.get_shared_future();
+        co_await simple_kv::apply(batch);
+    }
+
+    void unblock() {
+        if (!_is_unblocked) {
+            _is_unblocked = true;
+            _unblocked.set_value();
+        }
+    }
+
+    ss::shared_promise<> _unblocked;
+    bool _is_unblocked = false;
+};
+
 /**
  * Local snapshot stm manages its own local snapshot.
  */
@@ -129,6 +157,44 @@ TEST_F_CORO(state_machine_fixture, test_apply_throwing_exception) {
     }
 }
 
+TEST_F_CORO(state_machine_fixture, test_slow_stm_does_not_block_others) {
+    create_nodes();
+    std::vector<ss::shared_ptr<simple_kv>> stms;
+    std::vector<ss::shared_ptr<blocked_kv>> blocked_stms;
+
+    for (auto& [id, node] : nodes()) {
+        raft::state_machine_manager_builder builder;
+        stms.push_back(builder.create_stm<simple_kv>(*node));
+        blocked_stms.push_back(builder.create_stm<blocked_kv>(*node));
+        co_await node->init_and_start(all_vnodes(), std::move(builder));
+    }
+    auto unblock = ss::defer([&blocked_stms] {
+        for (auto& stm : blocked_stms) {
+            stm->unblock();
+        }
+    });
+
+    auto expected = co_await build_random_state(1000);
+    auto committed_offset = co_await with_leader(
+      10s,
+      [](raft_node_instance& node) { return node.raft()->committed_offset(); });
+
+    // the STMs make progress while the other STM of the partition is blocked
+    for (auto& stm : stms) {
+        co_await stm->wait(committed_offset, model::timeout_clock::now() + 10s);
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+    for (auto& stm : blocked_stms) {
+        ASSERT_TRUE_CORO(stm->state.empty());
+        stm->unblock();
+    }
+
+    co_await wait_for_apply();
+    for (auto& stm : blocked_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+}
+
 TEST_F_CORO(state_machine_fixture, test_recovery_without_snapshot) {
     /**
      * Create 3 replicas group with simple_kv STM
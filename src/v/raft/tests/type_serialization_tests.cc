@@ -618,3 +618,81 @@ SEASTAR_THREAD_TEST_CASE(append_entries_request_serde_wrapper_serde) {
       .consume(checking_consumer(std::move(batches_result)), model::no_timeout)
       .get0();
 }
+
+SEASTAR_THREAD_TEST_CASE(append_entries_batch_request_serde) {
+    std::vector<raft::append_entries_request> requests;
+    std::vector<model::record_batch_reader> expected;
+    for (int i = 0; i < 3; ++i) {
+        auto batches = model::test::make_random_batches(
+          model::offset(1), 3, false);
+        auto rdr = model::make_memory_record_batch_reader(std::move(batches));
+        auto readers = raft::details::share_n(std::move(rdr), 2).get0();
+        requests.emplace_back(
+          raft::vnode(model::node_id(1), model::revision_id(10)),
+          raft::vnode(model::node_id(10), model::revision_id(101)),
+          raft::protocol_metadata{
+            .group = raft::group_id(i),
+            .commit_index = model::offset(100),
+            .term = model::term_id(10),
+          },
+          std::move(readers.back()));
+        readers.pop_back();
+        expected.push_back(std::move(readers.back()));
+    }
+
+    iobuf buf;
+    serde::write_async(
+      buf, raft::append_entries_batch_request(std::move(requests)))
+      .get();
+    iobuf_parser parser(std::move(buf));
+    auto decoded
+      = serde::read_async<raft::append_entries_batch_request>(parser)
+          .get()
+          .release();
+
+    BOOST_REQUIRE_EQUAL(decoded.size(), expected.size());
+    for (size_t i = 0; i < decoded.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(
+          decoded[i].metadata().group, raft::group_id(static_cast<int>(i)));
+        auto batches_result = model::consume_reader_to_memory(
+                                std::move(expected[i]), model::no_timeout)
+                                .get0();
+        std::move(decoded[i])
+          .release_batches()
+          .consume(
+            checking_consumer(std::move(batches_result)), model::no_timeout)
+          .get0();
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(vote_batch_roundtrip) {
+    raft::vote_batch_request request;
+    raft::vote_batch_reply reply;
+    for (int i = 0; i < 3; ++i) {
+        request.requests.push_back(raft::vote_request{
+          .node_id = raft::vnode(model::node_id(1), model::revision_id(10)),
+          .target_node_id = raft::vnode(
+            model::node_id(2), model::revision_id(11)),
+          .group = raft::group_id(i),
+          .term = model::term_id(5),
+          .prev_log_index = model::offset(100 + i),
+          .prev_log_term = model::term_id(4),
+          .leadership_transfer = i == 1,
+        });
+        reply.replies.push_back(raft::vote_reply{
+          .target_node_id = raft::vnode(
+            model::node_id(1), model::revision_id(10)),
+          .term = model::term_id(5),
+          .granted = i != 2,
+          .log_ok = true,
+          .node_id = raft::vnode(model::node_id(2), model::revision_id(11)),
+        });
+    }
+
+    auto decoded_request = serde::from_iobuf<raft::vote_batch_request>(
+      serde::to_iobuf(request));
+    BOOST_REQUIRE(decoded_request == request);
+    auto decoded_reply = serde::from_iobuf<raft::vote_batch_reply>(
+      serde::to_iobuf(reply));
+    BOOST_REQUIRE(decoded_reply == reply);
+}
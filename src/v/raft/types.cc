@@ -729,6 +729,52 @@ append_entries_request_serde_wrapper::serde_async_direct_read(
       flush);
 }
 
+ss::future<> append_entries_batch_request::serde_async_write(iobuf& dst) {
+    serde::write(dst, static_cast<uint32_t>(_requests.size()));
+    for (auto& r : _requests) {
+        co_await serde::write_async(
+          dst, append_entries_request_serde_wrapper(std::move(r)));
+    }
+    _requests.clear();
+}
+
+ss::future<append_entries_batch_request>
+append_entries_batch_request::serde_async_direct_read(
+  iobuf_parser& src, serde::header h) {
+    auto count = serde::read_nested<uint32_t>(src, 0U);
+
+    std::vector<append_entries_request> requests;
+    requests.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        auto wrapper = co_await serde::read_async_nested<
+          append_entries_request_serde_wrapper>(src, h._bytes_left_limit);
+        requests.push_back(std::move(wrapper).release());
+    }
+
+    co_return append_entries_batch_request(std::move(requests));
+}
+
+std::ostream&
+operator<<(std::ostream& o, const append_entries_batch_request& r) {
+    fmt::print(o, "{{requests: {}}}", r._requests.size());
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const append_entries_batch_reply& r) {
+    fmt::print(o, "{{replies: {}}}", r.replies.size());
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const vote_batch_request& r) {
+    fmt::print(o, "{{requests: {}}}", r.requests.size());
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const vote_batch_reply& r) {
+    fmt::print(o, "{{replies: {}}}", r.replies.size());
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const append_entries_request& r) {
     fmt::print(
       o,
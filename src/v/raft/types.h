@@ -203,6 +203,7 @@ struct follower_index_metadata {
 struct follower_metrics {
     model::node_id id;
     bool is_learner;
+    bool is_observer;
     model::offset committed_log_index;
     model::offset dirty_log_index;
     model::offset match_index;
@@ -370,6 +371,59 @@ struct append_entries_reply
     }
 };
 
+/// \brief recovery append entries requests of many raft groups sent to the
+/// same target node in a single RPC. The requests are dispatched to their
+/// groups independently and the reply contains a reply for each request in
+/// the same order.
+class append_entries_batch_request
+  : public serde::envelope<
+      append_entries_batch_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+public:
+    using rpc_adl_exempt = std::true_type;
+
+    explicit append_entries_batch_request(
+      std::vector<append_entries_request> requests)
+      : _requests(std::move(requests)) {}
+
+    size_t size() const { return _requests.size(); }
+
+    std::vector<append_entries_request> release() && {
+        return std::move(_requests);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const append_entries_batch_request& r);
+
+    ss::future<> serde_async_write(iobuf& out);
+
+    static ss::future<append_entries_batch_request>
+    serde_async_direct_read(iobuf_parser&, serde::header);
+
+private:
+    std::vector<append_entries_request> _requests;
+};
+
+struct append_entries_batch_reply
+  : serde::envelope<
+      append_entries_batch_reply,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    std::vector<append_entries_reply> replies;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const append_entries_batch_reply& r);
+
+    friend bool operator==(
+      const append_entries_batch_reply&, const append_entries_batch_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(replies); }
+};
+
 struct heartbeat_metadata {
     protocol_metadata meta;
     vnode node_id;
@@ -487,6 +541,44 @@ struct vote_reply
     }
 };
 
+/// \brief vote and prevote requests of many raft groups sent to the same
+/// target node in a single RPC. The reply contains a reply for each request
+/// in the same order.
+struct vote_batch_request
+  : serde::envelope<
+      vote_batch_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    std::vector<vote_request> requests;
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const vote_batch_request& r);
+
+    friend bool operator==(const vote_batch_request&, const vote_batch_request&)
+      = default;
+
+    auto serde_fields() { return std::tie(requests); }
+};
+
+struct vote_batch_reply
+  : serde::envelope<
+      vote_batch_reply,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    std::vector<vote_reply> replies;
+
+    friend std::ostream& operator<<(std::ostream& o, const vote_batch_reply& r);
+
+    friend bool operator==(const vote_batch_reply&, const vote_batch_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(replies); }
+};
+
 /// This structure is used by consensus to notify other systems about group
 /// leadership changes.
 struct leadership_status {
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "raft/vote_batcher.h"
+
+#include "features/feature_table.h"
+#include "raft/errc.h"
+#include "raft/logger.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+namespace raft {
+
+vote_batcher::vote_batcher(
+  consensus_client_protocol client,
+  features::feature_table& features,
+  config::binding<bool> enabled)
+  : _client(std::move(client))
+  , _features(features)
+  , _enabled(std::move(enabled)) {}
+
+ss::future<> vote_batcher::stop() { return _gate.close(); }
+
+bool vote_batcher::is_enabled() const {
+    return _enabled()
+           && _features.is_active(features::feature::raft_vote_batch);
+}
+
+ss::future<result<vote_reply>> vote_batcher::vote(
+  model::node_id target, vote_request&& r, rpc::client_opts opts) {
+    if (!is_enabled()) {
+        return _client.vote(target, std::move(r), std::move(opts));
+    }
+    if (_gate.is_closed()) {
+        return ss::make_ready_future<result<vote_reply>>(errc::shutting_down);
+    }
+
+    ss::promise<result<vote_reply>> p;
+    auto f = p.get_future();
+    auto [it, inserted] = _queues.try_emplace(target);
+    it->second.push_back(pending_request{
+      .request = std::move(r),
+      .opts = std::move(opts),
+      .promise = std::move(p),
+    });
+    if (inserted) {
+        ssx::spawn_with_gate(
+          _gate, [this, target] { return dispatch_loop(target); });
+    }
+    return f;
+}
+
+ss::future<> vote_batcher::dispatch_loop(model::node_id target) {
+    while (true) {
+        // the queue is looked up in every iteration as the map may rehash
+        // while the batch is in flight
+        auto it = _queues.find(target);
+        if (it->second.empty()) {
+            _queues.erase(it);
+            co_return;
+        }
+        auto& queue = it->second;
+
+        pending_requests_t batch;
+        batch.reserve(std::min(queue.size(), max_batch_size));
+        while (!queue.empty() && batch.size() < max_batch_size) {
+            batch.push_back(std::move(queue.front()));
+            queue.pop_front();
+        }
+        co_await dispatch_batch(target, std::move(batch));
+    }
+}
+
+ss::future<> vote_batcher::dispatch_batch(
+  model::node_id target, pending_requests_t batch) {
+    if (batch.size() == 1) {
+        auto& req = batch.front();
+        try {
+            auto reply = co_await _client.vote(
+              target, std::move(req.request), std::move(req.opts));
+            req.promise.set_value(std::move(reply));
+        } catch (...) {
+            req.promise.set_to_current_exception();
+        }
+        co_return;
+    }
+
+    // requests that timed out while queued are not sent, the batch is sent
+    // with the shortest timeout of the remaining ones
+    const auto now = rpc::clock_type::now();
+    auto timeout = rpc::clock_type::time_point::max();
+    vote_batch_request request;
+    request.requests.reserve(batch.size());
+    pending_requests_t sent;
+    sent.reserve(batch.size());
+    for (auto& req : batch) {
+        if (req.opts.timeout.timeout_at() <= now) {
+            req.promise.set_value(errc::timeout);
+            continue;
+        }
+        timeout = std::min(timeout, req.opts.timeout.timeout_at());
+        request.requests.push_back(std::move(req.request));
+        sent.push_back(std::move(req));
+    }
+    if (sent.empty()) {
+        co_return;
+    }
+    vlog(
+      raftlog.trace,
+      "dispatching {} vote requests to node {}",
+      request.requests.size(),
+      target);
+
+    try {
+        auto reply = co_await _client.vote_batch(
+          target, std::move(request), rpc::client_opts(timeout));
+
+        if (reply.has_error()) {
+            for (auto& req : sent) {
+                req.promise.set_value(reply.error());
+            }
+            co_return;
+        }
+        auto& replies = reply.value().replies;
+        if (replies.size() != sent.size()) {
+            vlog(
+              raftlog.warn,
+              "unexpected number of vote batch replies from node {}, "
+              "expected: {}, got: {}",
+              target,
+              sent.size(),
+              replies.size());
+            for (auto& req : sent) {
+                req.promise.set_value(errc::vote_dispatch_error);
+            }
+            co_return;
+        }
+        for (size_t i = 0; i < sent.size(); ++i) {
+            sent[i].promise.set_value(replies[i]);
+        }
+    } catch (...) {
+        auto e = std::current_exception();
+        for (auto& req : sent) {
+            req.promise.set_exception(e);
+        }
+    }
+}
+
+} // namespace raft
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "config/property.h"
+#include "features/fwd.h"
+#include "model/metadata.h"
+#include "outcome.h"
+#include "raft/consensus_client_protocol.h"
+#include "raft/types.h"
+#include "rpc/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/chunked_fifo.hh>
+#include <seastar/core/gate.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <vector>
+
+namespace raft {
+
+/**
+ * Shard local batcher of vote and prevote requests.
+ *
+ * When a node fails, the elections of all the groups it led start at about
+ * the same time, and every vote_stm and prevote_stm sends its own request to
+ * each peer. The requests of the groups of a shard that are sent to the same
+ * node are coalesced into a single vote_batch RPC, like the recovery
+ * requests in recovery_batcher: a request is sent right away if nothing is
+ * in flight to its target node, otherwise it is queued and sent with the
+ * other requests queued in the meantime as soon as the in flight RPC
+ * finishes. A single election isn't delayed, while a mass election sends a
+ * few RPCs per round trip instead of one per group.
+ *
+ * Batching is enabled by the raft_enable_vote_batching property.
+ */
+class vote_batcher {
+public:
+    /// Upper bound of the number of requests in a batch
+    static constexpr size_t max_batch_size = 1024;
+
+    vote_batcher(
+      consensus_client_protocol,
+      features::feature_table&,
+      config::binding<bool> enabled);
+
+    ss::future<> stop();
+
+    /// Send a vote or prevote request to the target node, coalesced with
+    /// the requests of other groups if batching is enabled
+    ss::future<result<vote_reply>>
+    vote(model::node_id, vote_request&&, rpc::client_opts);
+
+private:
+    struct pending_request {
+        vote_request request;
+        rpc::client_opts opts;
+        ss::promise<result<vote_reply>> promise;
+    };
+    using pending_requests_t = std::vector<pending_request>;
+
+    bool is_enabled() const;
+
+    ss::future<> dispatch_loop(model::node_id);
+    ss::future<> dispatch_batch(model::node_id, pending_requests_t);
+
+    consensus_client_protocol _client;
+    features::feature_table& _features;
+    config::binding<bool> _enabled;
+    /**
+     * Requests waiting for the in flight RPC to their target node. A node is
+     * present in the map as long as its dispatch loop is running.
+     */
+    absl::flat_hash_map<model::node_id, ss::chunked_fifo<pending_request>>
+      _queues;
+    ss::gate _gate;
+};
+
+} // namespace raft
@@ -54,7 +54,7 @@ ss::future<result<vote_reply>> vote_stm::do_dispatch_one(vnode n) {
     auto r = _req;
     _ptr->_probe->vote_request_sent();
     r.target_node_id = n;
-    return _ptr->_client_protocol
+    return _ptr->_vote_batcher
       .vote(n.id(), std::move(r), rpc::client_opts(tout))
       .then([this, target_node_id = n.id()](result<vote_reply> reply) {
           return _ptr->validate_reply_target_node(
@@ -12,11 +12,15 @@
 #include "cluster/cloud_storage_size_reducer.h"
 #include "cluster/controller.h"
 #include "cluster/metadata_cache.h"
+#include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "cluster/topics_frontend.h"
 #include "redpanda/admin/api-doc/debug.json.hh"
 #include "redpanda/admin/server.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace {
 ss::future<result<std::vector<cluster::partition_state>>>
 get_partition_state(model::ntp ntp, cluster::controller& controller) {
@@ -88,6 +92,62 @@ void fill_raft_state(
     }
     replica.raft_state = std::move(raft_state);
 }
+
+constexpr size_t default_hot_spots_limit = 20;
+
+enum class hot_spot_order { bytes, bytes_produced, bytes_fetched };
+
+struct partition_traffic {
+    model::ntp ntp;
+    ss::shard_id shard;
+    uint64_t bytes_produced;
+    uint64_t bytes_fetched;
+    uint64_t records_produced;
+    uint64_t records_fetched;
+
+    uint64_t key(hot_spot_order order) const {
+        switch (order) {
+        case hot_spot_order::bytes:
+            return bytes_produced + bytes_fetched;
+        case hot_spot_order::bytes_produced:
+            return bytes_produced;
+        case hot_spot_order::bytes_fetched:
+            return bytes_fetched;
+        }
+        __builtin_unreachable();
+    }
+};
+
+// keeps the first `limit` elements by descending key, sorted
+void keep_top(
+  std::vector<partition_traffic>& v, size_t limit, hot_spot_order order) {
+    auto by_key = [order](
+                    const partition_traffic& a, const partition_traffic& b) {
+        return a.key(order) > b.key(order);
+    };
+    auto n = std::min(limit, v.size());
+    std::partial_sort(v.begin(), v.begin() + n, v.end(), by_key);
+    v.resize(n);
+}
+
+std::vector<partition_traffic> top_partitions(
+  const cluster::partition_manager& pm, size_t limit, hot_spot_order order) {
+    std::vector<partition_traffic> ret;
+    ret.reserve(pm.partitions().size());
+    for (const auto& [ntp, p] : pm.partitions()) {
+        const auto& probe = p->probe();
+        ret.push_back(partition_traffic{
+          .ntp = ntp,
+          .shard = ss::this_shard_id(),
+          .bytes_produced = probe.bytes_produced(),
+          .bytes_fetched = probe.bytes_fetched(),
+          .records_produced = probe.records_produced(),
+          .records_fetched = probe.records_fetched(),
+        });
+    }
+    keep_top(ret, limit, order);
+    return ret;
+}
 } // namespace
 
 void admin_server::register_debug_routes() {
@@ -387,6 +447,13 @@ void admin_server::register_debug_routes() {
           return get_partition_state_handler(std::move(req));
       });
 
+    register_route<user>(
+      ss::httpd::debug_json::get_partition_hot_spots,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return partition_hot_spots_handler(std::move(req));
+      });
+
     register_route<superuser>(
       ss::httpd::debug_json::cpu_profile,
       [this](std::unique_ptr<ss::http::request> req)
@@ -493,6 +560,64 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
       std::move(response));
 }
 
+ss::future<ss::json::json_return_type>
+admin_server::partition_hot_spots_handler(
+  std::unique_ptr<ss::http::request> req) {
+    size_t limit = default_hot_spots_limit;
+    if (auto e = req->get_query_param("limit"); !e.empty()) {
+        try {
+            limit = boost::lexical_cast<size_t>(e);
+        } catch (const boost::bad_lexical_cast&) {
+            throw ss::httpd::bad_param_exception(
+              fmt::format("Invalid parameter 'limit' value {{{}}}", e));
+        }
+    }
+
+    auto order = hot_spot_order::bytes;
+    if (auto e = req->get_query_param("sort"); !e.empty()) {
+        if (e == "bytes_produced") {
+            order = hot_spot_order::bytes_produced;
+        } else if (e == "bytes_fetched") {
+            order = hot_spot_order::bytes_fetched;
+        } else if (e != "bytes") {
+            throw ss::httpd::bad_param_exception(fmt::format(
+              "Invalid parameter 'sort' value {{{}}}, expected one of "
+              "'bytes', 'bytes_produced' or 'bytes_fetched'",
+              e));
+        }
+    }
+
+    auto top = co_await _partition_manager.map_reduce0(
+      [limit, order](const cluster::partition_manager& pm) {
+          return top_partitions(pm, limit, order);
+      },
+      std::vector<partition_traffic>{},
+      [limit, order](
+        std::vector<partition_traffic> acc,
+        std::vector<partition_traffic> shard_top) {
+          std::move(
+            shard_top.begin(), shard_top.end(), std::back_inserter(acc));
+          keep_top(acc, limit, order);
+          return acc;
+      });
+
+    std::vector<ss::httpd::debug_json::partition_hot_spot> response;
+    response.reserve(top.size());
+    for (const auto& t : top) {
+        ss::httpd::debug_json::partition_hot_spot hot_spot;
+        hot_spot.ns = t.ntp.ns();
+        hot_spot.topic = t.ntp.tp.topic();
+        hot_spot.partition_id = t.ntp.tp.partition();
+        hot_spot.shard_id = t.shard;
+        hot_spot.bytes_produced = t.bytes_produced;
+        hot_spot.bytes_fetched = t.bytes_fetched;
+        hot_spot.records_produced = t.records_produced;
+        hot_spot.records_fetched = t.records_fetched;
+        response.push_back(std::move(hot_spot));
+    }
+    co_return ss::json::json_return_type(std::move(response));
+}
+
 ss::future<ss::json::json_return_type>
 admin_server::get_local_offsets_translated_handler(
   std::unique_ptr<ss::http::request> req) {
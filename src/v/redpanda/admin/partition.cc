@@ -894,7 +894,9 @@ admin_server::get_topic_partitions_handler(
             });
       });
 
-    co_return ss::json::json_return_type(partitions);
+    co_return ss::json::json_return_type(ss::json::stream_range_as_array(
+      lw_shared_container{std::move(partitions)},
+      [](const partition_t& p) -> const partition_t& { return p; }));
 }
 
 ss::future<ss::json::json_return_type>
@@ -2611,13 +2611,20 @@ admin_server::self_test_start_handler(std::unique_ptr<ss::http::request> req) {
                 const auto& obj = element.GetObject();
                 const ss::sstring test_type(obj["type"].GetString());
                 if (test_type == "disk") {
-                    r.dtos.push_back(cluster::diskcheck_opts::from_json(obj));
+                    try {
+                        r.dtos.push_back(
+                          cluster::diskcheck_opts::from_json(obj));
+                    } catch (const std::invalid_argument& ex) {
+                        throw ss::httpd::bad_param_exception(ex.what());
+                    }
                 } else if (test_type == "network") {
                     r.ntos.push_back(cluster::netcheck_opts::from_json(obj));
+                } else if (test_type == "cloud") {
+                    r.ctos.push_back(cluster::cloudcheck_opts::from_json(obj));
                 } else {
                     throw ss::httpd::bad_param_exception(
-                      "Unknown self_test 'type', valid options are 'disk' or "
-                      "'network'");
+                      "Unknown self_test 'type', valid options are 'disk', "
+                      "'network' or 'cloud'");
                 }
             }
         } else {
@@ -3106,6 +3113,100 @@ fragmented_vector<cluster_partition_info> topic2cluster_partitions(
     return ret;
 }
 
+/// Position in the listing of /v1/cluster/partitions, which is ordered by
+/// namespace, topic and partition id.
+struct cluster_partitions_cursor {
+    model::topic_namespace ns_tp;
+    model::partition_id id;
+
+    bool is_after(
+      const model::topic_namespace& p_ns_tp, model::partition_id p_id) const {
+        return p_ns_tp != ns_tp || p_id > id;
+    }
+};
+
+/// Parse the start_after query parameter, namespace/topic/partition
+std::optional<cluster_partitions_cursor>
+get_cluster_partitions_cursor(const ss::http::request& req) {
+    auto it = req.query_parameters.find("start_after");
+    if (it == req.query_parameters.end()) {
+        return std::nullopt;
+    }
+    std::string_view value = it->second;
+    auto first = value.find('/');
+    auto last = value.rfind('/');
+    if (first == std::string_view::npos || first == last) {
+        throw ss::httpd::bad_request_exception(
+          "Parameter start_after must be namespace/topic/partition");
+    }
+    try {
+        return cluster_partitions_cursor{
+          .ns_tp = model::topic_namespace(
+            model::ns(ss::sstring(value.substr(0, first))),
+            model::topic(
+              ss::sstring(value.substr(first + 1, last - first - 1)))),
+          .id = model::partition_id(
+            std::stoi(ss::sstring(value.substr(last + 1)))),
+        };
+    } catch (const std::logic_error&) {
+        throw ss::httpd::bad_request_exception(
+          "Parameter start_after must be namespace/topic/partition");
+    }
+}
+
+/// Write the partitions of \p topics as a JSON array, one topic at a time:
+/// only the partitions of a single topic are held in memory.
+ss::future<> write_cluster_partitions(
+  ss::output_stream<char> out,
+  const cluster::topic_table& topics_state,
+  ss::lw_shared_ptr<fragmented_vector<model::topic_namespace>> topics,
+  std::optional<bool> disabled_filter,
+  std::optional<cluster_partitions_cursor> cursor,
+  std::optional<uint64_t> limit) {
+    std::exception_ptr ex;
+    try {
+        co_await out.write("[");
+        uint64_t written = 0;
+        for (const auto& ns_tp : *topics) {
+            if (limit && written >= *limit) {
+                break;
+            }
+            auto topic_it = topics_state.topics_map().find(ns_tp);
+            if (topic_it == topics_state.topics_map().end()) {
+                // probably got deleted while we were writing.
+                continue;
+            }
+
+            auto partitions = topic2cluster_partitions(
+              ns_tp,
+              topic_it->second.get_assignments(),
+              topics_state.get_topic_disabled_set(ns_tp),
+              disabled_filter);
+
+            for (const auto& p : partitions) {
+                if (cursor && !cursor->is_after(ns_tp, p.id)) {
+                    continue;
+                }
+                if (limit && written >= *limit) {
+                    break;
+                }
+                if (written++ > 0) {
+                    co_await out.write(",");
+                }
+                co_await ss::json::formatter::write(out, p.to_json());
+            }
+            co_await ss::coroutine::maybe_yield();
+        }
+        co_await out.write("]");
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await out.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
 } // namespace
 
 ss::future<ss::json::json_return_type>
@@ -3118,15 +3219,38 @@ admin_server::get_cluster_partitions_handler(
 
     bool with_internal = get_boolean_query_param(*req, "with_internal");
 
+    std::optional<model::ns> ns_filter;
+    if (auto it = req->query_parameters.find("namespace");
+        it != req->query_parameters.end()) {
+        ns_filter = model::ns(it->second);
+    }
+    ss::sstring topic_prefix;
+    if (auto it = req->query_parameters.find("topic_prefix");
+        it != req->query_parameters.end()) {
+        topic_prefix = it->second;
+    }
+    auto cursor = get_cluster_partitions_cursor(*req);
+    auto limit = get_integer_query_param(*req, "limit");
+
     const auto& topics_state = _controller->get_topics_state().local();
 
-    fragmented_vector<model::topic_namespace> topics;
+    auto topics
+      = ss::make_lw_shared<fragmented_vector<model::topic_namespace>>();
     auto fill_topics = [&](const auto& map) {
         for (const auto& [ns_tp, _] : map) {
             if (!with_internal && !model::is_user_topic(ns_tp)) {
                 continue;
             }
-            topics.push_back(ns_tp);
+            if (ns_filter && ns_tp.ns != *ns_filter) {
+                continue;
+            }
+            if (!std::string_view(ns_tp.tp()).starts_with(topic_prefix)) {
+                continue;
+            }
+            if (cursor && ns_tp < cursor->ns_tp) {
+                continue;
+            }
+            topics->push_back(ns_tp);
         }
     };
 
@@ -3138,33 +3262,23 @@ admin_server::get_cluster_partitions_handler(
         fill_topics(topics_state.topics_map());
     }
 
-    std::sort(topics.begin(), topics.end());
-
-    ss::chunked_fifo<cluster_partition_info> partitions;
-    for (const auto& ns_tp : topics) {
-        auto topic_it = topics_state.topics_map().find(ns_tp);
-        if (topic_it == topics_state.topics_map().end()) {
-            // probably got deleted while we were iterating.
-            continue;
-        }
-
-        auto topic_partitions = topic2cluster_partitions(
-          ns_tp,
-          topic_it->second.get_assignments(),
-          topics_state.get_topic_disabled_set(ns_tp),
-          disabled_filter);
-
-        std::move(
-          topic_partitions.begin(),
-          topic_partitions.end(),
-          std::back_inserter(partitions));
-
-        co_await ss::coroutine::maybe_yield();
-    }
+    std::sort(topics->begin(), topics->end());
+    co_await ss::coroutine::maybe_yield();
 
-    co_return ss::json::json_return_type(ss::json::stream_range_as_array(
-      lw_shared_container{std::move(partitions)},
-      [](const auto& p) { return p.to_json(); }));
+    co_return ss::json::json_return_type(
+      [&topics_state,
+       topics = std::move(topics),
+       disabled_filter,
+       cursor = std::move(cursor),
+       limit](ss::output_stream<char>&& out) {
+          return write_cluster_partitions(
+            std::move(out),
+            topics_state,
+            topics,
+            disabled_filter,
+            cursor,
+            limit);
+      });
 }
 
 ss::future<ss::json::json_return_type>
@@ -4119,6 +4233,63 @@ admin_server::reset_scrubbing_metadata(std::unique_ptr<ss::http::request> req) {
     co_return ss::json::json_return_type(ss::json::json_void());
 }
 
+ss::future<ss::json::json_return_type>
+admin_server::get_cloud_storage_key_lookup(
+  std::unique_ptr<ss::http::request> req) {
+    const model::ntp ntp = parse_ntp_from_request(
+      req->param, model::kafka_namespace);
+
+    auto key = req->get_query_param("key");
+    if (key.empty()) {
+        throw ss::httpd::bad_param_exception("Missing key parameter");
+    }
+
+    if (need_redirect_to_leader(ntp, _metadata_cache)) {
+        throw co_await redirect_to_leader(*req, ntp);
+    }
+
+    const auto shard = _shard_table.local().shard_for(ntp);
+    if (!shard) {
+        throw ss::httpd::not_found_exception(fmt::format(
+          "{} could not be found on the node. Perhaps it has been moved "
+          "during the redirect.",
+          ntp));
+    }
+
+    auto segments = co_await _partition_manager.invoke_on(
+      *shard, [&ntp, &key, shard](auto& pm) {
+          const auto& partitions = pm.partitions();
+          auto partition_iter = partitions.find(ntp);
+
+          if (partition_iter == partitions.end()) {
+              throw ss::httpd::not_found_exception(
+                fmt::format("{} could not be found on shard {}.", ntp, *shard));
+          }
+
+          auto archiver = partition_iter->second->archiver();
+          if (!archiver) {
+              throw ss::httpd::not_found_exception(
+                fmt::format("{} has no archiver on shard {}.", ntp, *shard));
+          }
+
+          return archiver.value().get().lookup_key(key);
+      });
+
+    ss::httpd::shadow_indexing_json::cloud_storage_key_lookup json;
+    json.ns = ntp.ns();
+    json.topic = ntp.tp.topic();
+    json.partition = ntp.tp.partition();
+    for (const auto& s : segments) {
+        ss::httpd::shadow_indexing_json::segment_key_lookup item;
+        item.segment = map_segment_meta_to_json(s.meta);
+        item.may_contain = s.may_contain;
+        item.has_key_filter = s.has_key_filter;
+        json.segments.push(std::move(item));
+    }
+
+    co_return json;
+}
+
 void admin_server::register_shadow_indexing_routes() {
     register_route<superuser>(
       ss::httpd::shadow_indexing_json::sync_local_state,
@@ -4195,6 +4366,12 @@ void admin_server::register_shadow_indexing_routes() {
     register_route<user>(
       ss::httpd::shadow_indexing_json::reset_scrubbing_metadata,
       [this](auto req) { return reset_scrubbing_metadata(std::move(req)); });
+
+    register_route<user>(
+      ss::httpd::shadow_indexing_json::get_cloud_storage_key_lookup,
+      [this](auto req) {
+          return get_cloud_storage_key_lookup(std::move(req));
+      });
 }
 
 constexpr std::string_view to_string_view(service_kind kind) {
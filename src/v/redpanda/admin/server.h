@@ -569,6 +569,8 @@ private:
       get_cloud_storage_anomalies(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       reset_scrubbing_metadata(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      get_cloud_storage_key_lookup(std::unique_ptr<ss::http::request>);
 
     /// Self test routes
     ss::future<ss::json::json_return_type>
@@ -590,6 +592,8 @@ private:
     // Debug routes
     ss::future<ss::json::json_return_type>
       cpu_profile_handler(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      partition_hot_spots_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       get_local_offsets_translated_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
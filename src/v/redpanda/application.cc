@@ -63,6 +63,7 @@
 #include "cluster/tx_gateway_frontend.h"
 #include "cluster/types.h"
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "compression/stream_zstd.h"
 #include "config/configuration.h"
 #include "config/endpoint_tls_config.h"
@@ -71,6 +72,7 @@
 #include "features/feature_table_snapshot.h"
 #include "features/fwd.h"
 #include "finjector/stress_fiber.h"
+#include "http/connection_pool.h"
 #include "kafka/client/configuration.h"
 #include "kafka/server/coordinator_ntp_mapper.h"
 #include "kafka/server/group_manager.h"
@@ -222,6 +224,9 @@ static void set_auditing_kafka_client_defaults(
     if (!client_config.produce_shutdown_delay.is_overriden()) {
         client_config.produce_shutdown_delay.set_value(3000ms);
     }
+    if (!client_config.produce_max_in_flight.is_overriden()) {
+        client_config.produce_max_in_flight.set_value(int16_t(5));
+    }
     /// explicity override the scram details as the client will need to use
     /// broker generated ephemeral credentials
     client_config.scram_password.reset();
@@ -537,6 +542,13 @@ void application::initialize(
     _deferred.emplace_back(
       [this] { smp_service_groups.destroy_groups().get(); });
 
+    // Stopped once the services using it are stopped
+    _deferred.emplace_back([] {
+        ss::smp::invoke_on_all([] {
+            return http::connection_pool::local().stop();
+        }).get();
+    });
+
     if (groups) {
         sched_groups = *groups;
         return;
@@ -826,6 +838,9 @@ void application::check_environment() {
     storage::directories::initialize(
       config::node().data_directory().as_sstring())
       .get();
+    for (const auto& dir : config::node().extra_data_directories()) {
+        storage::directories::initialize(dir.as_sstring()).get();
+    }
     cloud_storage::cache::initialize(config::node().cloud_storage_cache_path())
       .get();
 
@@ -1037,7 +1052,7 @@ static storage::kvstore_config kvstore_config_from_global_config(
 static storage::log_config manager_config_from_global_config(
   scheduling_groups& sgs,
   std::optional<storage::file_sanitize_config> sanitizer_config) {
-    return storage::log_config(
+    auto cfg = storage::log_config(
       config::node().data_directory().as_sstring(),
       config::shard_local_cfg().log_segment_size.bind(),
       config::shard_local_cfg().compacted_log_segment_size.bind(),
@@ -1056,10 +1071,16 @@ static storage::log_config manager_config_from_global_config(
         .max_size = config::shard_local_cfg().reclaim_max_size(),
         .min_free_memory
         = config::shard_local_cfg().reclaim_batch_cache_min_free(),
+        .admission_filter
+        = config::shard_local_cfg().batch_cache_admission_filter(),
       },
       config::shard_local_cfg().readers_cache_eviction_timeout_ms(),
       sgs.compaction_sg(),
       std::move(sanitizer_config));
+    for (const auto& dir : config::node().extra_data_directories()) {
+        cfg.extra_dirs.push_back(dir.as_sstring());
+    }
+    return cfg;
 }
 
 static storage::backlog_controller_config compaction_controller_config(
@@ -1105,7 +1126,8 @@ static storage::backlog_controller_config compaction_controller_config(
       sg,
       iopc,
       config::shard_local_cfg().compaction_ctrl_min_shares(),
-      config::shard_local_cfg().compaction_ctrl_max_shares());
+      config::shard_local_cfg().compaction_ctrl_max_shares(),
+      config::shard_local_cfg().compaction_ctrl_priority());
 }
 
 static storage::backlog_controller_config
@@ -1138,7 +1160,8 @@ make_upload_controller_config(ss::scheduling_group sg) {
       sg,
       priority_manager::local().archival_priority(),
       config::shard_local_cfg().cloud_storage_upload_ctrl_min_shares(),
-      config::shard_local_cfg().cloud_storage_upload_ctrl_max_shares()};
+      config::shard_local_cfg().cloud_storage_upload_ctrl_max_shares(),
+      config::shard_local_cfg().cloud_storage_upload_ctrl_priority()};
 }
 
 // add additional services in here
@@ -1290,6 +1313,10 @@ void application::wire_up_redpanda_services(
                   .raft_replica_max_pending_flush_bytes.bind(),
               .flush_timer_interval_ms
               = config::shard_local_cfg().raft_flush_timer_interval_ms.bind(),
+              .recovery_batch_max_bytes
+              = config::shard_local_cfg().raft_recovery_batch_max_bytes.bind(),
+              .enable_vote_batching
+              = config::shard_local_cfg().raft_enable_vote_batching.bind(),
             };
         },
         [] {
@@ -1511,6 +1538,7 @@ void application::wire_up_redpanda_services(
       node_id,
       std::ref(local_monitor),
       std::ref(_connection_cache),
+      std::ref(cloud_storage_api),
       sched_groups.self_test_sg())
       .get();
 
@@ -1849,6 +1877,11 @@ void application::wire_up_redpanda_services(
 
               c.stream_recv_buf
                 = config::shard_local_cfg().kafka_rpc_server_stream_recv_buf;
+              if (auto cork
+                  = config::shard_local_cfg().kafka_rpc_server_output_cork_us();
+                  cork.has_value()) {
+                  c.stream_cork_window = std::chrono::microseconds(*cork);
+              }
               auto& tls_config = config::node().kafka_api_tls.value();
               for (const auto& ep : config::node().kafka_api()) {
                   ss::shared_ptr<ss::tls::server_credentials> credentials
@@ -1934,6 +1967,7 @@ void application::wire_up_redpanda_services(
         &kafka_cfg,
         smp_service_groups.kafka_smp_sg(),
         sched_groups.fetch_sg(),
+        sched_groups.kafka_tenant_sgs(),
         std::ref(metadata_cache),
         std::ref(controller->get_topics_frontend()),
         std::ref(controller->get_config_frontend()),
@@ -2072,6 +2106,11 @@ void application::wire_up_bootstrap_services() {
                 = config::shard_local_cfg().rpc_server_tcp_recv_buf;
               c.tcp_send_buf
                 = config::shard_local_cfg().rpc_server_tcp_send_buf;
+              if (auto cork
+                  = config::shard_local_cfg().rpc_server_output_cork_us();
+                  cork.has_value()) {
+                  c.stream_cork_window = std::chrono::microseconds(*cork);
+              }
               auto credentials
                 = net::build_reloadable_server_credentials_with_probe(
                     config::node().rpc_server_tls(),
@@ -2402,6 +2441,9 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
           .stack_memory = {
             .debug_host_stack_usage = false,
           },
+          .compilation_cache = {
+            .directory = config::node().data_directory().path / "wasm_cache",
+          },
         };
         _wasm_runtime->start(config).get();
         _transform_service.invoke_on_all(&transform::service::start).get();
@@ -2433,6 +2475,18 @@ void application::start_runtime_services(
       });
 
     thread_worker->start({.name = "worker"}).get();
+    auto offload_min_bytes
+      = config::shard_local_cfg().compression_offload_min_bytes();
+    if (offload_min_bytes.has_value()) {
+        ss::smp::invoke_on_all([this, min_bytes = *offload_min_bytes] {
+            compression::set_offload_worker(thread_worker.get(), min_bytes);
+        }).get();
+        _deferred.emplace_back([] {
+            ss::smp::invoke_on_all([] {
+                compression::set_offload_worker(nullptr, 0);
+            }).get();
+        });
+    }
 
     // single instance
     node_status_backend.invoke_on_all(&cluster::node_status_backend::start)
@@ -2463,7 +2517,9 @@ void application::start_runtime_services(
                 partition_manager,
                 shard_table.local(),
                 config::shard_local_cfg().raft_heartbeat_interval_ms(),
-                config::node().node_id().value()));
+                config::node().node_id().value(),
+                config::shard_local_cfg()
+                  .raft_enable_idle_group_hibernation.bind()));
               s.add_services(std::move(runtime_services));
           })
           .get();
@@ -2529,7 +2585,9 @@ void application::start_runtime_services(
                 partition_manager,
                 shard_table.local(),
                 config::shard_local_cfg().raft_heartbeat_interval_ms(),
-                config::node().node_id().value()));
+                config::node().node_id().value(),
+                config::shard_local_cfg()
+                  .raft_enable_idle_group_hibernation.bind()));
           }
 
           runtime_services.push_back(std::make_unique<cluster::service>(
@@ -39,6 +39,38 @@ available_memory::inner_register(const ss::sstring& name, afn&& fn) {
     return ret;
 }
 
+available_memory::deregister_holder
+available_memory::inner_register_usage(const ss::sstring& name, afn&& fn) {
+    auto ret = std::unique_ptr<reporter>(new reporter{name, std::move(fn)});
+    _usage_reporters.push_back(*ret);
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return ret;
+    }
+    auto [it, inserted] = _usage_metrics.try_emplace(name);
+    if (inserted) {
+        namespace sm = ss::metrics;
+        it->second.add_group(
+          prometheus_sanitize::metrics_name("memory"),
+          {sm::make_gauge(
+            "subsystem_bytes",
+            [this, name] { return usage(name); },
+            sm::description("Memory currently held by the subsystem in bytes"),
+            {sm::label("subsystem")(name)})});
+    }
+    return ret;
+}
+
+size_t available_memory::usage(std::string_view name) const {
+    size_t total = 0;
+    for (const auto& r : _usage_reporters) {
+        if (r.name == name) {
+            total += r.avail_fn();
+        }
+    }
+    return total;
+}
+
 size_t available_memory::available() const {
     return ss::memory::free_memory() + reclaimable();
 }
@@ -20,7 +20,9 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <map>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 namespace resources {
@@ -140,6 +142,36 @@ public:
         return inner_register(name, std::move(reporter_fn));
     }
 
+    /**
+     * @brief Register a memory usage reporter.
+     *
+     * A usage reporter is a subsystem reporting the amount of memory it
+     * currently holds, reclaimable or not (e.g., the batch cache, the append
+     * chunks or the raft recovery buffers). Usage reporters do not contribute
+     * to available(), they are exported as the memory:subsystem_bytes metric
+     * labelled with the reporter name, giving a live breakdown of the shard
+     * memory by subsystem.
+     *
+     * The returned holder deregisters the reporter when destroyed, as for
+     * register_reporter.
+     *
+     * @param name name of the subsystem, the memory of the reporters sharing
+     * a name is summed up
+     * @param usage_fn a function which returns the amount of memory held by
+     * the subsystem at any moment in time
+     */
+    template<typename F>
+    [[nodiscard("You need to hold the returned object to maintain "
+                "registration")]] deregister_holder
+    register_usage_reporter(const ss::sstring& name, F usage_fn) {
+        return inner_register_usage(name, std::move(usage_fn));
+    }
+
+    /**
+     * @brief The memory held by the usage reporters of the given name.
+     */
+    size_t usage(std::string_view name) const;
+
     /**
      * @brief Get a reference to the shard-global available_memory instance.
      *
@@ -149,11 +181,18 @@ public:
 
 private:
     deregister_holder inner_register(const ss::sstring& name, afn&& fn);
+    deregister_holder
+    inner_register_usage(const ss::sstring& name, afn&& fn);
 
     static thread_local available_memory
       _local_instance; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
     intrusive_list<reporter, &reporter::hook> _reporters;
+    intrusive_list<reporter, &reporter::hook> _usage_reporters;
+    // one subsystem_bytes gauge per reporter name, registered with the first
+    // reporter of the name
+    std::map<ss::sstring, metrics::internal_metric_groups, std::less<>>
+      _usage_metrics;
     std::optional<metrics::all_metrics_groups> _metrics;
     size_t _lwm;
 };
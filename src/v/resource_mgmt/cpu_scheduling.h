@@ -11,12 +11,17 @@
 
 #pragma once
 
+#include "config/tenant_group.h"
 #include "seastarx.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/scheduling.hh>
 
+#include <fmt/format.h>
+
+#include <vector>
+
 // manage cpu scheduling groups. scheduling groups are global, so one instance
 // of this class can be created at the top level and passed down into any server
 // and any shard that needs to schedule continuations into a given group.
@@ -38,6 +43,10 @@ public:
         _node_status = co_await ss::create_scheduling_group("node_status", 50);
         _self_test = co_await ss::create_scheduling_group("self_test", 100);
         _fetch = co_await ss::create_scheduling_group("fetch", 1000);
+        for (size_t i = 0; i < config::tenant_group::max_groups; ++i) {
+            _kafka_tenants.push_back(co_await ss::create_scheduling_group(
+              fmt::format("kafka_tenant_{}", i), 1000));
+        }
     }
 
     ss::future<> destroy_groups() {
@@ -52,6 +61,9 @@ public:
         co_await destroy_scheduling_group(_node_status);
         co_await destroy_scheduling_group(_self_test);
         co_await destroy_scheduling_group(_fetch);
+        for (auto& sg : _kafka_tenants) {
+            co_await destroy_scheduling_group(sg);
+        }
         co_return;
     }
 
@@ -80,10 +92,19 @@ public:
      * use all the CPU.
      */
     ss::scheduling_group fetch_sg() { return _fetch; }
+    /**
+     * @brief Scheduling groups for the produce and fetch requests of the
+     * kafka tenants isolated from the others (kafka_tenant_groups). The
+     * shares of a group are set by the kafka server once its tenant is
+     * configured.
+     */
+    const std::vector<ss::scheduling_group>& kafka_tenant_sgs() const {
+        return _kafka_tenants;
+    }
 
     std::vector<std::reference_wrapper<const ss::scheduling_group>>
     all_scheduling_groups() const {
-        return {
+        std::vector<std::reference_wrapper<const ss::scheduling_group>> all{
           std::cref(_default),
           std::cref(_admin),
           std::cref(_raft),
@@ -96,6 +117,10 @@ public:
           std::cref(_node_status),
           std::cref(_self_test),
           std::cref(_fetch)};
+        for (const auto& sg : _kafka_tenants) {
+            all.push_back(std::cref(sg));
+        }
+        return all;
     }
 
 private:
@@ -112,4 +137,5 @@ private:
     ss::scheduling_group _node_status;
     ss::scheduling_group _self_test;
     ss::scheduling_group _fetch;
+    std::vector<ss::scheduling_group> _kafka_tenants;
 };
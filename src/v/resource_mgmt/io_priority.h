@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "config/tenant_group.h"
 #include "seastarx.h"
 
 #include <seastar/core/distributed.hh>
@@ -18,6 +19,10 @@
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/reactor.hh>
 
+#include <fmt/format.h>
+
+#include <vector>
+
 class priority_manager {
 public:
     ss::io_priority_class raft_priority() { return _raft_priority; }
@@ -32,6 +37,11 @@ public:
         return _shadow_indexing_priority;
     }
     ss::io_priority_class archival_priority() { return _archival_priority; }
+    // reads of the kafka tenants isolated from the others, their shares are
+    // set by the kafka server
+    const std::vector<ss::io_priority_class>& kafka_tenant_read_priorities() {
+        return _kafka_tenant_read_priorities;
+    }
 
     static priority_manager& local() {
         static thread_local priority_manager pm = priority_manager();
@@ -60,7 +70,13 @@ private:
       // Background uploads to tiered storage: not user-visible latency, lowest
       // priority.
       , _archival_priority(
-          ss::io_priority_class::register_one("archival", 200)) {}
+          ss::io_priority_class::register_one("archival", 200)) {
+        for (size_t i = 0; i < config::tenant_group::max_groups; ++i) {
+            _kafka_tenant_read_priorities.push_back(
+              ss::io_priority_class::register_one(
+                fmt::format("kafka_tenant_read_{}", i), 1000));
+        }
+    }
 #pragma clang diagnostic pop
 
     ss::io_priority_class _raft_priority;
@@ -71,6 +87,7 @@ private:
     ss::io_priority_class _raft_learner_recovery_priority;
     ss::io_priority_class _shadow_indexing_priority;
     ss::io_priority_class _archival_priority;
+    std::vector<ss::io_priority_class> _kafka_tenant_read_priorities;
 };
 
 inline ss::io_priority_class raft_priority() {
@@ -16,17 +16,39 @@
 #include "metrics/metrics.h"
 #include "prometheus/prometheus_sanitize.h"
 #include "resource_mgmt/cpu_scheduling.h"
+#include "ssx/sformat.h"
+#include "utils/log_hist.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/metrics.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/timer.hh>
 
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * Exposes the runtime of the scheduling groups. On top of the accumulated
+ * runtime, the runtime and the queueing time (runnable but not running) of
+ * every group are sampled once per sampling_period into histograms, so that
+ * bursts of a group (e.g. a non-yielding loop) and the groups starved by them
+ * show up in the distribution rather than being averaged out in a counter.
+ */
 class scheduling_groups_probe {
 public:
+    static constexpr std::chrono::seconds sampling_period{1};
+
     void wire_up(const scheduling_groups& scheduling_groups) {
+        auto groups = scheduling_groups.all_scheduling_groups();
+        setup_internal_metrics(groups);
+
         if (config::shard_local_cfg().disable_public_metrics()) {
             return;
         }
 
-        auto groups = scheduling_groups.all_scheduling_groups();
         for (const auto& group_ref : groups) {
             _public_metrics.add_group(
               prometheus_sanitize::metrics_name("scheduler"),
@@ -45,8 +67,91 @@ public:
         }
     }
 
-    void clear() { _public_metrics.clear(); }
+    void clear() {
+        _sampling_timer.cancel();
+        _metrics.clear();
+        _public_metrics.clear();
+        _groups.clear();
+    }
 
 private:
+    using hist_t = log_hist_internal;
+    using stats_t = decltype(std::declval<const ss::scheduling_group&>()
+                               .get_stats());
+
+    struct group_samples {
+        explicit group_samples(const ss::scheduling_group& g)
+          : group(g)
+          , last(g.get_stats()) {}
+
+        ss::scheduling_group group;
+        stats_t last;
+        hist_t runtime;
+        hist_t waittime;
+    };
+
+    void setup_internal_metrics(
+      const std::vector<std::reference_wrapper<const ss::scheduling_group>>&
+        groups) {
+        if (config::shard_local_cfg().disable_metrics()) {
+            return;
+        }
+        namespace sm = ss::metrics;
+
+        for (const auto& group_ref : groups) {
+            auto& samples = *_groups.emplace_back(
+              std::make_unique<group_samples>(group_ref.get()));
+            const std::vector<sm::label_instance> labels{
+              sm::label("group")(group_ref.get().name()),
+              sm::label("latency_metric")("microseconds")};
+            _metrics.add_group(
+              prometheus_sanitize::metrics_name("scheduler"),
+              {
+                sm::make_histogram(
+                  "sampled_runtime_us",
+                  sm::description(ssx::sformat(
+                    "Runtime of the task queue in every {}s sampling period",
+                    sampling_period.count())),
+                  labels,
+                  [&samples] {
+                      return samples.runtime.internal_histogram_logform();
+                  }),
+                sm::make_histogram(
+                  "sampled_waittime_us",
+                  sm::description(ssx::sformat(
+                    "Time the task queue was runnable but not running in "
+                    "every {}s sampling period",
+                    sampling_period.count())),
+                  labels,
+                  [&samples] {
+                      return samples.waittime.internal_histogram_logform();
+                  }),
+              },
+              {},
+              {sm::shard_label});
+        }
+
+        _sampling_timer.set_callback([this] { sample(); });
+        _sampling_timer.arm_periodic(sampling_period);
+    }
+
+    void sample() {
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        for (auto& g : _groups) {
+            auto current = g->group.get_stats();
+            g->runtime.record(
+              duration_cast<microseconds>(current.runtime - g->last.runtime)
+                .count());
+            g->waittime.record(
+              duration_cast<microseconds>(current.waittime - g->last.waittime)
+                .count());
+            g->last = current;
+        }
+    }
+
+    std::vector<std::unique_ptr<group_samples>> _groups;
+    ss::timer<ss::lowres_clock> _sampling_timer;
+    metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
 };
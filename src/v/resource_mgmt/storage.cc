@@ -116,13 +116,18 @@ ss::future<> disk_space_manager::run_loop() {
             continue;
         }
 
-        if (_target_size == 0) {
-            _local_monitor->local().set_log_data_state(std::nullopt);
-            continue;
-        }
-
         try {
-            co_await manage_data_disk(_target_size);
+            if (_target_size == 0) {
+                _local_monitor->local().set_log_data_state(std::nullopt);
+                _previous_reclaim = false;
+            } else {
+                co_await manage_data_disk(_target_size);
+            }
+            // the log target reclaim takes precedence in this tick, its
+            // decisions would be overridden by a second schedule
+            if (!_previous_reclaim) {
+                co_await manage_shared_disk();
+            }
         } catch (...) {
             vlog(
               stlog.info,
@@ -650,4 +655,76 @@ ss::future<> disk_space_manager::manage_data_disk(uint64_t target_size) {
     co_await _storage->invoke_on_all([](api& api) { api.trigger_gc(); });
 }
 
+bool disk_space_manager::shared_disk() const {
+    return _cache != nullptr && _data_disk_info.total > 0
+           && _cache_disk_info.total > 0
+           && _cache_disk_info.fsid == _data_disk_info.fsid;
+}
+
+ss::future<> disk_space_manager::manage_shared_disk() {
+    if (!shared_disk()) {
+        co_return;
+    }
+
+    /*
+     * the log storage and the cache each react to the low space alert on their
+     * own, which trims both abruptly at the same time. instead, start freeing
+     * space smoothly once free space drops below a multiple of the low space
+     * threshold, with the candidates ranked by the cost of getting the data
+     * back:
+     *
+     *   1. local data of cloud partitions past their local retention target.
+     *      it is expected to be removed anyway and reads would be served from
+     *      the cloud.
+     *   2. cache objects, least recently accessed first (the cache trim
+     *      order). these are re-fetched on the next read.
+     *   3. local data of cloud partitions without an explicit local retention
+     *      setting, down to their low space level. this is the tail that
+     *      consumers are the most likely to be reading.
+     */
+    const auto soft_threshold = _data_disk_info.low_space_threshold
+                                * shared_disk_headroom_factor;
+    if (_data_disk_info.free >= soft_threshold) {
+        co_return;
+    }
+    const auto excess = soft_threshold - _data_disk_info.free;
+
+    auto schedule = co_await _policy.create_new_schedule();
+    size_t estimate = 0;
+    if (schedule.sched_size > 0) {
+        estimate += _policy.evict_until_local_retention(schedule, excess);
+    }
+
+    size_t cache_trim = 0;
+    if (estimate < excess) {
+        auto& cache = _cache->local();
+        const auto cache_size = cache.get_usage_bytes();
+        cache_trim = std::min(excess - estimate, cache_size);
+        if (cache_trim > 0) {
+            co_await cache.trim_manually(cache_size - cache_trim, std::nullopt);
+            estimate += cache_trim;
+        }
+    }
+
+    if (estimate < excess && schedule.sched_size > 0) {
+        estimate += _policy.evict_until_low_space_non_hinted(
+          schedule, excess - estimate);
+    }
+
+    vlog(
+      rlog.info,
+      "Shared disk free space {} below soft threshold {}. Reclaiming {} "
+      "(cache {}) for target {}",
+      human::bytes(_data_disk_info.free),
+      human::bytes(soft_threshold),
+      human::bytes(estimate),
+      human::bytes(cache_trim),
+      human::bytes(excess));
+
+    if (schedule.sched_size > 0) {
+        co_await _policy.install_schedule(std::move(schedule));
+        co_await _storage->invoke_on_all([](api& api) { api.trigger_gc(); });
+    }
+}
+
 } // namespace storage
@@ -217,6 +217,9 @@ private:
  */
 class disk_space_manager {
     static constexpr ss::shard_id run_loop_core = 0;
+    // shared disk reclaim starts when free space drops below this multiple of
+    // the low space alert threshold
+    static constexpr size_t shared_disk_headroom_factor = 2;
 
 public:
     disk_space_manager(
@@ -258,6 +261,13 @@ private:
     node::disk_space_info _data_disk_info{};
 
     ss::future<> manage_data_disk(uint64_t target_size);
+
+    /*
+     * when the log data and the cloud cache share a disk, free space ahead of
+     * the low space alert by reclaiming from both, cheapest first.
+     */
+    ss::future<> manage_shared_disk();
+    bool shared_disk() const;
     config::binding<std::optional<uint64_t>> _retention_target_capacity_bytes;
     config::binding<std::optional<double>> _retention_target_capacity_percent;
     config::binding<double> _disk_reservation_percent;
@@ -68,6 +68,31 @@ SEASTAR_THREAD_TEST_CASE(check_with_reporters) {
     BOOST_CHECK_EQUAL(local().reclaimable(), 0);
 }
 
+SEASTAR_THREAD_TEST_CASE(check_usage_reporters) {
+    size_t used = 3;
+    {
+        auto holder = local().register_usage_reporter(
+          "test_subsystem", [&] { return used; });
+        BOOST_CHECK_EQUAL(local().usage("test_subsystem"), 3);
+
+        {
+            // reporters sharing a name are summed up
+            auto holder2 = local().register_usage_reporter(
+              "test_subsystem", [] { return 4; });
+            BOOST_CHECK_EQUAL(local().usage("test_subsystem"), 3 + 4);
+        }
+
+        used = 5;
+        BOOST_CHECK_EQUAL(local().usage("test_subsystem"), 5);
+        BOOST_CHECK_EQUAL(local().usage("other_subsystem"), 0);
+
+        // usage isn't reclaimable
+        BOOST_CHECK_EQUAL(local().reclaimable(), 0);
+    }
+
+    BOOST_CHECK_EQUAL(local().usage("test_subsystem"), 0);
+}
+
 // this next test only makes sense if we are using the seastar
 // allocator since otherwise the stats return bogus, fixed values
 #ifndef SEASTAR_DEFAULT_ALLOCATOR
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <absl/container/flat_hash_map.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace rpc {
+
+/**
+ * Tracks how well the messages of each method compress and skips the
+ * compression of those for which it doesn't pay off (e.g. replicated batches
+ * that are already compressed by the producers).
+ *
+ * Every compressed message is a sample. When a message doesn't shrink by at
+ * least min_saving, the following messages of the method are sent
+ * uncompressed, for a number of messages doubling on every consecutive bad
+ * sample up to max_backoff. A single good sample re-enables compression.
+ */
+class adaptive_compression {
+public:
+    // compressed size / original size above which compression doesn't pay
+    static constexpr double max_ratio = 0.9;
+    static constexpr uint32_t initial_backoff = 8;
+    static constexpr uint32_t max_backoff = 1024;
+
+    /// Whether the next message of the method should be compressed.
+    bool should_compress(uint32_t method_id) {
+        auto it = _methods.find(method_id);
+        if (it == _methods.end() || it->second.skip == 0) {
+            return true;
+        }
+        --it->second.skip;
+        return false;
+    }
+
+    /// Record the outcome of compressing a message of the method.
+    void record(uint32_t method_id, size_t original, size_t compressed) {
+        auto& s = _methods[method_id];
+        if (
+          original == 0
+          || static_cast<double>(compressed)
+               <= max_ratio * static_cast<double>(original)) {
+            s.backoff = 0;
+            s.skip = 0;
+            return;
+        }
+        s.backoff = s.backoff == 0 ? initial_backoff
+                                   : std::min(s.backoff * 2, max_backoff);
+        s.skip = s.backoff;
+    }
+
+private:
+    struct method_state {
+        // messages left to be sent uncompressed
+        uint32_t skip{0};
+        uint32_t backoff{0};
+    };
+
+    absl::flat_hash_map<uint32_t, method_state> _methods;
+};
+
+} // namespace rpc
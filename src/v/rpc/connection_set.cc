@@ -37,7 +37,9 @@ ss::future<> connection_set::try_add_or_update(
       .credentials = std::move(cert_creds),
       .disable_metrics = net::metrics_disabled(
         config::shard_local_cfg().disable_metrics),
-      .version = get_default_transport_version()};
+      .version = get_default_transport_version(),
+      .max_inflight_write_bytes
+      = config::shard_local_cfg().rpc_client_max_inflight_write_bytes()};
     auto trans = ss::make_lw_shared<rpc::reconnect_transport>(
       std::move(config), std::move(backoff), _label, node);
 
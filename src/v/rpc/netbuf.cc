@@ -12,6 +12,7 @@
 #include "compression/async_stream_zstd.h"
 #include "hashing/xx.h"
 #include "reflection/adl.h"
+#include "rpc/adaptive_compression.h"
 #include "rpc/types.h"
 #include "vassert.h"
 
@@ -27,7 +28,8 @@ iobuf header_as_iobuf(const header& h) {
 }
 /// \brief used to send the bytes down the wire
 /// we re-compute the header-checksum on every call
-ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
+ss::future<ss::scattered_message<char>> netbuf::as_scattered(
+  adaptive_compression* adaptive, uint32_t method_id) && {
     // Move object members into coroutine before first supension.
     iobuf out_buf = std::move(_out);
     auto hdr = _hdr;
@@ -39,9 +41,14 @@ ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
     }
     if (
       out_buf.size_bytes() >= _min_compression_bytes
-      && rpc::compression_type::zstd == hdr.compression) {
+      && rpc::compression_type::zstd == hdr.compression
+      && (!adaptive || adaptive->should_compress(method_id))) {
         auto& zstd_inst = compression::async_stream_zstd_instance();
+        auto const original_size = out_buf.size_bytes();
         out_buf = co_await zstd_inst.compress(std::move(out_buf));
+        if (adaptive) {
+            adaptive->record(method_id, original_size, out_buf.size_bytes());
+        }
     } else {
         // didn't meet min requirements
         hdr.compression = rpc::compression_type::none;
@@ -10,6 +10,7 @@
 
 #include "config/configuration.h"
 #include "net/server.h"
+#include "rpc/adaptive_compression.h"
 #include "rpc/service.h"
 #include "vassert.h"
 
@@ -75,6 +76,8 @@ private:
     bool _all_services_added{false};
     bool _service_unavailable_allowed{false};
     std::vector<std::unique_ptr<service>> _services;
+    // skips the compression of the methods whose replies don't compress
+    adaptive_compression _reply_compression;
 };
 
 } // namespace rpc
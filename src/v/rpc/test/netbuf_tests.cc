@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "rpc/adaptive_compression.h"
 #include "rpc/parse_utils.h"
 
 #include <seastar/core/thread.hh>
@@ -17,6 +18,11 @@
 
 #include <fmt/ostream.h>
 
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
 namespace rpc {
 /// \brief expects the inputstream to be prefixed by an rpc::header
 template<typename T>
@@ -45,3 +51,70 @@ SEASTAR_THREAD_TEST_CASE(netbuf_pod) {
     BOOST_REQUIRE_EQUAL(src.y, dst.y);
     BOOST_REQUIRE_EQUAL(src.z, dst.z);
 }
+
+namespace {
+rpc::compression_type
+send_with_adaptive_compression(rpc::adaptive_compression& ac, iobuf payload) {
+    auto n = rpc::netbuf();
+    n.set_correlation_id(42);
+    n.set_service_method({"test::test", 66});
+    n.set_compression(rpc::compression_type::zstd);
+    n.set_min_compression_bytes(0);
+    n.buffer().append(std::move(payload));
+    auto bufs = std::move(n).as_scattered(&ac, 66).get().release().release();
+    auto in = make_iobuf_input_stream(iobuf(std::move(bufs)));
+    return rpc::parse_header(in).get0().value().compression;
+}
+
+iobuf incompressible_payload() {
+    std::mt19937_64 gen{std::random_device{}()};
+    std::vector<uint64_t> data(512);
+    std::generate(data.begin(), data.end(), std::ref(gen));
+    iobuf ret;
+    ret.append(
+      reinterpret_cast<const char*>(data.data()),
+      data.size() * sizeof(uint64_t));
+    return ret;
+}
+
+iobuf compressible_payload() {
+    iobuf ret;
+    ret.append(ss::sstring(4096, 'a').data(), 4096);
+    return ret;
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(netbuf_adaptive_compression) {
+    using rpc::adaptive_compression;
+    using rpc::compression_type;
+    adaptive_compression ac;
+
+    // the first incompressible payload is a sample, the following ones are
+    // sent uncompressed until the next sample
+    BOOST_REQUIRE(
+      send_with_adaptive_compression(ac, incompressible_payload())
+      == compression_type::zstd);
+    for (uint32_t i = 0; i < adaptive_compression::initial_backoff; ++i) {
+        BOOST_REQUIRE(
+          send_with_adaptive_compression(ac, incompressible_payload())
+          == compression_type::none);
+    }
+
+    // a second bad sample doubles the backoff
+    BOOST_REQUIRE(
+      send_with_adaptive_compression(ac, incompressible_payload())
+      == compression_type::zstd);
+    for (uint32_t i = 0; i < 2 * adaptive_compression::initial_backoff; ++i) {
+        BOOST_REQUIRE(
+          send_with_adaptive_compression(ac, compressible_payload())
+          == compression_type::none);
+    }
+
+    // a good sample re-enables compression
+    BOOST_REQUIRE(
+      send_with_adaptive_compression(ac, compressible_payload())
+      == compression_type::zstd);
+    BOOST_REQUIRE(
+      send_with_adaptive_compression(ac, compressible_payload())
+      == compression_type::zstd);
+}
@@ -37,6 +37,8 @@
 
 #include <exception>
 #include <filesystem>
+#include <map>
+#include <optional>
 
 using namespace std::chrono_literals; // NOLINT
 
@@ -611,6 +613,49 @@ FIXTURE_TEST(ordering_test, rpc_integration_fixture) {
     client.stop().get();
 }
 
+FIXTURE_TEST(priority_ordering_test, rpc_integration_fixture) {
+    configure_server();
+    register_services();
+    start_server();
+    auto cfg = client_config();
+    // a single normal priority request in flight at a time
+    cfg.max_inflight_write_bytes = 1;
+    auto client = rpc::make_client<echo::echo_client_protocol>(std::move(cfg));
+    client.connect(model::no_timeout).get();
+
+    constexpr uint64_t requests = 20;
+    // index of the normal priority requests in the order they were served
+    std::map<uint64_t, uint64_t> normal_served;
+    std::vector<ss::future<>> futures;
+    futures.reserve(requests);
+    for (uint64_t i = 0; i < requests; ++i) {
+        auto opts = rpc::client_opts(rpc::no_timeout);
+        auto high = i % 2 == 1;
+        if (high) {
+            opts.priority = rpc::request_priority::high;
+        }
+        futures.push_back(
+          client.counter(echo::cnt_req{.expected = i}, std::move(opts))
+            .then(&rpc::get_ctx_data<echo::cnt_resp>)
+            .then([high, &normal_served](result<echo::cnt_resp> r) {
+                BOOST_REQUIRE(r.has_value());
+                if (!high) {
+                    normal_served[r.value().expected] = r.value().current;
+                }
+            }));
+    }
+    ss::when_all_succeed(futures.begin(), futures.end()).get0();
+
+    // requests of the same priority are never reordered
+    BOOST_REQUIRE_EQUAL(normal_served.size(), requests / 2);
+    std::optional<uint64_t> prev;
+    for (auto& [_, served] : normal_served) {
+        BOOST_REQUIRE(!prev || *prev < served);
+        prev = served;
+    }
+    client.stop().get();
+}
+
 FIXTURE_TEST(server_exception_test, rpc_integration_fixture) {
     configure_server();
     register_services();
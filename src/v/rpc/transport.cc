@@ -25,6 +25,7 @@
 #include <seastar/core/with_timeout.hh>
 #include <seastar/net/api.hh>
 #include <seastar/net/socket_defs.hh>
+#include <seastar/util/defer.hh>
 
 #include <fmt/core.h>
 
@@ -63,6 +64,7 @@ transport::transport(
     .credentials = std::move(c.credentials),
   })
   , _memory(c.max_queued_bytes, "rpc/transport-mem")
+  , _max_inflight_write_bytes(c.max_inflight_write_bytes)
   , _version(c.version)
   , _default_version(c.version) {
     if (!c.disable_metrics) {
@@ -79,6 +81,8 @@ void transport::fail_outstanding_futures() noexcept {
     _last_seq = sequence_t{0};
     _seq = sequence_t{0};
     _requests_queue.clear();
+    _high_priority_ready.clear();
+    _normal_priority_ready.clear();
     _correlations.clear();
 }
 
@@ -226,6 +230,7 @@ transport::do_send(sequence_t seq, netbuf b, rpc::client_opts opts) {
       _dispatch_gate,
       [this, b = std::move(b), opts = std::move(opts), seq]() mutable {
           auto f = make_response_handler(b, opts);
+          auto priority = opts.priority;
 
           // send
           auto sz = b.buffer().size_bytes();
@@ -238,19 +243,20 @@ transport::do_send(sequence_t seq, netbuf b, rpc::client_opts opts) {
                     auto& timing = it->second->timing;
                     timing.memory_reserved_at = clock_type::now();
                 }
-                return std::move(b).as_scattered().then(
-                  [u = std::move(units)](
-                    ss::scattered_message<char> scattered_message) mutable {
-                      return std::make_tuple(
-                        std::move(u), std::move(scattered_message));
+                auto method_id = b.service_method_id();
+                return std::move(b)
+                  .as_scattered(&_compression, method_id)
+                  .then([u = std::move(units)](
+                          ss::scattered_message<char> msg) mutable {
+                      return std::make_tuple(std::move(u), std::move(msg));
                   });
             })
             .then_unpack(
-              [this, f = std::move(f), seq, corr](
+              [this, f = std::move(f), seq, corr, priority](
                 ssx::semaphore_units units,
                 ss::scattered_message<char> scattered_message) mutable {
                   auto e = std::make_unique<entry>(
-                    std::move(scattered_message), corr);
+                    std::move(scattered_message), corr, priority);
                   _requests_queue.emplace(seq, std::move(e));
 
                   // By this point the request may already have timed out but
@@ -278,105 +284,129 @@ transport::do_send(sequence_t seq, netbuf b, rpc::client_opts opts) {
       });
 }
 
-ss::future<> transport::do_dispatch_send() {
-    return ss::do_until(
-      [this] {
-          if (_requests_queue.empty()) {
-              return true;
-          }
-          auto queue_begin_sequence = _requests_queue.begin()->first;
-          auto out_of_order = queue_begin_sequence
-                              > (_last_seq + sequence_t(1));
-          if (unlikely(out_of_order)) {
-              vlog(
-                rpclog.debug,
-                "Dispatch request queue out of order. Last seq: "
-                "{}, "
-                "queue begin seq: {}",
-                _last_seq,
-                queue_begin_sequence);
-          }
-          return out_of_order;
-      },
-      // Be careful adding any scheduling points in the lambda
-      // below.
-      //
-      // If a scheduling point is added before
-      // `_requests_queue.erase` then two concurrent instances of
-      // dispatch_send could try sending the same message.
-      // Resulting in one of them throwing a seg. fault.
-      //
-      // And if a scheduling point is added after
-      // `_requests_queue.erase` the conditional for executing the
-      // lambda could succeed for two different messages
-      // concurrently resulting in incorrect ordering of the sent
-      // messages.
-      [this] {
-          auto it = _requests_queue.begin();
-          _last_seq = it->first;
-          auto v = std::move(it->second->scattered_message);
-          auto corr = it->second->correlation_id;
-          _requests_queue.erase(it);
-
-          auto resp_it = _correlations.find(corr);
-          if (resp_it == _correlations.end()) {
-              // request had already completed even before we sent
-              // it (probably due to timeout or disconnect). We
-              // don't need to do anything.
-              return ss::now();
-          }
-          auto& resp_entry = resp_it->second;
-
-          // These units are released once we are out of scope here
-          // and that is intentional because the underlying write
-          // call to the batched output stream guarantees us the
-          // in-order delivery of the dispatched write calls, which
-          // is the intent of holding on to the units up until this
-          // point.
-          auto units = std::move(resp_entry->resource_units);
-          auto msg_size = v.size();
-
-          auto f = _out.write(std::move(v));
-          resp_entry->timing.dispatched_at = clock_type::now();
-          vlog(
-            rpclog.trace,
-            "Dispatched request with sequence: {}, "
-            "correlation_idx: {}, "
-            "pending queue_size: {}, target_address: {}",
-            _last_seq,
-            corr,
-            _requests_queue.size(),
-            server_address());
-          return std::move(f)
-            .then([this, corr](bool flushed) {
-                if (auto maybe_timing = get_timing(corr)) {
-                    maybe_timing->written_at = clock_type::now();
-                    maybe_timing->flushed = flushed;
-                }
-            })
-            .finally([this, msg_size] { _probe->add_bytes_sent(msg_size); });
-      });
-}
-
 void transport::dispatch_send() {
     // Callers expect this function does not throw, so check if the gate is
     // closed so we know that `hold()` will never throw.
     if (_dispatch_gate.is_closed()) {
         return;
     }
+    // Move the requests that are next in sequence to the queue of their
+    // priority. There are no scheduling points in here so that concurrent
+    // callers can't observe the same request nor reorder them.
+    while (!_requests_queue.empty()) {
+        auto it = _requests_queue.begin();
+        if (unlikely(it->first > (_last_seq + sequence_t(1)))) {
+            vlog(
+              rpclog.debug,
+              "Dispatch request queue out of order. Last seq: {}, queue "
+              "begin seq: {}",
+              _last_seq,
+              it->first);
+            break;
+        }
+        _last_seq = it->first;
+        auto e = std::move(it->second);
+        _requests_queue.erase(it);
+        if (e->priority == request_priority::high) {
+            _high_priority_ready.push_back(std::move(e));
+        } else {
+            _normal_priority_ready.push_back(std::move(e));
+        }
+    }
+    write_ready();
+}
+
+std::unique_ptr<transport::entry> transport::next_ready() {
+    std::unique_ptr<entry> e;
+    if (!_high_priority_ready.empty()) {
+        e = std::move(_high_priority_ready.front());
+        _high_priority_ready.pop_front();
+    } else if (
+      !_normal_priority_ready.empty()
+      && (!_max_inflight_write_bytes
+          || _inflight_write_bytes < *_max_inflight_write_bytes)) {
+        e = std::move(_normal_priority_ready.front());
+        _normal_priority_ready.pop_front();
+    }
+    return e;
+}
+
+void transport::write_ready() {
+    // writes may complete synchronously and call back in here, the loop
+    // below picks up whatever they made ready
+    if (_writing_ready) {
+        return;
+    }
+    _writing_ready = true;
+    auto reset = ss::defer([this] { _writing_ready = false; });
+    while (!_dispatch_gate.is_closed()) {
+        auto e = next_ready();
+        if (!e) {
+            return;
+        }
+        write(std::move(e));
+    }
+}
+
+void transport::write(std::unique_ptr<entry> e) {
+    auto corr = e->correlation_id;
+    auto resp_it = _correlations.find(corr);
+    if (resp_it == _correlations.end()) {
+        // request had already completed even before we sent it (probably due
+        // to timeout or disconnect). We don't need to do anything.
+        return;
+    }
+    auto& resp_entry = resp_it->second;
+
+    // These units are released once we are out of scope here and that is
+    // intentional because the underlying write call to the batched output
+    // stream guarantees us the in-order delivery of the dispatched write
+    // calls, which is the intent of holding on to the units up until this
+    // point.
+    auto units = std::move(resp_entry->resource_units);
+    auto msg_size = e->scattered_message.size();
+
+    _inflight_write_bytes += msg_size;
+    auto f = _out.write(std::move(e->scattered_message));
+    resp_entry->timing.dispatched_at = clock_type::now();
+    vlog(
+      rpclog.trace,
+      "Dispatched request with correlation_idx: {}, priority: {}, pending "
+      "queue_size: {}, inflight bytes: {}, target_address: {}",
+      corr,
+      static_cast<int>(e->priority),
+      _requests_queue.size() + _high_priority_ready.size()
+        + _normal_priority_ready.size(),
+      _inflight_write_bytes,
+      server_address());
+
     auto holder = _dispatch_gate.hold();
-    ssx::background = ssx::ignore_shutdown_exceptions(do_dispatch_send())
-                        .then_wrapped(
-                          [this, h = std::move(holder)](ss::future<> fut) {
-                              if (fut.failed()) {
-                                  vlog(
-                                    rpclog.info,
-                                    "Error dispatching socket write:{}",
-                                    fut.get_exception());
-                                  _probe->request_error();
-                                  fail_outstanding_futures();
-                              }
-                          });
+    ssx::background
+      = ssx::ignore_shutdown_exceptions(
+          std::move(f)
+            .then([this, corr](bool flushed) {
+                if (auto maybe_timing = get_timing(corr)) {
+                    maybe_timing->written_at = clock_type::now();
+                    maybe_timing->flushed = flushed;
+                }
+            })
+            .finally([this, msg_size] {
+                _inflight_write_bytes -= msg_size;
+                _probe->add_bytes_sent(msg_size);
+            }))
+          .then_wrapped([this, h = std::move(holder)](ss::future<> fut) {
+              if (fut.failed()) {
+                  vlog(
+                    rpclog.info,
+                    "Error dispatching socket write:{}",
+                    fut.get_exception());
+                  _probe->request_error();
+                  fail_outstanding_futures();
+                  return;
+              }
+              // the write released some of the budget
+              write_ready();
+          });
 }
 
 ss::future<> transport::do_reads() {
@@ -16,6 +16,7 @@
 #include "net/transport.h"
 #include "outcome.h"
 #include "reflection/async_adl.h"
+#include "rpc/adaptive_compression.h"
 #include "rpc/errc.h"
 #include "rpc/parse_utils.h"
 #include "rpc/response_handler.h"
@@ -23,6 +24,7 @@
 #include "seastarx.h"
 #include "utils/named_type.h"
 
+#include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/metrics_registration.hh>
@@ -148,9 +150,11 @@ private:
     struct entry {
         ss::scattered_message<char> scattered_message;
         uint32_t correlation_id;
+        request_priority priority;
     };
     using requests_queue_t
       = absl::btree_map<sequence_t, std::unique_ptr<entry>>;
+    using ready_queue_t = ss::chunked_fifo<std::unique_ptr<entry>>;
     friend client_context_impl;
     ss::future<> do_reads();
     ss::future<> dispatch(header);
@@ -162,12 +166,16 @@ private:
     ss::future<result<std::unique_ptr<streaming_context>>>
       do_send(sequence_t, netbuf, rpc::client_opts);
     void dispatch_send();
-    ss::future<> do_dispatch_send();
+    void write_ready();
+    std::unique_ptr<entry> next_ready();
+    void write(std::unique_ptr<entry>);
 
     ss::future<result<std::unique_ptr<streaming_context>>>
     make_response_handler(netbuf&, rpc::client_opts&);
 
     ssx::semaphore _memory;
+    // skips the compression of the methods whose requests don't compress
+    adaptive_compression _compression;
 
     /**
      * @brief Get the timing info for the request with the given correlation ID.
@@ -212,6 +220,19 @@ private:
     sequence_t _seq;
     sequence_t _last_seq;
 
+    /**
+     * Requests next in sequence waiting to be written to the wire, by
+     * priority. Normal priority requests are written only while less than
+     * _max_inflight_write_bytes are being written, high priority ones are
+     * written right away so that they don't queue behind large messages in
+     * the output stream.
+     */
+    ready_queue_t _high_priority_ready;
+    ready_queue_t _normal_priority_ready;
+    size_t _inflight_write_bytes{0};
+    std::optional<size_t> _max_inflight_write_bytes;
+    bool _writing_ready{false};
+
     /*
      * version level used when dispatching requests. this value may change
      * during the lifetime of the transport. for example the version may be
@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <limits>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -44,6 +45,8 @@ using namespace std::chrono_literals;
 
 namespace rpc {
 
+class adaptive_compression;
+
 using clock_type = net::clock_type;
 using duration_type = typename clock_type::duration;
 using timer_type = ss::timer<clock_type>;
@@ -259,6 +262,14 @@ static_assert(
 
 uint32_t checksum_header_only(const header& h);
 
+/**
+ * Requests of a transport are written to the wire in the order they are sent
+ * within a priority. High priority requests are small and latency sensitive
+ * (e.g. raft heartbeats), they are written ahead of the normal priority ones
+ * waiting for the in flight write budget of the connection.
+ */
+enum class request_priority : uint8_t { normal, high };
+
 struct client_opts {
     using resource_units_t
       = ss::foreign_ptr<ss::lw_shared_ptr<std::vector<ssx::semaphore_units>>>;
@@ -310,6 +321,7 @@ struct client_opts {
      * to control caller resources.
      */
     resource_units_t resource_units;
+    request_priority priority{request_priority::normal};
 };
 
 /// \brief used to pass environment context to the class
@@ -366,7 +378,12 @@ class netbuf {
 public:
     /// \brief used to send the bytes down the wire
     /// we re-compute the header-checksum on every call
-    ss::future<ss::scattered_message<char>> as_scattered() &&;
+    ///
+    /// When given, \p adaptive decides whether a payload of the method
+    /// \p method_id is worth compressing and records how well it compressed.
+    ss::future<ss::scattered_message<char>> as_scattered(
+      adaptive_compression* adaptive = nullptr,
+      uint32_t method_id = 0) &&;
 
     void set_status(rpc::status);
     void set_correlation_id(uint32_t);
@@ -387,6 +404,11 @@ public:
      */
     uint32_t correlation_id() const { return _hdr.correlation_id; }
 
+    /**
+     * @brief Get the id of the service method of a request.
+     */
+    uint32_t service_method_id() const { return _hdr.meta; }
+
 private:
     const char* _name = nullptr;
     size_t _min_compression_bytes{1024};
@@ -479,6 +501,9 @@ struct transport_configuration {
     ss::shared_ptr<ss::tls::certificate_credentials> credentials;
     net::metrics_disabled disable_metrics = net::metrics_disabled::no;
     transport_version version{transport_version::v2};
+    /// Bytes of normal priority requests written to the connection at a
+    /// time, unbounded if not set.
+    std::optional<size_t> max_inflight_write_bytes;
 };
 
 std::ostream& operator<<(std::ostream&, const status&);
@@ -114,19 +114,28 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
     }
 
     /*
-     * the acls are sorted within (resource-type, pattern-type) bounds by name
-     * in reverse order so longer names (prefixes) appear first.
+     * the lengths of the prefixed patterns of the name, found by walking the
+     * name down the trie. the matches are ordered longer prefixes first.
      */
     std::vector<acl_matches::entry_set_ref> prefixes;
-    {
-        auto it = _acls.lower_bound(
-          resource_pattern(resource, name, pattern_type::prefixed));
-
-        auto end = _acls.upper_bound(resource_pattern(
-          resource, name.substr(0, 1), pattern_type::prefixed));
-
-        for (; it != end; ++it) {
-            if (std::string_view(name).starts_with(it->first.name())) {
+    if (const auto root = _prefixes.find(resource); root != _prefixes.end()) {
+        std::vector<size_t> lengths;
+        const prefix_node* node = &root->second;
+        for (size_t i = 0; node != nullptr; ++i) {
+            if (node->terminal) {
+                lengths.push_back(i);
+            }
+            if (i == name.size()) {
+                break;
+            }
+            const auto child = node->children.find(name[i]);
+            node = child == node->children.end() ? nullptr
+                                                 : child->second.get();
+        }
+        for (auto len = lengths.rbegin(); len != lengths.rend(); ++len) {
+            const auto it = _acls.find(resource_pattern(
+              resource, name.substr(0, *len), pattern_type::prefixed));
+            if (it != _acls.end()) {
                 prefixes.emplace_back(it->first, it->second);
             }
         }
@@ -135,8 +144,26 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
     return acl_matches(wildcards, literals, std::move(prefixes));
 }
 
+void acl_store::add_prefix(const resource_pattern& pattern) {
+    if (pattern.pattern() != pattern_type::prefixed) {
+        return;
+    }
+    prefix_node* node = &_prefixes[pattern.resource()];
+    for (const char c : pattern.name()) {
+        auto& child = node->children[c];
+        if (!child) {
+            child = std::make_unique<prefix_node>();
+        }
+        node = child.get();
+    }
+    node->terminal = true;
+}
+
 std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
   const std::vector<acl_binding_filter>& filters, bool dry_run) {
+    if (!dry_run) {
+        ++_generation;
+    }
     // the pair<filter, size_t> is used to record the index of the filter in the
     // input so that returned set of matching binding is organized in the same
     // order as the input filters. this is a property needed by the kafka api.
@@ -239,14 +266,20 @@ ss::future<>
 acl_store::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
     // NOTE: not coroutinized because otherwise clang-14 crashes.
     _acls.clear();
+    _prefixes.clear();
+    // the store changes across yield points, until the returned future
+    // resolves
+    ++_generation;
     return ss::do_for_each(
              bindings,
              [this](const auto& binding) {
+                 add_prefix(binding.pattern());
                  _acls[binding.pattern()].insert(binding.entry());
              })
       .then([this] {
           return ss::do_for_each(_acls, [](auto& kv) { kv.second.rehash(); });
-      });
+      })
+      .then([this] { ++_generation; });
 }
 
 std::ostream& operator<<(std::ostream& os, acl_operation op) {
@@ -12,8 +12,11 @@
 #include "security/acl.h"
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_set.h>
 
+#include <memory>
+
 namespace security {
 
 /*
@@ -134,7 +137,9 @@ public:
     ~acl_store() noexcept = default;
 
     void add_bindings(const std::vector<acl_binding>& bindings) {
+        ++_generation;
         for (auto& binding : bindings) {
+            add_prefix(binding.pattern());
             auto& entries = _acls[binding.pattern()];
             entries.insert(binding.entry());
             entries.rehash();
@@ -155,7 +160,28 @@ public:
     ss::future<fragmented_vector<acl_binding>> all_bindings() const;
     ss::future<> reset_bindings(const fragmented_vector<acl_binding>& bindings);
 
+    /*
+     * Changes whenever the ACLs change. The matches returned by find() refer
+     * to the store and are valid as long as its generation doesn't change.
+     */
+    uint64_t generation() const { return _generation; }
+
 private:
+    /*
+     * A trie of the names of the prefixed patterns of one resource type, so
+     * that finding the prefixed patterns of a resource name takes one walk
+     * down the name instead of a scan of the prefixed patterns. Patterns are
+     * never removed from the trie: bindings removal leaves empty entry sets
+     * in the store, which match nothing.
+     */
+    struct prefix_node {
+        absl::flat_hash_map<char, std::unique_ptr<prefix_node>> children;
+        // a prefixed pattern ends at this node
+        bool terminal{false};
+    };
+
+    void add_prefix(const resource_pattern&);
+
     /*
      * resource pattern ordering:
      *
@@ -178,6 +204,8 @@ private:
 
     absl::btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>
       _acls;
+    absl::flat_hash_map<resource_type, prefix_node> _prefixes;
+    uint64_t _generation{0};
 };
 
 } // namespace security
@@ -834,10 +834,31 @@ bool audit_log_manager::report_redpanda_app_event(is_started app_started) {
         : application_lifecycle::activity_id::stop);
 }
 
+bool audit_log_manager::aggregate_audit_event(size_t fingerprint) {
+    auto fit = _authz_fingerprints.find(fingerprint);
+    if (fit == _authz_fingerprints.end()) {
+        return false;
+    }
+    auto& map = _queue.get<underlying_unordered_map>();
+    auto it = map.find(fit->second);
+    if (it == map.end()) {
+        _authz_fingerprints.erase(fit);
+        return false;
+    }
+    it->increment(security::audit::timestamp_t{
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count()});
+    ++_aggregated_events;
+    return true;
+}
+
 bool audit_log_manager::do_enqueue_audit_event(
-  std::unique_ptr<security::audit::ocsf_base_impl> msg) {
+  std::unique_ptr<security::audit::ocsf_base_impl> msg,
+  std::optional<size_t> fingerprint) {
     auto& map = _queue.get<underlying_unordered_map>();
-    auto it = map.find(msg->key());
+    const auto key = msg->key();
+    auto it = map.find(key);
     if (it == map.end()) {
         const auto msg_size = msg->estimated_size();
         auto units = ss::try_get_units(_queue_bytes_sem, msg_size);
@@ -865,6 +886,10 @@ bool audit_log_manager::do_enqueue_audit_event(
             std::chrono::system_clock::now().time_since_epoch())
             .count()};
         it->increment(now);
+        ++_aggregated_events;
+    }
+    if (fingerprint) {
+        _authz_fingerprints.insert_or_assign(*fingerprint, key);
     }
     return true;
 }
@@ -882,7 +907,9 @@ ss::future<> audit_log_manager::drain() {
     /// Combine all batched audit msgs into record_essences
     std::vector<kafka::client::record_essence> essences;
     auto records = std::exchange(_queue, underlying_t{});
+    _authz_fingerprints.clear();
     auto& records_seq = records.get<underlying_list>();
+    essences.reserve(records_seq.size());
     while (!records_seq.empty()) {
         auto first = records_seq.extract(records_seq.begin());
         auto audit_msg = std::move(first.value()).release();
@@ -32,6 +32,9 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+#include <boost/container_hash/hash.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/indexed_by.hpp>
 #include <boost/multi_index/key.hpp>
@@ -141,12 +144,21 @@ public:
                 return (bool)*val;
             }
         }
+        /// Produce and fetch authorize every topic of every request, so most
+        /// of these events repeat one already in the queue. Those are counted
+        /// without building the event.
+        const auto fingerprint = authz_fingerprint(
+          api, operation_name, result, args...);
+        if (aggregate_audit_event(fingerprint)) {
+            return true;
+        }
         return do_enqueue_audit_event(
           std::make_unique<api_activity>(make_api_activity_event(
             operation_name,
             std::move(result),
             std::forward<Args>(args)...,
-            {})));
+            {})),
+          fingerprint);
     }
 
     bool enqueue_authn_event(authentication_event_options options) {
@@ -206,6 +218,10 @@ public:
     /// Note does not include records already sent to client
     size_t pending_events() const { return _queue.size(); };
 
+    /// Returns the number of events counted into an event already pending
+    /// instead of being enqueued
+    uint64_t aggregated_events() const { return _aggregated_events; }
+
     /// Returns the number of bytes left until the semaphore is exhausted
     ///
     size_t avaiable_reservation() const {
@@ -251,7 +267,45 @@ private:
 
     bool is_audit_event_enabled(event_type) const;
     bool do_enqueue_audit_event(
-      std::unique_ptr<security::audit::ocsf_base_impl> msg);
+      std::unique_ptr<security::audit::ocsf_base_impl> msg,
+      std::optional<size_t> fingerprint = std::nullopt);
+
+    /// Hash of the inputs of an authz event, equal fingerprints make equal
+    /// events. Cheaper than building the event to compute its key().
+    template<typename... Args>
+    static size_t authz_fingerprint(
+      kafka::api_key api,
+      std::string_view operation_name,
+      const security::auth_result& result,
+      const Args&... args) {
+        size_t h = absl::HashOf(
+          result.principal,
+          result.host,
+          result.resource_type,
+          std::string_view{result.resource_name},
+          result.operation);
+        boost::hash_combine(h, std::hash<kafka::api_key>()(api));
+        boost::hash_combine(h, std::hash<std::string_view>()(operation_name));
+        boost::hash_combine(
+          h,
+          (static_cast<size_t>(result.authorized) << 3U)
+            | (static_cast<size_t>(result.authorization_disabled) << 2U)
+            | (static_cast<size_t>(result.is_superuser) << 1U)
+            | static_cast<size_t>(result.empty_matches));
+        if (result.resource_pattern) {
+            boost::hash_combine(
+              h, absl::HashOf(result.resource_pattern->get()));
+        }
+        if (result.acl) {
+            boost::hash_combine(h, absl::HashOf(result.acl->get()));
+        }
+        (boost::hash_combine(h, std::hash<std::decay_t<Args>>()(args)), ...);
+        return h;
+    }
+
+    /// Count an event with \p fingerprint into the pending event it repeats,
+    /// returns false if there is none.
+    bool aggregate_audit_event(size_t fingerprint);
     void set_enabled_events();
 
     audit_probe& probe() { return *_probe; }
@@ -366,6 +420,11 @@ private:
     underlying_t _queue;
     ssx::semaphore _active_drain{1, "audit-drain"};
 
+    /// Fingerprints of the authz events pending in the queue, mapped to their
+    /// key in the queue. Emptied together with the queue on drain().
+    absl::flat_hash_map<size_t, size_t> _authz_fingerprints;
+    uint64_t _aggregated_events{0};
+
     /// Single instance contains a kafka::client::client instance.
     friend class audit_sink;
     std::unique_ptr<audit_sink> _sink;
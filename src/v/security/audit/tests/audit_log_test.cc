@@ -10,6 +10,7 @@
 
 #include "cluster/types.h"
 #include "kafka/client/test/fixture.h"
+#include "kafka/protocol/schemata/fetch_request.h"
 #include "kafka/types.h"
 #include "redpanda/tests/fixture.h"
 #include "security/audit/audit_log_manager.h"
@@ -116,6 +117,37 @@ FIXTURE_TEST(test_audit_init_phase, kafka_client_fixture) {
         return audit_mgr.local().is_effectively_enabled();
     }).get();
 
+    /// Repeated authz events are counted into the pending event, the
+    /// same as the events which are built and then found in the queue
+    auto enqueue_fetch_authz = [](sa::audit_log_manager& m) {
+        security::auth_result result{
+          .authorized = true,
+          .principal = security::acl_principal(
+            security::principal_type::user, "alice"),
+          .host = security::acl_host("127.0.0.1"),
+          .resource_type = security::resource_type::topic,
+          .resource_name = "tapioca",
+          .operation = security::acl_operation::read};
+        return m.enqueue_authz_audit_event(
+          kafka::fetch_api::key,
+          model::topic("tapioca"),
+          "fetch",
+          std::move(result),
+          ss::socket_address(ss::net::inet_address("127.0.0.1"), 9092),
+          std::string_view("kafka rpc protocol"),
+          ss::net::inet_address("127.0.0.2"),
+          uint16_t(5000),
+          std::make_optional<std::string_view>("client"));
+    };
+    const auto pending_before = audit_mgr.local().pending_events();
+    const auto aggregated_before = audit_mgr.local().aggregated_events();
+    for (auto i = 0; i < 10; ++i) {
+        BOOST_REQUIRE(enqueue_fetch_authz(audit_mgr.local()));
+    }
+    BOOST_CHECK_EQUAL(audit_mgr.local().pending_events(), pending_before + 1);
+    BOOST_CHECK_EQUAL(
+      audit_mgr.local().aggregated_events(), aggregated_before + 9);
+
     /// Verify auditing can enqueue up until the max configured, and further
     /// calls to enqueue return false, signifying action did not occur.
     auto enqueue_some = [event_size](sa::audit_log_manager& m) {
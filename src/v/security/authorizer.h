@@ -15,6 +15,7 @@
 #include "seastarx.h"
 #include "security/acl.h"
 #include "security/acl_store.h"
+#include "security/authz_decision_cache.h"
 #include "security/logger.h"
 #include "vlog.h"
 
@@ -241,14 +242,54 @@ public:
       acl_operation operation,
       const acl_principal& principal,
       const acl_host& host) const {
-        auto type = get_resource_type<T>();
-        auto acls = _store.find(type, resource_name());
-
         if (_superusers.contains(principal)) {
             return auth_result::superuser_authorized(
               principal, host, operation, resource_name);
         }
 
+        const auto type = get_resource_type<T>();
+        const decision_cache::key_view key{
+          .type = type,
+          .name = resource_name(),
+          .operation = operation,
+          .principal = principal,
+          .host = host};
+        if (const auto* cached = _decisions.find(_store.generation(), key);
+            cached != nullptr) {
+            return *cached;
+        }
+        auto result = authorize_with_acls(
+          type, resource_name, operation, principal, host);
+        _decisions.insert(_store.generation(), key, result);
+        return result;
+    }
+
+    ss::future<fragmented_vector<acl_binding>> all_bindings() const {
+        return _store.all_bindings();
+    }
+
+    ss::future<>
+    reset_bindings(const fragmented_vector<acl_binding>& bindings) {
+        return _store.reset_bindings(bindings);
+    }
+
+    acl_store& store() { return _store; }
+
+    /// Number of cached authorization decisions.
+    size_t cached_decisions() const { return _decisions.size(); }
+
+private:
+    using decision_cache = authz_decision_cache<auth_result>;
+
+    template<typename T>
+    auth_result authorize_with_acls(
+      resource_type type,
+      const T& resource_name,
+      acl_operation operation,
+      const acl_principal& principal,
+      const acl_host& host) const {
+        auto acls = _store.find(type, resource_name());
+
         if (acls.empty()) {
             return auth_result::empty_match_result(
               principal,
@@ -275,18 +316,6 @@ public:
           acl_any_implied_ops_allowed(acls, principal, host, operation));
     }
 
-    ss::future<fragmented_vector<acl_binding>> all_bindings() const {
-        return _store.all_bindings();
-    }
-
-    ss::future<>
-    reset_bindings(const fragmented_vector<acl_binding>& bindings) {
-        return _store.reset_bindings(bindings);
-    }
-
-    acl_store& store() { return _store; }
-
-private:
     /*
      * Compute whether the specified operation is allowed based on the implied
      * operations.
@@ -333,6 +362,8 @@ private:
         }
     }
     acl_store _store;
+    // Decisions of the ACLs of _store, the superusers are checked first
+    mutable decision_cache _decisions;
 
     // The list of superusers is stored twice: once as a vector in the
     // configuration subsystem, then again has a set here for fast lookups.
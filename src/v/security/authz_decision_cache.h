@@ -0,0 +1,147 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+#include "seastarx.h"
+#include "security/acl.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+
+#include <cstdint>
+#include <string_view>
+
+namespace security {
+
+/*
+ * Cache of the ACL authorization decisions of a shard, keyed by resource,
+ * operation, principal and host.
+ *
+ * Produce and fetch authorize every topic of every request, and the same
+ * few (principal, topic, operation) tuples come back over and over. A
+ * decision only depends on the ACLs, so the cache remembers the generation
+ * of the acl_store its decisions were made with, and drops them all when
+ * the ACLs change. The cached values may refer to the store, which is valid
+ * for as long as its generation doesn't change.
+ *
+ * The cache is cleared when it is full: the set of tuples a shard authorizes
+ * is usually small, and a full cache means it isn't worth keeping.
+ *
+ * The Value is the decision, the auth_result of the authorizer.
+ */
+template<typename Value>
+class authz_decision_cache {
+public:
+    static constexpr size_t max_entries = 16384;
+
+    struct key_view {
+        resource_type type;
+        std::string_view name;
+        acl_operation operation;
+        const acl_principal& principal;
+        const acl_host& host;
+
+        friend bool operator==(const key_view& a, const key_view& b) {
+            return a.type == b.type && a.name == b.name
+                   && a.operation == b.operation && a.principal == b.principal
+                   && a.host == b.host;
+        }
+    };
+
+    /// The decision for \p key made at \p generation of the ACLs, if any.
+    const Value* find(uint64_t generation, const key_view& key) {
+        if (generation != _generation) {
+            _decisions.clear();
+            _generation = generation;
+            return nullptr;
+        }
+        auto it = _decisions.find(key);
+        if (it == _decisions.end()) {
+            ++_misses;
+            return nullptr;
+        }
+        ++_hits;
+        return &it->second;
+    }
+
+    /// Remember the decision for \p key made at \p generation of the ACLs.
+    void insert(uint64_t generation, const key_view& key, Value value) {
+        if (generation != _generation) {
+            _decisions.clear();
+            _generation = generation;
+        }
+        if (_decisions.size() >= max_entries) {
+            _decisions.clear();
+        }
+        _decisions.emplace(key_type(key), std::move(value));
+    }
+
+    size_t size() const { return _decisions.size(); }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    struct key_type {
+        explicit key_type(const key_view& k)
+          : type(k.type)
+          , name(k.name.data(), k.name.size())
+          , operation(k.operation)
+          , principal(k.principal)
+          , host(k.host) {}
+
+        key_view view() const {
+            return {
+              .type = type,
+              .name = name,
+              .operation = operation,
+              .principal = principal,
+              .host = host};
+        }
+
+        resource_type type;
+        ss::sstring name;
+        acl_operation operation;
+        acl_principal principal;
+        acl_host host;
+    };
+
+    // heterogeneous, so that a lookup doesn't copy the key
+    struct key_hash {
+        using is_transparent = void;
+        size_t operator()(const key_view& k) const {
+            return absl::HashOf(
+              k.type, k.name, k.operation, k.principal, k.host);
+        }
+        size_t operator()(const key_type& k) const {
+            return (*this)(k.view());
+        }
+    };
+
+    struct key_eq {
+        using is_transparent = void;
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return as_view(a) == as_view(b);
+        }
+
+    private:
+        static key_view as_view(const key_view& k) { return k; }
+        static key_view as_view(const key_type& k) { return k.view(); }
+    };
+
+    absl::flat_hash_map<key_type, Value, key_hash, key_eq> _decisions;
+    uint64_t _generation{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+} // namespace security
@@ -107,6 +107,12 @@ public:
 
     result<authentication_data>
     authenticate(std::string_view bearer_token) const {
+        auto now = ss::lowres_system_clock::now();
+        if (auto cached = _service.find_authenticated(bearer_token, now);
+            cached.has_value()) {
+            return std::move(cached).value();
+        }
+
         auto jws = oidc::jws::make(ss::sstring{bearer_token});
         if (jws.has_error()) {
             vlog(
@@ -123,14 +129,18 @@ public:
             return issuer.assume_error();
         }
 
-        return oidc::authenticate(
+        auto res = oidc::authenticate(
           jws.assume_value(),
           _service.get_verifier(),
           _service.get_principal_mapping_rule(),
           issuer.assume_value(),
           _service.audience(),
           _service.clock_skew_tolerance(),
-          ss::lowres_system_clock::now());
+          now);
+        if (res.has_value()) {
+            _service.cache_authenticated(bearer_token, res.assume_value(), now);
+        }
+        return res;
     }
 
 private:
@@ -10,12 +10,14 @@
 #include "security/oidc_service.h"
 
 #include "http/client.h"
+#include "http/connection_pool.h"
 #include "metrics/metrics.h"
 #include "net/tls_certificate_probe.h"
 #include "prometheus/prometheus_sanitize.h"
 #include "security/exceptions.h"
 #include "security/jwt.h"
 #include "security/logger.h"
+#include "security/oidc_authenticator.h"
 #include "security/oidc_principal_mapping.h"
 #include "security/oidc_url_parser.h"
 #include "ssx/future-util.h"
@@ -134,6 +136,9 @@ private:
 } // namespace
 
 struct service::impl {
+    static constexpr size_t max_authenticated = 512;
+    static constexpr auto authenticated_ttl = 60s;
+
     ss::shard_id update_shard_id{0};
     impl(
       config::binding<std::vector<ss::sstring>> sasl_mechanisms,
@@ -164,6 +169,8 @@ struct service::impl {
         _discovery_url.watch([this]() {
             ssx::spawn_with_gate(_gate, [this] { return update(); });
         });
+        _token_audience.watch([this]() { _authenticated.clear(); });
+        _clock_skew_tolerance.watch([this]() { _authenticated.clear(); });
         _mapping.watch([this]() { update_rule(); });
         update_rule();
         _jwks_refresh_interval.watch([this]() {
@@ -274,6 +281,7 @@ struct service::impl {
         measure.success();
 
         _issuer.emplace(metadata.assume_value().issuer());
+        _authenticated.clear();
     }
 
     ss::future<> update_jwks() {
@@ -313,6 +321,7 @@ struct service::impl {
         measure.success();
 
         auto res = _verifier.update_keys(std::move(jwks).assume_value());
+        _authenticated.clear();
         if (res.has_error()) {
             co_await return_exception(
               res.assume_error(), "Error updating keys");
@@ -326,7 +335,39 @@ struct service::impl {
             vlog(seclog.error, "Rule failed to parse: {}", _mapping());
         } else {
             _rule = std::move(r).assume_value();
+            _authenticated.clear();
+        }
+    }
+
+    std::optional<authentication_data> find_authenticated(
+      std::string_view token, ss::lowres_system_clock::time_point now) {
+        auto it = _authenticated.find(token);
+        if (it == _authenticated.end()) {
+            return std::nullopt;
+        }
+        if (it->second.expires_at <= now) {
+            _authenticated.erase(it);
+            return std::nullopt;
+        }
+        return it->second.data;
+    }
+
+    void cache_authenticated(
+      std::string_view token,
+      authentication_data const& data,
+      ss::lowres_system_clock::time_point now) {
+        if (_authenticated.size() >= max_authenticated) {
+            // the tokens of a shard are usually few, a full cache isn't
+            // worth keeping
+            _authenticated.clear();
         }
+        _authenticated.insert_or_assign(
+          ss::sstring{token},
+          authenticated{
+            .data = data,
+            .expires_at = std::min(
+              now + authenticated_ttl,
+              data.expiry + _clock_skew_tolerance())});
     }
 
     ss::future<ss::sstring> make_request(parsed_url url) {
@@ -355,10 +396,10 @@ struct service::impl {
                   });
             }
         }
-        http::client client{net::base_transport::configuration{
+        net::base_transport::configuration client_cfg{
           .server_addr = {url.host, url.port},
           .credentials = is_https ? _creds : nullptr,
-          .tls_sni_hostname = tls_host}};
+          .tls_sni_hostname = tls_host};
 
         http::client::request_header req_hdr;
         req_hdr.method(boost::beast::http::verb::get);
@@ -368,10 +409,13 @@ struct service::impl {
           {url.host.data(), url.host.length()});
         req_hdr.insert(boost::beast::http::field::accept, "*/*");
 
-        co_return co_await http::with_client(
-          std::move(client),
-          [req_hdr{std::move(req_hdr)}](http::client& client) mutable {
-              return client.request(std::move(req_hdr))
+        // The discovery document and the keys are usually served by the same
+        // host, the second fetch reuses the connection of the first.
+        co_return co_await http::with_pooled_client(
+          std::move(client_cfg),
+          nullptr,
+          [req_hdr{std::move(req_hdr)}](http::client& client) {
+              return client.request(http::client::request_header{req_hdr})
                 .then([](auto res) -> ss::future<ss::sstring> {
                     ss::sstring response_body;
                     while (!res->is_done()) {
@@ -401,6 +445,17 @@ struct service::impl {
     ss::timer<ss::lowres_clock> _jwks_refresh;
     ss::shared_ptr<ss::tls::certificate_credentials> _creds;
     absl::flat_hash_map<ss::sstring, std::unique_ptr<probe>> _probes;
+
+    struct authenticated {
+        authentication_data data;
+        ss::lowres_system_clock::time_point expires_at;
+    };
+    absl::flat_hash_map<
+      ss::sstring,
+      authenticated,
+      detail::string_viewable_hasher,
+      detail::string_viewable_compare>
+      _authenticated;
 };
 
 service::service(
@@ -443,6 +498,22 @@ principal_mapping_rule const& service::get_principal_mapping_rule() const {
     return _impl->_rule;
 }
 
-ss::future<> service::refresh_keys() { return _impl->update_jwks(); }
+ss::future<> service::refresh_keys() {
+    // a refresh is also how tokens are revoked
+    _impl->_authenticated.clear();
+    return _impl->update_jwks();
+}
+
+std::optional<authentication_data> service::find_authenticated(
+  std::string_view bearer_token, ss::lowres_system_clock::time_point now) {
+    return _impl->find_authenticated(bearer_token, now);
+}
+
+void service::cache_authenticated(
+  std::string_view bearer_token,
+  authentication_data const& data,
+  ss::lowres_system_clock::time_point now) {
+    _impl->cache_authenticated(bearer_token, data, now);
+}
 
 } // namespace security::oidc
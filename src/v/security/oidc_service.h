@@ -13,6 +13,8 @@
 #include "outcome.h"
 #include "security/fwd.h"
 
+#include <seastar/core/lowres_clock.hh>
+
 #include <chrono>
 #include <memory>
 #include <optional>
@@ -48,6 +50,19 @@ public:
 
     ss::future<> refresh_keys();
 
+    /// The authentication of a bearer token which was verified recently.
+    ///
+    /// A client reconnecting, or sending HTTP requests, presents the same
+    /// token over and over. Successful authentications are kept for a short
+    /// while, and no longer than the token's expiry; they're dropped when the
+    /// keys, the issuer, the audience or the principal mapping change.
+    std::optional<authentication_data> find_authenticated(
+      std::string_view bearer_token, ss::lowres_system_clock::time_point now);
+    void cache_authenticated(
+      std::string_view bearer_token,
+      authentication_data const& data,
+      ss::lowres_system_clock::time_point now);
+
 private:
     struct impl;
     std::unique_ptr<impl> _impl;
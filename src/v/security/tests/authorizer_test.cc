@@ -895,6 +895,87 @@ BOOST_AUTO_TEST_CASE(single_char) {
     BOOST_REQUIRE(result.empty_matches);
 }
 
+BOOST_AUTO_TEST_CASE(nested_prefixes) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+
+    auto auth = make_test_instance();
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "f", pattern_type::prefixed),
+      allow_read_acl);
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "foo", pattern_type::prefixed),
+      allow_read_acl);
+    bindings.emplace_back(
+      resource_pattern(resource_type::group, "fo", pattern_type::prefixed),
+      deny_read_acl);
+    auth.add_bindings(bindings);
+
+    // the longest prefix is matched first, the group prefix doesn't apply
+    auto result = auth.authorized(
+      model::topic("foobar"), acl_operation::read, user, host);
+    BOOST_REQUIRE(result.authorized);
+    BOOST_REQUIRE_EQUAL(
+      result.resource_pattern,
+      resource_pattern(resource_type::topic, "foo", pattern_type::prefixed));
+
+    bindings.clear();
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "fo", pattern_type::prefixed),
+      deny_read_acl);
+    auth.add_bindings(bindings);
+
+    result = auth.authorized(
+      model::topic("foobar"), acl_operation::read, user, host);
+    BOOST_REQUIRE(!result.authorized);
+    BOOST_REQUIRE_EQUAL(
+      result.resource_pattern,
+      resource_pattern(resource_type::topic, "fo", pattern_type::prefixed));
+
+    result = auth.authorized(
+      model::topic("fa"), acl_operation::read, user, host);
+    BOOST_REQUIRE(result.authorized);
+}
+
+BOOST_AUTO_TEST_CASE(cached_decisions_follow_acl_changes) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+
+    auto auth = make_test_instance();
+
+    auto topic = model::topic(default_resource.name());
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE_EQUAL(auth.cached_decisions(), 1);
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(default_resource, allow_read_acl);
+    auth.add_bindings(bindings);
+    auto result = auth.authorized(topic, acl_operation::read, user, host);
+    BOOST_REQUIRE(result.authorized);
+    BOOST_REQUIRE_EQUAL(result.acl, allow_read_acl);
+    BOOST_REQUIRE_EQUAL(auth.cached_decisions(), 1);
+
+    // a dry run doesn't change the decisions
+    std::vector<acl_binding_filter> filters{acl_binding_filter(
+      resource_pattern_filter(default_resource), acl_entry_filter::any())};
+    auth.remove_bindings(filters, true);
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+
+    auth.remove_bindings(filters);
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+
+    // other operations, principals and resources are decided separately
+    acl_principal bob(principal_type::user, "bob");
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::write, user, host));
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, bob, host));
+    BOOST_REQUIRE(!auth.authorized(
+      kafka::group_id(topic()), acl_operation::read, user, host));
+    BOOST_REQUIRE_EQUAL(auth.cached_decisions(), 4);
+}
+
 BOOST_AUTO_TEST_CASE(get_acls_principal) {
     acl_principal user(principal_type::user, "alice");
 
@@ -12,9 +12,15 @@
 #include "bytes/iobuf_parser.h"
 #include "hashing/crc32c.h"
 #include "likely.h"
+#include "reflection/type_traits.h"
+#include "serde/envelope_for_each_field.h"
 #include "serde/logger.h"
 #include "serde/read_header.h"
+#include "serde/rw/map.h"
+#include "serde/rw/optional.h"
+#include "serde/rw/reservable.h"
 #include "serde/rw/rw.h"
+#include "serde/rw/vector.h"
 #include "ssx/future-util.h"
 #include "ssx/sformat.h"
 #include "vlog.h"
@@ -61,11 +67,178 @@ inline ss::future<crc::crc32c> calculate_crc_async(iobuf_const_parser in) {
       });
 }
 
+template<typename T>
+ss::future<std::decay_t<T>>
+read_async_nested(iobuf_parser& in, size_t const bytes_left_limit);
+
+template<typename T>
+ss::future<> write_async(iobuf& out, T t);
+
+/*
+ * Containers are read and written asynchronously element by element. The
+ * seastar loops below run synchronously for as long as the elements are
+ * ready and the task quota isn't exhausted, so small containers cost about
+ * the same as with the synchronous path while large ones (e.g. the topic
+ * table of a big cluster) yield to the reactor instead of stalling it.
+ *
+ * Vectors of arithmetic types are left to the synchronous path, they are
+ * cheap to encode and this keeps string-like types out of the way.
+ */
+template<typename T>
+concept async_vector = Vector<T>
+                       && !std::is_arithmetic_v<typename T::value_type>;
+
+template<typename T>
+concept async_map = Map<T>;
+
+template<typename T>
+void check_container_size(const T& t) {
+    if (unlikely(t.size() > std::numeric_limits<serde_size_t>::max())) {
+        throw serde_exception(fmt_with_ctx(
+          ssx::sformat,
+          "serde: {} size {} exceeds serde_size_t",
+          type_str<T>(),
+          t.size()));
+    }
+}
+
+template<async_vector Vec>
+ss::future<> write_vector_async(iobuf& out, Vec t) {
+    check_container_size(t);
+    write(out, static_cast<serde_size_t>(t.size()));
+    return ss::do_with(std::move(t), [&out](Vec& t) {
+        return ss::do_for_each(
+          t, [&out](auto& el) { return write_async(out, std::move(el)); });
+    });
+}
+
+template<async_map Map>
+ss::future<> write_map_async(iobuf& out, Map t) {
+    check_container_size(t);
+    write(out, static_cast<serde_size_t>(t.size()));
+    return ss::do_with(std::move(t), [&out](Map& t) {
+        return ss::do_for_each(t, [&out](auto& el) {
+            write(out, el.first);
+            return write_async(out, std::move(el.second));
+        });
+    });
+}
+
+template<async_vector Vec>
+ss::future<Vec>
+read_vector_async_nested(iobuf_parser& in, std::size_t const bytes_left_limit) {
+    using value_type = typename Vec::value_type;
+    auto const size = read_nested<serde_size_t>(in, bytes_left_limit);
+    return ss::do_with(Vec{}, [size, &in, bytes_left_limit](Vec& t) {
+        if constexpr (Reservable<Vec>) {
+            t.reserve(size);
+        }
+        return ss::do_until(
+                 [size, &t] { return t.size() == size; },
+                 [&t, &in, bytes_left_limit] {
+                     return read_async_nested<value_type>(in, bytes_left_limit)
+                       .then([&t](value_type v) { t.push_back(std::move(v)); });
+                 })
+          .then([&t] {
+              t.shrink_to_fit();
+              return std::move(t);
+          });
+    });
+}
+
+template<async_map Map>
+ss::future<Map>
+read_map_async_nested(iobuf_parser& in, std::size_t const bytes_left_limit) {
+    using key_type = typename Map::key_type;
+    using mapped_type = typename Map::mapped_type;
+    auto const size = read_nested<serde_size_t>(in, bytes_left_limit);
+    return ss::do_with(
+      Map{}, serde_size_t{0}, [size, &in, bytes_left_limit](Map& t, auto& n) {
+          if constexpr (Reservable<Map>) {
+              t.reserve(size);
+          }
+          return ss::do_until(
+                   [size, &n] { return n == size; },
+                   [&t, &n, &in, bytes_left_limit] {
+                       ++n;
+                       auto key = read_nested<key_type>(in, bytes_left_limit);
+                       return read_async_nested<mapped_type>(
+                                in, bytes_left_limit)
+                         .then([&t, key = std::move(key)](
+                                 mapped_type v) mutable {
+                             t.emplace(std::move(key), std::move(v));
+                         });
+                   })
+            .then([&t] { return std::move(t); });
+      });
+}
+
+/// Writes the fields of the envelope asynchronously one after the other.
+/// Meant to implement serde_async_write of large envelopes whose fields are
+/// containers:
+///
+///   ss::future<> serde_async_write(iobuf& out) {
+///       return serde::write_fields_async(out, *this);
+///   }
+template<typename T>
+ss::future<> write_fields_async(iobuf& out, T& t) {
+    auto f = ss::now();
+    envelope_for_each_field(t, [&out, &f](auto& field) {
+        f = f.then(
+          [&out, &field] { return write_async(out, std::move(field)); });
+    });
+    return f;
+}
+
+/// Counterpart of write_fields_async() implementing serde_async_read. Like
+/// the synchronous path, fields missing from older versions of the envelope
+/// are left untouched and fields added by newer versions are skipped.
+template<typename T>
+ss::future<> read_fields_async(iobuf_parser& in, T& t, header const h) {
+    auto f = ss::now();
+    envelope_for_each_field(t, [&in, &f, h](auto& field) {
+        using FieldType = std::decay_t<decltype(field)>;
+        f = f.then([&in, &field, h] {
+            if (h._bytes_left_limit == in.bytes_left()) {
+                return ss::now();
+            }
+            if (unlikely(in.bytes_left() < h._bytes_left_limit)) {
+                throw serde_exception(fmt_with_ctx(
+                  ssx::sformat,
+                  "field spill over in {}, field type {}: envelope_end={}, "
+                  "in.bytes_left()={}",
+                  type_str<T>(),
+                  type_str<FieldType>(),
+                  h._bytes_left_limit,
+                  in.bytes_left()));
+            }
+            return read_async_nested<FieldType>(in, h._bytes_left_limit)
+              .then([&field](FieldType v) { field = std::move(v); });
+        });
+    });
+    return f.then([&in, h] {
+        if (in.bytes_left() > h._bytes_left_limit) {
+            in.skip(in.bytes_left() - h._bytes_left_limit);
+        }
+    });
+}
+
 template<typename T>
 ss::future<std::decay_t<T>>
 read_async_nested(iobuf_parser& in, size_t const bytes_left_limit) {
     using Type = std::decay_t<T>;
-    if constexpr (
+    if constexpr (async_vector<Type>) {
+        return read_vector_async_nested<Type>(in, bytes_left_limit);
+    } else if constexpr (async_map<Type>) {
+        return read_map_async_nested<Type>(in, bytes_left_limit);
+    } else if constexpr (reflection::is_std_optional<Type>) {
+        using value_type = typename Type::value_type;
+        if (!read_nested<bool>(in, bytes_left_limit)) {
+            return ss::make_ready_future<Type>(std::nullopt);
+        }
+        return read_async_nested<value_type>(in, bytes_left_limit)
+          .then([](value_type v) { return Type{std::move(v)}; });
+    } else if constexpr (
       has_serde_async_direct_read<Type> || has_serde_async_read<Type>) {
         auto const h = read_header<Type>(in, bytes_left_limit);
         auto f = ss::now();
@@ -184,6 +357,17 @@ ss::future<> write_async(iobuf& out, T t) {
                     }
                 });
           });
+    } else if constexpr (async_vector<Type>) {
+        return write_vector_async(out, std::move(t));
+    } else if constexpr (async_map<Type>) {
+        return write_map_async(out, std::move(t));
+    } else if constexpr (reflection::is_std_optional<Type>) {
+        if (!t) {
+            write(out, false);
+            return ss::now();
+        }
+        write(out, true);
+        return write_async(out, std::move(t.value()));
     } else {
         write(out, std::move(t));
         return ss::make_ready_future<>();
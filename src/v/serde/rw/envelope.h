@@ -14,9 +14,12 @@
 #include "serde/envelope.h"
 #include "serde/envelope_for_each_field.h"
 #include "serde/read_header.h"
+#include "serde/rw/fixed_size.h"
 #include "serde/rw/rw.h"
 #include "serde/serde_size_t.h"
 
+#include <array>
+#include <limits>
 #include <type_traits>
 
 namespace serde {
@@ -29,6 +32,12 @@ concept has_serde_read = requires(T t, iobuf_parser& in, const header& h) {
     t.serde_read(in, h);
 };
 
+template<typename T>
+concept fixed_size_envelope
+  = inherits_from_envelope<T> && !is_checksum_envelope<T>
+    && !has_serde_write<T> && !has_serde_read<T>
+    && (envelope_fixed_fields_size<T>() > 0);
+
 template<typename T>
 requires is_envelope<std::decay_t<T>>
 void tag_invoke(
@@ -37,6 +46,20 @@ void tag_invoke(
 
     auto const h = read_header<Type>(in, bytes_left_limit);
 
+    if constexpr (fixed_size_envelope<Type>) {
+        // Envelopes written by other versions of the type may have more or
+        // fewer fields, those go through the generic path below.
+        constexpr auto fields_size = envelope_fixed_fields_size<Type>();
+        if (in.bytes_left() - h._bytes_left_limit == fields_size) {
+            std::array<char, fields_size> buf;
+            in.consume_to(buf.size(), buf.data());
+            const char* src = buf.data();
+            envelope_for_each_field(
+              t, [&src](auto& f) { read_fixed(src, f); });
+            return;
+        }
+    }
+
     if constexpr (is_checksum_envelope<Type>) {
         auto const shared = in.share_no_consume(
           in.bytes_left() - h._bytes_left_limit);
@@ -92,6 +115,24 @@ requires is_envelope<std::decay_t<T>>
 void tag_invoke(tag_t<write_tag>, iobuf& out, T t) {
     using Type = std::decay_t<T>;
 
+    if constexpr (fixed_size_envelope<Type>) {
+        constexpr auto fields_size = envelope_fixed_fields_size<Type>();
+        static_assert(
+          fields_size <= std::numeric_limits<serde_size_t>::max(),
+          "envelope too big");
+        std::array<
+          char,
+          2 * sizeof(version_t) + sizeof(serde_size_t) + fields_size>
+          buf;
+        char* dst = buf.data();
+        write_fixed(dst, Type::redpanda_serde_version);
+        write_fixed(dst, Type::redpanda_serde_compat_version);
+        write_fixed(dst, static_cast<serde_size_t>(fields_size));
+        envelope_for_each_field(t, [&dst](auto& f) { write_fixed(dst, f); });
+        out.append(buf.data(), buf.size());
+        return;
+    }
+
     write(out, Type::redpanda_serde_version);
     write(out, Type::redpanda_serde_compat_version);
 
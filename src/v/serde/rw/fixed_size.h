@@ -0,0 +1,145 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+
+#include "serde/envelope.h"
+#include "serde/envelope_for_each_field.h"
+#include "serde/serde_is_enum.h"
+#include "utils/named_type.h"
+
+#include <seastar/core/byteorder.hh>
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Envelopes whose fields are all fixed size (arithmetic types and named types
+ * of them) have a wire size that is known at compile time. Such envelopes are
+ * written with a single append of a stack buffer and read with a single copy
+ * out of the parser, instead of field by field through the iobuf.
+ *
+ * The wire format is exactly the one of the generic path: every field is
+ * little endian and there is no padding.
+ */
+namespace serde {
+
+namespace detail {
+
+template<typename T, typename Tag, typename IsConstexpr>
+std::true_type
+  is_named_type_impl(const ::detail::base_named_type<T, Tag, IsConstexpr>*);
+std::false_type is_named_type_impl(...);
+
+template<typename T>
+inline constexpr bool is_named_type_v
+  = decltype(is_named_type_impl(std::declval<T*>()))::value;
+
+} // namespace detail
+
+/// Size of T on the wire, or 0 if it isn't known at compile time.
+template<typename T>
+consteval size_t fixed_wire_size() {
+    using Type = std::decay_t<T>;
+    if constexpr (detail::is_named_type_v<Type>) {
+        return fixed_wire_size<typename Type::type>();
+    } else if constexpr (
+      std::is_arithmetic_v<Type> && !serde_is_enum_v<Type>) {
+        return sizeof(Type);
+    } else {
+        return 0;
+    }
+}
+
+/// Size of the fields of the envelope T on the wire, or 0 if any of them
+/// isn't of fixed size.
+template<typename T>
+consteval size_t envelope_fixed_fields_size() {
+    using tuple_t = std::decay_t<decltype(envelope_to_tuple(
+      std::declval<T&>()))>;
+    constexpr auto n = std::tuple_size_v<tuple_t>;
+    return []<size_t... I>(std::index_sequence<I...>) {
+        constexpr std::array<size_t, sizeof...(I)> sizes{
+          fixed_wire_size<std::tuple_element_t<I, tuple_t>>()...};
+        size_t total = 0;
+        for (auto s : sizes) {
+            if (s == 0) {
+                return size_t{0};
+            }
+            total += s;
+        }
+        return total;
+    }(std::make_index_sequence<n>{});
+}
+
+template<typename T>
+void write_fixed(char*& dst, const T& t) {
+    using Type = std::decay_t<T>;
+    if constexpr (detail::is_named_type_v<Type>) {
+        write_fixed(dst, t());
+    } else if constexpr (std::is_same_v<bool, Type>) {
+        auto const b = static_cast<int8_t>(t);
+        std::memcpy(dst, &b, sizeof(b));
+        dst += sizeof(b);
+    } else if constexpr (sizeof(Type) == 1) {
+        std::memcpy(dst, &t, sizeof(t));
+        dst += sizeof(t);
+    } else if constexpr (std::is_same_v<float, Type>) {
+        auto const le_t = htole32(std::bit_cast<std::uint32_t>(t));
+        std::memcpy(dst, &le_t, sizeof(le_t));
+        dst += sizeof(le_t);
+    } else if constexpr (std::is_same_v<double, Type>) {
+        auto const le_t = htole64(std::bit_cast<std::uint64_t>(t));
+        std::memcpy(dst, &le_t, sizeof(le_t));
+        dst += sizeof(le_t);
+    } else {
+        auto const le_t = ss::cpu_to_le(t);
+        std::memcpy(dst, &le_t, sizeof(le_t));
+        dst += sizeof(le_t);
+    }
+}
+
+template<typename T>
+void read_fixed(const char*& src, T& t) {
+    using Type = std::decay_t<T>;
+    if constexpr (detail::is_named_type_v<Type>) {
+        typename Type::type v;
+        read_fixed(src, v);
+        t = Type{v};
+    } else if constexpr (std::is_same_v<bool, Type>) {
+        int8_t b = 0;
+        std::memcpy(&b, src, sizeof(b));
+        src += sizeof(b);
+        t = (b != 0);
+    } else if constexpr (sizeof(Type) == 1) {
+        std::memcpy(&t, src, sizeof(t));
+        src += sizeof(t);
+    } else if constexpr (std::is_same_v<float, Type>) {
+        std::uint32_t le_t = 0;
+        std::memcpy(&le_t, src, sizeof(le_t));
+        src += sizeof(le_t);
+        t = std::bit_cast<float>(le32toh(le_t));
+    } else if constexpr (std::is_same_v<double, Type>) {
+        std::uint64_t le_t = 0;
+        std::memcpy(&le_t, src, sizeof(le_t));
+        src += sizeof(le_t);
+        t = std::bit_cast<double>(le64toh(le_t));
+    } else {
+        Type le_t{};
+        std::memcpy(&le_t, src, sizeof(le_t));
+        src += sizeof(le_t);
+        t = ss::le_to_cpu(le_t);
+    }
+}
+
+} // namespace serde
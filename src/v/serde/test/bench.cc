@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "model/fundamental.h"
 #include "serde/serde.h"
 
 #include <seastar/core/reactor.hh>
@@ -38,6 +39,54 @@ PERF_TEST(small, deserialize) {
     perf_tests::stop_measuring_time();
 }
 
+// layout of raft::protocol_metadata, all fields are of fixed size and take
+// the compile time sized path
+struct metadata_t
+  : public serde::
+      envelope<metadata_t, serde::version<0>, serde::compat_version<0>> {
+    model::term_id term{11};
+    model::offset prev_log_index{12};
+    model::term_id prev_log_term{13};
+    model::offset last_visible_index{14};
+    model::offset dirty_offset{15};
+};
+
+// same as metadata_t with a variable size field which forces the generic path
+struct metadata_var_t
+  : public serde::
+      envelope<metadata_var_t, serde::version<0>, serde::compat_version<0>> {
+    model::term_id term{11};
+    model::offset prev_log_index{12};
+    model::term_id prev_log_term{13};
+    model::offset last_visible_index{14};
+    model::offset dirty_offset{15};
+    ss::sstring name{"name"};
+};
+
+template<typename T>
+void serialize_metadata() {
+    perf_tests::start_measuring_time();
+    auto o = serde::to_iobuf(T{});
+    perf_tests::do_not_optimize(o);
+    perf_tests::stop_measuring_time();
+}
+
+template<typename T>
+void deserialize_metadata() {
+    auto b = serde::to_iobuf(T{});
+    perf_tests::start_measuring_time();
+    auto result = serde::from_iobuf<T>(std::move(b));
+    perf_tests::do_not_optimize(result);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST(metadata_fixed, serialize) { serialize_metadata<metadata_t>(); }
+PERF_TEST(metadata_fixed, deserialize) { deserialize_metadata<metadata_t>(); }
+PERF_TEST(metadata_var, serialize) { serialize_metadata<metadata_var_t>(); }
+PERF_TEST(metadata_var, deserialize) {
+    deserialize_metadata<metadata_var_t>();
+}
+
 struct big_t
   : public serde::envelope<big_t, serde::version<3>, serde::compat_version<2>> {
     small_t s;
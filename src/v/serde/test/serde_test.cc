@@ -31,6 +31,7 @@
 
 #include <chrono>
 #include <limits>
+#include <map>
 #include <optional>
 #include <ratio>
 
@@ -559,6 +560,46 @@ SEASTAR_THREAD_TEST_CASE(compat_test_removed_field_vector) {
     BOOST_CHECK(deserialized.at(1).c == 789);
 }
 
+struct fixed_named
+  : public serde::
+      envelope<fixed_named, serde::version<2>, serde::compat_version<1>> {
+    bool operator==(const fixed_named&) const = default;
+
+    model::term_id term;
+    model::offset offset;
+    bool flag{false};
+    int16_t s{0};
+    double d{0};
+};
+
+SEASTAR_THREAD_TEST_CASE(fixed_size_envelope_wire_format) {
+    static_assert(serde::fixed_size_envelope<fixed_named>);
+    static_assert(serde::envelope_fixed_fields_size<fixed_named>() == 27);
+    static_assert(!serde::fixed_size_envelope<test_snapshot_header>);
+
+    auto const v = fixed_named{
+      .term = model::term_id{7},
+      .offset = model::offset{-12345},
+      .flag = true,
+      .s = 0x1234,
+      .d = 3.5};
+
+    // the fixed size path must produce the same bytes as the generic one
+    auto expected = iobuf{};
+    serde::write(expected, uint8_t{2});
+    serde::write(expected, uint8_t{1});
+    serde::write(expected, serde::serde_size_t{27});
+    serde::write(expected, v.term);
+    serde::write(expected, v.offset);
+    serde::write(expected, v.flag);
+    serde::write(expected, v.s);
+    serde::write(expected, v.d);
+
+    auto b = serde::to_iobuf(v);
+    BOOST_CHECK(b == expected);
+    BOOST_CHECK(serde::from_iobuf<fixed_named>(std::move(b)) == v);
+}
+
 SEASTAR_THREAD_TEST_CASE(compat_test_half_field_1) {
     struct half_field_1
       : public serde::envelope<
@@ -1061,6 +1102,99 @@ SEASTAR_THREAD_TEST_CASE(test_async_checksummed) {
           });
     }
 }
+
+struct async_fields_v0
+  : public serde::
+      envelope<async_fields_v0, serde::version<0>, serde::compat_version<0>> {
+    fragmented_vector<test_msg0> msgs;
+    std::map<int32_t, ss::sstring> names;
+
+    bool operator==(const async_fields_v0&) const = default;
+
+    ss::future<> serde_async_write(iobuf& out) {
+        return serde::write_fields_async(out, *this);
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, serde::header const h) {
+        return serde::read_fields_async(in, *this, h);
+    }
+};
+
+struct async_fields_v1
+  : public serde::
+      envelope<async_fields_v1, serde::version<1>, serde::compat_version<0>> {
+    fragmented_vector<test_msg0> msgs;
+    std::map<int32_t, ss::sstring> names;
+    std::optional<std::vector<async_fields_v0>> nested;
+
+    bool operator==(const async_fields_v1&) const = default;
+
+    ss::future<> serde_async_write(iobuf& out) {
+        return serde::write_fields_async(out, *this);
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, serde::header const h) {
+        return serde::read_fields_async(in, *this, h);
+    }
+};
+
+template<typename T>
+T make_async_fields(size_t n) {
+    T ret;
+    for (size_t i = 0; i < n; ++i) {
+        ret.msgs.push_back(test_msg0{
+          ._i = static_cast<char>(i), ._j = static_cast<char>(i + 1)});
+        ret.names.emplace(
+          static_cast<int32_t>(i), random_generators::gen_alphanum_string(8));
+    }
+    return ret;
+}
+
+SEASTAR_THREAD_TEST_CASE(async_fields_test) {
+    constexpr size_t n = 10000;
+    auto obj = make_async_fields<async_fields_v1>(n);
+    obj.nested.emplace();
+    obj.nested->push_back(make_async_fields<async_fields_v0>(10));
+
+    auto copy = [](const async_fields_v1& o) {
+        async_fields_v1 ret;
+        ret.msgs = o.msgs.copy();
+        ret.names = o.names;
+        ret.nested = o.nested;
+        return ret;
+    };
+
+    // roundtrip, the encoding is the same as the synchronous one
+    auto b = iobuf{};
+    serde::write_async(b, copy(obj)).get();
+    BOOST_CHECK(b == serde::to_iobuf(copy(obj)));
+    {
+        auto parser = iobuf_parser{b.copy()};
+        BOOST_CHECK(obj == serde::read_async<async_fields_v1>(parser).get());
+    }
+    BOOST_CHECK(obj == serde::from_iobuf<async_fields_v1>(b.copy()));
+
+    // the field added in v1 is skipped by v0
+    {
+        auto parser = iobuf_parser{b.copy()};
+        auto v0 = serde::read_async<async_fields_v0>(parser).get();
+        BOOST_CHECK(v0.msgs == obj.msgs);
+        BOOST_CHECK(v0.names == obj.names);
+    }
+
+    // and left untouched when reading v0
+    {
+        auto v0 = make_async_fields<async_fields_v0>(n);
+        auto b0 = iobuf{};
+        serde::write_async(b0, std::move(v0)).get();
+        auto parser = iobuf_parser{std::move(b0)};
+        auto v1 = serde::read_async<async_fields_v1>(parser).get();
+        BOOST_CHECK_EQUAL(v1.msgs.size(), n);
+        BOOST_CHECK_EQUAL(v1.names.size(), n);
+        BOOST_CHECK(!v1.nested.has_value());
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(collections_interop) {
     auto vector = tests::random_vector(
       []() { return random_generators::gen_alphanum_string(32); }, 1024);
@@ -38,6 +38,7 @@ public:
       , _feature_table(feature_table) {}
 
     ss::future<> start() {
+        _resources.get_flush_coordinator().probe().setup_metrics();
         _kvstore = std::make_unique<kvstore>(
           _kv_conf_cb(), _resources, _feature_table);
         return _kvstore->start().then([this] {
@@ -56,9 +57,10 @@ public:
             f = _log_mgr->stop();
         }
         if (_kvstore) {
-            return f.then([this] { return _kvstore->stop(); });
+            f = f.then([this] { return _kvstore->stop(); });
         }
-        return f;
+        return f.then(
+          [this] { return _resources.get_flush_coordinator().stop(); });
     }
 
     void set_node_uuid(const model::node_uuid& node_uuid) {
@@ -10,6 +10,7 @@
 
 #include "config/configuration.h"
 #include "prometheus/prometheus_sanitize.h"
+#include "storage/backlog_coordinator.h"
 #include "ssx/future-util.h"
 #include "ssx/sformat.h"
 #include "vlog.h"
@@ -33,7 +34,8 @@ backlog_controller_config::backlog_controller_config(
   ss::scheduling_group sg,
   ss::io_priority_class iop,
   int min,
-  int max)
+  int max,
+  int priority)
   : proportional_coeff(kp)
   , integral_coeff(ki)
   , derivative_coeff(kd)
@@ -44,7 +46,8 @@ backlog_controller_config::backlog_controller_config(
   , scheduling_group(sg)
   , io_priority(iop)
   , min_shares(min)
-  , max_shares(max) {}
+  , max_shares(max)
+  , priority(priority) {}
 
 backlog_controller::backlog_controller(
   std::unique_ptr<sampler> sampler,
@@ -60,9 +63,11 @@ backlog_controller::backlog_controller(
   , _scheduling_group(cfg.scheduling_group)
   , _io_priority(cfg.io_priority)
   , _setpoint(cfg.setpoint / _norm)
+  , _desired_shares(cfg.initial_shares)
   , _current_shares(cfg.initial_shares)
   , _min_shares(cfg.min_shares)
-  , _max_shares(cfg.max_shares) {}
+  , _max_shares(cfg.max_shares)
+  , _priority(cfg.priority) {}
 
 ss::future<> backlog_controller::start() {
     _current_backlog = co_await _sampler->sample_backlog() / _norm;
@@ -86,6 +91,7 @@ void backlog_controller::update_setpoint(int64_t v) {
 
 ss::future<> backlog_controller::stop() {
     _sampling_timer.cancel();
+    backlog_coordinator::local().remove(this);
     return _gate.close();
 }
 
@@ -106,17 +112,24 @@ ss::future<> backlog_controller::update() {
                   * static_cast<double>(current_err - _prev_error);
     }
     update *= _proportional_coeff;
-    _current_shares = std::clamp(
+    _desired_shares = std::clamp(
       static_cast<int>(update), _min_shares, _max_shares);
+    _current_shares = backlog_coordinator::local().grant(
+      this,
+      {.shares = _desired_shares,
+       .min_shares = _min_shares,
+       .priority = _priority});
     vlog(
       _log.trace,
       "state update: {{setpoint: {}, current_backlog: {}, current_error: {}, "
-      "prev_error: {}, shares_update: {}, current_share: {} }}",
+      "prev_error: {}, shares_update: {}, desired_shares: {}, "
+      "current_share: {} }}",
       _setpoint,
       _current_backlog,
       current_err,
       _prev_error,
       update,
+      _desired_shares,
       _current_shares);
 
     // update error sample
@@ -149,6 +162,11 @@ void backlog_controller::setup_metrics(const ss::sstring& controller_label) {
           "shares",
           [this] { return _current_shares; },
           sm::description("controller output, i.e. number of shares")),
+        sm::make_gauge(
+          "desired_shares",
+          [this] { return _desired_shares; },
+          sm::description("shares wanted by the controller, before the "
+                          "shard budget is shared out")),
         sm::make_gauge(
           "backlog_size",
           [this] { return _current_backlog; },
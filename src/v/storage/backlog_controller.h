@@ -30,7 +30,8 @@ struct backlog_controller_config {
       ss::scheduling_group sg,
       ss::io_priority_class iopc,
       int min_shares,
-      int max_shares);
+      int max_shares,
+      int priority = 1);
 
     double proportional_coeff;
     double integral_coeff;
@@ -43,6 +44,9 @@ struct backlog_controller_config {
     ss::io_priority_class io_priority;
     int min_shares;
     int max_shares;
+    // weight of the controller when the backlog_coordinator of the shard has
+    // to share out its budget
+    int priority;
 };
 /**
  * Backlog controller is PID controller implementation to manage amount of
@@ -83,6 +87,10 @@ struct backlog_controller_config {
  *
  * Both the integral and derivative actions of the controller can be disabled
  * by setting corresponding coefficient to 0.
+ *
+ * The shares computed by the controller are a demand: the backlog_coordinator
+ * of the shard decides how many of them are granted, given the demands of the
+ * other controllers and the foreground latency.
  */
 class backlog_controller {
 public:
@@ -122,9 +130,11 @@ private:
     int64_t _prev_error{0};
     int64_t _error_integral{0};
     int64_t _setpoint;
+    int _desired_shares;
     int _current_shares;
     int _min_shares;
     int _max_shares;
+    int _priority;
     ss::gate _gate;
     metrics::internal_metric_groups _metrics;
 };
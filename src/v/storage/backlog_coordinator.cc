@@ -0,0 +1,93 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "storage/backlog_coordinator.h"
+
+#include "config/configuration.h"
+
+#include <algorithm>
+
+namespace storage {
+
+backlog_coordinator::backlog_coordinator(
+  config::binding<std::optional<int32_t>> budget,
+  config::binding<std::optional<std::chrono::milliseconds>> latency_target)
+  : _budget(std::move(budget))
+  , _latency_target(std::move(latency_target)) {}
+
+backlog_coordinator& backlog_coordinator::local() {
+    static thread_local backlog_coordinator coordinator(
+      config::shard_local_cfg().backlog_ctrl_shares_budget.bind(),
+      config::shard_local_cfg().backlog_ctrl_latency_target_ms.bind());
+    return coordinator;
+}
+
+void backlog_coordinator::record_foreground_latency(
+  std::chrono::steady_clock::duration d) {
+    static constexpr double alpha = 0.05;
+    auto us = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+    auto now = ss::lowres_clock::now();
+    if (_latency_us == 0 || now - _last_latency_sample > latency_expiry) {
+        _latency_us = us;
+    } else {
+        _latency_us = alpha * us + (1.0 - alpha) * _latency_us;
+    }
+    _last_latency_sample = now;
+}
+
+std::optional<int> backlog_coordinator::budget() const {
+    if (!_budget()) {
+        return std::nullopt;
+    }
+    auto budget = static_cast<double>(*_budget());
+    auto target = _latency_target();
+    if (
+      target
+      && ss::lowres_clock::now() - _last_latency_sample <= latency_expiry) {
+        auto target_us = static_cast<double>(
+          std::chrono::duration_cast<std::chrono::microseconds>(*target)
+            .count());
+        if (_latency_us > target_us) {
+            budget *= target_us / _latency_us;
+        }
+    }
+    return static_cast<int>(budget);
+}
+
+int backlog_coordinator::grant(const void* controller, demand d) {
+    _demands[controller] = d;
+    auto budget = this->budget();
+    if (!budget) {
+        return d.shares;
+    }
+
+    int demanded = 0;
+    double weighted = 0;
+    for (const auto& [_, other] : _demands) {
+        demanded += other.shares;
+        weighted += static_cast<double>(other.priority)
+                    * static_cast<double>(other.shares);
+    }
+    if (demanded <= *budget || weighted <= 0) {
+        return d.shares;
+    }
+    auto granted = static_cast<double>(*budget)
+                   * static_cast<double>(d.priority)
+                   * static_cast<double>(d.shares) / weighted;
+    return std::clamp(
+      static_cast<int>(granted),
+      d.min_shares,
+      std::max(d.min_shares, d.shares));
+}
+
+void backlog_coordinator::remove(const void* controller) {
+    _demands.erase(controller);
+}
+
+} // namespace storage
@@ -0,0 +1,77 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+#include "config/property.h"
+#include "seastarx.h"
+
+#include <seastar/core/lowres_clock.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+#include <optional>
+
+namespace storage {
+
+/**
+ * Divides a shard wide budget of IO and CPU shares between the backlog
+ * controllers of a shard (compaction and archival uploads).
+ *
+ * Every controller computes the shares it wants from its own backlog. As long
+ * as the demands fit in the budget they are granted as is; beyond it the
+ * budget is shared out in proportion to demand times priority, so that a
+ * controller with a large backlog or a high priority gets more of it, and
+ * every controller keeps at least its minimum shares.
+ *
+ * The budget shrinks while the foreground latency (the end-to-end produce
+ * latency of the shard) is above its target, by the ratio of the target to
+ * the latency: background work backs off when it starts to hurt the clients.
+ *
+ * Without a budget the demands are always granted, i.e. the controllers work
+ * independently of each other.
+ */
+class backlog_coordinator {
+public:
+    struct demand {
+        int shares;
+        int min_shares;
+        int priority;
+    };
+
+    backlog_coordinator(
+      config::binding<std::optional<int32_t>> budget,
+      config::binding<std::optional<std::chrono::milliseconds>>
+        latency_target);
+
+    /// The coordinator of the controllers of this shard.
+    static backlog_coordinator& local();
+
+    /// Update the demand of \p controller, returns the shares it is granted.
+    int grant(const void* controller, demand);
+    void remove(const void* controller);
+
+    void record_foreground_latency(std::chrono::steady_clock::duration);
+
+    /// The budget after the foreground latency adjustment, if any.
+    std::optional<int> budget() const;
+
+private:
+    // a latency that hasn't been refreshed for this long is ignored, there is
+    // no foreground load to protect
+    static constexpr auto latency_expiry = std::chrono::seconds(10);
+
+    config::binding<std::optional<int32_t>> _budget;
+    config::binding<std::optional<std::chrono::milliseconds>> _latency_target;
+    absl::flat_hash_map<const void*, demand> _demands;
+    double _latency_us{0};
+    ss::lowres_clock::time_point _last_latency_sample;
+};
+
+} // namespace storage
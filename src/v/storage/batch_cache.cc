@@ -21,6 +21,7 @@
 #include <seastar/core/gate.hh>
 #include <seastar/util/defer.hh>
 
+#include <absl/hash/hash.h>
 #include <fmt/ostream.h>
 
 namespace storage {
@@ -128,10 +129,15 @@ batch_cache::batch_cache(const reclaim_options& opts)
   : _reclaimer(
     [this](reclaimer::request r) { return reclaim(r); }, reclaim_scope::sync)
   , _reclaim_opts(opts)
+  , _admission(
+      opts.admission_filter ? std::make_unique<admission_filter>() : nullptr)
   , _reclaim_size(_reclaim_opts.min_size)
   , _background_reclaimer(
       *this, opts.min_free_memory, opts.background_reclaimer_sg)
-  , _available_mem_deregister(register_memory_reporter(*this)) {
+  , _available_mem_deregister(register_memory_reporter(*this))
+  , _usage_deregister(
+      resources::available_memory::local().register_usage_reporter(
+        "batch_cache", [this] { return size_bytes(); })) {
     _background_reclaimer.start();
 }
 
@@ -432,15 +438,48 @@ ss::future<> batch_cache::background_reclaimer::reclaim_loop() {
     co_return;
 }
 
+bool batch_cache::admit(const batch_cache_index& index, model::offset o) {
+    if (!_admission) {
+        return true;
+    }
+    return _admission->test_and_record(
+      absl::HashOf(reinterpret_cast<uintptr_t>(&index), o()));
+}
+
+bool batch_cache::admission_filter::test_and_record(size_t hash) {
+    // two probes derived from the two halves of the hash. both bits are set
+    // whatever the result of the first test.
+    const bool first = test_and_set(hash % bits);
+    const bool second = test_and_set((hash >> 32U) % bits);
+    if (first && second) {
+        return true;
+    }
+    if (++_recorded >= window_size) {
+        std::fill(_words.begin(), _words.end(), 0);
+        _recorded = 0;
+    }
+    return false;
+}
+
+bool batch_cache::admission_filter::test_and_set(size_t bit) {
+    auto& word = _words[bit / 64];
+    const uint64_t mask = uint64_t(1) << (bit % 64);
+    const bool was_set = (word & mask) != 0;
+    word |= mask;
+    return was_set;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const batch_cache::reclaim_options& opts) {
     fmt::print(
       os,
-      "growth window {} stable window {} min_size {} max_size {}",
+      "growth window {} stable window {} min_size {} max_size {} "
+      "admission_filter {}",
       opts.growth_window,
       opts.stable_window,
       opts.min_size,
-      opts.max_size);
+      opts.max_size,
+      opts.admission_filter);
     return os;
 }
 
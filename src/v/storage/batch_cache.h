@@ -24,6 +24,7 @@
 #include <seastar/core/memory.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/weak_ptr.hh>
+#include <seastar/util/bool_class.hh>
 
 #include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
@@ -107,6 +108,8 @@ class batch_cache {
     using reclaim_result = ss::memory::reclaiming_result;
 
 public:
+    using disk_read = ss::bool_class<struct disk_read_tag>;
+
     struct reclaim_options {
         ss::lowres_clock::duration growth_window;
         ss::lowres_clock::duration stable_window;
@@ -115,6 +118,8 @@ public:
         // background reclaimer settings
         ss::scheduling_group background_reclaimer_sg;
         size_t min_free_memory = 64_MiB;
+        // filter the admission of batches read from disk, see admit()
+        bool admission_filter = false;
     };
 
     /*
@@ -312,8 +317,39 @@ public:
      */
     size_t size_bytes() const { return _size_bytes; }
 
+    /**
+     * Returns true if a batch read from disk at the given offset of the index
+     * should be inserted into the cache.
+     *
+     * Without the admission filter every batch is admitted. With the filter a
+     * batch is admitted on its second read within a window of recent reads,
+     * so that a scan reading every batch once doesn't evict the batches which
+     * are read repeatedly (the doorkeeper of TinyLFU).
+     */
+    bool admit(const batch_cache_index&, model::offset);
+
 private:
     friend batch_cache_test_fixture;
+
+    /*
+     * Bloom filter of the recent reads of batches missing from the cache. It
+     * is cleared every window_size recorded reads to age out old reads.
+     */
+    class admission_filter {
+    public:
+        static constexpr size_t bits = 1U << 20U;
+        static constexpr size_t window_size = bits / 8;
+
+        // records a read, returning true if it was seen in the window
+        bool test_and_record(size_t hash);
+
+    private:
+        bool test_and_set(size_t bit);
+
+        std::vector<uint64_t> _words = std::vector<uint64_t>(bits / 64);
+        size_t _recorded{0};
+    };
+
     struct batch_reclaiming_lock {
         explicit batch_reclaiming_lock(batch_cache& b) noexcept
           : ref(b)
@@ -380,10 +416,12 @@ private:
     size_t _size_bytes{0};
 
     reclaim_options _reclaim_opts;
+    std::unique_ptr<admission_filter> _admission;
     ss::lowres_clock::time_point _last_reclaim;
     size_t _reclaim_size;
     background_reclaimer _background_reclaimer;
     resources::available_memory::deregister_holder _available_mem_deregister;
+    resources::available_memory::deregister_holder _usage_deregister;
 
     friend std::ostream& operator<<(std::ostream&, const reclaim_options&);
     friend std::ostream& operator<<(std::ostream&, const batch_cache&);
@@ -418,10 +456,18 @@ public:
 
     bool empty() const { return _index.empty(); }
 
-    void put(const model::record_batch& batch) {
+    /**
+     * Copies a batch into the cache. Batches read from disk are subject to
+     * the admission policy of the cache, see batch_cache::admit.
+     */
+    void put(
+      const model::record_batch& batch,
+      batch_cache::disk_read read = batch_cache::disk_read::no) {
         lock_guard lk(*this);
         auto offset = batch.header().base_offset;
-        if (likely(!_index.contains(offset))) {
+        if (
+          likely(!_index.contains(offset))
+          && (!read || _cache->admit(*this, offset))) {
             /*
              * do not allow initial cache entries to be dangling. if the index
              * is destroyed the cache will contain invalid index reference. once
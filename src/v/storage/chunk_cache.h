@@ -1,4 +1,5 @@
 #pragma once
+#include "resource_mgmt/available_memory.h"
 #include "resource_mgmt/memory_groups.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
@@ -30,6 +31,19 @@ public:
      */
     static constexpr const alignment alignment{4_KiB};
 
+    /**
+     * Chunks come in two sizes: append_chunk_size, the chunks handed out by
+     * get() which the cache pre-allocates, and append_large_chunk_size, the
+     * chunks of appenders sustaining a high append rate that get_large()
+     * hands out when memory permits. Larger chunks mean fewer and larger DMA
+     * writes for the same throughput. Large chunks may hold at most half of
+     * the cache memory so that they never starve the regular chunks.
+     */
+    size_t large_chunk_size() const {
+        const auto size = config::shard_local_cfg().append_large_chunk_size();
+        return size > _chunk_size ? size : 0;
+    }
+
     chunk_cache() noexcept
       : _size_target(memory_groups().chunk_cache_min_memory())
       , _size_limit(memory_groups().chunk_cache_max_memory())
@@ -42,6 +56,9 @@ public:
     ~chunk_cache() noexcept = default;
 
     ss::future<> start() {
+        _usage_deregister
+          = resources::available_memory::local().register_usage_reporter(
+            "append_chunks", [this] { return _size_total; });
         const auto num_chunks = memory_groups().chunk_cache_min_memory()
                                 / _chunk_size;
         return ss::do_for_each(
@@ -55,12 +72,20 @@ public:
     }
 
     void add(const chunk_ptr& chunk) {
-        if (_size_available >= _size_target) {
-            _size_total -= _chunk_size;
-            return;
+        const auto size = chunk->capacity();
+        const bool large = size != _chunk_size;
+        if (
+          _size_available >= _size_target
+          || (large && size != large_chunk_size())) {
+            // dropped, or of a large size which is no longer configured
+            _size_total -= size;
+            if (large) {
+                _size_large -= size;
+            }
+        } else {
+            (large ? _large_chunks : _chunks).push_back(chunk);
+            _size_available += size;
         }
-        _chunks.push_back(chunk);
-        _size_available += _chunk_size;
         if (_sem.waiters()) {
             _sem.signal();
         }
@@ -75,6 +100,33 @@ public:
           [this](ssx::semaphore_units) { return do_get(); });
     }
 
+    /**
+     * A large chunk, or nullptr if large chunks are disabled or would exceed
+     * their share of the cache memory. Never waits, the caller falls back to
+     * get().
+     */
+    chunk_ptr get_large() {
+        const auto size = large_chunk_size();
+        if (size == 0 || _sem.waiters()) {
+            return nullptr;
+        }
+        if (!_large_chunks.empty()) {
+            auto c = _large_chunks.front();
+            _large_chunks.pop_front();
+            _size_available -= size;
+            c->reset();
+            return c;
+        }
+        if (
+          _size_total + size > _size_limit
+          || _size_large + size > _size_limit / 2) {
+            return nullptr;
+        }
+        _size_total += size;
+        _size_large += size;
+        return ss::make_lw_shared<chunk>(size, alignment);
+    }
+
     size_t chunk_size() const { return _chunk_size; }
 
 private:
@@ -99,17 +151,29 @@ private:
             _size_total += _chunk_size;
             return c;
         }
+        // at the memory limit, a free large chunk serves as well
+        if (!_large_chunks.empty()) {
+            auto c = _large_chunks.front();
+            _large_chunks.pop_front();
+            _size_available -= c->capacity();
+            c->reset();
+            return c;
+        }
         return nullptr;
     }
 
     ss::chunked_fifo<chunk_ptr> _chunks;
+    ss::chunked_fifo<chunk_ptr> _large_chunks;
     ssx::semaphore _sem{0, "s/chunk-cache"};
     size_t _size_available{0};
     size_t _size_total{0};
+    // the part of _size_total in large chunks
+    size_t _size_large{0};
     const size_t _size_target;
     const size_t _size_limit;
 
     const size_t _chunk_size{0};
+    resources::available_memory::deregister_holder _usage_deregister;
 };
 
 inline chunk_cache& chunks() {
@@ -11,9 +11,11 @@
 
 #pragma once
 #include "bytes/bytes.h"
+#include "hashing/xx.h"
 #include "model/fundamental.h"
 #include "model/record_batch_types.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <ostream>
@@ -49,6 +51,13 @@ struct compacted_index {
     static constexpr const size_t max_entry_size = size_t(
       std::numeric_limits<uint16_t>::max());
 
+    // the batch type and control bit that enhance_key prepends to a key
+    static constexpr size_t key_prefix_size
+      = sizeof(std::underlying_type_t<model::record_batch_type>)
+        + sizeof(int8_t);
+    static constexpr size_t fingerprint_size = key_prefix_size
+                                               + 2 * sizeof(uint64_t);
+
     enum class entry_type : uint8_t {
         none, // error detection
         key,  // most common - just keys
@@ -65,6 +74,10 @@ struct compacted_index {
         self_compaction = 1U << 1U,
         /// index writer was forced to stop without writing all the entries.
         incomplete = 1U << 2U,
+        /// the index holds a single entry per key, in increasing key order,
+        /// see sorted_run_less. The sorted runs of adjacent segments are
+        /// merged in a single streaming pass.
+        sorted_run = 1U << 3U,
     };
     struct footer {
         // footer versions:
@@ -75,7 +88,10 @@ struct compacted_index {
         // 3 - add control bit to the key prefix so control batches cannot
         // compact
         //  data batches with same key
+        // 4 - same layout as 3, keys longer than a fingerprint may be stored
+        //  as their fingerprint (see fingerprint_key)
         static constexpr int8_t current_version = 3;
+        static constexpr int8_t fingerprint_version = 4;
 
         uint64_t size{0};
         uint64_t keys{0};
@@ -158,6 +174,47 @@ struct compacted_index {
 
 std::ostream& operator<<(std::ostream&, compacted_index::recovery_state);
 
+/// Order of the keys of a sorted run index: bytewise on the keys as stored,
+/// i.e. after fingerprinting
+inline bool
+sorted_run_less(const compaction_key& a, const compaction_key& b) noexcept {
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+
+inline bool should_fingerprint_key(const compaction_key& key) {
+    return key.size() > compacted_index::fingerprint_size;
+}
+
+/**
+ * The fingerprint of an enhanced key: the key's batch type and control bit
+ * prefix followed by two independently seeded 64-bit xxhash digests of the
+ * entire key.
+ *
+ * Fingerprints stand in for keys that are longer than a fingerprint both in
+ * the compaction index and in the compaction key-offset maps. Keeping the
+ * prefix means that keys of different batch types or of control batches
+ * never share a fingerprint. A wrongly deduplicated record requires a
+ * collision of both digests (128 bits), compared to the 64 bits of a single
+ * digest. A key and its own fingerprint never compare equal, so mixing
+ * indices with and without fingerprints only results in less deduplication.
+ */
+inline compaction_key fingerprint_key(const compaction_key& key) {
+    static constexpr uint64_t digest_seeds[] = {0, 0x9e3779b97f4a7c15};
+    auto fingerprint = ss::uninitialized_string<bytes>(
+      compacted_index::fingerprint_size);
+    auto out = std::copy_n(
+      key.begin(), compacted_index::key_prefix_size, fingerprint.begin());
+    for (auto seed : digest_seeds) {
+        incremental_xxhash64 h(seed);
+        // NOLINTNEXTLINE
+        h.update(reinterpret_cast<const char*>(key.data()), key.size());
+        auto digest_le = ss::cpu_to_le(h.digest());
+        out = std::copy_n(
+          reinterpret_cast<const char*>(&digest_le), sizeof(digest_le), out);
+    }
+    return compaction_key(std::move(fingerprint));
+}
+
 [[gnu::always_inline]] inline compacted_index::footer_flags
 operator|(compacted_index::footer_flags a, compacted_index::footer_flags b) {
     return compacted_index::footer_flags(
@@ -16,6 +16,7 @@
 #include "storage/compacted_index.h"
 #include "storage/compacted_index_reader.h"
 #include "storage/logger.h"
+#include "units.h"
 #include "utils/to_string.h"
 
 #include <seastar/core/file.hh>
@@ -159,7 +160,9 @@ compacted_index_chunk_reader::load_footer() {
         footer.version = footer_v1.version;
 
         data_size = file_size - compacted_index::footer_v1::footer_size;
-    } else if (footer_v1.version == compacted_index::footer::current_version) {
+    } else if (
+      footer_v1.version == compacted_index::footer::current_version
+      || footer_v1.version == compacted_index::footer::fingerprint_version) {
         iobuf_parser parser(std::move(buf));
         footer = reflection::adl<storage::compacted_index::footer>{}.from(
           parser);
@@ -198,7 +201,14 @@ compacted_index_chunk_reader::load_slice(model::timeout_clock::time_point t) {
           [this, t](compacted_index::footer) { return load_slice(t); });
     }
     if (!_cursor) {
-        _cursor = ss::make_file_input_stream(_handle, 0, _footer->size);
+        // read ahead so that consuming a slice, e.g. adding its keys to a
+        // compaction key-offset map, overlaps with reading the next one.
+        ss::file_input_stream_options options;
+        options.buffer_size = 32_KiB;
+        options.io_priority_class = _iopc;
+        options.read_ahead = 1;
+        _cursor = ss::make_file_input_stream(
+          _handle, 0, _footer->size, std::move(options));
     }
 
     return ss::do_with(ret_t{}, [this](ret_t& slice) {
@@ -137,6 +137,15 @@ public:
 
     void reset() { _impl->reset(); }
 
+    /// Pull based access to the entries, for the readers consumed in
+    /// lockstep like the sorted runs of a merge. Not to be mixed with
+    /// consume() or for_each_async() on the same reader.
+    bool is_end_of_stream() const { return _impl->is_end_of_stream(); }
+    ss::future<ss::circular_buffer<compacted_index::entry>>
+    load_slice(model::timeout_clock::time_point timeout) {
+        return _impl->load_slice(timeout);
+    }
+
     const ss::sstring filename() const { return _impl->filename(); }
     const segment_full_path& path() const { return _impl->path(); }
 
@@ -17,6 +17,7 @@
 #include "storage/index_state.h"
 #include "storage/logger.h"
 #include "storage/parser_utils.h"
+#include "storage/probe.h"
 #include "storage/segment_appender_utils.h"
 #include "storage/segment_utils.h"
 #include "vlog.h"
@@ -27,6 +28,7 @@
 #include <boost/range/irange.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <exception>
 
 namespace storage::internal {
@@ -88,6 +90,51 @@ roaring::Roaring compaction_key_reducer::end_of_stream() {
     return std::move(_inverted);
 }
 
+ss::future<ss::stop_iteration>
+sorted_run_reducer::operator()(compacted_index::entry&& e) {
+    using stop_t = ss::stop_iteration;
+    auto key = _fingerprint_keys && should_fingerprint_key(e.key)
+                 ? fingerprint_key(e.key)
+                 : std::move(e.key);
+    const auto o = e.offset + model::offset(e.delta);
+    if (auto it = _entries.find(key); it != _entries.end()) {
+        auto& v = it->second;
+        if (o > v.offset + model::offset(v.delta)) {
+            v = value_type{.offset = e.offset, .delta = e.delta};
+        }
+        return ss::make_ready_future<stop_t>(stop_t::no);
+    }
+    _keys_mem_usage += key.size();
+    _entries.emplace(
+      std::move(key), value_type{.offset = e.offset, .delta = e.delta});
+    if (mem_usage() > _max_mem) {
+        // no point in reading the rest of the index
+        _overflow = true;
+        _entries.clear();
+        _keys_mem_usage = 0;
+        return ss::make_ready_future<stop_t>(stop_t::yes);
+    }
+    return ss::make_ready_future<stop_t>(stop_t::no);
+}
+
+std::optional<sorted_run_reducer::entries_t>
+sorted_run_reducer::end_of_stream() {
+    if (_overflow) {
+        return std::nullopt;
+    }
+    entries_t entries;
+    while (!_entries.empty()) {
+        auto node = _entries.extract(_entries.begin());
+        entries.emplace_back(
+          compacted_index::entry_type::key,
+          std::move(node.key()),
+          node.mapped().offset,
+          node.mapped().delta);
+    }
+    _keys_mem_usage = 0;
+    return entries;
+}
+
 ss::future<ss::stop_iteration>
 index_copy_reducer::operator()(compacted_index::entry&& e) {
     using stop_t = ss::stop_iteration;
@@ -287,8 +334,16 @@ copy_data_segment_reducer::filter(model::record_batch batch) {
     co_return new_batch;
 }
 
+bool copy_data_segment_reducer::should_recompress(
+  model::compression original, const model::record_batch& b) {
+    return _target_compression.has_value() && *_target_compression != original
+           && !_internal_topic
+           && b.header().type == model::record_batch_type::raft_data
+           && !b.header().attrs.is_control();
+}
+
 ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
-  model::compression original, model::record_batch b) {
+  model::compression original, size_t original_size, model::record_batch b) {
     using stop_t = ss::stop_iteration;
     auto to_copy = co_await filter(std::move(b));
     if (to_copy == std::nullopt) {
@@ -308,26 +363,47 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
                 r.offset_delta());
           });
     }
-    auto batch = co_await compress_batch(original, std::move(to_copy.value()));
+    // the batch is still decompressed, its keys can be sketched
+    const auto keys = _idx.with_zone_maps ? key_sketch::of(to_copy.value())
+                                          : key_sketch{};
+    const bool recompress = should_recompress(original, to_copy.value());
+    const auto compress_start = std::chrono::steady_clock::now();
+    auto batch = co_await compress_batch(
+      recompress ? *_target_compression : original, std::move(to_copy.value()));
+    if (recompress && _probe) {
+        _probe->batch_recompressed(
+          original_size,
+          batch.size_bytes(),
+          std::chrono::steady_clock::now() - compress_start);
+    }
     auto const start_pos = _appender->file_byte_offset();
     auto const header_size = batch.header().size_bytes;
     _acc += header_size;
+    const bool user_data = _internal_topic
+                           || batch.header().type
+                                == model::record_batch_type::raft_data;
     // do not set broker_timestamp in this index, leave the operation to the
     // caller who has more context
-    if (_idx.maybe_index(
-          _acc,
-          32_KiB,
-          start_pos,
-          batch.base_offset(),
-          batch.last_offset(),
-          batch.header().first_timestamp,
-          batch.header().max_timestamp,
-          std::nullopt,
-          _internal_topic
-            || batch.header().type == model::record_batch_type::raft_data,
-          compactible_batch ? batch.header().record_count : 0)) {
+    const bool indexed = _idx.maybe_index(
+      _acc,
+      32_KiB,
+      start_pos,
+      batch.base_offset(),
+      batch.last_offset(),
+      batch.header().first_timestamp,
+      batch.header().max_timestamp,
+      std::nullopt,
+      user_data,
+      compactible_batch ? batch.header().record_count : 0);
+    if (indexed) {
         _acc = 0;
     }
+    _idx.track_zone(
+      indexed,
+      batch.header().first_timestamp,
+      batch.header().max_timestamp,
+      user_data,
+      keys);
     co_await _appender->append(batch);
     vassert(
       _appender->file_byte_offset() == start_pos + header_size,
@@ -341,12 +417,13 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
 ss::future<ss::stop_iteration>
 copy_data_segment_reducer::operator()(model::record_batch b) {
     const auto comp = b.header().attrs.compression();
+    const size_t size = b.size_bytes();
     if (!b.compressed()) {
-        co_return co_await filter_and_append(comp, std::move(b));
+        co_return co_await filter_and_append(comp, size, std::move(b));
     }
     auto batch = co_await decompress_batch(std::move(b));
 
-    co_return co_await filter_and_append(comp, std::move(batch));
+    co_return co_await filter_and_append(comp, size, std::move(batch));
 }
 
 ss::future<ss::stop_iteration>
@@ -74,6 +74,59 @@ private:
     bytes_hasher<uint64_t, xxhash_64> _hasher;
 };
 
+/// Collects the latest entry of every key of an index, in the order of a
+/// sorted run (see compacted_index::footer_flags::sorted_run), so that the
+/// clean index is written from memory instead of being filtered out of a
+/// second read of the index. Gives up once the entries take more than max_mem,
+/// the index is then compacted with compaction_key_reducer.
+class sorted_run_reducer : public compaction_reducer {
+public:
+    static constexpr const size_t default_max_memory_usage = 5_MiB;
+    struct value_type {
+        model::offset offset;
+        int32_t delta;
+    };
+    struct key_less {
+        bool operator()(
+          const compaction_key& a, const compaction_key& b) const noexcept {
+            return sorted_run_less(a, b);
+        }
+    };
+    using underlying_t = absl::btree_map<
+      compaction_key,
+      value_type,
+      key_less,
+      util::tracking_allocator<std::pair<const compaction_key, value_type>>>;
+    using entries_t = fragmented_vector<compacted_index::entry>;
+
+    /// \p fingerprint_keys must match the setting of the writer of the clean
+    /// index, which must not change the keys for them to stay ordered
+    explicit sorted_run_reducer(
+      bool fingerprint_keys, size_t max_mem = default_max_memory_usage)
+      : _max_mem(max_mem)
+      , _fingerprint_keys(fingerprint_keys)
+      , _memory_tracker(
+          ss::make_shared<util::mem_tracker>("sorted_run_reducer_index"))
+      , _entries{util::tracking_allocator<
+          std::pair<const compaction_key, value_type>>{_memory_tracker}} {}
+
+    ss::future<ss::stop_iteration> operator()(compacted_index::entry&&);
+    /// The entries ordered by key, nullopt if they didn't fit in memory
+    std::optional<entries_t> end_of_stream();
+
+private:
+    size_t mem_usage() const {
+        return _memory_tracker->consumption() + _keys_mem_usage;
+    }
+
+    size_t _max_mem;
+    bool _fingerprint_keys;
+    bool _overflow{false};
+    size_t _keys_mem_usage{0};
+    ss::shared_ptr<util::mem_tracker> _memory_tracker;
+    underlying_t _entries;
+};
+
 /// This class copies the input reader into the writer consulting the bitmap of
 /// wether ot keep the entry or not
 class index_filtered_copy_reducer : public compaction_reducer {
@@ -125,20 +178,26 @@ public:
       bool internal_topic,
       offset_delta_time apply_offset,
       model::offset segment_last_offset = model::offset{},
-      compacted_index_writer* cidx = nullptr)
+      compacted_index_writer* cidx = nullptr,
+      std::optional<model::compression> target_compression = std::nullopt,
+      probe* pb = nullptr)
       : _should_keep_fn(std::move(f))
       , _segment_last_offset(segment_last_offset)
       , _appender(a)
       , _compacted_idx(cidx)
       , _idx(index_state::make_empty_index(apply_offset))
-      , _internal_topic(internal_topic) {}
+      , _internal_topic(internal_topic)
+      , _target_compression(target_compression)
+      , _probe(pb) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch);
     storage::index_state end_of_stream() { return std::move(_idx); }
 
 private:
-    ss::future<ss::stop_iteration>
-      filter_and_append(model::compression, model::record_batch);
+    ss::future<ss::stop_iteration> filter_and_append(
+      model::compression, size_t original_size, model::record_batch);
+
+    bool should_recompress(model::compression, const model::record_batch&);
 
     ss::future<> maybe_keep_offset(
       const model::record_batch&, const model::record&, std::vector<int32_t>&);
@@ -161,6 +220,11 @@ private:
     /// We need to know if this is an internal topic to inform whether to
     /// index on non-raft-data batches
     bool _internal_topic;
+
+    /// If set, data batches are rewritten with this compression instead of
+    /// the one they were produced with.
+    std::optional<model::compression> _target_compression;
+    probe* _probe;
 };
 
 class index_rebuilder_reducer : public compaction_reducer {
@@ -590,9 +590,16 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
                             ? dynamic_cast<key_offset_map&>(*cfg.hash_key_map)
                             : dynamic_cast<key_offset_map&>(*simple_map);
     model::offset idx_start_offset;
+    key_overlap_tracker overlaps(segs);
     try {
         idx_start_offset = co_await build_offset_map(
-          cfg, segs, _stm_manager, _manager.resources(), *_probe, map);
+          cfg,
+          segs,
+          _stm_manager,
+          _manager.resources(),
+          *_probe,
+          map,
+          &overlaps);
     } catch (...) {
         auto eptr = std::current_exception();
         if (ssx::is_shutdown_exception(eptr)) {
@@ -637,6 +644,20 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
               seg->filename());
             continue;
         }
+        if (seg->finished_self_compaction() && !overlaps.may_overlap(*seg)) {
+            // The segment has no duplicate keys of its own and, according to
+            // the key summary left by a previous compaction, none of the keys
+            // of the newer segments in the window. Deduplicating it would not
+            // remove any record. Skip to avoid a needless rewrite.
+            seg->mark_as_finished_windowed_compaction();
+            vlog(
+              gclog.trace,
+              "[{}] treating segment as compacted, no key overlaps with "
+              "newer segments: {}",
+              config().ntp(),
+              seg->filename());
+            continue;
+        }
         if (!seg->may_have_compactible_records()) {
             // All data records are already compacted away. Skip to avoid a
             // needless rewrite.
@@ -1174,6 +1195,7 @@ ss::future<> disk_log_impl::housekeeping(housekeeping_config cfg) {
 ss::future<> disk_log_impl::do_compact(
   compaction_config compact_cfg,
   std::optional<model::offset> new_start_offset) {
+    compact_cfg.target_compression = config().recompression_type();
     if (!config::shard_local_cfg().log_compaction_use_sliding_window()) {
         co_return co_await adjacent_merge_compact(
           compact_cfg, new_start_offset);
@@ -1277,42 +1299,49 @@ ss::future<> disk_log_impl::retention_adjust_timestamps(
     auto retention_cfg = time_based_retention_cfg::make(
       _feature_table.local()); // this will retrieve cluster cfgs
 
-    fragmented_vector<segment_set::type> segs_all_bogus;
+    fragmented_vector<segment_set::type> segs_in_future;
     for (const auto& s : _segs) {
+        // We may drop out as soon as we see a segment with a valid
+        // timestamp: this is collectible by time_based_gc_max_offset
+        // without us making an adjustment, and if there are any later
+        // segments that require correction we will hit them after
+        // this earlier segment has  been collected.
+        if (s->index().retention_timestamp(retention_cfg) < ignore_threshold) {
+            break;
+        }
+        segs_in_future.emplace_back(s);
+    }
+
+    fragmented_vector<segment_set::type> segs_all_bogus;
+    // The index entries are needed to search for a valid timestamp, loading
+    // them incurs a scheduling point so the segments are collected first.
+    for (const auto& s : segs_in_future) {
         auto max_ts = s->index().retention_timestamp(retention_cfg);
 
         // If the actual max timestamp from user records is out of bounds, clamp
         // it to something more plausible, either from other batches or from
         // filesystem metadata if no batches with valid timestamps are
         // available.
-        if (max_ts >= ignore_threshold) {
-            auto alternate_batch_ts = s->index().find_highest_timestamp_before(
-              ignore_threshold);
-            if (alternate_batch_ts.has_value()) {
-                // Some batch in the segment has a timestamp within threshold,
-                // use that instead of the official max ts.
-                vlog(
-                  gclog.warn,
-                  "[{}] Timestamp in future detected, check client clocks.  "
-                  "Adjusting retention timestamp from {} to max valid record "
-                  "timestamp {} on {}",
-                  config().ntp(),
-                  max_ts,
-                  alternate_batch_ts.value(),
-                  s->path().string());
-                s->index().set_retention_timestamp(alternate_batch_ts.value());
-            } else {
-                // Collect segments with all bogus segments. We'll adjust them
-                // below.
-                segs_all_bogus.emplace_back(s);
-            }
+        co_await s->load_index();
+        auto alternate_batch_ts = s->index().find_highest_timestamp_before(
+          ignore_threshold);
+        if (alternate_batch_ts.has_value()) {
+            // Some batch in the segment has a timestamp within threshold,
+            // use that instead of the official max ts.
+            vlog(
+              gclog.warn,
+              "[{}] Timestamp in future detected, check client clocks.  "
+              "Adjusting retention timestamp from {} to max valid record "
+              "timestamp {} on {}",
+              config().ntp(),
+              max_ts,
+              alternate_batch_ts.value(),
+              s->path().string());
+            s->index().set_retention_timestamp(alternate_batch_ts.value());
         } else {
-            // We may drop out as soon as we see a segment with a valid
-            // timestamp: this is collectible by time_based_gc_max_offset
-            // without us making an adjustment, and if there are any later
-            // segments that require correction we will hit them after
-            // this earlier segment has  been collected.
-            break;
+            // Collect segments with all bogus segments. We'll adjust them
+            // below.
+            segs_all_bogus.emplace_back(s);
         }
     }
     // Doing this outside the main loop since it incurs a scheduling point, and
@@ -1369,6 +1398,30 @@ disk_log_impl::retention_offset(gc_config cfg) const {
     return std::max(max_offset_by_size, max_offset_by_time);
 }
 
+housekeeping_estimate
+disk_log_impl::estimate_housekeeping(gc_config cfg) const {
+    housekeeping_estimate estimate{
+      .compaction = config().is_compacted() && !_segs.empty(),
+      .size_bytes = _probe->partition_size(),
+    };
+    if (!_segs.empty()) {
+        estimate.oldest_timestamp = _segs.front()->index().retention_timestamp(
+          time_based_retention_cfg::make(_feature_table.local()));
+    }
+
+    if (_cloud_gc_offset.has_value()) {
+        estimate.gc_due = true;
+    } else if (config().is_collectable()) {
+        // timestamps in the future are corrected on the gc path only, which
+        // needs to load the segment indices: leave it to gc to decide
+        estimate.gc_due = config::shard_local_cfg()
+                            .storage_ignore_timestamps_in_future_sec()
+                            .has_value()
+                          || retention_offset(apply_overrides(cfg)).has_value();
+    }
+    return estimate;
+}
+
 ss::future<> disk_log_impl::remove_empty_segments() {
     return ss::do_until(
       [this] { return _segs.empty() || !_segs.back()->empty(); },
@@ -1501,6 +1554,9 @@ ss::future<> disk_log_impl::new_segment(
                 if (config().is_compacted()) {
                     h->mark_as_compacted_segment();
                 }
+                if (_upload_buffering) {
+                    h->enable_upload_buffer();
+                }
                 _segs.add(std::move(h));
                 _probe->segment_created();
                 _stm_manager->make_snapshot_in_background();
@@ -1622,6 +1678,24 @@ ss::future<> disk_log_impl::force_roll(ss::io_priority_class iopc) {
       });
 }
 
+void disk_log_impl::set_upload_buffering(bool enabled) {
+    if (_upload_buffering == enabled) {
+        return;
+    }
+    _upload_buffering = enabled;
+    if (enabled) {
+        // buffer the rest of the active segment, the segments before it are
+        // read from disk
+        if (!_segs.empty()) {
+            _segs.back()->enable_upload_buffer();
+        }
+        return;
+    }
+    for (auto& s : _segs) {
+        s->release_upload_buffer();
+    }
+}
+
 ss::future<> disk_log_impl::maybe_roll_unlocked(
   model::term_id t, model::offset next_offset, ss::io_priority_class iopc) {
     vassert(
@@ -1755,8 +1829,17 @@ disk_log_impl::make_reader(log_reader_config config) {
 ss::future<model::record_batch_reader>
 disk_log_impl::make_reader(timequery_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
-    return _lock_mngr.range_lock(config).then(
-      [this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
+    return _lock_mngr.range_lock(config)
+      .then([](std::unique_ptr<lock_manager::lease> lease) {
+          if (lease->range.empty()) {
+              return ss::make_ready_future<decltype(lease)>(
+                std::move(lease));
+          }
+          auto& segment = *lease->range.begin();
+          return segment->load_index().then(
+            [lease = std::move(lease)]() mutable { return std::move(lease); });
+      })
+      .then([this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
           auto start_offset = _start_offset;
           if (!lease->range.empty()) {
               const ss::lw_shared_ptr<segment>& segment = *lease->range.begin();
@@ -1851,6 +1934,10 @@ disk_log_impl::index_lower_bound(model::offset o) const {
         // input already lies on a boundary
         return o;
     }
+    if (!idx.is_loaded()) {
+        // the end of the previous segment is the closest known boundary
+        return model::prev_offset(idx.base_offset());
+    }
     if (auto entry = idx.find_nearest(o)) {
         return model::prev_offset(entry->offset);
     }
@@ -2073,6 +2160,7 @@ ss::future<> disk_log_impl::do_truncate(
     // offset
     model::offset start = last->offsets().base_offset;
 
+    co_await last->load_index();
     auto pidx = last->index().find_nearest(
       std::max(start, model::prev_offset(cfg.base_offset)));
     size_t initial_size = 0;
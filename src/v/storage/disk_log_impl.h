@@ -96,6 +96,7 @@ public:
       model::term_id, model::offset next_offset, ss::io_priority_class);
 
     ss::future<> force_roll(ss::io_priority_class) override;
+    void set_upload_buffering(bool) override;
 
     probe& get_probe() override { return *_probe; }
     model::term_id term() const;
@@ -143,6 +144,7 @@ public:
     size_t reclaimable_local_size_bytes() const override;
 
     std::optional<model::offset> retention_offset(gc_config) const final;
+    housekeeping_estimate estimate_housekeeping(gc_config) const final;
 
     // Collects an iterable list of segments over which to perform sliding
     // window compaction.
@@ -314,6 +316,7 @@ private:
     mutex _segments_rolling_lock;
 
     std::optional<model::offset> _cloud_gc_offset;
+    bool _upload_buffering{false};
     std::optional<model::offset> _last_compaction_window_start_offset;
     size_t _reclaimable_local_size_bytes{0};
 };
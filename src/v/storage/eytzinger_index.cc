@@ -0,0 +1,49 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/eytzinger_index.h"
+
+#include "vassert.h"
+
+namespace storage {
+
+void eytzinger_index::build(const fragmented_vector<uint32_t>& keys) {
+    vassert(
+      keys.size() <= max_entries,
+      "eytzinger index over {} entries exceeds the limit of {}",
+      keys.size(),
+      max_entries);
+    _size = keys.size();
+    _keys.resize(_size + 1);
+    _ranks.resize(_size + 1);
+    fill(keys, 0, 1);
+}
+
+void eytzinger_index::clear() {
+    _size = 0;
+    _keys = {};
+    _ranks = {};
+}
+
+size_t eytzinger_index::fill(
+  const fragmented_vector<uint32_t>& keys, size_t i, size_t k) {
+    // an in-order walk of the implicit tree visits the keys in sorted order
+    if (k <= _size) {
+        i = fill(keys, i, 2 * k);
+        _keys[k] = keys[i];
+        _ranks[k] = i;
+        ++i;
+        i = fill(keys, i, 2 * k + 1);
+    }
+    return i;
+}
+
+} // namespace storage
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "utils/fragmented_vector.h"
+
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace storage {
+
+/**
+ * A read optimized copy of the sorted relative offsets of a segment index.
+ *
+ * The keys are stored in Eytzinger (breadth first binary tree) order, so the
+ * first levels of every search share the same few cache lines and the search
+ * loop compiles to a branch free sequence of loads and shifts. A binary
+ * search over the index_state fragmented vectors instead touches a different
+ * fragment and cache line on almost every step.
+ *
+ * The layout covers a prefix of the index only. Entries appended after it
+ * was built are not visible to find(), callers search them separately and
+ * rebuild the layout once the uncovered tail grows large enough.
+ */
+class eytzinger_index {
+public:
+    // below this size a binary search over the index is already cache
+    // resident and building the layout does not pay off.
+    static constexpr size_t min_entries = 64;
+    // keeps each of the two arrays below a 64KiB allocation, enough for a
+    // 512MiB segment at the default index step.
+    static constexpr size_t max_entries = 16384;
+
+    /// Build the layout over all of \p keys, which must be sorted.
+    void build(const fragmented_vector<uint32_t>& keys);
+
+    /// Drop the layout if it covers entries beyond the first \p size.
+    void truncate(size_t size) {
+        if (size < _size) {
+            clear();
+        }
+    }
+
+    void clear();
+
+    /// Number of leading index entries covered by the layout.
+    size_t size() const { return _size; }
+
+    /**
+     * Return the position, in index order, of the last covered key that is
+     * less than or equal to \p needle.
+     */
+    std::optional<size_t> find(uint32_t needle) const {
+        // descend the implicit tree. the final path encodes the upper bound
+        // as the node at which the walk last went left.
+        size_t k = 1;
+        while (k <= _size) {
+            k = 2 * k + static_cast<size_t>(_keys[k] <= needle);
+        }
+        k >>= std::countr_one(k) + 1;
+        // k == 0 when every key is less than or equal to the needle
+        const size_t upper = k == 0 ? _size : _ranks[k];
+        if (upper == 0) {
+            return std::nullopt;
+        }
+        return upper - 1;
+    }
+
+private:
+    size_t fill(const fragmented_vector<uint32_t>& keys, size_t i, size_t k);
+
+    size_t _size{0};
+    // 1-based, slot 0 is unused
+    std::vector<uint32_t> _keys;
+    // position in index order of the key stored at the same slot
+    std::vector<uint32_t> _ranks;
+};
+
+} // namespace storage
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/flush_coordinator.h"
+
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+
+namespace storage {
+
+flush_coordinator::flush_coordinator(
+  config::binding<std::chrono::milliseconds> window)
+  : _window(std::move(window)) {
+    _timer.set_callback([this] { dispatch(); });
+    _window.watch([this] {
+        // don't hold queued requests for longer than the new window
+        if (_window() == std::chrono::milliseconds{0} && _timer.cancel()) {
+            dispatch();
+        }
+    });
+}
+
+ss::future<> flush_coordinator::flush(const void* owner, ss::file file) {
+    _probe.flush_requested();
+    if (_window() == std::chrono::milliseconds{0} || _gate.is_closed()) {
+        _probe.flush_dispatched();
+        return file.flush();
+    }
+
+    auto it = _pending.try_emplace(owner, std::move(file)).first;
+    auto& waiter = it->second.waiters.emplace_back();
+    if (!_timer.armed()) {
+        _timer.arm(_window());
+    }
+    return waiter.get_future();
+}
+
+void flush_coordinator::dispatch() {
+    auto pending = std::exchange(_pending, {});
+    for (auto& [_, p] : pending) {
+        _probe.flush_dispatched();
+        ssx::spawn_with_gate(_gate, [p = std::move(p)]() mutable {
+            return p.file.flush().then_wrapped(
+              [waiters = std::move(p.waiters)](ss::future<> f) mutable {
+                  if (f.failed()) {
+                      auto e = f.get_exception();
+                      for (auto& w : waiters) {
+                          w.set_exception(e);
+                      }
+                      return;
+                  }
+                  for (auto& w : waiters) {
+                      w.set_value();
+                  }
+              });
+        });
+    }
+}
+
+ss::future<> flush_coordinator::stop() {
+    _timer.cancel();
+    dispatch();
+    co_await _gate.close();
+    _probe.clear_metrics();
+}
+
+} // namespace storage
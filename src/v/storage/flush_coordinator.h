@@ -0,0 +1,84 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "seastarx.h"
+#include "storage/probe.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+#include <vector>
+
+namespace storage {
+
+/**
+ * Shard-wide coordinator of segment file flushes.
+ *
+ * With a non-zero coalescing window, flush requests are queued for up to the
+ * window and then dispatched together. Requests from the same appender that
+ * arrive within one window are served by a single physical flush, and the
+ * flushes of different segments reach the device together which lets the
+ * filesystem share journal commits between them. All the waiters of a
+ * dispatched batch are completed when their file's flush completes.
+ *
+ * With a zero window every request is passed straight through to the file.
+ */
+class flush_coordinator {
+public:
+    explicit flush_coordinator(config::binding<std::chrono::milliseconds>);
+
+    flush_coordinator(const flush_coordinator&) = delete;
+    flush_coordinator& operator=(const flush_coordinator&) = delete;
+    flush_coordinator(flush_coordinator&&) = delete;
+    flush_coordinator& operator=(flush_coordinator&&) = delete;
+    ~flush_coordinator() noexcept = default;
+
+    /**
+     * Flush \p file on behalf of \p owner. Requests with the same owner are
+     * coalesced, so the owner must only request a flush after the writes
+     * it needs to be durable have completed.
+     */
+    ss::future<> flush(const void* owner, ss::file file);
+
+    /**
+     * Dispatch the queued flushes and wait for all of them to complete.
+     */
+    ss::future<> stop();
+
+    flush_coordinator_probe& probe() { return _probe; }
+
+private:
+    struct pending_flush {
+        explicit pending_flush(ss::file f)
+          : file(std::move(f)) {}
+
+        ss::file file;
+        std::vector<ss::promise<>> waiters;
+    };
+
+    void dispatch();
+
+    config::binding<std::chrono::milliseconds> _window;
+    absl::flat_hash_map<const void*, pending_flush> _pending;
+    ss::timer<> _timer;
+    ss::gate _gate;
+    flush_coordinator_probe _probe;
+};
+
+} // namespace storage
@@ -24,6 +24,7 @@ class log;
 class log_manager;
 class probe;
 class offset_translator_state;
+class read_ahead_budget;
 class readers_cache;
 class segment;
 class segment_appender;
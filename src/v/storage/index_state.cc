@@ -10,8 +10,11 @@
 #include "storage/index_state.h"
 
 #include "bytes/iobuf_parser.h"
+#include "config/configuration.h"
 #include "hashing/crc32c.h"
+#include "hashing/xx.h"
 #include "likely.h"
+#include "model/record.h"
 #include "model/timestamp.h"
 #include "reflection/adl.h"
 #include "serde/serde.h"
@@ -24,13 +27,58 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <limits>
 #include <optional>
 
 namespace storage {
 
+uint64_t key_sketch::hash(const iobuf& key) {
+    incremental_xxhash64 h;
+    for (const auto& frag : key) {
+        h.update(frag.get(), frag.size());
+    }
+    return h.digest();
+}
+
+key_sketch key_sketch::of(const model::record_batch& batch) {
+    if (batch.compressed()) {
+        return saturated();
+    }
+    key_sketch s;
+    if (
+      batch.header().type != model::record_batch_type::raft_data
+      || batch.header().attrs.is_control()) {
+        return s;
+    }
+    batch.for_each_record(
+      [&s](const model::record& r) { s.add(hash(r.key())); });
+    return s;
+}
+
+// double hashing, the bits of a key are h1 + i * h2
+void key_sketch::add(uint64_t key_hash) {
+    const uint64_t h2 = (key_hash >> 32) | 1;
+    for (size_t i = 0; i < hashes; ++i) {
+        const auto bit = (key_hash + i * h2) % (words * 64);
+        bits[bit / 64] |= uint64_t{1} << (bit % 64);
+    }
+}
+
+bool key_sketch::may_contain(uint64_t key_hash) const {
+    const uint64_t h2 = (key_hash >> 32) | 1;
+    for (size_t i = 0; i < hashes; ++i) {
+        const auto bit = (key_hash + i * h2) % (words * 64);
+        if ((bits[bit / 64] & (uint64_t{1} << (bit % 64))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 index_state index_state::make_empty_index(offset_delta_time with_offset) {
     index_state idx{};
     idx.with_offset = with_offset;
+    idx.with_zone_maps = config::shard_local_cfg().storage_index_zone_maps();
 
     return idx;
 }
@@ -117,6 +165,69 @@ bool index_state::maybe_index(
     return retval;
 }
 
+void index_state::track_zone(
+  bool new_entry,
+  model::timestamp first_timestamp,
+  model::timestamp last_timestamp,
+  bool user_data,
+  const key_sketch& keys) {
+    if (!with_zone_maps) {
+        return;
+    }
+    if (new_entry) {
+        // no user data yet, the zone matches no timestamp
+        zone_min_time_index.push_back(
+          std::numeric_limits<model::timestamp::type>::max());
+        zone_max_time_index.push_back(
+          std::numeric_limits<model::timestamp::type>::min());
+        for (size_t i = 0; i < key_sketch::words; ++i) {
+            zone_key_sketch_index.push_back(0);
+        }
+    }
+    if (!has_zone_maps()) {
+        // the zones can't be trusted anymore, e.g. the index was created
+        // without them, stop maintaining them.
+        with_zone_maps = false;
+        zone_min_time_index = {};
+        zone_max_time_index = {};
+        zone_key_sketch_index = {};
+        return;
+    }
+    const auto zone = size() - 1;
+    if (user_data) {
+        zone_min_time_index[zone] = std::min(
+          zone_min_time_index[zone], first_timestamp());
+        zone_max_time_index[zone] = std::max(
+          {zone_max_time_index[zone], first_timestamp(), last_timestamp()});
+    }
+    for (size_t i = 0; i < key_sketch::words; ++i) {
+        zone_key_sketch_index[zone * key_sketch::words + i] |= keys.bits[i];
+    }
+}
+
+std::optional<size_t> index_state::find_zone(model::timestamp ts) const {
+    for (size_t i = 0; i < zone_max_time_index.size(); ++i) {
+        if (zone_max_time_index[i] >= ts()) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<size_t>
+index_state::find_zone(size_t from, uint64_t key_hash) const {
+    key_sketch s;
+    for (size_t i = from; i < size(); ++i) {
+        for (size_t w = 0; w < key_sketch::words; ++w) {
+            s.bits[w] = zone_key_sketch_index[i * key_sketch::words + w];
+        }
+        if (s.may_contain(key_hash)) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
 std::ostream& operator<<(std::ostream& o, const index_state& s) {
     return o << "{header_bitflags:" << s.bitflags
              << ", base_offset:" << s.base_offset
@@ -129,7 +240,8 @@ std::ostream& operator<<(std::ostream& o, const index_state& s) {
              << ", non_data_timestamps:" << s.non_data_timestamps
              << ", broker_timestamp:" << s.broker_timestamp
              << ", num_compactible_records_appended:"
-             << s.num_compactible_records_appended << ", index("
+             << s.num_compactible_records_appended
+             << ", with_zone_maps:" << s.with_zone_maps << ", index("
              << s.relative_offset_index.size() << ","
              << s.relative_time_index.size() << "," << s.position_index.size()
              << ")}";
@@ -152,6 +264,10 @@ void index_state::serde_write(iobuf& out) const {
     write(tmp, non_data_timestamps);
     write(tmp, broker_timestamp);
     write(tmp, num_compactible_records_appended);
+    write(tmp, with_zone_maps);
+    write(tmp, zone_min_time_index.copy());
+    write(tmp, zone_max_time_index.copy());
+    write(tmp, zone_key_sketch_index.copy());
 
     crc::crc32c crc;
     crc_extend_iobuf(crc, tmp);
@@ -248,6 +364,14 @@ void read_nested(
     } else {
         st.num_compactible_records_appended = std::nullopt;
     }
+    if (hdr._version >= index_state::zone_maps_version) {
+        read_nested(p, st.with_zone_maps, 0U);
+        read_nested(p, st.zone_min_time_index, 0U);
+        read_nested(p, st.zone_max_time_index, 0U);
+        read_nested(p, st.zone_key_sketch_index, 0U);
+    } else {
+        st.with_zone_maps = false;
+    }
 }
 
 } // namespace storage
@@ -20,9 +20,14 @@
 
 #include <seastar/core/sharded.hh>
 
+#include <array>
 #include <cstdint>
 #include <optional>
 
+namespace model {
+class record_batch;
+} // namespace model
+
 namespace storage {
 
 using offset_delta_time = ss::bool_class<struct offset_delta_time_tag>;
@@ -73,6 +78,33 @@ private:
     friend struct index_state;
 };
 
+/*
+ * Bloom filter of the record keys of the batches covered by an index entry.
+ * The sketch of batches whose records can't be read cheaply, e.g. compressed
+ * batches on the append path, is saturated: it may contain any key.
+ */
+struct key_sketch {
+    // 512 bits, 3 bits per key
+    static constexpr size_t words = 8;
+    static constexpr size_t hashes = 3;
+
+    std::array<uint64_t, words> bits{};
+
+    static uint64_t hash(const iobuf& key);
+
+    /// The sketch of the keys of the user records of \p batch.
+    static key_sketch of(const model::record_batch& batch);
+
+    static key_sketch saturated() {
+        key_sketch s;
+        s.bits.fill(~uint64_t{0});
+        return s;
+    }
+
+    void add(uint64_t key_hash);
+    bool may_contain(uint64_t key_hash) const;
+};
+
 /* Fileformat:
    1 byte  - version
    4 bytes - size - does not include the version or size
@@ -89,12 +121,18 @@ private:
    1 byte  - batch_timestamps_are_monotonic
    1 byte  - with_offset
    1 byte  - non_data_timestamps
+   ...
+   1 byte  - with_zone_maps
+   [] zone_min_time_index
+   [] zone_max_time_index
+   [] zone_key_sketch_index
  */
 struct index_state
-  : serde::envelope<index_state, serde::version<7>, serde::compat_version<4>> {
+  : serde::envelope<index_state, serde::version<8>, serde::compat_version<4>> {
     static constexpr auto monotonic_timestamps_version = 5;
     static constexpr auto broker_timestamp_version = 6;
     static constexpr auto num_compactible_records_version = 7;
+    static constexpr auto zone_maps_version = 8;
 
     static index_state make_empty_index(offset_delta_time with_offset);
 
@@ -148,8 +186,24 @@ struct index_state
     // support this field, and we can't conclude anything.
     std::optional<size_t> num_compactible_records_appended{0};
 
+    // Optional zone maps, one per index entry, of the batches from the entry
+    // up to the next one: their lowest and highest user data timestamps and a
+    // key_sketch of their keys. Lookups use them to skip the entries that
+    // can't match. Fixed when the index is created, see storage_index_zone_maps
+    bool with_zone_maps{false};
+    fragmented_vector<model::timestamp::type> zone_min_time_index;
+    fragmented_vector<model::timestamp::type> zone_max_time_index;
+    // key_sketch::words per entry
+    fragmented_vector<uint64_t> zone_key_sketch_index;
+
     size_t size() const { return relative_offset_index.size(); }
 
+    bool has_zone_maps() const {
+        return with_zone_maps && zone_min_time_index.size() == size()
+               && zone_max_time_index.size() == size()
+               && zone_key_sketch_index.size() == size() * key_sketch::words;
+    }
+
     bool empty() const { return relative_offset_index.empty(); }
 
     void add_entry(
@@ -159,6 +213,13 @@ struct index_state
         position_index.push_back(pos);
     }
     void pop_back() {
+        if (has_zone_maps()) {
+            zone_min_time_index.pop_back();
+            zone_max_time_index.pop_back();
+            for (size_t i = 0; i < key_sketch::words; ++i) {
+                zone_key_sketch_index.pop_back();
+            }
+        }
         relative_offset_index.pop_back();
         relative_time_index.pop_back();
         position_index.pop_back();
@@ -178,6 +239,9 @@ struct index_state
         relative_offset_index.shrink_to_fit();
         relative_time_index.shrink_to_fit();
         position_index.shrink_to_fit();
+        zone_min_time_index.shrink_to_fit();
+        zone_max_time_index.shrink_to_fit();
+        zone_key_sketch_index.shrink_to_fit();
     }
 
     std::optional<std::tuple<uint32_t, offset_time_index, uint64_t>>
@@ -218,6 +282,24 @@ struct index_state
       bool user_data,
       size_t compactible_records);
 
+    /// Adds a batch to the zone map of the last entry, \p new_entry if
+    /// maybe_index() just added that entry for the batch.
+    void track_zone(
+      bool new_entry,
+      model::timestamp first_timestamp,
+      model::timestamp last_timestamp,
+      bool user_data,
+      const key_sketch& keys);
+
+    /// The first entry whose batches may have a timestamp >= \p ts, nullopt
+    /// if there is none. Requires has_zone_maps().
+    std::optional<size_t> find_zone(model::timestamp ts) const;
+
+    /// The first entry from \p from whose batches may contain a record with
+    /// the key hash \p key_hash, nullopt if there is none. Requires
+    /// has_zone_maps().
+    std::optional<size_t> find_zone(size_t from, uint64_t key_hash) const;
+
     void update_batch_timestamps_are_monotonic(bool pred) {
         batch_timestamps_are_monotonic = batch_timestamps_are_monotonic && pred;
     }
@@ -243,7 +325,11 @@ private:
       , with_offset(o.with_offset)
       , non_data_timestamps(o.non_data_timestamps)
       , broker_timestamp(o.broker_timestamp)
-      , num_compactible_records_appended(o.num_compactible_records_appended) {}
+      , num_compactible_records_appended(o.num_compactible_records_appended)
+      , with_zone_maps(o.with_zone_maps)
+      , zone_min_time_index(o.zone_min_time_index.copy())
+      , zone_max_time_index(o.zone_max_time_index.copy())
+      , zone_key_sketch_index(o.zone_key_sketch_index.copy()) {}
 };
 
 } // namespace storage
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/key_set_summary.h"
+
+#include "hashing/xx.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace storage {
+
+key_set_summary::key_set_summary(size_t expected_keys) {
+    // a power of two number of bits
+    const size_t bits = std::bit_ceil(std::clamp<size_t>(
+      expected_keys * bits_per_key, min_bytes * 8, max_bytes * 8));
+    _bit_mask = bits - 1;
+    _words.resize(bits / 64);
+}
+
+uint64_t key_set_summary::hash(const compaction_key& key) {
+    if (should_fingerprint_key(key)) {
+        auto fingerprint = fingerprint_key(key);
+        return xxhash_64(fingerprint.data(), fingerprint.size());
+    }
+    return xxhash_64(key.data(), key.size());
+}
+
+void key_set_summary::add(uint64_t hash) {
+    for_each_bit(hash, [this](size_t word, uint64_t mask) {
+        _words[word] |= mask;
+        return true;
+    });
+}
+
+bool key_set_summary::may_contain(uint64_t hash) const {
+    bool found = true;
+    for_each_bit(hash, [this, &found](size_t word, uint64_t mask) {
+        found = (_words[word] & mask) != 0;
+        return found;
+    });
+    return found;
+}
+
+} // namespace storage
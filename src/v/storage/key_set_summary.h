@@ -0,0 +1,71 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "storage/compacted_index.h"
+#include "units.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace storage {
+
+/**
+ * A Bloom filter over the compaction keys of a segment.
+ *
+ * Sliding window compaction uses the summary of an older segment to find out
+ * whether any key of the newer segments in the window may also be in it.
+ * When none is, deduplicating the segment would not remove any record and
+ * its rewrite is skipped.
+ *
+ * Keys are expected in the form they take in the compaction index. Keys long
+ * enough to be fingerprinted are summarized by their fingerprint so that
+ * indices written with and without fingerprints agree.
+ */
+class key_set_summary {
+public:
+    static constexpr size_t bits_per_key = 8;
+    static constexpr size_t num_probes = 5;
+    // keeps the false positive rate of small segments negligible
+    static constexpr size_t min_bytes = 512;
+    static constexpr size_t max_bytes = 128_KiB;
+
+    /// Create an empty summary sized for \p expected_keys keys.
+    explicit key_set_summary(size_t expected_keys);
+
+    static uint64_t hash(const compaction_key&);
+
+    void add(uint64_t hash);
+    bool may_contain(uint64_t hash) const;
+
+    size_t memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+private:
+    template<typename Func>
+    void for_each_bit(uint64_t hash, Func f) const {
+        // double hashing, see Kirsch and Mitzenmacher, "Less Hashing, Same
+        // Performance: Building a Better Bloom Filter".
+        const uint64_t h1 = hash;
+        const uint64_t h2 = (hash >> 32U) | 1U;
+        for (size_t i = 0; i < num_probes; ++i) {
+            const uint64_t bit = (h1 + i * h2) & _bit_mask;
+            if (!f(bit / 64, uint64_t(1) << (bit % 64))) {
+                return;
+            }
+        }
+    }
+
+    uint64_t _bit_mask;
+    std::vector<uint64_t> _words;
+};
+
+} // namespace storage
@@ -270,70 +270,72 @@ ss::future<> kvstore::flush_and_apply_ops() {
       });
 }
 
+ss::future<> kvstore::open_segment() {
+    _segment = co_await make_segment(
+      _ntpc,
+      model::offset(_next_offset),
+      model::term_id(0),
+      ss::default_priority_class(),
+      record_version_type::v1,
+      config::shard_local_cfg().storage_read_buffer_size(),
+      config::shard_local_cfg().storage_read_readahead_count(),
+      std::nullopt,
+      _resources,
+      _feature_table,
+      _ntp_sanitizer_config);
+}
+
 ss::future<> kvstore::roll() {
     if (!_segment) {
-        return make_segment(
-                 _ntpc,
-                 model::offset(_next_offset),
-                 model::term_id(0),
-                 ss::default_priority_class(),
-                 record_version_type::v1,
-                 config::shard_local_cfg().storage_read_buffer_size(),
-                 config::shard_local_cfg().storage_read_readahead_count(),
-                 std::nullopt,
-                 _resources,
-                 _feature_table,
-                 _ntp_sanitizer_config)
-          .then([this](ss::lw_shared_ptr<segment> seg) {
-              _segment = std::move(seg);
-          });
+        co_return co_await open_segment();
     }
 
-    if (_segment->appender().file_byte_offset() > _conf.max_segment_size) {
-        _probe.roll_segment();
+    const auto segment_size = _segment->appender().file_byte_offset();
+    if (segment_size <= _conf.max_segment_size) {
+        co_return;
+    }
 
-        vlog(
-          lg.debug,
-          "Rolling segment with base offset {} size {}",
-          _segment->offsets().base_offset,
-          _segment->appender().file_byte_offset());
-        // _segment being set is a signal to stop() to flush and close the
-        // segment. we clear _segment here before closing and finishing the roll
-        // process so that if an issue occurs and the flush fiber terminates
-        // that stop() doesn't try to flush and close a closed and partially
-        // cleaned-up segment.
-        auto seg = std::exchange(_segment, nullptr);
-        return seg->close()
-          .then([this] { return save_snapshot(); })
-          .then([seg] {
-              vlog(
-                lg.debug,
-                "Removing old segment with base offset {}",
-                seg->offsets().base_offset);
-              return ss::remove_file(seg->reader().path().string()).then([seg] {
-                  return ss::remove_file(seg->index().path().string());
-              });
-          })
-          .then([this] {
-              return make_segment(
-                       _ntpc,
-                       model::offset(_next_offset),
-                       model::term_id(0),
-                       ss::default_priority_class(),
-                       record_version_type::v1,
-                       config::shard_local_cfg().storage_read_buffer_size(),
-                       config::shard_local_cfg().storage_read_readahead_count(),
-                       std::nullopt,
-                       _resources,
-                       _feature_table,
-                       _ntp_sanitizer_config)
-                .then([this](ss::lw_shared_ptr<segment> seg) {
-                    _segment = std::move(seg);
-                });
-          });
+    _probe.roll_segment();
+    vlog(
+      lg.debug,
+      "Rolling segment with base offset {} size {}",
+      _segment->offsets().base_offset,
+      segment_size);
+    // _segment being set is a signal to stop() to flush and close the
+    // segment. we clear _segment here before closing and finishing the roll
+    // process so that if an issue occurs and the flush fiber terminates
+    // that stop() doesn't try to flush and close a closed and partially
+    // cleaned-up segment.
+    auto seg = std::exchange(_segment, nullptr);
+    co_await seg->close();
+    _closed_segments.push_back(closed_segment{
+      .base_offset = seg->offsets().base_offset,
+      .data_path = seg->reader().path().string(),
+      .index_path = seg->index().path().string()});
+    _closed_segments_bytes += segment_size;
+
+    // a snapshot rewrites the whole database, so it is only taken once the
+    // closed segments are at least as large as the database. this bounds the
+    // write amplification of a large database to about 2x, and the log that
+    // recovery replays on top of the snapshot to about the database size.
+    if (_closed_segments_bytes >= snapshot_threshold()) {
+        co_await save_snapshot();
+        for (auto& closed : std::exchange(_closed_segments, {})) {
+            vlog(
+              lg.debug,
+              "Removing old segment with base offset {}",
+              closed.base_offset);
+            co_await ss::remove_file(closed.data_path);
+            co_await ss::remove_file(closed.index_path);
+        }
+        _closed_segments_bytes = 0;
     }
 
-    return ss::now();
+    co_await open_segment();
+}
+
+size_t kvstore::snapshot_threshold() const {
+    return std::max(_conf.max_segment_size, _probe.cached_bytes);
 }
 
 ss::future<> kvstore::save_snapshot() {
@@ -657,6 +659,7 @@ ss::future<usage_report> kvstore::disk_usage() const {
     if (_segment) {
         report.usage = co_await _segment->persistent_size();
     }
+    report.usage.data += _closed_segments_bytes;
     report.usage.data += (co_await _snap.size()).value_or(0);
 
     // kvstore doesn't have on-demand reclaimable data (yet) so the default
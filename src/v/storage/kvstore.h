@@ -154,8 +154,8 @@ private:
     /*
      * database operations are cached in `ops` and periodically flushed to the
      * current `segment` at position `next_offset` and then applied to `db`.
-     * when the segment reaches a threshold size a snapshot is saved a new
-     * segment is created.
+     * when the segment reaches a threshold size a new segment is created, and
+     * a snapshot is saved once the rolled segments outgrow the database.
      */
     std::vector<op> _ops;
     ss::timer<> _timer;
@@ -171,8 +171,22 @@ private:
     void apply_op(
       bytes key, std::optional<iobuf> value, ssx::semaphore_units const&);
     ss::future<> flush_and_apply_ops();
+    ss::future<> open_segment();
     ss::future<> roll();
     ss::future<> save_snapshot();
+    size_t snapshot_threshold() const;
+
+    /*
+     * Segments rolled since the last snapshot. They are replayed on top of
+     * the snapshot by recovery, and removed once a snapshot covers them.
+     */
+    struct closed_segment {
+        model::offset base_offset;
+        ss::sstring data_path;
+        ss::sstring index_path;
+    };
+    std::vector<closed_segment> _closed_segments;
+    size_t _closed_segments_bytes{0};
 
     /*
      * Recovery
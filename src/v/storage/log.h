@@ -142,6 +142,13 @@ public:
     // roll immediately with the current term.
     virtual ss::future<> force_roll(ss::io_priority_class) = 0;
 
+    /*
+     * keep a copy of the data appended to the log in memory, for the tiered
+     * storage uploads of its segments (see segment::enable_upload_buffer).
+     * disabling it releases the copies.
+     */
+    virtual void set_upload_buffering(bool) = 0;
+
     virtual probe& get_probe() = 0;
 
     /*
@@ -153,6 +160,11 @@ public:
      * Returns new log start offset for given retention settings.
      */
     virtual std::optional<model::offset> retention_offset(gc_config) const = 0;
+    /**
+     * Returns the housekeeping work pending for the given retention settings,
+     * estimated without I/O.
+     */
+    virtual housekeeping_estimate estimate_housekeeping(gc_config) const = 0;
 
 private:
     ntp_config _config;
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/log_directories.h"
+
+#include "storage/logger.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace storage {
+
+log_directories::log_directories(
+  ss::sstring base_dir, const std::vector<ss::sstring>& extra_dirs) {
+    _dirs.reserve(extra_dirs.size() + 1);
+    _dirs.push_back(directory{.path = std::move(base_dir)});
+    for (const auto& dir : extra_dirs) {
+        if (find(dir) == nullptr) {
+            _dirs.push_back(directory{.path = dir});
+        }
+    }
+}
+
+log_directories::directory* log_directories::find(const ss::sstring& path) {
+    auto it = std::find_if(
+      _dirs.begin(), _dirs.end(), [&path](const directory& d) {
+          return d.path == path;
+      });
+    return it == _dirs.end() ? nullptr : &*it;
+}
+
+ss::future<> log_directories::refresh() {
+    for (auto& d : _dirs) {
+        try {
+            auto space = co_await ss::file_system_space(d.path);
+            d.total = space.capacity;
+            d.free = space.available;
+        } catch (...) {
+            // not a placement target until the directory is readable again
+            vlog(
+              stlog.warn,
+              "Unable to read the disk space of {}: {}",
+              d.path,
+              std::current_exception());
+            d.free = 0;
+        }
+    }
+}
+
+ss::future<ss::sstring> log_directories::place(const ntp_config& cfg) {
+    for (auto& d : _dirs) {
+        auto partition_dir = fmt::format(
+          "{}/{}_{}", d.path, cfg.ntp().path(), cfg.get_revision());
+        if (co_await ss::file_exists(partition_dir)) {
+            ++d.partitions;
+            co_return d.path;
+        }
+    }
+
+    co_await refresh();
+    auto score = [](const directory& d) {
+        return static_cast<double>(d.free)
+               / static_cast<double>(d.partitions + 1);
+    };
+    auto& best = *std::max_element(
+      _dirs.begin(),
+      _dirs.end(),
+      [&score](const directory& a, const directory& b) {
+          return score(a) < score(b);
+      });
+    vlog(
+      stlog.debug,
+      "Placing {} in {} (free: {}, partitions: {})",
+      cfg.ntp(),
+      best.path,
+      best.free,
+      best.partitions);
+    ++best.partitions;
+    co_return best.path;
+}
+
+void log_directories::add_partition(const ss::sstring& dir) {
+    if (auto* d = find(dir); d != nullptr) {
+        ++d->partitions;
+    }
+}
+
+void log_directories::remove_partition(const ss::sstring& dir) {
+    if (auto* d = find(dir); d != nullptr && d->partitions > 0) {
+        --d->partitions;
+    }
+}
+
+} // namespace storage
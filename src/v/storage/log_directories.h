@@ -0,0 +1,77 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "storage/ntp_config.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+
+#include <cstdint>
+#include <vector>
+
+namespace storage {
+
+/**
+ * The data directories the partitions of a shard are placed in.
+ *
+ * The first directory is the base directory of the log_manager, which also
+ * keeps the node state. The others (node config extra_data_directories) are
+ * typically mount points of separate devices, so that a node with several
+ * disks doesn't need to stripe them into one device.
+ *
+ * A partition stays in the directory which holds its data. A new partition
+ * is placed in the directory with the most free space per partition placed
+ * in it by this shard: the partition count stands for the I/O load of the
+ * device, and every shard balances its own partitions across the devices.
+ */
+class log_directories {
+public:
+    struct directory {
+        ss::sstring path;
+        // disk space of the filesystem of the directory
+        uint64_t total{0};
+        uint64_t free{0};
+        // partitions of this shard in the directory
+        size_t partitions{0};
+    };
+
+    explicit log_directories(
+      ss::sstring base_dir, const std::vector<ss::sstring>& extra_dirs = {});
+
+    /// True if there is more than one directory to place partitions in.
+    bool multiple() const { return _dirs.size() > 1; }
+
+    const std::vector<directory>& get() const { return _dirs; }
+
+    /// Refresh the disk space of the directories.
+    ss::future<> refresh();
+
+    /**
+     * The directory of the partition of \p cfg: the directory holding its
+     * data if there is one, otherwise the best directory for a new
+     * partition. The partition is counted in the returned directory.
+     */
+    ss::future<ss::sstring> place(const ntp_config& cfg);
+
+    /// Count a partition in \p dir, a no-op if \p dir isn't a data directory.
+    void add_partition(const ss::sstring& dir);
+    void remove_partition(const ss::sstring& dir);
+
+private:
+    directory* find(const ss::sstring& path);
+
+    std::vector<directory> _dirs;
+};
+
+} // namespace storage
@@ -18,7 +18,6 @@ namespace storage {
 struct log_housekeeping_meta {
     enum class bitflags : uint32_t {
         none = 0,
-        compacted = 1U,
         lifetime_checked = 1U << 1U,
     };
     explicit log_housekeeping_meta(ss::shared_ptr<log> l) noexcept
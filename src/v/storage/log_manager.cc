@@ -29,6 +29,7 @@
 #include "storage/kvstore.h"
 #include "storage/log.h"
 #include "storage/logger.h"
+#include "storage/read_ahead.h"
 #include "storage/segment.h"
 #include "storage/segment_appender.h"
 #include "storage/segment_index.h"
@@ -60,10 +61,12 @@
 #include <boost/algorithm/string/predicate.hpp>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <filesystem>
 #include <optional>
+#include <vector>
 
 namespace storage {
 using logs_type = absl::flat_hash_map<model::ntp, log_housekeeping_meta>;
@@ -142,7 +145,8 @@ log_manager::log_manager(
   , _feature_table(feature_table)
   , _jitter(_config.compaction_interval())
   , _trigger_gc_jitter(0s, 5s)
-  , _batch_cache(config.reclaim_opts) {
+  , _batch_cache(config.reclaim_opts)
+  , _directories(_config.base_dir, _config.extra_dirs) {
     _config.compaction_interval.watch([this]() {
         _jitter = simple_time_jitter<ss::lowres_clock>{
           _config.compaction_interval()};
@@ -170,6 +174,15 @@ ss::future<> log_manager::clean_close(ss::shared_ptr<storage::log> log) {
 }
 
 ss::future<> log_manager::start() {
+    _recovery_probe.setup_metrics(_resources);
+    _read_ahead_probe.setup_metrics(internal::shard_read_ahead_budget());
+    _dma_write_probe.setup_metrics(_resources);
+    // kept next to the partition directories, the pooled files are moved
+    // into them by rename
+    co_await _resources.get_segment_file_pool().start(
+      std::filesystem::path(_config.base_dir) / ".segment_pool"
+        / fmt::format("{}", ss::this_shard_id()),
+      config::shard_local_cfg().storage_segment_file_pool_size());
     if (unlikely(config::shard_local_cfg()
                    .log_disable_housekeeping_for_tests.value())) {
         co_return;
@@ -181,19 +194,23 @@ ss::future<> log_manager::start() {
 ss::future<> log_manager::stop() {
     _abort_source.request_abort();
     _housekeeping_sem.broken();
+    _recovery_probe.clear_metrics();
+    _read_ahead_probe.clear_metrics();
+    _dma_write_probe.clear_metrics();
 
     co_await _open_gate.close();
     co_await ss::coroutine::parallel_for_each(
       _logs, [this](logs_type::value_type& entry) {
           return clean_close(entry.second->handle);
       });
+    co_await _resources.get_segment_file_pool().stop();
     co_await _batch_cache.stop();
     co_await ssx::async_clear(_logs)();
-    if (_compaction_hash_key_map) {
-        // Clear memory used for the compaction hash map, if any.
-        co_await _compaction_hash_key_map->initialize(0);
-        _compaction_hash_key_map.reset();
+    // Clear memory used for the compaction hash maps, if any.
+    for (auto& map : _compaction_hash_key_maps) {
+        co_await map->initialize(0);
     }
+    _compaction_hash_key_maps.clear();
 }
 
 /**
@@ -207,12 +224,12 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
         return (var & flag) != flag;
     };
 
-    // reset flags for the next two loops, segment_ms and compaction.
-    // since there are suspension points during the traversal of _logs_list, the
-    // algorithm is: mark the logs visited, rotate _logs_list, op, and loop
-    // until empty or reaching a marked log
+    // reset flags for the segment_ms loop. since there are suspension points
+    // during the traversal of _logs_list, the algorithm is: mark the logs
+    // visited, rotate _logs_list, op, and loop until empty or reaching a
+    // marked log
     for (auto& log_meta : _logs_list) {
-        log_meta.flags &= ~(bflags::compacted | bflags::lifetime_checked);
+        log_meta.flags &= ~bflags::lifetime_checked;
     }
 
     /*
@@ -242,42 +259,71 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
         co_await current_log.handle->apply_segment_ms();
     }
 
+    auto schedule = co_await housekeeping_schedule(collection_threshold);
+    if (_abort_source.abort_requested()) {
+        co_return;
+    }
+
     if (
       config::shard_local_cfg().log_compaction_use_sliding_window.value()
-      && !_compaction_hash_key_map && !_logs_list.empty()
-      && is_not_set(_logs_list.front().flags, bflags::compacted)) {
-        auto compaction_mem_bytes
-          = memory_groups().compaction_reserved_memory();
-        auto compaction_map = std::make_unique<hash_key_offset_map>();
-        co_await compaction_map->initialize(compaction_mem_bytes);
-        _compaction_hash_key_map = std::move(compaction_map);
+      && _compaction_hash_key_maps.empty() && !schedule.empty()) {
+        const size_t num_maps
+          = config::shard_local_cfg()
+              .storage_compaction_max_concurrent_partitions();
+        auto map_mem_bytes = memory_groups().compaction_reserved_memory()
+                             / num_maps;
+        for (size_t i = 0; i < num_maps; ++i) {
+            auto compaction_map = std::make_unique<hash_key_offset_map>();
+            co_await compaction_map->initialize(map_mem_bytes);
+            _compaction_hash_key_maps.push_back(std::move(compaction_map));
+        }
     }
-    while (!_logs_list.empty()
-           && is_not_set(_logs_list.front().flags, bflags::compacted)) {
+
+    // Logs are housekept in rounds of up to one log per key-map, so that
+    // sliding window compaction of several partitions overlaps their I/O.
+    const size_t concurrency = std::max<size_t>(
+      _compaction_hash_key_maps.size(), 1);
+    std::vector<ss::future<>> round;
+    round.reserve(concurrency);
+    auto next = schedule.begin();
+    while (next != schedule.end()) {
         if (_abort_source.abort_requested()) {
             co_return;
         }
 
-        auto& current_log = _logs_list.front();
-
-        _logs_list.shift_forward();
-
-        current_log.flags |= bflags::compacted;
-        current_log.last_compaction = ss::lowres_clock::now();
-
-        auto ntp_sanitizer_cfg = _config.maybe_get_ntp_sanitizer_config(
-          current_log.handle->config().ntp());
-        // NOTE: housekeeping holds _compaction_housekeeping_gate, that prevents
-        // the removal of the parent object. this makes awaiting housekeeping
-        // safe against removal of segments from _logs_list
-        co_await current_log.handle->housekeeping(housekeeping_config(
-          collection_threshold,
-          _config.retention_bytes(),
-          current_log.handle->stm_manager()->max_collectible_offset(),
-          _config.compaction_priority,
-          _abort_source,
-          std::move(ntp_sanitizer_cfg),
-          _compaction_hash_key_map.get()));
+        while (round.size() < concurrency && next != schedule.end()) {
+            // the log may have been removed while the schedule was built or
+            // during the previous round
+            auto it = _logs.find(*next++);
+            if (it == _logs.end()) {
+                continue;
+            }
+            auto& current_log = *it->second;
+            current_log.last_compaction = ss::lowres_clock::now();
+
+            auto ntp_sanitizer_cfg = _config.maybe_get_ntp_sanitizer_config(
+              current_log.handle->config().ntp());
+            auto* key_map = _compaction_hash_key_maps.empty()
+                              ? nullptr
+                              : _compaction_hash_key_maps[round.size()].get();
+            // NOTE: housekeeping enters _compaction_housekeeping_gate before
+            // its first suspension point, that prevents the removal of the
+            // parent object. the handle is held by the continuation so the
+            // log outlives the round even if it's removed from _logs_list.
+            auto handle = current_log.handle;
+            round.push_back(handle
+                              ->housekeeping(housekeeping_config(
+                                collection_threshold,
+                                _config.retention_bytes(),
+                                handle->stm_manager()->max_collectible_offset(),
+                                _config.compaction_priority,
+                                _abort_source,
+                                std::move(ntp_sanitizer_cfg),
+                                key_map))
+                              .finally([handle] {}));
+        }
+        co_await ss::when_all_succeed(round.begin(), round.end());
+        round.clear();
 
         // bail out of compaction early in order to get back to gc
         if (_gc_triggered) {
@@ -286,6 +332,79 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
     }
 }
 
+/**
+ * `housekeeping_schedule` returns the logs with housekeeping work, ordered by
+ * priority: first the logs from which retention would remove data, oldest and
+ * then largest first, followed by the compacted logs, least recently
+ * housekept first. Logs with nothing to do are left out, so that with many
+ * idle partitions a round only wakes up the ones that need it.
+ */
+ss::future<std::vector<model::ntp>>
+log_manager::housekeeping_schedule(model::timestamp collection_threshold) {
+    struct candidate {
+        model::ntp ntp;
+        housekeeping_estimate estimate;
+        ss::lowres_clock::time_point last_compaction;
+    };
+
+    // the estimates don't suspend, but there may be many logs: the list is
+    // copied first so that the loop below can yield
+    std::vector<model::ntp> ntps;
+    ntps.reserve(_logs.size());
+    for (const auto& log_meta : _logs_list) {
+        ntps.push_back(log_meta.handle->config().ntp());
+    }
+
+    const gc_config cfg(collection_threshold, _config.retention_bytes());
+    std::vector<candidate> candidates;
+    for (auto& ntp : ntps) {
+        co_await ss::coroutine::maybe_yield();
+        auto it = _logs.find(ntp);
+        if (it == _logs.end()) {
+            continue;
+        }
+        auto estimate = it->second->handle->estimate_housekeeping(cfg);
+        if (!estimate.has_work()) {
+            continue;
+        }
+        candidates.push_back(candidate{
+          .ntp = std::move(ntp),
+          .estimate = estimate,
+          .last_compaction = it->second->last_compaction,
+        });
+    }
+
+    std::sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const candidate& a, const candidate& b) {
+          if (a.estimate.gc_due != b.estimate.gc_due) {
+              return a.estimate.gc_due;
+          }
+          if (a.estimate.gc_due) {
+              if (a.estimate.oldest_timestamp != b.estimate.oldest_timestamp) {
+                  return a.estimate.oldest_timestamp
+                         < b.estimate.oldest_timestamp;
+              }
+              return a.estimate.size_bytes > b.estimate.size_bytes;
+          }
+          return a.last_compaction < b.last_compaction;
+      });
+
+    vlog(
+      stlog.debug,
+      "Housekeeping {} of {} logs",
+      candidates.size(),
+      ntps.size());
+
+    std::vector<model::ntp> schedule;
+    schedule.reserve(candidates.size());
+    for (auto& c : candidates) {
+        schedule.push_back(std::move(c.ntp));
+    }
+    co_return schedule;
+}
+
 ss::future<> log_manager::housekeeping() {
     while (!_open_gate.is_closed()) {
         try {
@@ -342,6 +461,8 @@ ss::future<> log_manager::housekeeping_loop() {
             // time for some chores
         }
 
+        co_await refresh_directories();
+
         /*
          * When we are in a low disk space situation we would like to reclaim
          * data as fast as possible since being in that state may cause all
@@ -456,6 +577,13 @@ ss::future<ss::lw_shared_ptr<segment>> log_manager::make_log_segment(
 
     auto ntp_sanitizer_cfg = _config.maybe_get_ntp_sanitizer_config(ntp.ntp());
 
+    // the pool is in the base directory, and takes a file by rename
+    std::optional<size_t> preallocated;
+    if (ntp.base_directory() == _config.base_dir) {
+        preallocated = co_await _resources.get_segment_file_pool().take(
+          segment_full_path(ntp, base_offset, term, version));
+    }
+
     co_return co_await make_segment(
       ntp,
       base_offset,
@@ -467,7 +595,8 @@ ss::future<ss::lw_shared_ptr<segment>> log_manager::make_log_segment(
       create_cache(ntp.cache_enabled()),
       _resources,
       _feature_table,
-      std::move(ntp_sanitizer_cfg));
+      std::move(ntp_sanitizer_cfg),
+      preallocated.value_or(0));
 }
 
 std::optional<batch_cache_index>
@@ -481,11 +610,45 @@ log_manager::create_cache(with_cache ntp_cache_enabled) {
     return batch_cache_index(_batch_cache);
 }
 
-ss::future<ss::shared_ptr<log>> log_manager::manage(ntp_config cfg) {
+ss::future<ss::shared_ptr<log>>
+log_manager::manage(ntp_config cfg, prioritize_recovery prioritize) {
     auto gate = _open_gate.hold();
 
-    auto units = co_await _resources.get_recovery_units();
-    co_return co_await do_manage(std::move(cfg));
+    if (prioritize) {
+        _recovery_probe.prioritized_recovery();
+    }
+    auto units = co_await _resources.get_recovery_units(prioritize);
+    _recovery_probe.recovery_started();
+    auto finished = ss::defer([this] { _recovery_probe.recovery_finished(); });
+
+    // the partitions of the base directory may be placed in any directory,
+    // others (e.g. of tests) stay where they are asked to be
+    if (_directories.multiple() && cfg.base_directory() == _config.base_dir) {
+        cfg.base_directory() = co_await _directories.place(cfg);
+    } else {
+        _directories.add_partition(cfg.base_directory());
+    }
+    auto placed = ss::defer([this, dir = cfg.base_directory()] {
+        _directories.remove_partition(dir);
+    });
+    auto log = co_await do_manage(std::move(cfg));
+    placed.cancel();
+    co_return log;
+}
+
+ss::future<> log_manager::refresh_directories() {
+    if (!_directories.multiple()) {
+        co_return;
+    }
+    co_await _directories.refresh();
+    // the base directory is accounted by storage_resources::update_allowance
+    std::vector<storage_resources::device_allowance> allowances;
+    const auto& dirs = _directories.get();
+    for (auto it = std::next(dirs.begin()); it != dirs.end(); ++it) {
+        allowances.push_back(
+          {.free = it->free, .partitions = it->partitions});
+    }
+    _resources.update_device_allowances(std::move(allowances));
 }
 
 ss::future<> log_manager::recover_log_state(const ntp_config& cfg) {
@@ -549,6 +712,7 @@ ss::future<ss::shared_ptr<log>> log_manager::do_manage(ntp_config cfg) {
     _logs_list.push_back(*it->second);
     _resources.update_partition_count(_logs.size());
     vassert(success, "Could not keep track of:{} - concurrency issue", l);
+    _recovery_probe.log_recovered(l->segment_count());
     co_return l;
 }
 
@@ -559,6 +723,8 @@ ss::future<> log_manager::shutdown(model::ntp ntp) {
     if (handle.empty()) {
         co_return;
     }
+    _directories.remove_partition(
+      handle.mapped()->handle->config().base_directory());
     co_await clean_close(handle.mapped()->handle);
     vlog(stlog.debug, "Shutdown: {}", ntp);
 }
@@ -573,6 +739,7 @@ ss::future<> log_manager::remove(model::ntp ntp) {
     }
     // 'ss::shared_ptr<>' make a copy
     auto lg = handle.mapped()->handle;
+    _directories.remove_partition(lg->config().base_directory());
     vlog(stlog.info, "Removing: {}", lg);
     // NOTE: it is ok to *not* externally synchronize the log here
     // because remove, takes a write lock on each individual segments
@@ -651,6 +818,23 @@ ss::future<> log_manager::remove_orphan_files(
   ss::sstring data_directory_path,
   absl::flat_hash_set<model::ns> namespaces,
   ss::noncopyable_function<bool(model::ntp, partition_path::metadata)>
+    orphan_filter) {
+    co_await remove_orphan_files_in(
+      data_directory_path, namespaces, orphan_filter);
+    if (data_directory_path != _config.base_dir) {
+        co_return;
+    }
+    // partitions of the base directory may be placed in the extra ones
+    const auto& dirs = _directories.get();
+    for (auto it = std::next(dirs.begin()); it != dirs.end(); ++it) {
+        co_await remove_orphan_files_in(it->path, namespaces, orphan_filter);
+    }
+}
+
+ss::future<> log_manager::remove_orphan_files_in(
+  const ss::sstring& data_directory_path,
+  const absl::flat_hash_set<model::ns>& namespaces,
+  ss::noncopyable_function<bool(model::ntp, partition_path::metadata)>&
     orphan_filter) {
     auto data_directory_exist = co_await ss::file_exists(data_directory_path);
     if (!data_directory_exist) {
@@ -22,8 +22,10 @@
 #include "storage/file_sanitizer_types.h"
 #include "storage/key_offset_map.h"
 #include "storage/log.h"
+#include "storage/log_directories.h"
 #include "storage/log_housekeeping_meta.h"
 #include "storage/ntp_config.h"
+#include "storage/probe.h"
 #include "storage/storage_resources.h"
 #include "storage/types.h"
 #include "storage/version.h"
@@ -45,6 +47,7 @@
 #include <array>
 #include <chrono>
 #include <optional>
+#include <vector>
 
 namespace storage {
 
@@ -86,6 +89,8 @@ struct log_config {
     log_config& operator=(log_config&&) noexcept = default;
 
     ss::sstring base_dir;
+    // more directories, on other devices, to place partitions in
+    std::vector<ss::sstring> extra_dirs;
     config::binding<size_t> max_segment_size;
 
     // Default 5% jitter on segment size thresholds
@@ -168,7 +173,13 @@ public:
       storage_resources&,
       ss::sharded<features::feature_table>&) noexcept;
 
-    ss::future<ss::shared_ptr<log>> manage(ntp_config);
+    /**
+     * Open the log, recovering its segments if needed. The number of
+     * concurrent recoveries on a shard is limited, prioritized recoveries
+     * are done ahead of the regular ones.
+     */
+    ss::future<ss::shared_ptr<log>>
+      manage(ntp_config, prioritize_recovery = prioritize_recovery::no);
 
     ss::future<> shutdown(model::ntp);
 
@@ -225,6 +236,8 @@ public:
 
     storage_resources& resources() { return _resources; }
 
+    const log_directories& directories() const { return _directories; }
+
     /*
      * Return disk usage information for all logs managed on the current core.
      */
@@ -261,10 +274,19 @@ private:
     std::optional<batch_cache_index> create_cache(with_cache);
 
     ss::future<> dispatch_topic_dir_deletion(ss::sstring dir);
+    ss::future<> remove_orphan_files_in(
+      const ss::sstring& data_directory_path,
+      const absl::flat_hash_set<model::ns>& namespaces,
+      ss::noncopyable_function<bool(model::ntp, partition_path::metadata)>&
+        orphan_filter);
+    // refreshes the disk space of the extra data directories
+    ss::future<> refresh_directories();
     ss::future<> recover_log_state(const ntp_config&);
     ss::future<> async_clear_logs();
 
     ss::future<> housekeeping_scan(model::timestamp);
+    ss::future<std::vector<model::ntp>>
+      housekeeping_schedule(model::timestamp);
 
     log_config _config;
     kvstore& _kvstore;
@@ -275,10 +297,15 @@ private:
     logs_type _logs;
     compaction_list_type _logs_list;
     batch_cache _batch_cache;
-
-    // Hash key-map to use across multiple compactions to reuse reserved memory
-    // rather than reallocating repeatedly.
-    std::unique_ptr<hash_key_offset_map> _compaction_hash_key_map;
+    log_directories _directories;
+    log_recovery_probe _recovery_probe;
+    read_ahead_probe _read_ahead_probe;
+    dma_write_probe _dma_write_probe;
+
+    // Hash key-maps to use across multiple compactions to reuse reserved
+    // memory rather than reallocating repeatedly. One map per partition that
+    // may be compacted concurrently.
+    std::vector<std::unique_ptr<hash_key_offset_map>> _compaction_hash_key_maps;
     ss::gate _open_gate;
     ss::abort_source _abort_source;
 
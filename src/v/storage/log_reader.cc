@@ -125,9 +125,13 @@ void skipping_consumer::print(std::ostream& os) const {
 }
 
 log_segment_batch_reader::log_segment_batch_reader(
-  segment& seg, log_reader_config& config, probe& p) noexcept
+  segment& seg,
+  log_reader_config& config,
+  catch_up_detector& catch_up,
+  probe& p) noexcept
   : _seg(seg)
   , _config(config)
+  , _catch_up(catch_up)
   , _probe(p) {}
 
 ss::future<std::unique_ptr<continuous_batch_parser>>
@@ -157,8 +161,9 @@ void log_segment_batch_reader::add_one(model::record_batch&& batch) {
     _config.bytes_consumed += size_bytes;
     _state.buffer_size += size_bytes;
     _probe.add_bytes_read(size_bytes);
-    if (!_config.skip_batch_cache) {
-        _seg.cache_put(b);
+    _catch_up.record_read(_seg, size_bytes);
+    if (!read_once()) {
+        _seg.cache_put(b, batch_cache::disk_read::yes);
     }
 }
 ss::future<result<records_t>>
@@ -173,7 +178,7 @@ log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
       _config.type_filter,
       _config.first_timestamp,
       std::min(max_buffer_size, _config.max_bytes),
-      _config.skip_batch_cache);
+      read_once());
 
     // handles cases where the type filter skipped batches. see
     // batch_cache_index::read for more details.
@@ -244,7 +249,7 @@ log_reader::log_reader(
 
     if (_iterator.next_seg != _lease->range.end()) {
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
-          **_iterator.next_seg, _config, _probe);
+          **_iterator.next_seg, _config, _catch_up, _probe);
     }
 }
 
@@ -264,7 +269,7 @@ ss::future<> log_reader::find_next_valid_iterator() {
     }
     if (_iterator.next_seg != _lease->range.end()) {
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
-          **_iterator.next_seg, _config, _probe);
+          **_iterator.next_seg, _config, _catch_up, _probe);
         _iterator.current_reader_seg = _iterator.next_seg;
     }
     if (tmp_reader) {
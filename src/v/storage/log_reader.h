@@ -86,12 +86,38 @@ private:
     model::offset _expected_next_batch;
 };
 
+/*
+ * Detects a reader catching up on historical data, e.g. a consumer
+ * backfilling from an old offset. Such a reader reads every batch once, and
+ * caching its batches would only evict the batches read by the consumers at
+ * the tail of the log.
+ */
+class catch_up_detector {
+public:
+    // bytes read from disk in closed segments after which a reader is
+    // considered to be catching up
+    static constexpr size_t threshold = 16 * 1024 * 1024; // 16MB
+
+    // a read from the active segment means that the reader is at the tail
+    void record_read(const segment& s, size_t bytes) {
+        _bytes = s.has_appender() ? 0 : _bytes + bytes;
+    }
+
+    bool catching_up() const { return _bytes >= threshold; }
+
+private:
+    size_t _bytes{0};
+};
+
 class log_segment_batch_reader {
 public:
     static constexpr size_t max_buffer_size = 32 * 1024; // 32KB
 
     log_segment_batch_reader(
-      segment&, log_reader_config& config, probe& p) noexcept;
+      segment&,
+      log_reader_config& config,
+      catch_up_detector& catch_up,
+      probe& p) noexcept;
     log_segment_batch_reader(log_segment_batch_reader&&) noexcept = default;
     log_segment_batch_reader& operator=(log_segment_batch_reader&&) noexcept
       = delete;
@@ -112,6 +138,12 @@ private:
 
     void add_one(model::record_batch&&);
 
+    // true if the read should neither insert nor promote cached batches
+    bool read_once() const {
+        return _config.cache_hint == batch_cache_hint::read_once
+               || _catch_up.catching_up();
+    }
+
 private:
     struct tmp_state {
         ss::circular_buffer<model::record_batch> buffer;
@@ -121,6 +153,7 @@ private:
 
     segment& _seg;
     log_reader_config& _config;
+    catch_up_detector& _catch_up;
     probe& _probe;
 
     std::unique_ptr<continuous_batch_parser> _iterator;
@@ -203,6 +236,19 @@ public:
      */
     bool is_reusable() const { return _iterator.reader != nullptr; }
 
+    /**
+     * Estimate of the buffer memory kept alive by this reader, i.e. by the
+     * stream of the segment it is positioned in.
+     */
+    size_t memory_estimate() const {
+        if (!_iterator.reader) {
+            return 0;
+        }
+        return (*_iterator.current_reader_seg)
+          ->reader()
+          .stream_memory_estimate();
+    }
+
 private:
     void set_end_of_stream() { _iterator.next_seg = _lease->range.end(); }
     bool is_done();
@@ -231,6 +277,8 @@ private:
     std::unique_ptr<lock_manager::lease> _lease;
     iterator_pair _iterator;
     log_reader_config _config;
+    // lives as long as the reader, which may be reused by readers_cache
+    catch_up_detector _catch_up;
     model::offset _last_base;
     probe& _probe;
     ss::abort_source::subscription _as_sub;
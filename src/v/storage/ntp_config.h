@@ -11,6 +11,7 @@
 
 #pragma once
 #include "config/configuration.h"
+#include "model/compression.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "ssx/sformat.h"
@@ -33,6 +34,13 @@ public:
     static constexpr bool default_remote_delete{true};
     static constexpr bool legacy_remote_delete{false};
 
+    // Writes are fsynced before acks=all requests are acknowledged, unless
+    // the topic opts into write caching.
+    static constexpr bool default_write_caching{false};
+
+    // All replicas vote unless the topic asks for observers.
+    static constexpr int16_t default_observer_replicas{0};
+
     static constexpr std::chrono::milliseconds read_replica_retention{3600000};
 
     struct default_overrides {
@@ -71,6 +79,18 @@ public:
         tristate<std::chrono::milliseconds> initial_retention_local_target_ms{
           std::nullopt};
 
+        // if set to a codec, compaction rewrites data batches with it
+        // instead of the codec they were produced with
+        std::optional<model::compression> compression;
+
+        // if set, acks=all writes are acknowledged once a majority of the
+        // replicas appended them, before they are flushed
+        std::optional<bool> write_caching;
+
+        // if set, number of replicas of the partition which replicate the
+        // log without voting, to serve reads
+        std::optional<int16_t> observer_replicas;
+
         friend std::ostream&
         operator<<(std::ostream&, const default_overrides&);
     };
@@ -156,6 +176,16 @@ public:
         return std::filesystem::path(_base_dir) / _ntp.topic_path();
     }
 
+    // The compression data batches are rewritten with by compaction, if any.
+    std::optional<model::compression> recompression_type() const {
+        if (
+          _overrides && _overrides->compression
+          && *_overrides->compression != model::compression::producer) {
+            return _overrides->compression;
+        }
+        return std::nullopt;
+    }
+
     with_cache cache_enabled() const {
         return with_cache(!has_overrides() || _overrides->cache_enabled);
     }
@@ -235,6 +265,21 @@ public:
         }
     }
 
+    bool write_caching() const {
+        if (_overrides == nullptr) {
+            return default_write_caching;
+        }
+        return _overrides->write_caching.value_or(default_write_caching);
+    }
+
+    int16_t observer_replicas() const {
+        if (_overrides == nullptr) {
+            return default_observer_replicas;
+        }
+        return _overrides->observer_replicas.value_or(
+          default_observer_replicas);
+    }
+
     auto segment_ms() const -> std::optional<std::chrono::milliseconds> {
         if (_overrides) {
             if (_overrides->segment_ms.is_disabled()) {
@@ -16,17 +16,226 @@
 #include "vassert.h"
 #include "vlog.h"
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 
 namespace storage {
 
+offset_translator_state::sealed_block::sealed_block(
+  std::span<const entry> entries)
+  : _front(entries.front())
+  , _back(entries.back())
+  , _size(entries.size())
+  , _last_offsets(
+      entries.front().last_offset(), details::delta_delta<int64_t>{})
+  , _base_offsets(entries.front().batch.base_offset())
+  , _next_deltas(entries.front().batch.next_delta) {
+    constexpr size_t row_width = details::FOR_buffer_depth;
+    vassert(
+      _size <= max_entries,
+      "sealed block can't contain more than {} entries, requested: {}",
+      max_entries,
+      _size);
+
+    std::array<int64_t, row_width> last_offsets{};
+    std::array<int64_t, row_width> base_offsets{};
+    std::array<int64_t, row_width> next_deltas{};
+    for (size_t i = 0; i < _size; i += row_width) {
+        for (size_t j = 0; j < row_width; ++j) {
+            // the last row is padded by repeating the last entry
+            const auto& e = entries[std::min(i + j, _size - 1)];
+            last_offsets[j] = e.last_offset();
+            base_offsets[j] = e.batch.base_offset();
+            next_deltas[j] = e.batch.next_delta;
+        }
+        _last_offsets.add(last_offsets);
+        _base_offsets.add(base_offsets);
+        _next_deltas.add(next_deltas);
+    }
+}
+
+std::vector<offset_translator_state::entry>
+offset_translator_state::sealed_block::decode() const {
+    constexpr size_t row_width = details::FOR_buffer_depth;
+    deltafor_decoder<int64_t, details::delta_delta<int64_t>> last_offsets(
+      _last_offsets.get_initial_value(),
+      _last_offsets.get_row_count(),
+      _last_offsets.share(),
+      details::delta_delta<int64_t>{});
+    deltafor_decoder<int64_t> base_offsets(
+      _base_offsets.get_initial_value(),
+      _base_offsets.get_row_count(),
+      _base_offsets.share());
+    deltafor_decoder<int64_t> next_deltas(
+      _next_deltas.get_initial_value(),
+      _next_deltas.get_row_count(),
+      _next_deltas.share());
+
+    std::vector<entry> ret;
+    ret.reserve(_size);
+    std::array<int64_t, row_width> last_offsets_row{};
+    std::array<int64_t, row_width> base_offsets_row{};
+    std::array<int64_t, row_width> next_deltas_row{};
+    while (last_offsets.read(last_offsets_row)
+           && base_offsets.read(base_offsets_row)
+           && next_deltas.read(next_deltas_row)) {
+        for (size_t j = 0; j < row_width && ret.size() < _size; ++j) {
+            ret.push_back(entry{
+              .last_offset = model::offset(last_offsets_row[j]),
+              .batch = batch_info{
+                .base_offset = model::offset(base_offsets_row[j]),
+                .next_delta = next_deltas_row[j]}});
+        }
+    }
+    return ret;
+}
+
+size_t offset_translator_state::size() const {
+    size_t ret = _last_offset2batch.size();
+    for (const auto& b : _sealed) {
+        ret += b.size();
+    }
+    return ret;
+}
+
+offset_translator_state::entry offset_translator_state::first() const {
+    if (!_sealed.empty()) {
+        return _sealed.front().front();
+    }
+    auto it = _last_offset2batch.begin();
+    return entry{.last_offset = it->first, .batch = it->second};
+}
+
+offset_translator_state::entry offset_translator_state::last() const {
+    if (!_last_offset2batch.empty()) {
+        auto it = _last_offset2batch.rbegin();
+        return entry{.last_offset = it->first, .batch = it->second};
+    }
+    return _sealed.back().back();
+}
+
+size_t offset_translator_state::sealed_lower_bound(model::offset o) const {
+    auto it = std::lower_bound(
+      _sealed.begin(),
+      _sealed.end(),
+      o,
+      [](const sealed_block& b, model::offset o) {
+          return b.back().last_offset < o;
+      });
+    return std::distance(_sealed.begin(), it);
+}
+
+const std::vector<offset_translator_state::entry>&
+offset_translator_state::decoded_block(size_t idx) const {
+    if (_decoded_idx != idx) {
+        _decoded = _sealed[idx].decode();
+        _decoded_idx = idx;
+    }
+    return _decoded;
+}
+
+void offset_translator_state::invalidate_decoded_block() const {
+    _decoded_idx.reset();
+    _decoded.clear();
+}
+
+offset_translator_state::neighbors
+offset_translator_state::lower_bound(model::offset o) const {
+    neighbors ret;
+    const auto block_idx = sealed_lower_bound(o);
+    if (block_idx == _sealed.size()) {
+        // all the sealed entries are smaller than o
+        auto it = _last_offset2batch.lower_bound(o);
+        if (it != _last_offset2batch.end()) {
+            ret.next = entry{.last_offset = it->first, .batch = it->second};
+        }
+        if (it != _last_offset2batch.begin()) {
+            auto prev = std::prev(it);
+            ret.prev = entry{.last_offset = prev->first, .batch = prev->second};
+        } else if (!_sealed.empty()) {
+            ret.prev = _sealed.back().back();
+        }
+        return ret;
+    }
+
+    const auto& entries = decoded_block(block_idx);
+    auto it = std::lower_bound(
+      entries.begin(), entries.end(), o, [](const entry& e, model::offset o) {
+          return e.last_offset < o;
+      });
+    // the last entry of the block is >= o
+    ret.next = *it;
+    if (it != entries.begin()) {
+        ret.prev = *std::prev(it);
+    } else if (block_idx > 0) {
+        ret.prev = _sealed[block_idx - 1].back();
+    }
+    return ret;
+}
+
+template<typename Func>
+void offset_translator_state::for_each_from(model::offset o, Func f) const {
+    for (auto idx = sealed_lower_bound(o); idx < _sealed.size(); ++idx) {
+        for (const auto& e : decoded_block(idx)) {
+            if (e.last_offset < o) {
+                continue;
+            }
+            if (!f(e)) {
+                return;
+            }
+        }
+    }
+    for (auto it = _last_offset2batch.lower_bound(o);
+         it != _last_offset2batch.end();
+         ++it) {
+        if (!f(entry{.last_offset = it->first, .batch = it->second})) {
+            return;
+        }
+    }
+}
+
+void offset_translator_state::unseal_from(model::offset o) {
+    if (_sealed.empty() || _sealed.back().back().last_offset < o) {
+        return;
+    }
+    invalidate_decoded_block();
+    while (!_sealed.empty() && _sealed.back().back().last_offset >= o) {
+        for (const auto& e : _sealed.back().decode()) {
+            _last_offset2batch.emplace(e.last_offset, e.batch);
+        }
+        _sealed.pop_back();
+    }
+}
+
+void offset_translator_state::maybe_seal() {
+    // keep at least a block worth of the most recent entries uncompressed as
+    // these are the ones which are accessed and modified most often
+    constexpr size_t block_size = sealed_block::max_entries;
+    if (_last_offset2batch.size() < 2 * block_size) {
+        return;
+    }
+    std::vector<entry> entries;
+    entries.reserve(block_size);
+    while (_last_offset2batch.size() >= 2 * block_size) {
+        entries.clear();
+        auto it = _last_offset2batch.begin();
+        for (size_t i = 0; i < block_size; ++i, ++it) {
+            entries.push_back(
+              entry{.last_offset = it->first, .batch = it->second});
+        }
+        _sealed.emplace_back(entries);
+        _last_offset2batch.erase(_last_offset2batch.begin(), it);
+    }
+}
+
 int64_t offset_translator_state::delta(model::offset o) const {
-    if (_last_offset2batch.empty()) {
+    if (empty()) {
         return 0;
     }
 
-    auto it = _last_offset2batch.lower_bound(o);
-    if (it == _last_offset2batch.begin()) {
+    auto [prev, next] = lower_bound(o);
+    if (!prev) {
         // We don't have enough information to calculate delta if we've ended up
         // here (even if we have an entry with the key o in the
         // _last_offset2batch map). The reason is that the first entry of the
@@ -46,16 +255,15 @@ int64_t offset_translator_state::delta(model::offset o) const {
           "{})",
           _ntp,
           o,
-          model::next_offset(_last_offset2batch.begin()->first))};
+          model::next_offset(first().last_offset))};
     }
 
-    auto delta = std::prev(it)->second.next_delta;
-    if (it == _last_offset2batch.end() || o < it->second.base_offset) {
+    auto delta = prev->batch.next_delta;
+    if (!next || o < next->batch.base_offset) {
         // This is the common case: offset o is the offset of a record in a data
-        // batch between non-data batches pointed to by iterators `it` and
-        // `std::prev(it)` (or, if `it` is the map end, o is beyond the last
-        // non-data batch in the log). Delta that we need is stored in the map
-        // element pointed to by `std::prev(it)`.
+        // batch between non-data batches `prev` and `next` (or, if there is no
+        // `next`, o is beyond the last non-data batch in the log). Delta that
+        // we need is stored in the `prev` map element.
         return delta;
     } else {
         // The offset is inside the non-data batch, so the data offset stops
@@ -65,7 +273,7 @@ int64_t offset_translator_state::delta(model::offset o) const {
         // (redpanda) offset 0 is a config batch. Then its data (kafka) offset
         // must be 0, the same as the data (kafka) offset of the data record at
         // log (redpanda) offset 1.
-        return delta + (o - it->second.base_offset);
+        return delta + (o - next->batch.base_offset);
     }
 }
 model::offset_delta
@@ -80,7 +288,7 @@ model::offset offset_translator_state::from_log_offset(model::offset o) const {
 
 model::offset offset_translator_state::to_log_offset(
   model::offset data_offset, model::offset hint) const {
-    if (_last_offset2batch.empty()) {
+    if (empty()) {
         return data_offset;
     }
 
@@ -88,12 +296,11 @@ model::offset offset_translator_state::to_log_offset(
         return data_offset;
     }
 
-    model::offset min_log_offset = model::next_offset(
-      _last_offset2batch.begin()->first);
+    const auto first_entry = first();
+    model::offset min_log_offset = model::next_offset(first_entry.last_offset);
 
     model::offset min_data_offset
-      = min_log_offset
-        - model::offset(_last_offset2batch.begin()->second.next_delta);
+      = min_log_offset - model::offset(first_entry.batch.next_delta);
     if (data_offset < min_data_offset) {
         throw std::runtime_error{fmt::format(
           "ntp {}: data offset {} is outside the translation range (starting "
@@ -111,55 +318,46 @@ model::offset offset_translator_state::to_log_offset(
     // log offset equal to `data_offset` (because log offset is at least as
     // big as data offset) and stopping when we find the interval where
     // given data offset is achievable.
-    auto interval_end_it = _last_offset2batch.lower_bound(search_start);
+    auto interval_start = lower_bound(search_start).prev;
     vassert(
-      interval_end_it != _last_offset2batch.begin(),
+      interval_start.has_value(),
       "ntp {}: log offset search start too small: {}",
       _ntp,
       search_start);
-    auto delta = std::prev(interval_end_it)->second.next_delta;
+    auto delta = interval_start->batch.next_delta;
 
-    while (interval_end_it != _last_offset2batch.end()) {
+    for_each_from(search_start, [&delta, data_offset](const entry& e) {
         model::offset max_do_this_interval
-          = model::prev_offset(interval_end_it->second.base_offset)
-            - model::offset{delta};
+          = model::prev_offset(e.batch.base_offset) - model::offset{delta};
         if (max_do_this_interval >= data_offset) {
-            break;
+            return false;
         }
 
-        delta = interval_end_it->second.next_delta;
-        ++interval_end_it;
-    }
+        delta = e.batch.next_delta;
+        return true;
+    });
 
     return data_offset + model::offset(delta);
 }
 
 int64_t offset_translator_state::last_delta() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->second.next_delta;
+    return last().batch.next_delta;
 }
 
 model::offset offset_translator_state::last_gap_offset() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->first;
+    return last().last_offset;
 }
 
 void offset_translator_state::add_gap(
   model::offset base_offset, model::offset last_offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    if (last_offset < _last_offset2batch.begin()->first) {
+    const auto first_entry = first();
+    if (last_offset < first_entry.last_offset) {
         // The gap is added before the
         vlog(
           stlog.error,
@@ -168,18 +366,18 @@ void offset_translator_state::add_gap(
           _ntp,
           base_offset,
           last_offset,
-          _last_offset2batch.begin()->first);
+          first_entry.last_offset);
         return;
     }
-    auto rbegin = _last_offset2batch.rbegin();
+    const auto last_entry = last();
     int64_t length = last_offset() - base_offset() + 1;
-    int64_t next_delta = rbegin->second.next_delta + length;
+    int64_t next_delta = last_entry.batch.next_delta + length;
 
-    if (base_offset <= rbegin->first) {
-        auto it = _last_offset2batch.find(last_offset);
+    if (base_offset <= last_entry.last_offset) {
+        auto existing = lower_bound(last_offset).next;
         if (
-          it == _last_offset2batch.end()
-          || it->second.base_offset != base_offset) {
+          !existing || existing->last_offset != last_offset
+          || existing->batch.base_offset != base_offset) {
             // If the gap is added second time it should match
             // the existing one.
             throw std::runtime_error(fmt_with_ctx(
@@ -189,8 +387,8 @@ void offset_translator_state::add_gap(
               _ntp,
               base_offset,
               last_offset,
-              rbegin->second.base_offset,
-              rbegin->second.next_delta));
+              last_entry.batch.base_offset,
+              last_entry.batch.next_delta));
         }
         return;
     }
@@ -204,6 +402,7 @@ void offset_translator_state::add_gap(
     _last_offset2batch.emplace(
       last_offset,
       batch_info{.base_offset = base_offset, .next_delta = next_delta});
+    maybe_seal();
 }
 
 bool offset_translator_state::add_absolute_delta(
@@ -219,12 +418,19 @@ bool offset_translator_state::add_absolute_delta(
     // Remove all overlapping elements
     auto gap_end = model::prev_offset(offset);
     auto gap_length = delta;
+    unseal_from(model::next_offset(gap_end));
     auto it = _last_offset2batch.upper_bound(gap_end);
-    // Add new element if empty or delta is different
-    model::offset gap_begin = offset - model::offset(delta);
+    std::optional<entry> back;
     if (it != _last_offset2batch.begin()) {
         auto back_it = std::prev(it);
-        gap_length -= back_it->second.next_delta;
+        back = entry{.last_offset = back_it->first, .batch = back_it->second};
+    } else if (!_sealed.empty()) {
+        back = _sealed.back().back();
+    }
+    // Add new element if empty or delta is different
+    model::offset gap_begin = offset - model::offset(delta);
+    if (back) {
+        gap_length -= back->batch.next_delta;
         gap_begin = offset - model::offset(gap_length);
         if (gap_length < 0) {
             // gap is inconsistent and will overlap with the previous
@@ -237,53 +443,57 @@ bool offset_translator_state::add_absolute_delta(
               _ntp,
               offset,
               delta,
-              back_it->first,
-              back_it->second.next_delta,
-              back_it->second.base_offset,
+              back->last_offset,
+              back->batch.next_delta,
+              back->batch.base_offset,
               gap_length));
         }
     }
     _last_offset2batch.erase(it, _last_offset2batch.end());
-    if (gap_length > 0 || _last_offset2batch.empty()) {
+    if (gap_length > 0 || empty()) {
         _last_offset2batch.emplace(
           gap_end, batch_info{.base_offset = gap_begin, .next_delta = delta});
+        maybe_seal();
         return true;
     }
     return false;
 }
 
-void offset_translator_state::reset() { _last_offset2batch.clear(); }
+void offset_translator_state::reset() {
+    invalidate_decoded_block();
+    _sealed.clear();
+    _last_offset2batch.clear();
+}
 
 bool offset_translator_state::truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.lower_bound(offset);
-    if (it == _last_offset2batch.begin()) {
+    auto [prev, next] = lower_bound(offset);
+    if (!prev) {
         throw std::runtime_error{fmt::format(
           "ntp {}: trying to truncate offset_translator at offset {} which "
           "is "
           "<= base translation offset {}",
           _ntp,
           offset,
-          _last_offset2batch.begin()->first)};
+          first().last_offset)};
     }
 
-    if (it != _last_offset2batch.end()) {
-        if (offset > it->second.base_offset) {
+    if (next) {
+        if (offset > next->batch.base_offset) {
             throw std::runtime_error{fmt::format(
               "ntp {}: trying to truncate offset_translator at offset {} "
               "which "
               "is in the middle of the batch [{},{}]",
               _ntp,
               offset,
-              it->second.base_offset,
-              it->first)};
+              next->batch.base_offset,
+              next->last_offset)};
         }
 
-        _last_offset2batch.erase(it, _last_offset2batch.end());
+        unseal_from(offset);
+        _last_offset2batch.erase(
+          _last_offset2batch.lower_bound(offset), _last_offset2batch.end());
         return true;
     }
 
@@ -291,36 +501,60 @@ bool offset_translator_state::truncate(model::offset offset) {
 }
 
 bool offset_translator_state::prefix_truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.upper_bound(offset);
-    if (it != _last_offset2batch.end() && offset >= it->second.base_offset) {
+    // prev is the last entry <= offset and next is the first entry > offset
+    auto [prev, next] = lower_bound(model::next_offset(offset));
+    if (next && offset >= next->batch.base_offset) {
         throw std::runtime_error{fmt::format(
           "ntp {}: trying to prefix truncate offset translator at offset "
           "{} "
           "which is in the middle of the batch {}-{}",
           _ntp,
           offset,
-          it->second.base_offset,
-          it->first)};
+          next->batch.base_offset,
+          next->last_offset)};
     }
 
-    if (it == _last_offset2batch.begin()) {
+    if (!prev) {
         return false;
     }
 
-    auto prev_it = std::prev(it);
-    if (prev_it == _last_offset2batch.begin() && prev_it->first == offset) {
+    const auto first_entry = first();
+    if (
+      prev->last_offset == first_entry.last_offset
+      && first_entry.last_offset == offset) {
         return false;
     }
 
-    auto base_batch = prev_it->second;
+    auto base_batch = prev->batch;
     base_batch.base_offset = offset;
-    _last_offset2batch.erase(_last_offset2batch.begin(), it);
-    _last_offset2batch.emplace(offset, base_batch);
+    const entry base{.last_offset = offset, .batch = base_batch};
+
+    invalidate_decoded_block();
+    while (!_sealed.empty() && _sealed.front().back().last_offset <= offset) {
+        _sealed.pop_front();
+    }
+    if (_sealed.empty()) {
+        _last_offset2batch.erase(
+          _last_offset2batch.begin(), _last_offset2batch.upper_bound(offset));
+        _last_offset2batch.emplace(offset, base_batch);
+        return true;
+    }
+
+    // the entries of the uncompressed map all follow the sealed blocks, only
+    // the first remaining sealed block has to be rebuilt
+    auto entries = _sealed.front().decode();
+    _sealed.pop_front();
+    std::erase_if(
+      entries, [offset](const entry& e) { return e.last_offset <= offset; });
+    entries.insert(entries.begin(), base);
+    if (entries.size() > sealed_block::max_entries) {
+        _sealed.emplace_front(std::span(entries).subspan(1));
+        _sealed.emplace_front(std::span(entries).first(1));
+    } else {
+        _sealed.emplace_front(entries);
+    }
     return true;
 }
 
@@ -354,21 +588,19 @@ struct persisted_batches_map
 } // namespace
 
 iobuf offset_translator_state::serialize_map() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
     std::vector<persisted_batch> batches;
-    batches.reserve(_last_offset2batch.size());
-    for (const auto& [o, b] : _last_offset2batch) {
-        int32_t length = int32_t(o - b.base_offset) + 1;
-        batches.push_back(
-          persisted_batch{.base_offset = b.base_offset, .length = length});
-    }
+    batches.reserve(size());
+    for_each_from(model::offset::min(), [&batches](const entry& e) {
+        int32_t length = int32_t(e.last_offset - e.batch.base_offset) + 1;
+        batches.push_back(persisted_batch{
+          .base_offset = e.batch.base_offset, .length = length});
+        return true;
+    });
 
     persisted_batches_map persisted{
-      .start_delta = _last_offset2batch.begin()->second.next_delta,
+      .start_delta = first().batch.next_delta,
       .batches = std::move(batches),
     };
 
@@ -410,6 +642,7 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
 
     offset_translator_state state(std::move(ntp));
     state._last_offset2batch = std::move(last_offset2batch);
+    state.maybe_seal();
     return state;
 }
 
@@ -420,20 +653,21 @@ offset_translator_state offset_translator_state::from_bootstrap_state(
         state._last_offset2batch.emplace(
           o, batch_info{.base_offset = o, .next_delta = d});
     }
+    state.maybe_seal();
     return state;
 }
 
 std::ostream&
 operator<<(std::ostream& os, const offset_translator_state& state) {
-    const auto& map = state._last_offset2batch;
-
-    if (map.empty()) {
+    if (state.empty()) {
         return os << "{empty}";
     }
 
-    return os << "{base offset/delta: " << map.begin()->first << "/"
-              << map.begin()->second.next_delta << ", map size: " << map.size()
-              << ", last delta: " << map.rbegin()->second.next_delta << "}";
+    const auto first = state.first();
+    return os << "{base offset/delta: " << first.last_offset << "/"
+              << first.batch.next_delta << ", map size: " << state.size()
+              << ", sealed blocks: " << state._sealed.size()
+              << ", last delta: " << state.last().batch.next_delta << "}";
 }
 
 } // namespace storage
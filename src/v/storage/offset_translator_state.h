@@ -13,9 +13,15 @@
 
 #include "model/fundamental.h"
 #include "serde/serde.h"
+#include "utils/delta_for.h"
 
 #include <absl/container/btree_map.h>
 
+#include <deque>
+#include <optional>
+#include <span>
+#include <vector>
+
 namespace storage {
 
 /// Provides offset translation between raw log offsets and offsets not counting
@@ -28,6 +34,12 @@ namespace storage {
 /// It works by maintaining an in-memory map of all filtered batch offsets.
 /// This map allows us to quickly find a delta between the raw log offset and
 /// corresponding translated offset.
+///
+/// Partitions with a lot of non-data batches (e.g. transactional topics with
+/// high commit rates) can accumulate millions of map entries. To keep memory
+/// bounded only the most recent entries are kept in an uncompressed map, older
+/// entries are sealed into immutable delta-FOR compressed blocks which are
+/// decoded on access.
 class offset_translator_state {
 public:
     /// Create an empty translator - the delta between log and kafka offsets is
@@ -52,7 +64,12 @@ public:
 
     const model::ntp& ntp() const { return _ntp; }
 
-    bool empty() const { return _last_offset2batch.empty(); }
+    bool empty() const {
+        return _last_offset2batch.empty() && _sealed.empty();
+    }
+
+    /// Number of non-data batches tracked by the translator
+    size_t size() const;
 
     /// Difference between the log offset and the kafka offset.
     int64_t delta(model::offset) const;
@@ -125,9 +142,77 @@ private:
     // way we can calculate delta for any offset starting from log_start.
     using batches_map_t = absl::btree_map<model::offset, batch_info>;
 
+    struct entry {
+        model::offset last_offset;
+        batch_info batch;
+    };
+
+    // Immutable compressed run of consecutive map entries. The first and the
+    // last entries are kept uncompressed as they are needed to navigate
+    // between the blocks.
+    class sealed_block {
+    public:
+        static constexpr size_t max_entries = 16 * details::FOR_buffer_depth;
+
+        explicit sealed_block(std::span<const entry>);
+
+        std::vector<entry> decode() const;
+
+        const entry& front() const { return _front; }
+        const entry& back() const { return _back; }
+        size_t size() const { return _size; }
+
+    private:
+        // last offsets are strictly increasing while base offsets of the
+        // artificial batches may overlap with the previous batch
+        using last_offset_encoder_t
+          = deltafor_encoder<int64_t, details::delta_delta<int64_t>>;
+        using value_encoder_t = deltafor_encoder<int64_t>;
+
+        entry _front;
+        entry _back;
+        size_t _size;
+        last_offset_encoder_t _last_offsets;
+        value_encoder_t _base_offsets;
+        value_encoder_t _next_deltas;
+    };
+
+    // Entries adjacent to the lower bound of an offset, `next` is the first
+    // entry with the last offset >= o and `prev` is the entry before it.
+    struct neighbors {
+        std::optional<entry> prev;
+        std::optional<entry> next;
+    };
+
+    entry first() const;
+    entry last() const;
+    neighbors lower_bound(model::offset) const;
+
+    /// Visit entries with the last offset >= o in order until the visitor
+    /// returns false.
+    template<typename Func>
+    void for_each_from(model::offset o, Func) const;
+
+    // Index of the first sealed block with the last offset >= o
+    size_t sealed_lower_bound(model::offset) const;
+    const std::vector<entry>& decoded_block(size_t idx) const;
+
+    /// Move the sealed blocks containing entries with the last offset >= o
+    /// back to the uncompressed map.
+    void unseal_from(model::offset);
+    /// Seal the oldest entries of the uncompressed map when it grows too big.
+    void maybe_seal();
+    void invalidate_decoded_block() const;
+
 private:
     model::ntp _ntp;
+    // Compressed entries, all of them precede the entries of the uncompressed
+    // map.
+    std::deque<sealed_block> _sealed;
     batches_map_t _last_offset2batch;
+    // Most recently decoded sealed block
+    mutable std::optional<size_t> _decoded_idx;
+    mutable std::vector<entry> _decoded;
 };
 
 } // namespace storage
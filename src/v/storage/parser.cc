@@ -25,6 +25,7 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/when_all.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/variant_utils.hh>
 
 #include <bits/stdint-uintn.h>
@@ -77,17 +78,10 @@ static model::record_batch_header header_from_iobuf(iobuf b) {
     hdr.ctx.owner_shard = ss::this_shard_id();
     return hdr;
 }
-// make sure that `msg` parameter is a static string or it is not removed before
-// this function finishes
-static ss::future<result<iobuf>> verify_read_iobuf(
-  ss::input_stream<char>& in,
-  size_t expected,
-  const char* msg,
-  bool recover = false) {
-    auto b = co_await read_iobuf_exactly(in, expected);
-
-    if (likely(b.size_bytes() == expected)) {
-        co_return b;
+static bool is_short_read(
+  size_t expected, size_t read, const char* msg, bool recover = false) {
+    if (likely(read == expected)) {
+        return false;
     }
     if (!recover) {
         vlog(
@@ -95,7 +89,7 @@ static ss::future<result<iobuf>> verify_read_iobuf(
           "Stopping parser, short read. Expected to read {} bytes, but read {} "
           "bytes. context: {}",
           expected,
-          b.size_bytes(),
+          read,
           msg);
     } else {
         vlog(
@@ -103,65 +97,33 @@ static ss::future<result<iobuf>> verify_read_iobuf(
           "Recovery ended with short read. Expected to read {} bytes, but read "
           "{} bytes. context: {}",
           expected,
-          b.size_bytes(),
+          read,
           msg);
     }
-    co_return parser_errc::input_stream_not_enough_bytes;
+    return true;
 }
 
-ss::future<result<stop_parser>> continuous_batch_parser::consume_header() {
-    /**
-     * we use a loop to prevent using tail recursion
-     **/
-    for (;;) {
-        if (!_header) {
-            auto r = co_await read_header();
-            if (!r) {
-                co_return r.error();
-            }
-            _header = r.value();
-        }
-
-        auto ret = _consumer->accept_batch_start(*_header);
-        switch (ret) {
-        case batch_consumer::consume_result::stop_parser:
-            co_return stop_parser::yes;
-        case batch_consumer::consume_result::accept_batch:
-            _consumer->consume_batch_start(
-              *_header, _physical_base_offset, _header->size_bytes);
-            _physical_base_offset += _header->size_bytes;
-            co_return stop_parser::no;
-        case batch_consumer::consume_result::skip_batch:
-            _consumer->skip_batch_start(
-              *_header, _physical_base_offset, _header->size_bytes);
-            _physical_base_offset += _header->size_bytes;
-            auto remaining = _header->size_bytes
-                             - model::packed_record_batch_header_size;
-            auto b = co_await verify_read_iobuf(
-              get_stream(), remaining, "parser::skip_batch", _recovery);
+// make sure that `msg` parameter is a static string or it is not removed before
+// this function finishes
+static ss::future<result<iobuf>> verify_read_iobuf(
+  ss::input_stream<char>& in,
+  size_t expected,
+  const char* msg,
+  bool recover = false) {
+    auto b = co_await read_iobuf_exactly(in, expected);
 
-            if (!b) {
-                co_return b.error();
-            }
-            // start again
-            add_bytes_and_reset();
-            continue;
-        }
-        __builtin_unreachable();
+    if (is_short_read(expected, b.size_bytes(), msg, recover)) {
+        co_return parser_errc::input_stream_not_enough_bytes;
     }
+    co_return b;
 }
 
 template<class Consumer>
-static ss::future<result<model::record_batch_header>> read_header_impl(
-  ss::input_stream<char>& input,
-  const Consumer& consumer,
-  bool recovery = false) {
-    auto b = co_await read_iobuf_exactly(
-      input, model::packed_record_batch_header_size);
-
+static result<model::record_batch_header>
+parse_header(iobuf b, const Consumer& consumer, bool recovery = false) {
     if (b.empty()) {
         // benign outcome. happens at end of file
-        co_return parser_errc::end_of_stream;
+        return parser_errc::end_of_stream;
     }
     if (b.size_bytes() != model::packed_record_batch_header_size) {
         if (!recovery) {
@@ -178,13 +140,13 @@ static ss::future<result<model::record_batch_header>> read_header_impl(
               b.size_bytes(),
               consumer);
         }
-        co_return parser_errc::input_stream_not_enough_bytes;
+        return parser_errc::input_stream_not_enough_bytes;
     }
     // check if iobuf is filled is zeros, this means that we are reading
     // fallocated range filled with zeros
     if (unlikely(storage::internal::is_zero(b))) {
         // happens when we fallocate the file
-        co_return parser_errc::fallocated_file_read_zero_bytes_for_header;
+        return parser_errc::fallocated_file_read_zero_bytes_for_header;
     }
     auto header = header_from_iobuf(std::move(b));
 
@@ -209,29 +171,121 @@ static ss::future<result<model::record_batch_header>> read_header_impl(
               header,
               consumer);
         }
-        co_return parser_errc::header_only_crc_missmatch;
+        return parser_errc::header_only_crc_missmatch;
     }
-    co_return header;
+    return header;
+}
+
+template<class Consumer>
+static ss::future<result<model::record_batch_header>> read_header_impl(
+  ss::input_stream<char>& input,
+  const Consumer& consumer,
+  bool recovery = false) {
+    auto b = co_await read_iobuf_exactly(
+      input, model::packed_record_batch_header_size);
+    co_return parse_header(std::move(b), consumer, recovery);
 }
 
-ss::future<result<model::record_batch_header>>
-continuous_batch_parser::read_header() {
-    return read_header_impl(get_stream(), *_consumer, _recovery);
+std::optional<ss::future<>> continuous_batch_parser::fill_pending(size_t n) {
+    while (_pending.size_bytes() < n && !get_stream().eof()) {
+        auto f = get_stream().read_up_to(n - _pending.size_bytes());
+        if (!f.available()) {
+            return f.then([this](ss::temporary_buffer<char> buf) {
+                _pending.append(std::move(buf));
+            });
+        }
+        // an empty buffer marks the end of the stream, stopping the loop
+        _pending.append(f.get());
+    }
+    return std::nullopt;
 }
 
-ss::future<result<stop_parser>> continuous_batch_parser::consume_one() {
-    return consume_header().then([this](result<stop_parser> st) {
-        if (!st) {
-            return ss::make_ready_future<result<stop_parser>>(st.error());
+continuous_batch_parser::step_result continuous_batch_parser::consume_one() {
+    /**
+     * we use a loop to prevent using tail recursion
+     **/
+    for (;;) {
+        switch (_state) {
+        case parse_state::header: {
+            if (!_header) {
+                if (auto f = fill_pending(
+                      model::packed_record_batch_header_size)) {
+                    return std::move(*f);
+                }
+                auto r = parse_header(
+                  std::exchange(_pending, {}), *_consumer, _recovery);
+                if (!r) {
+                    return result<stop_parser>(r.error());
+                }
+                _header = r.value();
+            }
+
+            auto ret = _consumer->accept_batch_start(*_header);
+            switch (ret) {
+            case batch_consumer::consume_result::stop_parser:
+                return result<stop_parser>(stop_parser::yes);
+            case batch_consumer::consume_result::accept_batch:
+                _consumer->consume_batch_start(
+                  *_header, _physical_base_offset, _header->size_bytes);
+                _state = parse_state::records;
+                break;
+            case batch_consumer::consume_result::skip_batch:
+                _consumer->skip_batch_start(
+                  *_header, _physical_base_offset, _header->size_bytes);
+                _state = parse_state::skip;
+                break;
+            }
+            _physical_base_offset += _header->size_bytes;
+            continue;
+        }
+        case parse_state::skip: {
+            auto remaining = _header->size_bytes
+                             - model::packed_record_batch_header_size;
+            if (auto f = fill_pending(remaining)) {
+                return std::move(*f);
+            }
+            auto read = std::exchange(_pending, {}).size_bytes();
+            if (is_short_read(
+                  remaining, read, "parser::skip_batch", _recovery)) {
+                return result<stop_parser>(
+                  parser_errc::input_stream_not_enough_bytes);
+            }
+            // start again
+            add_bytes_and_reset();
+            continue;
         }
-        if (st.value() == stop_parser::yes) {
-            return ss::make_ready_future<result<stop_parser>>(st.value());
+        case parse_state::records: {
+            auto sz = _header->size_bytes
+                      - model::packed_record_batch_header_size;
+            if (auto f = fill_pending(sz)) {
+                return std::move(*f);
+            }
+            auto records = std::exchange(_pending, {});
+            if (is_short_read(
+                  sz,
+                  records.size_bytes(),
+                  "parser::consume_records",
+                  _recovery)) {
+                add_bytes_and_reset();
+                return result<stop_parser>(
+                  parser_errc::input_stream_not_enough_bytes);
+            }
+            _consumer->consume_records(std::move(records));
+            auto end = _consumer->consume_batch_end();
+            if (!end.available()) {
+                _state = parse_state::batch_end;
+                return end.then(
+                  [this](stop_parser sp) { _batch_end_result = sp; });
+            }
+            add_bytes_and_reset();
+            return result<stop_parser>(end.get());
         }
-        return consume_records().then([this](result<stop_parser> r) {
+        case parse_state::batch_end:
             add_bytes_and_reset();
-            return r;
-        });
-    });
+            return result<stop_parser>(_batch_end_result);
+        }
+        __builtin_unreachable();
+    }
 }
 
 size_t continuous_batch_parser::consumed_batch_bytes() const {
@@ -241,20 +295,7 @@ size_t continuous_batch_parser::consumed_batch_bytes() const {
 void continuous_batch_parser::add_bytes_and_reset() {
     _bytes_consumed += consumed_batch_bytes();
     _header = {}; // reset
-}
-ss::future<result<stop_parser>> continuous_batch_parser::consume_records() {
-    auto sz = _header->size_bytes - model::packed_record_batch_header_size;
-    return verify_read_iobuf(
-             get_stream(), sz, "parser::consume_records", _recovery)
-      .then([this](result<iobuf> record) -> ss::future<result<stop_parser>> {
-          if (!record) {
-              return ss::make_ready_future<result<stop_parser>>(record.error());
-          }
-          _consumer->consume_records(std::move(record.value()));
-          return _consumer->consume_batch_end().then([](stop_parser sp) {
-              return ss::make_ready_future<result<stop_parser>>(sp);
-          });
-      });
+    _state = parse_state::header;
 }
 
 static constexpr std::array<parser_errc, 3> benign_error_codes{
@@ -267,36 +308,40 @@ ss::future<result<size_t>> continuous_batch_parser::consume() {
           benign_error_codes.begin(),
           benign_error_codes.end(),
           [v = _err](parser_errc e) { return e == v; }))) {
-        return ss::make_ready_future<result<size_t>>(_err);
+        co_return _err;
+    }
+    for (;;) {
+        auto step = consume_one();
+        if (auto* wait = std::get_if<ss::future<>>(&step)) {
+            // out of buffered bytes, wait for the input stream
+            co_await std::move(*wait);
+            continue;
+        }
+        auto& s = std::get<result<stop_parser>>(step);
+        if (!s) {
+            _err = parser_errc(s.error().value());
+            break;
+        }
+        if (get_stream().eof()) {
+            break;
+        }
+        if (s.value() == stop_parser::yes) {
+            break;
+        }
+        // a scan of buffered batches never suspends otherwise
+        co_await ss::coroutine::maybe_yield();
+    }
+    if (_bytes_consumed) {
+        // support partial reads
+        co_return _bytes_consumed;
+    }
+    if (std::any_of(
+          benign_error_codes.begin(),
+          benign_error_codes.end(),
+          [v = _err](parser_errc e) { return e == v; })) {
+        co_return _bytes_consumed;
     }
-    return ss::repeat([this] {
-               return consume_one().then([this](result<stop_parser> s) {
-                   if (!s) {
-                       _err = parser_errc(s.error().value());
-                       return ss::stop_iteration::yes;
-                   }
-                   if (get_stream().eof()) {
-                       return ss::stop_iteration::yes;
-                   }
-                   if (s.value() == stop_parser::yes) {
-                       return ss::stop_iteration::yes;
-                   }
-                   return ss::stop_iteration::no;
-               });
-           })
-      .then([this] {
-          if (_bytes_consumed) {
-              // support partial reads
-              return result<size_t>(_bytes_consumed);
-          }
-          if (std::any_of(
-                benign_error_codes.begin(),
-                benign_error_codes.end(),
-                [v = _err](parser_errc e) { return e == v; })) {
-              return result<size_t>(_bytes_consumed);
-          }
-          return result<size_t>(_err);
-      });
+    co_return _err;
 }
 
 class copy_helper {
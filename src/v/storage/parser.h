@@ -26,6 +26,7 @@
 #include <seastar/core/iostream.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <optional>
 #include <variant>
 
 namespace storage {
@@ -116,16 +117,31 @@ public:
     parser_errc error() const { return _err; }
 
 private:
-    /// \brief consumes _one_ full batch.
-    ss::future<result<batch_consumer::stop_parser>> consume_one();
+    /// \brief where the parser is within the current batch
+    enum class parse_state : int8_t {
+        header,    // reading the header, or waiting for accept_batch_start
+        skip,      // reading the records of a skipped batch
+        records,   // reading the records of an accepted batch
+        batch_end, // consume_batch_end() completed asynchronously
+    };
 
-    /// \brief read and parses header from input_file_stream
-    ss::future<result<model::record_batch_header>> read_header();
-    /// \brief parses and _stores_ the header into _header variable
-    ss::future<result<batch_consumer::stop_parser>> consume_header();
+    /// \brief the outcome of a step of the parser: either a parsed batch or
+    /// the read to wait for before the batch can be parsed
+    using step_result
+      = std::variant<result<batch_consumer::stop_parser>, ss::future<>>;
 
-    /// consume the [un]compressed records
-    ss::future<result<batch_consumer::stop_parser>> consume_records();
+    /// \brief consumes _one_ full batch.
+    ///
+    /// Runs synchronously for as long as the input stream has the bytes
+    /// buffered, and only returns a future at buffer boundaries, so that
+    /// scans of buffered data do not allocate a continuation per header and
+    /// per body.
+    step_result consume_one();
+
+    /// \brief reads into _pending until it holds `n` bytes or the end of the
+    /// stream is reached. Returns the read to wait for when the input stream
+    /// is out of buffered bytes.
+    std::optional<ss::future<>> fill_pending(size_t n);
 
     size_t consumed_batch_bytes() const;
     void add_bytes_and_reset();
@@ -142,6 +158,11 @@ private:
     bool _recovery{false};
 
     std::optional<model::record_batch_header> _header;
+    parse_state _state{parse_state::header};
+    batch_consumer::stop_parser _batch_end_result{false};
+    // bytes of the header or records being read, accumulated across the
+    // buffers of the input stream
+    iobuf _pending;
     parser_errc _err = parser_errc::none;
     size_t _bytes_consumed{0};
     size_t _physical_base_offset{0};
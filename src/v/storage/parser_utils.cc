@@ -34,7 +34,17 @@ model::record_batch_reader decompress_batch_consumer::end_of_stream() {
 }
 
 ss::future<model::record_batch> decompress_batch(model::record_batch&& b) {
-    return ss::futurize_invoke(decompress_batch_sync, std::move(b));
+    if (!b.compressed()) {
+        co_return std::move(b);
+    }
+    auto h = b.header();
+    iobuf body_buf = co_await compression::offload_compressor::uncompress(
+      std::move(b).release_data(), h.attrs.compression());
+    // must remove compression first!
+    h.attrs.remove_compression();
+    reset_size_checksum_metadata(h, body_buf);
+    co_return model::record_batch(
+      h, std::move(body_buf), model::record_batch::tag_ctor_ng{});
 }
 
 ss::future<model::record_batch> decompress_batch(const model::record_batch& b) {
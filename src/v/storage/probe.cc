@@ -11,8 +11,10 @@
 
 #include "config/configuration.h"
 #include "prometheus/prometheus_sanitize.h"
+#include "storage/read_ahead.h"
 #include "storage/readers_cache_probe.h"
 #include "storage/segment.h"
+#include "storage/storage_resources.h"
 
 #include <seastar/core/metrics.hh>
 
@@ -59,6 +61,158 @@ void node_probe::setup_node_metrics() {
       });
 }
 
+void flush_coordinator_probe::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:flush_coordinator"),
+      {
+        sm::make_counter(
+          "requests",
+          [this] { return _flush_requests; },
+          sm::description("Number of segment flushes requested")),
+        sm::make_counter(
+          "flushes",
+          [this] { return _flushes_dispatched; },
+          sm::description(
+            "Number of segment flushes dispatched to the filesystem")),
+        sm::make_gauge(
+          "coalescing_factor",
+          [this] {
+              return _flushes_dispatched == 0
+                       ? 1.0
+                       : static_cast<double>(_flush_requests)
+                           / static_cast<double>(_flushes_dispatched);
+          },
+          sm::description(
+            "Average number of flush requests served by one dispatched "
+            "flush")),
+      });
+}
+
+void log_recovery_probe::setup_metrics(const storage_resources& resources) {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:log_recovery"),
+      {
+        sm::make_gauge(
+          "pending",
+          [&resources] { return resources.recovery_waiters(); },
+          sm::description("Number of logs waiting to be recovered")),
+        sm::make_gauge(
+          "active",
+          [this] { return _active; },
+          sm::description("Number of logs being recovered")),
+        sm::make_counter(
+          "recovered",
+          [this] { return _recovered; },
+          sm::description("Number of logs recovered")),
+        sm::make_counter(
+          "prioritized",
+          [this] { return _prioritized; },
+          sm::description(
+            "Number of log recoveries prioritized as the partition is "
+            "likely to become a leader")),
+        sm::make_counter(
+          "segments",
+          [this] { return _segments_recovered; },
+          sm::description("Number of segments opened by log recoveries")),
+      });
+}
+
+void read_ahead_probe::setup_metrics(const read_ahead_budget& budget) {
+    if (config::shard_local_cfg().disable_metrics() || !budget.enabled()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:read_ahead"),
+      {
+        sm::make_gauge(
+          "budget_reserved_bytes",
+          [&budget] { return budget.reserved(); },
+          sm::description(
+            "Bytes of the read-ahead budget held by open segment streams")),
+        sm::make_counter(
+          "read_bytes",
+          [&budget] { return budget.get_stats().read_bytes; },
+          sm::description("Bytes read from disk by segment file streams")),
+        sm::make_counter(
+          "wasted_bytes",
+          [&budget] { return budget.get_stats().wasted_bytes; },
+          sm::description(
+            "Bytes read ahead by segment file streams and never consumed")),
+        sm::make_counter(
+          "grown",
+          [&budget] { return budget.get_stats().grown; },
+          sm::description("Number of times a reader grew its read-ahead")),
+        sm::make_counter(
+          "shrunk",
+          [&budget] { return budget.get_stats().shrunk; },
+          sm::description("Number of times a reader shrunk its read-ahead")),
+        sm::make_counter(
+          "denied",
+          [&budget] { return budget.get_stats().denied; },
+          sm::description(
+            "Number of streams denied a larger read-ahead by the exhausted "
+            "budget")),
+      });
+}
+
+void dma_write_probe::setup_metrics(const storage_resources& resources) {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:dma_writes"),
+      {
+        sm::make_gauge(
+          "inflight",
+          [&resources] { return resources.get_dma_write_stats().inflight; },
+          sm::description(
+            "Number of segment appender writes in flight on the device")),
+        sm::make_gauge(
+          "queue_depth",
+          [&resources] { return resources.dma_write_queue_depth(); },
+          sm::description(
+            "Maximum number of segment appender writes in flight, zero if "
+            "unlimited")),
+        sm::make_counter(
+          "dispatched",
+          [&resources] { return resources.get_dma_write_stats().dispatched; },
+          sm::description("Number of segment appender writes dispatched")),
+        sm::make_counter(
+          "merged",
+          [&resources] { return resources.get_dma_write_stats().merged; },
+          sm::description(
+            "Number of appender writes merged into a queued write")),
+        sm::make_counter(
+          "throttled",
+          [&resources] { return resources.get_dma_write_stats().throttled; },
+          sm::description(
+            "Number of appender writes which waited for the queue depth "
+            "limit")),
+        sm::make_counter(
+          "large_chunks",
+          [&resources] {
+              return resources.get_dma_write_stats().large_chunks;
+          },
+          sm::description(
+            "Number of large chunks taken by appenders sustaining a high "
+            "append rate")),
+      });
+}
+
 void probe::setup_metrics(const model::ntp& ntp) {
     if (config::shard_local_cfg().disable_metrics()) {
         return;
@@ -147,6 +301,27 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _segment_compacted; },
           sm::description("Number of compacted segments"),
           labels),
+        sm::make_counter(
+          "compaction_recompressed_bytes_in",
+          [this] { return _recompression_bytes_in; },
+          sm::description("Size of the batches rewritten by compaction with "
+                          "the topic's compression type, before rewriting"),
+          labels),
+        sm::make_counter(
+          "compaction_recompressed_bytes_out",
+          [this] { return _recompression_bytes_out; },
+          sm::description("Size of the batches rewritten by compaction with "
+                          "the topic's compression type, after rewriting"),
+          labels),
+        sm::make_counter(
+          "compaction_recompression_seconds",
+          [this] {
+              return std::chrono::duration<double>(_recompression_time)
+                .count();
+          },
+          sm::description("Time spent compressing batches rewritten by "
+                          "compaction with the topic's compression type"),
+          labels),
         sm::make_gauge(
           "partition_size",
           [this] { return _partition_bytes; },
@@ -203,6 +378,13 @@ void readers_cache_probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _readers_evicted; },
           sm::description("Number of readers evicted from cache"),
           labels),
+        sm::make_counter(
+          "readers_evicted_over_budget",
+          [this] { return _readers_evicted_over_budget; },
+          sm::description(
+            "Number of readers evicted from cache to keep the memory of "
+            "inactive readers within budget"),
+          labels),
         sm::make_counter(
           "cache_hits",
           [this] { return _cache_hits; },
@@ -49,6 +49,65 @@ private:
     metrics::public_metric_groups _public_metrics;
 };
 
+// Per-shard probe of the segment flush_coordinator.
+class flush_coordinator_probe {
+public:
+    void flush_requested() { ++_flush_requests; }
+    void flush_dispatched() { ++_flushes_dispatched; }
+
+    void setup_metrics();
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    uint64_t _flush_requests = 0;
+    uint64_t _flushes_dispatched = 0;
+    metrics::internal_metric_groups _metrics;
+};
+
+// Per-shard probe of the log recoveries done when the logs are opened.
+class log_recovery_probe {
+public:
+    void recovery_started() { ++_active; }
+    void recovery_finished() { --_active; }
+    void log_recovered(size_t segments) {
+        ++_recovered;
+        _segments_recovered += segments;
+    }
+    void prioritized_recovery() { ++_prioritized; }
+
+    void setup_metrics(const storage_resources&);
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    uint64_t _active = 0;
+    uint64_t _recovered = 0;
+    uint64_t _prioritized = 0;
+    uint64_t _segments_recovered = 0;
+    metrics::internal_metric_groups _metrics;
+};
+
+// Per-shard probe of the adaptive read-ahead of segment readers, reporting
+// the statistics of the shard read_ahead_budget.
+class read_ahead_probe {
+public:
+    void setup_metrics(const read_ahead_budget&);
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    metrics::internal_metric_groups _metrics;
+};
+
+// Per-shard probe of the DMA writes of the segment appenders, reporting the
+// statistics of the shard storage_resources.
+class dma_write_probe {
+public:
+    void setup_metrics(const storage_resources&);
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    metrics::internal_metric_groups _metrics;
+};
+
 // Per-NTP probe.
 class probe {
 public:
@@ -84,6 +143,13 @@ public:
     void initial_segments_count(size_t cnt) { _log_segments_active = cnt; }
 
     void segment_compacted() { ++_segment_compacted; }
+
+    void batch_recompressed(
+      size_t bytes_in, size_t bytes_out, std::chrono::nanoseconds took) {
+        _recompression_bytes_in += bytes_in;
+        _recompression_bytes_out += bytes_out;
+        _recompression_time += took;
+    }
     auto get_segments_compacted() const { return _segment_compacted; }
 
     void batch_write_error(const std::exception_ptr& e) {
@@ -131,6 +197,9 @@ private:
     uint32_t _batch_parse_errors = 0;
     uint32_t _batch_write_errors = 0;
     double _compaction_ratio = 1.0;
+    uint64_t _recompression_bytes_in = 0;
+    uint64_t _recompression_bytes_out = 0;
+    std::chrono::nanoseconds _recompression_time{0};
     metrics::internal_metric_groups _metrics;
 };
 } // namespace storage
@@ -0,0 +1,127 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/read_ahead.h"
+
+#include "config/configuration.h"
+#include "storage/logger.h"
+#include "vlog.h"
+
+#include <algorithm>
+
+namespace storage {
+
+read_ahead_budget::read_ahead_budget(size_t capacity)
+  : _capacity(capacity)
+  , _sem(capacity, "s/read-ahead") {}
+
+std::optional<ssx::semaphore_units>
+read_ahead_budget::try_reserve(size_t bytes) {
+    return ss::try_get_units(_sem, bytes);
+}
+
+void read_ahead_budget::record_adjustment(unsigned before, unsigned after) {
+    if (after > before) {
+        ++_stats.grown;
+    } else {
+        ++_stats.shrunk;
+    }
+}
+
+adaptive_read_ahead::adaptive_read_ahead(
+  unsigned configured, size_t buffer_size) noexcept
+  : _configured(configured)
+  , _buffer_size(buffer_size)
+  , _current(configured) {
+    if (internal::shard_read_ahead_budget().enabled()) {
+        _history = ss::make_lw_shared<ss::file_input_stream_history>();
+    }
+}
+
+uint64_t adaptive_read_ahead::observe() {
+    if (!_history) {
+        return 0;
+    }
+    const auto& h = *_history;
+    uint64_t read = 0;
+    uint64_t wasted = 0;
+    if (h.current_window.total_read < _seen.total_read) {
+        // the window we saw last was rolled over into the previous one.
+        // reads of windows rolled over in between are not accounted.
+        read = h.previous_window.total_read - _seen.total_read
+               + h.current_window.total_read;
+        wasted = h.previous_window.unused_read - _seen.unused_read
+                 + h.current_window.unused_read;
+    } else {
+        read = h.current_window.total_read - _seen.total_read;
+        wasted = h.current_window.unused_read - _seen.unused_read;
+    }
+    _seen = h.current_window;
+    internal::shard_read_ahead_budget().record_reads(read, wasted);
+    return read;
+}
+
+adaptive_read_ahead::grant adaptive_read_ahead::next() {
+    if (!_history) {
+        return {.read_ahead = _configured};
+    }
+    auto& budget = internal::shard_read_ahead_budget();
+    _read_since_adjustment += observe();
+
+    // judge the access pattern once the streams of the reader read more than
+    // a full read-ahead since the last adjustment
+    const auto& h = *_history;
+    const auto total = h.current_window.total_read
+                       + h.previous_window.total_read;
+    const auto unused = h.current_window.unused_read
+                        + h.previous_window.unused_read;
+    const auto sample = _buffer_size * (std::max(_current, 1U) + 1);
+    if (total > 0 && _read_since_adjustment >= sample) {
+        const auto before = _current;
+        if (unused * 4 > total) {
+            _current /= 2;
+        } else if (unused * 16 < total) {
+            _current = std::min(
+              std::max(_current * 2, 1U), _configured * max_growth_factor);
+        }
+        if (_current != before) {
+            vlog(
+              stlog.trace,
+              "read-ahead {} -> {}, read {} bytes, {} unused",
+              before,
+              _current,
+              total,
+              unused);
+            budget.record_adjustment(before, _current);
+        }
+        _read_since_adjustment = 0;
+    }
+
+    grant g{.read_ahead = _current};
+    if (_current > _configured) {
+        g.units = budget.try_reserve((_current - _configured) * _buffer_size);
+        if (!g.units) {
+            budget.record_denied();
+            g.read_ahead = _configured;
+        }
+    }
+    return g;
+}
+
+namespace internal {
+
+read_ahead_budget& shard_read_ahead_budget() {
+    static thread_local read_ahead_budget budget(
+      config::shard_local_cfg().storage_read_readahead_budget());
+    return budget;
+}
+
+} // namespace internal
+
+} // namespace storage
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/fstream.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include <cstdint>
+#include <optional>
+
+namespace storage {
+
+/**
+ * Shard-wide accounting of the adaptive read-ahead of segment readers.
+ *
+ * Read-ahead beyond the configured storage_read_readahead_count is borrowed
+ * from a per-shard budget of bytes for as long as the stream issuing it is
+ * open, so that a burst of catch-up scans cannot grow the read-ahead of the
+ * shard without bound. The budget also collects the bytes read by the file
+ * streams and the bytes they read ahead but never consumed.
+ */
+class read_ahead_budget {
+public:
+    struct stats {
+        uint64_t read_bytes{0};
+        uint64_t wasted_bytes{0};
+        uint64_t grown{0};
+        uint64_t shrunk{0};
+        uint64_t denied{0};
+    };
+
+    /// A capacity of zero disables the adaptive read-ahead.
+    explicit read_ahead_budget(size_t capacity);
+
+    bool enabled() const { return _capacity > 0; }
+    size_t capacity() const { return _capacity; }
+    size_t reserved() const { return _capacity - _sem.available_units(); }
+
+    /// Reserve \p bytes of read-ahead until the units are released, or
+    /// std::nullopt when the budget is exhausted.
+    std::optional<ssx::semaphore_units> try_reserve(size_t bytes);
+
+    void record_reads(uint64_t read, uint64_t wasted) {
+        _stats.read_bytes += read;
+        _stats.wasted_bytes += wasted;
+    }
+    void record_adjustment(unsigned before, unsigned after);
+    void record_denied() { ++_stats.denied; }
+
+    const stats& get_stats() const { return _stats; }
+
+private:
+    size_t _capacity;
+    ssx::semaphore _sem;
+    stats _stats;
+};
+
+/**
+ * The read-ahead of the file streams of a single segment reader.
+ *
+ * The streams of the reader share a seastar input stream history, in which
+ * they record the bytes they read and the bytes they read ahead and dropped
+ * unused on close. Every new stream derives its read-ahead from that history:
+ * readers that consume nearly everything they read ahead (sequential scans)
+ * double it, up to max_growth_factor times the configured count and within
+ * the shard budget, and readers that waste a large share of it (tail readers
+ * and random access) halve it, down to no read-ahead at all.
+ */
+class adaptive_read_ahead {
+public:
+    static constexpr unsigned max_growth_factor = 4;
+
+    struct grant {
+        unsigned read_ahead;
+        // budget borrowed beyond the configured count, held by the stream
+        std::optional<ssx::semaphore_units> units;
+    };
+
+    adaptive_read_ahead(unsigned configured, size_t buffer_size) noexcept;
+
+    /// The read-ahead of the next stream of the reader.
+    grant next();
+
+    /// The history to share with the file stream, null when the adaptive
+    /// read-ahead is disabled.
+    const ss::lw_shared_ptr<ss::file_input_stream_history>& history() const {
+        return _history;
+    }
+
+    /// Account the reads recorded in the history since the last call into
+    /// the shard budget statistics. Returns the bytes read since then.
+    uint64_t observe();
+
+    unsigned current() const { return _current; }
+
+private:
+    unsigned _configured;
+    size_t _buffer_size;
+    unsigned _current;
+    ss::lw_shared_ptr<ss::file_input_stream_history> _history;
+    // the current window of the history as of the last observe()
+    ss::file_input_stream_history::window _seen;
+    // bytes read since the read-ahead was last adjusted
+    uint64_t _read_since_adjustment{0};
+};
+
+namespace internal {
+
+/**
+ * The shard-local read-ahead budget. Sized by the
+ * `storage_read_readahead_budget` property at first use.
+ */
+read_ahead_budget& shard_read_ahead_budget();
+
+} // namespace internal
+
+} // namespace storage
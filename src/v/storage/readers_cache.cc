@@ -10,6 +10,7 @@
  */
 #include "storage/readers_cache.h"
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "ssx/future-util.h"
 #include "storage/types.h"
@@ -25,11 +26,23 @@
 
 namespace storage {
 
+struct readers_cache::shard_budget {
+    intrusive_list<readers_cache, &readers_cache::_budget_hook> caches;
+    // estimated memory of the inactive readers of all the caches
+    size_t idle_bytes{0};
+};
+
+readers_cache::shard_budget& readers_cache::local_budget() {
+    static thread_local shard_budget budget;
+    return budget;
+}
+
 readers_cache::readers_cache(
   model::ntp ntp, std::chrono::milliseconds eviction_timeout)
   : _ntp(std::move(ntp))
   , _eviction_timeout(eviction_timeout) {
     _probe.setup_metrics(_ntp);
+    local_budget().caches.push_back(*this);
     // setup eviction timer
     _eviction_timer.set_callback([this] {
         ssx::spawn_with_gate(_gate, [this] {
@@ -110,6 +123,7 @@ readers_cache::get_reader(const log_reader_config& cfg) {
                                     == cfg.start_offset;
         // if invalid we will dispose this entry in background
         if (!is_valid) {
+            remove_idle(*it);
             it = _readers.erase_and_dispose(
               it, [&to_evict](entry* e) { to_evict.push_back(*e); });
             continue;
@@ -133,9 +147,11 @@ readers_cache::get_reader(const log_reader_config& cfg) {
     vlog(stlog.trace, "{} - reader cache hit for: {}", _ntp, cfg);
     it->reader->reset_config(cfg);
     _probe.cache_hit();
+    ++e.hits;
 
     // we use cached_reader wrapper to track reader usage, when cached_reader is
     // destroyed we unlock reader and trigger eviction
+    remove_idle(e);
     e._hook.unlink();
     _in_use.push_back(e);
     return e.make_cached_reader(this);
@@ -167,9 +183,11 @@ ss::future<> readers_cache::stop() {
     for (auto& r : _readers) {
         co_await r.reader->finally();
     }
-    _readers.clear_and_dispose([](entry* e) {
+    _readers.clear_and_dispose([this](entry* e) {
+        remove_idle(*e);
         delete e; // NOLINT
     });
+    _budget_hook.unlink();
     /**
      * Stop and clear metrics as well or risk a double registrion on partition
      * movements. For details see
@@ -332,6 +350,71 @@ void readers_cache::dispose_in_background(entry* e) {
     }
 }
 
+void readers_cache::add_idle(entry& e) {
+    e.last_used = ss::lowres_clock::now();
+    e.cost = std::max<size_t>(e.reader->memory_estimate(), 1);
+    _readers.push_back(e);
+    local_budget().idle_bytes += e.cost;
+}
+
+void readers_cache::remove_idle(entry& e) {
+    local_budget().idle_bytes -= e.cost;
+    e.cost = 0;
+}
+
+void readers_cache::enforce_memory_budget() {
+    auto& budget = local_budget();
+    const size_t limit
+      = config::shard_local_cfg().readers_cache_memory_budget();
+    while (budget.idle_bytes > limit) {
+        readers_cache* victim_cache = nullptr;
+        entry* victim = nullptr;
+        // the reader reused least per byte, the oldest one among equals
+        auto less_valuable = [](const entry& a, const entry& b) {
+            const auto a_score = static_cast<double>(a.hits + 1)
+                                 / static_cast<double>(a.cost);
+            const auto b_score = static_cast<double>(b.hits + 1)
+                                 / static_cast<double>(b.cost);
+            if (a_score != b_score) {
+                return a_score < b_score;
+            }
+            return a.last_used < b.last_used;
+        };
+        for (auto& c : budget.caches) {
+            if (c._gate.is_closed()) {
+                continue;
+            }
+            for (auto& e : c._readers) {
+                if (e.cost == 0) {
+                    continue;
+                }
+                if (victim == nullptr || less_valuable(e, *victim)) {
+                    victim_cache = &c;
+                    victim = &e;
+                }
+            }
+        }
+        if (victim == nullptr) {
+            return;
+        }
+        vlog(
+          stlog.trace,
+          "{} - evicting reader over memory budget, cost: {} hits: {}",
+          victim_cache->_ntp,
+          victim->cost,
+          victim->hits);
+        victim_cache->evict_idle(*victim);
+    }
+}
+
+void readers_cache::evict_idle(entry& e) {
+    remove_idle(e);
+    e.valid = false;
+    e._hook.unlink();
+    _probe.reader_evicted_over_budget();
+    dispose_in_background(&e);
+}
+
 ss::future<> readers_cache::maybe_evict() {
     auto now = ss::lowres_clock::now();
     co_await evict_if([this, now](entry& e) {
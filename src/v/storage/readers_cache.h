@@ -32,6 +32,12 @@ namespace storage {
  * interface to force readers eviction in face of truncation and segments
  * removal. Readers are evicted from the cache according to LRU policy and
  * automatically when they can not longer be reused (f.e. EOF).
+ *
+ * The buffers of the inactive readers of all the caches of a shard are
+ * bounded by the `readers_cache_memory_budget` property. When the budget is
+ * exceeded the inactive reader with the fewest reuses per byte of estimated
+ * memory is evicted, whichever partition it belongs to, so that a burst of
+ * cold readers does not push out the readers of the hot partitions.
  */
 class readers_cache {
 public:
@@ -96,11 +102,8 @@ public:
 private:
     friend struct readers_cache_test_fixture;
     struct entry;
-    void touch(entry* e) {
-        e->last_used = ss::lowres_clock::now();
-        e->_hook.unlink();
-        _readers.push_back(*e);
-    };
+    struct shard_budget;
+    static shard_budget& local_budget();
 
     /**
      * Entry kept in lru readers list
@@ -109,6 +112,11 @@ private:
         model::record_batch_reader make_cached_reader(readers_cache*);
         std::unique_ptr<log_reader> reader;
         ss::lowres_clock::time_point last_used = ss::lowres_clock::now();
+        // number of times the reader was reused
+        uint64_t hits{0};
+        // estimated memory accounted in the shard budget while the reader is
+        // inactive, zero otherwise
+        size_t cost{0};
         bool valid = true;
         intrusive_list_hook _hook;
     };
@@ -134,7 +142,8 @@ private:
              * requested to be evicted
              */
             if (_e->reader->is_reusable() && _e->valid) {
-                _cache->_readers.push_back(*_e);
+                _cache->add_idle(*_e);
+                _cache->enforce_memory_budget();
             } else {
                 _cache->dispose_in_background(_e);
             }
@@ -147,6 +156,12 @@ private:
     };
 
     ss::future<> maybe_evict();
+    // moves an entry to, or out of, the inactive readers list, accounting
+    // its memory in the shard budget
+    void add_idle(entry&);
+    void remove_idle(entry&);
+    void enforce_memory_budget();
+    void evict_idle(entry&);
     ss::future<> dispose_entries(intrusive_list<entry, &entry::_hook>);
     void dispose_in_background(intrusive_list<entry, &entry::_hook>);
     void dispose_in_background(entry* e);
@@ -160,6 +175,7 @@ private:
             if (should_evict) {
                 // marking reader as invlid to prevent any further use
                 it->valid = false;
+                remove_idle(*it);
                 it = _readers.erase_and_dispose(
                   it, [&to_evict](entry* e) { to_evict.push_back(*e); });
             } else {
@@ -194,5 +210,7 @@ private:
      */
     std::vector<offset_range> _locked_offset_ranges;
     ss::condition_variable _in_use_reader_destroyed;
+    // links the cache into the shard budget
+    intrusive_list_hook _budget_hook;
 };
 } // namespace storage
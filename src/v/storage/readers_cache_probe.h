@@ -13,6 +13,7 @@ class readers_cache_probe {
 public:
     void reader_added() { _readers_added++; }
     void reader_evicted() { _readers_evicted++; }
+    void reader_evicted_over_budget() { _readers_evicted_over_budget++; }
     void cache_hit() { _cache_hits++; }
     void cache_miss() { _cache_misses++; }
     void clear() { _metrics.clear(); }
@@ -22,6 +23,7 @@ public:
 private:
     uint64_t _readers_added{0};
     uint64_t _readers_evicted{0};
+    uint64_t _readers_evicted_over_budget{0};
     uint64_t _cache_misses{0};
     uint64_t _cache_hits{0};
 
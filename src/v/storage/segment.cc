@@ -79,6 +79,7 @@ void segment::check_segment_not_closed(const char* msg) {
 ss::future<> segment::close() {
     check_segment_not_closed("closed()");
     set_close();
+    release_upload_buffer();
     /**
      * close() is considered a destructive operation. All future IO on this
      * segment is unsafe. write_lock() ensures that we want for any active
@@ -204,12 +205,30 @@ ss::future<size_t> segment::remove_persistent_state() {
     co_return co_await ss::map_reduce(
       rm,
       [this](std::filesystem::path path) {
+          if (path == std::filesystem::path(reader().path())) {
+              return recycle_data_file(std::move(path));
+          }
           return remove_persistent_state(std::move(path));
       },
       size_t(0),
       std::plus<>());
 }
 
+ss::future<size_t> segment::recycle_data_file(std::filesystem::path path) {
+    std::optional<size_t> file_size;
+    try {
+        file_size = co_await ss::file_size(path.c_str());
+    } catch (...) {
+        // missing file, or unable to stat: the removal deals with it
+    }
+    if (
+      file_size
+      && co_await _resources.get_segment_file_pool().recycle(path)) {
+        co_return *file_size;
+    }
+    co_return co_await remove_persistent_state(std::move(path));
+}
+
 ss::future<> segment::do_close() {
     auto f = _reader->close();
     if (_appender) {
@@ -390,6 +409,16 @@ ss::future<> segment::do_truncate(
       new_max_offset);
     _generation_id++;
     cache_truncate(new_max_offset + model::offset(1));
+    if (_upload_buffer) {
+        auto& buf = *_upload_buffer;
+        if (physical <= buf.base) {
+            release_upload_buffer();
+        } else if (physical < buf.base + buf.data.size_bytes()) {
+            auto n = buf.base + buf.data.size_bytes() - physical;
+            buf.data.trim_back(n);
+            buf.units.return_units(n);
+        }
+    }
     auto f = ss::now();
     if (is_compacted_segment()) {
         // if compaction index is opened close it
@@ -438,6 +467,7 @@ ss::future<bool> segment::materialize_index() {
             _tracker.committed_offset = _idx.max_offset();
             _tracker.stable_offset = _idx.max_offset();
             _tracker.dirty_offset = _idx.max_offset();
+            mark_index_used();
         }
         return yn;
     });
@@ -515,6 +545,9 @@ ss::future<append_result> segment::do_append(const model::record_batch& b) {
     }
     const auto start_physical_offset = _appender->file_byte_offset();
     _generation_id++;
+    if (_upload_buffer) {
+        upload_buffer_append(b, start_physical_offset);
+    }
     // proxy serialization to segment_appender
     auto write_fut = _appender->append(b).then(
       [this, &b, start_physical_offset] {
@@ -534,7 +567,7 @@ ss::future<append_result> segment::do_append(const model::record_batch& b) {
           _inflight.emplace(end_physical_offset, b.last_offset());
           // index the write
           _idx.maybe_track(
-            b.header(), ss::lowres_system_clock::now(), start_physical_offset);
+            b, ss::lowres_system_clock::now(), start_physical_offset);
           auto ret = append_result{
             .base_offset = b.base_offset(),
             .last_offset = b.last_offset(),
@@ -563,6 +596,8 @@ ss::future<append_result> segment::do_append(const model::record_batch& b) {
               return std::move(append_fut);
           }
           if (append_fut.failed()) {
+              // the buffer may have bytes which didn't make it to the file
+              release_upload_buffer();
               auto append_err = std::move(append_fut).get_exception();
               vlog(stlog.error, "segment::append failed: {}", append_err);
               if (index_fut.failed()) {
@@ -613,7 +648,12 @@ ss::future<append_result> segment::append(model::record_batch&& b) {
 ss::future<segment_reader_handle>
 segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
     check_segment_not_closed("offset_data_stream()");
+    if (!_idx.is_loaded()) {
+        co_await _idx.load();
+        check_segment_not_closed("offset_data_stream()");
+    }
     auto nearest = _idx.find_nearest(o);
+    mark_index_used();
     size_t position = 0;
     if (nearest) {
         position = nearest->filepos;
@@ -623,7 +663,20 @@ segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
     // size) (https://github.com/redpanda-data/redpanda/issues/2101)
     vassert(position < size_bytes(), "Index points beyond file size");
 
-    return _reader->data_stream(position, iopc);
+    co_return co_await _reader->data_stream(position, iopc);
+}
+
+ss::future<> segment::load_index() {
+    co_await _idx.load();
+    mark_index_used();
+}
+
+void segment::mark_index_used() {
+    // the index of an active segment keeps changing, it is tracked once the
+    // segment is closed for appends
+    if (!_appender) {
+        _resources.get_segment_index_lru().touch(_idx);
+    }
 }
 
 void segment::advance_stable_offset(size_t filepos) {
@@ -648,6 +701,67 @@ void segment::advance_stable_offset(size_t filepos) {
     clear_cached_disk_usage();
 }
 
+void segment::enable_upload_buffer() {
+    if (_upload_buffer || !_appender || is_closed()) {
+        return;
+    }
+    _upload_buffer.emplace(
+      upload_buffer{.base = _appender->file_byte_offset()});
+}
+
+void segment::release_upload_buffer() { _upload_buffer.reset(); }
+
+void segment::upload_buffer_append(
+  const model::record_batch& b, size_t start_physical_offset) {
+    auto& buf = *_upload_buffer;
+    if (buf.base + buf.data.size_bytes() != start_physical_offset) {
+        // cannot happen as appends are sequential, but a gap in the copy
+        // would upload the wrong bytes
+        vlog(stlog.warn, "Upload buffer out of sync with {}", *this);
+        release_upload_buffer();
+        return;
+    }
+    auto units = _resources.upload_buffer_take_bytes(b.header().size_bytes);
+    if (!units) {
+        vlog(stlog.debug, "Out of upload buffer memory, releasing {}", *this);
+        release_upload_buffer();
+        return;
+    }
+    if (buf.units.count()) {
+        buf.units.adopt(std::move(*units));
+    } else {
+        buf.units = std::move(*units);
+    }
+    buf.data.append(disk_header_to_iobuf(b.header()));
+    buf.data.append(b.data().copy());
+}
+
+void segment::trim_upload_buffer(size_t pos) {
+    if (!_upload_buffer || pos <= _upload_buffer->base) {
+        return;
+    }
+    auto& buf = *_upload_buffer;
+    auto n = std::min(pos - buf.base, buf.data.size_bytes());
+    if (n > 0) {
+        buf.data.trim_front(n);
+        buf.units.return_units(n);
+        buf.base += n;
+    }
+    if (buf.data.empty() && !_appender) {
+        release_upload_buffer();
+    }
+}
+
+std::optional<iobuf> segment::upload_buffer_range(size_t begin, size_t end) {
+    if (
+      !_upload_buffer || begin < _upload_buffer->base || end < begin
+      || end > _upload_buffer->base + _upload_buffer->data.size_bytes()) {
+        return std::nullopt;
+    }
+    return _upload_buffer->data.share(
+      begin - _upload_buffer->base, end - begin);
+}
+
 std::ostream& operator<<(std::ostream& o, const segment::offset_tracker& t) {
     fmt::print(
       o,
@@ -760,7 +874,8 @@ ss::future<ss::lw_shared_ptr<segment>> make_segment(
   std::optional<batch_cache_index> batch_cache,
   storage_resources& resources,
   ss::sharded<features::feature_table>& feature_table,
-  std::optional<ntp_sanitizer_config> ntp_sanitizer_config) {
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config,
+  size_t preallocated_bytes) {
     auto path = segment_full_path(ntpc, base_offset, term, version);
     vlog(stlog.info, "Creating new segment {}", path);
     return open_segment(
@@ -771,11 +886,20 @@ ss::future<ss::lw_shared_ptr<segment>> make_segment(
              resources,
              feature_table,
              ntp_sanitizer_config)
-      .then([path, &ntpc, pc, &resources, ntp_sanitizer_config](
-              ss::lw_shared_ptr<segment> seg) mutable {
+      .then([path,
+             &ntpc,
+             pc,
+             &resources,
+             ntp_sanitizer_config,
+             preallocated_bytes](ss::lw_shared_ptr<segment> seg) mutable {
           return with_segment(
             std::move(seg),
-            [path, &ntpc, pc, &resources, ntp_sanitizer_config](
+            [path,
+             &ntpc,
+             pc,
+             &resources,
+             ntp_sanitizer_config,
+             preallocated_bytes](
               const ss::lw_shared_ptr<segment>& seg) mutable {
                 return internal::make_segment_appender(
                          path,
@@ -783,7 +907,8 @@ ss::future<ss::lw_shared_ptr<segment>> make_segment(
                          internal::segment_size_from_config(ntpc),
                          pc,
                          resources,
-                         std::move(ntp_sanitizer_config))
+                         std::move(ntp_sanitizer_config),
+                         preallocated_bytes)
                   .then([seg, &resources](segment_appender_ptr a) {
                       return ss::make_ready_future<ss::lw_shared_ptr<segment>>(
                         ss::make_lw_shared<segment>(
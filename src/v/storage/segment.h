@@ -11,11 +11,14 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
+#include "ssx/semaphore.h"
 #include "storage/batch_cache.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
 #include "storage/fwd.h"
+#include "storage/key_set_summary.h"
 #include "storage/segment_appender.h"
 #include "storage/segment_index.h"
 #include "storage/segment_reader.h"
@@ -26,6 +29,7 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/rwlock.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/shared_ptr.hh>
 
 #include <exception>
 #include <optional>
@@ -103,6 +107,9 @@ public:
     ss::future<append_result> append(const model::record_batch&);
     ss::future<append_result> do_append(const model::record_batch&);
     ss::future<bool> materialize_index();
+    /// Load the index if it was unloaded to save memory and mark it as
+    /// recently used, indices of the active segments are always loaded.
+    ss::future<> load_index();
 
     /// main read interface
     ss::future<segment_reader_handle>
@@ -132,6 +139,29 @@ public:
     /// metadata.
     bool may_have_compactible_records() const;
 
+    /// \brief Summary of the keys in the segment's compaction index, if one
+    /// was built by a previous compaction. Dropped when the data file is
+    /// swapped, since the new data may contain keys the summary does not.
+    const ss::lw_shared_ptr<const key_set_summary>& key_summary() const {
+        return _key_summary;
+    }
+    void set_key_summary(ss::lw_shared_ptr<const key_set_summary> s) {
+        _key_summary = std::move(s);
+    }
+
+    /// \brief Keep a copy of the bytes appended to the segment from now on,
+    /// so that the tiered storage upload of the segment doesn't read them
+    /// back from disk. The copy is dropped when the memory of the upload
+    /// buffers of the shard runs out, or the data file is rewritten.
+    void enable_upload_buffer();
+    void release_upload_buffer();
+    /// Release the buffered bytes before file position \p pos, e.g. after
+    /// they were uploaded.
+    void trim_upload_buffer(size_t pos);
+    /// The bytes [begin, end) of the data file, if they are all buffered
+    std::optional<iobuf> upload_buffer_range(size_t begin, size_t end);
+    bool has_upload_buffer() const { return _upload_buffer.has_value(); }
+
     // low level api's are discouraged and might be deprecated
     // please use higher level API's when possible
     segment_reader& reader();
@@ -165,7 +195,9 @@ public:
       std::optional<model::timestamp> first_ts,
       size_t max_bytes,
       bool skip_lru_promote);
-    void cache_put(const model::record_batch& batch);
+    void cache_put(
+      const model::record_batch& batch,
+      batch_cache::disk_read read = batch_cache::disk_read::no);
 
     ss::future<ss::rwlock::holder> read_lock(
       ss::semaphore::time_point timeout = ss::semaphore::time_point::max());
@@ -225,6 +257,8 @@ private:
     void release_appender_in_background(readers_cache* readers_cache);
 
     ss::future<size_t> remove_persistent_state(std::filesystem::path);
+    // hands the data file to the segment_file_pool, or removes it
+    ss::future<size_t> recycle_data_file(std::filesystem::path);
 
     struct appender_callbacks : segment_appender::callbacks {
         explicit appender_callbacks(segment* segment)
@@ -242,6 +276,9 @@ private:
     appender_callbacks _appender_callbacks;
 
     void advance_stable_offset(size_t offset);
+    void mark_index_used();
+    void upload_buffer_append(
+      const model::record_batch&, size_t start_physical_offset);
     /**
      * Generation id is incremented every time the destructive operation is
      * executed on the segment, it is used when atomically swapping the staging
@@ -267,8 +304,18 @@ private:
     // size of the compaction index is needed (e.g. estimating total seg size).
     std::optional<size_t> _compaction_index_size;
     std::optional<compacted_index_writer> _compaction_index;
+    ss::lw_shared_ptr<const key_set_summary> _key_summary;
 
     std::optional<batch_cache_index> _cache;
+
+    struct upload_buffer {
+        // file position of the first buffered byte
+        size_t base{0};
+        iobuf data;
+        ssx::semaphore_units units;
+    };
+    std::optional<upload_buffer> _upload_buffer;
+
     ss::rwlock _destructive_ops;
     ss::gate _gate;
 
@@ -317,7 +364,8 @@ ss::future<ss::lw_shared_ptr<segment>> make_segment(
   std::optional<batch_cache_index> batch_cache,
   storage_resources&,
   ss::sharded<features::feature_table>& feature_table,
-  std::optional<ntp_sanitizer_config> ntp_sanitizer_config);
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config,
+  size_t preallocated_bytes = 0);
 
 // bitflags operators
 [[gnu::always_inline]] inline segment::bitflags
@@ -427,9 +475,10 @@ inline batch_cache_index::read_result segment::cache_get(
       .next_batch = offset,
     };
 }
-inline void segment::cache_put(const model::record_batch& batch) {
+inline void segment::cache_put(
+  const model::record_batch& batch, batch_cache::disk_read read) {
     if (likely(bool(_cache))) {
-        _cache->put(batch);
+        _cache->put(batch, read);
     }
 }
 inline ss::future<ss::rwlock::holder>
@@ -449,7 +498,10 @@ inline bool segment::is_closed() const {
 }
 inline segment_reader& segment::reader() { return *_reader; }
 inline void segment::swap_reader(segment_reader_ptr new_reader) {
+    // the buffered bytes are those of the replaced data file
+    release_upload_buffer();
     std::swap(new_reader, _reader);
+    _key_summary = nullptr;
 }
 inline segment_reader_ptr segment::release_segment_reader() {
     return std::move(_reader);
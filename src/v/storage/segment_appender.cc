@@ -28,6 +28,7 @@
 
 #include <optional>
 #include <ostream>
+#include <utility>
 
 namespace storage {
 
@@ -58,10 +59,10 @@ static constexpr auto head_sem_name = "s/appender-head";
 segment_appender::segment_appender(ss::file f, options opts)
   : _out(std::move(f))
   , _opts(opts)
+  , _fallocation_offset(opts.preallocated_bytes)
   , _concurrent_flushes(ss::semaphore::max_counter(), "s/append-flush")
   , _prev_head_write(ss::make_lw_shared<ssx::semaphore>(1, head_sem_name))
-  , _inactive_timer([this] { handle_inactive_timer(); })
-  , _chunk_size(internal::chunks().chunk_size()) {
+  , _inactive_timer([this] { handle_inactive_timer(); }) {
     const auto alignment = _out.disk_write_dma_alignment();
     vassert(
       internal::chunk_cache::alignment % alignment == 0,
@@ -105,7 +106,7 @@ segment_appender::segment_appender(segment_appender&& o) noexcept
   , _merged_writes(std::exchange(o._merged_writes, 0))
   , _callbacks(std::exchange(o._callbacks, nullptr))
   , _inactive_timer([this] { handle_inactive_timer(); })
-  , _chunk_size(o._chunk_size) {
+  , _filled_chunks(o._filled_chunks) {
     o._closed = true;
 }
 
@@ -181,7 +182,7 @@ ss::future<> segment_appender::do_append(const char* buf, size_t n) {
         auto units = co_await ss::get_units(_concurrent_flushes, 1);
         units.return_all();
 
-        auto chunk = co_await internal::chunks().get();
+        auto chunk = co_await next_head_chunk();
         vassert(!_head, "cannot overwrite existing chunk");
         _head = std::move(chunk);
 
@@ -190,12 +191,23 @@ ss::future<> segment_appender::do_append(const char* buf, size_t n) {
     }
 }
 
+ss::future<segment_appender::chunk_ptr> segment_appender::next_head_chunk() {
+    if (_filled_chunks >= large_chunk_threshold) {
+        if (auto c = internal::chunks().get_large(); c) {
+            ++_opts.resources.get_dma_write_stats().large_chunks;
+            return ss::make_ready_future<chunk_ptr>(std::move(c));
+        }
+    }
+    return internal::chunks().get();
+}
+
 void segment_appender::check_no_dispatched_writes() {
     vassert(
       _inflight_dispatched == 0, "Unexpected pending head write {}", *this);
 }
 
 void segment_appender::handle_inactive_timer() {
+    _filled_chunks = 0;
     if (_head && _head->bytes_pending()) {
         /*
          * this is the why the timer was originally set upon returning from
@@ -436,7 +448,8 @@ ss::future<> segment_appender::process_flush_ops(size_t committed) {
 
     _flush_ops.pop_back_n(std::distance(flushable, _flush_ops.end()));
 
-    return _out.flush().then([this, committed, ops = std::move(ops)]() mutable {
+    auto flushed = _opts.resources.get_flush_coordinator().flush(this, _out);
+    return flushed.then([this, committed, ops = std::move(ops)]() mutable {
         // Inflight_dispatched is incremented right before a write is dispatched
         // and then must be decremented when the write is "finished", where we
         // don't consider the write finished until any associated flush
@@ -496,6 +509,7 @@ void segment_appender::dispatch_background_head_write() {
     auto head_sem = _prev_head_write;
 
     if (entry.full) {
+        ++_filled_chunks;
         /*
          * If _head is full then this is the last write to this chunk, so we
          * clear out the head pointer synchronously here, then release it
@@ -520,6 +534,7 @@ void segment_appender::dispatch_background_head_write() {
         // been dispatched to the disk) so we just append this write
         // to that entry.
         ++_merged_writes;
+        ++_opts.resources.get_dma_write_stats().merged;
         return;
     }
 
@@ -540,15 +555,25 @@ void segment_appender::dispatch_background_head_write() {
       1,
       [w, this, head_sem, units = std::move(units)]() mutable {
           return units
-            .then([this, w](ssx::semaphore_units u) mutable {
+            .then([this](ssx::semaphore_units u) {
+                // writes are sequenced on the head semaphore before they
+                // queue for the device, so they are submitted in order
+                return _opts.resources.get_dma_write_units().then(
+                  [u = std::move(u)](ssx::semaphore_units depth) mutable {
+                      return std::make_pair(std::move(u), std::move(depth));
+                  });
+            })
+            .then([this, w](auto units) mutable {
+                auto [u, depth] = std::move(units);
                 const auto dma_size = w->chunk_end - w->chunk_begin;
+                const auto chunk_size = w->chunk->capacity();
 
                 vassert(
-                  dma_size <= _chunk_size && w->chunk_end > w->chunk_begin
-                    && w->chunk_end <= _chunk_size,
-                  "Bad write bounds _chunk_size: {}, chunk_begin: {}, "
+                  dma_size <= chunk_size && w->chunk_end > w->chunk_begin
+                    && w->chunk_end <= chunk_size,
+                  "Bad write bounds chunk_size: {}, chunk_begin: {}, "
                   "chunk_end: {}",
-                  _chunk_size,
+                  chunk_size,
                   w->chunk_begin,
                   w->chunk_end);
 
@@ -557,6 +582,9 @@ void segment_appender::dispatch_background_head_write() {
                 w->set_state(write_state::DISPATCHED);
                 ++_inflight_dispatched;
                 ++_dispatched_writes;
+                auto& stats = _opts.resources.get_dma_write_stats();
+                ++stats.dispatched;
+                ++stats.inflight;
 
                 return _out
 #pragma clang diagnostic push
@@ -567,7 +595,10 @@ void segment_appender::dispatch_background_head_write() {
                     dma_size,
                     _opts.priority)
 #pragma clang diagnostic pop
-                  .then([this, w](size_t got) {
+                  .then([this, w, depth = std::move(depth)](
+                          size_t got) mutable {
+                      depth.return_all();
+                      --_opts.resources.get_dma_write_stats().inflight;
                       /*
                        * the continuation that captured full=true is the end
                        * of the dependency chain for this chunk. it can be
@@ -75,6 +75,8 @@ public:
         // more space than a segment would ever need.
         std::optional<uint64_t> segment_size;
         storage_resources& resources;
+        // bytes already allocated in the file, e.g. by the segment_file_pool
+        size_t preallocated_bytes{0};
     };
 
     segment_appender(ss::file f, options opts);
@@ -153,6 +155,7 @@ private:
     using chunk_ptr = ss::lw_shared_ptr<chunk>;
 
     void dispatch_background_head_write();
+    ss::future<chunk_ptr> next_head_chunk();
     ss::future<> do_next_adaptive_fallocation();
     ss::future<> hydrate_last_half_page();
     ss::future<> do_truncation(size_t);
@@ -308,7 +311,11 @@ private:
     ss::timer<ss::lowres_clock> _inactive_timer;
     void handle_inactive_timer();
 
-    size_t _chunk_size{0};
+    // An appender which fills this many chunks in a row, without going idle,
+    // sustains a high append rate and switches to large chunks.
+    static constexpr size_t large_chunk_threshold = 2;
+    // The number of chunks filled since the appender was last idle
+    size_t _filled_chunks{0};
 
     // Bit-map tracking the types of batches in the `_head` chunk that have
     // not been written to disk yet.
@@ -49,6 +49,7 @@ public:
     alignment alignment() const { return _alignment; }
     size_t space_left() const { return _chunk_size - _pos; }
     size_t size() const { return _pos; }
+    size_t capacity() const { return _chunk_size; }
 
     /// \brief size() aligned to the _alignment
     size_t dma_size() const {
@@ -9,6 +9,7 @@
 
 #include "storage/segment_deduplication_utils.h"
 
+#include "storage/compacted_index.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compaction_reducers.h"
 #include "storage/index_state.h"
@@ -30,7 +31,12 @@ ss::future<ss::stop_iteration> put_entry(
   const compacted_index::entry& idx_entry,
   bool& fully_indexed) {
     auto offset = idx_entry.offset + model::offset_delta(idx_entry.delta);
-    bool success = co_await map.put(idx_entry.key, offset);
+    // long keys are mapped by their fingerprint, whether or not the index
+    // stores fingerprints, so that maps built from indices with and without
+    // fingerprints are looked up the same way.
+    bool success = should_fingerprint_key(idx_entry.key)
+                     ? co_await map.put(fingerprint_key(idx_entry.key), offset)
+                     : co_await map.put(idx_entry.key, offset);
     if (success) {
         co_return ss::stop_iteration::no;
     }
@@ -46,6 +52,9 @@ ss::future<bool> should_keep(
     auto key_view = compaction_key{iobuf_to_bytes(r.key())};
     auto key = enhance_key(
       b.header().type, b.header().attrs.is_control(), key_view);
+    if (should_fingerprint_key(key)) {
+        key = fingerprint_key(key);
+    }
     auto latest_offset_indexed = co_await map.get(key);
     // If the map hasn't indexed the given key, we should keep the
     // key.
@@ -58,8 +67,41 @@ ss::future<bool> should_keep(
 }
 } // anonymous namespace
 
+key_overlap_tracker::key_overlap_tracker(const segment_set& segs) {
+    for (const auto& seg : segs) {
+        if (seg->key_summary()) {
+            _candidates.push_back(candidate{
+              .base_offset = seg->offsets().base_offset,
+              .summary = seg->key_summary(),
+            });
+        }
+    }
+}
+
+void key_overlap_tracker::add(model::offset base_offset, uint64_t key_hash) {
+    for (auto& c : _candidates) {
+        if (c.base_offset >= base_offset) {
+            break;
+        }
+        if (!c.overlaps && c.summary->may_contain(key_hash)) {
+            c.overlaps = true;
+        }
+    }
+}
+
+bool key_overlap_tracker::may_overlap(const segment& seg) const {
+    auto it = std::find_if(
+      _candidates.begin(), _candidates.end(), [&seg](const candidate& c) {
+          return c.base_offset == seg.offsets().base_offset;
+      });
+    return it == _candidates.end() || it->overlaps;
+}
+
 ss::future<bool> build_offset_map_for_segment(
-  const compaction_config& cfg, const segment& seg, key_offset_map& m) {
+  const compaction_config& cfg,
+  segment& seg,
+  key_offset_map& m,
+  key_overlap_tracker* overlaps) {
     auto compaction_idx_path = seg.path().to_compacted_index();
     auto compaction_idx_file = co_await internal::make_reader_handle(
       compaction_idx_path, cfg.sanitizer_config);
@@ -81,12 +123,29 @@ ss::future<bool> build_offset_map_for_segment(
           eptr);
         std::rethrow_exception(eptr);
     }
+    ss::lw_shared_ptr<key_set_summary> summary;
+    if (overlaps) {
+        auto footer = co_await rdr.load_footer();
+        summary = ss::make_lw_shared<key_set_summary>(footer.keys);
+    }
     bool fully_indexed = true;
+    const auto base_offset = seg.offsets().base_offset;
     co_await rdr.for_each_async(
-      [&m, &fully_indexed](const compacted_index::entry& idx_entry) {
+      [&m, &fully_indexed, &summary, overlaps, base_offset](
+        const compacted_index::entry& idx_entry) {
+          if (
+            overlaps
+            && idx_entry.type == compacted_index::entry_type::key) {
+              const auto h = key_set_summary::hash(idx_entry.key);
+              overlaps->add(base_offset, h);
+              summary->add(h);
+          }
           return put_entry(m, idx_entry, fully_indexed);
       },
       model::no_timeout);
+    if (summary && fully_indexed) {
+        seg.set_key_summary(std::move(summary));
+    }
     co_return fully_indexed;
 }
 
@@ -96,7 +155,8 @@ ss::future<model::offset> build_offset_map(
   ss::lw_shared_ptr<storage::stm_manager> stm_manager,
   storage_resources& resources,
   storage::probe& probe,
-  key_offset_map& m) {
+  key_offset_map& m,
+  key_overlap_tracker* overlaps) {
     if (segs.empty()) {
         throw std::runtime_error("No segments to build offset map");
     }
@@ -155,7 +215,7 @@ ss::future<model::offset> build_offset_map(
             to_clean->clear();
         }
         auto seg_fully_indexed = co_await build_offset_map_for_segment(
-          cfg, *seg, m);
+          cfg, *seg, m, overlaps);
         if (!seg_fully_indexed) {
             // The offset map is full. Note that we may have only partially
             // indexed a segment, but it's safe to use this index. If no new
@@ -201,7 +261,9 @@ ss::future<index_state> deduplicate_segment(
       seg->path().is_internal_topic(),
       should_offset_delta_times,
       seg->offsets().committed_offset,
-      &cmp_idx_writer);
+      &cmp_idx_writer,
+      cfg.target_compression,
+      &probe);
 
     auto new_idx = co_await rdr.consume(
       std::move(copy_reducer), model::no_timeout);
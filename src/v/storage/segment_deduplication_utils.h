@@ -12,17 +12,50 @@
 #include "seastarx.h"
 #include "storage/fwd.h"
 #include "storage/index_state.h"
+#include "storage/key_set_summary.h"
 #include "storage/segment_set.h"
 
+#include <vector>
+
 namespace storage {
 using segment_list_t = fragmented_vector<segment_set::type>;
 class stm_manager;
 
+// Tracks which segments of a sliding window may contain a key that is also
+// in a newer segment of the window, based on the key summaries that previous
+// compactions left on the segments. Segments without a summary are always
+// assumed to overlap.
+class key_overlap_tracker {
+public:
+    explicit key_overlap_tracker(const segment_set& segs);
+
+    // Record that a segment starting at \p base_offset has a key whose
+    // key_set_summary::hash is \p key_hash.
+    void add(model::offset base_offset, uint64_t key_hash);
+
+    bool may_overlap(const segment& seg) const;
+
+private:
+    struct candidate {
+        model::offset base_offset;
+        ss::lw_shared_ptr<const key_set_summary> summary;
+        bool overlaps{false};
+    };
+    // ordered by base offset
+    std::vector<candidate> _candidates;
+};
+
 // Adds the keys from the given compacted index reader to the map. Returns
 // true if the entire reader was successfully indexed, false if the index was
 // full before reaching the end of the segment.
+//
+// If \p overlaps is set, the keys are also recorded with it, and a key
+// summary is attached to the segment once it is fully indexed.
 ss::future<bool> build_offset_map_for_segment(
-  const compaction_config& cfg, const segment& seg, key_offset_map& m);
+  const compaction_config& cfg,
+  segment& seg,
+  key_offset_map& m,
+  key_overlap_tracker* overlaps = nullptr);
 
 // Builds a map from key to latest offset from the last segment to the
 // earliest segment in 'segs'.
@@ -45,7 +78,8 @@ ss::future<model::offset> build_offset_map(
   ss::lw_shared_ptr<storage::stm_manager> stm_manager,
   storage::storage_resources&,
   storage::probe&,
-  key_offset_map&);
+  key_offset_map&,
+  key_overlap_tracker* overlaps = nullptr);
 
 // Rewrites 'seg' according to the parameters in 'cfg' to 'appender' and
 // 'cmp_idx_writer', deduplicating with latest offsets per key from 'map'.
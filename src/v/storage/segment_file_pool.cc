@@ -0,0 +1,198 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/segment_file_pool.h"
+
+#include "ssx/future-util.h"
+#include "storage/logger.h"
+#include "storage/segment_utils.h"
+#include "utils/directory_walker.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/core/sleep.hh>
+
+#include <fmt/format.h>
+
+namespace storage {
+
+namespace {
+// best effort removal of a file the pool gives up on
+ss::future<> remove_quietly(const std::filesystem::path& path) {
+    try {
+        co_await ss::remove_file(path.string());
+    } catch (...) {
+        vlog(
+          stlog.debug,
+          "error removing pooled file {}: {}",
+          path,
+          std::current_exception());
+    }
+}
+} // namespace
+
+segment_file_pool::segment_file_pool(falloc_step_fn falloc_step)
+  : _falloc_step(std::move(falloc_step)) {}
+
+ss::future<>
+segment_file_pool::start(std::filesystem::path dir, size_t capacity) {
+    if (capacity == 0) {
+        co_return;
+    }
+    co_await ss::recursive_touch_directory(dir.string());
+    co_await directory_walker::walk(
+      dir.string(), [&dir](const ss::directory_entry& de) {
+          return ss::remove_file((dir / de.name.c_str()).string());
+      });
+    vlog(stlog.info, "Pooling up to {} segment files in {}", capacity, dir);
+    _dir = std::move(dir);
+    _capacity = capacity;
+    ssx::spawn_with_gate(_gate, [this] { return refill_loop(); });
+}
+
+ss::future<> segment_file_pool::stop() {
+    if (_gate.is_closed()) {
+        co_return;
+    }
+    auto f = _gate.close();
+    _as.request_abort();
+    _changed.broadcast();
+    co_await std::move(f);
+}
+
+std::filesystem::path segment_file_pool::next_path() {
+    return _dir / fmt::format("{}.log", _next_id++);
+}
+
+ss::future<std::optional<size_t>>
+segment_file_pool::take(const std::filesystem::path& path) {
+    if (!enabled()) {
+        co_return std::nullopt;
+    }
+    if (_ready.empty()) {
+        ++_stats.misses;
+        co_return std::nullopt;
+    }
+    auto holder = _gate.hold();
+    if (co_await ss::file_exists(path.string()) || _ready.empty()) {
+        co_return std::nullopt;
+    }
+    auto file = std::move(_ready.front());
+    _ready.pop_front();
+    _changed.signal();
+    try {
+        co_await ss::rename_file(file.path.string(), path.string());
+    } catch (...) {
+        // e.g. the segment is on another filesystem than the pool
+        vlog(
+          stlog.warn,
+          "Unable to move pooled file {} to {}: {}",
+          file.path,
+          path,
+          std::current_exception());
+        co_await remove_quietly(file.path);
+        co_return std::nullopt;
+    }
+    ++_stats.taken;
+    vlog(stlog.debug, "Took pooled file {} for {}", file.path, path);
+    co_return file.allocated;
+}
+
+ss::future<bool>
+segment_file_pool::recycle(const std::filesystem::path& path) {
+    if (!enabled() || _ready.size() + _recycled.size() >= _capacity) {
+        co_return false;
+    }
+    auto holder = _gate.hold();
+    auto target = next_path();
+    try {
+        co_await ss::rename_file(path.string(), target.string());
+    } catch (...) {
+        vlog(
+          stlog.debug,
+          "Unable to recycle {} into the segment pool: {}",
+          path,
+          std::current_exception());
+        co_return false;
+    }
+    ++_stats.recycled;
+    vlog(stlog.debug, "Recycled {} as {}", path, target);
+    _recycled.push_back(std::move(target));
+    _changed.signal();
+    co_return true;
+}
+
+ss::future<> segment_file_pool::refill_loop() {
+    while (!_gate.is_closed()) {
+        co_await _changed.wait(
+          [this] { return _gate.is_closed() || needs_refill(); });
+        if (_gate.is_closed()) {
+            break;
+        }
+        bool failed = false;
+        try {
+            co_await prepare_one();
+        } catch (...) {
+            vlog(
+              stlog.warn,
+              "Error preparing a pooled segment file: {}",
+              std::current_exception());
+            failed = true;
+        }
+        if (failed) {
+            // don't spin on a persistent error, e.g. a full disk
+            try {
+                co_await ss::sleep_abortable(std::chrono::seconds(5), _as);
+            } catch (const ss::sleep_aborted&) {
+            }
+        }
+    }
+}
+
+ss::future<> segment_file_pool::prepare_one() {
+    const bool recycled = !_recycled.empty();
+    std::filesystem::path path;
+    auto flags = ss::open_flags::rw | ss::open_flags::create;
+    if (recycled) {
+        path = std::move(_recycled.front());
+        _recycled.pop_front();
+        // drops the data of the removed segment
+        flags |= ss::open_flags::truncate;
+    } else {
+        path = next_path();
+        ++_stats.created;
+    }
+
+    const auto step = _falloc_step();
+    auto f = co_await internal::make_handle(
+      path, flags, ss::file_open_options{}, std::nullopt);
+    std::exception_ptr err;
+    try {
+        if (step > 0) {
+            co_await f.allocate(0, step);
+        }
+    } catch (...) {
+        err = std::current_exception();
+    }
+    co_await f.close();
+
+    if (err || _gate.is_closed() || _ready.size() >= _capacity) {
+        co_await remove_quietly(path);
+        if (err) {
+            std::rethrow_exception(err);
+        }
+        co_return;
+    }
+    _ready.push_back(pooled_file{.path = std::move(path), .allocated = step});
+}
+
+} // namespace storage
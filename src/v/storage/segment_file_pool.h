@@ -0,0 +1,120 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <optional>
+
+namespace storage {
+
+/**
+ * Shard-wide pool of pre-created segment data files.
+ *
+ * Creating the data file of a new segment and allocating its first extents
+ * happen on the append path at segment roll, and show up as append latency
+ * spikes on filesystems like XFS. The pool creates files ahead of time in a
+ * directory on the same filesystem as the segments, allocates their first
+ * fallocation step (keeping the file size at zero, like the appender does),
+ * and a segment roll only has to rename a pooled file into place.
+ *
+ * The data files of segments removed by retention are recycled: they are
+ * renamed into the pool and truncated and re-allocated in the background,
+ * which saves creating a new file for the next roll.
+ *
+ * The pool is disabled until started, and with a capacity of zero.
+ */
+class segment_file_pool {
+public:
+    using falloc_step_fn = ss::noncopyable_function<size_t()>;
+
+    struct stats {
+        uint64_t created{0};
+        uint64_t recycled{0};
+        uint64_t taken{0};
+        uint64_t misses{0};
+    };
+
+    /// \p falloc_step returns the number of bytes to allocate in a new file
+    explicit segment_file_pool(falloc_step_fn falloc_step);
+
+    segment_file_pool(const segment_file_pool&) = delete;
+    segment_file_pool& operator=(const segment_file_pool&) = delete;
+    segment_file_pool(segment_file_pool&&) = delete;
+    segment_file_pool& operator=(segment_file_pool&&) = delete;
+    ~segment_file_pool() noexcept = default;
+
+    /**
+     * Start keeping up to \p capacity files in \p dir, which must be on the
+     * filesystem of the segments. The files left over by a previous run are
+     * removed.
+     */
+    ss::future<> start(std::filesystem::path dir, size_t capacity);
+    ss::future<> stop();
+
+    /**
+     * Move a pooled file to \p path, which must not exist. Returns the number
+     * of bytes allocated in the file, or std::nullopt if no file was taken
+     * from the pool, in which case the caller creates the file.
+     */
+    ss::future<std::optional<size_t>> take(const std::filesystem::path& path);
+
+    /**
+     * Offer the data file of a removed segment for reuse. Returns true if the
+     * file was moved into the pool, otherwise the caller removes it.
+     */
+    ss::future<bool> recycle(const std::filesystem::path& path);
+
+    /// Number of files ready to be taken.
+    size_t ready() const { return _ready.size(); }
+
+    const stats& get_stats() const { return _stats; }
+
+private:
+    struct pooled_file {
+        std::filesystem::path path;
+        size_t allocated;
+    };
+
+    bool enabled() const { return !_dir.empty() && !_gate.is_closed(); }
+    bool needs_refill() const {
+        return !_recycled.empty() || _ready.size() < _capacity;
+    }
+    std::filesystem::path next_path();
+
+    ss::future<> refill_loop();
+    // creates a new file, or truncates a recycled one, and allocates it
+    ss::future<> prepare_one();
+
+    falloc_step_fn _falloc_step;
+    std::filesystem::path _dir;
+    size_t _capacity{0};
+    uint64_t _next_id{0};
+    std::deque<pooled_file> _ready;
+    // recycled files moved into the pool, not truncated yet
+    std::deque<std::filesystem::path> _recycled;
+    ss::condition_variable _changed;
+    ss::abort_source _as;
+    ss::gate _gate;
+    stats _stats;
+};
+
+} // namespace storage
@@ -26,6 +26,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace storage {
 
@@ -72,6 +73,13 @@ segment_index::segment_index(
     _state.base_offset = base;
 }
 
+segment_index::~segment_index() noexcept {
+    // the hook unlinks itself
+    if (_lru_hook.is_linked()) {
+        --_lru->_size;
+    }
+}
+
 ss::future<ss::file> segment_index::open() {
     if (_mock_file) {
         // Unit testing hook
@@ -86,18 +94,22 @@ ss::future<ss::file> segment_index::open() {
 }
 
 void segment_index::reset() {
+    _loaded = true;
     auto base = _state.base_offset;
     _state = index_state::make_empty_index(
       storage::internal::should_apply_delta_time_offset(_feature_table));
     _state.base_offset = base;
+    _offset_search.clear();
 
     _acc = 0;
 }
 
 void segment_index::swap_index_state(index_state&& o) {
+    _loaded = true;
     _needs_persistence = true;
     _acc = 0;
     std::swap(_state, o);
+    _offset_search.clear();
 }
 
 // helper for segment_index::maybe_track, converts betwen optional-wrapped
@@ -117,6 +129,25 @@ void segment_index::maybe_track(
   const model::record_batch_header& hdr,
   std::optional<broker_timestamp_t> new_broker_ts,
   size_t filepos) {
+    do_track(hdr, new_broker_ts, filepos, key_sketch::saturated());
+}
+
+void segment_index::maybe_track(
+  const model::record_batch& batch,
+  std::optional<broker_timestamp_t> new_broker_ts,
+  size_t filepos) {
+    do_track(
+      batch.header(),
+      new_broker_ts,
+      filepos,
+      _state.with_zone_maps ? key_sketch::of(batch) : key_sketch{});
+}
+
+void segment_index::do_track(
+  const model::record_batch_header& hdr,
+  std::optional<broker_timestamp_t> new_broker_ts,
+  size_t filepos,
+  const key_sketch& keys) {
     _acc += hdr.size_bytes;
 
     _state.update_batch_timestamps_are_monotonic(
@@ -124,20 +155,24 @@ void segment_index::maybe_track(
     _last_batch_max_timestamp = std::max(
       hdr.first_timestamp, hdr.max_timestamp);
 
-    if (_state.maybe_index(
-          _acc,
-          _step,
-          filepos,
-          hdr.base_offset,
-          hdr.last_offset(),
-          hdr.first_timestamp,
-          hdr.max_timestamp,
-          to_optional_model_timestamp(new_broker_ts),
-          path().is_internal_topic()
-            || hdr.type == model::record_batch_type::raft_data,
-          internal::is_compactible(hdr) ? hdr.record_count : 0)) {
+    const bool user_data = path().is_internal_topic()
+                           || hdr.type == model::record_batch_type::raft_data;
+    const bool indexed = _state.maybe_index(
+      _acc,
+      _step,
+      filepos,
+      hdr.base_offset,
+      hdr.last_offset(),
+      hdr.first_timestamp,
+      hdr.max_timestamp,
+      to_optional_model_timestamp(new_broker_ts),
+      user_data,
+      internal::is_compactible(hdr) ? hdr.record_count : 0);
+    if (indexed) {
         _acc = 0;
     }
+    _state.track_zone(
+      indexed, hdr.first_timestamp, hdr.max_timestamp, user_data, keys);
     _needs_persistence = true;
 }
 
@@ -150,6 +185,15 @@ segment_index::find_nearest(model::timestamp t) {
         return std::nullopt;
     }
 
+    if (_state.has_zone_maps()) {
+        // exact even if the timestamps of the batches aren't monotonic
+        auto zone = _state.find_zone(t);
+        if (!zone) {
+            return std::nullopt;
+        }
+        return translate_index_entry(_state, _state.get_entry(*zone));
+    }
+
     const auto delta = t - _state.base_timestamp;
     const auto entry = _state.find_entry(delta);
     if (!entry) {
@@ -161,31 +205,78 @@ segment_index::find_nearest(model::timestamp t) {
 
 std::optional<segment_index::entry>
 segment_index::find_nearest(model::offset o) {
+    auto i = find_nearest_entry(o);
+    if (!i) {
+        return std::nullopt;
+    }
+    return translate_index_entry(_state, _state.get_entry(*i));
+}
+
+std::optional<segment_index::entry>
+segment_index::find_nearest_with_key(model::offset o, const iobuf& key) {
+    if (!_state.has_zone_maps()) {
+        return find_nearest(o);
+    }
+    if (_state.empty()) {
+        return std::nullopt;
+    }
+    const auto from = find_nearest_entry(o).value_or(0);
+    auto zone = _state.find_zone(from, key_sketch::hash(key));
+    if (!zone) {
+        return std::nullopt;
+    }
+    return translate_index_entry(_state, _state.get_entry(*zone));
+}
+
+std::optional<size_t> segment_index::find_nearest_entry(model::offset o) {
     if (o < _state.base_offset || _state.empty()) {
         return std::nullopt;
     }
     const uint32_t needle = o() - _state.base_offset();
-    auto it = std::lower_bound(
-      std::begin(_state.relative_offset_index),
-      std::end(_state.relative_offset_index),
-      needle,
-      std::less<uint32_t>{});
-    if (it == _state.relative_offset_index.end()) {
-        it = std::prev(it);
-    }
-    // make it signed so it can be negative
-    int i = std::distance(_state.relative_offset_index.begin(), it);
-    do {
-        if (_state.relative_offset_index[i] <= needle) {
-            return translate_index_entry(_state, _state.get_entry(i));
-        }
-    } while (i-- > 0);
+    maybe_build_offset_search();
+
+    // entries appended since the layout was built are searched directly,
+    // they cover the highest offsets so they are only consulted when the
+    // needle is at or beyond the first of them.
+    const auto covered = _offset_search.size();
+    std::optional<size_t> i;
+    if (
+      covered == _state.size()
+      || needle < _state.relative_offset_index[covered]) {
+        i = _offset_search.find(needle);
+    } else {
+        auto begin = std::next(
+          std::begin(_state.relative_offset_index),
+          static_cast<ptrdiff_t>(covered));
+        auto it = std::upper_bound(
+          begin,
+          std::end(_state.relative_offset_index),
+          needle,
+          std::less<uint32_t>{});
+        // begin is less than or equal to the needle so it is never returned
+        i = std::distance(_state.relative_offset_index.begin(), it) - 1;
+    }
+    return i;
+}
 
-    return std::nullopt;
+void segment_index::maybe_build_offset_search() {
+    const auto covered = _offset_search.size();
+    const auto entries = _state.size();
+    if (
+      entries < eytzinger_index::min_entries
+      || entries > eytzinger_index::max_entries) {
+        return;
+    }
+    // rebuild once the uncovered tail is as large as the covered prefix so
+    // the cost of building amortizes over the appends to an active segment.
+    if (entries - covered >= std::max(covered, eytzinger_index::min_entries)) {
+        _offset_search.build(_state.relative_offset_index);
+    }
 }
 
 ss::future<> segment_index::truncate(
   model::offset new_max_offset, model::timestamp new_max_timestamp) {
+    co_await load();
     if (new_max_offset < _state.base_offset) {
         co_return;
     }
@@ -203,6 +294,7 @@ ss::future<> segment_index::truncate(
         while (remove_back_elems-- > 0) {
             _state.pop_back();
         }
+        _offset_search.truncate(_state.size());
     }
 
     if (new_max_offset < _state.max_offset) {
@@ -230,24 +322,85 @@ ss::future<bool> segment_index::materialize_index() {
     });
 }
 
-ss::future<bool> segment_index::materialize_index_from_file(ss::file f) {
+ss::future<std::optional<index_state>>
+segment_index::read_index_state(ss::file f) {
     auto size = co_await f.size();
     auto buf = co_await f.dma_read_bulk<char>(0, size);
     if (buf.empty()) {
-        co_return false;
+        co_return std::nullopt;
     }
     iobuf b;
     b.append(std::move(buf));
     try {
-        _state = serde::from_iobuf<index_state>(std::move(b));
-        co_return true;
+        co_return serde::from_iobuf<index_state>(std::move(b));
     } catch (const serde::serde_exception& ex) {
         vlog(
           stlog.info,
           "Rebuilding index_state after decoding failure: {}",
           ex.what());
+        co_return std::nullopt;
+    }
+}
+
+ss::future<bool> segment_index::materialize_index_from_file(ss::file f) {
+    auto state = co_await read_index_state(std::move(f));
+    if (!state) {
         co_return false;
     }
+    _state = std::move(*state);
+    _offset_search.clear();
+    co_return true;
+}
+
+void segment_index::unload() {
+    if (!_loaded || _needs_persistence) {
+        return;
+    }
+    vlog(stlog.trace, "Unloading index {}", _path);
+    _state.relative_offset_index = {};
+    _state.relative_time_index = {};
+    _state.position_index = {};
+    _state.zone_min_time_index = {};
+    _state.zone_max_time_index = {};
+    _state.zone_key_sketch_index = {};
+    _offset_search.clear();
+    _loaded = false;
+}
+
+ss::future<> segment_index::load() {
+    if (_loaded) {
+        return ss::now();
+    }
+    if (!_loading || _loading->available()) {
+        _loading.emplace(do_load());
+    }
+    return _loading->get_future();
+}
+
+ss::future<> segment_index::do_load() {
+    vlog(stlog.trace, "Loading index {}", _path);
+    std::optional<index_state> state;
+    try {
+        state = co_await ss::with_file(open(), [this](ss::file f) {
+            return read_index_state(std::move(f));
+        });
+    } catch (...) {
+        vlog(
+          stlog.warn,
+          "Unable to load index {}, reads of the segment will scan it from "
+          "the beginning: {}",
+          _path,
+          std::current_exception());
+    }
+    // the state may have been replaced while the file was read
+    if (_loaded) {
+        co_return;
+    }
+    if (state) {
+        _state = std::move(*state);
+    }
+    _offset_search.clear();
+    _loaded = true;
 }
 
 ss::future<> segment_index::drop_all_data() {
@@ -284,10 +437,49 @@ ss::future<> segment_index::flush_to_file(ss::file backing_file) {
     co_await out.flush();
 }
 
+segment_index_lru::segment_index_lru(
+  config::binding<std::optional<size_t>> max_loaded)
+  : _max_loaded(std::move(max_loaded)) {
+    _max_loaded.watch([this] {
+        if (!_max_loaded().has_value()) {
+            _lru.clear();
+            _size = 0;
+        } else {
+            trim();
+        }
+    });
+}
+
+void segment_index_lru::touch(segment_index& idx) {
+    if (!_max_loaded().has_value()) {
+        return;
+    }
+    if (idx._lru_hook.is_linked()) {
+        idx._lru_hook.unlink();
+    } else {
+        idx._lru = this;
+        ++_size;
+    }
+    _lru.push_back(idx);
+    trim();
+}
+
+void segment_index_lru::trim() {
+    const auto max_loaded = _max_loaded().value_or(
+      std::numeric_limits<size_t>::max());
+    while (_size > max_loaded && !_lru.empty()) {
+        auto& idx = _lru.front();
+        _lru.pop_front();
+        --_size;
+        idx.unload();
+    }
+}
+
 std::ostream& operator<<(std::ostream& o, const segment_index& i) {
     return o << "{file:" << i.path() << ", offsets:" << i.base_offset()
              << ", index:" << i._state << ", step:" << i._step
-             << ", needs_persistence:" << i._needs_persistence << "}";
+             << ", needs_persistence:" << i._needs_persistence
+             << ", loaded:" << i._loaded << "}";
 }
 std::ostream& operator<<(std::ostream& o, const segment_index_ptr& i) {
     if (i) {
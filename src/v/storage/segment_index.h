@@ -10,16 +10,20 @@
  */
 
 #pragma once
+#include "config/property.h"
 #include "features/feature_table.h"
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "model/timestamp.h"
+#include "storage/eytzinger_index.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
 #include "storage/index_state.h"
 #include "storage/types.h"
+#include "utils/intrusive_list_helpers.h"
 
 #include <seastar/core/file.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/unaligned.hh>
 
@@ -99,6 +103,8 @@ struct time_based_retention_cfg {
     }
 };
 
+class segment_index_lru;
+
 /**
  * file file format is: [ header ] [ payload ]
  * header  == segment_index::header
@@ -131,7 +137,7 @@ public:
       std::optional<ntp_sanitizer_config> sanitizer_config,
       std::optional<model::timestamp> broker_timestamp = std::nullopt);
 
-    ~segment_index() noexcept = default;
+    ~segment_index() noexcept;
     segment_index(segment_index&&) noexcept = default;
     segment_index& operator=(segment_index&&) noexcept = default;
     segment_index(const segment_index&) = delete;
@@ -147,13 +153,26 @@ public:
         return 1 + 16 * log_size / default_data_buffer_step;
     }
 
+    /// Track a batch of which only the header is known, its zone map
+    /// entry may contain any key.
     void maybe_track(
       const model::record_batch_header&,
       std::optional<broker_timestamp_t> new_broker_ts,
       size_t filepos);
+    void maybe_track(
+      const model::record_batch&,
+      std::optional<broker_timestamp_t> new_broker_ts,
+      size_t filepos);
     std::optional<entry> find_nearest(model::offset);
     std::optional<entry> find_nearest(model::timestamp);
 
+    /// The nearest entry at or before the first batch from offset \p o that
+    /// may contain a record with \p key, nullopt if no batch from \p o does.
+    /// Without zone maps every batch may contain the key.
+    std::optional<entry> find_nearest_with_key(model::offset o, const iobuf&);
+
+    bool has_zone_maps() const { return _state.has_zone_maps(); }
+
     /// Fallback timestamp search for if the recorded max ts appears to be
     /// invalid, e.g. too far in the future
     std::optional<model::timestamp>
@@ -191,6 +210,15 @@ public:
     }
 
     ss::future<bool> materialize_index();
+
+    /// Release the memory of the index entries, they are read back from the
+    /// index file by load(). Lookups on an unloaded index find no entries.
+    /// Indices with changes that are not persisted yet are not unloaded.
+    void unload();
+    /// Read the index entries back if the index was unloaded.
+    ss::future<> load();
+    bool is_loaded() const { return _loaded; }
+
     ss::future<> flush();
     ss::future<> truncate(model::offset, model::timestamp);
 
@@ -218,8 +246,18 @@ public:
     void clear_cached_disk_usage() { _disk_usage_size.reset(); }
 
 private:
+    void do_track(
+      const model::record_batch_header&,
+      std::optional<broker_timestamp_t> new_broker_ts,
+      size_t filepos,
+      const key_sketch&);
+    std::optional<size_t> find_nearest_entry(model::offset);
+
+    ss::future<std::optional<index_state>> read_index_state(ss::file);
     ss::future<bool> materialize_index_from_file(ss::file);
+    ss::future<> do_load();
     ss::future<> flush_to_file(ss::file);
+    void maybe_build_offset_search();
 
     segment_full_path _path;
     size_t _step;
@@ -227,6 +265,8 @@ private:
     size_t _acc{0};
     bool _needs_persistence{false};
     index_state _state;
+    // lazily built search layout over _state.relative_offset_index
+    eytzinger_index _offset_search;
     std::optional<ntp_sanitizer_config> _sanitizer_config;
 
     // Override the timestamp used for retention, in case what's in
@@ -236,6 +276,11 @@ private:
     // invalidate size cache when on-disk size may change
     std::optional<size_t> _disk_usage_size;
 
+    bool _loaded{true};
+    std::optional<ss::shared_future<>> _loading;
+    intrusive_list_hook _lru_hook;
+    segment_index_lru* _lru{nullptr};
+
     model::timestamp _last_batch_max_timestamp;
 
     /** Constructor with mock file content for unit testing */
@@ -254,6 +299,38 @@ private:
     friend class log_replayer_fixture;
 
     friend std::ostream& operator<<(std::ostream&, const segment_index&);
+    friend class segment_index_lru;
+};
+
+/**
+ * Per shard LRU of the loaded indices of closed segments. Bounds the memory
+ * used by the indices of segments that are not read: when the number of the
+ * tracked indices exceeds the limit, the least recently used ones are
+ * unloaded. Indices are not tracked if there is no limit.
+ */
+class segment_index_lru {
+public:
+    explicit segment_index_lru(config::binding<std::optional<size_t>>);
+    segment_index_lru(const segment_index_lru&) = delete;
+    segment_index_lru& operator=(const segment_index_lru&) = delete;
+    segment_index_lru(segment_index_lru&&) = delete;
+    segment_index_lru& operator=(segment_index_lru&&) = delete;
+    ~segment_index_lru() { _lru.clear(); }
+
+    /// Mark the index as the most recently used one
+    void touch(segment_index&);
+
+    size_t size() const { return _size; }
+
+private:
+    friend class segment_index;
+
+    void trim();
+
+    config::binding<std::optional<size_t>> _max_loaded;
+    intrusive_list<segment_index, &segment_index::_lru_hook> _lru;
+    // intrusive_list::size() is linear
+    size_t _size{0};
 };
 
 using segment_index_ptr = std::unique_ptr<segment_index>;
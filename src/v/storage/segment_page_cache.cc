@@ -0,0 +1,247 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/segment_page_cache.h"
+
+#include "config/configuration.h"
+#include "storage/logger.h"
+#include "units.h"
+#include "vlog.h"
+
+#include <seastar/core/align.hh>
+#include <seastar/core/coroutine.hh>
+
+#include <vector>
+
+namespace storage {
+
+namespace {
+
+/*
+ * Data source that serves a byte range of a segment file from the page cache.
+ * While the current page is consumed the next page is read in the background
+ * which stands in for the read-ahead of a seastar file input stream.
+ */
+class page_cache_data_source final : public ss::data_source_impl {
+public:
+    page_cache_data_source(
+      ss::lw_shared_ptr<segment_page_cache::file_pages> pages,
+      ss::file file,
+      size_t pos_begin,
+      size_t pos_end,
+      size_t file_size,
+      size_t page_size,
+      ss::io_priority_class pc)
+      : _pages(std::move(pages))
+      , _file(std::move(file))
+      , _pos(pos_begin)
+      , _end(pos_end)
+      , _file_size(file_size)
+      , _page_size(page_size)
+      , _pc(pc) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        if (_pos >= _end) {
+            co_return ss::temporary_buffer<char>{};
+        }
+
+        const auto page_offset = ss::align_down<uint64_t>(_pos, _page_size);
+        ss::temporary_buffer<char> buf;
+        if (_read_ahead && _read_ahead_offset == page_offset) {
+            buf = co_await std::exchange(_read_ahead, std::nullopt).value();
+        } else {
+            co_await drain_read_ahead();
+            buf = co_await _pages->read(_file, page_offset, _file_size, _pc);
+        }
+
+        const auto next_offset = page_offset + _page_size;
+        if (next_offset < _end && !_read_ahead) {
+            _read_ahead_offset = next_offset;
+            _read_ahead = _pages->read(_file, next_offset, _file_size, _pc);
+        }
+
+        const auto page_pos = _pos - page_offset;
+        if (buf.size() <= page_pos) {
+            // short read: the file ends before the requested range.
+            _pos = _end;
+            co_return ss::temporary_buffer<char>{};
+        }
+        buf.trim_front(page_pos);
+        buf.trim(std::min<size_t>(buf.size(), _end - _pos));
+        _pos += buf.size();
+        co_return buf;
+    }
+
+    ss::future<> close() override { return drain_read_ahead(); }
+
+private:
+    ss::future<> drain_read_ahead() {
+        if (!_read_ahead) {
+            return ss::now();
+        }
+        return std::exchange(_read_ahead, std::nullopt)
+          .value()
+          .discard_result()
+          .handle_exception([](const std::exception_ptr&) {});
+    }
+
+    ss::lw_shared_ptr<segment_page_cache::file_pages> _pages;
+    ss::file _file;
+    size_t _pos;
+    size_t _end;
+    size_t _file_size;
+    size_t _page_size;
+    ss::io_priority_class _pc;
+
+    std::optional<ss::future<ss::temporary_buffer<char>>> _read_ahead;
+    uint64_t _read_ahead_offset{0};
+};
+
+} // namespace
+
+segment_page_cache::segment_page_cache(size_t capacity, size_t page_size)
+  : _page_size(ss::align_up<size_t>(std::max<size_t>(page_size, 1), 4_KiB)) {
+    if (capacity > _page_size) {
+        _cache.emplace(cache_type::config{
+          .cache_size = capacity,
+          .small_size = capacity / 10,
+        });
+    }
+}
+
+ss::lw_shared_ptr<segment_page_cache::file_pages>
+segment_page_cache::make_file_pages() {
+    if (!enabled()) {
+        return nullptr;
+    }
+    return ss::make_lw_shared<file_pages>(this);
+}
+
+ss::input_stream<char> segment_page_cache::make_input_stream(
+  ss::lw_shared_ptr<file_pages> pages,
+  ss::file file,
+  size_t pos_begin,
+  size_t pos_end,
+  size_t file_size,
+  ss::io_priority_class pc) {
+    return ss::input_stream<char>(
+      ss::data_source(std::make_unique<page_cache_data_source>(
+        std::move(pages),
+        std::move(file),
+        pos_begin,
+        pos_end,
+        file_size,
+        _page_size,
+        pc)));
+}
+
+segment_page_cache::file_pages::file_pages(segment_page_cache* cache) noexcept
+  : _cache(cache) {}
+
+segment_page_cache::file_pages::~file_pages() noexcept {
+    for (const auto& p : _pages) {
+        _cache->_cache->remove(*p);
+    }
+}
+
+ss::future<ss::temporary_buffer<char>> segment_page_cache::file_pages::read(
+  ss::file file, uint64_t offset, size_t file_size, ss::io_priority_class pc) {
+    auto it = _pages.find(offset);
+    if (it != _pages.end() && !(*it)->data().empty()) {
+        (*it)->hook.touch();
+        ++_cache->_stats.hits;
+        co_return (*it)->data().share();
+    }
+
+    ++_cache->_stats.misses;
+    const auto page_size = _cache->_page_size;
+    auto buf = co_await file.dma_read<char>(offset, page_size, pc);
+
+    // the tail page of the file may still be growing, don't cache it
+    if (offset + page_size <= file_size && buf.size() == page_size) {
+        insert(offset, buf);
+    }
+    co_return buf;
+}
+
+void segment_page_cache::file_pages::insert(
+  uint64_t offset, const ss::temporary_buffer<char>& buf) {
+    // the index may have changed while the read was in flight
+    auto it = _pages.find(offset);
+    if (it != _pages.end()) {
+        const auto& p = *it;
+        if (
+          p->offset() == offset && p->size() == buf.size()
+          && p->data().empty()) {
+            // rehydrate in place to retain the ghost queue membership
+            p->set_data(buf.share());
+            _cache->_cache->insert(*p);
+        }
+        return;
+    }
+
+    auto res = _pages.insert(ss::make_lw_shared<page>(offset, buf.share()));
+    if (res.second) {
+        _cache->_cache->insert(**res.first);
+    }
+
+    if (++_misses_since_prune >= prune_interval) {
+        _misses_since_prune = 0;
+        maybe_prune();
+    }
+}
+
+void segment_page_cache::file_pages::maybe_prune() {
+    std::vector<uint64_t> stale;
+    for (const auto& p : _pages) {
+        if (
+          p->hook.evicted() && !_cache->_cache->ghost_queue_contains(*p)) {
+            stale.push_back(p->offset());
+        }
+    }
+    for (auto offset : stale) {
+        _pages.erase(_pages.find(offset));
+    }
+}
+
+void segment_page_cache::file_pages::truncate(size_t size) {
+    std::vector<uint64_t> dropped;
+    for (const auto& p : _pages) {
+        if (p->offset() + p->size() > size) {
+            dropped.push_back(p->offset());
+        }
+    }
+    for (auto offset : dropped) {
+        auto it = _pages.find(offset);
+        _cache->_cache->remove(**it);
+        _pages.erase(it);
+    }
+    if (!dropped.empty()) {
+        vlog(
+          stlog.trace,
+          "dropped {} cached pages after truncation to {}",
+          dropped.size(),
+          size);
+    }
+}
+
+namespace internal {
+
+segment_page_cache& page_cache() {
+    static thread_local segment_page_cache cache(
+      config::shard_local_cfg().storage_read_page_cache_size(),
+      config::shard_local_cfg().storage_read_buffer_size());
+    return cache;
+}
+
+} // namespace internal
+
+} // namespace storage
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "io/cache.h"
+#include "io/page.h"
+#include "io/page_set.h"
+#include "seastarx.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/io_priority_class.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <cstdint>
+#include <optional>
+
+namespace storage {
+
+/**
+ * A shard-local, page granular cache of segment file data.
+ *
+ * Segment data is cached in fixed size, aligned pages. The pages of each
+ * segment file are indexed by an io::page_set owned by the file's
+ * segment_reader, and all pages on the shard are managed by a single s3-fifo
+ * io::cache that bounds the total number of cached bytes.
+ *
+ * Compared with caching decoded record batches the per-partition overhead is
+ * small (one index entry per page), and the s3-fifo ghost queue lets pages
+ * that are re-read by lagging consumers displace pages touched by a single
+ * catch-up scan.
+ *
+ * Only pages that lie entirely below the reader's visible file size are
+ * cached. The partially written tail page of an active segment is always read
+ * from disk.
+ */
+class segment_page_cache {
+    using page = experimental::io::page;
+
+    struct evictor {
+        bool operator()(page& p) noexcept {
+            // readers hold shared references to the page data so releasing
+            // it here never invalidates an in-flight read.
+            p.clear();
+            return true;
+        }
+    };
+
+    struct cost {
+        size_t operator()(const page& p) noexcept { return p.size(); }
+    };
+
+    using cache_type
+      = experimental::io::cache<page, &page::hook, evictor, cost>;
+
+public:
+    /**
+     * The cached pages of a single segment file.
+     */
+    class file_pages {
+    public:
+        explicit file_pages(segment_page_cache* cache) noexcept;
+        file_pages(const file_pages&) = delete;
+        file_pages& operator=(const file_pages&) = delete;
+        file_pages(file_pages&&) = delete;
+        file_pages& operator=(file_pages&&) = delete;
+        ~file_pages() noexcept;
+
+        /**
+         * Read the page starting at \p offset from the cache, or from \p file
+         * on a cache miss. The returned buffer may be shorter than a page
+         * when the page covers the end of the file.
+         */
+        ss::future<ss::temporary_buffer<char>> read(
+          ss::file file,
+          uint64_t offset,
+          size_t file_size,
+          ss::io_priority_class pc);
+
+        /**
+         * Drop all pages that are not entirely below \p size.
+         */
+        void truncate(size_t size);
+
+    private:
+        void insert(uint64_t offset, const ss::temporary_buffer<char>& buf);
+        void maybe_prune();
+
+        segment_page_cache* _cache;
+        experimental::io::page_set _pages;
+        size_t _misses_since_prune{0};
+    };
+
+    struct stats {
+        uint64_t hits{0};
+        uint64_t misses{0};
+    };
+
+    /**
+     * Create a cache holding \p capacity bytes of pages of \p page_size
+     * bytes. A capacity of zero disables the cache.
+     */
+    segment_page_cache(size_t capacity, size_t page_size);
+
+    segment_page_cache(const segment_page_cache&) = delete;
+    segment_page_cache& operator=(const segment_page_cache&) = delete;
+    segment_page_cache(segment_page_cache&&) = delete;
+    segment_page_cache& operator=(segment_page_cache&&) = delete;
+    ~segment_page_cache() noexcept = default;
+
+    bool enabled() const { return _cache.has_value(); }
+    size_t page_size() const { return _page_size; }
+    const stats& get_stats() const { return _stats; }
+
+    /**
+     * Create the page index for a segment file. Returns nullptr when the
+     * cache is disabled.
+     */
+    ss::lw_shared_ptr<file_pages> make_file_pages();
+
+    /**
+     * Create an input stream reading the byte range [pos_begin, pos_end) of
+     * \p file through the cached \p pages.
+     */
+    ss::input_stream<char> make_input_stream(
+      ss::lw_shared_ptr<file_pages> pages,
+      ss::file file,
+      size_t pos_begin,
+      size_t pos_end,
+      size_t file_size,
+      ss::io_priority_class pc);
+
+private:
+    // evicted pages stay in their file's index to preserve ghost queue
+    // metadata. they are pruned once this many misses accumulate in a file.
+    static constexpr size_t prune_interval = 64;
+
+    size_t _page_size;
+    std::optional<cache_type> _cache;
+    stats _stats;
+};
+
+namespace internal {
+
+/**
+ * The shard-local segment page cache. Sized by the
+ * `storage_read_page_cache_size` property at first use.
+ */
+segment_page_cache& page_cache();
+
+} // namespace internal
+
+} // namespace storage
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "storage/segment_read_scheduler.h"
+
+#include "config/configuration.h"
+#include "ssx/future-util.h"
+#include "storage/logger.h"
+#include "units.h"
+#include "vlog.h"
+
+#include <seastar/core/align.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/util/later.hh>
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace storage {
+
+namespace {
+
+/*
+ * Data source that serves a byte range of a segment file through the read
+ * scheduler, one chunk at a time. The next chunk is requested together with
+ * the current one so that the two are coalesced into a single read, and it
+ * stands in for the read-ahead of a seastar file input stream.
+ */
+class scheduled_data_source final : public ss::data_source_impl {
+public:
+    scheduled_data_source(
+      segment_read_scheduler* scheduler,
+      const void* owner,
+      ss::file file,
+      size_t pos_begin,
+      size_t pos_end,
+      ss::io_priority_class pc)
+      : _scheduler(scheduler)
+      , _owner(owner)
+      , _file(std::move(file))
+      , _pos(pos_begin)
+      , _end(pos_end)
+      , _pc(pc) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        if (_pos >= _end) {
+            co_return ss::temporary_buffer<char>{};
+        }
+
+        const auto chunk_size = _scheduler->chunk_size();
+        const auto chunk_offset = ss::align_down<uint64_t>(_pos, chunk_size);
+        std::optional<ss::future<ss::temporary_buffer<char>>> current;
+        if (_read_ahead && _read_ahead_offset == chunk_offset) {
+            current = std::exchange(_read_ahead, std::nullopt);
+        } else {
+            co_await drain_read_ahead();
+            current = read(chunk_offset);
+        }
+
+        const auto next_offset = chunk_offset + chunk_size;
+        if (next_offset < _end && !_read_ahead) {
+            _read_ahead_offset = next_offset;
+            _read_ahead = read(next_offset);
+        }
+
+        auto buf = co_await std::move(current).value();
+        const auto chunk_pos = _pos - chunk_offset;
+        if (buf.size() <= chunk_pos) {
+            // short read: the file ends before the requested range.
+            _pos = _end;
+            co_return ss::temporary_buffer<char>{};
+        }
+        buf.trim_front(chunk_pos);
+        buf.trim(std::min<size_t>(buf.size(), _end - _pos));
+        _pos += buf.size();
+        co_return buf;
+    }
+
+    ss::future<> close() override { return drain_read_ahead(); }
+
+private:
+    ss::future<ss::temporary_buffer<char>> read(uint64_t offset) {
+        return _scheduler->read(_owner, _file, offset, _pc);
+    }
+
+    ss::future<> drain_read_ahead() {
+        if (!_read_ahead) {
+            return ss::now();
+        }
+        return std::exchange(_read_ahead, std::nullopt)
+          .value()
+          .discard_result()
+          .handle_exception([](const std::exception_ptr&) {});
+    }
+
+    segment_read_scheduler* _scheduler;
+    const void* _owner;
+    ss::file _file;
+    size_t _pos;
+    size_t _end;
+    ss::io_priority_class _pc;
+
+    std::optional<ss::future<ss::temporary_buffer<char>>> _read_ahead;
+    uint64_t _read_ahead_offset{0};
+};
+
+} // namespace
+
+segment_read_scheduler::segment_read_scheduler(size_t chunk_size)
+  : _chunk_size(std::min(
+    ss::align_up<size_t>(std::max<size_t>(chunk_size, 1), 4_KiB),
+    max_coalesced_bytes)) {}
+
+ss::future<ss::temporary_buffer<char>> segment_read_scheduler::read(
+  const void* owner,
+  ss::file file,
+  uint64_t offset,
+  ss::io_priority_class pc) {
+    ++_stats.requests;
+    auto& r = _pending.emplace_back(request{
+      .owner = owner, .file = std::move(file), .offset = offset, .pc = pc});
+    auto f = r.result.get_future();
+    if (!_flush_scheduled) {
+        // collect the requests of every task that runs before the yield
+        _flush_scheduled = true;
+        ssx::background = ss::yield().then([this] { flush(); });
+    }
+    return f;
+}
+
+void segment_read_scheduler::flush() {
+    _flush_scheduled = false;
+    auto pending = std::exchange(_pending, {});
+    ++_stats.flushes;
+    std::sort(
+      pending.begin(), pending.end(), [](const request& a, const request& b) {
+          if (a.owner != b.owner) {
+              return std::less<>{}(a.owner, b.owner);
+          }
+          return a.offset < b.offset;
+      });
+
+    std::vector<request> group;
+    for (auto& r : pending) {
+        if (!group.empty()) {
+            const auto& first = group.front();
+            const auto& last = group.back();
+            const bool coalesce = r.owner == last.owner && r.pc == last.pc
+                                  && r.offset <= last.offset + _chunk_size
+                                  && r.offset + _chunk_size - first.offset
+                                       <= max_coalesced_bytes;
+            if (!coalesce) {
+                ssx::background = submit(std::exchange(group, {}));
+            }
+        }
+        group.push_back(std::move(r));
+    }
+    if (!group.empty()) {
+        ssx::background = submit(std::move(group));
+    }
+}
+
+ss::future<> segment_read_scheduler::submit(std::vector<request> group) {
+    // the group is sorted by offset, all chunks are aligned
+    const auto begin = group.front().offset;
+    const auto len = group.back().offset + _chunk_size - begin;
+    ++_stats.submissions;
+    vlog(
+      stlog.trace,
+      "submitting read of {} bytes at {} for {} chunks",
+      len,
+      begin,
+      group.size());
+    try {
+        auto buf = co_await group.front().file.dma_read<char>(
+          begin, len, group.front().pc);
+        _stats.bytes_read += buf.size();
+        for (auto& r : group) {
+            const auto pos = r.offset - begin;
+            if (pos >= buf.size()) {
+                r.result.set_value(ss::temporary_buffer<char>{});
+                continue;
+            }
+            r.result.set_value(
+              buf.share(pos, std::min<size_t>(_chunk_size, buf.size() - pos)));
+        }
+    } catch (...) {
+        auto e = std::current_exception();
+        for (auto& r : group) {
+            r.result.set_exception(e);
+        }
+    }
+}
+
+ss::input_stream<char> segment_read_scheduler::make_input_stream(
+  const void* owner,
+  ss::file file,
+  size_t pos_begin,
+  size_t pos_end,
+  ss::io_priority_class pc) {
+    return ss::input_stream<char>(
+      ss::data_source(std::make_unique<scheduled_data_source>(
+        this, owner, std::move(file), pos_begin, pos_end, pc)));
+}
+
+namespace internal {
+
+segment_read_scheduler* read_scheduler() {
+    static thread_local auto scheduler
+      = config::shard_local_cfg().storage_read_coalescing()
+          ? std::make_unique<segment_read_scheduler>(
+            config::shard_local_cfg().storage_read_buffer_size())
+          : nullptr;
+    return scheduler.get();
+}
+
+} // namespace internal
+
+} // namespace storage
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/io_priority_class.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <cstdint>
+#include <vector>
+
+namespace storage {
+
+/**
+ * A shard-local scheduler of segment file reads.
+ *
+ * Reads are issued in aligned chunks of chunk_size bytes. Rather than being
+ * submitted one by one as each stream asks for them, the chunks requested by
+ * all the streams of the shard are queued until the end of the current
+ * scheduling round and then submitted together. Chunks of the same file that
+ * are adjacent or overlapping (concurrent catch-up readers of a partition,
+ * a stream and its read-ahead) are coalesced into a single dma read of up to
+ * max_coalesced_bytes, and the reads of all files are handed to the reactor
+ * in the same task so that the io backend submits them in one batch.
+ */
+class segment_read_scheduler {
+public:
+    static constexpr size_t max_coalesced_bytes = 1024 * 1024;
+
+    struct stats {
+        // chunks requested by the streams
+        uint64_t requests{0};
+        // dma reads submitted for them
+        uint64_t submissions{0};
+        uint64_t flushes{0};
+        uint64_t bytes_read{0};
+    };
+
+    explicit segment_read_scheduler(size_t chunk_size);
+
+    segment_read_scheduler(const segment_read_scheduler&) = delete;
+    segment_read_scheduler& operator=(const segment_read_scheduler&) = delete;
+    segment_read_scheduler(segment_read_scheduler&&) = delete;
+    segment_read_scheduler& operator=(segment_read_scheduler&&) = delete;
+    ~segment_read_scheduler() noexcept = default;
+
+    size_t chunk_size() const { return _chunk_size; }
+    const stats& get_stats() const { return _stats; }
+
+    /**
+     * Read the chunk starting at the chunk aligned \p offset of \p file. The
+     * returned buffer is shorter than a chunk when the chunk covers the end
+     * of the file. \p owner identifies the file: reads are only coalesced
+     * between requests of the same owner.
+     */
+    ss::future<ss::temporary_buffer<char>> read(
+      const void* owner,
+      ss::file file,
+      uint64_t offset,
+      ss::io_priority_class pc);
+
+    /**
+     * Create an input stream reading the byte range [pos_begin, pos_end) of
+     * \p file through the scheduler.
+     */
+    ss::input_stream<char> make_input_stream(
+      const void* owner,
+      ss::file file,
+      size_t pos_begin,
+      size_t pos_end,
+      ss::io_priority_class pc);
+
+private:
+    struct request {
+        const void* owner;
+        ss::file file;
+        uint64_t offset;
+        ss::io_priority_class pc;
+        ss::promise<ss::temporary_buffer<char>> result;
+    };
+
+    void flush();
+    ss::future<> submit(std::vector<request> group);
+
+    size_t _chunk_size;
+    std::vector<request> _pending;
+    bool _flush_scheduled{false};
+    stats _stats;
+};
+
+namespace internal {
+
+/**
+ * The shard-local segment read scheduler, null unless enabled by the
+ * `storage_read_coalescing` property at first use. Chunks are
+ * storage_read_buffer_size bytes.
+ */
+segment_read_scheduler* read_scheduler();
+
+} // namespace internal
+
+} // namespace storage
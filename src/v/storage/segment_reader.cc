@@ -11,6 +11,7 @@
 
 #include "ssx/future-util.h"
 #include "storage/logger.h"
+#include "storage/segment_read_scheduler.h"
 #include "storage/segment_utils.h"
 #include "vassert.h"
 #include "vlog.h"
@@ -30,8 +31,9 @@ segment_reader::segment_reader(
   std::optional<ntp_sanitizer_config> ntp_sanitizer_config) noexcept
   : _path(std::move(path))
   , _buffer_size(buffer_size)
-  , _read_ahead(read_ahead)
-  , _sanitizer_config(std::move(ntp_sanitizer_config)) {}
+  , _read_ahead(read_ahead, buffer_size)
+  , _sanitizer_config(std::move(ntp_sanitizer_config))
+  , _pages(internal::page_cache().make_file_pages()) {}
 
 segment_reader::~segment_reader() noexcept {
     if (!_streams.empty() || _data_file_refcount > 0) {
@@ -55,6 +57,40 @@ ss::future<> segment_reader::load_size() {
     set_file_size(s.st_size);
 };
 
+void segment_reader::set_file_size(size_t o) {
+    if (_pages && o < _file_size) {
+        _pages->truncate(o);
+    }
+    _file_size = o;
+}
+
+ss::input_stream<char> segment_reader::make_stream(
+  segment_reader_handle& handle,
+  size_t pos_begin,
+  size_t pos_end,
+  const ss::io_priority_class pc) {
+    if (_pages) {
+        return internal::page_cache().make_input_stream(
+          _pages, _data_file, pos_begin, pos_end, _file_size, pc);
+    }
+    if (auto* scheduler = internal::read_scheduler()) {
+        return scheduler->make_input_stream(
+          this, _data_file, pos_begin, pos_end, pc);
+    }
+
+    auto read_ahead = _read_ahead.next();
+    handle._read_ahead_units = std::move(read_ahead.units);
+
+    ss::file_input_stream_options options;
+    options.buffer_size = _buffer_size;
+    options.io_priority_class = pc;
+    options.read_ahead = read_ahead.read_ahead;
+    options.dynamic_adjustments = _read_ahead.history();
+
+    return make_file_input_stream(
+      _data_file, pos_begin, pos_end - pos_begin, std::move(options));
+}
+
 ss::future<segment_reader_handle>
 segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     vassert(
@@ -74,16 +110,10 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     // sealed segments are supposed to be very rare events. The hotpath of
     // truncating the appender, is optimized.
 
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
-
     ss::gate::holder guard{_gate};
 
     auto handle = co_await get();
-    handle.set_stream(make_file_input_stream(
-      _data_file, pos, _file_size - pos, std::move(options)));
+    handle.set_stream(make_stream(handle, pos, _file_size, pc));
     co_return std::move(handle);
 }
 
@@ -155,22 +185,17 @@ ss::future<segment_reader_handle> segment_reader::data_stream(
       pos_begin,
       pos_end,
       *this);
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
 
     ss::gate::holder guard{_gate};
     auto handle = co_await get();
-    handle.set_stream(make_file_input_stream(
-      _data_file, pos_begin, pos_end - pos_begin, std::move(options)));
+    handle.set_stream(make_stream(handle, pos_begin, pos_end, pc));
     co_return handle;
 }
 
 ss::future<> segment_reader::truncate(size_t n) {
     ss::gate::holder guard{_gate};
 
-    _file_size = n;
+    set_file_size(n);
     return ss::open_file_dma(ss::sstring(_path), ss::open_flags::rw)
       .then([n](ss::file f) {
           return f.truncate(n)
@@ -215,9 +240,12 @@ ss::future<> segment_reader_handle::close() {
         co_await _stream.value().close();
         _stream = std::nullopt;
     }
+    _read_ahead_units.reset();
     _hook.unlink();
 
     if (_parent) {
+        // closing the stream recorded the read-ahead it left unused
+        _parent->_read_ahead.observe();
         co_await _parent->put();
         _parent = nullptr;
     }
@@ -235,6 +263,7 @@ void segment_reader_handle::operator=(segment_reader_handle&& rhs) noexcept {
         ssx::background = _parent->put();
     }
     _stream = std::exchange(rhs._stream, std::nullopt);
+    _read_ahead_units = std::exchange(rhs._read_ahead_units, std::nullopt);
     _parent = std::exchange(rhs._parent, nullptr);
     _hook.swap_nodes(rhs._hook);
 }
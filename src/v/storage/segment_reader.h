@@ -15,6 +15,8 @@
 #include "seastarx.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
+#include "storage/read_ahead.h"
+#include "storage/segment_page_cache.h"
 #include "storage/types.h"
 #include "utils/intrusive_list_helpers.h"
 #include "utils/mutex.h"
@@ -59,11 +61,15 @@ private:
     // created to just stat() a file for example.
     std::optional<ss::input_stream<char>> _stream;
 
+    // read-ahead budget borrowed by the stream, see adaptive_read_ahead
+    std::optional<ssx::semaphore_units> _read_ahead_units;
+
 public:
     explicit segment_reader_handle(segment_reader* parent);
 
     segment_reader_handle(segment_reader_handle&& rhs) noexcept {
         _stream = std::exchange(rhs._stream, std::nullopt);
+        _read_ahead_units = std::exchange(rhs._read_ahead_units, std::nullopt);
         _parent = std::exchange(rhs._parent, nullptr);
         _hook.swap_nodes(rhs._hook);
     }
@@ -124,8 +130,9 @@ public:
 
     ss::future<> load_size();
 
-    /// max physical byte that this reader is allowed to fetch
-    void set_file_size(size_t o) { _file_size = o; }
+    /// max physical byte that this reader is allowed to fetch. shrinking the
+    /// size drops cached pages beyond the new size.
+    void set_file_size(size_t o);
     size_t file_size() const { return _file_size; }
 
     /// file name
@@ -134,6 +141,12 @@ public:
 
     bool empty() const { return _file_size == 0; }
 
+    /// estimate of the buffer memory held by an open stream of this reader
+    size_t stream_memory_estimate() const {
+        // a page and its read-ahead for page cache streams
+        return _buffer_size * (1 + (_pages ? 1 : _read_ahead.current()));
+    }
+
     /// close the underlying file handle
     ss::future<> close();
 
@@ -167,9 +180,12 @@ private:
 
     size_t _file_size{0};
     size_t _buffer_size{0};
-    unsigned _read_ahead{0};
+    adaptive_read_ahead _read_ahead;
     std::optional<ntp_sanitizer_config> _sanitizer_config;
 
+    // Cached pages of this file, null when the page cache is disabled
+    ss::lw_shared_ptr<segment_page_cache::file_pages> _pages;
+
     // Keeps track of operations that cannot be pre-empted by close()
     ss::gate _gate;
     // Acquire a handle to use the underlying file handle
@@ -178,6 +194,12 @@ private:
     // Signal destruction of a segment_reader_handle
     ss::future<> put();
 
+    ss::input_stream<char> make_stream(
+      segment_reader_handle& handle,
+      size_t pos_begin,
+      size_t pos_end,
+      const ss::io_priority_class pc);
+
     friend class segment_reader_handle;
     friend std::ostream& operator<<(std::ostream&, const segment_reader&);
 };
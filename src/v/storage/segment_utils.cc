@@ -49,6 +49,7 @@
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/when_all.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/defer.hh>
 
 #include <absl/container/btree_map.h>
@@ -57,7 +58,9 @@
 #include <fmt/format.h>
 #include <roaring/roaring.hh>
 
+#include <algorithm>
 #include <optional>
+#include <stdexcept>
 
 namespace storage::internal {
 using namespace storage; // NOLINT
@@ -167,12 +170,14 @@ ss::future<segment_appender_ptr> make_segment_appender(
   std::optional<uint64_t> segment_size,
   ss::io_priority_class iopc,
   storage_resources& resources,
-  std::optional<ntp_sanitizer_config> ntp_sanitizer_config) {
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config,
+  size_t preallocated_bytes) {
     return internal::make_writer_handle(path, std::nullopt)
       .then([number_of_chunks,
              iopc,
              path,
              segment_size,
+             preallocated_bytes,
              &resources,
              ntp_sanitizer_config = std::move(ntp_sanitizer_config)](
               ss::file writer) mutable {
@@ -193,10 +198,11 @@ ss::future<segment_appender_ptr> make_segment_appender(
               // NOTE: This try-catch is needed to not uncover the real
               // exception during an OOM condition, since the appender allocates
               // 1MB of memory aligned buffers
+              auto opts = segment_appender::options(
+                iopc, number_of_chunks, segment_size, resources);
+              opts.preallocated_bytes = preallocated_bytes;
               auto appender_ptr = std::make_unique<segment_appender>(
-                writer,
-                segment_appender::options(
-                  iopc, number_of_chunks, segment_size, resources));
+                writer, opts);
 
               if (sanitized_writer) {
                   sanitized_writer->set_pointer_to_appender(appender_ptr.get());
@@ -270,19 +276,85 @@ ss::future<> copy_filtered_entries(
       });
 }
 
+/// Writes the clean index of an index which is already a sorted run, e.g.
+/// the merge of the sorted runs of adjacent segments, in a single pass.
+static ss::future<> copy_sorted_run(
+  compacted_index_reader reader, compacted_index_writer writer) {
+    reader.reset();
+    std::exception_ptr ex;
+    try {
+        co_await reader.consume(index_copy_reducer(writer), model::no_timeout);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    writer.set_flag(
+      compacted_index::footer_flags::self_compaction
+      | compacted_index::footer_flags::sorted_run);
+    co_await writer.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+/// Writes the clean index from the entries collected by sorted_run_reducer
+static ss::future<> write_sorted_run(
+  sorted_run_reducer::entries_t entries, compacted_index_writer writer) {
+    std::exception_ptr ex;
+    try {
+        for (auto& e : entries) {
+            co_await writer.append(std::move(e));
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    writer.set_flag(
+      compacted_index::footer_flags::self_compaction
+      | compacted_index::footer_flags::sorted_run);
+    co_await writer.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
 static ss::future<> do_write_clean_compacted_index(
   compacted_index_reader reader,
   compaction_config cfg,
   storage_resources& resources) {
+    using flags = compacted_index::footer_flags;
     const auto tmpname = std::filesystem::path(
       fmt::format("{}.staging", reader.path()));
-    auto bitmap = co_await natural_index_of_entries_to_keep(reader);
-    auto staging_to_clean = scoped_file_tracker{
-      cfg.files_to_cleanup, {tmpname}};
+    // the keys of a sorted run are fingerprinted like the clean index writer,
+    // created with the same setting, does, so that it keeps them in order
+    const bool fingerprint_keys
+      = config::shard_local_cfg().storage_compaction_index_fingerprint_keys();
     auto truncating_writer = make_file_backed_compacted_index(
       tmpname.string(), cfg.iopc, true, resources, cfg.sanitizer_config);
-    co_await copy_filtered_entries(
-      reader, std::move(bitmap), std::move(truncating_writer));
+    reader.reset();
+    const auto footer = co_await reader.load_footer();
+    std::optional<sorted_run_reducer::entries_t> sorted_run;
+    std::optional<roaring::Roaring> bitmap;
+    if (!bool(footer.flags & flags::sorted_run)) {
+        // the in memory entries take more space than their serialized form
+        if (footer.size <= sorted_run_reducer::default_max_memory_usage) {
+            reader.reset();
+            sorted_run = co_await reader.consume(
+              sorted_run_reducer(fingerprint_keys), model::no_timeout);
+        }
+        if (!sorted_run) {
+            bitmap = co_await natural_index_of_entries_to_keep(reader);
+        }
+    }
+    auto staging_to_clean = scoped_file_tracker{
+      cfg.files_to_cleanup, {tmpname}};
+    if (bitmap) {
+        co_await copy_filtered_entries(
+          reader, std::move(*bitmap), std::move(truncating_writer));
+    } else if (sorted_run) {
+        co_await write_sorted_run(
+          std::move(*sorted_run), std::move(truncating_writer));
+    } else {
+        co_await copy_sorted_run(reader, std::move(truncating_writer));
+    }
     co_await ss::rename_file(std::string(tmpname), ss::sstring(reader.path()));
     staging_to_clean.clear();
 };
@@ -418,7 +490,11 @@ ss::future<storage::index_state> do_copy_segment_data(
       std::move(should_keep),
       appender.get(),
       seg->path().is_internal_topic(),
-      apply_offset);
+      apply_offset,
+      model::offset{},
+      nullptr,
+      cfg.target_compression,
+      &pb);
 
     // create the segment, get the in-memory index for the new segment
     auto new_index = co_await create_segment_full_reader(
@@ -447,7 +523,7 @@ model::record_batch_reader create_segment_full_reader(
     auto o = s->offsets();
     auto reader_cfg = log_reader_config(
       o.base_offset, o.dirty_offset, cfg.iopc);
-    reader_cfg.skip_batch_cache = true;
+    reader_cfg.cache_hint = batch_cache_hint::read_once;
     segment_set::underlying_t set;
     set.reserve(1);
     set.push_back(s);
@@ -870,6 +946,161 @@ ss::future<> rewrite_concatenated_indicies(
       });
 }
 
+namespace {
+
+/// Cursor over the entries of a sorted run index
+class sorted_run_cursor {
+public:
+    explicit sorted_run_cursor(compacted_index_reader reader)
+      : _reader(std::move(reader)) {
+        _reader.reset();
+    }
+
+    /// Loads the next entries when needed, false once the run is exhausted
+    ss::future<bool> fill() {
+        while (_slice.empty() && !_reader.is_end_of_stream()) {
+            _slice = co_await _reader.load_slice(model::no_timeout);
+        }
+        co_return !_slice.empty();
+    }
+
+    compacted_index::entry& front() { return _slice.front(); }
+    void pop_front() { _slice.pop_front(); }
+    const compacted_index_reader& reader() const { return _reader; }
+
+private:
+    compacted_index_reader _reader;
+    ss::circular_buffer<compacted_index::entry> _slice;
+};
+
+/// Merges the sorted runs of \p readers into \p writer, keeping the latest
+/// entry of every key. Only a slice of every run is kept in memory.
+ss::future<> merge_sorted_runs(
+  std::vector<compacted_index_reader>& readers,
+  compacted_index_writer& writer) {
+    std::vector<sorted_run_cursor> cursors;
+    cursors.reserve(readers.size());
+    for (auto& r : readers) {
+        cursors.emplace_back(r);
+    }
+    std::vector<sorted_run_cursor*> live;
+    live.reserve(cursors.size());
+    for (auto& c : cursors) {
+        if (co_await c.fill()) {
+            live.push_back(&c);
+        }
+    }
+
+    // the runs are few, a linear scan for the smallest key beats a heap
+    std::vector<sorted_run_cursor*> matching;
+    std::optional<compaction_key> last_key;
+    while (!live.empty()) {
+        matching.clear();
+        for (auto* c : live) {
+            const auto& key = c->front().key;
+            if (
+              matching.empty()
+              || sorted_run_less(key, matching.front()->front().key)) {
+                matching.clear();
+                matching.push_back(c);
+            } else if (!sorted_run_less(matching.front()->front().key, key)) {
+                matching.push_back(c);
+            }
+        }
+        auto* latest = *std::ranges::max_element(
+          matching, std::less<>{}, [](sorted_run_cursor* c) {
+              return c->front().offset + model::offset(c->front().delta);
+          });
+        auto& key = latest->front().key;
+        if (last_key && !sorted_run_less(*last_key, key)) {
+            throw std::runtime_error(fmt::format(
+              "compacted index {} is not a sorted run",
+              latest->reader().filename()));
+        }
+        last_key = key;
+        co_await writer.append(std::move(latest->front()));
+
+        for (auto* c : matching) {
+            c->pop_front();
+        }
+        for (auto* c : matching) {
+            if (!co_await c->fill()) {
+                std::erase(live, c);
+            }
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+}
+
+/// True if all of \p readers are sorted runs whose keys the writers keep as
+/// they are
+ss::future<bool> are_mergeable_sorted_runs(
+  std::vector<compacted_index_reader>& readers, bool fingerprint_keys) {
+    using flags = compacted_index::footer_flags;
+    for (auto& r : readers) {
+        auto footer = co_await r.load_footer();
+        // without fingerprints in the run the writer could fingerprint some
+        // of its keys, and reorder them
+        const bool has_fingerprints
+          = footer.version >= compacted_index::footer::fingerprint_version;
+        if (
+          !bool(footer.flags & flags::sorted_run)
+          || (fingerprint_keys && !has_fingerprints)) {
+            co_return false;
+        }
+    }
+    co_return true;
+}
+
+/// Writes the index of the concatenation of the segments of \p readers. The
+/// sorted runs of self compacted segments are merged in one pass into a
+/// sorted run holding the latest entry of every key, the other indices are
+/// concatenated.
+ss::future<> write_concatenated_indices(
+  std::filesystem::path target_path,
+  std::vector<compacted_index_reader>& readers,
+  compaction_config cfg,
+  storage_resources& resources) {
+    const bool fingerprint_keys
+      = config::shard_local_cfg().storage_compaction_index_fingerprint_keys();
+    if (co_await are_mergeable_sorted_runs(readers, fingerprint_keys)) {
+        const auto tmpname = std::filesystem::path(
+          fmt::format("{}.staging", target_path.string()));
+        auto staging_to_clean = scoped_file_tracker{
+          cfg.files_to_cleanup, {tmpname}};
+        auto writer = make_file_backed_compacted_index(
+          tmpname.string(), cfg.iopc, true, resources, cfg.sanitizer_config);
+        std::exception_ptr ex;
+        try {
+            co_await merge_sorted_runs(readers, writer);
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        writer.set_flag(compacted_index::footer_flags::sorted_run);
+        co_await writer.close();
+        if (!ex) {
+            co_await ss::rename_file(
+              tmpname.string(), target_path.string());
+            staging_to_clean.clear();
+            co_return;
+        }
+        if (ssx::is_shutdown_exception(ex)) {
+            std::rethrow_exception(ex);
+        }
+        vlog(
+          gclog.info,
+          "failed to merge the sorted runs of {} indices, concatenating "
+          "them instead - {}",
+          readers.size(),
+          ex);
+    }
+    auto writer = co_await make_compacted_index_writer(
+      target_path, cfg.iopc, resources, cfg.sanitizer_config);
+    co_await rewrite_concatenated_indicies(std::move(writer), readers);
+}
+
+} // namespace
+
 ss::future<> do_write_concatenated_compacted_index(
   std::filesystem::path target_path,
   std::vector<ss::lw_shared_ptr<segment>>& segments,
@@ -906,16 +1137,8 @@ ss::future<> do_write_concatenated_compacted_index(
                       if (!verified_successfully) {
                           return ss::now();
                       }
-
-                      return make_compacted_index_writer(
-                               target_path,
-                               cfg.iopc,
-                               resources,
-                               cfg.sanitizer_config)
-                        .then([&readers](compacted_index_writer writer) {
-                            return rewrite_concatenated_indicies(
-                              std::move(writer), readers);
-                        });
+                      return write_concatenated_indices(
+                        std::move(target_path), readers, cfg, resources);
                   })
                   .finally([&readers] {
                       return ss::parallel_for_each(
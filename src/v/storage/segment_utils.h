@@ -128,7 +128,8 @@ ss::future<segment_appender_ptr> make_segment_appender(
   std::optional<uint64_t> segment_size,
   ss::io_priority_class iopc,
   storage_resources& resources,
-  std::optional<ntp_sanitizer_config> ntp_sanitizer_config);
+  std::optional<ntp_sanitizer_config> ntp_sanitizer_config,
+  size_t preallocated_bytes = 0);
 
 size_t number_of_chunks_from_config(const storage::ntp_config&);
 uint64_t segment_size_from_config(const storage::ntp_config&);
@@ -10,6 +10,7 @@
 #include "storage/spill_key_index.h"
 
 #include "bytes/bytes.h"
+#include "config/configuration.h"
 #include "random/generators.h"
 #include "reflection/adl.h"
 #include "storage/compacted_index.h"
@@ -45,7 +46,11 @@ spill_key_index::spill_key_index(
   , _sanitizer_config(std::move(sanitizer_config))
   , _resources(resources)
   , _pc(p)
-  , _truncate(truncate) {}
+  , _truncate(truncate)
+  , _fingerprint_keys(
+      config::shard_local_cfg().storage_compaction_index_fingerprint_keys()) {
+    init_footer();
+}
 
 /**
  * This constructor is only for unit tests, which pre-construct a ss::file
@@ -59,10 +64,27 @@ spill_key_index::spill_key_index(
   : compacted_index_writer::impl(std::move(name))
   , _resources(resources)
   , _pc(ss::default_priority_class())
+  , _fingerprint_keys(
+      config::shard_local_cfg().storage_compaction_index_fingerprint_keys())
   , _appender(storage::segment_appender(
       std::move(dummy_file),
       segment_appender::options(_pc, 1, std::nullopt, _resources)))
-  , _max_mem(max_mem) {}
+  , _max_mem(max_mem) {
+    init_footer();
+}
+
+void spill_key_index::init_footer() {
+    if (_fingerprint_keys) {
+        _footer.version = compacted_index::footer::fingerprint_version;
+    }
+}
+
+compaction_key spill_key_index::maybe_fingerprint(compaction_key key) const {
+    if (_fingerprint_keys && should_fingerprint_key(key)) {
+        return fingerprint_key(key);
+    }
+    return key;
+}
 
 spill_key_index::~spill_key_index() {
     vassert(
@@ -74,6 +96,9 @@ spill_key_index::~spill_key_index() {
 
 ss::future<> spill_key_index::index(
   const compaction_key& v, model::offset base_offset, int32_t delta) {
+    if (_fingerprint_keys && should_fingerprint_key(v)) {
+        return index(fingerprint_key(v), base_offset, delta);
+    }
     return ss::try_with_gate(_gate, [this, &v, base_offset, delta]() {
         if (auto it = _midx.find(v); it != _midx.end()) {
             auto& pair = it->second;
@@ -165,7 +190,8 @@ ss::future<> spill_key_index::index(
        b = std::move(b),
        base_offset,
        delta]() {
-          auto key = enhance_key(batch_type, is_control_batch, b);
+          auto key = maybe_fingerprint(
+            enhance_key(batch_type, is_control_batch, b));
           if (auto it = _midx.find(key); it != _midx.end()) {
               auto& pair = it->second;
               // must use both base+delta, since we only want to keep the
@@ -248,6 +274,9 @@ ss::future<> spill_key_index::spill(
 
 ss::future<> spill_key_index::append(compacted_index::entry e) {
     return ss::try_with_gate(_gate, [this, e = std::move(e)]() mutable {
+        if (e.type == compacted_index::entry_type::key) {
+            e.key = maybe_fingerprint(std::move(e.key));
+        }
         return ss::do_with(std::move(e), [this](compacted_index::entry& e) {
             return spill(e.type, e.key, value_type{e.offset, e.delta});
         });
@@ -115,6 +115,9 @@ private:
         _mem_units.return_units(release_units);
     }
 
+    void init_footer();
+    compaction_key maybe_fingerprint(compaction_key) const;
+
     ss::future<> maybe_open();
     ss::future<> open();
     ss::future<> drain_all_keys();
@@ -125,6 +128,8 @@ private:
     storage_resources& _resources;
     ss::io_priority_class _pc;
     bool _truncate;
+    // store keys longer than a fingerprint as their fingerprint
+    bool _fingerprint_keys;
     std::optional<segment_appender> _appender;
     underlying_t _midx;
 
@@ -16,10 +16,16 @@
 #include "storage/logger.h"
 #include "vlog.h"
 
+#include <seastar/util/defer.hh>
+
 namespace {
 uint64_t per_shard_target_replay_bytes(uint64_t global_target_replay_bytes) {
     return global_target_replay_bytes / ss::smp::count;
 }
+
+uint64_t dma_write_depth(size_t max_inflight) {
+    return max_inflight > 0 ? max_inflight : ss::semaphore::max_counter();
+}
 } // namespace
 
 namespace storage {
@@ -40,10 +46,23 @@ storage_resources::storage_resources(
       _global_target_replay_bytes() / ss::smp::count)
   , _stm_dirty_bytes(_global_target_replay_bytes() / ss::smp::count)
   , _compaction_index_bytes(_compaction_index_mem_limit())
+  , _upload_buffer_mem_limit(
+      config::shard_local_cfg()
+        .cloud_storage_upload_buffer_memory_per_shard.bind())
+  , _upload_buffer_bytes(_upload_buffer_mem_limit(), "s/upload-buffer")
   , _inflight_recovery(
       std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
   , _inflight_close_flush(
-      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1})) {
+      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
+  , _max_inflight_dma_writes(
+      config::shard_local_cfg().storage_max_inflight_dma_writes.bind())
+  , _inflight_dma_writes(
+      dma_write_depth(_max_inflight_dma_writes()), "s/dma-writes")
+  , _flush_coordinator(
+      config::shard_local_cfg().storage_flush_coalescing_window_ms.bind())
+  , _segment_index_lru(
+      config::shard_local_cfg().storage_max_loaded_segment_indices.bind())
+  , _segment_file_pool([this] { return get_falloc_step(std::nullopt); }) {
     // Register notifications on configuration changes
     _global_target_replay_bytes.watch([this]() {
         auto v = per_shard_target_replay_bytes(_global_target_replay_bytes());
@@ -68,6 +87,22 @@ storage_resources::storage_resources(
     _compaction_index_mem_limit.watch([this] {
         _compaction_index_bytes.set_capacity(_compaction_index_mem_limit());
     });
+
+    _upload_buffer_mem_limit.watch([this] {
+        _upload_buffer_bytes.set_capacity(_upload_buffer_mem_limit());
+    });
+
+    _max_inflight_dma_writes.watch([this] {
+        _inflight_dma_writes.set_capacity(
+          dma_write_depth(_max_inflight_dma_writes()));
+    });
+}
+
+ss::future<ssx::semaphore_units> storage_resources::get_dma_write_units() {
+    if (_inflight_dma_writes.available_units() <= 0) {
+        ++_dma_write_stats.throttled;
+    }
+    return _inflight_dma_writes.get_units(1);
 }
 
 // Unit test convenience for tests that want to control the falloc step
@@ -114,6 +149,12 @@ void storage_resources::update_min_checkpoint_bytes() {
     }
 }
 
+void storage_resources::update_device_allowances(
+  std::vector<device_allowance> allowances) {
+    _device_allowances = std::move(allowances);
+    _falloc_step_dirty = true;
+}
+
 void storage_resources::update_partition_count(size_t partition_count) {
     _partition_count = partition_count;
     _falloc_step_dirty = true;
@@ -142,13 +183,26 @@ size_t storage_resources::calc_falloc_step() {
     // is uneven, this may lead to us underestimasting how much space
     // is available, which is safe.
 
-    uint64_t space_free_this_shard = _space_allowance_free / ss::smp::count;
-
     // Only use up to half the available space for fallocs.
-    uint64_t space_per_partition = (space_free_this_shard / 2)
-                                   / (_partition_count);
-
-    step = std::min(space_per_partition, step);
+    auto space_per_partition = [](uint64_t free, size_t partitions) {
+        uint64_t space_free_this_shard = free / ss::smp::count;
+        return (space_free_this_shard / 2) / partitions;
+    };
+
+    size_t primary_partitions = _partition_count;
+    for (const auto& device : _device_allowances) {
+        if (device.partitions == 0) {
+            continue;
+        }
+        primary_partitions -= std::min(primary_partitions, device.partitions);
+        step = std::min(
+          space_per_partition(device.free, device.partitions), step);
+    }
+    if (primary_partitions > 0) {
+        step = std::min(
+          space_per_partition(_space_allowance_free, primary_partitions),
+          step);
+    }
 
     // Round down to nearest append chunk size
     auto remainder = step % _append_chunk_size;
@@ -190,6 +244,26 @@ storage_resources::get_falloc_step(std::optional<uint64_t> segment_size_hint) {
     return step;
 }
 
+ss::future<ssx::semaphore_units>
+storage_resources::get_recovery_units(prioritize_recovery prioritize) {
+    ++_recovery_waiters;
+    auto decrement = ss::defer([this] { --_recovery_waiters; });
+
+    if (prioritize) {
+        ++_prioritized_recovery_waiters;
+        auto units = co_await _inflight_recovery.get_units(1).finally([this] {
+            if (--_prioritized_recovery_waiters == 0) {
+                _prioritized_recovery_done.broadcast();
+            }
+        });
+        co_return units;
+    }
+
+    co_await _prioritized_recovery_done.wait(
+      [this] { return _prioritized_recovery_waiters == 0; });
+    co_return co_await _inflight_recovery.get_units(1);
+}
+
 bool storage_resources::offset_translator_take_bytes(
   int32_t bytes, ssx::semaphore_units& units) {
     vlog(
@@ -251,4 +325,12 @@ storage_resources::compaction_index_take_bytes(size_t bytes) {
     return _compaction_index_bytes.take(bytes);
 }
 
+std::optional<ssx::semaphore_units>
+storage_resources::upload_buffer_take_bytes(size_t bytes) {
+    if (_upload_buffer_bytes.available_units() < static_cast<ssize_t>(bytes)) {
+        return std::nullopt;
+    }
+    return _upload_buffer_bytes.take(bytes).units;
+}
+
 } // namespace storage
@@ -13,15 +13,26 @@
 
 #include "config/property.h"
 #include "ssx/semaphore.h"
+#include "storage/flush_coordinator.h"
+#include "storage/segment_file_pool.h"
+#include "storage/segment_index.h"
 #include "units.h"
 #include "utils/adjustable_semaphore.h"
 
+#include <seastar/core/condition-variable.hh>
+#include <seastar/util/bool_class.hh>
+
 #include <cstdint>
+#include <vector>
 
 namespace storage {
 
 class node_api;
 
+/// Prioritized log recoveries are granted recovery units ahead of the
+/// regular ones, e.g. for partitions that are likely to become leaders.
+using prioritize_recovery = ss::bool_class<struct prioritize_recovery_tag>;
+
 /**
  * This class is used by various storage components to control consumption
  * of shared system resources.  It broadly does this in two ways:
@@ -53,6 +64,20 @@ public:
      */
     void update_partition_count(size_t partition_count);
 
+    struct device_allowance {
+        uint64_t free{0};
+        // partitions of this shard on the device
+        size_t partitions{0};
+    };
+
+    /**
+     * Call this when the disk space of the data directories other than the
+     * one of update_allowance() is refreshed. The partitions placed on those
+     * devices count against the free space of their own device, and the
+     * fallocation step is the smallest one of the devices.
+     */
+    void update_device_allowances(std::vector<device_allowance>);
+
     uint64_t get_space_allowance() { return _space_allowance; }
 
     size_t get_falloc_step(std::optional<uint64_t>);
@@ -71,9 +96,24 @@ public:
         return _compaction_index_bytes.current() > 0;
     }
 
-    ss::future<ssx::semaphore_units> get_recovery_units() {
-        return _inflight_recovery.get_units(1);
-    }
+    /**
+     * Units for \p bytes of segment upload buffers, nullopt if the memory of
+     * the upload buffers of this shard is exhausted (the buffers are disabled
+     * when cloud_storage_upload_buffer_memory_per_shard is zero).
+     */
+    std::optional<ssx::semaphore_units> upload_buffer_take_bytes(size_t bytes);
+
+    ss::future<ssx::semaphore_units>
+      get_recovery_units(prioritize_recovery = prioritize_recovery::no);
+
+    /// Number of log recoveries waiting for recovery units
+    size_t recovery_waiters() const { return _recovery_waiters; }
+
+    flush_coordinator& get_flush_coordinator() { return _flush_coordinator; }
+
+    segment_index_lru& get_segment_index_lru() { return _segment_index_lru; }
+
+    segment_file_pool& get_segment_file_pool() { return _segment_file_pool; }
 
     ss::future<ssx::semaphore_units> get_close_flush_units() {
         return _inflight_close_flush.get_units(1);
@@ -83,6 +123,34 @@ public:
         return _inflight_compaction_compression.get_units(1);
     }
 
+    struct dma_write_stats {
+        // DMA writes dispatched by the segment appenders
+        uint64_t dispatched{0};
+        // appends merged into a write queued for dispatch
+        uint64_t merged{0};
+        // writes which waited for the queue depth limit
+        uint64_t throttled{0};
+        // large chunks taken by appenders
+        uint64_t large_chunks{0};
+        // writes submitted to the device and not completed yet
+        size_t inflight{0};
+    };
+
+    /**
+     * Units for one DMA write of a segment appender. All the segments of the
+     * node share the data device, so the units bound the write queue depth
+     * of this shard on the device (storage_max_inflight_dma_writes).
+     */
+    ss::future<ssx::semaphore_units> get_dma_write_units();
+
+    /// The configured queue depth, zero if unlimited.
+    size_t dma_write_queue_depth() const { return _max_inflight_dma_writes(); }
+
+    dma_write_stats& get_dma_write_stats() { return _dma_write_stats; }
+    const dma_write_stats& get_dma_write_stats() const {
+        return _dma_write_stats;
+    }
+
     /**
      * An adjustable_semaphore will set checkpoint_hint whenever its units
      * are exhausted, but this can happen with pathological frequency if
@@ -123,6 +191,9 @@ private:
     size_t _falloc_step{0};
     bool _falloc_step_dirty{false};
 
+    // the extra data directories of the node, see update_device_allowances
+    std::vector<device_allowance> _device_allowances;
+
     // These 'dirty_bytes' semaphores control how many bytes
     // may be written to logs in between checkpoints/snapshots, in
     // order to limit the quantity of data that must be replayed after
@@ -144,9 +215,19 @@ private:
     // use for their spill_key_index objects
     adjustable_semaphore _compaction_index_bytes{0};
 
+    // How much memory may the segments on this shard use for copies of
+    // their appended data, read by the tiered storage uploads
+    config::binding<size_t> _upload_buffer_mem_limit;
+    adjustable_semaphore _upload_buffer_bytes;
+
     // How many logs may be recovered (via log_manager::manage)
     // concurrently?
     adjustable_semaphore _inflight_recovery{0};
+    size_t _recovery_waiters{0};
+    // Regular recoveries do not queue for the units while there are
+    // prioritized ones waiting
+    size_t _prioritized_recovery_waiters{0};
+    ss::condition_variable _prioritized_recovery_done;
 
     // How many logs may be flushed during segment close concurrently?
     // (e.g. when we shut down and ask everyone to flush)
@@ -156,6 +237,21 @@ private:
     // memory footprint compared with the batch's original size, we must
     // limit how many of these we do in parallel.
     adjustable_semaphore _inflight_compaction_compression{1};
+
+    // How many DMA writes may the segment appenders on this shard have
+    // submitted to the device at once?
+    config::binding<size_t> _max_inflight_dma_writes;
+    adjustable_semaphore _inflight_dma_writes;
+    dma_write_stats _dma_write_stats;
+
+    // Coalesces the segment flushes of all logs on this shard
+    flush_coordinator _flush_coordinator;
+
+    // Bounds the number of loaded indices of closed segments on this shard
+    segment_index_lru _segment_index_lru;
+
+    // Pre-created segment files of this shard, started by the log_manager
+    segment_file_pool _segment_file_pool;
 };
 
 } // namespace storage
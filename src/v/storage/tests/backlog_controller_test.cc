@@ -7,8 +7,10 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/mock_property.h"
 #include "seastarx.h"
 #include "storage/backlog_controller.h"
+#include "storage/backlog_coordinator.h"
 #include "test_utils/async.h"
 #include "test_utils/fixture.h"
 
@@ -19,6 +21,7 @@
 #include <seastar/core/reactor.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/log.hh>
 
 #include <cstdint>
@@ -101,3 +104,35 @@ FIXTURE_TEST(test_feedback_loop, backlog_controller_fixture) {
         return get_current_cpu_shares() == 800;
     }).get();
 }
+
+SEASTAR_THREAD_TEST_CASE(test_coordinator_shares_out_budget) {
+    config::mock_property<std::optional<int32_t>> budget(std::nullopt);
+    config::mock_property<std::optional<std::chrono::milliseconds>> target(
+      std::nullopt);
+    storage::backlog_coordinator coordinator(budget.bind(), target.bind());
+    int compaction = 0;
+    int upload = 0;
+
+    // without a budget the demands are granted
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&compaction, {500, 10, 1}), 500);
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&upload, {500, 10, 2}), 500);
+
+    // demands within the budget are granted
+    budget.update(1000);
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&compaction, {500, 10, 1}), 500);
+
+    // beyond it, the budget is shared out by demand and priority
+    budget.update(600);
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&compaction, {500, 10, 1}), 200);
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&upload, {500, 10, 2}), 400);
+    // but a controller always keeps its minimum shares
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&compaction, {10, 10, 1}), 10);
+
+    // the budget shrinks while the foreground latency is above target
+    target.update(10ms);
+    coordinator.record_foreground_latency(20ms);
+    BOOST_REQUIRE_EQUAL(*coordinator.budget(), 300);
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&compaction, {500, 10, 1}), 100);
+    coordinator.remove(&upload);
+    BOOST_REQUIRE_EQUAL(coordinator.grant(&compaction, {500, 10, 1}), 300);
+}
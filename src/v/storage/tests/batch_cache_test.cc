@@ -311,3 +311,26 @@ FIXTURE_TEST(test_random_batch_sizes, batch_cache_test_fixture) {
         BOOST_REQUIRE_LE(r.waste(), max_waste);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(admission_filter_admits_second_read) {
+    auto filtered_opts = opts;
+    filtered_opts.admission_filter = true;
+    storage::batch_cache cache(filtered_opts);
+    auto stop = ss::defer([&cache] { cache.stop().get(); });
+    {
+        storage::batch_cache_index index(cache);
+        const auto read = storage::batch_cache::disk_read::yes;
+
+        // a batch read once from disk is not cached
+        index.put(make_batch(10, model::offset(0)), read);
+        BOOST_CHECK(!index.get(model::offset(0)));
+
+        // it is on the second read
+        index.put(make_batch(10, model::offset(0)), read);
+        BOOST_CHECK(index.get(model::offset(0)));
+
+        // appended batches bypass the filter
+        index.put(make_batch(10, model::offset(10)));
+        BOOST_CHECK(index.get(model::offset(10)));
+    }
+}
@@ -9,6 +9,7 @@
 
 #include "bytes/bytes.h"
 #include "bytes/iobuf_parser.h"
+#include "config/configuration.h"
 #include "random/generators.h"
 #include "reflection/adl.h"
 #include "storage/compacted_index.h"
@@ -24,6 +25,8 @@
 #include "utils/tmpbuf_file.h"
 #include "utils/vint.h"
 
+#include <seastar/util/defer.hh>
+
 #include <boost/test/unit_test_suite.hpp>
 
 storage::compacted_index_writer make_dummy_compacted_index(
@@ -522,3 +525,69 @@ FIXTURE_TEST(v0_footers_compatibility, compacted_topic_fixture) {
           storage::compacted_index::needs_rebuild_error);
     }
 }
+
+FIXTURE_TEST(format_verification_fingerprint_keys, compacted_topic_fixture) {
+    config::shard_local_cfg()
+      .get("storage_compaction_index_fingerprint_keys")
+      .set_value(true);
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg()
+          .get("storage_compaction_index_fingerprint_keys")
+          .reset();
+    });
+
+    tmpbuf_file::store_t index_data;
+    auto idx = make_dummy_compacted_index(index_data, 1_MiB, resources);
+    const auto long_key = random_generators::get_bytes(1024);
+    const auto short_key = random_generators::get_bytes(8);
+    auto bt = tests::random_batch_type();
+    auto is_control = tests::random_bool();
+    idx.index(bt, is_control, bytes(long_key), model::offset(42), 66).get();
+    idx.index(bt, is_control, bytes(long_key), model::offset(43), 0).get();
+    idx.index(bt, is_control, bytes(short_key), model::offset(44), 0).get();
+    idx.close().get();
+    info("{}", idx);
+
+    auto rdr = storage::make_file_backed_compacted_reader(
+      storage::segment_full_path::mock("dummy name"),
+      ss::file(ss::make_shared(tmpbuf_file(index_data))),
+      ss::default_priority_class(),
+      32_KiB);
+    rdr.verify_integrity().get();
+    auto footer = rdr.load_footer().get0();
+    BOOST_REQUIRE_EQUAL(footer.keys, 2);
+    BOOST_REQUIRE_EQUAL(
+      footer.version, storage::compacted_index::footer::fingerprint_version);
+    auto vec = compaction_index_reader_to_memory(std::move(rdr)).get0();
+    BOOST_REQUIRE_EQUAL(vec.size(), 2);
+
+    // long keys are stored as the fingerprint of the enhanced key
+    const auto fingerprint = storage::fingerprint_key(
+      storage::enhance_key(bt, is_control, long_key));
+    const auto short_enhanced = storage::enhance_key(bt, is_control, short_key);
+    BOOST_REQUIRE_EQUAL(
+      fingerprint.size(), storage::compacted_index::fingerprint_size);
+    size_t matched = 0;
+    for (const auto& e : vec) {
+        if (e.key == fingerprint) {
+            BOOST_REQUIRE_EQUAL(e.offset, model::offset(43));
+            ++matched;
+        } else {
+            BOOST_REQUIRE_EQUAL(e.key, short_enhanced);
+            BOOST_REQUIRE_EQUAL(e.offset, model::offset(44));
+            ++matched;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(matched, 2);
+
+    // the fingerprint retains the key prefix and depends on the whole key
+    BOOST_REQUIRE(std::equal(
+      fingerprint.begin(),
+      fingerprint.begin() + storage::compacted_index::key_prefix_size,
+      short_enhanced.begin()));
+    auto other_key = long_key;
+    other_key[other_key.size() - 1] ^= 1;
+    BOOST_REQUIRE(
+      storage::fingerprint_key(storage::enhance_key(bt, is_control, other_key))
+      != fingerprint);
+}
@@ -4,6 +4,9 @@
 
 #include <seastar/testing/thread_test_case.hh>
 
+#include <algorithm>
+#include <vector>
+
 SEASTAR_THREAD_TEST_CASE(compaction_reducer_key_clash_test) {
     // Insert three elements with the same key in the reducer
     // and validate that the one with the largest offset wins.
@@ -59,3 +62,52 @@ SEASTAR_THREAD_TEST_CASE(compaction_reducer_max_mem_usage_test) {
         BOOST_REQUIRE_LE(reducer.idx_mem_usage(), 16_KiB);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(sorted_run_reducer_test) {
+    // The latest entry of every key is kept, ordered by key
+    storage::internal::sorted_run_reducer reducer{false, 16_KiB};
+
+    std::vector<bytes> keys;
+    for (size_t i = 0; i < 50; ++i) {
+        keys.push_back(random_generators::get_bytes(20));
+    }
+    for (size_t i = 0; i < 200; ++i) {
+        storage::compacted_index::entry entry(
+          storage::compacted_index::entry_type::key,
+          storage::compaction_key(keys[i % keys.size()]),
+          model::offset(i),
+          0);
+        BOOST_REQUIRE(
+          reducer(std::move(entry)).get() == ss::stop_iteration::no);
+    }
+
+    auto entries = reducer.end_of_stream();
+    BOOST_REQUIRE(entries.has_value());
+    BOOST_REQUIRE_EQUAL(entries->size(), keys.size());
+    for (size_t i = 0; i < entries->size(); ++i) {
+        const auto& e = (*entries)[i];
+        if (i > 0) {
+            BOOST_REQUIRE(
+              storage::sorted_run_less((*entries)[i - 1].key, e.key));
+        }
+        auto key_idx = std::distance(
+          keys.begin(), std::find(keys.begin(), keys.end(), e.key));
+        BOOST_REQUIRE_EQUAL(e.offset, model::offset(150 + key_idx));
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(sorted_run_reducer_max_mem_usage_test) {
+    storage::internal::sorted_run_reducer reducer{false, 16_KiB};
+
+    auto stop = ss::stop_iteration::no;
+    for (size_t i = 0; i < 1000 && stop == ss::stop_iteration::no; ++i) {
+        storage::compacted_index::entry entry(
+          storage::compacted_index::entry_type::key,
+          storage::compaction_key(random_generators::get_bytes(20)),
+          model::offset(i),
+          0);
+        stop = reducer(std::move(entry)).get();
+    }
+    BOOST_REQUIRE(stop == ss::stop_iteration::yes);
+    BOOST_REQUIRE(!reducer.end_of_stream().has_value());
+}
@@ -0,0 +1,107 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "random/generators.h"
+#include "storage/eytzinger_index.h"
+#include "utils/fragmented_vector.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+constexpr size_t inner_iters = 1000;
+
+// an index entry every few offsets, as produced by a segment of small batches
+fragmented_vector<uint32_t> make_offsets(size_t entries) {
+    fragmented_vector<uint32_t> ret;
+    uint32_t offset = 0;
+    for (size_t i = 0; i < entries; ++i) {
+        ret.push_back(offset);
+        offset += random_generators::get_int<uint32_t>(1, 64);
+    }
+    return ret;
+}
+
+std::vector<uint32_t>
+make_needles(const fragmented_vector<uint32_t>& offsets) {
+    std::vector<uint32_t> ret;
+    ret.reserve(inner_iters);
+    for (size_t i = 0; i < inner_iters; ++i) {
+        ret.push_back(random_generators::get_int<uint32_t>(0, offsets.back()));
+    }
+    return ret;
+}
+
+// the search segment_index::find_nearest used before the eytzinger layout
+std::optional<size_t>
+lower_bound_find(const fragmented_vector<uint32_t>& offsets, uint32_t needle) {
+    auto it = std::lower_bound(
+      offsets.begin(), offsets.end(), needle, std::less<uint32_t>{});
+    if (it == offsets.end()) {
+        it = std::prev(it);
+    }
+    int i = std::distance(offsets.begin(), it);
+    do {
+        if (offsets[i] <= needle) {
+            return i;
+        }
+    } while (i-- > 0);
+    return std::nullopt;
+}
+
+struct index_search_bench {
+    explicit index_search_bench(size_t entries)
+      : offsets(make_offsets(entries))
+      , needles(make_needles(offsets)) {
+        layout.build(offsets);
+    }
+
+    size_t run_lower_bound() {
+        perf_tests::start_measuring_time();
+        for (auto needle : needles) {
+            perf_tests::do_not_optimize(lower_bound_find(offsets, needle));
+        }
+        perf_tests::stop_measuring_time();
+        return needles.size();
+    }
+
+    size_t run_eytzinger() {
+        perf_tests::start_measuring_time();
+        for (auto needle : needles) {
+            perf_tests::do_not_optimize(layout.find(needle));
+        }
+        perf_tests::stop_measuring_time();
+        return needles.size();
+    }
+
+    fragmented_vector<uint32_t> offsets;
+    std::vector<uint32_t> needles;
+    storage::eytzinger_index layout;
+};
+
+// a 128MiB segment at the default 32KiB index step
+struct index_search_4k : index_search_bench {
+    index_search_4k()
+      : index_search_bench(4096) {}
+};
+
+struct index_search_16k : index_search_bench {
+    index_search_16k()
+      : index_search_bench(storage::eytzinger_index::max_entries) {}
+};
+
+} // namespace
+
+PERF_TEST_F(index_search_4k, lower_bound) { return run_lower_bound(); }
+PERF_TEST_F(index_search_4k, eytzinger) { return run_eytzinger(); }
+PERF_TEST_F(index_search_16k, lower_bound) { return run_lower_bound(); }
+PERF_TEST_F(index_search_16k, eytzinger) { return run_eytzinger(); }
@@ -0,0 +1,61 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/property.h"
+#include "storage/flush_coordinator.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/future-util.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace std::chrono_literals; // NOLINT
+
+namespace {
+ss::file open_file(const ss::sstring& name) {
+    return ss::open_file_dma(name, ss::open_flags::rw | ss::open_flags::create)
+      .get0();
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_flush_coordinator_pass_through) {
+    storage::flush_coordinator coordinator(config::mock_binding(0ms));
+    auto f = open_file("flush_coordinator_pass_through.log");
+    int owner = 0;
+    coordinator.flush(&owner, f).get();
+    coordinator.flush(&owner, f).get();
+    coordinator.stop().get();
+    f.close().get();
+    ss::remove_file("flush_coordinator_pass_through.log").get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_flush_coordinator_coalesces) {
+    storage::flush_coordinator coordinator(config::mock_binding(1ms));
+    auto f1 = open_file("flush_coordinator_coalesces_1.log");
+    auto f2 = open_file("flush_coordinator_coalesces_2.log");
+    int owner1 = 0;
+    int owner2 = 0;
+
+    // all the requests land in one window: one flush per owner
+    std::vector<ss::future<>> flushes;
+    flushes.push_back(coordinator.flush(&owner1, f1));
+    flushes.push_back(coordinator.flush(&owner1, f1));
+    flushes.push_back(coordinator.flush(&owner2, f2));
+    ss::when_all_succeed(flushes.begin(), flushes.end()).get();
+
+    // requests queued at stop are dispatched rather than dropped
+    auto pending = coordinator.flush(&owner1, f1);
+    coordinator.stop().get();
+    pending.get();
+
+    f1.close().get();
+    f2.close().get();
+    ss::remove_file("flush_coordinator_coalesces_1.log").get();
+    ss::remove_file("flush_coordinator_coalesces_2.log").get();
+}
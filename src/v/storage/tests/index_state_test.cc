@@ -36,6 +36,22 @@ static storage::index_state make_random_index_state(
           random_generators::get_int<uint64_t>());
     }
 
+    if (
+      apply_offset == storage::offset_delta_time::yes
+      && random_generators::get_int(0, 1) == 1) {
+        st.with_zone_maps = true;
+        for (auto i = 0; i < n; ++i) {
+            st.zone_min_time_index.push_back(
+              random_generators::get_int<int64_t>());
+            st.zone_max_time_index.push_back(
+              random_generators::get_int<int64_t>());
+            for (size_t w = 0; w < storage::key_sketch::words; ++w) {
+                st.zone_key_sketch_index.push_back(
+                  random_generators::get_int<uint64_t>());
+            }
+        }
+    }
+
     if (apply_offset == storage::offset_delta_time::no) {
         fragmented_vector<uint32_t> time_index;
         for (auto i = 0; i < n; ++i) {
@@ -218,6 +234,72 @@ BOOST_AUTO_TEST_CASE(serde_deprecated_crc) {
       });
 }
 
+BOOST_AUTO_TEST_CASE(key_sketch_test) {
+    storage::key_sketch s;
+    std::vector<uint64_t> added;
+    for (int i = 0; i < 50; ++i) {
+        auto key = bytes_to_iobuf(random_generators::get_bytes(16));
+        added.push_back(storage::key_sketch::hash(key));
+        s.add(added.back());
+    }
+    for (auto h : added) {
+        BOOST_REQUIRE(s.may_contain(h));
+    }
+    size_t false_positives = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto key = bytes_to_iobuf(random_generators::get_bytes(16));
+        false_positives += s.may_contain(storage::key_sketch::hash(key));
+    }
+    // about 1% for 50 keys
+    BOOST_REQUIRE_LT(false_positives, 100);
+    BOOST_REQUIRE(storage::key_sketch::saturated().may_contain(added[0]));
+}
+
+BOOST_AUTO_TEST_CASE(zone_maps_test) {
+    auto st = storage::index_state::make_empty_index(
+      storage::offset_delta_time::yes);
+    st.with_zone_maps = true;
+    iobuf key_buf;
+    key_buf.append("key", 3);
+    auto key = storage::key_sketch::hash(key_buf);
+    storage::key_sketch with_key;
+    with_key.add(key);
+
+    // two entries of two batches each, the timestamps of the second batch of
+    // the first entry are higher than the ones of the second entry.
+    auto track = [&st](
+                   int64_t ts, bool new_entry, const storage::key_sketch& k) {
+        if (new_entry) {
+            st.add_entry(
+              st.size(),
+              storage::offset_time_index{
+                model::timestamp(0), storage::offset_delta_time::yes},
+              st.size());
+        }
+        st.track_zone(
+          new_entry, model::timestamp(ts), model::timestamp(ts), true, k);
+    };
+    track(10, true, {});
+    track(100, false, {});
+    track(20, true, {});
+    track(30, false, with_key);
+    BOOST_REQUIRE(st.has_zone_maps());
+
+    BOOST_REQUIRE(st.find_zone(model::timestamp(5)) == size_t(0));
+    BOOST_REQUIRE(st.find_zone(model::timestamp(50)) == size_t(0));
+    BOOST_REQUIRE(!st.find_zone(model::timestamp(101)).has_value());
+    BOOST_REQUIRE(st.find_zone(0, key) == size_t(1));
+    BOOST_REQUIRE(st.find_zone(1, key) == size_t(1));
+
+    // zone maps survive a round trip and truncation
+    auto output = serde::from_iobuf<storage::index_state>(
+      serde::to_iobuf(st.copy()));
+    BOOST_REQUIRE_EQUAL(output, st);
+    output.pop_back();
+    BOOST_REQUIRE(output.has_zone_maps());
+    BOOST_REQUIRE(!output.find_zone(0, key).has_value());
+}
+
 BOOST_AUTO_TEST_CASE(offset_time_index_test) {
     // Before offsetting: [0, ..., 2 ^ 31 - 1, ..., 2 ^ 32 - 1]
     //                    |             |              |
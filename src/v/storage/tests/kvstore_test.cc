@@ -18,6 +18,8 @@
 #include <seastar/testing/thread_test_case.hh>
 #include <seastar/util/file.hh>
 
+#include <unordered_set>
+
 template<typename T>
 static void set_configuration(ss::sstring p_name, T v) {
     ss::smp::invoke_on_all([p_name, v = std::move(v)] {
@@ -187,3 +189,50 @@ FIXTURE_TEST(kvstore, kvstore_test_fixture) {
     }
     kvs->stop().get();
 }
+
+FIXTURE_TEST(kvstore_larger_than_segments, kvstore_test_fixture) {
+    set_configuration("disable_metrics", true);
+
+    // the database is much larger than a segment, so segments are rolled
+    // many times between snapshots and recovery replays all of them
+    std::unordered_map<bytes, iobuf> truth;
+    for (int round = 0; round < 3; ++round) {
+        auto kvs = make_kvstore();
+        kvs->start().get();
+        for (auto& e : truth) {
+            BOOST_REQUIRE(
+              kvs->get(storage::kvstore::key_space::testing, e.first).value()
+              == e.second);
+        }
+        for (int batch = 0; batch < 20; ++batch) {
+            // puts in a batch are flushed together; a key is only written once
+            // per batch so that the order of its updates doesn't matter
+            std::vector<ss::future<>> puts;
+            std::unordered_set<bytes> batch_keys;
+            for (int i = 0; i < 50; ++i) {
+                auto key = random_generators::get_bytes(1);
+                if (!batch_keys.insert(key).second) {
+                    continue;
+                }
+                auto value = bytes_to_iobuf(
+                  random_generators::get_bytes(1024));
+                truth[key] = value.copy();
+                puts.push_back(kvs->put(
+                  storage::kvstore::key_space::testing,
+                  std::move(key),
+                  std::move(value)));
+            }
+            ss::when_all_succeed(puts.begin(), puts.end()).get();
+        }
+        kvs->stop().get();
+    }
+
+    auto kvs = make_kvstore();
+    kvs->start().get();
+    for (auto& e : truth) {
+        BOOST_REQUIRE(
+          kvs->get(storage::kvstore::key_space::testing, e.first).value()
+          == e.second);
+    }
+    kvs->stop().get();
+}
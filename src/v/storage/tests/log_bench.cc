@@ -0,0 +1,196 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/fundamental.h"
+#include "model/record_batch_reader.h"
+#include "model/tests/random_batch.h"
+#include "random/generators.h"
+#include "storage/tests/utils/disk_log_builder.h"
+#include "units.h"
+
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+/*
+ * Benchmarks of the hot paths of a local partition log over real files:
+ * appends with flushes, full scans from the batch cache and from disk,
+ * segment rolls and size based retention.
+ *
+ * The batches are drawn from a pool mimicking produce traffic: mostly small
+ * batches of a few records, with a tail of large ones.
+ */
+namespace {
+
+constexpr size_t batch_pool_size = 256;
+constexpr size_t batches_per_append = 16;
+constexpr size_t prefill_batches = 4096;
+constexpr size_t retention_segments = 64;
+constexpr size_t batches_per_segment = 8;
+
+int random_record_count() {
+    auto p = random_generators::get_int(99);
+    if (p < 50) {
+        return random_generators::get_int(1, 4);
+    } else if (p < 90) {
+        return random_generators::get_int(5, 50);
+    }
+    return random_generators::get_int(51, 500);
+}
+
+ss::circular_buffer<model::record_batch> make_batch_pool() {
+    ss::circular_buffer<model::record_batch> pool;
+    for (size_t i = 0; i < batch_pool_size; ++i) {
+        auto records = random_record_count();
+        std::vector<size_t> sizes;
+        sizes.reserve(records);
+        for (int r = 0; r < records; ++r) {
+            sizes.push_back(random_generators::get_int<size_t>(64, 2048));
+        }
+        pool.push_back(model::test::make_random_batch(
+          model::test::record_batch_spec{
+            .allow_compression = false,
+            .records = records,
+            .record_sizes = std::move(sizes)}));
+    }
+    return pool;
+}
+
+struct batch_counter {
+    ss::future<ss::stop_iteration> operator()(model::record_batch&) {
+        ++batches;
+        return ss::make_ready_future<ss::stop_iteration>(
+          ss::stop_iteration::no);
+    }
+    size_t end_of_stream() const { return batches; }
+
+    size_t batches{0};
+};
+
+storage::log_append_config no_fsync_config() {
+    return storage::log_append_config{
+      .should_fsync = storage::log_append_config::fsync::no,
+      .io_priority = ss::default_priority_class(),
+      .timeout = model::no_timeout};
+}
+
+} // namespace
+
+class log_bench_fixture {
+public:
+    explicit log_bench_fixture(
+      storage::with_cache cache = storage::with_cache::yes)
+      : _builder(storage::log_config(
+        storage::random_dir(), 1_GiB, ss::default_priority_class(), cache))
+      , _pool(make_batch_pool()) {
+        _builder.start().get();
+    }
+
+    log_bench_fixture(const log_bench_fixture&) = delete;
+    log_bench_fixture& operator=(const log_bench_fixture&) = delete;
+    log_bench_fixture(log_bench_fixture&&) = delete;
+    log_bench_fixture& operator=(log_bench_fixture&&) = delete;
+
+    ~log_bench_fixture() { _builder.stop().get(); }
+
+protected:
+    storage::log& log() { return *_builder.get_log(); }
+
+    /// Appends n batches of the pool, returning the number of records.
+    size_t append(size_t n) {
+        ss::circular_buffer<model::record_batch> batches;
+        size_t records = 0;
+        for (size_t i = 0; i < n; ++i) {
+            auto& b = _pool[_next++ % _pool.size()];
+            records += b.record_count();
+            batches.push_back(b.copy());
+        }
+        model::make_memory_record_batch_reader(std::move(batches))
+          .for_each_ref(
+            log().make_appender(no_fsync_config()), model::no_timeout)
+          .get();
+        return records;
+    }
+
+    size_t scan() {
+        auto reader = log().make_reader(storage::reader_config()).get();
+        return std::move(reader)
+          .consume(batch_counter{}, model::no_timeout)
+          .get();
+    }
+
+    void prefill() {
+        if (_prefilled) {
+            return;
+        }
+        for (size_t i = 0; i < prefill_batches; i += batches_per_append) {
+            append(batches_per_append);
+        }
+        log().flush().get();
+        _prefilled = true;
+    }
+
+    storage::disk_log_builder _builder;
+
+private:
+    ss::circular_buffer<model::record_batch> _pool;
+    size_t _next{0};
+    bool _prefilled{false};
+};
+
+struct uncached_log_bench_fixture : log_bench_fixture {
+    uncached_log_bench_fixture()
+      : log_bench_fixture(storage::with_cache::no) {}
+};
+
+PERF_TEST_F(log_bench_fixture, append_flush) {
+    perf_tests::start_measuring_time();
+    auto records = append(batches_per_append);
+    log().flush().get();
+    perf_tests::stop_measuring_time();
+    return records;
+}
+
+PERF_TEST_F(log_bench_fixture, scan_batch_cache) {
+    prefill();
+    perf_tests::start_measuring_time();
+    auto batches = scan();
+    perf_tests::stop_measuring_time();
+    return batches;
+}
+
+PERF_TEST_F(uncached_log_bench_fixture, scan_disk) {
+    prefill();
+    perf_tests::start_measuring_time();
+    auto batches = scan();
+    perf_tests::stop_measuring_time();
+    return batches;
+}
+
+PERF_TEST_F(log_bench_fixture, segment_roll) {
+    append(1);
+    perf_tests::start_measuring_time();
+    log().force_roll(ss::default_priority_class()).get();
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST_F(log_bench_fixture, size_retention) {
+    for (size_t i = 0; i < retention_segments; ++i) {
+        append(batches_per_segment);
+        log().force_roll(ss::default_priority_class()).get();
+    }
+    auto before = log().segment_count();
+
+    perf_tests::start_measuring_time();
+    _builder.gc(model::timestamp::min(), 0).get();
+    perf_tests::stop_measuring_time();
+
+    return before - log().segment_count();
+}
@@ -0,0 +1,70 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/fundamental.h"
+#include "model/namespace.h"
+#include "storage/log_directories.h"
+#include "storage/ntp_config.h"
+#include "test_utils/tmp_dir.h"
+
+#include <seastar/core/seastar.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+using storage::log_directories;
+
+namespace {
+
+storage::ntp_config make_ntp_config(int partition, const ss::sstring& dir) {
+    return storage::ntp_config(
+      model::ntp(
+        model::kafka_namespace,
+        model::topic("tapioca"),
+        model::partition_id(partition)),
+      dir);
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_place_new_partitions) {
+    temporary_dir base("log_directories");
+    temporary_dir extra("log_directories");
+    log_directories dirs(
+      base.get_path().string(), {extra.get_path().string()});
+    BOOST_REQUIRE(dirs.multiple());
+
+    // both directories are on the same filesystem, so the partitions are
+    // spread by count
+    auto first = dirs.place(make_ntp_config(0, base.get_path().string())).get();
+    auto second
+      = dirs.place(make_ntp_config(1, base.get_path().string())).get();
+    BOOST_REQUIRE_NE(first, second);
+    for (const auto& d : dirs.get()) {
+        BOOST_REQUIRE_EQUAL(d.partitions, 1);
+        BOOST_REQUIRE_GT(d.total, 0);
+    }
+
+    dirs.remove_partition(extra.get_path().string());
+    auto third = dirs.place(make_ntp_config(2, base.get_path().string())).get();
+    BOOST_REQUIRE_EQUAL(third, extra.get_path().string());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_partition_stays_with_its_data) {
+    temporary_dir base("log_directories");
+    temporary_dir extra("log_directories");
+    log_directories dirs(
+      base.get_path().string(), {extra.get_path().string()});
+    // a directory with more partitions doesn't attract new ones
+    dirs.add_partition(extra.get_path().string());
+    dirs.add_partition(extra.get_path().string());
+
+    auto cfg = make_ntp_config(0, extra.get_path().string());
+    ss::recursive_touch_directory(cfg.work_directory()).get();
+    BOOST_REQUIRE_EQUAL(dirs.place(cfg).get(), extra.get_path().string());
+    BOOST_REQUIRE_EQUAL(dirs.get().back().partitions, 3);
+}
@@ -443,3 +443,27 @@ FIXTURE_TEST(non_collectible_disk_usage_test, gc_fixture) {
 
     builder | storage::stop();
 }
+
+FIXTURE_TEST(housekeeping_estimate_size, gc_fixture) {
+    builder | storage::start() | storage::add_segment(0)
+      | storage::add_random_batch(0, 100, storage::maybe_compress_batches::yes)
+      | storage::add_segment(100)
+      | storage::add_random_batch(100, 2, storage::maybe_compress_batches::yes);
+    auto part_size = builder.get_disk_log_impl().get_probe().partition_size();
+
+    BOOST_TEST_MESSAGE("Should have no work under the retention size");
+    auto estimate = builder.get_log()->estimate_housekeeping(
+      storage::gc_config(model::timestamp(1), part_size));
+    BOOST_CHECK(!estimate.gc_due);
+    BOOST_CHECK(!estimate.has_work());
+    BOOST_CHECK_EQUAL(estimate.size_bytes, part_size);
+
+    BOOST_TEST_MESSAGE("Should be due over the retention size");
+    estimate = builder.get_log()->estimate_housekeeping(
+      storage::gc_config(model::timestamp(1), std::optional<size_t>(0)));
+    BOOST_CHECK(estimate.gc_due);
+
+    builder
+      | storage::garbage_collect(model::timestamp(1), std::optional<size_t>(0))
+      | storage::stop();
+}
@@ -284,6 +284,42 @@ SEASTAR_THREAD_TEST_CASE(test_can_append_10MB) {
     run_test_can_append_10MB(32_MiB);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_large_chunks_and_queue_depth) {
+    auto& cfg = config::shard_local_cfg();
+    cfg.get("append_large_chunk_size").set_value(size_t{128_KiB});
+    cfg.get("storage_max_inflight_dma_writes").set_value(size_t{1});
+    auto reset = ss::defer([&cfg] {
+        cfg.get("append_large_chunk_size").reset();
+        cfg.get("storage_max_inflight_dma_writes").reset();
+    });
+
+    auto f = open_file("test_segment_appender_large_chunks.log");
+    storage::storage_resources resources(
+      config::mock_binding<size_t>(32_MiB));
+    auto appender = make_segment_appender(f, resources);
+    auto close = ss::defer([&appender] { appender.close().get(); });
+
+    constexpr size_t one_meg = 1024 * 1024;
+    iobuf original = make_random_data(one_meg);
+    appender.append(original).get();
+    appender.flush().get();
+
+    auto in = make_file_input_stream(f, 0);
+    iobuf result = read_iobuf_exactly(in, one_meg).get0();
+    BOOST_CHECK_EQUAL(original, result);
+    in.close().get();
+
+    // the appender switches to large chunks once it filled a few chunks in
+    // a row, so it needs fewer writes than with regular chunks
+    const auto& stats = resources.get_dma_write_stats();
+    BOOST_CHECK_GT(stats.large_chunks, 0);
+    BOOST_CHECK_LT(
+      access(appender).total_dispatched(), one_meg / default_chunk_size());
+    BOOST_CHECK_EQUAL(stats.dispatched, access(appender).total_dispatched());
+    BOOST_CHECK_EQUAL(stats.inflight, 0);
+    BOOST_CHECK_EQUAL(resources.dma_write_queue_depth(), 1);
+}
+
 static void run_test_can_append_10MB_sequential_write_sequential_read(
   size_t fallocate_size) {
     auto f = open_file("test_segment_appender_sequential.log");
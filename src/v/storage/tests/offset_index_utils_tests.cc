@@ -6,8 +6,10 @@
 // As of the Change Date specified in that file, in accordance with
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
+#include "config/property.h"
 #include "random/generators.h"
 #include "serde/serde.h"
+#include "storage/eytzinger_index.h"
 #include "storage/segment_index.h"
 #include "test_utils/fixture.h"
 #include "utils/file_io.h"
@@ -26,10 +28,15 @@ public:
     offset_index_utils_fixture(model::offset base = model::offset(0)) {
         _base_offset = base;
         // index
-        _idx = std::unique_ptr<segment_index>(new segment_index(
+        _idx = make_index(_base_offset, _data);
+    }
+
+    segment_index_ptr
+    make_index(model::offset base, tmpbuf_file::store_t& data) {
+        return std::unique_ptr<segment_index>(new segment_index(
           segment_full_path::mock("In memory iobuf"),
-          ss::file(ss::make_shared(tmpbuf_file(_data))),
-          _base_offset,
+          ss::file(ss::make_shared(tmpbuf_file(data))),
+          base,
           storage::segment_index::default_data_buffer_step,
           _feature_table));
     }
@@ -176,3 +183,110 @@ FIXTURE_TEST(bucket_truncate, offset_index_utils_fixture) {
         BOOST_REQUIRE(bool(!p));
     }
 }
+
+FIXTURE_TEST(find_nearest_search_layout, offset_index_utils_fixture) {
+    start().get();
+
+    // every other offset is indexed. lookups cover the layout built on the
+    // first search and the tail appended after it.
+    auto track = [this](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            _idx->maybe_track(
+              modify_get(
+                model::offset(i * 2),
+                storage::segment_index::default_data_buffer_step),
+              std::nullopt,
+              i);
+        }
+    };
+    auto expect_all = [this](uint32_t entries) {
+        for (uint32_t i = 0; i < entries; ++i) {
+            index_entry_expect(i * 2, i);
+            auto p = _idx->find_nearest(model::offset(i * 2 + 1));
+            BOOST_REQUIRE(bool(p));
+            BOOST_REQUIRE_EQUAL(p->offset, model::offset(i * 2));
+        }
+        auto p = _idx->find_nearest(model::offset(entries * 4));
+        BOOST_REQUIRE(bool(p));
+        BOOST_REQUIRE_EQUAL(p->offset, model::offset((entries - 1) * 2));
+    };
+
+    track(0, 1000);
+    expect_all(1000);
+    track(1000, 1500);
+    expect_all(1500);
+    track(1500, 2100);
+    expect_all(2100);
+
+    _idx->truncate(model::offset(600), model::timestamp{100}).get();
+    expect_all(300);
+    track(300, 400);
+    expect_all(400);
+}
+
+FIXTURE_TEST(eytzinger_index_find, offset_index_utils_fixture) {
+    start().get();
+
+    for (size_t entries : {0, 1, 2, 3, 7, 64, 100, 1023, 1024, 1025}) {
+        fragmented_vector<uint32_t> keys;
+        uint32_t key = random_generators::get_int<uint32_t>(0, 10);
+        for (size_t i = 0; i < entries; ++i) {
+            keys.push_back(key);
+            key += random_generators::get_int<uint32_t>(1, 10);
+        }
+        storage::eytzinger_index layout;
+        layout.build(keys);
+        BOOST_REQUIRE_EQUAL(layout.size(), entries);
+        for (uint32_t needle = 0; needle <= key + 1; ++needle) {
+            auto it = std::upper_bound(keys.begin(), keys.end(), needle);
+            auto expected = it == keys.begin()
+                              ? std::nullopt
+                              : std::make_optional<size_t>(
+                                std::distance(keys.begin(), it) - 1);
+            BOOST_REQUIRE(layout.find(needle) == expected);
+        }
+    }
+}
+
+FIXTURE_TEST(index_unload_and_load, offset_index_utils_fixture) {
+    start().get();
+
+    for (uint32_t i = 0; i < 1024; ++i) {
+        model::offset o = _base_offset + model::offset(i);
+        _idx->maybe_track(
+          modify_get(o, storage::segment_index::default_data_buffer_step),
+          std::nullopt,
+          i * storage::segment_index::default_data_buffer_step);
+    }
+    // indices with changes that are not persisted can't be unloaded
+    _idx->unload();
+    BOOST_REQUIRE(_idx->is_loaded());
+    _idx->flush().get();
+
+    storage::segment_index_lru lru(
+      config::mock_binding<std::optional<size_t>>(std::optional<size_t>(1)));
+    lru.touch(*_idx);
+    BOOST_REQUIRE_EQUAL(lru.size(), 1);
+    BOOST_REQUIRE(_idx->is_loaded());
+
+    {
+        tmpbuf_file::store_t other_data;
+        auto other = make_index(model::offset(2048), other_data);
+        // the least recently used index is unloaded
+        lru.touch(*other);
+        BOOST_REQUIRE_EQUAL(lru.size(), 1);
+        BOOST_REQUIRE(other->is_loaded());
+        BOOST_REQUIRE(!_idx->is_loaded());
+    }
+    BOOST_REQUIRE_EQUAL(lru.size(), 0);
+
+    // the summary is kept while the entries are unloaded
+    BOOST_REQUIRE_EQUAL(_idx->max_offset(), model::offset(1023));
+    BOOST_REQUIRE(!_idx->find_nearest(model::offset(512)).has_value());
+
+    _idx->load().get();
+    BOOST_REQUIRE(_idx->is_loaded());
+    BOOST_REQUIRE_EQUAL(_idx->size(), 1024);
+    index_entry_expect(
+      512, 512 * storage::segment_index::default_data_buffer_step);
+}
@@ -151,3 +151,79 @@ SEASTAR_THREAD_TEST_CASE(offset_translator_state_case_2) {
     BOOST_REQUIRE_EQUAL(state.last_delta(), 10_do);
     BOOST_REQUIRE_EQUAL(state.last_gap_offset(), 100_rp);
 }
+
+SEASTAR_THREAD_TEST_CASE(offset_translator_state_many_gaps) {
+    // enough gaps for the oldest entries to be compressed
+    constexpr int64_t num_gaps = 2000;
+    constexpr int64_t stride = 10;
+
+    storage::offset_translator_state state(ntp);
+    BOOST_REQUIRE(state.add_absolute_delta(0_rp, 0));
+
+    // a gap of 1 to 3 offsets at the beginning of every stride
+    auto gap_length = [](int64_t i) { return i % 3 + 1; };
+    std::vector<int64_t> deltas;
+    std::vector<bool> is_gap;
+    int64_t delta = 0;
+    for (int64_t i = 0; i < num_gaps; ++i) {
+        const auto base = i * stride;
+        const auto length = gap_length(i);
+        state.add_gap(model::offset(base), model::offset(base + length - 1));
+        for (int64_t o = base; o < base + stride; ++o) {
+            deltas.push_back(delta);
+            is_gap.push_back(o < base + length);
+            if (o < base + length) {
+                ++delta;
+            }
+        }
+    }
+    BOOST_REQUIRE_EQUAL(state.size(), num_gaps + 1);
+    BOOST_REQUIRE_EQUAL(state.last_delta(), delta);
+    BOOST_REQUIRE_EQUAL(
+      state.last_gap_offset(),
+      model::offset((num_gaps - 1) * stride + gap_length(num_gaps - 1) - 1));
+
+    auto check = [&](const storage::offset_translator_state& st, int64_t from) {
+        for (int64_t o = from; o < int64_t(deltas.size()); ++o) {
+            BOOST_REQUIRE_EQUAL(st.delta(model::offset(o)), deltas[o]);
+            if (!is_gap[o]) {
+                auto data_offset = model::offset(o - deltas[o]);
+                BOOST_REQUIRE_EQUAL(
+                  st.to_log_offset(data_offset), model::offset(o));
+            }
+        }
+    };
+    check(state, 0);
+
+    auto restored = storage::offset_translator_state::from_serialized_map(
+      ntp, state.serialize_map());
+    BOOST_REQUIRE_EQUAL(restored.size(), state.size());
+    check(restored, 0);
+
+    // truncate in the middle of the compressed entries
+    const auto truncate_at = (num_gaps / 4) * stride;
+    BOOST_REQUIRE(state.truncate(model::offset(truncate_at)));
+    deltas.resize(truncate_at);
+    is_gap.resize(truncate_at);
+    BOOST_REQUIRE_EQUAL(state.size(), num_gaps / 4 + 1);
+    check(state, 0);
+
+    // add the gaps back and prefix truncate
+    for (int64_t i = num_gaps / 4; i < num_gaps; ++i) {
+        const auto base = i * stride;
+        const auto length = gap_length(i);
+        state.add_gap(model::offset(base), model::offset(base + length - 1));
+        for (int64_t o = base; o < base + stride; ++o) {
+            deltas.push_back(deltas.back() + int64_t(is_gap.back()));
+            is_gap.push_back(o < base + length);
+        }
+    }
+    check(state, 0);
+
+    const auto prefix_truncate_at = (num_gaps / 3) * stride + stride - 1;
+    BOOST_REQUIRE(state.prefix_truncate(model::offset(prefix_truncate_at)));
+    BOOST_REQUIRE_EQUAL(state.size(), num_gaps - num_gaps / 3);
+    check(state, prefix_truncate_at + 1);
+    BOOST_REQUIRE_THROW(
+      state.delta(model::offset(prefix_truncate_at)), std::runtime_error);
+}
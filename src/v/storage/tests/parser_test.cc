@@ -0,0 +1,169 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "model/record.h"
+#include "model/tests/random_batch.h"
+#include "storage/parser.h"
+#include "storage/segment_appender_utils.h"
+#include "storage/segment_reader.h"
+#include "units.h"
+
+#include <seastar/core/iostream.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/later.hh>
+
+#include <algorithm>
+#include <vector>
+
+using stop_parser = storage::batch_consumer::stop_parser;
+
+namespace {
+
+/// Serves the bytes of an iobuf in buffers of `chunk` bytes, from buffered
+/// memory or after a yield, to make the batches straddle the buffers of the
+/// input stream and exercise both the synchronous and asynchronous paths of
+/// the parser.
+class chunked_source final : public ss::data_source_impl {
+public:
+    chunked_source(iobuf data, size_t chunk, bool async)
+      : _parser(std::move(data))
+      , _chunk(chunk)
+      , _async(async) {}
+
+    ss::future<ss::temporary_buffer<char>> get() final {
+        auto n = std::min(_chunk, _parser.bytes_left());
+        ss::temporary_buffer<char> buf(n);
+        _parser.consume_to(n, buf.get_write());
+        if (!_async) {
+            return ss::make_ready_future<ss::temporary_buffer<char>>(
+              std::move(buf));
+        }
+        return ss::yield().then([buf = std::move(buf)]() mutable {
+            return std::move(buf);
+        });
+    }
+
+private:
+    iobuf_parser _parser;
+    size_t _chunk;
+    bool _async;
+};
+
+class recording_consumer final : public storage::batch_consumer {
+public:
+    recording_consumer(
+      std::vector<model::record_batch_header>& headers,
+      std::vector<iobuf>& records,
+      bool async_end,
+      int skip_every)
+      : _headers(headers)
+      , _records(records)
+      , _async_end(async_end)
+      , _skip_every(skip_every) {}
+
+    consume_result
+    accept_batch_start(const model::record_batch_header& h) const final {
+        if (_skip_every > 0 && h.base_offset() % _skip_every == 0) {
+            return consume_result::skip_batch;
+        }
+        return consume_result::accept_batch;
+    }
+
+    void consume_batch_start(
+      model::record_batch_header h, size_t, size_t) final {
+        _headers.push_back(h);
+    }
+
+    void skip_batch_start(model::record_batch_header, size_t, size_t) final {}
+
+    void consume_records(iobuf&& records) final {
+        _records.push_back(std::move(records));
+    }
+
+    ss::future<stop_parser> consume_batch_end() final {
+        if (!_async_end) {
+            return ss::make_ready_future<stop_parser>(stop_parser::no);
+        }
+        return ss::yield().then([] { return stop_parser::no; });
+    }
+
+    void print(std::ostream& os) const final { os << "recording_consumer"; }
+
+private:
+    std::vector<model::record_batch_header>& _headers;
+    std::vector<iobuf>& _records;
+    bool _async_end;
+    int _skip_every;
+};
+
+struct parse_params {
+    size_t chunk;
+    bool async_source;
+    bool async_end;
+    int skip_every{0};
+};
+
+void test_parse(const parse_params& p) {
+    auto expected = model::test::make_random_batches(model::offset(0), 50);
+    iobuf data;
+    for (auto& b : expected) {
+        data.append(storage::disk_header_to_iobuf(b.header()));
+        data.append(b.data().copy());
+    }
+    const auto size = data.size_bytes();
+
+    std::vector<model::record_batch_header> headers;
+    std::vector<iobuf> records;
+    storage::continuous_batch_parser parser(
+      std::make_unique<recording_consumer>(
+        headers, records, p.async_end, p.skip_every),
+      storage::segment_reader_handle(ss::input_stream<char>(ss::data_source(
+        std::make_unique<chunked_source>(
+          std::move(data), p.chunk, p.async_source)))));
+    auto consumed = parser.consume().get();
+    parser.close().get();
+
+    BOOST_REQUIRE(consumed.has_value());
+    BOOST_REQUIRE_EQUAL(consumed.value(), size);
+    size_t i = 0;
+    for (auto& b : expected) {
+        if (p.skip_every > 0 && b.base_offset() % p.skip_every == 0) {
+            continue;
+        }
+        BOOST_REQUIRE_LT(i, headers.size());
+        BOOST_REQUIRE_EQUAL(headers[i], b.header());
+        BOOST_REQUIRE(records[i] == b.data());
+        ++i;
+    }
+    BOOST_REQUIRE_EQUAL(i, headers.size());
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(parse_from_buffered_stream) {
+    test_parse({.chunk = 128_KiB, .async_source = false, .async_end = false});
+}
+
+SEASTAR_THREAD_TEST_CASE(parse_across_buffer_boundaries) {
+    for (size_t chunk : {1UL, 7UL, 61UL, 4096UL}) {
+        test_parse({.chunk = chunk, .async_source = true, .async_end = false});
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(parse_with_async_batch_end) {
+    test_parse({.chunk = 4096, .async_source = true, .async_end = true});
+    test_parse({.chunk = 128_KiB, .async_source = false, .async_end = true});
+}
+
+SEASTAR_THREAD_TEST_CASE(parse_skipped_batches) {
+    test_parse(
+      {.chunk = 61, .async_source = true, .async_end = false, .skip_every = 3});
+}
@@ -0,0 +1,75 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/read_ahead.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+using storage::adaptive_read_ahead;
+
+namespace {
+
+constexpr size_t buffer_size = 4096;
+
+// emulates the streams of a reader reading `read` bytes and dropping
+// `unused` of them
+void record(adaptive_read_ahead& ra, uint64_t read, uint64_t unused) {
+    auto& w = ra.history()->current_window;
+    w.total_read += read;
+    w.unused_read += unused;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(read_ahead_grows_for_sequential_scans) {
+    adaptive_read_ahead ra(2, buffer_size);
+    BOOST_REQUIRE(ra.history());
+    BOOST_REQUIRE_EQUAL(ra.next().read_ahead, 2);
+
+    // nothing read ahead went unused
+    unsigned previous = 2;
+    for (int i = 0; i < 4; ++i) {
+        record(ra, 16 * buffer_size, 0);
+        auto g = ra.next();
+        BOOST_REQUIRE_GE(g.read_ahead, previous);
+        previous = g.read_ahead;
+    }
+    auto g = ra.next();
+    BOOST_REQUIRE_EQUAL(
+      g.read_ahead, 2 * adaptive_read_ahead::max_growth_factor);
+    // the read-ahead beyond the configured count is borrowed from the budget
+    BOOST_REQUIRE(g.units.has_value());
+    BOOST_REQUIRE_EQUAL(
+      g.units->count(),
+      (2 * adaptive_read_ahead::max_growth_factor - 2) * buffer_size);
+}
+
+SEASTAR_THREAD_TEST_CASE(read_ahead_shrinks_for_wasteful_readers) {
+    adaptive_read_ahead ra(8, buffer_size);
+    // most of what was read ahead is dropped on close
+    for (int i = 0; i < 8; ++i) {
+        record(ra, 16 * buffer_size, 12 * buffer_size);
+        auto g = ra.next();
+        BOOST_REQUIRE(!g.units.has_value());
+    }
+    BOOST_REQUIRE_EQUAL(ra.next().read_ahead, 0);
+
+    const auto& stats = storage::internal::shard_read_ahead_budget()
+                          .get_stats();
+    BOOST_REQUIRE_GT(stats.shrunk, 0);
+    BOOST_REQUIRE_GT(stats.wasted_bytes, 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(read_ahead_waits_for_enough_reads) {
+    adaptive_read_ahead ra(4, buffer_size);
+    // less than a full read-ahead has been read, no decision yet
+    record(ra, buffer_size, buffer_size);
+    BOOST_REQUIRE_EQUAL(ra.next().read_ahead, 4);
+    BOOST_REQUIRE_EQUAL(ra.current(), 4);
+}
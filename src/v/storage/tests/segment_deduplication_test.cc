@@ -9,6 +9,7 @@
 
 #include "gmock/gmock.h"
 #include "random/generators.h"
+#include "storage/compacted_index_reader.h"
 #include "storage/disk_log_impl.h"
 #include "storage/key_offset_map.h"
 #include "storage/segment_deduplication_utils.h"
@@ -16,6 +17,7 @@
 #include "storage/tests/disk_log_builder_fixture.h"
 #include "storage/tests/utils/disk_log_builder.h"
 #include "test_utils/test.h"
+#include "units.h"
 
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/seastar.hh>
@@ -253,3 +255,120 @@ TEST(BuildOffsetMap, TestBuildMapWithMissingCompactedIndex) {
         ASSERT_TRUE(ss::file_exists(idx_path.string()).get());
     }
 }
+
+TEST(SelfCompactionTest, TestRecompressesBatches) {
+    storage::disk_log_builder b;
+    build_segments(
+      b,
+      /*num_segs=*/3,
+      /*records_per_seg=*/10,
+      /*start_offset=*/0,
+      /*mark_compacted=*/false);
+    auto cleanup = ss::defer([&] { b.stop().get(); });
+    auto& disk_log = b.get_disk_log_impl();
+    compaction_config cfg(
+      model::offset{30}, ss::default_priority_class(), never_abort);
+    cfg.target_compression = model::compression::lz4;
+    probe pb;
+    for (auto& seg : disk_log.segments()) {
+        storage::internal::self_compact_segment(
+          seg,
+          disk_log.stm_manager(),
+          cfg,
+          pb,
+          disk_log.readers(),
+          disk_log.resources(),
+          offset_delta_time::yes)
+          .get();
+    }
+    auto batches = b.consume().get();
+    ASSERT_FALSE(batches.empty());
+    for (const auto& batch : batches) {
+        ASSERT_EQ(batch.header().attrs.compression(), model::compression::lz4);
+    }
+}
+
+TEST(KeySetSummary, TestMayContain) {
+    constexpr size_t num_keys = 10000;
+    key_set_summary summary(num_keys);
+    std::vector<uint64_t> hashes;
+    for (size_t i = 0; i < num_keys; ++i) {
+        auto key = compaction_key(random_generators::get_bytes(
+          random_generators::get_int<size_t>(1, 128)));
+        hashes.push_back(key_set_summary::hash(key));
+        summary.add(hashes.back());
+    }
+    for (auto h : hashes) {
+        ASSERT_TRUE(summary.may_contain(h));
+    }
+    size_t false_positives = 0;
+    for (size_t i = 0; i < num_keys; ++i) {
+        auto key = compaction_key(random_generators::get_bytes(256));
+        false_positives += summary.may_contain(key_set_summary::hash(key));
+    }
+    // ~2% expected at 8 bits per key
+    ASSERT_LT(false_positives, num_keys / 10);
+}
+
+TEST(BuildOffsetMap, TestKeySummaryOverlaps) {
+    storage::disk_log_builder b;
+    build_segments(b, 3);
+    auto cleanup = ss::defer([&] { b.stop().get(); });
+    auto& disk_log = b.get_disk_log_impl();
+    auto& segs = disk_log.segments();
+    compaction_config cfg(
+      model::offset{30}, ss::default_priority_class(), never_abort);
+
+    // Without summaries every segment may overlap. Building the map leaves a
+    // summary on each fully indexed segment.
+    simple_key_offset_map first_map(100);
+    key_overlap_tracker first(segs);
+    build_offset_map(
+      cfg,
+      segs,
+      disk_log.stm_manager(),
+      disk_log.resources(),
+      disk_log.get_probe(),
+      first_map,
+      &first)
+      .get();
+    for (const auto& s : segs) {
+        ASSERT_TRUE(first.may_overlap(*s));
+        ASSERT_TRUE(s->key_summary());
+    }
+
+    // The random keys of the segments don't overlap.
+    simple_key_offset_map second_map(100);
+    key_overlap_tracker second(segs);
+    build_offset_map(
+      cfg,
+      segs,
+      disk_log.stm_manager(),
+      disk_log.resources(),
+      disk_log.get_probe(),
+      second_map,
+      &second)
+      .get();
+    for (const auto& s : segs) {
+        ASSERT_FALSE(second.may_overlap(*s));
+    }
+
+    // A key of the first segment seen in the last one overlaps.
+    auto& first_seg = segs.front();
+    auto idx_path = first_seg->path().to_compacted_index();
+    auto idx_file = internal::make_reader_handle(idx_path, std::nullopt).get();
+    auto rdr = make_file_backed_compacted_reader(
+      idx_path, idx_file, ss::default_priority_class(), 64_KiB);
+    auto entries = compaction_index_reader_to_memory(std::move(rdr)).get();
+    idx_file.close().get();
+    ASSERT_FALSE(entries.empty());
+    second.add(
+      segs.back()->offsets().base_offset,
+      key_set_summary::hash(entries.front().key));
+    ASSERT_TRUE(second.may_overlap(*first_seg));
+    ASSERT_FALSE(second.may_overlap(*segs[1]));
+
+    // Swapping the data of a segment drops its summary.
+    first_seg->swap_reader(first_seg->release_segment_reader());
+    ASSERT_FALSE(first_seg->key_summary());
+}
@@ -0,0 +1,106 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/segment_file_pool.h"
+#include "test_utils/async.h"
+#include "test_utils/tmp_dir.h"
+#include "units.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+using namespace std::chrono_literals;
+using storage::segment_file_pool;
+
+namespace {
+
+constexpr size_t falloc_step = 1_MiB;
+
+void wait_for_ready(const segment_file_pool& pool, size_t n) {
+    tests::cooperative_spin_wait_with_timeout(
+      10s, [&pool, n] { return pool.ready() == n; })
+      .get();
+}
+
+void write_file(const std::filesystem::path& path, size_t size) {
+    auto f = ss::open_file_dma(
+               path.native(), ss::open_flags::rw | ss::open_flags::create)
+               .get();
+    auto buf = ss::temporary_buffer<char>::aligned(
+      f.disk_write_dma_alignment(), size);
+    std::fill_n(buf.get_write(), size, 'x');
+    f.dma_write(0, buf.get(), buf.size()).get();
+    f.close().get();
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_take_pooled_files) {
+    temporary_dir dir("segment_file_pool");
+    segment_file_pool pool([] { return falloc_step; });
+    auto stop = ss::defer([&pool] { pool.stop().get(); });
+    pool.start(dir.get_path() / "pool", 2).get();
+    wait_for_ready(pool, 2);
+
+    auto target = dir.get_path() / "0-1-v1.log";
+    auto allocated = pool.take(target).get();
+    BOOST_REQUIRE(allocated);
+    BOOST_REQUIRE_EQUAL(*allocated, falloc_step);
+    // the allocation doesn't change the size seen by readers
+    BOOST_REQUIRE(ss::file_exists(target.native()).get());
+    BOOST_REQUIRE_EQUAL(ss::file_size(target.native()).get(), 0);
+    BOOST_REQUIRE_EQUAL(pool.get_stats().taken, 1);
+
+    // an existing file is never replaced
+    BOOST_REQUIRE(!pool.take(target).get());
+
+    // the pool is refilled in the background
+    wait_for_ready(pool, 2);
+    BOOST_REQUIRE_EQUAL(pool.get_stats().created, 3);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_recycle_removed_segment) {
+    temporary_dir dir("segment_file_pool");
+    segment_file_pool pool([] { return falloc_step; });
+    auto stop = ss::defer([&pool] { pool.stop().get(); });
+    auto removed = dir.get_path() / "0-1-v1.log";
+    write_file(removed, 64_KiB);
+
+    // recycled while the pool creates its first file
+    pool.start(dir.get_path() / "pool", 2).get();
+    BOOST_REQUIRE(pool.recycle(removed).get());
+    BOOST_REQUIRE(!ss::file_exists(removed.native()).get());
+    wait_for_ready(pool, 2);
+    BOOST_REQUIRE_EQUAL(pool.get_stats().created, 1);
+    BOOST_REQUIRE_EQUAL(pool.get_stats().recycled, 1);
+
+    // the pool is full
+    auto other = dir.get_path() / "5-1-v1.log";
+    write_file(other, 64_KiB);
+    BOOST_REQUIRE(!pool.recycle(other).get());
+
+    // the recycled file is truncated before it is handed out again
+    for (auto name : {"10-1-v1.log", "20-1-v1.log"}) {
+        auto target = dir.get_path() / name;
+        BOOST_REQUIRE(pool.take(target).get());
+        BOOST_REQUIRE_EQUAL(ss::file_size(target.native()).get(), 0);
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_disabled_pool) {
+    temporary_dir dir("segment_file_pool");
+    segment_file_pool pool([] { return falloc_step; });
+    auto stop = ss::defer([&pool] { pool.stop().get(); });
+    pool.start(dir.get_path() / "pool", 0).get();
+
+    BOOST_REQUIRE(!pool.take(dir.get_path() / "0-1-v1.log").get());
+    BOOST_REQUIRE(!ss::file_exists((dir.get_path() / "pool").native()).get());
+}
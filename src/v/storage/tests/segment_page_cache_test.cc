@@ -0,0 +1,132 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "random/generators.h"
+#include "storage/segment_page_cache.h"
+#include "units.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/fstream.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace storage; // NOLINT
+
+namespace {
+
+constexpr size_t page_size = 4_KiB;
+
+ss::sstring write_file(const ss::sstring& name, const ss::sstring& data) {
+    auto f = ss::open_file_dma(
+               name, ss::open_flags::rw | ss::open_flags::create)
+               .get0();
+    auto out = ss::make_file_output_stream(std::move(f)).get0();
+    out.write(data.data(), data.size()).get();
+    out.flush().get();
+    out.close().get();
+    return name;
+}
+
+ss::sstring read_range(
+  segment_page_cache& cache,
+  const ss::lw_shared_ptr<segment_page_cache::file_pages>& pages,
+  ss::file f,
+  size_t begin,
+  size_t end,
+  size_t file_size) {
+    auto in = cache.make_input_stream(
+      pages, f, begin, end, file_size, ss::default_priority_class());
+    ss::sstring ret;
+    while (true) {
+        auto buf = in.read().get0();
+        if (buf.empty()) {
+            break;
+        }
+        ret.append(buf.get(), buf.size());
+    }
+    in.close().get();
+    return ret;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_page_cache_disabled) {
+    segment_page_cache cache(0, page_size);
+    BOOST_REQUIRE(!cache.enabled());
+    BOOST_REQUIRE(cache.make_file_pages() == nullptr);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_page_cache_read_hits) {
+    const auto data = random_generators::gen_alphanum_string(
+      page_size * 4 + 100);
+    auto name = write_file("page_cache_read_hits.log", data);
+    auto f = ss::open_file_dma(name, ss::open_flags::ro).get0();
+
+    segment_page_cache cache(1_MiB, page_size);
+    auto pages = cache.make_file_pages();
+    BOOST_REQUIRE(pages);
+
+    // unaligned range crossing several pages including the partial tail page
+    auto first = read_range(cache, pages, f, 10, data.size(), data.size());
+    BOOST_REQUIRE_EQUAL(first, data.substr(10));
+    const auto misses = cache.get_stats().misses;
+    BOOST_REQUIRE_EQUAL(cache.get_stats().hits, 0);
+
+    // full pages are served from the cache, the tail page is re-read
+    auto second = read_range(cache, pages, f, 0, data.size(), data.size());
+    BOOST_REQUIRE_EQUAL(second, data);
+    BOOST_REQUIRE_EQUAL(cache.get_stats().hits, 4);
+    BOOST_REQUIRE_EQUAL(cache.get_stats().misses, misses + 1);
+
+    auto middle = read_range(
+      cache, pages, f, page_size + 7, page_size * 2 + 9, data.size());
+    BOOST_REQUIRE_EQUAL(middle, data.substr(page_size + 7, page_size + 2));
+
+    pages = nullptr;
+    f.close().get();
+    ss::remove_file(name).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_page_cache_truncate) {
+    const auto data = random_generators::gen_alphanum_string(page_size * 4);
+    auto name = write_file("page_cache_truncate.log", data);
+    auto f = ss::open_file_dma(name, ss::open_flags::ro).get0();
+
+    segment_page_cache cache(1_MiB, page_size);
+    auto pages = cache.make_file_pages();
+    read_range(cache, pages, f, 0, data.size(), data.size());
+    const auto misses = cache.get_stats().misses;
+
+    // pages at or beyond the truncation point must be re-read
+    pages->truncate(page_size * 2 + 1);
+    read_range(cache, pages, f, 0, data.size(), data.size());
+    BOOST_REQUIRE_EQUAL(cache.get_stats().misses, misses + 2);
+
+    pages = nullptr;
+    f.close().get();
+    ss::remove_file(name).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_page_cache_eviction) {
+    const auto data = random_generators::gen_alphanum_string(page_size * 16);
+    auto name = write_file("page_cache_eviction.log", data);
+    auto f = ss::open_file_dma(name, ss::open_flags::ro).get0();
+
+    // room for a few pages only: reads must stay correct under eviction
+    segment_page_cache cache(page_size * 4, page_size);
+    auto pages = cache.make_file_pages();
+    for (int i = 0; i < 3; ++i) {
+        auto res = read_range(cache, pages, f, 0, data.size(), data.size());
+        BOOST_REQUIRE_EQUAL(res, data);
+    }
+
+    pages = nullptr;
+    f.close().get();
+    ss::remove_file(name).get();
+}
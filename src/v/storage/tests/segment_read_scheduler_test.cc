@@ -0,0 +1,137 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iostream.h"
+#include "storage/segment_read_scheduler.h"
+#include "test_utils/tmp_dir.h"
+#include "units.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <vector>
+
+using storage::segment_read_scheduler;
+
+namespace {
+
+constexpr size_t chunk_size = 4_KiB;
+
+char byte_at(size_t pos) { return static_cast<char>(pos % 251); }
+
+// a file of `chunks` chunks, byte i holding byte_at(i)
+ss::file make_file(const temporary_dir& dir, size_t chunks) {
+    auto path = (dir.get_path() / "segment").native();
+    auto f = ss::open_file_dma(
+               path, ss::open_flags::rw | ss::open_flags::create)
+               .get();
+    auto buf = ss::temporary_buffer<char>::aligned(
+      f.disk_write_dma_alignment(), chunks * chunk_size);
+    for (size_t i = 0; i < buf.size(); ++i) {
+        buf.get_write()[i] = byte_at(i);
+    }
+    f.dma_write(0, buf.get(), buf.size()).get();
+    f.flush().get();
+    return f;
+}
+
+void check_bytes(const ss::temporary_buffer<char>& buf, size_t pos) {
+    for (size_t i = 0; i < buf.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(buf[i], byte_at(pos + i));
+    }
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(coalesces_adjacent_chunks) {
+    temporary_dir dir("read_scheduler");
+    auto f = make_file(dir, 16);
+    segment_read_scheduler scheduler(chunk_size);
+    int owner = 0;
+
+    // chunks 0-3 and 8, requested in the same task
+    std::vector<ss::future<ss::temporary_buffer<char>>> reads;
+    for (size_t c : {3, 0, 2, 1, 8}) {
+        reads.push_back(scheduler.read(
+          &owner, f, c * chunk_size, ss::default_priority_class()));
+    }
+    auto bufs = ss::when_all_succeed(reads.begin(), reads.end()).get();
+
+    BOOST_REQUIRE_EQUAL(scheduler.get_stats().requests, 5);
+    BOOST_REQUIRE_EQUAL(scheduler.get_stats().flushes, 1);
+    BOOST_REQUIRE_EQUAL(scheduler.get_stats().submissions, 2);
+    size_t i = 0;
+    for (size_t c : {3, 0, 2, 1, 8}) {
+        BOOST_REQUIRE_EQUAL(bufs[i].size(), chunk_size);
+        check_bytes(bufs[i], c * chunk_size);
+        ++i;
+    }
+    f.close().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(does_not_coalesce_different_owners) {
+    temporary_dir dir("read_scheduler");
+    auto f = make_file(dir, 4);
+    segment_read_scheduler scheduler(chunk_size);
+    int a = 0;
+    int b = 0;
+
+    auto r1 = scheduler.read(&a, f, 0, ss::default_priority_class());
+    auto r2 = scheduler.read(&b, f, chunk_size, ss::default_priority_class());
+    auto [b1, b2] = ss::when_all_succeed(std::move(r1), std::move(r2)).get();
+    BOOST_REQUIRE_EQUAL(scheduler.get_stats().submissions, 2);
+    check_bytes(b1, 0);
+    check_bytes(b2, chunk_size);
+    f.close().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(reads_past_end_of_file) {
+    temporary_dir dir("read_scheduler");
+    auto f = make_file(dir, 2);
+    segment_read_scheduler scheduler(chunk_size);
+    int owner = 0;
+
+    auto r1 = scheduler.read(
+      &owner, f, chunk_size, ss::default_priority_class());
+    auto r2 = scheduler.read(
+      &owner, f, 2 * chunk_size, ss::default_priority_class());
+    auto [b1, b2] = ss::when_all_succeed(std::move(r1), std::move(r2)).get();
+    BOOST_REQUIRE_EQUAL(b1.size(), chunk_size);
+    check_bytes(b1, chunk_size);
+    BOOST_REQUIRE(b2.empty());
+    f.close().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(input_stream_reads_range) {
+    temporary_dir dir("read_scheduler");
+    auto f = make_file(dir, 8);
+    segment_read_scheduler scheduler(chunk_size);
+    int owner = 0;
+
+    const size_t begin = 1000;
+    const size_t end = 6 * chunk_size + 17;
+    auto in = scheduler.make_input_stream(
+      &owner, f, begin, end, ss::default_priority_class());
+    auto data = read_iobuf_exactly(in, end - begin + 1).get();
+    in.close().get();
+
+    BOOST_REQUIRE_EQUAL(data.size_bytes(), end - begin);
+    size_t pos = begin;
+    for (const auto& frag : data) {
+        for (size_t i = 0; i < frag.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(frag.get()[i], byte_at(pos++));
+        }
+    }
+    // the first read of the stream was coalesced with its read-ahead
+    BOOST_REQUIRE_LT(
+      scheduler.get_stats().submissions, scheduler.get_stats().requests);
+    f.close().get();
+}
@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "bytes/bytes.h"
+#include "bytes/iostream.h"
 #include "config/mock_property.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -23,6 +24,7 @@
 #include "storage/log_manager.h"
 #include "storage/ntp_config.h"
 #include "storage/record_batch_builder.h"
+#include "storage/segment_reader.h"
 #include "storage/segment_utils.h"
 #include "storage/tests/disk_log_builder_fixture.h"
 #include "storage/tests/storage_test_fixture.h"
@@ -3541,3 +3543,44 @@ FIXTURE_TEST(test_skipping_compaction_below_start_offset, log_builder_fixture) {
 
     b.stop().get();
 }
+
+FIXTURE_TEST(test_segment_upload_buffer, storage_test_fixture) {
+    config::shard_local_cfg()
+      .cloud_storage_upload_buffer_memory_per_shard.set_value(size_t{10_MiB});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg()
+          .cloud_storage_upload_buffer_memory_per_shard.reset();
+    });
+    storage::log_manager mgr = make_log_manager();
+    auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get0(); });
+    auto ntp = model::ntp("default", "test", 0);
+    auto log
+      = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir)).get0();
+    log->set_upload_buffering(true);
+
+    append_random_batches(log, 10);
+    log->flush().get();
+
+    auto seg = log->segments().back();
+    BOOST_REQUIRE(seg->has_upload_buffer());
+    const auto size = seg->size_bytes();
+    auto buffered = seg->upload_buffer_range(0, size);
+    BOOST_REQUIRE(buffered.has_value());
+
+    // the buffer holds the bytes of the data file
+    auto stream = storage::concat_segment_reader_view(
+                    {seg}, 0, size, ss::default_priority_class())
+                    .take_stream();
+    auto on_disk = read_iobuf_exactly(stream, size).get();
+    stream.close().get();
+    BOOST_REQUIRE(on_disk == *buffered);
+    BOOST_REQUIRE(!seg->upload_buffer_range(0, size + 1).has_value());
+
+    // uploaded bytes are released
+    seg->trim_upload_buffer(size / 2);
+    BOOST_REQUIRE(!seg->upload_buffer_range(0, size).has_value());
+    BOOST_REQUIRE(seg->upload_buffer_range(size / 2, size).has_value());
+
+    log->set_upload_buffering(false);
+    BOOST_REQUIRE(!seg->has_upload_buffer());
+}
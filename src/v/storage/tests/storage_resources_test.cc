@@ -0,0 +1,70 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/property.h"
+#include "storage/storage_resources.h"
+#include "units.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/later.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <vector>
+
+SEASTAR_THREAD_TEST_CASE(test_prioritized_recovery_units) {
+    storage::storage_resources resources(
+      config::mock_binding<size_t>(32_MiB),
+      config::mock_binding<uint64_t>(1_GiB),
+      config::mock_binding<uint64_t>(ss::smp::count),
+      config::mock_binding<uint64_t>(128_MiB));
+
+    // hold the only recovery unit of the shard
+    auto held = resources.get_recovery_units().get();
+
+    std::vector<ss::sstring> order;
+    auto wait = [&resources, &order](
+                  storage::prioritize_recovery prioritize,
+                  ss::sstring name) -> ss::future<> {
+        auto units = co_await resources.get_recovery_units(prioritize);
+        order.push_back(name);
+    };
+    auto first = wait(storage::prioritize_recovery::yes, "first");
+    auto regular = wait(storage::prioritize_recovery::no, "regular");
+    auto second = wait(storage::prioritize_recovery::yes, "second");
+    ss::yield().get();
+    BOOST_REQUIRE_EQUAL(resources.recovery_waiters(), 3);
+    BOOST_REQUIRE(order.empty());
+
+    // the regular recovery waits for the prioritized ones requested after it
+    held.return_all();
+    first.get();
+    second.get();
+    regular.get();
+    BOOST_REQUIRE(
+      order == std::vector<ss::sstring>({"first", "second", "regular"}));
+    BOOST_REQUIRE_EQUAL(resources.recovery_waiters(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_falloc_step_of_extra_devices) {
+    storage::storage_resources resources(config::mock_binding<size_t>(32_MiB));
+    resources.update_allowance(1_TiB, 1_TiB);
+    resources.update_partition_count(4);
+    BOOST_REQUIRE_EQUAL(resources.get_falloc_step(std::nullopt), 32_MiB);
+
+    // half of the partitions are on a device with little free space: half
+    // of its share of this shard is split between them
+    resources.update_device_allowances(
+      {{.free = 64_MiB * ss::smp::count, .partitions = 2}});
+    BOOST_REQUIRE_EQUAL(resources.get_falloc_step(std::nullopt), 16_MiB);
+
+    // the device has no partitions anymore
+    resources.update_device_allowances(
+      {{.free = 64_MiB * ss::smp::count, .partitions = 0}});
+    BOOST_REQUIRE_EQUAL(resources.get_falloc_step(std::nullopt), 32_MiB);
+}
@@ -43,6 +43,16 @@ std::ostream& operator<<(std::ostream& o, const disk& d) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, batch_cache_hint h) {
+    switch (h) {
+    case batch_cache_hint::automatic:
+        return o << "automatic";
+    case batch_cache_hint::read_once:
+        return o << "read_once";
+    }
+    __builtin_unreachable();
+}
+
 std::ostream& operator<<(std::ostream& o, const log_reader_config& cfg) {
     o << "{start_offset:" << cfg.start_offset
       << ", max_offset:" << cfg.max_offset << ", min_bytes:" << cfg.min_bytes
@@ -61,7 +71,7 @@ std::ostream& operator<<(std::ostream& o, const log_reader_config& cfg) {
     o << ", bytes_consumed:" << cfg.bytes_consumed;
     o << ", over_budget:" << cfg.over_budget;
     o << ", strict_max_bytes:" << cfg.strict_max_bytes;
-    o << ", skip_batch_cache:" << cfg.skip_batch_cache;
+    o << ", cache_hint:" << cfg.cache_hint;
     o << ", abortable:" << cfg.abort_source.has_value();
     o << ", aborted:"
       << (cfg.abort_source.has_value()
@@ -107,7 +117,8 @@ operator<<(std::ostream& o, const ntp_config::default_overrides& v) {
       "retention_local_target_bytes: {}, retention_local_target_ms: {}, "
       "remote_delete: {}, segment_ms: {}, "
       "initial_retention_local_target_bytes: {}, "
-      "initial_retention_local_target_ms: {}}}",
+      "initial_retention_local_target_ms: {}, compression: {}, "
+      "write_caching: {}, observer_replicas: {}}}",
       v.compaction_strategy,
       v.cleanup_policy_bitflags,
       v.segment_size,
@@ -119,7 +130,10 @@ operator<<(std::ostream& o, const ntp_config::default_overrides& v) {
       v.remote_delete,
       v.segment_ms,
       v.initial_retention_local_target_bytes,
-      v.initial_retention_local_target_ms);
+      v.initial_retention_local_target_ms,
+      v.compression,
+      v.write_caching,
+      v.observer_replicas);
 
     return o;
 }
@@ -289,6 +289,23 @@ struct truncate_prefix_config {
     operator<<(std::ostream&, const truncate_prefix_config&);
 };
 
+/*
+ * How a reader uses the batch cache.
+ */
+enum class batch_cache_hint : int8_t {
+    // batches read from disk are inserted into the cache, subject to the
+    // cache admission filter. a reader found to be catching up on historical
+    // data is treated as a read_once reader until it reaches the active
+    // segment.
+    automatic,
+    // allow cache reads, but skip lru promotion and cache insertions on miss.
+    // use this option when a reader shouldn't perturb the cache (e.g.
+    // historical read-once workloads like compaction).
+    read_once,
+};
+
+std::ostream& operator<<(std::ostream&, batch_cache_hint);
+
 /**
  * Log reader configuration.
  *
@@ -329,10 +346,8 @@ struct log_reader_config {
     // will return no batches.
     bool strict_max_bytes{false};
 
-    // allow cache reads, but skip lru promotion and cache insertions on miss.
-    // use this option when a reader shouldn't perturb the cache (e.g.
-    // historical read-once workloads like compaction).
-    bool skip_batch_cache{false};
+    // how the reader uses the batch cache
+    batch_cache_hint cache_hint{batch_cache_hint::automatic};
 
     opt_client_address_t client_address;
 
@@ -392,6 +407,23 @@ struct gc_config {
     friend std::ostream& operator<<(std::ostream&, const gc_config&);
 };
 
+/*
+ * Housekeeping work pending for a log, estimated from its in-memory state
+ * without any I/O. The log manager uses it to skip the logs with nothing to
+ * do and to visit the most overdue ones first.
+ */
+struct housekeeping_estimate {
+    // retention would remove data, or a cloud gc was requested
+    bool gc_due{false};
+    // the log is compacted, compaction may have work to do
+    bool compaction{false};
+    // retention timestamp of the oldest segment
+    model::timestamp oldest_timestamp{model::timestamp::max()};
+    size_t size_bytes{0};
+
+    bool has_work() const { return gc_due || compaction; }
+};
+
 struct compaction_config {
     compaction_config(
       model::offset max_collect_offset,
@@ -430,6 +462,9 @@ struct compaction_config {
     // abort source for compaction task
     ss::abort_source* asrc;
 
+    // If set, data batches are rewritten with this compression.
+    std::optional<model::compression> target_compression;
+
     friend std::ostream& operator<<(std::ostream&, const compaction_config&);
 };
 
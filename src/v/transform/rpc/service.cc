@@ -155,8 +155,13 @@ ss::future<result<model::offset, cluster::errc>> local_service::produce(
             co_return cluster::errc::invalid_request;
         }
     }
-    auto rdr = model::make_foreign_fragmented_memory_record_batch_reader(
-      std::move(batches));
+    // Batches read from a foreign reader are copied on the owning shard, when
+    // the partition is on this shard they can be handed to raft as is.
+    auto rdr = *shard == ss::this_shard_id()
+                 ? model::make_fragmented_memory_record_batch_reader(
+                   std::move(batches))
+                 : model::make_foreign_fragmented_memory_record_batch_reader(
+                   std::move(batches));
     // TODO: schema validation
     model::offset produced_offset;
     auto ec = co_await _partition_manager->invoke_on_shard(
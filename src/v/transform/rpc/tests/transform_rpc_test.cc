@@ -453,6 +453,8 @@ private:
             throw std::runtime_error("unimplemented");
         }
         bool is_leader() const final { return true; }
+        bool is_observer() const final { return false; }
+        bool has_observers() const final { return false; }
         ss::future<std::error_code> linearizable_barrier() final {
             throw std::runtime_error("unimplemented");
         }
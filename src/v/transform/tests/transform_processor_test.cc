@@ -9,6 +9,7 @@
  * by the Apache License, Version 2.0
  */
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -23,6 +24,8 @@
 
 #include <memory>
 
+using namespace std::chrono_literals;
+
 namespace transform {
 namespace {
 class ProcessorTestFixture : public ::testing::Test {
@@ -136,6 +139,25 @@ TEST_F(ProcessorTestFixture, ProcessMany) {
     EXPECT_EQ(error_count(), 0);
 }
 
+TEST_F(ProcessorTestFixture, ProcessManyWithLinger) {
+    auto& linger = config::shard_local_cfg().data_transforms_write_linger_ms;
+    linger.set_value(5ms);
+    std::vector<model::record_batch> batches;
+    constexpr int num_batches = 32;
+    std::generate_n(std::back_inserter(batches), num_batches, [this] {
+        return make_tiny_batch();
+    });
+    for (auto& b : batches) {
+        push_batch(b.share());
+    }
+    for (auto& b : batches) {
+        auto returned = read_batch();
+        EXPECT_EQ(b, returned);
+    }
+    EXPECT_EQ(error_count(), 0);
+    linger.reset();
+}
+
 TEST_F(ProcessorTestFixture, TracksOffsets) {
     constexpr int num_batches = 32;
     std::vector<model::record_batch> first_batches;
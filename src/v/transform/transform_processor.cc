@@ -10,6 +10,7 @@
  */
 #include "transform/transform_processor.h"
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
@@ -27,14 +28,28 @@
 
 #include <optional>
 
+using namespace std::chrono_literals;
+
 namespace transform {
 
 namespace {
 
+// The queues between the stages are bounded by the buffer memory, the element
+// count only needs to be large enough to not limit small batches.
+constexpr size_t max_queued_batches = 32;
+
 class queue_output_consumer {
 public:
-    queue_output_consumer(ss::queue<model::record_batch>* output, probe* probe)
+    queue_output_consumer(
+      ss::queue<consumed_batch>* output,
+      ssx::semaphore* memory,
+      size_t max_memory,
+      ss::abort_source* as,
+      probe* probe)
       : _output(output)
+      , _memory(memory)
+      , _max_memory(max_memory)
+      , _as(as)
       , _probe(probe) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch b) {
@@ -43,46 +58,66 @@ public:
         // model::record_batch.
         _last_offset = model::offset_cast(b.last_offset());
         _probe->increment_read_bytes(b.size_bytes());
-        co_await _output->push_eventually(std::move(b));
+        // A batch larger than the whole buffer takes all of it so that we
+        // still make progress.
+        auto size = std::min(size_t(b.size_bytes()), _max_memory);
+        ssx::semaphore_units units;
+        try {
+            units = co_await ss::get_units(*_memory, size, *_as);
+        } catch (...) {
+            // Prefer the processor's shutdown exception over the semaphore's.
+            _as->check();
+            throw;
+        }
+        co_await _output->push_eventually(
+          {.batch = std::move(b), .memory = std::move(units)});
         co_return ss::stop_iteration::no;
     }
     std::optional<kafka::offset> end_of_stream() const { return _last_offset; }
 
 private:
     std::optional<kafka::offset> _last_offset;
-    ss::queue<model::record_batch>* _output;
+    ss::queue<consumed_batch>* _output;
+    ssx::semaphore* _memory;
+    size_t _max_memory;
+    ss::abort_source* _as;
     probe* _probe;
 };
 
 struct drain_result {
     ss::chunked_fifo<model::record_batch> batches;
-    kafka::offset latest_offset;
+    std::optional<kafka::offset> latest_offset;
+    size_t size_bytes = 0;
+    ssx::semaphore_units memory;
 };
 
-ss::future<drain_result>
-drain_queue(ss::queue<transformed_batch>* queue, probe* p) {
-    static constexpr size_t max_batches_bytes = 1_MiB;
-    if (queue->empty()) {
-        co_await queue->not_empty();
-    }
-    drain_result result;
-    size_t batches_size = 0;
+/**
+ * Move the transformed batches from the queue into the result, until the
+ * result is max_bytes large.
+ */
+void drain_queue(
+  ss::queue<transformed_batch>* queue,
+  size_t max_bytes,
+  drain_result* result,
+  probe* p) {
     while (!queue->empty()) {
         auto batch_size = queue->front().batch.size_bytes();
-        batches_size += queue->front().batch.size_bytes();
         // ensure if there is a large batch we make some progress
         // otherwise cap how much data we send to the sink at once.
-        if (!result.batches.empty() && batches_size > max_batches_bytes) {
+        if (
+          result->latest_offset.has_value()
+          && result->size_bytes + batch_size > max_bytes) {
             break;
         }
         p->increment_write_bytes(batch_size);
+        result->size_bytes += batch_size;
         auto transformed = queue->pop();
-        result.latest_offset = transformed.input_offset;
+        result->latest_offset = transformed.input_offset;
+        result->memory.adopt(std::move(transformed.memory));
         if (transformed.batch.record_count() > 0) {
-            result.batches.push_back(std::move(transformed.batch));
+            result->batches.push_back(std::move(transformed.batch));
         }
     }
-    co_return result;
 }
 
 /**
@@ -116,8 +151,15 @@ processor::processor(
   , _offset_tracker(std::move(offset_tracker))
   , _state_callback(std::move(cb))
   , _probe(p)
-  , _consumer_transform_pipe(1)
-  , _transform_producer_pipe(1)
+  , _write_linger(
+      config::shard_local_cfg().data_transforms_write_linger_ms.bind())
+  , _write_max_batch_bytes(
+      config::shard_local_cfg().data_transforms_write_max_batch_bytes.bind())
+  , _buffer_memory(
+      config::shard_local_cfg().data_transforms_buffer_memory_per_partition())
+  , _buffer_memory_sem(_buffer_memory, "transform/processor")
+  , _consumer_transform_pipe(max_queued_batches)
+  , _transform_producer_pipe(max_queued_batches)
   , _task(ss::now())
   , _logger(tlog, ss::format("{}/{}", _meta.name(), _ntp.tp.partition())) {
     vassert(
@@ -134,8 +176,9 @@ ss::future<> processor::start() {
     _as = {};
     co_await _source->start();
     co_await _offset_tracker->start();
-    _consumer_transform_pipe = ss::queue<model::record_batch>(1);
-    _transform_producer_pipe = ss::queue<transformed_batch>(1);
+    _consumer_transform_pipe = ss::queue<consumed_batch>(max_queued_batches);
+    _transform_producer_pipe = ss::queue<transformed_batch>(
+      max_queued_batches);
     _task = handle_processor_task(_engine->start().then([this] {
         return load_start_offset().then([this](kafka::offset start_offset) {
             // Mark that we're running now that the start offset is loaded.
@@ -209,7 +252,12 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
     while (!_as.abort_requested()) {
         auto reader = co_await _source->read_batch(offset, &_as);
         auto last_offset = co_await std::move(reader).consume(
-          queue_output_consumer(&_consumer_transform_pipe, _probe),
+          queue_output_consumer(
+            &_consumer_transform_pipe,
+            &_buffer_memory_sem,
+            _buffer_memory,
+            &_as,
+            _probe),
           model::no_timeout);
         if (!last_offset) {
             vlog(
@@ -226,20 +274,39 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
 
 ss::future<> processor::run_transform_loop() {
     while (!_as.abort_requested()) {
-        auto batch = co_await _consumer_transform_pipe.pop_eventually();
-        auto offset = model::offset_cast(batch.last_offset());
-        batch = co_await _engine->transform(std::move(batch), _probe);
-        co_await _transform_producer_pipe.push_eventually(
-          {.batch = std::move(batch), .input_offset = offset});
+        auto consumed = co_await _consumer_transform_pipe.pop_eventually();
+        auto offset = model::offset_cast(consumed.batch.last_offset());
+        auto batch = co_await _engine->transform(
+          std::move(consumed.batch), _probe);
+        co_await _transform_producer_pipe.push_eventually({
+          .batch = std::move(batch),
+          .input_offset = offset,
+          .memory = std::move(consumed.memory),
+        });
     }
 }
 
 ss::future<> processor::run_producer_loop() {
     while (!_as.abort_requested()) {
-        auto drained = co_await drain_queue(&_transform_producer_pipe, _probe);
+        co_await _transform_producer_pipe.not_empty();
+        auto max_bytes = _write_max_batch_bytes();
+        drain_result drained;
+        drain_queue(&_transform_producer_pipe, max_bytes, &drained, _probe);
+        auto linger = _write_linger();
+        if (linger > 0ms && drained.size_bytes < max_bytes) {
+            // Give the transform a chance to produce more batches so they
+            // are written together.
+            try {
+                co_await ss::sleep_abortable<ss::lowres_clock>(linger, _as);
+            } catch (const ss::sleep_aborted&) {
+                co_return;
+            }
+            drain_queue(&_transform_producer_pipe, max_bytes, &drained, _probe);
+        }
         co_await _sinks[0]->write(std::move(drained.batches));
-        co_await _offset_tracker->commit_offset(drained.latest_offset);
-        report_lag(_source->latest_offset() - drained.latest_offset);
+        auto latest_offset = drained.latest_offset.value();
+        co_await _offset_tracker->commit_offset(latest_offset);
+        report_lag(_source->latest_offset() - latest_offset);
     }
 }
 
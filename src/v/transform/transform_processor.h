@@ -11,12 +11,14 @@
 
 #pragma once
 
+#include "config/property.h"
 #include "metrics/metrics.h"
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
 #include "model/transform.h"
 #include "seastarx.h"
+#include "ssx/semaphore.h"
 #include "transform/io.h"
 #include "transform/probe.h"
 #include "utils/prefix_logger.h"
@@ -28,6 +30,15 @@
 
 namespace transform {
 
+/**
+ * A batch read from the input partition, along with the buffer memory it's
+ * accounted against until its transformed result is written.
+ */
+struct consumed_batch {
+    model::record_batch batch;
+    ssx::semaphore_units memory;
+};
+
 /**
  * A holder of the result of a transform, along with the input offset the batch
  * was read at.
@@ -35,6 +46,7 @@ namespace transform {
 struct transformed_batch {
     model::record_batch batch;
     kafka::offset input_offset;
+    ssx::semaphore_units memory;
 };
 
 /**
@@ -42,6 +54,20 @@ struct transformed_batch {
  *
  * At it's heart it's a fiber that reads->transforms->writes batches
  * from an input ntp to an output ntp.
+ *
+ * The three stages run concurrently. Batches are buffered between them up to
+ * data_transforms_buffer_memory_per_partition bytes: the consumer waits for
+ * memory before reading more and the memory is returned once the transformed
+ * batch is written. The producer writes whatever is buffered at once, up to
+ * data_transforms_write_max_batch_bytes, optionally waiting up to
+ * data_transforms_write_linger_ms for more.
+ *
+ * The wasm engine is not owned by the processor: the engines made by the
+ * factories of wasm::caching_runtime are shared by all the processors of a
+ * transform on a shard, which take turns to run their batches through it.
+ * Everything that is specific to the partition (offsets, buffered batches)
+ * lives in the processor, and its committed offset is tracked per partition
+ * by the commit_batcher of the shard.
  */
 class processor {
 public:
@@ -95,7 +121,12 @@ private:
     state_callback _state_callback;
     probe* _probe;
 
-    ss::queue<model::record_batch> _consumer_transform_pipe;
+    config::binding<std::chrono::milliseconds> _write_linger;
+    config::binding<size_t> _write_max_batch_bytes;
+    size_t _buffer_memory;
+    ssx::semaphore _buffer_memory_sem;
+
+    ss::queue<consumed_batch> _consumer_transform_pipe;
     ss::queue<transformed_batch> _transform_producer_pipe;
 
     ss::abort_source _as;
@@ -18,10 +18,12 @@
 
 #include <seastar/util/log.hh>
 
+#include <array>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <span>
+#include <stdexcept>
 #include <type_traits>
 #include <variant>
 
@@ -660,9 +662,21 @@ private:
         }
     }
     void unpack(std::span<TVal, row_width> output, uint8_t n) {
-        [&]<size_t... Is>(std::index_sequence<Is...>) {
-            ((void)(n == Is ? (unpack<Is>(output), true) : false), ...);
-        }(std::make_index_sequence<sizeof(uint64_t) * 8 + 1>{});
+        using unpack_fn = void (deltafor_decoder::*)(
+          std::span<TVal, row_width>);
+        // one specialized kernel per bit width, indexed by the row header.
+        // the table lookup replaces a chain of comparisons of the width that
+        // every decoded row used to go through.
+        static constexpr auto kernels =
+          []<size_t... Is>(std::index_sequence<Is...>) {
+              return std::array<unpack_fn, sizeof...(Is)>{
+                &deltafor_decoder::template unpack<Is>...};
+          }(std::make_index_sequence<sizeof(uint64_t) * 8 + 1>{});
+        if (n >= kernels.size()) {
+            throw std::runtime_error(
+              fmt::format("deltafor_decoder: invalid bit width {}", n));
+        }
+        (this->*kernels[n])(output);
     }
 
     TVal _initial;
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+ * Per-shard cache of the buffers of the full fragments of the fragmented
+ * containers.
+ *
+ * The vectors built for a single request or report allocate and free the same
+ * few large fragment sizes over and over. The freed fragments of a size are
+ * kept on a free list and handed out again to the next allocation of that
+ * size, up to a cap on the bytes cached by the shard, above which they go back
+ * to the allocator.
+ *
+ * A buffer freed on another shard than the one it was allocated on is cached
+ * by the shard which freed it, like any other buffer.
+ */
+class fragment_pool {
+public:
+    static constexpr size_t default_max_cached_bytes = 4 * 1024 * 1024;
+
+    fragment_pool() = default;
+    fragment_pool(const fragment_pool&) = delete;
+    fragment_pool& operator=(const fragment_pool&) = delete;
+    fragment_pool(fragment_pool&&) = delete;
+    fragment_pool& operator=(fragment_pool&&) = delete;
+
+    ~fragment_pool() noexcept {
+        for (auto& c : _classes) {
+            for (auto* p : c.free) {
+                ::operator delete(p);
+            }
+        }
+    }
+
+    /// Pool of the current shard
+    static fragment_pool& local() {
+        static thread_local fragment_pool pool;
+        return pool;
+    }
+
+    void* allocate(size_t bytes) {
+        if (auto* c = find(bytes); c != nullptr && !c->free.empty()) {
+            auto* p = c->free.back();
+            c->free.pop_back();
+            _cached_bytes -= bytes;
+            ++_hits;
+            return p;
+        }
+        ++_misses;
+        return ::operator new(bytes);
+    }
+
+    void deallocate(void* p, size_t bytes) noexcept {
+        if (_cached_bytes + bytes <= _max_cached_bytes) {
+            try {
+                auto* c = find(bytes);
+                if (c == nullptr) {
+                    c = &_classes.emplace_back(size_class{.bytes = bytes, .free = {}});
+                }
+                c->free.push_back(p);
+                _cached_bytes += bytes;
+                return;
+            } catch (const std::bad_alloc&) {
+                // fall through and free the buffer
+            }
+        }
+        ::operator delete(p);
+    }
+
+    /// Cap of the bytes cached by the shard, the buffers cached above the new
+    /// cap are freed.
+    void set_max_cached_bytes(size_t max) {
+        _max_cached_bytes = max;
+        for (auto& c : _classes) {
+            while (_cached_bytes > _max_cached_bytes && !c.free.empty()) {
+                ::operator delete(c.free.back());
+                c.free.pop_back();
+                _cached_bytes -= c.bytes;
+            }
+        }
+    }
+
+    size_t cached_bytes() const { return _cached_bytes; }
+    /// Allocations served from, and not from, the cached buffers
+    size_t hits() const { return _hits; }
+    size_t misses() const { return _misses; }
+
+private:
+    struct size_class {
+        size_t bytes;
+        std::vector<void*> free;
+    };
+
+    // The fragment sizes in use are few, a linear search is the fastest
+    size_class* find(size_t bytes) {
+        for (auto& c : _classes) {
+            if (c.bytes == bytes) {
+                return &c;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<size_class> _classes;
+    size_t _cached_bytes{0};
+    size_t _max_cached_bytes{default_max_cached_bytes};
+    size_t _hits{0};
+    size_t _misses{0};
+};
+
+/**
+ * Allocator of the fragments of a fragmented container: the buffers of
+ * exactly \p pooled_elems elements, the full fragments, come from the
+ * fragment_pool of the shard, the others from the regular allocator. Types
+ * aligned above the default new alignment are not pooled.
+ */
+template<typename T, size_t pooled_elems>
+class fragment_allocator {
+    static constexpr bool poolable = alignof(T)
+                                     <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = fragment_allocator<U, pooled_elems>;
+    };
+
+    fragment_allocator() noexcept = default;
+    template<typename U>
+    explicit fragment_allocator(
+      const fragment_allocator<U, pooled_elems>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if (poolable && n == pooled_elems) {
+            return static_cast<T*>(
+              fragment_pool::local().allocate(n * sizeof(T)));
+        }
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (poolable && n == pooled_elems) {
+            fragment_pool::local().deallocate(p, n * sizeof(T));
+            return;
+        }
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const fragment_allocator<U, pooled_elems>&) const noexcept {
+        return true;
+    }
+};
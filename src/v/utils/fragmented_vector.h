@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include "utils/fragment_pool.h"
 #include "vassert.h"
 
 #include <seastar/core/coroutine.hh>
@@ -31,11 +32,17 @@ struct fragmented_vector_accessor;
  * A very very simple fragmented vector that provides random access like a
  * vector, but does not store its data in contiguous memory.
  *
- * There is no reserve method because we allocate a full fragment at a time.
+ * There is no reserve method because we allocate a fragment at a time.
  * However, after you populate a vector you might want to call shrink to fit if
  * your fragment is large. A more advanced strategy could allocate capacity up
  * front which just requires a bit more accounting.
  *
+ * The first fragment starts small and doubles up to the full fragment size, so
+ * that the many short vectors don't pay for a full fragment. The buffers of
+ * the full fragments are recycled through the fragment_pool of the shard, the
+ * large short-lived vectors built for a request or a report reuse the
+ * fragments freed by the previous ones instead of going to the allocator.
+ *
  * The iterator implementation works for a few things like std::lower_bound,
  * upper_bound, distance, etc... see fragmented_vector_test.
  *
@@ -48,11 +55,12 @@ struct fragmented_vector_accessor;
  */
 template<typename T, size_t max_fragment_size = 8192>
 class fragmented_vector {
-    // calculate the maximum number of elements per fragment while
-    // keeping the element count a power of two
-    static constexpr size_t calc_elems_per_frag(size_t esize) {
-        size_t max = max_fragment_size / esize;
-        assert(max > 0);
+    // calculate the maximum number of elements per fragment of frag_size
+    // bytes while keeping the element count a power of two
+    static constexpr size_t
+    calc_elems_per_frag(size_t esize, size_t frag_size = max_fragment_size) {
+        size_t max = std::max<size_t>(frag_size / esize, 1);
+        assert(esize <= max_fragment_size);
         // round down to a power of two
         size_t pow2 = 1;
         while (pow2 * 2 <= max) {
@@ -68,6 +76,13 @@ class fragmented_vector {
       "element count per fragment must be a power of 2");
     static_assert(elems_per_frag >= 1);
 
+    // capacity of the first fragment when it is allocated
+    static constexpr size_t min_first_frag_bytes = 256;
+    static constexpr size_t initial_elems_per_frag = std::min(
+      elems_per_frag, calc_elems_per_frag(sizeof(T), min_first_frag_bytes));
+
+    using fragment_type = std::vector<T, fragment_allocator<T, elems_per_frag>>;
+
 public:
     using this_type = fragmented_vector<T, max_fragment_size>;
     using value_type = T;
@@ -141,8 +156,8 @@ public:
         _frags.back().pop_back();
         --_size;
         if (_frags.back().empty()) {
+            _capacity -= _frags.back().capacity();
             _frags.pop_back();
-            _capacity -= elems_per_frag;
         }
     }
 
@@ -163,8 +178,8 @@ public:
 
         while (n >= _frags.back().size()) {
             n -= _frags.back().size();
+            _capacity -= _frags.back().capacity();
             _frags.pop_back();
-            _capacity -= elems_per_frag;
         }
 
         for (size_t i = 0; i < n; ++i) {
@@ -191,7 +206,9 @@ public:
 
     void shrink_to_fit() {
         if (!_frags.empty()) {
+            _capacity -= _frags.back().capacity();
             _frags.back().shrink_to_fit();
+            _capacity += _frags.back().capacity();
         }
     }
 
@@ -203,7 +220,7 @@ public:
      * Returns the approximate in-memory size of this vector in bytes.
      */
     size_t memory_size() const {
-        return _frags.size() * (sizeof(_frags[0]) + elems_per_frag * sizeof(T));
+        return _frags.size() * sizeof(fragment_type) + _capacity * sizeof(T);
     }
 
     /**
@@ -221,7 +238,7 @@ public:
      */
     void clear() {
         // do the swap dance to actually clear the memory held by the vector
-        std::vector<std::vector<T>>{}.swap(_frags);
+        std::vector<fragment_type>{}.swap(_frags);
         _size = 0;
         _capacity = 0;
     }
@@ -320,16 +337,37 @@ public:
 
 private:
     void maybe_add_capacity() {
-        if (_size == _capacity) {
-            std::vector<T> frag;
-            frag.reserve(elems_per_frag);
-            _frags.push_back(std::move(frag));
-            _capacity += elems_per_frag;
+        if (_size != _capacity) {
+            return;
         }
+        if (_frags.size() == 1 && _capacity < elems_per_frag) {
+            // grow the first fragment in place, its elements keep their
+            // indices
+            auto& frag = _frags.front();
+            frag.reserve(std::min(_capacity * 2, elems_per_frag));
+            _capacity = frag.capacity();
+            return;
+        }
+        fragment_type frag;
+        frag.reserve(_frags.empty() ? initial_elems_per_frag : elems_per_frag);
+        _frags.push_back(std::move(frag));
+        _capacity += _frags.back().capacity();
     }
 
 private:
-    fragmented_vector(const fragmented_vector&) noexcept = default;
+    // the fragments of the copy have the capacities of the original ones,
+    // so that the full fragments come from the pool and the accounting of
+    // the capacity holds
+    fragmented_vector(const fragmented_vector& other) noexcept
+      : _size(other._size)
+      , _capacity(other._capacity) {
+        _frags.reserve(other._frags.size());
+        for (const auto& f : other._frags) {
+            auto& frag = _frags.emplace_back();
+            frag.reserve(f.capacity());
+            frag.insert(frag.end(), f.begin(), f.end());
+        }
+    }
 
     template<typename TT, size_t SS>
     friend seastar::future<>
@@ -341,7 +379,7 @@ private:
 
     size_t _size{0};
     size_t _capacity{0};
-    std::vector<std::vector<T>> _frags;
+    std::vector<fragment_type> _frags;
 };
 
 /**
@@ -0,0 +1,67 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/fragment_pool.h"
+#include "utils/fragmented_vector.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <cstdint>
+
+namespace {
+
+constexpr size_t vectors_count = 100;
+
+// a large vector built and dropped for every request, like the partition
+// lists of the health reports
+template<typename Vec>
+size_t build_and_drop(size_t elements) {
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < vectors_count; ++i) {
+        Vec v;
+        for (size_t j = 0; j < elements; ++j) {
+            v.push_back(j);
+        }
+        perf_tests::do_not_optimize(v);
+    }
+    perf_tests::stop_measuring_time();
+    return vectors_count * elements;
+}
+
+struct no_pool {
+    no_pool() { fragment_pool::local().set_max_cached_bytes(0); }
+    ~no_pool() {
+        fragment_pool::local().set_max_cached_bytes(
+          fragment_pool::default_max_cached_bytes);
+    }
+};
+
+} // namespace
+
+PERF_TEST(fragmented_vector, build_small) {
+    return build_and_drop<fragmented_vector<int64_t>>(10);
+}
+
+PERF_TEST(fragmented_vector, build_large) {
+    return build_and_drop<fragmented_vector<int64_t>>(100'000);
+}
+
+PERF_TEST(fragmented_vector, build_large_no_pool) {
+    no_pool np;
+    return build_and_drop<fragmented_vector<int64_t>>(100'000);
+}
+
+PERF_TEST(fragmented_vector, build_large_fragment_vector) {
+    return build_and_drop<large_fragment_vector<int64_t>>(100'000);
+}
+
+PERF_TEST(fragmented_vector, build_large_fragment_vector_no_pool) {
+    no_pool np;
+    return build_and_drop<large_fragment_vector<int64_t>>(100'000);
+}
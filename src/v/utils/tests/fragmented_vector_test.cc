@@ -10,6 +10,7 @@
  */
 #include "random/generators.h"
 #include "serde/serde.h"
+#include "utils/fragment_pool.h"
 #include "utils/fragmented_vector.h"
 
 #include <boost/test/tools/old/interface.hpp>
@@ -67,6 +68,12 @@ struct fragmented_vector_accessor {
               v._capacity));
         }
     }
+
+    template<typename T, size_t S>
+    static size_t
+    fragment_capacity(const fragmented_vector<T, S>& v, size_t i) {
+        return v._frags.at(i).capacity();
+    }
 };
 } // namespace test_details
 
@@ -368,3 +375,65 @@ BOOST_AUTO_TEST_CASE(fragmented_vector_constructor_from_iter_range) {
 
     test_details::fragmented_vector_accessor::check_consistency(fv);
 }
+
+BOOST_AUTO_TEST_CASE(fragmented_vector_small_first_fragment) {
+    using accessor = test_details::fragmented_vector_accessor;
+    checker<int64_t, 1024> v;
+    const auto full = static_cast<int64_t>(v.u.elements_per_fragment());
+
+    v->push_back(0);
+    BOOST_REQUIRE_LT(accessor::fragment_capacity(v.u, 0), size_t(full));
+
+    // the first fragment doubles until it is full
+    for (int64_t i = 1; i < 3 * full; ++i) {
+        v->push_back(i);
+    }
+    BOOST_REQUIRE_EQUAL(accessor::fragment_capacity(v.u, 0), size_t(full));
+    BOOST_REQUIRE_EQUAL(accessor::fragment_capacity(v.u, 1), size_t(full));
+    for (int64_t i = 0; i < 3 * full; ++i) {
+        BOOST_REQUIRE_EQUAL(v.get()[i], i);
+    }
+
+    v->pop_back_n(2 * full + 1);
+    v->shrink_to_fit();
+    accessor::check_consistency(v.u);
+
+    auto copy = v->copy();
+    accessor::check_consistency(copy);
+    BOOST_REQUIRE(copy == v.u);
+}
+
+BOOST_AUTO_TEST_CASE(fragmented_vector_fragment_pool_reuse) {
+    auto& pool = fragment_pool::local();
+    const auto fill = [](fragmented_vector<int64_t, 1024>& v) {
+        for (size_t i = 0; i < 10 * v.elements_per_fragment(); ++i) {
+            v.push_back(i);
+        }
+    };
+
+    {
+        fragmented_vector<int64_t, 1024> v;
+        fill(v);
+    }
+    // the full fragments of the first vector are cached
+    BOOST_REQUIRE_GE(pool.cached_bytes(), 10 * 1024);
+
+    const auto hits = pool.hits();
+    const auto misses = pool.misses();
+    {
+        fragmented_vector<int64_t, 1024> v;
+        fill(v);
+        BOOST_REQUIRE_EQUAL(pool.hits() - hits, size_t(10));
+        BOOST_REQUIRE_EQUAL(pool.misses(), misses);
+    }
+
+    // the bytes cached above the cap are freed
+    pool.set_max_cached_bytes(2 * 1024);
+    BOOST_REQUIRE_LE(pool.cached_bytes(), 2 * 1024);
+    {
+        fragmented_vector<int64_t, 1024> v;
+        fill(v);
+    }
+    BOOST_REQUIRE_LE(pool.cached_bytes(), 2 * 1024);
+    pool.set_max_cached_bytes(fragment_pool::default_max_cached_bytes);
+}
@@ -0,0 +1,59 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "random/generators.h"
+#include "utils/vint.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+namespace {
+
+constexpr size_t values_count = 100'000;
+
+// mostly small values, like the deltas and lengths of small records
+iobuf make_varints() {
+    iobuf buf;
+    for (size_t i = 0; i < values_count; ++i) {
+        const auto v = random_generators::get_int<int64_t>(
+          -(int64_t(1) << random_generators::get_int(0, 20)),
+          int64_t(1) << random_generators::get_int(0, 20));
+        const auto b = vint::to_bytes(v);
+        buf.append(b.data(), b.size());
+    }
+    return buf;
+}
+
+} // namespace
+
+PERF_TEST(vint, deserialize_bytewise) {
+    auto buf = make_varints();
+    iobuf::iterator_consumer in(buf.cbegin(), buf.cend());
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < values_count; ++i) {
+        auto [v, len] = vint::deserialize(in);
+        in.skip(len);
+        perf_tests::do_not_optimize(v);
+    }
+    perf_tests::stop_measuring_time();
+    return values_count;
+}
+
+PERF_TEST(vint, parser_read_varlong) {
+    auto buf = make_varints();
+    iobuf_const_parser parser(buf);
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < values_count; ++i) {
+        auto [v, len] = parser.read_varlong();
+        perf_tests::do_not_optimize(v);
+    }
+    perf_tests::stop_measuring_time();
+    return values_count;
+}
@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "bytes/bytes.h"
+#include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
 #include "random/generators.h"
 #include "utils/vint.h"
@@ -65,3 +66,73 @@ SEASTAR_THREAD_TEST_CASE(test_unsigned_stream_deserializer) {
       = unsigned_vint::stream_deserialize(istream).get();
     BOOST_CHECK_EQUAL(result, test_number);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_word_deserializer_matches_scalar) {
+    for (int i = 0; i < 100000; ++i) {
+        const auto shift = random_generators::get_int(0, 63);
+        const auto v = static_cast<int64_t>(
+          random_generators::get_int<uint64_t>() >> shift);
+        const auto b = vint::to_bytes(v);
+
+        // pad with continuation bytes so the word holds garbage
+        std::array<uint8_t, 2 * vint::max_length> buf;
+        buf.fill(0xff);
+        std::copy(b.begin(), b.end(), buf.begin());
+
+        const auto [expected, expected_len] = vint::deserialize(bytes_view(b));
+        const auto res = vint::deserialize_word(buf.data());
+        if (b.size() > sizeof(uint64_t)) {
+            BOOST_REQUIRE(!res);
+            continue;
+        }
+        BOOST_REQUIRE(res);
+        BOOST_REQUIRE_EQUAL(res->first, expected);
+        BOOST_REQUIRE_EQUAL(res->second, expected_len);
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_unsigned_word_deserializer_matches_scalar) {
+    for (int i = 0; i < 100000; ++i) {
+        const auto v = random_generators::get_int<uint32_t>()
+                       >> random_generators::get_int(0, 31);
+        const auto b = unsigned_vint::to_bytes(v);
+        std::array<uint8_t, 2 * vint::max_length> buf;
+        buf.fill(0xff);
+        std::copy(b.begin(), b.end(), buf.begin());
+
+        const auto res = unsigned_vint::deserialize_word(buf.data());
+        BOOST_REQUIRE(res);
+        BOOST_REQUIRE_EQUAL(res->first, v);
+        BOOST_REQUIRE_EQUAL(res->second, b.size());
+    }
+
+    // longer than max_length is left to the scalar decoder
+    std::array<uint8_t, 2 * vint::max_length> buf;
+    buf.fill(0x80);
+    buf[6] = 0x01;
+    BOOST_REQUIRE(!unsigned_vint::deserialize_word(buf.data()));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_parser_varlong) {
+    // contiguous varints take the word path, varints in fragments shorter
+    // than a word take the byte-wise path
+    iobuf contiguous;
+    iobuf fragmented;
+    std::vector<int64_t> values;
+    for (int i = 0; i < 1000; ++i) {
+        const auto v = static_cast<int64_t>(
+          random_generators::get_int<uint64_t>()
+          >> random_generators::get_int(0, 63));
+        values.push_back(v);
+        const auto b = vint::to_bytes(v);
+        contiguous.append(b.data(), b.size());
+        fragmented.append_fragments(bytes_to_iobuf(b));
+    }
+    for (const auto* buf : {&contiguous, &fragmented}) {
+        iobuf_const_parser parser(*buf);
+        for (auto v : values) {
+            BOOST_REQUIRE_EQUAL(parser.read_varlong().first, v);
+        }
+        BOOST_REQUIRE_EQUAL(parser.bytes_left(), 0);
+    }
+}
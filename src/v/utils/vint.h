@@ -12,7 +12,11 @@
 #pragma once
 #include "bytes/bytes.h"
 
+#include <seastar/core/byteorder.hh>
+
+#include <bit>
 #include <cstdint>
+#include <optional>
 
 namespace unsigned_vint {
 /// At most 5 bytes are needed to encode a 32 bit value
@@ -63,6 +67,39 @@ deserialize(Range&& r, uint8_t limit) noexcept {
     return std::make_pair(decoder.result, decoder.bytes_read);
 }
 
+/**
+ * Decode a varint of at most \p max_bytes bytes from a contiguous buffer
+ * holding at least 8 readable bytes, without a per-byte loop.
+ *
+ * The first 8 bytes are loaded as one little endian word. The terminating
+ * byte is the lowest byte with a clear continuation bit, and the 7 bit
+ * groups below it are compacted pairwise in three shift-and-mask steps.
+ * Returns std::nullopt when the varint is longer than 8 bytes or than
+ * \p max_bytes, in which case the caller falls back to deserialize().
+ */
+inline std::optional<std::pair<uint64_t, size_t>>
+deserialize_word(const uint8_t* src, size_t max_bytes) noexcept {
+    constexpr uint64_t continuation_bits = 0x8080808080808080ULL;
+    const auto word = ss::read_le<uint64_t>(reinterpret_cast<const char*>(src));
+    const auto stop_bits = ~word & continuation_bits;
+    if (unlikely(stop_bits == 0)) {
+        return std::nullopt;
+    }
+    const size_t len = (std::countr_zero(stop_bits) / 8) + 1;
+    if (unlikely(len > max_bytes)) {
+        return std::nullopt;
+    }
+    // keep the bytes of this varint and drop the continuation bits
+    auto x = word & ~continuation_bits;
+    if (len < sizeof(uint64_t)) {
+        x &= (uint64_t(1) << (len * 8)) - 1;
+    }
+    x = ((x & 0x7f007f007f007f00ULL) >> 1) | (x & 0x007f007f007f007fULL);
+    x = ((x & 0x3fff00003fff0000ULL) >> 2) | (x & 0x00003fff00003fffULL);
+    x = ((x & 0x0fffffff00000000ULL) >> 4) | (x & 0x000000000fffffffULL);
+    return std::make_pair(x, len);
+}
+
 } // namespace detail
 
 inline size_t serialize(uint64_t value, uint8_t* out) noexcept {
@@ -94,6 +131,17 @@ inline std::pair<uint32_t, size_t> deserialize(Range&& r) noexcept {
     return {static_cast<uint32_t>(result), bytes_read};
 }
 
+/// Decode from a buffer with at least 8 readable bytes, see
+/// detail::deserialize_word.
+inline std::optional<std::pair<uint32_t, size_t>>
+deserialize_word(const uint8_t* src) noexcept {
+    auto res = detail::deserialize_word(src, max_length);
+    if (!res) {
+        return std::nullopt;
+    }
+    return std::make_pair(static_cast<uint32_t>(res->first), res->second);
+}
+
 inline constexpr size_t size(uint64_t v) noexcept {
     size_t len = 1;
     while (v >= 128) {
@@ -160,6 +208,17 @@ inline std::pair<int64_t, size_t> deserialize(Range&& r) noexcept {
     return {decode_zigzag(result), bytes_read};
 }
 
+/// Decode from a buffer with at least 8 readable bytes, see
+/// unsigned_vint::detail::deserialize_word.
+inline std::optional<std::pair<int64_t, size_t>>
+deserialize_word(const uint8_t* src) noexcept {
+    auto res = unsigned_vint::detail::deserialize_word(src, max_length);
+    if (!res) {
+        return std::nullopt;
+    }
+    return std::make_pair(decode_zigzag(res->first), res->second);
+}
+
 inline bytes to_bytes(int64_t value) noexcept {
     // our bytes uses a short-string optimization of 31 bytes, at most
     // vint::max_length bytes will be used to allocate the encoded size at the
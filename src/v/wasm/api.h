@@ -17,7 +17,9 @@
 #include "seastarx.h"
 #include "wasm/fwd.h"
 
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 namespace wasm {
 
@@ -101,6 +103,12 @@ public:
             bool debug_host_stack_usage;
         };
         stack_memory stack_memory;
+        struct compilation_cache {
+            // The directory where compiled modules are kept across restarts,
+            // modules are compiled every time they are loaded if unset.
+            std::optional<std::filesystem::path> directory;
+        };
+        compilation_cache compilation_cache;
     };
 
     virtual ss::future<> start(config) = 0;
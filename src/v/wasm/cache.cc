@@ -11,6 +11,7 @@
 
 #include "wasm/cache.h"
 
+#include "wasm/errc.h"
 #include "wasm/logger.h"
 
 #include <seastar/core/lowres_clock.hh>
@@ -23,6 +24,8 @@
 
 #include <absl/container/btree_set.h>
 
+#include <vector>
+
 namespace wasm {
 
 namespace {
@@ -32,6 +35,13 @@ namespace {
  */
 constexpr auto default_gc_interval = std::chrono::minutes(10);
 
+/**
+ * How long engines are kept running after their last user stopped them. They
+ * are stopped on the first gc past this delay, or sooner if their memory is
+ * needed to create another engine.
+ */
+constexpr auto default_idle_engine_keep_alive = std::chrono::minutes(5);
+
 template<typename Key, typename Value>
 ss::future<int64_t>
 gc_btree_map(absl::btree_map<Key, ss::weak_ptr<Value>>* cache) {
@@ -58,9 +68,24 @@ gc_btree_map(absl::btree_map<Key, ss::weak_ptr<Value>>* cache) {
     co_return cleanup_count;
 }
 
+bool is_engine_creation_failure(const std::exception_ptr& ex) {
+    try {
+        std::rethrow_exception(ex);
+    } catch (const wasm_exception& e) {
+        return e.error_code() == errc::engine_creation_failure;
+    } catch (...) {
+        return false;
+    }
+}
+
 /**
  * Allows sharing an engine between multiple uses.
  *
+ * When the last user stops the engine it can be kept running in the engine
+ * cache for a while, so that the next user (i.e. a partition moving back or
+ * a leadership change) doesn't pay for instantiating and initializing the
+ * module again.
+ *
  * Must live on a single core.
  */
 class shared_engine
@@ -68,11 +93,15 @@ class shared_engine
   , public ss::enable_shared_from_this<shared_engine>
   , public ss::weakly_referencable<shared_engine> {
 public:
-    explicit shared_engine(
+    shared_engine(
       ss::shared_ptr<engine> underlying,
-      ss::foreign_ptr<ss::shared_ptr<factory>> f)
+      ss::foreign_ptr<ss::shared_ptr<factory>> f,
+      model::offset offset,
+      engine_cache* cache)
       : _underlying(std::move(underlying))
-      , _factory(std::move(f)) {}
+      , _factory(std::move(f))
+      , _offset(offset)
+      , _cache(cache) {}
 
     ss::future<model::record_batch>
     transform(model::record_batch batch, transform_probe* probe) override {
@@ -95,18 +124,16 @@ public:
         std::rethrow_exception(fut.get_exception());
     }
 
-    ss::future<> start() override {
-        auto u = co_await _mu.get_units();
-        if (_ref_count++ == 0) {
-            co_await _underlying->start();
-        }
-    }
-    ss::future<> stop() override {
-        vassert(
-          _ref_count > 0, "expected a call to start before a call to stop");
+    ss::future<> start() override;
+    ss::future<> stop() override;
+
+    /**
+     * Stop the underlying engine if it has been kept running without users.
+     */
+    ss::future<> stop_if_idle() {
         auto u = co_await _mu.get_units();
-        if (--_ref_count == 0) {
-            co_await _underlying->stop();
+        if (_ref_count == 0 && _running) {
+            co_await stop_underlying();
         }
     }
 
@@ -116,11 +143,21 @@ public:
     }
 
 private:
+    ss::future<> start_underlying();
+    ss::future<> stop_underlying() {
+        _running = false;
+        return _underlying->stop();
+    }
+
     mutex _mu;
     size_t _ref_count = 0;
+    // If the underlying engine was started, it may be running without users.
+    bool _running = false;
     ss::shared_ptr<engine> _underlying;
     // This factory reference is here to keep the cache entry alive.
     ss::foreign_ptr<ss::shared_ptr<factory>> _factory;
+    model::offset _offset;
+    engine_cache* _cache;
 };
 
 /**
@@ -185,6 +222,11 @@ private:
 /** A cache for engines on a particular core. */
 class engine_cache {
 public:
+    explicit engine_cache(ss::lowres_clock::duration idle_keep_alive)
+      : _idle_keep_alive(idle_keep_alive) {}
+
+    ss::future<> stop() { co_await evict_idle(); }
+
     void
     put(model::offset offset, const ss::shared_ptr<shared_engine>& engine) {
         _cache.insert_or_assign(offset, engine->weak_from_this());
@@ -200,13 +242,114 @@ public:
         return ss::static_pointer_cast<engine>(it->second->shared_from_this());
     }
 
-    ss::future<int64_t> gc() { return gc_btree_map(&_cache); }
+    /**
+     * If engines should be kept running once their last user stops them.
+     */
+    bool keeps_idle_engines() const {
+        return _idle_keep_alive > ss::lowres_clock::duration::zero();
+    }
+
+    /**
+     * Keep a running engine alive without users until it's evicted.
+     */
+    void park(model::offset offset, ss::shared_ptr<shared_engine> engine) {
+        _idle.insert_or_assign(
+          offset,
+          idle_engine{
+            .engine = std::move(engine), .since = ss::lowres_clock::now()});
+    }
+
+    /**
+     * Take back an idle engine that is used again.
+     */
+    void unpark(model::offset offset) { _idle.erase(offset); }
+
+    /**
+     * Stop the engines idle since before the given time, returns the number
+     * of engines stopped.
+     */
+    ss::future<size_t> evict_idle(
+      ss::lowres_clock::time_point idle_before
+      = ss::lowres_clock::time_point::max()) {
+        // Take the engines out of the map before stopping them, as they are
+        // stopped under their lock and the map can change in the meantime.
+        std::vector<ss::shared_ptr<shared_engine>> evicted;
+        for (auto it = _idle.begin(); it != _idle.end();) {
+            if (it->second.since < idle_before) {
+                evicted.push_back(std::move(it->second.engine));
+                it = _idle.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (auto& engine : evicted) {
+            co_await engine->stop_if_idle();
+        }
+        co_return evicted.size();
+    }
+
+    ss::future<int64_t> gc() {
+        co_await evict_idle(ss::lowres_clock::now() - _idle_keep_alive);
+        co_return co_await gc_btree_map(&_cache);
+    }
 
 private:
+    struct idle_engine {
+        ss::shared_ptr<shared_engine> engine;
+        ss::lowres_clock::time_point since;
+    };
+
     mutex _mu;
     absl::btree_map<model::offset, ss::weak_ptr<shared_engine>> _cache;
+    ss::lowres_clock::duration _idle_keep_alive;
+    absl::btree_map<model::offset, idle_engine> _idle;
 };
 
+namespace {
+
+ss::future<> shared_engine::start() {
+    auto u = co_await _mu.get_units();
+    if (_ref_count++ > 0) {
+        co_return;
+    }
+    if (_running) {
+        // The engine was kept running since its last user stopped it.
+        _cache->unpark(_offset);
+        co_return;
+    }
+    co_await start_underlying();
+}
+
+ss::future<> shared_engine::stop() {
+    vassert(_ref_count > 0, "expected a call to start before a call to stop");
+    auto u = co_await _mu.get_units();
+    if (--_ref_count > 0) {
+        co_return;
+    }
+    if (_running && _cache->keeps_idle_engines()) {
+        _cache->park(_offset, shared_from_this());
+        co_return;
+    }
+    co_await stop_underlying();
+}
+
+ss::future<> shared_engine::start_underlying() {
+    auto fut = co_await ss::coroutine::as_future(_underlying->start());
+    if (fut.failed()) {
+        auto ex = fut.get_exception();
+        // Idle engines may be holding the memory needed to create this one.
+        if (
+          !is_engine_creation_failure(ex)
+          || co_await _cache->evict_idle() == 0) {
+            std::rethrow_exception(ex);
+        }
+        co_await _underlying->start();
+    }
+    _running = true;
+}
+
+} // namespace
+
 /**
  * A factory
  *
@@ -247,7 +390,10 @@ public:
         // created.
         auto foreign_this = co_await foreign_from_this();
         auto created = ss::make_shared<shared_engine>(
-          co_await _underlying->make_engine(), std::move(foreign_this));
+          co_await _underlying->make_engine(),
+          std::move(foreign_this),
+          _offset,
+          &_engine_cache->local());
         _engine_cache->local().put(_offset, created);
         co_return created;
     }
@@ -266,12 +412,16 @@ private:
 };
 
 caching_runtime::caching_runtime(std::unique_ptr<runtime> u)
-  : caching_runtime(std::move(u), default_gc_interval) {}
+  : caching_runtime(
+    std::move(u), default_gc_interval, default_idle_engine_keep_alive) {}
 
 caching_runtime::caching_runtime(
-  std::unique_ptr<runtime> u, ss::lowres_clock::duration gc_interval)
+  std::unique_ptr<runtime> u,
+  ss::lowres_clock::duration gc_interval,
+  ss::lowres_clock::duration idle_engine_keep_alive)
   : _underlying(std::move(u))
   , _gc_interval(gc_interval)
+  , _idle_engine_keep_alive(idle_engine_keep_alive)
   , _gc_timer([this]() {
       ssx::spawn_with_gate(_gate, [this] { return do_gc().discard_result(); });
   }) {}
@@ -280,7 +430,7 @@ caching_runtime::~caching_runtime() = default;
 
 ss::future<> caching_runtime::start(runtime::config c) {
     co_await _underlying->start(c);
-    co_await _engine_caches.start();
+    co_await _engine_caches.start(_idle_engine_keep_alive);
     _gc_timer.arm(_gc_interval);
 }
 
@@ -38,12 +38,18 @@ class cached_factory;
  * single shard. Ramifications of this is that failures to a single engine cause
  * the engine to be restarted and all users of a given engine must wait until
  * it's restarted to use the engine.
+ *
+ * Engines without users are kept running for the idle keep alive duration so
+ * that they can be picked up again without being instantiated, unless their
+ * memory is needed to create other engines.
  */
 class caching_runtime : public runtime {
 public:
     explicit caching_runtime(std::unique_ptr<runtime>);
     caching_runtime(
-      std::unique_ptr<runtime>, ss::lowres_clock::duration gc_interval);
+      std::unique_ptr<runtime>,
+      ss::lowres_clock::duration gc_interval,
+      ss::lowres_clock::duration idle_engine_keep_alive);
     caching_runtime(const caching_runtime&) = delete;
     caching_runtime(caching_runtime&&) = delete;
     caching_runtime& operator=(const caching_runtime&) = delete;
@@ -89,6 +95,7 @@ private:
     absl::btree_map<model::offset, ss::weak_ptr<cached_factory>> _factory_cache;
     ss::sharded<engine_cache> _engine_caches;
     ss::lowres_clock::duration _gc_interval;
+    ss::lowres_clock::duration _idle_engine_keep_alive;
     ss::timer<ss::lowres_clock> _gc_timer;
     ss::gate _gate;
 };
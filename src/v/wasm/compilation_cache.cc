@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "wasm/compilation_cache.h"
+
+#include "hashing/secure.h"
+#include "vlog.h"
+#include "wasm/logger.h"
+
+#include <fmt/format.h>
+
+#include <fstream>
+#include <system_error>
+
+namespace wasm {
+
+namespace {
+constexpr std::string_view artifact_extension = ".cwasm";
+} // namespace
+
+compilation_cache::compilation_cache(std::filesystem::path dir)
+  : _dir(std::move(dir)) {}
+
+size_t
+compilation_cache::start(std::filesystem::file_time_type::duration max_age) {
+    std::filesystem::create_directories(_dir);
+    const auto now = std::filesystem::file_time_type::clock::now();
+    size_t removed = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(_dir)) {
+        std::error_code ec;
+        if (entry.path().extension() == ".tmp") {
+            // the leftover of an interrupted store
+            std::filesystem::remove(entry.path(), ec);
+            continue;
+        }
+        if (
+          !entry.is_regular_file(ec)
+          || entry.path().extension() != artifact_extension) {
+            continue;
+        }
+        auto mtime = entry.last_write_time(ec);
+        if (!ec && now - mtime > max_age) {
+            vlog(
+              wasm_log.info,
+              "removing unused compiled module {}",
+              entry.path().native());
+            if (std::filesystem::remove(entry.path(), ec)) {
+                ++removed;
+            }
+        }
+    }
+    return removed;
+}
+
+std::filesystem::path compilation_cache::path_for(bytes_view source) const {
+    hash_sha256 h;
+    h.update(source);
+    return _dir / fmt::format("{}{}", to_hex(h.reset()), artifact_extension);
+}
+
+void compilation_cache::touch(const std::filesystem::path& path) noexcept {
+    std::error_code ec;
+    std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now(), ec);
+}
+
+void compilation_cache::store(
+  const std::filesystem::path& path, bytes_view artifact) {
+    auto tmp = path;
+    tmp += ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          reinterpret_cast<const char*>(artifact.data()),
+          static_cast<std::streamsize>(artifact.size()));
+        out.close();
+        if (!out) {
+            std::error_code ec;
+            std::filesystem::remove(tmp, ec);
+            throw std::runtime_error(
+              fmt::format("unable to write compiled module {}", tmp.native()));
+        }
+    }
+    std::filesystem::rename(tmp, path);
+}
+
+void compilation_cache::remove(const std::filesystem::path& path) noexcept {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+} // namespace wasm
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/bytes.h"
+
+#include <filesystem>
+
+namespace wasm {
+
+/**
+ * On disk cache of compiled WebAssembly modules.
+ *
+ * Compiling a large module takes seconds, and without this cache a broker
+ * compiles every transform again each time it restarts. The compiled
+ * artifacts are keyed by the SHA-256 of the source module. An artifact is
+ * only valid for the runtime version, engine settings and CPU features it
+ * was compiled with: the runtime checks that when the artifact is loaded,
+ * and an artifact which doesn't pass is compiled again and replaced.
+ *
+ * The artifacts are native code which is loaded without further validation,
+ * so the directory must only be writable by the broker.
+ *
+ * All the operations block: they are meant to be used on the thread which
+ * compiles the modules, not on the reactor.
+ */
+class compilation_cache {
+public:
+    explicit compilation_cache(std::filesystem::path dir);
+
+    /// Create the directory and remove the artifacts which weren't used for
+    /// \p max_age. Returns the number of artifacts removed.
+    size_t start(std::filesystem::file_time_type::duration max_age);
+
+    /// Path of the compiled artifact of the module \p source.
+    std::filesystem::path path_for(bytes_view source) const;
+
+    /// Mark the artifact at \p path as used.
+    void touch(const std::filesystem::path& path) noexcept;
+
+    /// Atomically replace the artifact at \p path with \p artifact.
+    void store(const std::filesystem::path& path, bytes_view artifact);
+
+    /// Remove the artifact at \p path, which failed to load.
+    void remove(const std::filesystem::path& path) noexcept;
+
+private:
+    std::filesystem::path _dir;
+};
+
+} // namespace wasm
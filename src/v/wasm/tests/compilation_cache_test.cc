@@ -0,0 +1,80 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "random/generators.h"
+#include "wasm/compilation_cache.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace wasm {
+
+namespace {
+
+bytes read_file(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::string content{
+      std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return {reinterpret_cast<const uint8_t*>(content.data()), content.size()};
+}
+
+} // namespace
+
+TEST(CompilationCache, StoresArtifactsBySource) {
+    auto dir = std::filesystem::temp_directory_path()
+               / fmt::format(
+                 "wasm_compilation_cache_{}",
+                 random_generators::get_int<uint64_t>());
+    compilation_cache cache(dir);
+    EXPECT_EQ(cache.start(std::chrono::hours(1)), 0);
+
+    auto source = random_generators::get_bytes(128);
+    auto other = random_generators::get_bytes(128);
+    auto path = cache.path_for(source);
+    EXPECT_EQ(path, cache.path_for(source));
+    EXPECT_NE(path, cache.path_for(other));
+    EXPECT_EQ(path.parent_path(), dir);
+
+    auto artifact = random_generators::get_bytes(4096);
+    cache.store(path, artifact);
+    EXPECT_TRUE(read_file(path) == artifact);
+    // a later store replaces the artifact
+    auto replaced = random_generators::get_bytes(1024);
+    cache.store(path, replaced);
+    EXPECT_TRUE(read_file(path) == replaced);
+
+    // artifacts in use are kept, unused ones and interrupted stores are not
+    auto unused = cache.path_for(other);
+    cache.store(unused, artifact);
+    std::filesystem::last_write_time(
+      unused,
+      std::filesystem::file_time_type::clock::now() - std::chrono::hours(2));
+    auto interrupted = path;
+    interrupted += ".tmp";
+    std::ofstream(interrupted) << "partial";
+
+    EXPECT_EQ(cache.start(std::chrono::hours(1)), 1);
+    EXPECT_TRUE(std::filesystem::exists(path));
+    EXPECT_FALSE(std::filesystem::exists(unused));
+    EXPECT_FALSE(std::filesystem::exists(interrupted));
+
+    cache.remove(path);
+    EXPECT_FALSE(std::filesystem::exists(path));
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace wasm
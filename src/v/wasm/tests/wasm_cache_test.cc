@@ -17,16 +17,19 @@
 #include "random/generators.h"
 #include "wasm/api.h"
 #include "wasm/cache.h"
+#include "wasm/errc.h"
 
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/core/when_all.hh>
 
 #include <gtest/gtest.h>
 
 #include <cstdlib>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <type_traits>
@@ -44,6 +47,7 @@ struct state {
     std::atomic_int engines = 0;
     std::atomic_int running_engines = 0;
     std::atomic_int engine_restarts = 0;
+    std::atomic_int max_running_engines = std::numeric_limits<int>::max();
 
     std::atomic_bool engine_transform_should_throw = false;
 };
@@ -61,6 +65,10 @@ public:
     ~fake_engine() override { --_state->engines; }
 
     ss::future<> start() override {
+        if (_state->running_engines >= _state->max_running_engines) {
+            throw wasm_exception(
+              "out of memory", errc::engine_creation_failure);
+        }
         ++_state->running_engines;
         if (_has_been_stopped) {
             ++_state->engine_restarts;
@@ -130,21 +138,32 @@ public:
         vassert(ss::smp::count > 1, "This test expects multiple shards");
     }
 
-    void SetUp() override {
+    void SetUp() override { start_runtime(/*idle_engine_keep_alive=*/{}); }
+
+    void TearDown() override { stop_runtime(); }
+
+    void start_runtime(ss::lowres_clock::duration idle_engine_keep_alive) {
         auto fr = std::make_unique<fake_runtime>();
         _fake_runtime = fr.get();
         // Effectively disable the gc interval
         _caching_runtime = std::make_unique<caching_runtime>(
-          std::move(fr), /*gc_interval=*/std::chrono::hours(1));
+          std::move(fr),
+          /*gc_interval=*/std::chrono::hours(1),
+          idle_engine_keep_alive);
         _caching_runtime->start({}).get();
     }
 
-    void TearDown() override {
+    void stop_runtime() {
         _caching_runtime->stop().get();
         _fake_runtime = nullptr;
         _caching_runtime = nullptr;
     }
 
+    void restart_runtime(ss::lowres_clock::duration idle_engine_keep_alive) {
+        stop_runtime();
+        start_runtime(idle_engine_keep_alive);
+    }
+
     model::transform_metadata random_metadata() {
         _offset = model::next_offset(_offset);
         return {
@@ -305,4 +324,59 @@ TEST_F(WasmCacheTest, EngineReplacementBeforeGC) {
     EXPECT_EQ(state()->engines, 1);
 }
 
+TEST_F(WasmCacheTest, KeepsIdleEnginesRunning) {
+    restart_runtime(/*idle_engine_keep_alive=*/std::chrono::hours(1));
+    auto meta = random_metadata();
+    auto factory = ss::make_foreign(make_factory(meta));
+    auto engine = factory->make_engine().get();
+    engine->start().get();
+    engine->stop().get();
+    engine = nullptr;
+    // The engine is kept running without users
+    EXPECT_EQ(state()->engines, 1);
+    EXPECT_EQ(state()->running_engines, 1);
+    EXPECT_EQ(gc(), 0);
+    // And picked up again without being restarted
+    engine = factory->make_engine().get();
+    engine->start().get();
+    EXPECT_EQ(state()->running_engines, 1);
+    EXPECT_EQ(state()->engine_restarts, 0);
+    engine->stop().get();
+}
+
+TEST_F(WasmCacheTest, GCStopsIdleEngines) {
+    restart_runtime(/*idle_engine_keep_alive=*/std::chrono::milliseconds(1));
+    auto meta = random_metadata();
+    auto factory = ss::make_foreign(make_factory(meta));
+    auto engine = factory->make_engine().get();
+    engine->start().get();
+    engine->stop().get();
+    engine = nullptr;
+    EXPECT_EQ(state()->running_engines, 1);
+    // Wait past the keep alive with the coarse lowres clock
+    ss::sleep(std::chrono::milliseconds(50)).get();
+    EXPECT_EQ(gc(), 1);
+    EXPECT_EQ(state()->running_engines, 0);
+    EXPECT_EQ(state()->engines, 0);
+}
+
+TEST_F(WasmCacheTest, EvictsIdleEnginesForMemory) {
+    restart_runtime(/*idle_engine_keep_alive=*/std::chrono::hours(1));
+    state()->max_running_engines = 1;
+    auto factory_one = ss::make_foreign(make_factory(random_metadata()));
+    auto factory_two = ss::make_foreign(make_factory(random_metadata()));
+    auto engine_one = factory_one->make_engine().get();
+    engine_one->start().get();
+    engine_one->stop().get();
+    EXPECT_EQ(state()->running_engines, 1);
+    // Starting another engine stops the idle one to take its place
+    auto engine_two = factory_two->make_engine().get();
+    engine_two->start().get();
+    EXPECT_EQ(state()->running_engines, 1);
+    // Unless it's in use
+    EXPECT_THROW(engine_one->start().get(), wasm_exception);
+    engine_two->stop().get();
+    engine_one->stop().get();
+}
+
 } // namespace wasm
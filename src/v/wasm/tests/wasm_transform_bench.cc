@@ -45,7 +45,7 @@ public:
         _engine = nullptr;
         if (!_runtime) {
             _runtime = wasm::wasmtime::create_runtime(nullptr);
-            constexpr wasm::runtime::config wasm_runtime_config {
+            const wasm::runtime::config wasm_runtime_config {
                 .heap_memory = {
                   .per_core_pool_size_bytes = 20_MiB,
                   .per_engine_memory_limit = 20_MiB,
@@ -11,6 +11,7 @@
 
 #include "bytes/bytes.h"
 #include "pandaproxy/schema_registry/types.h"
+#include "storage/record_batch_builder.h"
 #include "test_utils/fixture.h"
 #include "test_utils/test.h"
 #include "wasm/errc.h"
@@ -35,6 +36,30 @@ TEST_F(WasmTestFixture, IdentityFunction) {
     ASSERT_EQ(transformed.copy_records(), batch.copy_records());
 }
 
+TEST_F(WasmTestFixture, FilterKeepsRecordsUnchanged) {
+    load_wasm("filter.wasm");
+    auto make_iobuf = [](std::string_view s) {
+        iobuf b;
+        b.append(s.data(), s.size());
+        return b;
+    };
+    storage::record_batch_builder b(
+      model::record_batch_type::raft_data, model::offset(1));
+    for (int i = 0; i < 10; ++i) {
+        b.add_raw_kv(
+          make_iobuf(fmt::format("key-{}", i)),
+          make_iobuf(fmt::format("{}-{}", i % 3 == 0 ? "keep" : "drop", i)));
+    }
+    auto transformed = transform(std::move(b).build());
+    auto records = transformed.copy_records();
+    ASSERT_EQ(records.size(), 4);
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].key(), make_iobuf(fmt::format("key-{}", i * 3)));
+        EXPECT_EQ(
+          records[i].value(), make_iobuf(fmt::format("keep-{}", i * 3)));
+    }
+}
+
 TEST_F(WasmTestFixture, CanRestartEngine) {
     load_wasm("identity.wasm");
     engine()->stop().get();
@@ -165,15 +165,15 @@ ss::future<int32_t> transform_module::read_next_record(
     *timestamp = record.timestamp();
     *offset = record.offset;
 
-    // Drop the metadata we already parsed
-    _call_ctx->batch_data.trim_front(record.metadata_size);
-    // Copy out the payload
+    // Drop the previous payload and the metadata we already parsed
+    _call_ctx->batch_data.trim_front(
+      std::exchange(_call_ctx->last_payload_size, record.payload_size)
+      + record.metadata_size);
+    // Copy out the payload, it's skipped over on the next read
     {
         iobuf_const_parser parser(_call_ctx->batch_data);
         parser.consume_to(record.payload_size, buf.data());
     }
-    // Skip over the payload
-    _call_ctx->batch_data.trim_front(record.payload_size);
 
     // Call back so we can refuel.
     _call_ctx->record_callback();
@@ -195,6 +195,19 @@ int32_t transform_module::write_record(ffi::array<uint8_t> buf) {
     return int32_t(buf.size());
 }
 
+int32_t transform_module::keep_record() {
+    // A record payload is never empty, so a zero size means that no record
+    // has been read yet.
+    if (!_call_ctx || _call_ctx->last_payload_size == 0) {
+        return NO_ACTIVE_TRANSFORM;
+    }
+    auto size = _call_ctx->last_payload_size;
+    _call_ctx->output_data.push_back(
+      model::transformed_data::from_record_payload(
+        _call_ctx->batch_data.share(0, size)));
+    return int32_t(size);
+}
+
 void transform_module::start() {
     _guest_cond_var.emplace();
     _host_cond_var.emplace();
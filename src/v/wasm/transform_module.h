@@ -48,6 +48,10 @@ struct batch_transform_context {
     size_t max_input_record_size{0};
     // The remaining records to transform
     ss::chunked_fifo<record_metadata> records;
+    // The size of the payload of the last record read by the guest, which is
+    // kept at the front of batch_data so that it can be shared if the guest
+    // keeps the record unchanged.
+    size_t last_payload_size{0};
     // The output data
     ss::chunked_fifo<model::transformed_data> output_data;
     // Called for every record that is consumed
@@ -121,6 +125,10 @@ public:
 
     int32_t write_record(ffi::array<uint8_t>);
 
+    // Write the last record read back unchanged, sharing the input payload
+    // instead of copying it out of the guest.
+    int32_t keep_record();
+
     // End ABI exports
 
 private:
@@ -22,6 +22,7 @@
 #include "vassert.h"
 #include "wasm/allocator.h"
 #include "wasm/api.h"
+#include "wasm/compilation_cache.h"
 #include "wasm/engine_probe.h"
 #include "wasm/errc.h"
 #include "wasm/ffi.h"
@@ -49,6 +50,7 @@
 #include <alloca.h>
 #include <cmath>
 #include <csignal>
+#include <filesystem>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -148,12 +150,18 @@ private:
     wasmtime_error_t* allocate_heap_memory(
       heap_allocator::request, wasmtime_linear_memory_t* memory_ret);
 
+    // Load the compiled module from the compilation cache, or compile it.
+    // Runs on the alien thread.
+    handle<wasmtime_module_t, wasmtime_module_delete>
+    load_or_compile_module(const model::transform_metadata&, bytes_view);
+
     handle<wasm_engine_t, &wasm_engine_delete> _engine;
     std::unique_ptr<schema_registry> _sr;
     ssx::singleton_thread_worker _alien_thread;
     ss::sharded<wasm::heap_allocator> _heap_allocator;
     ss::sharded<stack_allocator> _stack_allocator;
     size_t _total_executable_memory = 0;
+    std::optional<compilation_cache> _compilation_cache;
     metrics::public_metric_groups _public_metrics;
     ss::sharded<wasm::engine_probe_cache> _engine_probe_cache;
 };
@@ -1175,6 +1183,7 @@ void register_transform_module(
     REG_HOST_FN(read_batch_header);
     REG_HOST_FN(read_next_record);
     REG_HOST_FN(write_record);
+    REG_HOST_FN(keep_record);
 #undef REG_HOST_FN
 }
 
@@ -1319,6 +1328,19 @@ ss::future<> wasmtime_runtime::start(runtime::config c) {
       .tracking_enabled = c.stack_memory.debug_host_stack_usage,
     });
     co_await _alien_thread.start({.name = "wasm"});
+    if (c.compilation_cache.directory) {
+        // compiled modules of transforms that are gone are removed after a
+        // week, the modules of running transforms are used on every start
+        constexpr static auto max_unused_age = std::chrono::hours(24 * 7);
+        _compilation_cache.emplace(*c.compilation_cache.directory);
+        auto removed = co_await _alien_thread.submit(
+          [this] { return _compilation_cache->start(max_unused_age); });
+        vlog(
+          wasm_log.info,
+          "Using wasm compilation cache at {}, removed {} unused modules",
+          c.compilation_cache.directory->native(),
+          removed);
+    }
     co_await ss::smp::invoke_on_all([] {
         // wasmtime needs some signals for it's handling, make sure we
         // unblock them.
@@ -1369,18 +1391,10 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
     };
     size_t memory_usage_size = co_await _alien_thread.submit(
       [this, &meta, &buf, &preinitialized, &ssc] {
-          vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
           // This can be a large contiguous allocation, however it happens
           // on an alien thread so it bypasses the seastar allocator.
           bytes b = iobuf_to_bytes(buf);
-          wasmtime_module_t* user_module_ptr = nullptr;
-          handle<wasmtime_error_t, wasmtime_error_delete> error{
-            wasmtime_module_new(
-              _engine.get(), b.data(), b.size(), &user_module_ptr)};
-          check_error(error.get());
-          handle<wasmtime_module_t, wasmtime_module_delete> user_module{
-            user_module_ptr};
-          wasm_log.info("Finished compiling wasm module {}", meta.name);
+          auto user_module = load_or_compile_module(meta, b);
 
           handle<wasmtime_linker_t, wasmtime_linker_delete> linker{
             wasmtime_linker_new(_engine.get())};
@@ -1390,8 +1404,9 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
           register_wasi_module(linker.get(), ssc);
 
           wasmtime_instance_pre_t* preinitialized_ptr = nullptr;
-          error.reset(wasmtime_linker_instantiate_pre(
-            linker.get(), user_module.get(), &preinitialized_ptr));
+          handle<wasmtime_error_t, wasmtime_error_delete> error{
+            wasmtime_linker_instantiate_pre(
+              linker.get(), user_module.get(), &preinitialized_ptr)};
           preinitialized->_underlying.reset(preinitialized_ptr);
           preinitialized->_memory_limits = lookup_memory_limits(
             user_module.get());
@@ -1413,6 +1428,74 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
       logger);
 }
 
+handle<wasmtime_module_t, wasmtime_module_delete>
+wasmtime_runtime::load_or_compile_module(
+  const model::transform_metadata& meta, bytes_view b) {
+    std::optional<std::filesystem::path> cached;
+    if (_compilation_cache) {
+        cached = _compilation_cache->path_for(b);
+        std::error_code ec;
+        if (std::filesystem::exists(*cached, ec)) {
+            // wasmtime rejects artifacts of other versions, engine settings or
+            // CPU features
+            wasmtime_module_t* module_ptr = nullptr;
+            handle<wasmtime_error_t, wasmtime_error_delete> error{
+              wasmtime_module_deserialize_file(
+                _engine.get(), cached->c_str(), &module_ptr)};
+            try {
+                check_error(error.get());
+                _compilation_cache->touch(*cached);
+                vlog(
+                  wasm_log.info,
+                  "Loaded compiled wasm module {} from {}",
+                  meta.name,
+                  cached->native());
+                return handle<wasmtime_module_t, wasmtime_module_delete>{
+                  module_ptr};
+            } catch (...) {
+                vlog(
+                  wasm_log.warn,
+                  "Unable to load compiled wasm module {} from {}, compiling "
+                  "it again: {}",
+                  meta.name,
+                  cached->native(),
+                  std::current_exception());
+                _compilation_cache->remove(*cached);
+            }
+        }
+    }
+
+    vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
+    wasmtime_module_t* user_module_ptr = nullptr;
+    handle<wasmtime_error_t, wasmtime_error_delete> error{wasmtime_module_new(
+      _engine.get(), b.data(), b.size(), &user_module_ptr)};
+    check_error(error.get());
+    handle<wasmtime_module_t, wasmtime_module_delete> user_module{
+      user_module_ptr};
+    wasm_log.info("Finished compiling wasm module {}", meta.name);
+
+    if (cached) {
+        wasm_byte_vec_t artifact{.size = 0, .data = nullptr};
+        auto free_artifact = ss::defer(
+          [&artifact] { wasm_byte_vec_delete(&artifact); });
+        try {
+            error.reset(
+              wasmtime_module_serialize(user_module.get(), &artifact));
+            check_error(error.get());
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            const auto* data = reinterpret_cast<const uint8_t*>(artifact.data);
+            _compilation_cache->store(*cached, bytes_view(data, artifact.size));
+        } catch (...) {
+            vlog(
+              wasm_log.warn,
+              "Unable to save compiled wasm module {}: {}",
+              meta.name,
+              std::current_exception());
+        }
+    }
+    return user_module;
+}
+
 wasm_engine_t* wasmtime_runtime::engine() const { return _engine.get(); }
 heap_allocator* wasmtime_runtime::heap_allocator() {
     return &_heap_allocator.local();
@@ -81,6 +81,8 @@ class TopicSpec:
 
     PROPERTY_INITIAL_RETENTION_LOCAL_TARGET_BYTES = "initial.retention.local.target.bytes"
     PROPERTY_INITIAL_RETENTION_LOCAL_TARGET_MS = "initial.retention.local.target.ms"
+    PROPERTY_WRITE_CACHING = "write.caching"
+    PROPERTY_OBSERVER_REPLICAS = "redpanda.observer.replicas"
 
     def __init__(self,
                  *,
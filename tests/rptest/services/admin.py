@@ -1165,16 +1165,30 @@ class Admin:
                                ns: str | None = None,
                                topic: str | None = None,
                                disabled: bool | None = None,
+                               topic_prefix: str | None = None,
+                               start_after: str | None = None,
+                               limit: int | None = None,
                                node=None):
+        params = {}
         if topic is not None:
             assert ns is not None
             req = f"cluster/partitions/{ns}/{topic}"
         else:
-            assert ns is None
             req = f"cluster/partitions"
+            if ns is not None:
+                params["namespace"] = ns
+            if topic_prefix is not None:
+                params["topic_prefix"] = topic_prefix
+            if start_after is not None:
+                params["start_after"] = start_after
+            if limit is not None:
+                params["limit"] = limit
 
         if disabled is not None:
-            req += f"?disabled={disabled}"
+            params["disabled"] = disabled
+
+        if params:
+            req += "?" + "&".join(f"{k}={v}" for k, v in params.items())
 
         return self._request("GET", req, node=node).json()
 
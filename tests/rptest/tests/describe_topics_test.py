@@ -221,6 +221,20 @@ class DescribeTopicsTest(RedpandaTest):
                 "storage write enabled. If no initial local target retention is "
                 "configured all locally retained data will be delivered to learner when "
                 "joining partition replica set"),
+            "write.caching":
+            ConfigProperty(
+                config_type="BOOLEAN",
+                value="false",
+                doc_string=
+                "Acknowledge acks=all writes once a majority of the replicas "
+                "appended them, before they are flushed to disk"),
+            "redpanda.observer.replicas":
+            ConfigProperty(
+                config_type="SHORT",
+                value="0",
+                doc_string=
+                "Number of replicas of every partition which replicate the "
+                "log without voting and serve fetches"),
         }
 
         tp_spec = TopicSpec()